@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/ObjectStreamImageAssetData.h>
+#include <AzCore/Asset/AssetDataStream.h>
+
+namespace AZ::Data
+{
+    ObjectStreamImageAssetData::ObjectStreamImageAssetData(const Uuid& rootTypeId, const AssetId& assetId, AssetStatus status)
+        : AssetData(assetId, status)
+        , m_rootTypeId(rootTypeId)
+    {
+    }
+
+    bool ObjectStreamImageAssetData::LoadObjectStreamImage(AssetDataStream& stream, const SerializeContext& serializeContext)
+    {
+        return m_image.Load(stream, serializeContext, m_rootTypeId);
+    }
+
+    bool ObjectStreamImageAssetData::SaveObjectStreamImage(IO::GenericStream& stream) const
+    {
+        return m_image.Write(stream);
+    }
+
+    const Uuid& ObjectStreamImageAssetData::GetRootTypeId() const
+    {
+        return m_rootTypeId;
+    }
+
+    const ObjectStreamImage& ObjectStreamImageAssetData::GetImage() const
+    {
+        return m_image;
+    }
+} // namespace AZ::Data
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Serialization/ObjectStreamImage.h>
+
+namespace AZ::Data
+{
+    class AssetDataStream;
+
+    //! Base class for assets whose data is stored as an AZ::ObjectStreamImage instead of an ObjectStream.
+    //! Asset handlers load these assets with a single read of the image rather than deserializing them, and the data of the
+    //! asset is used in place through GetRoot(). AzFramework::GenericAssetHandler does this for asset types deriving from this class.
+    class ObjectStreamImageAssetData
+        : public AssetData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ObjectStreamImageAssetData, SystemAllocator, 0);
+        AZ_RTTI(ObjectStreamImageAssetData, "{A7C1E5D3-2B94-4F08-9E6A-5D3B1C7F0E24}", AssetData);
+
+        //! @param rootTypeId Type of the root object of the images of this asset, which has to opt into ObjectStreamImages.
+        explicit ObjectStreamImageAssetData(const Uuid& rootTypeId, const AssetId& assetId = AssetId(),
+            AssetStatus status = AssetStatus::NotLoaded);
+        ~ObjectStreamImageAssetData() override = default;
+
+        //! Loads the image of the asset, the stream has to hold an image of the root type for its current layout.
+        bool LoadObjectStreamImage(AssetDataStream& stream, const SerializeContext& serializeContext);
+        //! Writes the loaded image to the stream.
+        bool SaveObjectStreamImage(IO::GenericStream& stream) const;
+
+        const Uuid& GetRootTypeId() const;
+        const ObjectStreamImage& GetImage() const;
+
+        //! Returns the root object of the image or null if the asset isn't loaded or the root object isn't a T.
+        template<class T>
+        const T* GetRoot() const
+        {
+            return m_image.GetRoot<T>();
+        }
+
+    private:
+        Uuid m_rootTypeId;
+        ObjectStreamImage m_image;
+    };
+} // namespace AZ::Data
@@ -7,6 +7,7 @@
  */
 
 #include <cctype>
+#include <cerrno>
 
 #include <AzCore/AzCoreModule.h>
 
@@ -23,6 +24,7 @@
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -93,6 +95,68 @@ static void PrintEntityName(const AZ::ConsoleCommandContainer& arguments)
 AZ_CONSOLEFREEFUNC(
     PrintEntityName, AZ::ConsoleFunctorFlags::Null, "Parameter: EntityId value, Prints the name of the entity to the console");
 
+static void StartHeapSampling(const AZ::ConsoleCommandContainer& arguments)
+{
+    size_t samplingInterval = AZ::Debug::AllocationRecords::DefaultSamplingInterval;
+    if (!arguments.empty())
+    {
+        // An interval of 0 would stop the sampling, StopHeapSampling does that
+        const AZStd::string intervalString(arguments.front());
+        errno = 0;
+        samplingInterval = aznumeric_cast<size_t>(strtoull(intervalString.c_str(), nullptr, 10));
+        if (intervalString.empty() || intervalString.find_first_not_of("0123456789") != AZStd::string::npos || errno == ERANGE ||
+            samplingInterval == 0)
+        {
+            AZ_Error("Memory", false, "StartHeapSampling expects a positive number of bytes, got '%s'", intervalString.c_str());
+            return;
+        }
+    }
+
+    AZ::AllocatorManager::Instance().SetHeapSampling(samplingInterval);
+    AZ_Printf("Memory", "Sampling one allocation every %zu bytes on average", samplingInterval);
+}
+
+AZ_CONSOLEFREEFUNC(
+    StartHeapSampling, AZ::ConsoleFunctorFlags::Null,
+    "Parameter: average number of bytes between two samples (default 512 KiB), Samples the allocations of all the allocators with their stack");
+
+static void StopHeapSampling([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+{
+    AZ::AllocatorManager::Instance().SetHeapSampling(0);
+}
+
+AZ_CONSOLEFREEFUNC(StopHeapSampling, AZ::ConsoleFunctorFlags::Null, "Stops sampling the allocations and frees the samples");
+
+static void DumpHeapProfile(const AZ::ConsoleCommandContainer& arguments)
+{
+    AZ::IO::FixedMaxPath filePath;
+    if (!arguments.empty())
+    {
+        filePath = arguments.front();
+    }
+    else
+    {
+        if (auto registry = AZ::SettingsRegistry::Get(); registry != nullptr)
+        {
+            registry->Get(filePath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_DevWriteStorage);
+        }
+        filePath /= "heap.prof";
+    }
+
+    if (AZ::AllocatorManager::Instance().WriteHeapProfile(filePath.c_str()))
+    {
+        AZ_Printf("Memory", "Heap profile written to %s", filePath.c_str());
+    }
+    else
+    {
+        AZ_Error("Memory", false, "Failed to write the heap profile to %s", filePath.c_str());
+    }
+}
+
+AZ_CONSOLEFREEFUNC(
+    DumpHeapProfile, AZ::ConsoleFunctorFlags::Null,
+    "Parameter: file path (default heap.prof in the user folder), Writes the live allocation samples as a pprof heap profile");
+
 namespace AZ
 {
     static EnvironmentVariable<OverrunDetectionSchema> s_overrunDetectionSchema;
@@ -332,7 +396,8 @@ namespace AZ
                     ->Value("No records", Debug::AllocationRecords::RECORD_NO_RECORDS)
                     ->Value("No stack trace", Debug::AllocationRecords::RECORD_STACK_NEVER)
                     ->Value("Stack trace when file/line missing", Debug::AllocationRecords::RECORD_STACK_IF_NO_FILE_LINE)
-                    ->Value("Stack trace always", Debug::AllocationRecords::RECORD_FULL);
+                    ->Value("Stack trace always", Debug::AllocationRecords::RECORD_FULL)
+                    ->Value("Sampled with stack trace", Debug::AllocationRecords::RECORD_SAMPLED);
                 ec->Class<Descriptor>("System memory settings", "Settings for managing application memory usage")
                     ->ClassElement(Edit::ClassElements::EditorData, "")
                         ->Attribute(Edit::Attributes::AutoExpand, true)
@@ -407,6 +472,7 @@ namespace AZ
     ComponentApplication::ComponentApplication(int argC, char** argV)
         : m_eventLogger{}
         , m_timeSystem(AZStd::make_unique<TimeSystem>())
+        , m_constructionTimeUs(AZStd::GetTimeNowMicroSecond())
     {
         if (Interface<ComponentApplicationRequests>::Get() == nullptr)
         {
@@ -645,6 +711,12 @@ namespace AZ
 
         Sfmt::Create();
 
+        if (!AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+            m_isFrameArenaAllocatorOwner = true;
+        }
+
         CreateReflectionManager();
 
         if (m_startupParameters.m_createEditContext)
@@ -788,6 +860,12 @@ namespace AZ
 
     void ComponentApplication::DestroyAllocator()
     {
+        if (m_isFrameArenaAllocatorOwner)
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            m_isFrameArenaAllocatorOwner = false;
+        }
+
         // kill the system allocator if we created it
         if (m_isSystemAllocatorOwner)
         {
@@ -928,9 +1006,20 @@ namespace AZ
 
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_TargetBuildDependencyRegistry(registry,
             AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+        //! The Engine, Gem and Project registries are merged through a snapshot in development builds.
+        //! Processes sharing a platform and specializations, such as the AssetBuilders launched by the AssetProcessor,
+        //! then merge a single pre-merged file written by the first of them instead of every registry folder.
+        AZ::IO::FixedMaxPath mergedSnapshotPath;
+#if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
+        bool useMergedSnapshot = true;
+        registry.Get(useMergedSnapshot, SettingsRegistryMergeUtils::MergedSnapshotEnabledKey);
+        if (useMergedSnapshot)
+        {
+            mergedSnapshotPath = SettingsRegistryMergeUtils::GetMergedSnapshotPath(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations);
+        }
+#endif
+        SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineGemProjectRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations,
+            mergedSnapshotPath.Native(), &scratchBuffer);
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_O3deUserRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, false);
@@ -1329,10 +1418,21 @@ namespace AZ
 #endif
     }
 
+    void ComponentApplication::StartFrameArenaFrame()
+    {
+        // The temporaries allocated by the handlers of the previous tick are reclaimed
+        if (AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+        {
+            static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get()).NewFrame();
+        }
+    }
+
     void ComponentApplication::Tick()
     {
         AZ_PROFILE_SCOPE(System, "Component application simulation tick");
 
+        StartFrameArenaFrame();
+
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedEvents");
             TickBus::ExecuteQueuedEvents();
@@ -1345,6 +1445,18 @@ namespace AZ
             AZ::TickBus::Broadcast(&TickEvents::OnTick, deltaTimeSeconds, GetTimeAtCurrentTick());
         }
 
+        // Measured before the tick rate limiter, which may sleep
+        if (!m_hasTicked)
+        {
+            m_hasTicked = true;
+            const AZ::u64 timeToFirstTickMs = aznumeric_cast<AZ::u64>(AZStd::GetTimeNowMicroSecond() - m_constructionTimeUs) / 1000;
+            if (m_settingsRegistry)
+            {
+                m_settingsRegistry->Set(TimeToFirstTickKey, timeToFirstTickMs);
+            }
+            AZ_Printf("ComponentApplication", "Time to first tick: %" PRIu64 " ms", timeToFirstTickMs);
+        }
+
         m_timeSystem->ApplyTickRateLimiterIfNeeded();
     }
 
@@ -1352,6 +1464,8 @@ namespace AZ
     {
         AZ_PROFILE_SCOPE(System, "Component application tick");
 
+        StartFrameArenaFrame();
+
         SystemTickBus::ExecuteQueuedEvents();
         EBUS_EVENT(SystemTickBus, OnSystemTick);
     }
@@ -29,6 +29,7 @@
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/osstring.h>
+#include <AzCore/std/time.h>
 
 
 namespace AZ
@@ -230,6 +231,10 @@ namespace AZ
 
         Descriptor& GetDescriptor() { return m_descriptor; }
 
+        //! Key under which the first Tick stores the milliseconds elapsed since the application was constructed.
+        //! It covers the startup work such as merging the Settings Registry and loading the modules.
+        static constexpr const char* TimeToFirstTickKey = "/O3DE/Runtime/Startup/TimeToFirstTickMs";
+
         /**
          * Ticks all components using the \ref AZ::TickBus during simulation time. May not tick if the application is not active (i.e. not in focus)
          */
@@ -316,6 +321,9 @@ namespace AZ
         /// Create the system allocator using the data in the m_descriptor
         void        CreateSystemAllocator();
 
+        /// Start a new frame of the FrameArenaAllocator, called at the beginning of Tick and TickSystem
+        void        StartFrameArenaFrame();
+
         virtual void MergeSettingsToRegistry(SettingsRegistryInterface& registry);
 
         //! Sets the specializations that will be used when loading the Settings Registry. Extend this in derived
@@ -366,6 +374,7 @@ namespace AZ
         bool                                        m_isStarted{ false };
         bool                                        m_isSystemAllocatorOwner{ false };
         bool                                        m_isOSAllocatorOwner{ false };
+        bool                                        m_isFrameArenaAllocatorOwner{ false };
         bool                                        m_ownsConsole{};
         void*                                       m_fixedMemoryBlock{ nullptr }; //!< Pointer to the memory block allocator, so we can free it OnDestroy.
         IAllocator*                                 m_osAllocator{ nullptr };
@@ -376,6 +385,8 @@ namespace AZ
         AZ::SettingsRegistryInterface::NotifyEventHandler m_commandLineUpdatedHandler;
 
         AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::sys_time_t m_constructionTimeUs{}; //!< Time at which the application was constructed, to measure the time to the first tick.
+        bool m_hasTicked{ false };
 
         // ConsoleFunctorHandle is responsible for unregistering the Settings Registry Console
         // from the m_console member when it goes out of scope
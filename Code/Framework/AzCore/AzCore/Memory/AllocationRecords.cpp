@@ -16,11 +16,45 @@
 
 #include <AzCore/Debug/StackTracer.h>
 
+#include <math.h>
+
 namespace AZ::Debug
 {
     // Many PC tools break with alloc/free size mismatches when the memory guard is enabled.  Disable for now
     //#define ENABLE_MEMORY_GUARD
 
+    namespace
+    {
+        // The sampling state of a thread is shared by all the allocators. The distance to the next sample is counted in
+        // sampling intervals, so allocators with different intervals can share it.
+        thread_local double t_intervalsToNextSample = -1.0;
+        thread_local AZ::u64 t_samplingRandomState = 0;
+        AZStd::atomic<AZ::u64> s_samplingSeed{ 0 };
+
+        double NextSampleDistance()
+        {
+            if (t_samplingRandomState == 0)
+            {
+                t_samplingRandomState = (s_samplingSeed.fetch_add(1, AZStd::memory_order_relaxed) + 1) * 0x9E3779B97F4A7C15ull;
+            }
+
+            // xorshift64*
+            t_samplingRandomState ^= t_samplingRandomState >> 12;
+            t_samplingRandomState ^= t_samplingRandomState << 25;
+            t_samplingRandomState ^= t_samplingRandomState >> 27;
+            const AZ::u64 random = t_samplingRandomState * 0x2545F4914F6CDD1Dull;
+
+            // The distance between two samples of a Poisson process follows an exponential distribution
+            const double uniform = static_cast<double>((random >> 11) + 1) * (1.0 / 9007199254740992.0); // (0, 1]
+            return -log(uniform);
+        }
+
+        size_t GetSampleFilterIndex(void* address, size_t filterSize)
+        {
+            return static_cast<size_t>(((reinterpret_cast<AZ::u64>(address) >> 4) * 0x9E3779B97F4A7C15ull) >> 48) & (filterSize - 1);
+        }
+    } // namespace
+
     //=========================================================================
     // AllocationRecords
     // [9/16/2009]
@@ -41,8 +75,18 @@ namespace AZ::Debug
         , m_requestedAllocs(0)
         , m_requestedBytes(0)
         , m_requestedBytesPeak(0)
+        , m_samplingInterval(DefaultSamplingInterval)
+        , m_samplingRate(1.0 / DefaultSamplingInterval)
+        , m_sampleFilter(nullptr)
         , m_allocatorName(allocatorName)
     {
+        // Allocators created while the heap is sampled are sampled too
+        const size_t heapSamplingInterval = AllocatorManager::Instance().m_heapSamplingInterval;
+        if (heapSamplingInterval > 0)
+        {
+            SetSamplingInterval(heapSamplingInterval);
+            SetMode(RECORD_SAMPLED);
+        }
     }
 
     //=========================================================================
@@ -60,6 +104,12 @@ namespace AZ::Debug
                 "Memory", m_records.empty(), "We still have %d allocations on record! They must be freed prior to destroy!",
                 m_records.size());
         }
+
+        if (m_sampleFilter)
+        {
+            m_records.get_allocator().deallocate(m_sampleFilter, sizeof(AZStd::atomic<AZ::u8>) * SampleFilterSize, alignof(AZStd::atomic<AZ::u8>));
+            m_sampleFilter = nullptr;
+        }
     }
 
     //=========================================================================
@@ -125,10 +175,22 @@ namespace AZ::Debug
             new (reinterpret_cast<char*>(address) + byteSize) Debug::GuardValue();
         }
 
+        // In sampled mode most allocations are skipped here, without taking the lock
+        const bool isSampled = m_mode == RECORD_SAMPLED;
+        size_t sampledBytes = 0;
+        if (isSampled && !SampleAllocation(byteSize, sampledBytes))
+        {
+            return nullptr;
+        }
+
         Debug::AllocationRecordsType::pair_iter_bool iterBool;
         {
             AZStd::scoped_lock lock(m_recordsMutex);
             iterBool = m_records.insert_key(address);
+            if (isSampled && iterBool.second)
+            {
+                UpdateSampleFilter(address, true);
+            }
         }
 
         if (!iterBool.second)
@@ -171,9 +233,10 @@ namespace AZ::Debug
         }
         ai.m_lineNum = lineNum;
         ai.m_timeStamp = AZStd::GetTimeNowMicroSecond();
+        ai.m_sampledBytes = sampledBytes;
 
         // if we don't have a fileName,lineNum record the stack or if the user requested it.
-        if ((fileName == nullptr && m_mode == RECORD_STACK_IF_NO_FILE_LINE) || m_mode == RECORD_FULL)
+        if ((fileName == nullptr && m_mode == RECORD_STACK_IF_NO_FILE_LINE) || m_mode == RECORD_FULL || isSampled)
         {
             ai.m_stackFrames = m_numStackLevels ? reinterpret_cast<AZ::Debug::StackFrame*>(m_records.get_allocator().allocate(
                                                       sizeof(AZ::Debug::StackFrame) * m_numStackLevels, 1))
@@ -244,6 +307,10 @@ namespace AZ::Debug
         {
             return;
         }
+        if (m_mode == RECORD_SAMPLED && !IsMaybeSampled(address))
+        {
+            return;
+        }
 
         AllocationInfo allocationInfo;
         {
@@ -258,6 +325,10 @@ namespace AZ::Debug
             }
             allocationInfo = iter->second;
             m_records.erase(iter);
+            if (m_mode == RECORD_SAMPLED)
+            {
+                UpdateSampleFilter(address, false);
+            }
 
             // try to be more aggressive and keep the memory footprint low.
             // \todo store the load factor at the last rehash to avoid unnecessary rehash
@@ -343,12 +414,20 @@ namespace AZ::Debug
         {
             return;
         }
+        if (m_mode == RECORD_SAMPLED && !IsMaybeSampled(address))
+        {
+            return;
+        }
 
         AllocationInfo* allocationInfo;
         {
             AZStd::scoped_lock lock(m_recordsMutex);
             Debug::AllocationRecordsType::iterator iter = m_records.find(address);
-            AZ_Assert(iter != m_records.end(), "Could not find address 0x%p in the allocator!", address);
+            AZ_Assert(iter != m_records.end() || m_mode == RECORD_SAMPLED, "Could not find address 0x%p in the allocator!", address);
+            if (iter == m_records.end())
+            {
+                return;
+            }
             allocationInfo = &iter->second;
         }
         AllocatorManager::Instance().DebugBreak(address, *allocationInfo);
@@ -403,25 +482,205 @@ namespace AZ::Debug
     //=========================================================================
     void AllocationRecords::SetMode(Mode mode)
     {
-        if (mode == RECORD_NO_RECORDS)
+        // The sampled mode only keeps samples, the records of the other modes are dropped when it starts and the samples when it stops
+        const bool isSamplingStarted = mode == RECORD_SAMPLED && m_mode != RECORD_SAMPLED;
+        const bool isSamplingStopped = mode != RECORD_SAMPLED && m_mode == RECORD_SAMPLED;
+        if (mode == RECORD_NO_RECORDS || isSamplingStarted || isSamplingStopped)
         {
             {
                 AZStd::scoped_lock lock(m_recordsMutex);
-                m_records.clear();
+                ClearRecords();
+
+                if (isSamplingStarted)
+                {
+                    if (!m_sampleFilter)
+                    {
+                        void* filter = m_records.get_allocator().allocate(sizeof(AZStd::atomic<AZ::u8>) * SampleFilterSize, alignof(AZStd::atomic<AZ::u8>));
+                        m_sampleFilter = reinterpret_cast<AZStd::atomic<AZ::u8>*>(filter);
+                        for (size_t i = 0; i < SampleFilterSize; ++i)
+                        {
+                            new (&m_sampleFilter[i]) AZStd::atomic<AZ::u8>(0);
+                        }
+                    }
+                    // a sample without its stack can't be attributed to a call site
+                    m_numStackLevels = AZStd::GetMax(m_numStackLevels, SampledStackLevels);
+                }
             }
             m_requestedBytes = 0;
             m_requestedBytesPeak = 0;
             m_requestedAllocs = 0;
         }
 
+        // Sampled mode ignores the allocations it doesn't know about
         AZ_Warning(
-            "Memory", m_mode != RECORD_NO_RECORDS || mode == RECORD_NO_RECORDS,
+            "Memory", m_mode != RECORD_NO_RECORDS || mode == RECORD_NO_RECORDS || mode == RECORD_SAMPLED,
             "Records recording was disabled and now it's enabled! You might get assert when you free memory, if a you have allocations "
             "which were not recorded!");
 
         m_mode = mode;
     }
 
+    //=========================================================================
+    // SetSamplingInterval
+    //=========================================================================
+    void AllocationRecords::SetSamplingInterval(size_t samplingInterval)
+    {
+        AZ_Assert(samplingInterval > 0, "The sampling interval must be at least one byte");
+        m_samplingInterval = samplingInterval;
+        m_samplingRate = 1.0 / static_cast<double>(samplingInterval);
+    }
+
+    //=========================================================================
+    // SampleAllocation
+    //=========================================================================
+    bool AllocationRecords::SampleAllocation(size_t byteSize, size_t& sampledBytes) const
+    {
+        if (byteSize == 0)
+        {
+            return false;
+        }
+        if (t_intervalsToNextSample < 0.0)
+        {
+            t_intervalsToNextSample = NextSampleDistance();
+        }
+
+        const double intervals = static_cast<double>(byteSize) * m_samplingRate;
+        t_intervalsToNextSample -= intervals;
+        if (t_intervalsToNextSample > 0.0)
+        {
+            return false;
+        }
+        t_intervalsToNextSample = NextSampleDistance();
+
+        // An allocation is sampled with a probability of 1 - exp(-byteSize / interval), dividing by it makes the estimate unbiased
+        sampledBytes = static_cast<size_t>(static_cast<double>(byteSize) / -expm1(-intervals));
+        return true;
+    }
+
+    //=========================================================================
+    // IsMaybeSampled
+    //=========================================================================
+    bool AllocationRecords::IsMaybeSampled(void* address) const
+    {
+        return !m_sampleFilter || m_sampleFilter[GetSampleFilterIndex(address, SampleFilterSize)].load(AZStd::memory_order_relaxed) != 0;
+    }
+
+    //=========================================================================
+    // UpdateSampleFilter
+    //=========================================================================
+    void AllocationRecords::UpdateSampleFilter(void* address, bool isAdded)
+    {
+        // Called with the lock held, only the readers are concurrent
+        if (!m_sampleFilter)
+        {
+            return;
+        }
+        AZStd::atomic<AZ::u8>& count = m_sampleFilter[GetSampleFilterIndex(address, SampleFilterSize)];
+        const AZ::u8 value = count.load(AZStd::memory_order_relaxed);
+        if (value == AZStd::numeric_limits<AZ::u8>::max() || (!isAdded && value == 0))
+        {
+            // a saturated count stays set, the addresses that share it always take the lock
+            return;
+        }
+        count.store(isAdded ? value + 1 : value - 1, AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // ClearRecords
+    //=========================================================================
+    void AllocationRecords::ClearRecords()
+    {
+        for (auto& record : m_records)
+        {
+            AllocationInfo& allocationInfo = record.second;
+            if (allocationInfo.m_namesBlock)
+            {
+                m_records.get_allocator().deallocate(allocationInfo.m_namesBlock, allocationInfo.m_namesBlockSize, 1);
+            }
+            if (allocationInfo.m_stackFrames)
+            {
+                m_records.get_allocator().deallocate(allocationInfo.m_stackFrames, sizeof(AZ::Debug::StackFrame) * m_numStackLevels, 1);
+            }
+        }
+        m_records.clear();
+
+        if (m_sampleFilter)
+        {
+            for (size_t i = 0; i < SampleFilterSize; ++i)
+            {
+                m_sampleFilter[i].store(0, AZStd::memory_order_relaxed);
+            }
+        }
+    }
+
+    //=========================================================================
+    // GatherHeapProfile
+    //=========================================================================
+    void AllocationRecords::GatherHeapProfile(HeapProfile& profile)
+    {
+        auto hashSite = [](const HeapProfileSite& site)
+        {
+            size_t hash = AZStd::hash<const char*>()(site.m_fileName);
+            AZStd::hash_combine(hash, site.m_lineNum);
+            for (uintptr_t programCounter : site.m_stack)
+            {
+                AZStd::hash_combine(hash, programCounter);
+            }
+            return hash;
+        };
+
+        using SiteIndices = AZStd::unordered_multimap<size_t, size_t, AZStd::hash<size_t>, AZStd::equal_to<size_t>, OSStdAllocator>;
+        SiteIndices siteIndices;
+        for (size_t siteIndex = 0; siteIndex < profile.size(); ++siteIndex)
+        {
+            siteIndices.emplace(hashSite(profile[siteIndex]), siteIndex);
+        }
+
+        // The stacks are freed with their samples, so the profile is gathered with the lock held. It only allocates from the OS allocator.
+        AZStd::scoped_lock lock(m_recordsMutex);
+        HeapProfileSite sampleSite;
+        for (const auto& record : m_records)
+        {
+            const AllocationInfo& allocationInfo = record.second;
+            sampleSite.m_fileName = allocationInfo.m_fileName;
+            sampleSite.m_lineNum = allocationInfo.m_lineNum;
+            sampleSite.m_stack.clear();
+            for (unsigned char level = 0; allocationInfo.m_stackFrames && level < m_numStackLevels; ++level)
+            {
+                if (!allocationInfo.m_stackFrames[level].IsValid())
+                {
+                    break;
+                }
+                sampleSite.m_stack.push_back(allocationInfo.m_stackFrames[level].m_programCounter);
+            }
+
+            const size_t hash = hashSite(sampleSite);
+            HeapProfileSite* site = nullptr;
+            for (auto [first, last] = siteIndices.equal_range(hash); first != last; ++first)
+            {
+                HeapProfileSite& candidate = profile[first->second];
+                if (candidate.m_fileName == sampleSite.m_fileName && candidate.m_lineNum == sampleSite.m_lineNum &&
+                    candidate.m_stack == sampleSite.m_stack)
+                {
+                    site = &candidate;
+                    break;
+                }
+            }
+            if (!site)
+            {
+                siteIndices.emplace(hash, profile.size());
+                site = &profile.emplace_back(sampleSite);
+            }
+
+            // Without sampling, every allocation is recorded
+            const size_t estimatedBytes = allocationInfo.m_sampledBytes ? allocationInfo.m_sampledBytes : allocationInfo.m_byteSize;
+            site->m_sampleCount += 1;
+            site->m_sampleBytes += allocationInfo.m_byteSize;
+            site->m_estimatedBytes += estimatedBytes;
+            site->m_estimatedCount += allocationInfo.m_byteSize ? estimatedBytes / allocationInfo.m_byteSize : 1;
+        }
+    }
+
     //=========================================================================
     // EnumerateAllocations
     // [9/29/2009]
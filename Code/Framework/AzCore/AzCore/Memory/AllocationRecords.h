@@ -14,6 +14,7 @@
 
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ
 {
@@ -37,6 +38,7 @@ namespace AZ
             AZ::Debug::StackFrame*  m_stackFrames{};
 
             AZ::u64         m_timeStamp{}; ///< Timestamp for sorting/tracking allocations
+            size_t          m_sampledBytes{}; ///< In sampled mode, estimated number of bytes allocated by the call site that this sample stands for.
         };
 
         // We use OSAllocator which uses system calls to allocate memory, they are not recorded or tracked!
@@ -50,6 +52,21 @@ namespace AZ
          * \returns true if you want to continue traverse of the records and false if you want to stop.
          */
         using AllocationInfoCBType = AZStd::function<bool (void*, const AllocationInfo&, unsigned char)>;
+
+        /**
+         * Live allocations of one call site, estimated from the samples of the sampled recording mode.
+         */
+        struct HeapProfileSite
+        {
+            AZStd::vector<uintptr_t, OSStdAllocator> m_stack; ///< Program counters of the call site, innermost first.
+            const char*     m_fileName{};
+            int             m_lineNum{};
+            size_t          m_sampleCount{};        ///< Number of live samples.
+            size_t          m_sampleBytes{};        ///< Bytes of the live samples.
+            size_t          m_estimatedCount{};     ///< Estimated number of live allocations.
+            size_t          m_estimatedBytes{};     ///< Estimated number of live bytes.
+        };
+        using HeapProfile = AZStd::vector<HeapProfileSite, OSStdAllocator>;
         /**
          * Example of records enumeration callback.
          */
@@ -129,6 +146,8 @@ namespace AZ
                 RECORD_STACK_NEVER,             ///< Never record stack traces. All other info is stored.
                 RECORD_STACK_IF_NO_FILE_LINE,   ///< Record stack if fileName and lineNum are not available. (default)
                 RECORD_FULL,                    ///< Always record the full stack.
+                RECORD_SAMPLED,                 ///< Record one allocation every sampling interval bytes on average, with the full stack.
+                                                ///< Cheap enough to be enabled on live servers. The statistics only count the samples.
 
                 RECORD_MAX                      ///< Must be last
             };
@@ -155,6 +174,13 @@ namespace AZ
             void    SetSaveNames(bool saveNames)                { m_saveNames = saveNames; }
             void    SetDecodeImmediately(bool decodeImmediately) { m_decodeImmediately = decodeImmediately; }
 
+            /// Sets the average number of bytes allocated between two samples in RECORD_SAMPLED mode.
+            void    SetSamplingInterval(size_t samplingInterval);
+            size_t  GetSamplingInterval() const                 { return m_samplingInterval; }
+
+            /// Adds the live samples to the profile, merged with the sites of the profile that have the same stack and file/line.
+            void    GatherHeapProfile(HeapProfile& profile);
+
             /// Returns number of stack levels that will captured for each allocation when requested (depending on the \ref Mode)
             unsigned char   GetNumStackLevels() const           { return m_numStackLevels; }
 
@@ -192,7 +218,20 @@ namespace AZ
             void    ResizeAllocation(void* address, size_t newSize);
             // @}
 
+            static constexpr size_t DefaultSamplingInterval = 512 * 1024;
+
         protected:
+            /// Returns true if the allocation is sampled, and the number of bytes it stands for.
+            bool    SampleAllocation(size_t byteSize, size_t& sampledBytes) const;
+            /// Returns false if the address is certainly not sampled. Used to free the other allocations without taking the lock.
+            bool    IsMaybeSampled(void* address) const;
+            void    UpdateSampleFilter(void* address, bool isAdded);
+            /// Frees and clears all the records, the lock must be held.
+            void    ClearRecords();
+
+            static constexpr size_t SampleFilterSize = 64 * 1024;
+            static constexpr unsigned char SampledStackLevels = 16;
+
             Debug::AllocationRecordsType    m_records;
             AZStd::spin_mutex               m_recordsMutex;
             Mode                            m_mode;
@@ -205,6 +244,9 @@ namespace AZ
             AZStd::atomic<size_t>           m_requestedAllocs;
             AZStd::atomic<size_t>           m_requestedBytes;
             AZStd::atomic<size_t>           m_requestedBytesPeak;
+            size_t                          m_samplingInterval;
+            double                          m_samplingRate;                 ///< Inverse of the sampling interval.
+            AZStd::atomic<AZ::u8>*          m_sampleFilter;                 ///< Counts of the samples by address hash, created with the sampled mode.
 
             const char*                     m_allocatorName;
         };
@@ -14,6 +14,7 @@
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Memory/MallocSchema.h>
 
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/containers/array.h>
@@ -151,6 +152,8 @@ AllocatorManager::AllocatorManager()
     m_numAllocators = 0;
     m_isAllocatorLeaking = false;
     m_defaultTrackingRecordMode = Debug::AllocationRecords::RECORD_NO_RECORDS;
+    m_heapSamplingInterval = 0;
+    m_numSampledAllocators = 0;
 }
 
 //=========================================================================
@@ -221,6 +224,16 @@ AllocatorManager::UnRegisterAllocator(class IAllocator* alloc)
             m_allocators[i] = m_allocators[m_numAllocators];
         }
     }
+
+    for (int i = 0; i < m_numSampledAllocators; ++i)
+    {
+        if (m_sampledAllocators[i] == alloc)
+        {
+            --m_numSampledAllocators;
+            m_sampledAllocators[i] = m_sampledAllocators[m_numSampledAllocators];
+            m_modesBeforeSampling[i] = m_modesBeforeSampling[m_numSampledAllocators];
+        }
+    }
 }
 
 
@@ -311,6 +324,145 @@ AllocatorManager::SetTrackingMode(Debug::AllocationRecords::Mode mode)
     }
 }
 
+void
+AllocatorManager::SetHeapSampling(size_t samplingInterval)
+{
+    const bool wasSampling = m_heapSamplingInterval > 0;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+        m_heapSamplingInterval = samplingInterval;
+        if (!wasSampling && samplingInterval > 0)
+        {
+            // Remember the recording modes, so the allocators get them back when the sampling stops
+            m_numSampledAllocators = 0;
+            for (int i = 0; i < m_numAllocators; ++i)
+            {
+                if (Debug::AllocationRecords* records = m_allocators[i]->GetRecords())
+                {
+                    m_sampledAllocators[m_numSampledAllocators] = m_allocators[i];
+                    m_modesBeforeSampling[m_numSampledAllocators] = records->GetMode();
+                    ++m_numSampledAllocators;
+                }
+            }
+        }
+
+        for (int i = 0; i < m_numAllocators; ++i)
+        {
+            Debug::AllocationRecords* records = m_allocators[i]->GetRecords();
+            if (!records)
+            {
+                continue;
+            }
+            if (samplingInterval > 0)
+            {
+                records->SetSamplingInterval(samplingInterval);
+                records->SetMode(Debug::AllocationRecords::RECORD_SAMPLED);
+            }
+            else if (wasSampling)
+            {
+                records->SetMode(GetModeBeforeSampling(m_allocators[i]));
+            }
+        }
+
+        if (samplingInterval == 0)
+        {
+            m_numSampledAllocators = 0;
+        }
+    }
+
+    // The allocators only update their records while profiling
+    if (!wasSampling && samplingInterval > 0)
+    {
+        EnterProfilingMode();
+    }
+    else if (wasSampling && samplingInterval == 0)
+    {
+        ExitProfilingMode();
+    }
+}
+
+Debug::AllocationRecords::Mode
+AllocatorManager::GetModeBeforeSampling(IAllocator* alloc) const
+{
+    for (int i = 0; i < m_numSampledAllocators; ++i)
+    {
+        if (m_sampledAllocators[i] == alloc)
+        {
+            return m_modesBeforeSampling[i];
+        }
+    }
+    // Allocators created while sampling started out sampled, their mode would have been the default one
+    return m_defaultTrackingRecordMode;
+}
+
+void
+AllocatorManager::GetHeapProfile(Debug::HeapProfile& profile)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+    for (int i = 0; i < m_numAllocators; ++i)
+    {
+        Debug::AllocationRecords* records = m_allocators[i]->GetRecords();
+        if (records)
+        {
+            records->GatherHeapProfile(profile);
+        }
+    }
+}
+
+bool
+AllocatorManager::WriteHeapProfile(const char* filePath)
+{
+    Debug::HeapProfile profile;
+    GetHeapProfile(profile);
+
+    IO::SystemFile file;
+    if (!file.Open(filePath, IO::SystemFile::SF_OPEN_CREATE | IO::SystemFile::SF_OPEN_CREATE_PATH | IO::SystemFile::SF_OPEN_WRITE_ONLY))
+    {
+        return false;
+    }
+
+    size_t sampleCount = 0;
+    size_t sampleBytes = 0;
+    for (const Debug::HeapProfileSite& site : profile)
+    {
+        sampleCount += site.m_sampleCount;
+        sampleBytes += site.m_sampleBytes;
+    }
+
+    // Legacy pprof heap profile. It holds the samples, pprof estimates the allocations from the heap_v2 sampling interval.
+    char line[256];
+    int length = azsnprintf(line, AZ_ARRAY_SIZE(line), "heap profile: %zu: %zu [%zu: %zu] @ heap_v2/%zu\n",
+        sampleCount, sampleBytes, sampleCount, sampleBytes, m_heapSamplingInterval);
+    file.Write(line, length);
+    for (const Debug::HeapProfileSite& site : profile)
+    {
+        length = azsnprintf(line, AZ_ARRAY_SIZE(line), "%zu: %zu [%zu: %zu] @",
+            site.m_sampleCount, site.m_sampleBytes, site.m_sampleCount, site.m_sampleBytes);
+        file.Write(line, length);
+        for (uintptr_t programCounter : site.m_stack)
+        {
+            length = azsnprintf(line, AZ_ARRAY_SIZE(line), " 0x%llx", static_cast<unsigned long long>(programCounter));
+            file.Write(line, length);
+        }
+        file.Write("\n", 1);
+    }
+
+    // pprof needs the module mappings to symbolize the stacks, on platforms that provide them
+    IO::SystemFile maps;
+    if (maps.Open("/proc/self/maps", IO::SystemFile::SF_OPEN_READ_ONLY))
+    {
+        static const char MappedLibraries[] = "\nMAPPED_LIBRARIES:\n";
+        file.Write(MappedLibraries, sizeof(MappedLibraries) - 1);
+
+        char buffer[4096];
+        while (IO::SystemFile::SizeType readSize = maps.Read(sizeof(buffer), buffer))
+        {
+            file.Write(buffer, readSize);
+        }
+    }
+    return true;
+}
+
 void
 AllocatorManager::EnterProfilingMode()
 {
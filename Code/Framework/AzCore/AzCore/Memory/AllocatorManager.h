@@ -84,6 +84,18 @@ namespace AZ
         /// Set memory track mode for all allocators already created.
         void    SetTrackingMode(AZ::Debug::AllocationRecords::Mode mode);
 
+        /// Samples the allocations of all the allocators with their stack, one every samplingInterval bytes on average.
+        /// The sampling replaces the recording mode of the allocators, 0 stops it, clears the samples and restores the recording mode
+        /// each allocator had before the sampling started.
+        void    SetHeapSampling(size_t samplingInterval);
+        size_t  GetHeapSamplingInterval() const         { return m_heapSamplingInterval; }
+
+        /// Gathers the live samples of all the allocators, by call site.
+        void    GetHeapProfile(Debug::HeapProfile& profile);
+
+        /// Writes the live samples of all the allocators as a heap profile that pprof can read.
+        bool    WriteHeapProfile(const char* filePath);
+
         /// Especially for great code and engines...
         void    SetAllocatorLeaking(bool allowLeaking)  { m_isAllocatorLeaking = allowLeaking; }
 
@@ -147,6 +159,7 @@ namespace AZ
 
     private:
         void InternalDestroy();
+        AZ::Debug::AllocationRecords::Mode GetModeBeforeSampling(IAllocator* alloc) const;
         void DebugBreak(void* address, const Debug::AllocationInfo& info);
         AZ::MallocSchema* CreateMallocSchema();
 
@@ -167,6 +180,10 @@ namespace AZ
         AZStd::atomic<int>  m_profilingRefcount;
 
         AZ::Debug::AllocationRecords::Mode m_defaultTrackingRecordMode;
+        size_t              m_heapSamplingInterval;
+        IAllocator*         m_sampledAllocators[m_maxNumAllocators];
+        AZ::Debug::AllocationRecords::Mode m_modesBeforeSampling[m_maxNumAllocators];
+        int                 m_numSampledAllocators;
         AZStd::unique_ptr<AZ::MallocSchema, void(*)(AZ::MallocSchema*)> m_mallocSchema;
 
         ~AllocatorManager();
@@ -0,0 +1,499 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ
+{
+    namespace FrameArenaInternal
+    {
+        static const int ReclaimedMemoryMarkValue = 0xcd;
+
+        // The size of each allocation is stored right before it, so any allocation can be reallocated
+        using AllocationHeader = size_t;
+
+        static void SetAllocationSize(void* address, size_t byteSize)
+        {
+            reinterpret_cast<AllocationHeader*>(address)[-1] = byteSize;
+        }
+
+        static size_t GetAllocationSize(void* address)
+        {
+            return reinterpret_cast<AllocationHeader*>(address)[-1];
+        }
+
+        // Protects the registration of the thread arenas in their allocator. It is never destroyed, since threads
+        // can exit after the static objects are destroyed.
+        static AZStd::mutex& GetThreadArenaMutex()
+        {
+            alignas(AZStd::mutex) static unsigned char s_mutexStorage[sizeof(AZStd::mutex)];
+            static AZStd::mutex* s_mutex = new (s_mutexStorage) AZStd::mutex();
+            return *s_mutex;
+        }
+    } // namespace FrameArenaInternal
+
+    struct FrameArenaAllocator::Chunk
+    {
+        Chunk* m_next = nullptr;
+        size_t m_dataSize = 0;
+
+        char* GetData() { return reinterpret_cast<char*>(this + 1); }
+        char* GetDataEnd() { return GetData() + m_dataSize; }
+    };
+
+    struct FrameArenaAllocator::ThreadArena
+    {
+        FrameArenaAllocator* m_allocator = nullptr;     // null once the allocator is destroyed, protected by the thread arena mutex
+        ThreadArena* m_nextInAllocator = nullptr;
+        ThreadArena* m_nextInThread = nullptr;
+
+        // only accessed by the owner thread
+        Chunk* m_firstChunk = nullptr;                  // chunks of the descriptor size, kept from frame to frame
+        Chunk* m_currentChunk = nullptr;
+        Chunk* m_largeChunks = nullptr;                 // chunks of allocations larger than a chunk, freed every frame
+        char* m_cursor = nullptr;
+        char* m_lastAllocation = nullptr;
+
+        // written by the owner thread, read by the statistics
+        AZStd::atomic<AZ::u64> m_frame{ 0 };
+        AZStd::atomic<size_t> m_allocatedSize{ 0 };
+        AZStd::atomic<size_t> m_capacity{ 0 };
+
+        void SetAllocatedSize(size_t size) { m_allocatedSize.store(size, AZStd::memory_order_relaxed); }
+        size_t GetAllocatedSize() const { return m_allocatedSize.load(AZStd::memory_order_relaxed); }
+    };
+
+    // The arenas of a thread, one per frame arena allocator it used. They are released when the thread exits.
+    struct FrameArenaAllocator::ThreadArenaHolder
+    {
+        ~ThreadArenaHolder()
+        {
+            // Allocations made by later thread local destructors go to the shared arena
+            s_isDestroyed = true;
+
+            AZStd::lock_guard<AZStd::mutex> lock(FrameArenaInternal::GetThreadArenaMutex());
+            while (m_first)
+            {
+                ThreadArena* arena = m_first;
+                m_first = arena->m_nextInThread;
+                if (arena->m_allocator)
+                {
+                    arena->m_allocator->ReleaseArena(*arena);
+                }
+                arena->~ThreadArena();
+                AZ_OS_FREE(arena);
+            }
+        }
+
+        ThreadArena* m_first = nullptr;
+
+        static thread_local ThreadArenaHolder s_holder;
+        static thread_local bool s_isDestroyed;
+    };
+
+    thread_local FrameArenaAllocator::ThreadArenaHolder FrameArenaAllocator::ThreadArenaHolder::s_holder;
+    thread_local bool FrameArenaAllocator::ThreadArenaHolder::s_isDestroyed = false;
+
+    //=========================================================================
+    // FrameArenaAllocator
+    //=========================================================================
+    FrameArenaAllocator::FrameArenaAllocator()
+        : AllocatorBase(this, "FrameArenaAllocator", "Linear allocator for temporaries reclaimed every frame")
+    {
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+    }
+
+    bool FrameArenaAllocator::Create(const Descriptor& desc)
+    {
+        AZ_Assert(desc.m_chunkSize > sizeof(Chunk), "The chunk size %zu is too small", desc.m_chunkSize);
+        m_desc = desc;
+        m_frame = 1;
+        m_highWaterMark = 0;
+
+        void* mem = AZ_OS_MALLOC(sizeof(ThreadArena), alignof(ThreadArena));
+        m_sharedArena = new (mem) ThreadArena();
+        m_sharedArena->m_allocator = this;
+        return true;
+    }
+
+    void FrameArenaAllocator::Destroy()
+    {
+        // Free the chunks of all the threads. The threads free their arenas when they exit.
+        AZStd::lock_guard<AZStd::mutex> lock(FrameArenaInternal::GetThreadArenaMutex());
+        while (m_arenas)
+        {
+            ReleaseArena(*m_arenas);
+        }
+
+        if (m_sharedArena)
+        {
+            ReleaseArena(*m_sharedArena);
+            m_sharedArena->~ThreadArena();
+            AZ_OS_FREE(m_sharedArena);
+            m_sharedArena = nullptr;
+        }
+    }
+
+    AllocatorDebugConfig FrameArenaAllocator::GetDebugConfig()
+    {
+        // Deallocations are not tracked one by one, the records would only report leaks
+        return AllocatorDebugConfig().ExcludeFromDebugging();
+    }
+
+    void FrameArenaAllocator::NewFrame()
+    {
+        m_frame.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::GetHighWaterMark() const
+    {
+        return m_highWaterMark.load(AZStd::memory_order_relaxed);
+    }
+
+    FrameArenaAllocator::pointer_type
+    FrameArenaAllocator::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+
+        if (byteSize == 0)
+        {
+            return nullptr;
+        }
+        alignment = AZStd::GetMax<size_type>(alignment, sizeof(void*));
+
+        void* address = nullptr;
+        if (ThreadArena* arena = GetThreadArena(true))
+        {
+            address = AllocateFromArena(*arena, byteSize, alignment);
+        }
+        else
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_sharedArenaMutex);
+            address = AllocateFromArena(*m_sharedArena, byteSize, alignment);
+        }
+
+        if (address == nullptr)
+        {
+            OnOutOfMemory(byteSize, alignment, flags, name, fileName, lineNum);
+        }
+        return address;
+    }
+
+    void FrameArenaAllocator::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+
+        // The memory is reclaimed with the frame, except for the last allocation of the thread which can be reused right away
+        ThreadArena* arena = GetThreadArena(false);
+        if (!arena || ptr == nullptr || ptr != arena->m_lastAllocation || arena->m_frame.load(AZStd::memory_order_relaxed) != m_frame.load(AZStd::memory_order_relaxed))
+        {
+            return;
+        }
+
+        char* allocationStart = arena->m_lastAllocation - sizeof(FrameArenaInternal::AllocationHeader);
+        if (m_desc.m_markReclaimedMemory)
+        {
+            memset(allocationStart, FrameArenaInternal::ReclaimedMemoryMarkValue, arena->m_cursor - allocationStart);
+        }
+        arena->SetAllocatedSize(arena->GetAllocatedSize() - (arena->m_cursor - allocationStart));
+        arena->m_cursor = allocationStart;
+        arena->m_lastAllocation = nullptr;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::Resize(pointer_type ptr, size_type newSize)
+    {
+        // Only the last allocation of the thread can be resized, by moving the cursor
+        ThreadArena* arena = GetThreadArena(false);
+        if (!arena || ptr == nullptr || ptr != arena->m_lastAllocation || arena->m_frame.load(AZStd::memory_order_relaxed) != m_frame.load(AZStd::memory_order_relaxed))
+        {
+            return 0;
+        }
+
+        char* lastAllocation = arena->m_lastAllocation;
+        if (newSize == 0 || lastAllocation + newSize > arena->m_currentChunk->GetDataEnd())
+        {
+            return arena->m_cursor - lastAllocation;
+        }
+
+        arena->SetAllocatedSize(arena->GetAllocatedSize() - (arena->m_cursor - lastAllocation) + newSize);
+        arena->m_cursor = lastAllocation + newSize;
+        FrameArenaInternal::SetAllocationSize(lastAllocation, newSize);
+        return newSize;
+    }
+
+    FrameArenaAllocator::pointer_type FrameArenaAllocator::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        if (ptr == nullptr)
+        {
+            return Allocate(newSize, newAlignment);
+        }
+
+        // The last allocation of the thread is resized in place, any other allocation is copied
+        if ((reinterpret_cast<size_t>(ptr) & (newAlignment - 1)) == 0 && Resize(ptr, newSize) == newSize)
+        {
+            return ptr;
+        }
+
+        const size_type oldSize = AllocationSize(ptr);
+        pointer_type newPtr = Allocate(newSize, newAlignment);
+        if (newPtr)
+        {
+            memcpy(newPtr, ptr, AZStd::GetMin(oldSize, newSize));
+            DeAllocate(ptr, oldSize);
+        }
+        return newPtr;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::AllocationSize(pointer_type ptr)
+    {
+        return ptr ? FrameArenaInternal::GetAllocationSize(ptr) : 0;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::NumAllocatedBytes() const
+    {
+        // Arenas that didn't allocate since the frame started still report the previous frame until they are reclaimed
+        const AZ::u64 frame = m_frame.load(AZStd::memory_order_relaxed);
+        size_type allocatedSize = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(FrameArenaInternal::GetThreadArenaMutex());
+        for (const ThreadArena* arena = m_arenas; arena; arena = arena->m_nextInAllocator)
+        {
+            if (arena->m_frame.load(AZStd::memory_order_relaxed) == frame)
+            {
+                allocatedSize += arena->GetAllocatedSize();
+            }
+        }
+        if (m_sharedArena && m_sharedArena->m_frame.load(AZStd::memory_order_relaxed) == frame)
+        {
+            allocatedSize += m_sharedArena->GetAllocatedSize();
+        }
+        return allocatedSize;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::Capacity() const
+    {
+        size_type capacity = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(FrameArenaInternal::GetThreadArenaMutex());
+        for (const ThreadArena* arena = m_arenas; arena; arena = arena->m_nextInAllocator)
+        {
+            capacity += arena->m_capacity.load(AZStd::memory_order_relaxed);
+        }
+        if (m_sharedArena)
+        {
+            capacity += m_sharedArena->m_capacity.load(AZStd::memory_order_relaxed);
+        }
+        return capacity;
+    }
+
+    FrameArenaAllocator::ThreadArena* FrameArenaAllocator::GetThreadArena(bool create)
+    {
+        if (ThreadArenaHolder::s_isDestroyed)
+        {
+            return nullptr;
+        }
+
+        ThreadArenaHolder& holder = ThreadArenaHolder::s_holder;
+        for (ThreadArena* arena = holder.m_first; arena; arena = arena->m_nextInThread)
+        {
+            if (arena->m_allocator == this)
+            {
+                return arena;
+            }
+        }
+        if (!create)
+        {
+            return nullptr;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(FrameArenaInternal::GetThreadArenaMutex());
+
+        // Free the arenas of the allocators destroyed since this thread last used them
+        for (ThreadArena** link = &holder.m_first; *link; )
+        {
+            ThreadArena* arena = *link;
+            if (arena->m_allocator)
+            {
+                link = &arena->m_nextInThread;
+                continue;
+            }
+            *link = arena->m_nextInThread;
+            arena->~ThreadArena();
+            AZ_OS_FREE(arena);
+        }
+
+        void* mem = AZ_OS_MALLOC(sizeof(ThreadArena), alignof(ThreadArena));
+        if (!mem)
+        {
+            return nullptr;
+        }
+        ThreadArena* arena = new (mem) ThreadArena();
+        arena->m_allocator = this;
+        arena->m_nextInAllocator = m_arenas;
+        m_arenas = arena;
+        arena->m_nextInThread = holder.m_first;
+        holder.m_first = arena;
+        return arena;
+    }
+
+    void* FrameArenaAllocator::AllocateFromArena(ThreadArena& arena, size_type byteSize, size_type alignment)
+    {
+        const AZ::u64 frame = m_frame.load(AZStd::memory_order_relaxed);
+        if (arena.m_frame.load(AZStd::memory_order_relaxed) != frame)
+        {
+            ReclaimArena(arena);
+            arena.m_frame.store(frame, AZStd::memory_order_relaxed);
+        }
+
+        if (arena.m_cursor)
+        {
+            char* address = reinterpret_cast<char*>(AZ::PointerAlignUp(arena.m_cursor + sizeof(FrameArenaInternal::AllocationHeader), alignment));
+            if (address + byteSize <= arena.m_currentChunk->GetDataEnd())
+            {
+                FrameArenaInternal::SetAllocationSize(address, byteSize);
+                arena.SetAllocatedSize(arena.GetAllocatedSize() + (address + byteSize - arena.m_cursor));
+                arena.m_cursor = address + byteSize;
+                arena.m_lastAllocation = address;
+                return address;
+            }
+        }
+        return AllocateFromNextChunk(arena, byteSize, alignment);
+    }
+
+    void* FrameArenaAllocator::AllocateFromNextChunk(ThreadArena& arena, size_type byteSize, size_type alignment)
+    {
+        const size_type headerSize = sizeof(FrameArenaInternal::AllocationHeader);
+        if (headerSize + byteSize + alignment > m_desc.m_chunkSize - sizeof(Chunk))
+        {
+            // Allocations larger than a chunk get a chunk of their own, and don't move the cursor
+            Chunk* chunk = AllocateChunk(arena, headerSize + byteSize + alignment);
+            if (!chunk)
+            {
+                return nullptr;
+            }
+            chunk->m_next = arena.m_largeChunks;
+            arena.m_largeChunks = chunk;
+            arena.SetAllocatedSize(arena.GetAllocatedSize() + byteSize);
+            char* address = reinterpret_cast<char*>(AZ::PointerAlignUp(chunk->GetData() + headerSize, alignment));
+            FrameArenaInternal::SetAllocationSize(address, byteSize);
+            return address;
+        }
+
+        // Move to the next chunk, the chunks of the previous frames are reused before new ones are allocated
+        Chunk* chunk = arena.m_currentChunk ? arena.m_currentChunk->m_next : arena.m_firstChunk;
+        if (!chunk)
+        {
+            chunk = AllocateChunk(arena, m_desc.m_chunkSize - sizeof(Chunk));
+            if (!chunk)
+            {
+                return nullptr;
+            }
+            if (arena.m_currentChunk)
+            {
+                arena.m_currentChunk->m_next = chunk;
+            }
+            else
+            {
+                arena.m_firstChunk = chunk;
+            }
+        }
+        arena.m_currentChunk = chunk;
+
+        char* address = reinterpret_cast<char*>(AZ::PointerAlignUp(chunk->GetData() + headerSize, alignment));
+        FrameArenaInternal::SetAllocationSize(address, byteSize);
+        arena.SetAllocatedSize(arena.GetAllocatedSize() + (address + byteSize - chunk->GetData()));
+        arena.m_cursor = address + byteSize;
+        arena.m_lastAllocation = address;
+        return address;
+    }
+
+    void FrameArenaAllocator::ReclaimArena(ThreadArena& arena)
+    {
+        // The high water mark only counts completed frames, the current frame may still grow
+        const size_t allocatedSize = arena.GetAllocatedSize();
+        size_type highWaterMark = m_highWaterMark.load(AZStd::memory_order_relaxed);
+        while (allocatedSize > highWaterMark && !m_highWaterMark.compare_exchange_weak(highWaterMark, allocatedSize, AZStd::memory_order_relaxed))
+        {
+        }
+
+        if (m_desc.m_markReclaimedMemory && arena.m_cursor)
+        {
+            for (Chunk* chunk = arena.m_firstChunk; chunk != arena.m_currentChunk; chunk = chunk->m_next)
+            {
+                memset(chunk->GetData(), FrameArenaInternal::ReclaimedMemoryMarkValue, chunk->m_dataSize);
+            }
+            memset(arena.m_currentChunk->GetData(), FrameArenaInternal::ReclaimedMemoryMarkValue, arena.m_cursor - arena.m_currentChunk->GetData());
+        }
+
+        while (arena.m_largeChunks)
+        {
+            Chunk* chunk = arena.m_largeChunks;
+            arena.m_largeChunks = chunk->m_next;
+            FreeChunk(arena, chunk);
+        }
+
+        arena.m_currentChunk = nullptr;
+        arena.m_cursor = nullptr;
+        arena.m_lastAllocation = nullptr;
+        arena.SetAllocatedSize(0);
+    }
+
+    void FrameArenaAllocator::ReleaseArena(ThreadArena& arena)
+    {
+        // The thread arena mutex is held by the caller
+        ReclaimArena(arena);
+        while (arena.m_firstChunk)
+        {
+            Chunk* chunk = arena.m_firstChunk;
+            arena.m_firstChunk = chunk->m_next;
+            FreeChunk(arena, chunk);
+        }
+
+        for (ThreadArena** link = &m_arenas; *link; link = &(*link)->m_nextInAllocator)
+        {
+            if (*link == &arena)
+            {
+                *link = arena.m_nextInAllocator;
+                break;
+            }
+        }
+        arena.m_nextInAllocator = nullptr;
+        if (&arena != m_sharedArena)
+        {
+            arena.m_allocator = nullptr;
+        }
+    }
+
+    FrameArenaAllocator::Chunk* FrameArenaAllocator::AllocateChunk(ThreadArena& arena, size_type dataSize)
+    {
+        void* mem = AZ_OS_MALLOC(sizeof(Chunk) + dataSize, alignof(Chunk));
+        if (!mem)
+        {
+            return nullptr;
+        }
+        Chunk* chunk = new (mem) Chunk();
+        chunk->m_dataSize = dataSize;
+        arena.m_capacity.store(arena.m_capacity.load(AZStd::memory_order_relaxed) + sizeof(Chunk) + dataSize, AZStd::memory_order_relaxed);
+        return chunk;
+    }
+
+    void FrameArenaAllocator::FreeChunk(ThreadArena& arena, Chunk* chunk)
+    {
+        arena.m_capacity.store(arena.m_capacity.load(AZStd::memory_order_relaxed) - (sizeof(Chunk) + chunk->m_dataSize), AZStd::memory_order_relaxed);
+        chunk->~Chunk();
+        AZ_OS_FREE(chunk);
+    }
+} // namespace AZ
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/AllocatorBase.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Linear allocator for temporaries that don't outlive the frame they were allocated in.
+     * Every thread bumps a pointer in chunks of its own, so allocating takes no lock and deallocating is free.
+     * All the memory is reclaimed at once when the next frame starts. The ComponentApplication starts a frame
+     * at the beginning of Tick and TickSystem, so memory allocated by a TickBus or SystemTickBus handler must not
+     * be used after the handler returns. Only the last allocation of a thread can be freed or resized in place, which
+     * lets a container that grows one element at a time extend its memory instead of copying it. The size of each
+     * allocation is stored in front of it, so any other allocation is reallocated by copying it.
+     * Use FrameArenaStdAllocator to put AZStd containers on this allocator.
+     */
+    class FrameArenaAllocator
+        : public AllocatorBase
+    {
+    public:
+        AZ_TYPE_INFO(FrameArenaAllocator, "{A1E4D7F2-5B8C-4C3E-9D61-2F7A0B3E8C54}");
+
+        FrameArenaAllocator();
+        ~FrameArenaAllocator() override;
+
+        struct Descriptor
+        {
+            Descriptor()
+                : m_chunkSize(256 * 1024)
+#if defined(AZ_DEBUG_BUILD)
+                , m_markReclaimedMemory(true)
+#else
+                , m_markReclaimedMemory(false)
+#endif
+            {}
+
+            size_t m_chunkSize;             ///< Size of the chunks the threads allocate from, larger allocations get a chunk of their own.
+            bool m_markReclaimedMemory;     ///< Fill the reclaimed memory with 0xcd, to catch temporaries used after their frame.
+        };
+
+        bool Create(const Descriptor& desc);
+
+        void Destroy() override;
+
+        //! Starts a new frame, the memory of the previous frame is reclaimed the next time each thread allocates.
+        void NewFrame();
+
+        //! Returns the largest number of bytes a single thread allocated in one frame.
+        size_type GetHighWaterMark() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocatorDebugConfig GetDebugConfig() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocatorSchema
+        pointer_type    Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void            DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        size_type       Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type    ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type       AllocationSize(pointer_type ptr) override;
+
+        size_type       NumAllocatedBytes() const override;
+        size_type       Capacity() const override;
+        size_type       GetMaxAllocationSize() const override { return AZ_CORE_MAX_ALLOCATOR_SIZE; }
+        size_type       GetMaxContiguousAllocationSize() const override { return AZ_CORE_MAX_ALLOCATOR_SIZE; }
+
+    private:
+        FrameArenaAllocator(const FrameArenaAllocator&) = delete;
+        FrameArenaAllocator& operator=(const FrameArenaAllocator&) = delete;
+
+        struct Chunk;
+        struct ThreadArena;
+        struct ThreadArenaHolder;
+
+        //! Returns the arena of the calling thread, creating it if needed.
+        ThreadArena* GetThreadArena(bool create);
+        void* AllocateFromArena(ThreadArena& arena, size_type byteSize, size_type alignment);
+        void* AllocateFromNextChunk(ThreadArena& arena, size_type byteSize, size_type alignment);
+        void ReclaimArena(ThreadArena& arena);
+        void ReleaseArena(ThreadArena& arena);
+        Chunk* AllocateChunk(ThreadArena& arena, size_type dataSize);
+        void FreeChunk(ThreadArena& arena, Chunk* chunk);
+
+        Descriptor m_desc;
+        AZStd::atomic<AZ::u64> m_frame{ 1 };
+        AZStd::atomic<size_type> m_highWaterMark{ 0 };
+        ThreadArena* m_arenas = nullptr;            ///< All the thread arenas, protected by the thread arena mutex.
+        ThreadArena* m_sharedArena = nullptr;       ///< Used by threads that already destroyed their thread locals.
+        AZStd::mutex m_sharedArenaMutex;
+    };
+
+    /**
+    * AZStd allocator for the FrameArenaAllocator. If the frame arena is not created (unit tests, tools that
+    * don't tick), the SystemAllocator is used instead. The allocator is chosen when this object is constructed,
+    * so containers free their memory to the allocator that allocated it.
+    */
+    class FrameArenaStdAllocator
+    {
+    public:
+        typedef void*               pointer_type;
+        typedef AZStd::size_t       size_type;
+        typedef AZStd::ptrdiff_t    difference_type;
+        typedef AZStd::false_type   allow_memory_leaks;
+
+        FrameArenaStdAllocator(const char* name = "AZ::FrameArenaStdAllocator")
+            : m_allocator(AllocatorInstance<FrameArenaAllocator>::IsReady() ? &AllocatorInstance<FrameArenaAllocator>::Get() : &AllocatorInstance<SystemAllocator>::Get())
+            , m_name(name)
+        {}
+        FrameArenaStdAllocator(const FrameArenaStdAllocator& rhs) = default;
+        FrameArenaStdAllocator(const FrameArenaStdAllocator& rhs, const char* name)
+            : m_allocator(rhs.m_allocator)
+            , m_name(name)
+        {}
+        FrameArenaStdAllocator& operator=(const FrameArenaStdAllocator& rhs) = default;
+
+        AZ_FORCE_INLINE pointer_type allocate(size_t byteSize, size_t alignment, int flags = 0)
+        {
+            return m_allocator->Allocate(byteSize, alignment, flags, m_name, __FILE__, __LINE__, 1);
+        }
+        AZ_FORCE_INLINE size_type resize(pointer_type ptr, size_t newSize)
+        {
+            return m_allocator->Resize(ptr, newSize);
+        }
+        AZ_FORCE_INLINE void deallocate(pointer_type ptr, size_t byteSize, size_t alignment)
+        {
+            m_allocator->DeAllocate(ptr, byteSize, alignment);
+        }
+        AZ_FORCE_INLINE const char* get_name() const { return m_name; }
+        AZ_FORCE_INLINE void        set_name(const char* name) { m_name = name; }
+        size_type                   max_size() const { return m_allocator->GetMaxContiguousAllocationSize(); }
+        size_type                   get_allocated_size() const { return m_allocator->NumAllocatedBytes(); }
+
+        AZ_FORCE_INLINE bool operator==(const FrameArenaStdAllocator& rhs) const { return m_allocator == rhs.m_allocator; }
+        AZ_FORCE_INLINE bool operator!=(const FrameArenaStdAllocator& rhs) const { return m_allocator != rhs.m_allocator; }
+
+    private:
+        IAllocator* m_allocator;
+        const char* m_name;
+    };
+} // namespace AZ
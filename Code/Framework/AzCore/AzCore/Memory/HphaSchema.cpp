@@ -13,8 +13,10 @@
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/spin_mutex.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/time.h>
 
 #ifdef _DEBUG
 //#define DEBUG_ALLOCATOR
@@ -57,6 +59,11 @@ namespace AZ
 // Enabled mutex per bucket
 #define USE_MUTEX_PER_BUCKET
 
+#ifdef MULTITHREADED
+// Enable per thread caches of small allocation blocks
+#   define USE_THREAD_CACHE
+#endif
+
     namespace HphaInternal
     {
         //! Rounds up a value to next power of 2.
@@ -335,6 +342,71 @@ namespace AZ
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+#ifdef USE_THREAD_CACHE
+        // a thread cache keeps up to THREAD_CACHE_BUCKET_SIZE bytes of free blocks per bucket, and at least THREAD_CACHE_MIN_BLOCKS
+        static constexpr size_t THREAD_CACHE_BUCKET_SIZE = 1024UL;
+        static constexpr size_t THREAD_CACHE_MIN_BLOCKS = 4UL;
+
+        // free blocks of one bucket cached by a thread
+        struct magazine
+        {
+            free_link*      mHead = nullptr;
+            unsigned short  mCount = 0;
+            unsigned short  mCapacity = 0;
+        };
+
+        // the small allocation cache of one thread for one allocator. It is owned by the thread and registered in the allocator,
+        // so the periodic trim and purge can return the blocks of idle threads and the allocator can flush it when destroyed
+        struct thread_cache
+            : public AZStd::list_base_hook<thread_cache>::node_type
+        {
+            mutable AZStd::spin_mutex mLock;                // only contended while the cache is trimmed
+            HpAllocator*            mAllocator = nullptr;   // null once released, protected by the thread cache mutex
+            size_t                  mAllocatorId = 0;
+            thread_cache*           mNextInThread = nullptr;
+            // bytes allocated minus bytes freed through this cache, only written by the owner thread.
+            // It can be negative when blocks are freed by another thread than the one that allocated them
+            AZStd::atomic<ptrdiff_t> mAllocatedSize{ 0 };
+            bool                    mIsActive = false;      // set on every use, cleared by each trim
+            magazine                mMagazines[NUM_BUCKETS];
+
+            void add_allocated(ptrdiff_t size) { mAllocatedSize.store(mAllocatedSize.load(AZStd::memory_order_relaxed) + size, AZStd::memory_order_relaxed); }
+        };
+        using thread_cache_list = AZStd::intrusive_list<thread_cache, AZStd::list_base_hook<thread_cache>>;
+
+        // the caches of a thread, one per allocator it used. The caches are released when the thread exits
+        struct thread_cache_holder
+        {
+            ~thread_cache_holder();
+
+            thread_cache* mFirst = nullptr;
+            thread_cache* mLast = nullptr; // last used, most threads only allocate from one allocator
+        };
+
+        // protects the registration of thread caches in their allocators, taken before any cache or bucket lock
+        static AZStd::mutex& thread_cache_mutex();
+        static thread_local thread_cache_holder s_threadCacheHolder;
+        static thread_local bool s_isThreadCacheHolderDestroyed;
+        static AZStd::atomic<size_t> s_nextAllocatorId;
+
+        thread_cache* get_thread_cache();
+        thread_cache* create_thread_cache(thread_cache_holder& holder);
+        void release_thread_cache(thread_cache& cache);
+        void* thread_cache_alloc(thread_cache& cache, unsigned bi);
+        void thread_cache_free(thread_cache& cache, void* ptr, unsigned bi);
+        bool bucket_fill_magazine(magazine& mag, unsigned bi);
+        void bucket_drain_magazine(magazine& mag, unsigned bi, size_t count);
+        size_t thread_cache_allocated() const;
+        size_t thread_cache_unused_memory() const;
+        void thread_cache_trim(bool isIdleOnly);
+        void thread_cache_trim_if_due();
+
+        thread_cache_list mThreadCaches;
+        size_t mId;
+        AZStd::sys_time_t mThreadCacheTrimInterval;                 // in microseconds, 0 when only purge trims the caches
+        AZStd::atomic<AZStd::sys_time_t> mNextThreadCacheTrimTime;
+#endif
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -918,6 +990,10 @@ namespace AZ
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+#ifdef USE_THREAD_CACHE
+            // Trim thread caches first so the buckets get their blocks back
+            thread_cache_trim(false);
+#endif
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -934,7 +1010,11 @@ namespace AZ
         // return the total number of allocated memory
         inline  size_t allocated() const
         {
+#ifdef USE_THREAD_CACHE
+            return mTotalAllocatedSizeBuckets + thread_cache_allocated() + mTotalAllocatedSizeTree;
+#else
             return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+#endif
         }
 
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
@@ -952,6 +1032,7 @@ namespace AZ
         const size_t m_treePageAlignment;
         const size_t m_poolPageSize;
         bool         m_isPoolAllocations;
+        bool         m_isThreadCaching;
         IAllocatorSchema* m_subAllocator;
 
 #if !defined (USE_MUTEX_PER_BUCKET)
@@ -1022,6 +1103,12 @@ namespace AZ
         m_fixedBlock = desc.m_fixedMemoryBlock;
         m_fixedBlockSize = desc.m_fixedMemoryBlockByteSize;
         m_isPoolAllocations = desc.m_isPoolAllocations;
+        m_isThreadCaching = desc.m_isThreadCaching;
+#ifdef USE_THREAD_CACHE
+        mId = ++s_nextAllocatorId;
+        mThreadCacheTrimInterval = (AZStd::sys_time_t)desc.m_threadCacheTrimIntervalMs * 1000;
+        mNextThreadCacheTrimTime = AZStd::GetTimeNowMicroSecond() + mThreadCacheTrimInterval;
+#endif
         if (desc.m_fixedMemoryBlock)
         {
             block_header* bl = tree_add_block(m_fixedBlock, m_fixedBlockSize);
@@ -1052,6 +1139,17 @@ namespace AZ
         report();
         check();
 #endif
+
+#ifdef USE_THREAD_CACHE
+        {
+            // Return the blocks cached by threads, the threads release the cache memory when they exit
+            AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+            while (!mThreadCaches.empty())
+            {
+                release_thread_cache(mThreadCaches.front());
+            }
+        }
+#endif
         
         purge();
 
@@ -1218,6 +1316,12 @@ namespace AZ
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef USE_THREAD_CACHE
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_alloc(*cache, bi);
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1246,6 +1350,12 @@ namespace AZ
     void* HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef USE_THREAD_CACHE
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_alloc(*cache, bi);
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1313,6 +1423,12 @@ namespace AZ
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef USE_THREAD_CACHE
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_free(*cache, ptr, bi);
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1331,6 +1447,12 @@ namespace AZ
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+#ifdef USE_THREAD_CACHE
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_free(*cache, ptr, bi);
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1445,6 +1567,297 @@ namespace AZ
         }
     }
 
+#ifdef USE_THREAD_CACHE
+    thread_local HpAllocator::thread_cache_holder HpAllocator::s_threadCacheHolder;
+    thread_local bool HpAllocator::s_isThreadCacheHolderDestroyed = false;
+    AZStd::atomic<size_t> HpAllocator::s_nextAllocatorId{ 0 };
+
+    AZStd::mutex& HpAllocator::thread_cache_mutex()
+    {
+        // Never destroyed, threads can exit after the static objects are destroyed
+        alignas(AZStd::mutex) static unsigned char s_mutexStorage[sizeof(AZStd::mutex)];
+        static AZStd::mutex* s_mutex = new (s_mutexStorage) AZStd::mutex();
+        return *s_mutex;
+    }
+
+    HpAllocator::thread_cache_holder::~thread_cache_holder()
+    {
+        // Allocations made by later thread local destructors go straight to the buckets
+        s_isThreadCacheHolderDestroyed = true;
+
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        while (mFirst)
+        {
+            thread_cache* cache = mFirst;
+            mFirst = cache->mNextInThread;
+            if (cache->mAllocator)
+            {
+                cache->mAllocator->release_thread_cache(*cache);
+            }
+            cache->~thread_cache();
+            AZ_OS_FREE(cache);
+        }
+        mLast = nullptr;
+    }
+
+    HpAllocator::thread_cache* HpAllocator::get_thread_cache()
+    {
+        if (!m_isThreadCaching || s_isThreadCacheHolderDestroyed)
+        {
+            return nullptr;
+        }
+        thread_cache_holder& holder = s_threadCacheHolder;
+        if (holder.mLast && holder.mLast->mAllocatorId == mId)
+        {
+            return holder.mLast;
+        }
+        for (thread_cache* cache = holder.mFirst; cache; cache = cache->mNextInThread)
+        {
+            if (cache->mAllocatorId == mId)
+            {
+                holder.mLast = cache;
+                return cache;
+            }
+        }
+        return create_thread_cache(holder);
+    }
+
+    HpAllocator::thread_cache* HpAllocator::create_thread_cache(thread_cache_holder& holder)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+
+        // Free the caches of the allocators destroyed since this thread last used them
+        holder.mLast = nullptr;
+        for (thread_cache** link = &holder.mFirst; *link; )
+        {
+            thread_cache* cache = *link;
+            if (cache->mAllocator)
+            {
+                link = &cache->mNextInThread;
+                continue;
+            }
+            *link = cache->mNextInThread;
+            cache->~thread_cache();
+            AZ_OS_FREE(cache);
+        }
+
+        void* mem = AZ_OS_MALLOC(sizeof(thread_cache), alignof(thread_cache));
+        if (!mem)
+        {
+            return nullptr;
+        }
+        thread_cache* cache = new (mem) thread_cache();
+        cache->mAllocator = this;
+        cache->mAllocatorId = mId;
+        for (unsigned bi = 0; bi < NUM_BUCKETS; bi++)
+        {
+            cache->mMagazines[bi].mCapacity = (unsigned short)AZStd::GetMax(THREAD_CACHE_MIN_BLOCKS, THREAD_CACHE_BUCKET_SIZE / bucket_spacing_function_inverse(bi));
+        }
+        mThreadCaches.push_back(*cache);
+
+        cache->mNextInThread = holder.mFirst;
+        holder.mFirst = cache;
+        holder.mLast = cache;
+        return cache;
+    }
+
+    void HpAllocator::release_thread_cache(thread_cache& cache)
+    {
+        // The thread cache mutex is held by the caller
+        AZStd::lock_guard<AZStd::spin_mutex> lock(cache.mLock);
+        for (unsigned bi = 0; bi < NUM_BUCKETS; bi++)
+        {
+            bucket_drain_magazine(cache.mMagazines[bi], bi, cache.mMagazines[bi].mCount);
+        }
+        mTotalAllocatedSizeBuckets += (size_t)cache.mAllocatedSize.load(AZStd::memory_order_relaxed);
+        cache.mAllocatedSize.store(0, AZStd::memory_order_relaxed);
+        mThreadCaches.erase(cache);
+        cache.mAllocator = nullptr;
+    }
+
+    void* HpAllocator::thread_cache_alloc(thread_cache& cache, unsigned bi)
+    {
+        free_link* block = nullptr;
+        bool isRefilled = false;
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(cache.mLock);
+            magazine& mag = cache.mMagazines[bi];
+            if (!mag.mHead)
+            {
+                if (!bucket_fill_magazine(mag, bi))
+                {
+                    return nullptr;
+                }
+                isRefilled = true;
+            }
+            block = mag.mHead;
+            mag.mHead = block->mNext;
+            mag.mCount--;
+            cache.mIsActive = true;
+            cache.add_allocated(bucket_spacing_function_inverse(bi));
+        }
+        if (isRefilled)
+        {
+            // already on the slow path, trim the caches of idle threads when it's time to
+            thread_cache_trim_if_due();
+        }
+        return block;
+    }
+
+    void HpAllocator::thread_cache_free(thread_cache& cache, void* ptr, unsigned bi)
+    {
+        bool isDrained = false;
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(cache.mLock);
+            magazine& mag = cache.mMagazines[bi];
+            if (mag.mCount == mag.mCapacity)
+            {
+                // return half of the blocks, so alternating allocations and frees don't go to the bucket every time
+                bucket_drain_magazine(mag, bi, mag.mCapacity / 2);
+                isDrained = true;
+            }
+            free_link* block = (free_link*)ptr;
+            block->mNext = mag.mHead;
+            mag.mHead = block;
+            mag.mCount++;
+            cache.mIsActive = true;
+            cache.add_allocated(-(ptrdiff_t)bucket_spacing_function_inverse(bi));
+        }
+        if (isDrained)
+        {
+            thread_cache_trim_if_due();
+        }
+    }
+
+    bool HpAllocator::bucket_fill_magazine(magazine& mag, unsigned bi)
+    {
+        // take half of the capacity under a single bucket lock
+        const size_t count = AZStd::GetMax<size_t>(mag.mCapacity / 2, 1);
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        for (size_t i = 0; i < count; i++)
+        {
+            page* p = mBuckets[bi].get_free_page();
+            if (!p)
+            {
+                p = bucket_grow(bucket_spacing_function_inverse(bi), mBuckets[bi].marker());
+                if (!p)
+                {
+                    break;
+                }
+                mBuckets[bi].add_free_page(p);
+            }
+            free_link* block = (free_link*)mBuckets[bi].alloc(p);
+            block->mNext = mag.mHead;
+            mag.mHead = block;
+            mag.mCount++;
+        }
+        return mag.mHead != nullptr;
+    }
+
+    void HpAllocator::bucket_drain_magazine(magazine& mag, unsigned bi, size_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        HPPA_ASSERT(count <= mag.mCount);
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        for (size_t i = 0; i < count; i++)
+        {
+            free_link* block = mag.mHead;
+            mag.mHead = block->mNext;
+            mBuckets[bi].free(ptr_get_page(block), block);
+        }
+        mag.mCount = (unsigned short)(mag.mCount - count);
+    }
+
+    size_t HpAllocator::thread_cache_allocated() const
+    {
+        if (!m_isThreadCaching)
+        {
+            return 0;
+        }
+        ptrdiff_t allocatedSize = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        for (const thread_cache& cache : mThreadCaches)
+        {
+            allocatedSize += cache.mAllocatedSize.load(AZStd::memory_order_relaxed);
+        }
+        return (size_t)allocatedSize;
+    }
+
+    size_t HpAllocator::thread_cache_unused_memory() const
+    {
+        if (!m_isThreadCaching)
+        {
+            return 0;
+        }
+        size_t unusedMemory = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        for (const thread_cache& cache : mThreadCaches)
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> cacheLock(cache.mLock);
+            for (unsigned bi = 0; bi < NUM_BUCKETS; bi++)
+            {
+                unusedMemory += cache.mMagazines[bi].mCount * bucket_spacing_function_inverse(bi);
+            }
+        }
+        return unusedMemory;
+    }
+
+    void HpAllocator::thread_cache_trim(bool isIdleOnly)
+    {
+        if (!m_isThreadCaching)
+        {
+            return;
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        for (thread_cache& cache : mThreadCaches)
+        {
+            // caches not used since the last trim are emptied, the others keep all of their blocks for a periodic trim
+            // and half of them for a purge
+            AZStd::lock_guard<AZStd::spin_mutex> cacheLock(cache.mLock);
+            for (unsigned bi = 0; bi < NUM_BUCKETS; bi++)
+            {
+                magazine& mag = cache.mMagazines[bi];
+                bucket_drain_magazine(mag, bi, !cache.mIsActive ? mag.mCount : isIdleOnly ? 0 : mag.mCount / 2);
+            }
+            cache.mIsActive = false;
+        }
+    }
+
+    void HpAllocator::thread_cache_trim_if_due()
+    {
+        // Called on the refill and drain paths, without any cache or bucket lock held. A thread that stops allocating
+        // never gets there, so the other threads release its cache within two trim intervals
+        if (mThreadCacheTrimInterval == 0)
+        {
+            return;
+        }
+        const AZStd::sys_time_t now = AZStd::GetTimeNowMicroSecond();
+        AZStd::sys_time_t nextTrimTime = mNextThreadCacheTrimTime.load(AZStd::memory_order_relaxed);
+        if (now < nextTrimTime ||
+            !mNextThreadCacheTrimTime.compare_exchange_strong(nextTrimTime, now + mThreadCacheTrimInterval, AZStd::memory_order_relaxed))
+        {
+            // not due yet, or another thread is trimming
+            return;
+        }
+        thread_cache_trim(true);
+    }
+#endif // USE_THREAD_CACHE
+
     void HpAllocator::split_block(block_header* bl, size_t size)
     {
         HPPA_ASSERT(size + sizeof(block_header) + sizeof(free_node) <= bl->size());
@@ -2194,7 +2607,11 @@ namespace AZ
     size_t
     HpAllocator::GetUnAllocatedMemory(bool isPrint) const
     {
+#ifdef USE_THREAD_CACHE
+        return bucket_get_unused_memory(isPrint) + thread_cache_unused_memory() + tree_get_unused_memory(isPrint);
+#else
         return bucket_get_unused_memory(isPrint) + tree_get_unused_memory(isPrint);
+#endif
     }
 
     //=========================================================================
@@ -2578,6 +2995,19 @@ namespace AZ
         return m_allocator->GetUnAllocatedMemory(isPrint);
     }
 
+    //=========================================================================
+    // GetThreadCachedMemory
+    //=========================================================================
+    HphaSchema::size_type
+    HphaSchema::GetThreadCachedMemory() const
+    {
+#ifdef USE_THREAD_CACHE
+        return m_allocator->thread_cache_unused_memory();
+#else
+        return 0;
+#endif
+    }
+
     //=========================================================================
     // GarbageCollect
     // [2/22/2011]
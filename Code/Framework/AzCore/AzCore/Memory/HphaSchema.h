@@ -39,6 +39,8 @@ namespace AZ
                 , m_subAllocator(nullptr)
                 , m_systemChunkSize(0)
                 , m_capacity(AZ_CORE_MAX_ALLOCATOR_SIZE)
+                , m_isThreadCaching(true)
+                , m_threadCacheTrimIntervalMs(1000)
             {}
 
             unsigned int            m_fixedMemoryBlockAlignment;
@@ -50,6 +52,8 @@ namespace AZ
             IAllocatorSchema*       m_subAllocator;                         ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
             size_t                  m_systemChunkSize;                      ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
             size_t                  m_capacity;                             ///< Max size this allocator can grow to
+            bool                    m_isThreadCaching;                      ///< True to cache small allocation blocks per thread, so threads don't contend on the pool locks.
+            unsigned int            m_threadCacheTrimIntervalMs;            ///< How often thread caches are trimmed, caches unused for a whole interval are returned to the pools. 0 to only trim in GarbageCollect.
         };
 
 
@@ -68,6 +72,8 @@ namespace AZ
         size_type       GetMaxAllocationSize() const override;
         size_type       GetMaxContiguousAllocationSize() const override;
         size_type       GetUnAllocatedMemory(bool isPrint = false) const override;
+        /// Returns the bytes of free blocks held by the thread caches, they are included in GetUnAllocatedMemory.
+        size_type       GetThreadCachedMemory() const;
 
         /// Return unused memory to the OS (if we don't use fixed block). Don't call this unless you really need free memory, it is slow.
         void            GarbageCollect() override;
@@ -7,11 +7,14 @@
  */
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Memory/PoolSchema.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/RTTI/BehaviorContextUtilities.h>
 #include <AzCore/Script/ScriptContextDebug.h>
 #include <AzCore/Script/ScriptProperty.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/IO/GenericStreams.h>
@@ -1431,6 +1434,10 @@ namespace AZ
 
 namespace AZ
 {
+    AZ_CVAR(bool, cl_luaPoolAllocator, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Pool the small allocations of the Lua states created by ScriptContexts, applies to the contexts created after it is changed.");
+    AZ_CVAR(bool, cl_luaFastMethodCalls, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Bind the reflected methods that only use numbers and value types with the specialized Lua callers, applies to the classes bound after it is changed.");
 
 #ifndef AZ_USE_CUSTOM_SCRIPT_BIND
 
@@ -1455,6 +1462,129 @@ namespace AZ
         _varName = "?";                                                       \
         }
 
+namespace Internal
+{
+    /**
+     * Single threaded small object allocator of a Lua state. Lua allocates enormous numbers of small tables,
+     * strings and closures, which are pooled in size classes (\ref PoolSchema) instead of going through the
+     * general purpose allocator. Lua always passes the size of the block it frees or reallocates, which tells
+     * which allocator owns it without a lookup.
+     */
+    class LuaPoolAllocator
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(LuaPoolAllocator, AZ::SystemAllocator, 0);
+
+        static constexpr size_t s_maxPooledSize = 256;
+
+        LuaPoolAllocator(IAllocator* fallbackAllocator)
+            : m_fallbackAllocator(fallbackAllocator)
+        {
+            PoolSchema::Descriptor desc;
+            desc.m_pageSize = 64 * 1024;
+            desc.m_minAllocationSize = LUA_DEFAULT_ALIGNMENT;
+            desc.m_maxAllocationSize = s_maxPooledSize;
+            desc.m_pageAllocator = fallbackAllocator;
+            m_pool.Create(desc);
+        }
+
+        ~LuaPoolAllocator()
+        {
+            m_pool.Destroy();
+        }
+
+        void* ReAllocate(void* ptr, size_t oldSize, size_t newSize)
+        {
+            if (newSize == 0)
+            {
+                if (ptr)
+                {
+                    DeAllocate(ptr, oldSize);
+                }
+                return nullptr;
+            }
+            else if (ptr == nullptr)
+            {
+                return Allocate(newSize);
+            }
+            else if (IsPooled(oldSize) && IsPooled(newSize))
+            {
+                if (SizeClass(oldSize) == SizeClass(newSize))
+                {
+                    m_statistics.m_pooledBytes += newSize - oldSize;
+                    return ptr;
+                }
+            }
+            else if (!IsPooled(oldSize) && !IsPooled(newSize))
+            {
+                void* newPtr = m_fallbackAllocator->ReAllocate(ptr, newSize, LUA_DEFAULT_ALIGNMENT);
+                if (newPtr)
+                {
+                    m_statistics.m_fallbackBytes += newSize - oldSize;
+                }
+                return newPtr;
+            }
+
+            // the block moves between size classes or between the pool and the fallback allocator
+            void* newPtr = Allocate(newSize);
+            if (newPtr)
+            {
+                memcpy(newPtr, ptr, AZStd::GetMin(oldSize, newSize));
+                DeAllocate(ptr, oldSize);
+            }
+            return newPtr;
+        }
+
+        const ScriptContext::AllocatorStatistics& GetStatistics() const
+        {
+            return m_statistics;
+        }
+
+    private:
+        static bool IsPooled(size_t size)
+        {
+            return size <= s_maxPooledSize;
+        }
+
+        static size_t SizeClass(size_t size)
+        {
+            return (size + LUA_DEFAULT_ALIGNMENT - 1) / LUA_DEFAULT_ALIGNMENT;
+        }
+
+        void* Allocate(size_t size)
+        {
+            if (IsPooled(size))
+            {
+                ++m_statistics.m_pooledAllocations;
+                m_statistics.m_pooledBytes += size;
+                return m_pool.Allocate(size, LUA_DEFAULT_ALIGNMENT, 0, "Script", __FILE__, __LINE__, 1);
+            }
+
+            ++m_statistics.m_fallbackAllocations;
+            m_statistics.m_fallbackBytes += size;
+            return m_fallbackAllocator->Allocate(size, LUA_DEFAULT_ALIGNMENT, 0, "Script", __FILE__, __LINE__, 1);
+        }
+
+        void DeAllocate(void* ptr, size_t size)
+        {
+            if (IsPooled(size))
+            {
+                m_statistics.m_pooledBytes -= size;
+                m_pool.DeAllocate(ptr, size, LUA_DEFAULT_ALIGNMENT);
+            }
+            else
+            {
+                m_statistics.m_fallbackBytes -= size;
+                m_fallbackAllocator->DeAllocate(ptr, size, LUA_DEFAULT_ALIGNMENT);
+            }
+        }
+
+        IAllocator* m_fallbackAllocator;
+        PoolSchema m_pool;
+        ScriptContext::AllocatorStatistics m_statistics;
+    };
+} // namespace Internal
+
 //=========================================================================
 // Lua Memory manager hook
 // [3/19/2012]
@@ -1481,6 +1611,15 @@ static void* LuaMemoryHook(void* userData, void* ptr, size_t osize, size_t nsize
     }
 }
 
+//=========================================================================
+// Lua Memory manager hook of states that pool their small allocations
+//=========================================================================
+static void* LuaPoolMemoryHook(void* userData, void* ptr, size_t osize, size_t nsize)
+{
+    // osize is the type of the new object when ptr is null
+    return reinterpret_cast<Internal::LuaPoolAllocator*>(userData)->ReAllocate(ptr, ptr ? osize : 0, nsize);
+}
+
 //=========================================================================
 // Lua Panic callback
 // [3/19/2012]
@@ -3587,6 +3726,220 @@ LUA_API const Node* lua_getDummyNode()
             bool m_isResult;
         };
 
+        //! Caller for the methods that only take and return numbers and reflected value types, like the math types.
+        //! What LuaScriptCaller::Call works out on every call is decided once, when the method is bound: numbers are read
+        //! into fixed storage, objects are passed straight from their user data, and object results are constructed in
+        //! their new user data, without temporary storage, the result callback and the copy to Lua.
+        //! Calls it can't handle (nil, derived or wrapped objects, default arguments) go through LuaScriptCaller::Call.
+        class LuaFastScriptCaller : public LuaScriptCaller
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(LuaFastScriptCaller, AZ::SystemAllocator, 0);
+
+            static constexpr int MaxArguments = 8;
+
+            static bool IsSupported(BehaviorContext* context, BehaviorMethod* method)
+            {
+                if (method->GetNumArguments() > MaxArguments)
+                {
+                    return false;
+                }
+
+                for (size_t iArg = 0; iArg < method->GetNumArguments(); ++iArg)
+                {
+                    const BehaviorParameter* arg = method->GetArgument(iArg);
+                    BehaviorClass* argClass = nullptr;
+                    if (!FromLuaStack(context, arg, argClass) || !IsSupportedParameter(*arg, argClass))
+                    {
+                        return false;
+                    }
+                }
+
+                if (method->HasResult())
+                {
+                    const BehaviorParameter* result = method->GetResult();
+                    BehaviorClass* resultClass = nullptr;
+                    if (!ToLuaStack(context, result, nullptr, resultClass) || !IsSupportedParameter(*result, resultClass))
+                    {
+                        return false;
+                    }
+
+                    if (resultClass)
+                    {
+                        // object results are constructed in place in a user data that Lua owns
+                        Script::Attributes::StorageType storageType = Script::Attributes::StorageType::ScriptOwn;
+                        if (Attribute* storageAttribute = FindAttribute(Script::Attributes::Storage, resultClass->m_attributes))
+                        {
+                            AttributeReader storageReader(nullptr, storageAttribute);
+                            storageReader.Read<Script::Attributes::StorageType>(storageType);
+                        }
+
+                        if (storageType != Script::Attributes::StorageType::Value || (result->m_traits & (BehaviorParameter::TR_POINTER | BehaviorParameter::TR_REFERENCE))
+                            || !resultClass->m_defaultConstructor || resultClass->m_alignment > 16)
+                        {
+                            return false;
+                        }
+                    }
+                }
+
+                return true;
+            }
+
+            LuaFastScriptCaller(BehaviorContext* context, BehaviorMethod* method)
+                : LuaScriptCaller(context, method)
+            {
+            }
+
+            int ManualCall(lua_State* lua) override
+            {
+                return Call(lua);
+            }
+
+            void PushClosure(lua_State* lua, const char* debugDescription) override
+            {
+                LSV_BEGIN(lua, 1);
+
+                lua_pushlightuserdata(lua, static_cast<LuaScriptCaller*>(this)); // the fallback reads the same up values
+                lua_pushstring(lua, debugDescription);
+                lua_pushcclosure(lua, &Internal::LuaMethodTagHelper, 0);
+                lua_pushcclosure(lua, &LuaFastScriptCaller::Call, 3);
+            }
+
+            static int Call(lua_State* lua)
+            {
+                LuaFastScriptCaller* thisPtr = static_cast<LuaFastScriptCaller*>(reinterpret_cast<LuaScriptCaller*>(lua_touserdata(lua, lua_upvalueindex(1))));
+
+                const int numArguments = static_cast<int>(thisPtr->m_method->GetNumArguments());
+                if (lua_gettop(lua) < numArguments)
+                {
+                    return LuaScriptCaller::Call(lua); // default arguments and errors
+                }
+
+                BehaviorValueParameter arguments[MaxArguments];
+                AZ::u64 argumentStorage[MaxArguments]; // numbers and object pointers
+
+                for (int i = 0; i < numArguments; ++i)
+                {
+                    const BehaviorParameter* parameter = thisPtr->m_method->GetArgument(i);
+                    BehaviorClass* argClass = thisPtr->m_fromLua[i].second;
+                    arguments[i].Set(*parameter);
+
+                    if (argClass)
+                    {
+                        LuaUserData* userData = lua_type(lua, i + 1) == LUA_TUSERDATA ? reinterpret_cast<LuaUserData*>(lua_touserdata(lua, i + 1)) : nullptr;
+                        if (!userData || userData->magicData != Internal::AZLuaUserData || userData->behaviorClass != argClass)
+                        {
+                            return LuaScriptCaller::Call(lua);
+                        }
+
+                        if (parameter->m_traits & BehaviorParameter::TR_POINTER)
+                        {
+                            arguments[i].m_value = &argumentStorage[i];
+                            *reinterpret_cast<void**>(arguments[i].m_value) = userData->value;
+                        }
+                        else
+                        {
+                            arguments[i].m_value = userData->value;
+                        }
+                    }
+                    else
+                    {
+                        arguments[i].m_value = &argumentStorage[i];
+                        thisPtr->m_fromLua[i].first(lua, i + 1, arguments[i], nullptr, nullptr);
+                    }
+                }
+
+                if (!thisPtr->m_resultToLua)
+                {
+                    if (!thisPtr->m_method->Call(arguments, numArguments, nullptr))
+                    {
+                        ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Lua failed to call %s method!", thisPtr->m_method->m_name.c_str());
+                    }
+                    return 0;
+                }
+
+                BehaviorValueParameter result;
+                result.Set(*thisPtr->m_method->GetResult());
+
+                AZ::u64 resultStorage;
+                if (thisPtr->m_resultClass)
+                {
+                    result.m_value = NewResultObject(lua, thisPtr->m_resultClass);
+                    if (!result.m_value)
+                    {
+                        return LuaScriptCaller::Call(lua); // the class isn't bound, let the generic path report it
+                    }
+                }
+                else
+                {
+                    result.m_value = &resultStorage;
+                }
+
+                if (!thisPtr->m_method->Call(arguments, numArguments, &result))
+                {
+                    ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Lua failed to call %s method!", thisPtr->m_method->m_name.c_str());
+                    if (thisPtr->m_resultClass)
+                    {
+                        lua_pop(lua, 1);
+                    }
+                    lua_pushnil(lua);
+                }
+                else if (!thisPtr->m_resultClass)
+                {
+                    thisPtr->m_resultToLua(lua, result);
+                }
+
+                return 1;
+            }
+
+        private:
+            static bool IsSupportedParameter(const BehaviorParameter& parameter, BehaviorClass* parameterClass)
+            {
+                if (!parameterClass)
+                {
+                    // strings and generic pointers are read as pointers, numbers are the rest
+                    return (parameter.m_traits & (BehaviorParameter::TR_POINTER | BehaviorParameter::TR_REFERENCE)) == 0;
+                }
+
+                return !parameterClass->m_unwrapper && !FindAttribute(Script::Attributes::ReaderWriterOverride, parameterClass->m_attributes);
+            }
+
+            //! Pushes a default constructed value of the class as a user data, same as RegisteredObjectToLua does for copies,
+            //! returns the address of the value or nullptr (and pushes nothing) if the class isn't bound
+            static void* NewResultObject(lua_State* lua, BehaviorClass* behaviorClass)
+            {
+                lua_rawgeti(lua, LUA_REGISTRYINDEX, AZ_LUA_CLASS_TABLE_REF);
+                Internal::azlua_pushtypeid(lua, behaviorClass->m_typeId);
+                lua_rawget(lua, -2);
+                if (!lua_istable(lua, -1))
+                {
+                    lua_pop(lua, 2);
+                    return nullptr;
+                }
+
+                size_t valueSize = behaviorClass->m_size;
+                if (behaviorClass->m_alignment > sizeof(L_Umaxalign))
+                {
+                    valueSize += behaviorClass->m_alignment - sizeof(L_Umaxalign);
+                }
+
+                LuaUserData* userData = reinterpret_cast<LuaUserData*>(lua_newuserdata(lua, sizeof(LuaUserData) + valueSize));
+                void* value = PointerAlignUp(static_cast<void*>(userData + 1), behaviorClass->m_alignment);
+                behaviorClass->m_defaultConstructor(value, behaviorClass->m_userData);
+
+                userData->magicData = Internal::AZLuaUserData;
+                userData->behaviorClass = behaviorClass;
+                userData->value = value;
+                userData->storageType = static_cast<u32>(Script::Attributes::StorageType::Value);
+
+                lua_pushvalue(lua, -2); // the class table is the metatable
+                lua_setmetatable(lua, -2);
+                lua_replace(lua, -3); // replace the classes table with the user data
+                lua_pop(lua, 1); // and pop the class table
+                return value;
+            }
+        };
+
         class LuaGenericCaller : public LuaCaller
         {
         public:
@@ -4328,8 +4681,21 @@ LUA_API const Node* lua_getDummyNode()
                         desc.m_heap.m_systemChunkSize = 1024 * 1024;
                         m_luaAllocator.Create(desc);
                         allocator = m_luaAllocator.Get();
+
+                        if (cl_luaPoolAllocator)
+                        {
+                            m_luaPoolAllocator = AZStd::make_unique<Internal::LuaPoolAllocator>(allocator);
+                        }
+                    }
+
+                    if (m_luaPoolAllocator)
+                    {
+                        m_lua = lua_newstate(&LuaPoolMemoryHook, m_luaPoolAllocator.get());
+                    }
+                    else
+                    {
+                        m_lua = lua_newstate(&LuaMemoryHook, allocator);
                     }
-                    m_lua = lua_newstate(&LuaMemoryHook, allocator);
                     AZ_Assert(m_lua, "Failed to create new LUA state!");
                 }
 
@@ -4624,6 +4990,12 @@ LUA_API const Node* lua_getDummyNode()
                     binder = caller;
                     m_genericMethods.insert(caller);
                 }
+                else if (cl_luaFastMethodCalls && LuaFastScriptCaller::IsSupported(behaviorContext, method))
+                {
+                    LuaScriptCaller* caller = aznew LuaFastScriptCaller(behaviorContext, method);
+                    binder = caller;
+                    m_methods.insert(caller);
+                }
                 else
                 {
                     // Create the generic lua script caller
@@ -5835,6 +6207,7 @@ LUA_API const Node* lua_getDummyNode()
             AZStd::vector< ScriptTypeFactory >  m_scriptPropertyArrayFactories;
             ScriptTypeFactory                   m_scriptPropertyTableFactory;
             AllocatorWrapper<Internal::LuaSystemAllocator> m_luaAllocator;
+            AZStd::unique_ptr<Internal::LuaPoolAllocator> m_luaPoolAllocator; ///< Allocates from m_luaAllocator, declared after it to be destroyed first.
             AZStd::thread::id m_ownerThreadId; // Check if Lua methods (including EBus handlers) are called from background threads.
         };
 
@@ -5881,6 +6254,32 @@ LUA_API const Node* lua_getDummyNode()
         lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    size_t ScriptContext::GarbageCollectStepForTime(AZStd::chrono::microseconds budget)
+    {
+        const auto start = AZStd::chrono::steady_clock::now();
+        size_t numberOfSteps = 0;
+
+        do
+        {
+            ++numberOfSteps;
+
+            // stop when the step finished a cycle, the rest of the budget is only spent when there is garbage
+            if (lua_gc(m_impl->m_lua, LUA_GCSTEP, 0))
+            {
+                break;
+            }
+        } while (AZStd::chrono::steady_clock::now() - start < budget);
+
+        return numberOfSteps;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    ScriptContext::AllocatorStatistics ScriptContext::GetAllocatorStatistics() const
+    {
+        return m_impl->m_luaPoolAllocator ? m_impl->m_luaPoolAllocator->GetStatistics() : AllocatorStatistics();
+    }
+
     //////////////////////////////////////////////////////////////////////////
     size_t ScriptContext::GetMemoryUsage() const
     {
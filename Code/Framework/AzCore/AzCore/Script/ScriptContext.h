@@ -24,6 +24,7 @@
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/allocator_static.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/thread.h>
 
 #include <AzCore/RTTI/ReflectContext.h>
@@ -867,6 +868,24 @@ namespace AZ
          */ 
         void GarbageCollectStep(int numberOfSteps = 2);
 
+        /**
+         * Step the garbage collector until the time budget is spent or the collection cycle finished,
+         * which paces the collection cost over frames instead of spiking. Returns the number of steps.
+         */
+        size_t GarbageCollectStepForTime(AZStd::chrono::microseconds budget);
+
+        /// Statistics of the small object pool of the Lua state (cl_luaPoolAllocator)
+        struct AllocatorStatistics
+        {
+            size_t m_pooledAllocations = 0; ///< Number of allocations served by the pool.
+            size_t m_pooledBytes = 0; ///< Bytes currently allocated from the pool.
+            size_t m_fallbackAllocations = 0; ///< Number of allocations too large for the pool.
+            size_t m_fallbackBytes = 0; ///< Bytes currently allocated from the general purpose allocator.
+        };
+
+        /// Returns empty statistics for contexts that don't pool, e.g. with a custom allocator or Lua state
+        AllocatorStatistics GetAllocatorStatistics() const;
+
         lua_State* NativeContext();
 
         //////////////////////////////////////////////////////////////////////////
@@ -14,6 +14,7 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerReflection.h>
 #include <AzCore/Debug/TraceReflection.h>
 #include <AzCore/IO/FileIO.h>
@@ -34,6 +35,9 @@
 namespace AZ
 {
 
+AZ_CVAR(uint32_t, cl_luaGarbageCollectorBudgetUs, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Microseconds per system tick the incremental Lua garbage collector may step each script context for, 0 steps a fixed number of times instead.");
+
 /**
  * Script lifecycle:
  * 1. When a script is requested for load, LoadAssetData() is called by the asset database
@@ -308,7 +312,14 @@ void    ScriptSystemComponent::OnSystemTick()
             contextContainer.m_context->GetDebugContext()->ProcessDebugCommands();
         }
 
-        contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        if (cl_luaGarbageCollectorBudgetUs > 0)
+        {
+            contextContainer.m_context->GarbageCollectStepForTime(AZStd::chrono::microseconds(static_cast<uint32_t>(cl_luaGarbageCollectorBudgetUs)));
+        }
+        else
+        {
+            contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        }
     }
 }
 
@@ -126,6 +126,7 @@ namespace AZ
         : JsonBaseContext(settings.m_metadata, settings.m_reporting,
             StackedString::Format::JsonPointer, settings.m_serializeContext, settings.m_registrationContext)
         , m_clearContainers(settings.m_clearContainers)
+        , m_useClassLoadPlans(settings.m_useClassLoadPlans)
     {
     }
 
@@ -134,6 +135,11 @@ namespace AZ
         return m_clearContainers;
     }
 
+    bool JsonDeserializerContext::ShouldUseClassLoadPlans() const
+    {
+        return m_useClassLoadPlans;
+    }
+
 
 
     //
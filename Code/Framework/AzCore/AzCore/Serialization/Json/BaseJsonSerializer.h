@@ -100,9 +100,12 @@ namespace AZ
         //! any values in the container will be kept and not overwritten.
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool ShouldClearContainers() const;
+        //! If true then classes are loaded through the plans compiled by the registration context instead of searching the class data.
+        bool ShouldUseClassLoadPlans() const;
 
     private:
         bool m_clearContainers = false;
+        bool m_useClassLoadPlans = true;
     };
 
     class JsonSerializerContext final
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/Json/JsonClassLoadPlan.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace JsonClassLoadPlanInternal
+    {
+        // Finalizer of MurmurHash3, the name crcs are already well distributed but the seed has to change every bit
+        static u32 Mix(u32 value, u32 seed)
+        {
+            value ^= seed;
+            value ^= value >> 16;
+            value *= 0x85ebca6b;
+            value ^= value >> 13;
+            value *= 0xc2b2ae35;
+            value ^= value >> 16;
+            return value;
+        }
+
+        static u32 NextPowerOfTwo(size_t value)
+        {
+            u32 result = 1;
+            while (result < value)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        // Number of seeds tried for a bucket before the table is made larger
+        static constexpr u32 MaxBucketSeed = 1 << 12;
+    } // namespace JsonClassLoadPlanInternal
+
+    JsonClassLoadPlan::JsonClassLoadPlan(const SerializeContext& serializeContext, const JsonRegistrationContext& registrationContext,
+        const SerializeContext::ClassData& classData)
+    {
+        AddElements(serializeContext, registrationContext, classData, 0);
+        BuildTable();
+    }
+
+    const JsonClassLoadPlan::Element* JsonClassLoadPlan::FindElement(Crc32 nameCrc) const
+    {
+        using namespace JsonClassLoadPlanInternal;
+
+        const u32 bucket = Mix(nameCrc, 0) & m_bucketMask;
+        const u32 slot = Mix(nameCrc, m_bucketSeeds[bucket]) & m_slotMask;
+        const u32 elementIndex = m_slots[slot];
+        if (elementIndex != 0 && m_elements[elementIndex - 1].m_nameCrc == nameCrc)
+        {
+            return &m_elements[elementIndex - 1];
+        }
+        return nullptr;
+    }
+
+    size_t JsonClassLoadPlan::GetElementCount() const
+    {
+        return m_elementCount;
+    }
+
+    void JsonClassLoadPlan::AddElements(const SerializeContext& serializeContext, const JsonRegistrationContext& registrationContext,
+        const SerializeContext::ClassData& classData, size_t baseOffset)
+    {
+        // The class data stores the base classes first, visiting the elements in reverse makes the elements of the derived class
+        // take precedence over the elements of the base classes in case of naming conflicts.
+        for (auto elementData = classData.m_elements.crbegin(); elementData != classData.m_elements.crend(); ++elementData)
+        {
+            Element element;
+            element.m_info = &*elementData;
+            element.m_offset = baseOffset + elementData->m_offset;
+            element.m_nameCrc = Crc32(elementData->m_nameCrc);
+
+            if (elementData->m_flags & SerializeContext::ClassElement::Flags::FLG_BASE_CLASS)
+            {
+                m_elements.push_back(element);
+                if (const SerializeContext::ClassData* baseClassData = serializeContext.FindClassData(elementData->m_typeId))
+                {
+                    AddElements(serializeContext, registrationContext, *baseClassData, element.m_offset);
+                }
+            }
+            else
+            {
+                if ((elementData->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) == 0)
+                {
+                    element.m_serializer = registrationContext.GetSerializerForType(elementData->m_typeId);
+                }
+                m_elements.push_back(element);
+                ++m_elementCount;
+            }
+        }
+    }
+
+    void JsonClassLoadPlan::BuildTable()
+    {
+        using namespace JsonClassLoadPlanInternal;
+
+        // Only the first element with a name can be found, the others don't go into the table
+        AZStd::vector<u32> elementIndices;
+        AZStd::unordered_set<u32> names;
+        for (u32 elementIndex = 0; elementIndex < m_elements.size(); ++elementIndex)
+        {
+            if (names.insert(m_elements[elementIndex].m_nameCrc).second)
+            {
+                elementIndices.push_back(elementIndex);
+            }
+        }
+
+        // Buckets of about two names are placed into a table twice as large as the number of names, starting with the fullest
+        // buckets, by trying seeds until all the names of a bucket land in empty slots.
+        u32 slotCount = NextPowerOfTwo(elementIndices.size() * 2);
+        const u32 bucketCount = NextPowerOfTwo((elementIndices.size() + 1) / 2);
+        m_bucketMask = bucketCount - 1;
+
+        AZStd::vector<AZStd::vector<u32>> buckets(bucketCount);
+        for (u32 elementIndex : elementIndices)
+        {
+            buckets[Mix(m_elements[elementIndex].m_nameCrc, 0) & m_bucketMask].push_back(elementIndex);
+        }
+        AZStd::vector<u32> bucketOrder(bucketCount);
+        for (u32 bucket = 0; bucket < bucketCount; ++bucket)
+        {
+            bucketOrder[bucket] = bucket;
+        }
+        AZStd::sort(bucketOrder.begin(), bucketOrder.end(), [&buckets](u32 lhs, u32 rhs)
+        {
+            return buckets[lhs].size() > buckets[rhs].size();
+        });
+
+        AZStd::vector<u32> bucketSlots;
+        for (;;)
+        {
+            m_slotMask = slotCount - 1;
+            m_slots.assign(slotCount, 0);
+            m_bucketSeeds.assign(bucketCount, 0);
+
+            bool tableBuilt = true;
+            for (u32 bucket : bucketOrder)
+            {
+                const AZStd::vector<u32>& bucketElements = buckets[bucket];
+                if (bucketElements.empty())
+                {
+                    break;
+                }
+
+                bool bucketPlaced = false;
+                for (u32 seed = 1; seed < MaxBucketSeed && !bucketPlaced; ++seed)
+                {
+                    bucketSlots.clear();
+                    bucketPlaced = true;
+                    for (u32 elementIndex : bucketElements)
+                    {
+                        const u32 slot = Mix(m_elements[elementIndex].m_nameCrc, seed) & m_slotMask;
+                        if (m_slots[slot] != 0 || AZStd::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+                        {
+                            bucketPlaced = false;
+                            break;
+                        }
+                        bucketSlots.push_back(slot);
+                    }
+
+                    if (bucketPlaced)
+                    {
+                        m_bucketSeeds[bucket] = seed;
+                        for (size_t i = 0; i < bucketElements.size(); ++i)
+                        {
+                            m_slots[bucketSlots[i]] = bucketElements[i] + 1;
+                        }
+                    }
+                }
+
+                if (!bucketPlaced)
+                {
+                    tableBuilt = false;
+                    break;
+                }
+            }
+
+            if (tableBuilt)
+            {
+                return;
+            }
+            slotCount <<= 1;
+        }
+    }
+
+    AZStd::shared_ptr<const JsonClassLoadPlan> JsonClassLoadPlanCache::GetPlan(const SerializeContext& serializeContext,
+        const JsonRegistrationContext& registrationContext, const SerializeContext::ClassData& classData)
+    {
+        const u64 reflectionVersion = serializeContext.GetReflectionVersion();
+        auto IsCurrent = [&serializeContext, reflectionVersion](const CachedPlan& cachedPlan)
+        {
+            return cachedPlan.m_serializeContext == &serializeContext && cachedPlan.m_reflectionVersion == reflectionVersion;
+        };
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            if (auto planIter = m_plans.find(&classData); planIter != m_plans.end() && IsCurrent(planIter->second))
+            {
+                return planIter->second.m_plan;
+            }
+        }
+
+        AZStd::scoped_lock<AZStd::shared_mutex> lock(m_mutex);
+        CachedPlan& cachedPlan = m_plans[&classData];
+        if (!cachedPlan.m_plan || !IsCurrent(cachedPlan))
+        {
+            cachedPlan.m_plan = AZStd::make_shared<JsonClassLoadPlan>(serializeContext, registrationContext, classData);
+            cachedPlan.m_serializeContext = &serializeContext;
+            cachedPlan.m_reflectionVersion = reflectionVersion;
+        }
+        return cachedPlan.m_plan;
+    }
+
+    void JsonClassLoadPlanCache::Clear()
+    {
+        AZStd::scoped_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_plans.clear();
+    }
+} // namespace AZ
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AZ
+{
+    class BaseJsonSerializer;
+    class JsonRegistrationContext;
+
+    //! Flattened view of the elements of a class, including the elements of all its base classes, which the JsonDeserializer
+    //! uses to load objects. Members are found with a single probe of a perfect hash on their name crc instead of walking the
+    //! class data of the class and of its base classes for every member of every object, and the Json serializer of each element
+    //! is resolved up front.
+    class JsonClassLoadPlan final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(JsonClassLoadPlan, SystemAllocator, 0);
+
+        struct Element
+        {
+            const SerializeContext::ClassElement* m_info{ nullptr };
+            //! Serializer for the type of the element, null if there's no serializer for it or if the element is a pointer.
+            BaseJsonSerializer* m_serializer{ nullptr };
+            //! Offset of the element from the start of the object, including the offsets of the base classes it's in.
+            size_t m_offset{ 0 };
+            Crc32 m_nameCrc;
+        };
+
+        JsonClassLoadPlan(const SerializeContext& serializeContext, const JsonRegistrationContext& registrationContext,
+            const SerializeContext::ClassData& classData);
+
+        //! Finds the element with the name, with the same precedence as JsonDeserializer::FindElementByNameCrc, so the elements of
+        //! a derived class hide the elements with the same name of its base classes.
+        //! @return The element or null if the class has no element with this name.
+        const Element* FindElement(Crc32 nameCrc) const;
+
+        //! Returns the number of elements at the root of a json object, which is the same as JsonDeserializer::CountElements.
+        size_t GetElementCount() const;
+
+    private:
+        void AddElements(const SerializeContext& serializeContext, const JsonRegistrationContext& registrationContext,
+            const SerializeContext::ClassData& classData, size_t baseOffset);
+        void BuildTable();
+
+        //! Elements in the order JsonDeserializer::FindElementByNameCrc visits them, the first one with a name hides the others.
+        AZStd::vector<Element> m_elements;
+        //! The perfect hash first picks a bucket from the name crc, the seed of that bucket then picks the slot.
+        AZStd::vector<u32> m_bucketSeeds;
+        //! Index of an element plus one for every slot of the perfect hash, zero for empty slots.
+        AZStd::vector<u32> m_slots;
+        u32 m_bucketMask{ 0 };
+        u32 m_slotMask{ 0 };
+        size_t m_elementCount{ 0 };
+    };
+
+    //! Lazily built JsonClassLoadPlans, shared by all the loads going through a JsonRegistrationContext.
+    //! A plan is rebuilt when the serialize context reflection changed since it was built, the JsonRegistrationContext clears
+    //! the cache when serializers are registered or unregistered.
+    class JsonClassLoadPlanCache final
+    {
+    public:
+        //! Returns the plan for the class data, building it if needed.
+        //! The cache replaces the plan when the reflection of the serialize context or the registered serializers change, the
+        //! returned plan stays alive for the loads still using it.
+        AZStd::shared_ptr<const JsonClassLoadPlan> GetPlan(const SerializeContext& serializeContext, const JsonRegistrationContext& registrationContext,
+            const SerializeContext::ClassData& classData);
+
+        void Clear();
+
+    private:
+        struct CachedPlan
+        {
+            AZStd::shared_ptr<const JsonClassLoadPlan> m_plan;
+            const SerializeContext* m_serializeContext{ nullptr };
+            u64 m_reflectionVersion{ 0 };
+        };
+
+        AZStd::shared_mutex m_mutex;
+        AZStd::unordered_map<const SerializeContext::ClassData*, CachedPlan> m_plans;
+    };
+} // namespace AZ
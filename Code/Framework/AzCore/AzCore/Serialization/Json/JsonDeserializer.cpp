@@ -191,6 +191,11 @@ namespace AZ
 
         AZ_Assert(context.GetRegistrationContext() && context.GetSerializeContext(), "Expected valid registration context and serialize context.");
 
+        // The plan is held for the whole load, the cache may replace it meanwhile when serializers are (un)registered.
+        const AZStd::shared_ptr<const JsonClassLoadPlan> plan = context.ShouldUseClassLoadPlans()
+            ? context.GetRegistrationContext()->GetClassLoadPlan(*context.GetSerializeContext(), classData)
+            : nullptr;
+
         size_t numLoads = 0;
         ResultCode retVal(Tasks::ReadField);
         for (auto iter = value.MemberBegin(); iter != value.MemberEnd(); ++iter)
@@ -202,12 +207,30 @@ namespace AZ
                 continue;
             }
             Crc32 nameCrc(name);
-            ElementDataResult foundElementData = FindElementByNameCrc(*context.GetSerializeContext(), object, classData, nameCrc);
+            ElementDataResult foundElementData;
+            BaseJsonSerializer* serializer = nullptr;
+            if (plan)
+            {
+                if (const JsonClassLoadPlan::Element* element = plan->FindElement(nameCrc))
+                {
+                    foundElementData.m_data = reinterpret_cast<char*>(object) + element->m_offset;
+                    foundElementData.m_info = element->m_info;
+                    foundElementData.m_found = true;
+                    serializer = element->m_serializer;
+                }
+            }
+            else
+            {
+                foundElementData = FindElementByNameCrc(*context.GetSerializeContext(), object, classData, nameCrc);
+            }
 
             ScopedContextPath subPath(context, name);
             if (foundElementData.m_found)
             {
-                ResultCode result = LoadWithClassElement(foundElementData.m_data, val, *foundElementData.m_info, context);
+                // The plan already resolved the serializer, which is what LoadWithClassElement would end up looking up.
+                ResultCode result = serializer
+                    ? DeserializerDefaultCheck(serializer, foundElementData.m_data, foundElementData.m_info->m_typeId, val, false, context)
+                    : LoadWithClassElement(foundElementData.m_data, val, *foundElementData.m_info, context);
                 retVal.Combine(result);
 
                 if (result.GetProcessing() == Processing::Halted)
@@ -226,7 +249,7 @@ namespace AZ
             }
         }
 
-        size_t elementCount = CountElements(*context.GetSerializeContext(), classData);
+        size_t elementCount = plan ? plan->GetElementCount() : CountElements(*context.GetSerializeContext(), classData);
         if (elementCount > numLoads)
         {
             retVal.Combine(ResultCode(Tasks::ReadField, numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
@@ -36,6 +36,10 @@ namespace AZ
         //! any values in the container will be kept and not overwritten.
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool m_clearContainers = false;
+        //! If true classes are loaded through a plan that's compiled once per class, which finds the members with a perfect hash
+        //! and holds the serializers of the members. If false the class data of the class and its base classes is searched for
+        //! every member.
+        bool m_useClassLoadPlans = true;
     };
 
     //! Optional settings used while storing an object to a json value.
@@ -32,6 +32,9 @@ namespace AZ
     JsonRegistrationContext::SerializerBuilder* JsonRegistrationContext::SerializerBuilder::HandlesTypeId(
         const Uuid& uuid, bool overwriteExisting)
     {
+        // The load plans store the serializers of the elements
+        m_context->m_classLoadPlans.Clear();
+
         if (!m_context->IsRemovingReflection())
         {
             auto serializer = m_serializerIter->second.get();
@@ -84,4 +87,10 @@ namespace AZ
         auto serializerIter = m_jsonSerializers.find(typeId);
         return serializerIter != m_jsonSerializers.end() ? serializerIter->second.get() : nullptr;
     }
+
+    AZStd::shared_ptr<const JsonClassLoadPlan> JsonRegistrationContext::GetClassLoadPlan(
+        const SerializeContext& serializeContext, const SerializeContext::ClassData& classData) const
+    {
+        return m_classLoadPlans.GetPlan(serializeContext, *this, classData);
+    }
 } // namespace AZ
@@ -13,6 +13,7 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonClassLoadPlan.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -34,6 +35,11 @@ namespace AZ
         const HandledTypesMap& GetRegisteredSerializers() const;
         BaseJsonSerializer* GetSerializerForType(const Uuid& typeId) const;
         BaseJsonSerializer* GetSerializerForSerializerType(const Uuid& typeId) const;
+        //! Returns the plan the JsonDeserializer uses to load objects of the class, the plan is built the first time it's requested
+        //! and rebuilt if the reflection of the serialize context or the registered serializers changed since. Callers keep the
+        //! returned plan for the duration of the load, so a rebuild on another thread doesn't free it while it's in use.
+        AZStd::shared_ptr<const JsonClassLoadPlan> GetClassLoadPlan(
+            const SerializeContext& serializeContext, const SerializeContext::ClassData& classData) const;
         
         template <typename T>
         SerializerBuilder Serializer()
@@ -118,5 +124,6 @@ namespace AZ
     protected:
         SerializerMap m_jsonSerializers;
         HandledTypesMap m_handledTypesMap;
+        mutable JsonClassLoadPlanCache m_classLoadPlans;
     };
 } // namespace AZ
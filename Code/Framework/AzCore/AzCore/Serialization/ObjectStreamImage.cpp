@@ -0,0 +1,501 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/ObjectStreamImage.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/hash.h>
+
+namespace AZ
+{
+    namespace ObjectStreamImageInternal
+    {
+        static const ObjectStreamImage::Layout* FindLayout(const SerializeContext::ClassData& classData)
+        {
+            auto layoutAttribute = azrtti_cast<AttributeData<ObjectStreamImage::Layout>*>(
+                classData.FindAttribute(SerializeContextAttributes::ObjectStreamImageLayout));
+            return layoutAttribute ? &layoutAttribute->Get(nullptr) : nullptr;
+        }
+
+        static const SerializeContext::ClassData* FindElementClassData(
+            const SerializeContext& serializeContext, const SerializeContext::ClassElement& element)
+        {
+            if (element.m_genericClassInfo)
+            {
+                return element.m_genericClassInfo->GetClassData();
+            }
+            const SerializeContext::ClassData* classData = serializeContext.FindClassData(element.m_typeId);
+            return classData ? classData : serializeContext.FindClassData(serializeContext.GetUnderlyingTypeId(element.m_typeId));
+        }
+
+        static size_t AlignUp(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        //! Hashes the reflected layout of a class and checks it can be stored in an image.
+        class LayoutHasher
+        {
+        public:
+            explicit LayoutHasher(const SerializeContext& serializeContext)
+                : m_serializeContext(serializeContext)
+            {
+            }
+
+            bool HashRoot(const SerializeContext::ClassData& classData, u64& hash)
+            {
+                m_hash = 0;
+                if (!HashPointee(classData))
+                {
+                    return false;
+                }
+                hash = m_hash;
+                return true;
+            }
+
+        private:
+            bool HashPointee(const SerializeContext::ClassData& classData)
+            {
+                const ObjectStreamImage::Layout* layout = FindLayout(classData);
+                if (!layout)
+                {
+                    AZ_Error("ObjectStreamImage", false, "Class '%s' doesn't have the ObjectStreamImageLayout attribute.", classData.m_name);
+                    return false;
+                }
+
+                AZStd::hash_combine(m_hash, classData.m_typeId, layout->m_size, layout->m_alignment);
+                for (const Uuid& visitedTypeId : m_visitedPointees)
+                {
+                    if (visitedTypeId == classData.m_typeId)
+                    {
+                        return true;
+                    }
+                }
+                m_visitedPointees.push_back(classData.m_typeId);
+                return HashClass(classData, true);
+            }
+
+            bool HashClass(const SerializeContext::ClassData& classData, bool allowPointers)
+            {
+                for (const SerializeContext::ClassElement& element : classData.m_elements)
+                {
+                    const bool isPointer = (element.m_flags & SerializeContext::ClassElement::FLG_POINTER) != 0;
+                    AZStd::hash_combine(m_hash, element.m_nameCrc, element.m_offset, element.m_dataSize, isPointer, element.m_typeId);
+
+                    const SerializeContext::ClassData* elementClassData = FindElementClassData(m_serializeContext, element);
+                    if (!elementClassData)
+                    {
+                        AZ_Error("ObjectStreamImage", false, "Element '%s' of class '%s' isn't reflected.", element.m_name, classData.m_name);
+                        return false;
+                    }
+
+                    bool supported = true;
+                    if (isPointer)
+                    {
+                        supported = allowPointers && HashPointee(*elementClassData);
+                    }
+                    else if (elementClassData->m_container)
+                    {
+                        supported = HashContainer(*elementClassData);
+                    }
+                    else
+                    {
+                        supported = HashClass(*elementClassData, allowPointers);
+                    }
+
+                    if (!supported)
+                    {
+                        AZ_Error("ObjectStreamImage", false, "Element '%s' of class '%s' can't be stored in an ObjectStreamImage.",
+                            element.m_name, classData.m_name);
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            // Fixed size containers are stored inline, their elements can't hold pointers as they aren't walked when relocating
+            bool HashContainer(const SerializeContext::ClassData& classData)
+            {
+                SerializeContext::IDataContainer* container = classData.m_container;
+                if (!container->IsFixedSize() || container->IsSmartPointer())
+                {
+                    return false;
+                }
+
+                bool supported = true;
+                container->EnumTypes([this, &supported](const Uuid& typeId, const SerializeContext::ClassElement* genericClassElement)
+                {
+                    AZStd::hash_combine(m_hash, typeId);
+                    const SerializeContext::ClassData* elementClassData = genericClassElement
+                        ? FindElementClassData(m_serializeContext, *genericClassElement)
+                        : m_serializeContext.FindClassData(typeId);
+                    supported = supported && elementClassData &&
+                        (!genericClassElement || (genericClassElement->m_flags & SerializeContext::ClassElement::FLG_POINTER) == 0) &&
+                        (elementClassData->m_container ? HashContainer(*elementClassData) : HashClass(*elementClassData, false));
+                    return true;
+                });
+                return supported;
+            }
+
+            const SerializeContext& m_serializeContext;
+            AZStd::vector<Uuid> m_visitedPointees;
+            size_t m_hash = 0;
+        };
+
+        //! Copies objects into an image and records the location of the pointers between them.
+        class ImageWriter
+        {
+        public:
+            explicit ImageWriter(const SerializeContext& serializeContext)
+                : m_serializeContext(serializeContext)
+            {
+            }
+
+            void WriteRoot(const void* object, const SerializeContext::ClassData& classData)
+            {
+                AddObject(object, classData);
+                // Objects are written breadth first so long chains of pointers don't recurse
+                for (size_t pendingIndex = 0; pendingIndex < m_pending.size(); ++pendingIndex)
+                {
+                    const PendingObject pending = m_pending[pendingIndex];
+                    WritePointers(reinterpret_cast<const char*>(pending.m_object), *pending.m_classData, pending.m_imageOffset);
+                }
+            }
+
+            AZStd::vector<char> m_image;
+            AZStd::vector<u64> m_relocations;
+            size_t m_alignment = alignof(u64);
+
+        private:
+            struct PendingObject
+            {
+                const void* m_object;
+                const SerializeContext::ClassData* m_classData;
+                size_t m_imageOffset;
+            };
+
+            size_t AddObject(const void* object, const SerializeContext::ClassData& classData)
+            {
+                auto [offsetIter, inserted] = m_objectOffsets.try_emplace(object, 0);
+                if (inserted)
+                {
+                    const ObjectStreamImage::Layout* layout = FindLayout(classData);
+                    const size_t imageOffset = AlignUp(m_image.size(), layout->m_alignment);
+                    m_image.resize(imageOffset + layout->m_size);
+                    memcpy(m_image.data() + imageOffset, object, layout->m_size);
+                    m_alignment = AZStd::max(m_alignment, layout->m_alignment);
+
+                    offsetIter->second = imageOffset;
+                    m_pending.push_back({ object, &classData, imageOffset });
+                }
+                return offsetIter->second;
+            }
+
+            void WritePointers(const char* object, const SerializeContext::ClassData& classData, size_t imageOffset)
+            {
+                for (const SerializeContext::ClassElement& element : classData.m_elements)
+                {
+                    const SerializeContext::ClassData* elementClassData = FindElementClassData(m_serializeContext, element);
+                    if (element.m_flags & SerializeContext::ClassElement::FLG_POINTER)
+                    {
+                        const void* target = *reinterpret_cast<const void* const*>(object + element.m_offset);
+                        uintptr_t storedOffset = 0;
+                        if (target)
+                        {
+                            storedOffset = AddObject(target, *elementClassData);
+                            m_relocations.push_back(imageOffset + element.m_offset);
+                        }
+                        memcpy(m_image.data() + imageOffset + element.m_offset, &storedOffset, sizeof(storedOffset));
+                    }
+                    else if (!elementClassData->m_container)
+                    {
+                        WritePointers(object + element.m_offset, *elementClassData, imageOffset + element.m_offset);
+                    }
+                }
+            }
+
+            const SerializeContext& m_serializeContext;
+            AZStd::unordered_map<const void*, size_t> m_objectOffsets;
+            AZStd::vector<PendingObject> m_pending;
+        };
+    } // namespace ObjectStreamImageInternal
+
+    ObjectStreamImage::~ObjectStreamImage()
+    {
+        Reset();
+    }
+
+    ObjectStreamImage::ObjectStreamImage(ObjectStreamImage&& rhs)
+        : m_header(rhs.m_header)
+        , m_relocations(AZStd::move(rhs.m_relocations))
+        , m_image(rhs.m_image)
+        , m_ownsImage(rhs.m_ownsImage)
+    {
+        rhs.m_image = nullptr;
+        rhs.m_ownsImage = false;
+    }
+
+    ObjectStreamImage& ObjectStreamImage::operator=(ObjectStreamImage&& rhs)
+    {
+        if (this != &rhs)
+        {
+            Reset();
+            m_header = rhs.m_header;
+            m_relocations = AZStd::move(rhs.m_relocations);
+            m_image = rhs.m_image;
+            m_ownsImage = rhs.m_ownsImage;
+            rhs.m_image = nullptr;
+            rhs.m_ownsImage = false;
+        }
+        return *this;
+    }
+
+    bool ObjectStreamImage::IsSupported(const SerializeContext& serializeContext, const Uuid& typeId)
+    {
+        const SerializeContext::ClassData* classData = serializeContext.FindClassData(typeId);
+        u64 layoutHash;
+        return classData && ObjectStreamImageInternal::LayoutHasher(serializeContext).HashRoot(*classData, layoutHash);
+    }
+
+    bool ObjectStreamImage::IsImage(const void* data, size_t size)
+    {
+        u32 magic;
+        if (size < sizeof(Header))
+        {
+            return false;
+        }
+        memcpy(&magic, data, sizeof(magic));
+        return magic == Magic;
+    }
+
+    bool ObjectStreamImage::Save(IO::GenericStream& stream, const void* object, const Uuid& typeId, const SerializeContext& serializeContext)
+    {
+        using namespace ObjectStreamImageInternal;
+
+        const SerializeContext::ClassData* classData = serializeContext.FindClassData(typeId);
+        if (!classData)
+        {
+            AZ_Error("ObjectStreamImage", false, "Type %s isn't reflected.", typeId.ToString<AZStd::string>().c_str());
+            return false;
+        }
+
+        Header header;
+        if (!LayoutHasher(serializeContext).HashRoot(*classData, header.m_layoutHash))
+        {
+            return false;
+        }
+
+        ImageWriter writer(serializeContext);
+        writer.WriteRoot(object, *classData);
+
+        header.m_typeId = typeId;
+        header.m_imageSize = writer.m_image.size();
+        header.m_relocationCount = writer.m_relocations.size();
+        header.m_imageAlignment = aznumeric_cast<u32>(writer.m_alignment);
+
+        const size_t relocationsSize = writer.m_relocations.size() * sizeof(u64);
+        return stream.Write(sizeof(header), &header) == sizeof(header) &&
+            stream.Write(writer.m_image.size(), writer.m_image.data()) == writer.m_image.size() &&
+            stream.Write(relocationsSize, writer.m_relocations.data()) == relocationsSize;
+    }
+
+    bool ObjectStreamImage::FitsInSize(const Header& header, u64 remainingSize)
+    {
+        return header.m_imageSize <= remainingSize && header.m_relocationCount <= (remainingSize - header.m_imageSize) / sizeof(u64);
+    }
+
+    bool ObjectStreamImage::Load(IO::GenericStream& stream, const SerializeContext& serializeContext, const Uuid& expectedTypeId)
+    {
+        Reset();
+
+        Header header;
+        if (stream.Read(sizeof(header), &header) != sizeof(header) || !ValidateHeader(header, serializeContext, expectedTypeId))
+        {
+            return false;
+        }
+        if (stream.GetCurPos() > stream.GetLength() || !FitsInSize(header, stream.GetLength() - stream.GetCurPos()))
+        {
+            AZ_Error("ObjectStreamImage", false, "ObjectStreamImage in '%s' is truncated.", stream.GetFilename());
+            return false;
+        }
+
+        m_header = header;
+        m_image = reinterpret_cast<char*>(azmalloc(header.m_imageSize, header.m_imageAlignment, SystemAllocator, "ObjectStreamImage"));
+        m_ownsImage = true;
+        m_relocations.resize_no_construct(header.m_relocationCount);
+        const size_t relocationsSize = header.m_relocationCount * sizeof(u64);
+        if (stream.Read(header.m_imageSize, m_image) != header.m_imageSize ||
+            stream.Read(relocationsSize, m_relocations.data()) != relocationsSize ||
+            !Relocate())
+        {
+            Reset();
+            return false;
+        }
+        return true;
+    }
+
+    bool ObjectStreamImage::LoadInPlace(void* data, size_t size, const SerializeContext& serializeContext, const Uuid& expectedTypeId)
+    {
+        Reset();
+
+        Header header;
+        if (size < sizeof(header))
+        {
+            return false;
+        }
+        memcpy(&header, data, sizeof(header));
+        if (!ValidateHeader(header, serializeContext, expectedTypeId))
+        {
+            return false;
+        }
+        if (!FitsInSize(header, size - sizeof(header)))
+        {
+            AZ_Error("ObjectStreamImage", false, "ObjectStreamImage is truncated.");
+            return false;
+        }
+
+        char* image = reinterpret_cast<char*>(data) + sizeof(header);
+        if (reinterpret_cast<uintptr_t>(image) % header.m_imageAlignment != 0)
+        {
+            AZ_Error("ObjectStreamImage", false, "The memory of an ObjectStreamImage loaded in place has to be aligned to %u bytes.",
+                header.m_imageAlignment);
+            return false;
+        }
+
+        m_header = header;
+        m_image = image;
+        m_ownsImage = false;
+        m_relocations.resize_no_construct(header.m_relocationCount);
+        memcpy(m_relocations.data(), image + header.m_imageSize, header.m_relocationCount * sizeof(u64));
+        if (!Relocate())
+        {
+            Reset();
+            return false;
+        }
+        return true;
+    }
+
+    bool ObjectStreamImage::Write(IO::GenericStream& stream) const
+    {
+        if (!IsLoaded())
+        {
+            return false;
+        }
+
+        // The pointers are turned back into offsets in a copy, the objects may be in use
+        AZStd::vector<char> image(m_image, m_image + m_header.m_imageSize);
+        for (u64 relocation : m_relocations)
+        {
+            uintptr_t pointer;
+            memcpy(&pointer, image.data() + relocation, sizeof(pointer));
+            pointer -= reinterpret_cast<uintptr_t>(m_image);
+            memcpy(image.data() + relocation, &pointer, sizeof(pointer));
+        }
+
+        const size_t relocationsSize = m_relocations.size() * sizeof(u64);
+        return stream.Write(sizeof(m_header), &m_header) == sizeof(m_header) &&
+            stream.Write(image.size(), image.data()) == image.size() &&
+            stream.Write(relocationsSize, m_relocations.data()) == relocationsSize;
+    }
+
+    void ObjectStreamImage::Reset()
+    {
+        if (m_ownsImage)
+        {
+            azfree(m_image, SystemAllocator, m_header.m_imageSize, m_header.m_imageAlignment);
+        }
+        m_image = nullptr;
+        m_ownsImage = false;
+        m_relocations = {};
+        m_header = {};
+    }
+
+    bool ObjectStreamImage::IsLoaded() const
+    {
+        return m_image != nullptr;
+    }
+
+    const Uuid& ObjectStreamImage::GetTypeId() const
+    {
+        return m_header.m_typeId;
+    }
+
+    size_t ObjectStreamImage::GetImageSize() const
+    {
+        return IsLoaded() ? m_header.m_imageSize : 0;
+    }
+
+    const void* ObjectStreamImage::GetRoot() const
+    {
+        return m_image;
+    }
+
+    bool ObjectStreamImage::ValidateHeader(const Header& header, const SerializeContext& serializeContext, const Uuid& expectedTypeId)
+    {
+        if (header.m_magic != Magic || header.m_version != Version || header.m_pointerSize != sizeof(void*))
+        {
+            AZ_Error("ObjectStreamImage", false, "Data isn't an ObjectStreamImage for this platform (version %u, pointer size %u).",
+                header.m_version, header.m_pointerSize);
+            return false;
+        }
+        if (!expectedTypeId.IsNull() && header.m_typeId != expectedTypeId)
+        {
+            AZ_Error("ObjectStreamImage", false, "ObjectStreamImage holds a %s instead of a %s.",
+                header.m_typeId.ToString<AZStd::string>().c_str(), expectedTypeId.ToString<AZStd::string>().c_str());
+            return false;
+        }
+        if (header.m_imageSize == 0 || header.m_imageAlignment == 0 || (header.m_imageAlignment & (header.m_imageAlignment - 1)) != 0)
+        {
+            AZ_Error("ObjectStreamImage", false, "ObjectStreamImage header is corrupted.");
+            return false;
+        }
+
+        const SerializeContext::ClassData* classData = serializeContext.FindClassData(header.m_typeId);
+        u64 layoutHash = 0;
+        if (!classData || !ObjectStreamImageInternal::LayoutHasher(serializeContext).HashRoot(*classData, layoutHash) ||
+            layoutHash != header.m_layoutHash)
+        {
+            AZ_Error("ObjectStreamImage", false, "ObjectStreamImage of %s was built for a different layout of the class and needs to be rebuilt.",
+                header.m_typeId.ToString<AZStd::string>().c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool ObjectStreamImage::Relocate()
+    {
+        // Everything is checked before the first pointer is written, so a corrupted image loaded in place is left untouched
+        for (u64 relocation : m_relocations)
+        {
+            uintptr_t offset;
+            if (relocation > m_header.m_imageSize || m_header.m_imageSize - relocation < sizeof(offset) ||
+                relocation % alignof(uintptr_t) != 0)
+            {
+                AZ_Error("ObjectStreamImage", false, "ObjectStreamImage has a relocation outside of the image.");
+                return false;
+            }
+            memcpy(&offset, m_image + relocation, sizeof(offset));
+            if (offset >= m_header.m_imageSize)
+            {
+                AZ_Error("ObjectStreamImage", false, "ObjectStreamImage has a pointer outside of the image.");
+                return false;
+            }
+        }
+
+        const uintptr_t imageStart = reinterpret_cast<uintptr_t>(m_image);
+        for (u64 relocation : m_relocations)
+        {
+            uintptr_t pointer;
+            memcpy(&pointer, m_image + relocation, sizeof(pointer));
+            pointer += imageStart;
+            memcpy(m_image + relocation, &pointer, sizeof(pointer));
+        }
+        return true;
+    }
+} // namespace AZ
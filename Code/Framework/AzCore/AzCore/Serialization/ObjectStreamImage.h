@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
+
+/**
+ * ObjectStreamImage is an alternative binary layout for reflected classes that opt in, meant for large assets made of plain
+ * data. Instead of a stream of elements that's parsed into newly allocated objects, the objects are stored with their in memory
+ * layout in a single image, followed by a relocation table listing the pointers in the image. Loading an image is a single read
+ * of the image and a pass over the relocation table to turn the stored offsets back into pointers, after which the objects are
+ * used directly from the image.
+ *
+ * A class opts in by adding the ObjectStreamImageLayout attribute to its reflection:
+ *
+ *  serializeContext->Class<HeightfieldData>()
+ *      ->Attribute(AZ::SerializeContextAttributes::ObjectStreamImageLayout, AZ::ObjectStreamImage::Layout::Create<HeightfieldData>())
+ *      ->Field("Heights", &HeightfieldData::m_heights)
+ *      ->Field("Material", &HeightfieldData::m_material);
+ *
+ * The class has to be trivially copyable. Its reflected elements can be values of any type, fixed size containers such as
+ * AZStd::array, and pointers to classes that opted in as well. Pointers are not owned by the objects in an image, they point to
+ * other objects in the same image. Members that aren't reflected are stored as raw bytes, so classes that opt in must reflect
+ * all of their pointers.
+ *
+ * Images are tied to the layout of the classes they store, a hash of the reflected layout is stored in the image and images
+ * built with a different layout, pointer size or endianness fail to load and have to be rebuilt.
+ */
+
+namespace AZ
+{
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    namespace SerializeContextAttributes
+    {
+        //! Class attribute that opts a class into ObjectStreamImages, the value is an ObjectStreamImage::Layout.
+        static const AZ::Crc32 ObjectStreamImageLayout = AZ_CRC_CE("ObjectStreamImageLayout");
+    }
+
+    class ObjectStreamImage
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ObjectStreamImage, SystemAllocator, 0);
+
+        //! Size and alignment of a class stored in images, which the serialize context doesn't record.
+        struct Layout
+        {
+            AZ_TYPE_INFO(ObjectStreamImage::Layout, "{3F2B8D71-6C0E-4A59-B1D4-7E9A2C5F8B03}");
+
+            template<class T>
+            static Layout Create()
+            {
+                static_assert(AZStd::is_trivially_copyable_v<T>, "Only trivially copyable classes can be stored in an ObjectStreamImage.");
+                return Layout{ sizeof(T), alignof(T) };
+            }
+
+            size_t m_size = 0;
+            size_t m_alignment = 1;
+        };
+
+        //! Identifies images, the bytes spell "AZOI" in little endian.
+        static constexpr u32 Magic = 0x494f5a41;
+        static constexpr u32 Version = 1;
+
+        ObjectStreamImage() = default;
+        ~ObjectStreamImage();
+
+        ObjectStreamImage(ObjectStreamImage&& rhs);
+        ObjectStreamImage& operator=(ObjectStreamImage&& rhs);
+        ObjectStreamImage(const ObjectStreamImage&) = delete;
+        ObjectStreamImage& operator=(const ObjectStreamImage&) = delete;
+
+        //! Returns true if objects of the type can be stored in an image.
+        static bool IsSupported(const SerializeContext& serializeContext, const Uuid& typeId);
+
+        //! Returns true if the data starts with the header of an image.
+        static bool IsImage(const void* data, size_t size);
+
+        //! Writes an image holding the object and all the objects it points to.
+        //! @return False if the type can't be stored in an image or the stream couldn't be written to.
+        static bool Save(IO::GenericStream& stream, const void* object, const Uuid& typeId, const SerializeContext& serializeContext);
+        template<class T>
+        static bool Save(IO::GenericStream& stream, const T& object, const SerializeContext& serializeContext);
+
+        //! Reads an image from the stream into memory owned by this ObjectStreamImage.
+        //! @param expectedTypeId If not null, the type of the root object of the image has to match.
+        //! @return False if the stream doesn't hold a valid image for the current layout of the type.
+        bool Load(IO::GenericStream& stream, const SerializeContext& serializeContext, const Uuid& expectedTypeId = Uuid::CreateNull());
+
+        //! Uses an image that's already in memory, for instance in a file mapped with write access, without copying it.
+        //! The pointers are relocated in the memory, which has to stay valid and aligned to the alignment of the root class for as
+        //! long as this ObjectStreamImage is used.
+        //! @param expectedTypeId If not null, the type of the root object of the image has to match.
+        //! @return False if the memory doesn't hold a valid image for the current layout of the type.
+        bool LoadInPlace(void* data, size_t size, const SerializeContext& serializeContext, const Uuid& expectedTypeId = Uuid::CreateNull());
+
+        //! Writes the loaded image back to a stream.
+        bool Write(IO::GenericStream& stream) const;
+
+        //! Releases the image, the objects in it can't be used anymore.
+        void Reset();
+
+        bool IsLoaded() const;
+        const Uuid& GetTypeId() const;
+        size_t GetImageSize() const;
+
+        //! Returns the root object of the image or null if no image is loaded.
+        const void* GetRoot() const;
+        //! Returns the root object of the image or null if no image is loaded or the root object isn't a T.
+        template<class T>
+        const T* GetRoot() const;
+
+    private:
+        struct Header
+        {
+            u32 m_magic = Magic;
+            u32 m_version = Version;
+            u32 m_pointerSize = sizeof(void*);
+            u32 m_imageAlignment = 1;
+            Uuid m_typeId = Uuid::CreateNull();
+            u64 m_layoutHash = 0;
+            u64 m_imageSize = 0;
+            u64 m_relocationCount = 0;
+            u64 m_reserved = 0;
+        };
+        static_assert(sizeof(Header) == 64, "The header is padded to 64 bytes so the images that follow it are aligned.");
+
+        static bool ValidateHeader(const Header& header, const SerializeContext& serializeContext, const Uuid& expectedTypeId);
+        //! Checks that the image and relocation table of the header fit in the remaining bytes, without overflowing on corrupted sizes.
+        static bool FitsInSize(const Header& header, u64 remainingSize);
+        bool Relocate();
+
+        Header m_header;
+        AZStd::vector<u64> m_relocations;   //!< Offsets of the pointers in the image.
+        char* m_image = nullptr;
+        bool m_ownsImage = false;
+    };
+
+    template<class T>
+    bool ObjectStreamImage::Save(IO::GenericStream& stream, const T& object, const SerializeContext& serializeContext)
+    {
+        return Save(stream, &object, azrtti_typeid<T>(), serializeContext);
+    }
+
+    template<class T>
+    const T* ObjectStreamImage::GetRoot() const
+    {
+        return GetTypeId() == azrtti_typeid<T>() ? reinterpret_cast<const T*>(GetRoot()) : nullptr;
+    }
+} // namespace AZ
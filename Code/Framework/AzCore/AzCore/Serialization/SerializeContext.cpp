@@ -408,6 +408,8 @@ namespace AZ
     SerializeContext::SerializeContext(bool registerIntegralTypes, bool createEditContext)
         : m_editContext(nullptr)
     {
+        UpdateReflectionVersion();
+
         if (registerIntegralTypes)
         {
             Class<char>()->
@@ -524,11 +526,25 @@ namespace AZ
         return m_editContext;
     }
 
+    AZ::u64 SerializeContext::GetReflectionVersion() const
+    {
+        return m_reflectionVersion;
+    }
+
+    void SerializeContext::UpdateReflectionVersion()
+    {
+        // Versions are shared by all the serialize contexts so a cache can't mistake a context for another one created at the
+        // same address.
+        static AZStd::atomic<AZ::u64> s_reflectionVersion{ 0 };
+        m_reflectionVersion = ++s_reflectionVersion;
+    }
+
     auto SerializeContext::RegisterType(const AZ::TypeId& typeId, AZ::SerializeContext::ClassData&& classData, CreateAnyFunc createAnyFunc) -> ClassBuilder
     {
         auto [typeToClassIter, inserted] = m_uuidMap.try_emplace(typeId, AZStd::move(classData));
         m_classNameToUuid.emplace(AZ::Crc32(typeToClassIter->second.m_name), typeId);
         m_uuidAnyCreationMap.emplace(typeId, createAnyFunc);
+        UpdateReflectionVersion();
 
         return ClassBuilder(this, typeToClassIter);
     }
@@ -566,6 +582,8 @@ namespace AZ
     //=========================================================================
     void SerializeContext::ClassDeprecate(const char* name, const AZ::Uuid& typeUuid, VersionConverter converter)
     {
+        UpdateReflectionVersion();
+
         if (IsRemovingReflection())
         {
             m_uuidMap.erase(typeUuid);
@@ -737,6 +755,7 @@ namespace AZ
                 m_uuidAnyCreationMap.emplace(classId, createAnyFunc);
                 m_classNameToUuid.emplace(genericClassInfo->GetClassData()->m_name, classId);
                 m_legacySpecializeTypeIdToTypeIdMap.emplace(genericClassInfo->GetLegacySpecializedTypeId(), classId);
+                UpdateReflectionVersion();
             }
         }
     }
@@ -2799,6 +2818,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::RemoveClassData(ClassData* classData)
     {
+        UpdateReflectionVersion();
         if (m_editContext)
         {
             m_editContext->RemoveClassData(classData);
@@ -160,6 +160,10 @@ namespace AZ
         /// Returns the pointer to the current edit context or NULL if one was not created.
         EditContext*    GetEditContext() const;
 
+        /// Returns a value that changes every time a class is reflected or removed, which allows caches built from the
+        /// reflected class data to detect they're out of date. The values are unique across all serialize contexts.
+        AZ::u64         GetReflectionVersion() const;
+
         /**
         * \anchor SerializeBind
         * \name Code to bind classes and variables for serialization.
@@ -1337,7 +1341,10 @@ namespace AZ
         };
 
     private:
+        void UpdateReflectionVersion();
+
         EditContext* m_editContext;  ///< Pointer to optional edit context.
+        AZ::u64 m_reflectionVersion = 0; ///< Changes every time a class is reflected or removed, see GetReflectionVersion.
         UuidToClassMap  m_uuidMap;      ///< Map for all class in this serialize context
         AZStd::unordered_multimap<AZ::Crc32, AZ::Uuid> m_classNameToUuid;  /// Map all class names to their uuid
         AZStd::unordered_multimap<Uuid, GenericClassInfo*>  m_uuidGenericMap;      ///< Uuid to ClassData map of reflected classes with GenericTypeInfo
@@ -1929,6 +1936,7 @@ namespace AZ
             m_uuidAnyCreationMap.emplace(SerializeTypeInfo<T>::GetUuid(), &AnyTypeInfoConcept<T>::CreateAny);
 
             AddClassData<T, TBaseClasses...>(&result.first->second);
+            UpdateReflectionVersion();
 
             return ClassBuilder(this, result.first);
         }
@@ -184,6 +184,7 @@ namespace AZ
                 // Store the underlying type as an attribute within the ClassData
                 enumClassData.m_attributes.emplace_back(Serialize::Attributes::EnumUnderlyingType, aznew AZ::AttributeContainerType<AZ::TypeId>(underlyingTypeId));
                 enumTypeIter = enumTypeInsertIter.first;
+                UpdateReflectionVersion();
                 return EnumBuilder(this, enumTypeIter);
             }
         }
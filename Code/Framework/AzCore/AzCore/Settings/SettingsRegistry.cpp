@@ -94,6 +94,80 @@ namespace AZ
         return index < m_names.size() ? m_names[index] : AZStd::string_view();
     }
 
+    SettingsRegistryInterface::KeyHandle::KeyHandle(AZStd::string_view path)
+    {
+        if (path.size() > m_path.max_size())
+        {
+            AZ_Error("Settings Registry", false, R"(Cannot create a key handle for "%.*s". It is longer than the maximum of %zu.)",
+                AZ_STRING_ARG(path), m_path.max_size());
+            return;
+        }
+        m_path = path;
+        m_isValid = true;
+    }
+
+    SettingsRegistryInterface::KeyHandle::KeyHandle(const KeyHandle& rhs)
+        : m_path(rhs.m_path)
+        , m_isValid(rhs.m_isValid)
+    {
+    }
+
+    auto SettingsRegistryInterface::KeyHandle::operator=(const KeyHandle& rhs) -> KeyHandle&
+    {
+        if (this != &rhs)
+        {
+            // The cached value belongs to the previous path
+            m_path = rhs.m_path;
+            m_isValid = rhs.m_isValid;
+            m_cachedVersion.store(0, AZStd::memory_order_relaxed);
+            m_cachedValue.store(nullptr, AZStd::memory_order_relaxed);
+        }
+        return *this;
+    }
+
+    AZStd::string_view SettingsRegistryInterface::KeyHandle::GetPath() const
+    {
+        return m_path;
+    }
+
+    bool SettingsRegistryInterface::KeyHandle::IsValid() const
+    {
+        return m_isValid;
+    }
+
+    bool SettingsRegistryInterface::KeyHandle::GetCachedValue(const void*& value, AZ::u64 version) const
+    {
+        // The version is read before and after the value, if it didn't change the value belongs to that version
+        const AZ::u64 cachedVersion = version << 1;
+        if (m_cachedVersion.load(AZStd::memory_order_acquire) != cachedVersion)
+        {
+            return false;
+        }
+        const void* cachedValue = m_cachedValue.load(AZStd::memory_order_relaxed);
+        AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+        if (m_cachedVersion.load(AZStd::memory_order_relaxed) != cachedVersion)
+        {
+            return false;
+        }
+        value = cachedValue;
+        return true;
+    }
+
+    void SettingsRegistryInterface::KeyHandle::SetCachedValue(const void* value, AZ::u64 version) const
+    {
+        AZ_Assert(version > 0, "Settings versions start at 1");
+        AZ::u64 cachedVersion = m_cachedVersion.load(AZStd::memory_order_relaxed);
+        if ((cachedVersion & 1) != 0 ||
+            !m_cachedVersion.compare_exchange_strong(cachedVersion, cachedVersion | 1, AZStd::memory_order_relaxed))
+        {
+            // Another thread is caching a value, the value will be resolved again on the next read if needed
+            return;
+        }
+        AZStd::atomic_thread_fence(AZStd::memory_order_release);
+        m_cachedValue.store(value, AZStd::memory_order_relaxed);
+        m_cachedVersion.store(version << 1, AZStd::memory_order_release);
+    }
+
     SettingsRegistryInterface::CommandLineArgumentSettings::CommandLineArgumentSettings()
     {
         m_delimiterFunc = [](AZStd::string_view line) -> JsonPathValue
@@ -16,6 +16,7 @@
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -47,6 +48,41 @@ namespace AZ
         //! AZStd::string overload must be used or the Visit method must be used
         using FixedValueString = AZ::StringFunc::Path::FixedString;
 
+        //! Path to a setting that is resolved once and then reused for as long as the Settings Registry doesn't change.
+        //! Prefer a KeyHandle over a path for settings that are read frequently, for instance every frame.
+        //! A KeyHandle can be shared between threads. A default constructed KeyHandle doesn't refer to any setting.
+        class KeyHandle
+        {
+        public:
+            KeyHandle() = default;
+            //! @param path The path to the setting, which can't be longer than FixedValueString::max_size().
+            explicit KeyHandle(AZStd::string_view path);
+            KeyHandle(const KeyHandle& rhs);
+            KeyHandle& operator=(const KeyHandle& rhs);
+
+            AZStd::string_view GetPath() const;
+            //! Returns true if the handle refers to a setting.
+            bool IsValid() const;
+
+            //! Retrieves the value cached for a version of the settings. Used by the implementations of the Settings Registry.
+            //! @param value The cached value, which is nullptr if the path didn't resolve to a value in that version.
+            //! @param version The version of the settings the value was resolved in.
+            //! @return True if a value was cached for the version, otherwise false.
+            bool GetCachedValue(const void*& value, AZ::u64 version) const;
+            //! Caches the value the path resolved to in a version of the settings. Used by the implementations of the Settings Registry.
+            //! Nothing is cached if another thread is caching a value at the same time.
+            //! @param value The value the path resolved to, or nullptr if it didn't resolve.
+            //! @param version The version of the settings the value was resolved in, this must be larger than 0.
+            void SetCachedValue(const void* value, AZ::u64 version) const;
+
+        private:
+            FixedValueString m_path;
+            bool m_isValid{ false };
+            //! Version of the cached value shifted left by one, the lowest bit is set while a value is being cached.
+            mutable AZStd::atomic<AZ::u64> m_cachedVersion{ 0 };
+            mutable AZStd::atomic<const void*> m_cachedValue{ nullptr };
+        };
+
         class Specializations
         {
         public:
@@ -259,6 +295,27 @@ namespace AZ
         template<typename T>
         bool GetObject(T& result, AZStd::string_view path) const { return GetObject(&result, azrtti_typeid(result), path); }
 
+        //! Gets the value at the path of the key handle. These behave the same as the path versions, but the path
+        //! is only resolved again after the Settings Registry has changed.
+        //! @param result The target to write the result to.
+        //! @param key The handle to the path of the value.
+        //! @return Whether or not the value was retrieved. An invalid path or type-mismatch will return false;
+        virtual bool Get(bool& result, const KeyHandle& key) const = 0;
+        virtual bool Get(s64& result, const KeyHandle& key) const = 0;
+        virtual bool Get(u64& result, const KeyHandle& key) const = 0;
+        virtual bool Get(double& result, const KeyHandle& key) const = 0;
+        virtual bool Get(AZStd::string& result, const KeyHandle& key) const = 0;
+        virtual bool Get(FixedValueString& result, const KeyHandle& key) const = 0;
+        //! Gets the object value at the path of the key handle serialized to the target struct/class.
+        //! Prefer to use GetObject(T& result, const KeyHandle& key) over this one.
+        //! @param result The target to write the result to.
+        //! @param resultTypeId The type id of the target that's being written to.
+        //! @param key The handle to the path of the value.
+        //! @return Whether or not the value was stored. An invalid path will return false;
+        virtual bool GetObject(void* result, Uuid resultTypeID, const KeyHandle& key) const = 0;
+        template<typename T>
+        bool GetObject(T& result, const KeyHandle& key) const { return GetObject(&result, azrtti_typeid(result), key); }
+
         //! Sets or replaces the boolean value at the provided path.
         //! @param path The path to the value.
         //! @param value The new value to store.
@@ -17,6 +17,7 @@
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/scoped_lock.h>
@@ -47,6 +48,14 @@ namespace AZ::SettingsRegistryImplInternal
 
         return Type::NoType;
     }
+
+    AZ::u64 NextSettingsVersion()
+    {
+        // Versions are unique across all the Settings Registries, so that a key handle used with several of them
+        // can't mistake a value cached for one registry for a value of another
+        static AZStd::atomic<AZ::u64> s_settingsVersion{ 0 };
+        return ++s_settingsVersion;
+    }
 }
 
 namespace AZ
@@ -93,6 +102,56 @@ namespace AZ
         return false;
     }
 
+    template<typename T>
+    bool SettingsRegistryImpl::ExtractValue(T& result, const rapidjson::Value* value)
+    {
+        if constexpr (AZStd::is_same_v<T, bool>)
+        {
+            if (value && value->IsBool())
+            {
+                result = value->GetBool();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, s64>)
+        {
+            if (value && value->IsInt64())
+            {
+                result = value->GetInt64();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, u64>)
+        {
+            if (value && value->IsUint64())
+            {
+                result = value->GetUint64();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, double>)
+        {
+            if (value && value->IsDouble())
+            {
+                result = value->GetDouble();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, AZStd::string> || AZStd::is_same_v<T, SettingsRegistryInterface::FixedValueString>)
+        {
+            if (value && value->IsString())
+            {
+                result.append(value->GetString(), value->GetStringLength());
+                return true;
+            }
+        }
+        else
+        {
+            static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::ExtractValue called with unsupported type.");
+        }
+        return false;
+    }
+
     template<typename T>
     bool SettingsRegistryImpl::GetValueInternal(T& result, AZStd::string_view path) const
     {
@@ -106,53 +165,174 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
-            const rapidjson::Value* value = pointer.Get(m_settings);
-            if constexpr (AZStd::is_same_v<T, bool>)
+            return ReadSettings([&result, &pointer](const rapidjson::Value& settings, [[maybe_unused]] u64 version,
+                [[maybe_unused]] const JsonDeserializerSettings& deserializationSettings)
             {
-                if (value && value->IsBool())
-                {
-                    result = value->GetBool();
-                    return true;
-                }
+                return ExtractValue(result, pointer.Get(settings));
+            });
+        }
+        return false;
+    }
+
+    template<typename T>
+    bool SettingsRegistryImpl::GetValueInternal(T& result, const KeyHandle& key) const
+    {
+        return ReadSettings([&result, &key](const rapidjson::Value& settings, u64 version,
+            [[maybe_unused]] const JsonDeserializerSettings& deserializationSettings)
+        {
+            return ExtractValue(result, ResolveKey(key, settings, version));
+        });
+    }
+
+    template<typename Reader>
+    bool SettingsRegistryImpl::ReadSettings(Reader&& reader) const
+    {
+        // Readers are counted in the slot of the snapshot they use, so that the snapshot isn't deleted or replaced under them
+        const u32 slotIndex = AcquireSnapshotSlot();
+        if (slotIndex != NoSnapshotSlot)
+        {
+            const Snapshot& snapshot = *m_snapshotSlots[slotIndex].m_snapshot;
+            const bool isUpToDate = snapshot.m_version == m_settingsVersion.load(AZStd::memory_order_acquire);
+            const bool result = isUpToDate &&
+                reader(static_cast<const rapidjson::Value&>(snapshot.m_settings), snapshot.m_version, snapshot.m_deserializationSettings);
+            ReleaseSnapshotSlot(slotIndex);
+            if (isUpToDate)
+            {
+                return result;
             }
-            else if constexpr (AZStd::is_same_v<T, s64>)
+        }
+
+        // The settings changed since the snapshot was published, read them under the lock and publish a new snapshot
+        // once enough reads happened. This avoids copying the settings after every change when they are changed in bulk.
+        AZStd::scoped_lock lock(m_settingMutex);
+        if (++m_lockedReadCount >= LockedReadsBeforePublish)
+        {
+            if (const Snapshot* snapshot = PublishSnapshot(); snapshot != nullptr)
             {
-                if (value && value->IsInt64())
-                {
-                    result = value->GetInt64();
-                    return true;
-                }
+                return reader(static_cast<const rapidjson::Value&>(snapshot->m_settings), snapshot->m_version,
+                    snapshot->m_deserializationSettings);
             }
-            else if constexpr (AZStd::is_same_v<T, u64>)
+        }
+        // Version 0 marks values that can't be cached, the settings can change as soon as the lock is released
+        return reader(static_cast<const rapidjson::Value&>(m_settings), 0, m_deserializationSettings);
+    }
+
+    const rapidjson::Value* SettingsRegistryImpl::ResolveKey(const KeyHandle& key, const rapidjson::Value& settings, u64 version)
+    {
+        if (const void* cachedValue = nullptr; version != 0 && key.GetCachedValue(cachedValue, version))
+        {
+            return static_cast<const rapidjson::Value*>(cachedValue);
+        }
+
+        const rapidjson::Value* value = nullptr;
+        if (key.IsValid())
+        {
+            AZStd::string_view path = key.GetPath();
+            rapidjson::Pointer pointer(path.data(), path.length());
+            value = pointer.IsValid() ? pointer.Get(settings) : nullptr;
+        }
+        if (version != 0)
+        {
+            key.SetCachedValue(value, version);
+        }
+        return value;
+    }
+
+    u32 SettingsRegistryImpl::AcquireSnapshotSlot() const
+    {
+        for (;;)
+        {
+            const u32 slotIndex = m_currentSnapshotSlot.load();
+            if (slotIndex == NoSnapshotSlot)
             {
-                if (value && value->IsUint64())
-                {
-                    result = value->GetUint64();
-                    return true;
-                }
+                return NoSnapshotSlot;
             }
-            else if constexpr (AZStd::is_same_v<T, double>)
+
+            m_snapshotSlots[slotIndex].m_readerCount.fetch_add(1);
+            // The snapshot may have been replaced before the reader was counted, in which case it may already be deleted
+            if (m_currentSnapshotSlot.load() == slotIndex)
             {
-                if (value && value->IsDouble())
-                {
-                    result = value->GetDouble();
-                    return true;
-                }
+                return slotIndex;
             }
-            else if constexpr (AZStd::is_same_v<T, AZStd::string> || AZStd::is_same_v<T, SettingsRegistryInterface::FixedValueString>)
+            ReleaseSnapshotSlot(slotIndex);
+        }
+    }
+
+    void SettingsRegistryImpl::ReleaseSnapshotSlot(u32 slotIndex) const
+    {
+        // If a writer holds the lock, the replaced snapshots are left to the next reader to leave or the next publish
+        if (m_snapshotSlots[slotIndex].m_readerCount.fetch_sub(1) == 1 && m_hasRetiredSnapshots.load() && m_settingMutex.try_lock())
+        {
+            DeleteRetiredSnapshots();
+            m_settingMutex.unlock();
+        }
+    }
+
+    auto SettingsRegistryImpl::PublishSnapshot() const -> const Snapshot*
+    {
+        const u64 version = m_settingsVersion.load(AZStd::memory_order_relaxed);
+        const u32 currentSlotIndex = m_currentSnapshotSlot.load();
+        if (currentSlotIndex != NoSnapshotSlot && m_snapshotSlots[currentSlotIndex].m_snapshot->m_version == version)
+        {
+            return m_snapshotSlots[currentSlotIndex].m_snapshot.get();
+        }
+
+        DeleteRetiredSnapshots();
+        auto emptySlot = AZStd::find_if(m_snapshotSlots.begin(), m_snapshotSlots.end(),
+            [](const SnapshotSlot& slot)
             {
-                if (value && value->IsString())
+                return slot.m_snapshot == nullptr;
+            });
+        if (emptySlot == m_snapshotSlots.end())
+        {
+            return nullptr;
+        }
+
+        // Readers that were counted in the empty slot in the meantime see that it isn't current and don't use it
+        emptySlot->m_snapshot.reset(aznew Snapshot);
+        emptySlot->m_snapshot->m_settings.CopyFrom(m_settings, emptySlot->m_snapshot->m_settings.GetAllocator());
+        emptySlot->m_snapshot->m_version = version;
+        emptySlot->m_snapshot->m_deserializationSettings = m_deserializationSettings;
+        m_currentSnapshotSlot.store(aznumeric_cast<u32>(emptySlot - m_snapshotSlots.begin()));
+        m_hasRetiredSnapshots.store(currentSlotIndex != NoSnapshotSlot);
+        m_lockedReadCount = 0;
+        return emptySlot->m_snapshot.get();
+    }
+
+    void SettingsRegistryImpl::DeleteRetiredSnapshots() const
+    {
+        // Readers that are counted in a slot from now on see that it isn't current and don't use its snapshot
+        const u32 currentSlotIndex = m_currentSnapshotSlot.load();
+        bool hasRetiredSnapshots = false;
+        for (u32 slotIndex = 0; slotIndex < SnapshotSlotCount; ++slotIndex)
+        {
+            SnapshotSlot& slot = m_snapshotSlots[slotIndex];
+            if (slotIndex != currentSlotIndex && slot.m_snapshot != nullptr)
+            {
+                if (slot.m_readerCount.load() == 0)
                 {
-                    result.append(value->GetString(), value->GetStringLength());
-                    return true;
+                    slot.m_snapshot.reset();
+                }
+                else
+                {
+                    hasRetiredSnapshots = true;
                 }
-            }
-            else
-            {
-                static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::GetValueInternal called with unsupported type.");
             }
         }
-        return false;
+        m_hasRetiredSnapshots.store(hasRetiredSnapshots);
+    }
+
+    SettingsRegistryImpl::ScopedWriteLock::ScopedWriteLock(SettingsRegistryImpl& registry)
+        : m_registry(registry)
+        , m_lock(registry.m_settingMutex)
+    {
+        // Readers of the published snapshot fall back to the locked settings from now on
+        m_registry.m_settingsVersion.store(SettingsRegistryImplInternal::NextSettingsVersion(), AZStd::memory_order_release);
+    }
+
+    SettingsRegistryImpl::ScopedWriteLock::~ScopedWriteLock()
+    {
+        m_registry.m_settingsVersion.store(SettingsRegistryImplInternal::NextSettingsVersion(), AZStd::memory_order_release);
     }
 
     SettingsRegistryImpl::SettingsRegistryImpl()
@@ -161,6 +341,7 @@ namespace AZ
 
         rapidjson::Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY);
         pointer.Create(m_settings, m_settings.GetAllocator()).SetArray();
+        m_settingsVersion = SettingsRegistryImplInternal::NextSettingsVersion();
     }
 
     SettingsRegistryImpl::SettingsRegistryImpl(bool useFileIo)
@@ -171,7 +352,8 @@ namespace AZ
 
     void SettingsRegistryImpl::SetContext(SerializeContext* context)
     {
-        AZStd::scoped_lock lock(m_settingMutex);
+        // The published snapshot keeps the contexts it was copied with, new snapshots pick up the changed ones
+        ScopedWriteLock lock(*this);
 
         m_serializationSettings.m_serializeContext = context;
         m_deserializationSettings.m_serializeContext = context;
@@ -179,7 +361,7 @@ namespace AZ
 
     void SettingsRegistryImpl::SetContext(JsonRegistrationContext* context)
     {
-        AZStd::scoped_lock lock(m_settingMutex);
+        ScopedWriteLock lock(*this);
 
         m_serializationSettings.m_registrationContext = context;
         m_deserializationSettings.m_registrationContext = context;
@@ -368,48 +550,48 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
-            AZStd::scoped_lock lock(m_settingMutex);
-            if (const rapidjson::Value* value = pointer.Get(m_settings); value != nullptr)
+            Type type = Type::NoType;
+            ReadSettings([&type, &pointer](const rapidjson::Value& settings, [[maybe_unused]] u64 version,
+                [[maybe_unused]] const JsonDeserializerSettings& deserializationSettings)
             {
-                return SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(*value);
-            }
+                if (const rapidjson::Value* value = pointer.Get(settings); value != nullptr)
+                {
+                    type = SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(*value);
+                }
+                return true;
+            });
+            return type;
         }
         return Type::NoType;
     }
 
     bool SettingsRegistryImpl::Get(bool& result, AZStd::string_view path) const
     {
-        AZStd::scoped_lock lock(m_settingMutex);
         return GetValueInternal(result, path);
     }
 
     bool SettingsRegistryImpl::Get(s64& result, AZStd::string_view path) const
     {
-        AZStd::scoped_lock lock(m_settingMutex);
         return GetValueInternal(result, path);
     }
 
     bool SettingsRegistryImpl::Get(u64& result, AZStd::string_view path) const
     {
-        AZStd::scoped_lock lock(m_settingMutex);
         return GetValueInternal(result, path);
     }
 
     bool SettingsRegistryImpl::Get(double& result, AZStd::string_view path) const
     {
-        AZStd::scoped_lock lock(m_settingMutex);
         return GetValueInternal(result, path);
     }
 
     bool SettingsRegistryImpl::Get(AZStd::string& result, AZStd::string_view path) const
     {
-        AZStd::scoped_lock lock(m_settingMutex);
         return GetValueInternal(result, path);
     }
 
     bool SettingsRegistryImpl::Get(FixedValueString& result, AZStd::string_view path) const
     {
-        AZStd::scoped_lock lock(m_settingMutex);
         return GetValueInternal(result, path);
     }
 
@@ -426,20 +608,68 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
-            AZStd::scoped_lock lock(m_settingMutex);
-            const rapidjson::Value* value = pointer.Get(m_settings);
-            if (value)
+            return ReadSettings([result, &resultTypeID, &pointer](const rapidjson::Value& settings, [[maybe_unused]] u64 version,
+                const JsonDeserializerSettings& deserializationSettings)
             {
-                JsonSerializationResult::ResultCode jsonResult = JsonSerialization::Load(result, resultTypeID, *value, m_deserializationSettings);
-                return jsonResult.GetProcessing() != JsonSerializationResult::Processing::Halted;
-            }
+                return LoadObject(result, resultTypeID, pointer.Get(settings), deserializationSettings);
+            });
+        }
+        return false;
+    }
+
+    bool SettingsRegistryImpl::Get(bool& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(s64& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(u64& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(double& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(AZStd::string& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(FixedValueString& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::GetObject(void* result, Uuid resultTypeID, const KeyHandle& key) const
+    {
+        return ReadSettings([result, &resultTypeID, &key](const rapidjson::Value& settings, u64 version,
+            const JsonDeserializerSettings& deserializationSettings)
+        {
+            return LoadObject(result, resultTypeID, ResolveKey(key, settings, version), deserializationSettings);
+        });
+    }
+
+    bool SettingsRegistryImpl::LoadObject(void* result, const Uuid& resultTypeID, const rapidjson::Value* value,
+        const JsonDeserializerSettings& deserializationSettings)
+    {
+        if (value)
+        {
+            JsonSerializationResult::ResultCode jsonResult = JsonSerialization::Load(result, resultTypeID, *value, deserializationSettings);
+            return jsonResult.GetProcessing() != JsonSerializationResult::Processing::Halted;
         }
         return false;
     }
 
     bool SettingsRegistryImpl::Set(AZStd::string_view path, bool value)
     {
-        if (AZStd::scoped_lock lock(m_settingMutex); !SetValueInternal(path, value))
+        if (ScopedWriteLock lock(*this); !SetValueInternal(path, value))
         {
             return false;
         }
@@ -449,7 +679,7 @@ namespace AZ
 
     bool SettingsRegistryImpl::Set(AZStd::string_view path, s64 value)
     {
-        if (AZStd::scoped_lock lock(m_settingMutex); !SetValueInternal(path, value))
+        if (ScopedWriteLock lock(*this); !SetValueInternal(path, value))
         {
             return false;
         }
@@ -459,7 +689,7 @@ namespace AZ
 
     bool SettingsRegistryImpl::Set(AZStd::string_view path, u64 value)
     {
-        if (AZStd::scoped_lock lock(m_settingMutex); !SetValueInternal(path, value))
+        if (ScopedWriteLock lock(*this); !SetValueInternal(path, value))
         {
             return false;
         }
@@ -469,7 +699,7 @@ namespace AZ
 
     bool SettingsRegistryImpl::Set(AZStd::string_view path, double value)
     {
-        if (AZStd::scoped_lock lock(m_settingMutex); !SetValueInternal(path, value))
+        if (ScopedWriteLock lock(*this); !SetValueInternal(path, value))
         {
             return false;
         }
@@ -479,7 +709,7 @@ namespace AZ
 
     bool SettingsRegistryImpl::Set(AZStd::string_view path, AZStd::string_view value)
     {
-        if (AZStd::scoped_lock lock(m_settingMutex); !SetValueInternal(path, value))
+        if (ScopedWriteLock lock(*this); !SetValueInternal(path, value))
         {
             return false;
         }
@@ -512,7 +742,7 @@ namespace AZ
             {
                 auto anchorType = Type::NoType;
                 {
-                    AZStd::scoped_lock lock(m_settingMutex);
+                    ScopedWriteLock lock(*this);
                     rapidjson::Value& setting = pointer.Create(m_settings, m_settings.GetAllocator());
                     setting = AZStd::move(store);
                     anchorType = SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(setting);
@@ -539,7 +769,7 @@ namespace AZ
             return false;
         }
 
-        AZStd::scoped_lock lock(m_settingMutex);
+        ScopedWriteLock lock(*this);
         return pointerPath.Erase(m_settings);
     }
 
@@ -667,7 +897,7 @@ namespace AZ
             {
                 rapidjson::Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
                 AZ_Error("Settings Registry", false, R"(Anchor path "%.*s" is invalid.)", AZ_STRING_ARG(anchorKey));
-                AZStd::scoped_lock lock(m_settingMutex);
+                ScopedWriteLock lock(*this);
                 pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                     .AddMember(rapidjson::StringRef("Error"), rapidjson::StringRef("Invalid anchor key."), m_settings.GetAllocator())
                     .AddMember(rapidjson::StringRef("Path"),
@@ -679,7 +909,7 @@ namespace AZ
 
         auto anchorType = AZ::SettingsRegistryInterface::Type::NoType;
         {
-            AZStd::scoped_lock lock(m_settingMutex);
+            ScopedWriteLock lock(*this);
             rapidjson::Value& anchorRoot = anchorPath.IsValid() ? anchorPath.Create(m_settings, m_settings.GetAllocator())
                 : m_settings;
 
@@ -731,7 +961,7 @@ namespace AZ
                     static_cast<int>(path.length()), path.data());
                 Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
 
-                AZStd::scoped_lock lock(m_settingMutex);
+                ScopedWriteLock lock(*this);
                 Value pathValue(path.data(), aznumeric_caster(path.length()), m_settings.GetAllocator());
                 pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                     .AddMember(StringRef("Error"), StringRef("Unable to read registry file."), m_settings.GetAllocator())
@@ -777,7 +1007,7 @@ namespace AZ
         {
             AZ_Error("Settings Registry", false, "Folder path for the Setting Registry is too long: %.*s",
                 static_cast<int>(path.size()), path.data());
-            AZStd::scoped_lock lock(m_settingMutex);
+            ScopedWriteLock lock(*this);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Folder path for the Setting Registry is too long."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path.data(), aznumeric_caster(path.length()), m_settings.GetAllocator()), m_settings.GetAllocator());
@@ -792,16 +1022,19 @@ namespace AZ
         const size_t platformKeyOffset = folderPath.Native().size();
         folderPath /= '*';
 
-        Value specialzationArray(kArrayType);
-        size_t specializationCount = specializations.GetCount();
-        for (size_t i = 0; i < specializationCount; ++i)
         {
-            AZStd::string_view name = specializations.GetSpecialization(i);
-            specialzationArray.PushBack(Value(name.data(), aznumeric_caster(name.length()), m_settings.GetAllocator()), m_settings.GetAllocator());
+            ScopedWriteLock lock(*this);
+            Value specialzationArray(kArrayType);
+            size_t specializationCount = specializations.GetCount();
+            for (size_t i = 0; i < specializationCount; ++i)
+            {
+                AZStd::string_view name = specializations.GetSpecialization(i);
+                specialzationArray.PushBack(Value(name.data(), aznumeric_caster(name.length()), m_settings.GetAllocator()), m_settings.GetAllocator());
+            }
+            pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
+                .AddMember(StringRef("Folder"), Value(folderPath.c_str(), aznumeric_caster(folderPath.Native().size()), m_settings.GetAllocator()), m_settings.GetAllocator())
+                .AddMember(StringRef("Specializations"), AZStd::move(specialzationArray), m_settings.GetAllocator());
         }
-        pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
-            .AddMember(StringRef("Folder"), Value(folderPath.c_str(), aznumeric_caster(folderPath.Native().size()), m_settings.GetAllocator()), m_settings.GetAllocator())
-            .AddMember(StringRef("Specializations"), AZStd::move(specialzationArray), m_settings.GetAllocator());
 
 
         auto CreateSettingsFindCallback = [this, &fileList, &specializations, &pointer, &folderPath](bool isPlatformFile)
@@ -813,7 +1046,7 @@ namespace AZ
                     if (fileList.size() >= MaxRegistryFolderEntries)
                     {
                         AZ_Error("Settings Registry", false, "Too many files in registry folder.");
-                        AZStd::scoped_lock lock(m_settingMutex);
+                        ScopedWriteLock lock(*this);
                         pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                             .AddMember(StringRef("Error"), StringRef("Too many files in registry folder."), m_settings.GetAllocator())
                             .AddMember(StringRef("Path"), Value(folderPath.c_str(), aznumeric_caster(folderPath.Native().size()), m_settings.GetAllocator()), m_settings.GetAllocator())
@@ -1075,7 +1308,7 @@ namespace AZ
         AZ_Error("Settings Registry", false, R"(Two registry files in "%.*s" point to the same specialization: "%s" and "%s")",
             AZ_STRING_ARG(folderPath), lhs.m_relativePath.c_str(), rhs.m_relativePath.c_str());
 
-        AZStd::scoped_lock lock(m_settingMutex);
+        ScopedWriteLock lock(*this);
         historyPointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
             .AddMember(StringRef("Error"), StringRef("Too many files in registry folder."), m_settings.GetAllocator())
             .AddMember(StringRef("Path"),
@@ -1183,6 +1416,7 @@ namespace AZ
         if (!fileReader.IsOpen())
         {
             AZ_Error("Settings Registry", false, R"(Unable to open registry file "%s".)", path);
+            ScopedWriteLock lock(*this);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to open registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
@@ -1193,6 +1427,7 @@ namespace AZ
         if (fileSize == 0)
         {
             AZ_Warning("Settings Registry", false, R"(Registry file "%s" is 0 bytes in length. There is no nothing to merge)", path);
+            ScopedWriteLock lock(*this);
             pointer.Create(m_settings, m_settings.GetAllocator())
                 .SetObject()
                 .AddMember(StringRef("Error"), StringRef("registry file is 0 bytes."), m_settings.GetAllocator())
@@ -1205,6 +1440,7 @@ namespace AZ
         if (fileReader.Read(fileSize, scratchBuffer.data()) != fileSize)
         {
             AZ_Error("Settings Registry", false, R"(Unable to read registry file "%s".)", path);
+            ScopedWriteLock lock(*this);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to read registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
@@ -1236,7 +1472,7 @@ namespace AZ
                 }
             }
             
-            AZStd::scoped_lock lock(m_settingMutex);
+            ScopedWriteLock lock(*this);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to parse registry file due to invalid json."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator())
@@ -1262,7 +1498,7 @@ namespace AZ
                     R"(To merge the supplied settings registry file, the settings within it must be placed within a JSON Object '{}')"
                     R"( in order to allow moving of its fields using the root-key as an anchor.)", path);
 
-                AZStd::scoped_lock lock(m_settingMutex);
+                ScopedWriteLock lock(*this);
                 pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                     .AddMember(StringRef("Error"), StringRef("Cannot merge registry file with a root which is not a JSON Object,"
                         " an empty root key and a merge approach of JsonMergePatch. Otherwise the Settings Registry would be overridden."
@@ -1282,7 +1518,7 @@ namespace AZ
         auto anchorType = Type::NoType;
         if (rootKey.empty())
         {
-            AZStd::scoped_lock lock(m_settingMutex);
+            ScopedWriteLock lock(*this);
             mergeResult = JsonSerialization::ApplyPatch(m_settings, m_settings.GetAllocator(), jsonPatch, mergeApproach, m_applyPatchSettings);
             anchorType = SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(m_settings);
         }
@@ -1291,7 +1527,7 @@ namespace AZ
             Pointer root(rootKey.data(), rootKey.length());
             if (root.IsValid())
             {
-                AZStd::scoped_lock lock(m_settingMutex);
+                ScopedWriteLock lock(*this);
                 Value& rootValue = root.Create(m_settings, m_settings.GetAllocator());
                 mergeResult = JsonSerialization::ApplyPatch(rootValue, m_settings.GetAllocator(), jsonPatch, mergeApproach, m_applyPatchSettings);
                 anchorType = SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(rootValue);
@@ -1300,7 +1536,7 @@ namespace AZ
             {
                 AZ_Error("Settings Registry", false, R"(Failed to root path "%.*s" is invalid.)",
                     aznumeric_cast<int>(rootKey.length()), rootKey.data());
-                AZStd::scoped_lock lock(m_settingMutex);
+                ScopedWriteLock lock(*this);
                 pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                     .AddMember(StringRef("Error"), StringRef("Invalid root key."), m_settings.GetAllocator())
                     .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
@@ -1310,7 +1546,7 @@ namespace AZ
         if (mergeResult.GetProcessing() != JsonSerializationResult::Processing::Completed)
         {
             AZ_Error("Settings Registry", false, R"(Failed to fully merge registry file "%s".)", path);
-            AZStd::scoped_lock lock(m_settingMutex);
+            ScopedWriteLock lock(*this);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Failed to fully merge registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
@@ -1318,7 +1554,7 @@ namespace AZ
         }
 
         {
-            AZStd::scoped_lock lock(m_settingMutex);
+            ScopedWriteLock lock(*this);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetString(path, m_settings.GetAllocator());
         }
 
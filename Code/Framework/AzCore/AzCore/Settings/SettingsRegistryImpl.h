@@ -14,9 +14,13 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 // Using a define instead of a static string to avoid the need for temporary buffers to composite the full paths.
 #define AZ_SETTINGS_REGISTRY_HISTORY_KEY "/Amazon/AzCore/Runtime/Registry/FileHistory"
@@ -65,6 +69,13 @@ namespace AZ
         bool Get(AZStd::string& result, AZStd::string_view path) const override;
         bool Get(SettingsRegistryInterface::FixedValueString& result, AZStd::string_view path) const override;
         bool GetObject(void* result, Uuid resultTypeID, AZStd::string_view path) const override;
+        bool Get(bool& result, const KeyHandle& key) const override;
+        bool Get(s64& result, const KeyHandle& key) const override;
+        bool Get(u64& result, const KeyHandle& key) const override;
+        bool Get(double& result, const KeyHandle& key) const override;
+        bool Get(AZStd::string& result, const KeyHandle& key) const override;
+        bool Get(FixedValueString& result, const KeyHandle& key) const override;
+        bool GetObject(void* result, Uuid resultTypeID, const KeyHandle& key) const override;
 
         bool Set(AZStd::string_view path, bool value) override;
         bool Set(AZStd::string_view path, s64 value) override;
@@ -102,8 +113,74 @@ namespace AZ
 
         template<typename T>
         bool SetValueInternal(AZStd::string_view path, T value);
+        //! Immutable copy of the settings that is read without locking.
+        struct Snapshot
+        {
+            AZ_CLASS_ALLOCATOR(Snapshot, AZ::OSAllocator, 0);
+
+            rapidjson::Document m_settings;
+            u64 m_version{};
+            //! The contexts objects are loaded with, which can only change with the settings locked.
+            JsonDeserializerSettings m_deserializationSettings;
+        };
+
+        //! Holds a published snapshot and counts the readers that use it. Slots are never deallocated, so a reader can count
+        //! itself in a slot before checking that the slot is still the current one. A replaced snapshot is deleted as soon as
+        //! its slot has no readers left, and a slot is only reused for a new snapshot once it's empty.
+        struct SnapshotSlot
+        {
+            AZStd::unique_ptr<Snapshot> m_snapshot;
+            AZStd::atomic<u32> m_readerCount{ 0 };
+        };
+        static constexpr u32 SnapshotSlotCount = 4;
+        static constexpr u32 NoSnapshotSlot = SnapshotSlotCount;
+
+        //! Locks the settings to change them and gives them a new version, which makes the published snapshot out of date.
+        //! The version changes again when the lock is released, in case a snapshot was published in the middle of the change.
+        class ScopedWriteLock
+        {
+        public:
+            explicit ScopedWriteLock(SettingsRegistryImpl& registry);
+            ~ScopedWriteLock();
+
+        private:
+            SettingsRegistryImpl& m_registry;
+            AZStd::scoped_lock<AZStd::recursive_mutex> m_lock;
+        };
+
+        //! Number of reads that have to fall back to the lock after the settings changed before a new snapshot is published.
+        //! Publishing deep copies all the settings, which costs about as much as a merge, so a snapshot is published at most once
+        //! per settings version. Changes made in bulk, like the merges during startup, are copied once when the reads start
+        //! instead of after every change. Settings that keep changing while they're read cost a copy every this many reads, and
+        //! no copy at all while the readers of the replaced snapshots occupy all the slots.
+        static constexpr u32 LockedReadsBeforePublish = 16;
+
+        template<typename T>
+        static bool ExtractValue(T& result, const rapidjson::Value* value);
         template<typename T>
         bool GetValueInternal(T& result, AZStd::string_view path) const;
+        template<typename T>
+        bool GetValueInternal(T& result, const KeyHandle& key) const;
+        static bool LoadObject(void* result, const Uuid& resultTypeID, const rapidjson::Value* value,
+            const JsonDeserializerSettings& deserializationSettings);
+        //! Calls the reader with the latest settings, taken from the published snapshot if it's up to date and otherwise
+        //! read under the lock. The reader is a function of the form
+        //! bool(const rapidjson::Value& settings, u64 version, const JsonDeserializerSettings& deserializationSettings),
+        //! where the version is 0 if the settings aren't from a snapshot and the deserialization settings are the ones that
+        //! go with the settings.
+        template<typename Reader>
+        bool ReadSettings(Reader&& reader) const;
+        //! Resolves the key in the settings, using the value cached in the key if it belongs to the version.
+        static const rapidjson::Value* ResolveKey(const KeyHandle& key, const rapidjson::Value& settings, u64 version);
+        //! Counts the reader in the slot of the current snapshot and returns the slot, or NoSnapshotSlot if nothing was published.
+        u32 AcquireSnapshotSlot() const;
+        //! Stops counting the reader in the slot. The last reader to leave deletes the replaced snapshots if the lock is free.
+        void ReleaseSnapshotSlot(u32 slotIndex) const;
+        //! Publishes a copy of the settings for the readers and returns it, must be called with the settings locked.
+        //! Returns nullptr if all the slots are still used by readers of replaced snapshots.
+        const Snapshot* PublishSnapshot() const;
+        //! Deletes the replaced snapshots that have no readers left, must be called with the settings locked.
+        void DeleteRetiredSnapshots() const;
         VisitResponse Visit(Visitor& visitor, StackedString& path, AZStd::string_view valueName,
             const rapidjson::Value& value) const;
 
@@ -135,6 +212,13 @@ namespace AZ
         AZStd::atomic_int m_signalCount{};
 
         rapidjson::Document m_settings;
+        //! Version of m_settings, which changes every time the settings are locked for writing.
+        AZStd::atomic<u64> m_settingsVersion{ 0 };
+        //! Snapshots of the settings published RCU style. Replaced snapshots are retired until no reader is using them.
+        mutable AZStd::array<SnapshotSlot, SnapshotSlotCount> m_snapshotSlots;
+        mutable AZStd::atomic<u32> m_currentSnapshotSlot{ NoSnapshotSlot };
+        mutable AZStd::atomic<bool> m_hasRetiredSnapshots{ false };
+        mutable u32 m_lockedReadCount{ 0 };
         JsonSerializerSettings m_serializationSettings;
         JsonDeserializerSettings m_deserializationSettings;
         JsonApplyPatchSettings m_applyPatchSettings;
@@ -6,16 +6,22 @@
  *
  */
 
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/FileReader.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/TextStreamWriters.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/JSON/pointer.h>
 #include <AzCore/JSON/prettywriter.h>
+#include <AzCore/JSON/stringbuffer.h>
 #include <AzCore/JSON/writer.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Platform.h>
 #include <AzCore/PlatformId/PlatformDefaults.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
@@ -249,6 +255,286 @@ namespace AZ::Internal
         commandLine.Parse(paramContainer);
         AZ::SettingsRegistryMergeUtils::StoreCommandLineToRegistry(settingsRegistry, commandLine);
     }
+
+    // A merged snapshot is a small binary file, its integers are stored in the byte order of the machine that wrote it
+    // as it only lives in the project cache of that machine.
+    //   u32 magic, u32 version
+    //   string key, made of the platform and the specializations the snapshot was merged with
+    //   u64 hash of the registry before the merge, as the changes the folders make depend on the settings they're merged into
+    //   u32 folder count, then for each registry folder: string path, u64 fingerprint of the folder content
+    //   u32 crc of the payload, string payload which holds the changes the registry folders made as a JSON Merge Patch
+    // Strings are stored as a u32 size followed by the characters.
+    static constexpr AZ::u32 MergedSnapshotMagic = 0x50414E53; // "SNAP"
+    static constexpr AZ::u32 MergedSnapshotVersion = 2;
+
+    struct MergedSnapshotFolder
+    {
+        AZ::IO::Path m_path;
+        AZ::u64 m_fingerprint{};
+    };
+    using MergedSnapshotFolders = AZStd::vector<MergedSnapshotFolder>;
+
+    //! Reads the values of a merged snapshot, the reads fail once the end of the data is reached.
+    class MergedSnapshotReader
+    {
+    public:
+        explicit MergedSnapshotReader(AZStd::string_view data)
+            : m_data(data)
+        {
+        }
+
+        template<typename T>
+        bool Read(T& value)
+        {
+            if (m_data.size() < sizeof(T))
+            {
+                return false;
+            }
+            memcpy(&value, m_data.data(), sizeof(T));
+            m_data.remove_prefix(sizeof(T));
+            return true;
+        }
+
+        bool ReadString(AZStd::string_view& value)
+        {
+            AZ::u32 size = 0;
+            if (!Read(size) || m_data.size() < size)
+            {
+                return false;
+            }
+            value = m_data.substr(0, size);
+            m_data.remove_prefix(size);
+            return true;
+        }
+
+    private:
+        AZStd::string_view m_data;
+    };
+
+    static void AppendMergedSnapshotValue(AZStd::vector<char>& buffer, const void* value, size_t size)
+    {
+        const char* bytes = static_cast<const char*>(value);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    static void AppendMergedSnapshotString(AZStd::vector<char>& buffer, AZStd::string_view value)
+    {
+        const AZ::u32 size = aznumeric_cast<AZ::u32>(value.size());
+        AppendMergedSnapshotValue(buffer, &size, sizeof(size));
+        AppendMergedSnapshotValue(buffer, value.data(), value.size());
+    }
+
+    static AZStd::string GetMergedSnapshotKey(AZStd::string_view platform, const AZ::SettingsRegistryInterface::Specializations& specializations)
+    {
+        AZStd::string key(platform);
+        for (size_t i = 0; i < specializations.GetCount(); ++i)
+        {
+            key += '|';
+            key += specializations.GetSpecialization(i);
+        }
+        return key;
+    }
+
+    //! Hashes the names, sizes and modification times of the files in a registry folder and its platform folder,
+    //! which are the files MergeSettingsFolder looks at. This only lists the folders, no file is opened or parsed.
+    static AZ::u64 GetRegistryFolderFingerprint(const AZ::IO::Path& folderPath, AZStd::string_view platform)
+    {
+        AZ::u64 fingerprint = 0;
+        auto HashFiles = [&fingerprint](const AZ::IO::FixedMaxPath& searchFolder)
+        {
+            AZ::IO::SystemFile::FindFiles((searchFolder / "*").c_str(), [&fingerprint, &searchFolder](const char* filename, bool isFile)
+            {
+                if (isFile)
+                {
+                    const AZ::IO::FixedMaxPath filePath = searchFolder / filename;
+                    size_t fileHash = AZStd::hash<AZStd::string_view>{}(filename);
+                    AZStd::hash_combine(fileHash, AZ::IO::SystemFile::ModificationTime(filePath.c_str()),
+                        AZ::IO::SystemFile::Length(filePath.c_str()));
+                    // Files aren't found in any particular order, summing their hashes makes the fingerprint independent of it
+                    fingerprint += fileHash;
+                }
+                return true;
+            });
+        };
+
+        AZ::IO::FixedMaxPath searchFolder(folderPath);
+        HashFiles(searchFolder);
+        if (!platform.empty())
+        {
+            searchFolder /= AZ::SettingsRegistryInterface::PlatformFolder;
+            searchFolder /= platform;
+            HashFiles(searchFolder);
+        }
+        return fingerprint;
+    }
+
+    //! Gathers the registry folders of the engine, the active gems and the project, in the order they are merged.
+    static MergedSnapshotFolders GetMergedSnapshotFolders(AZ::SettingsRegistryInterface& registry, AZStd::string_view platform)
+    {
+        MergedSnapshotFolders folders;
+        auto AddFolder = [&folders, platform](AZ::IO::Path folderPath)
+        {
+            folderPath /= AZ::SettingsRegistryInterface::RegistryFolder;
+            const AZ::u64 fingerprint = GetRegistryFolderFingerprint(folderPath, platform);
+            folders.push_back({ AZStd::move(folderPath), fingerprint });
+        };
+
+        if (AZ::IO::Path engineRootPath; registry.Get(engineRootPath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_EngineRootFolder))
+        {
+            AddFolder(AZStd::move(engineRootPath));
+        }
+        AZ::SettingsRegistryMergeUtils::VisitActiveGems(registry, [&AddFolder](AZStd::string_view, AZStd::string_view gemPath)
+        {
+            AddFolder(AZ::IO::Path(gemPath));
+        });
+        if (AZ::IO::Path projectPath; registry.Get(projectPath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectPath))
+        {
+            AddFolder(AZStd::move(projectPath));
+        }
+        return folders;
+    }
+
+    //! Dumps the whole registry to JSON, leaving out the keys which belong to the process, like the merge history and the command
+    //! line. The registry folders don't read those, and keeping them would give every process a different snapshot key, for
+    //! instance the asset builders which are each launched with an id of their own.
+    static bool DumpRegistryForMergedSnapshot(AZ::SettingsRegistryInterface& registry, AZStd::string& json)
+    {
+        AZ::IO::ByteContainerStream<AZStd::string> stream(&json);
+        AZ::SettingsRegistryMergeUtils::DumperSettings dumperSettings;
+        dumperSettings.m_includeFilter = [](AZStd::string_view path)
+        {
+            constexpr AZStd::string_view processKeys[] = {
+                AZ_SETTINGS_REGISTRY_HISTORY_KEY,
+                AZ::SettingsRegistryMergeUtils::CommandLineRootKey,
+                AZ::SettingsRegistryMergeUtils::CommandLineValueChangedKey
+            };
+            for (AZStd::string_view processKey : processKeys)
+            {
+                if (path.starts_with(processKey) && (path.size() == processKey.size() || path[processKey.size()] == '/'))
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+        return AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(registry, "", stream, dumperSettings);
+    }
+
+    static AZ::u64 GetMergedSnapshotSettingsHash(AZStd::string_view settings)
+    {
+        return AZStd::hash<AZStd::string_view>{}(settings);
+    }
+
+    //! Merges the snapshot if it was made for the same platform, specializations and registry content, and if none of the
+    //! registry folders changed since.
+    static bool MergeMergedSnapshot(AZ::SettingsRegistryInterface& registry, AZStd::string_view snapshotPath, AZStd::string_view platform,
+        const AZ::SettingsRegistryInterface::Specializations& specializations, AZ::u64 settingsHash)
+    {
+        const AZ::IO::FixedMaxPath filePath(snapshotPath);
+        AZStd::string snapshot;
+        {
+            AZ::IO::SystemFile file;
+            if (!file.Open(filePath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+            {
+                return false;
+            }
+            snapshot.resize_no_construct(file.Length());
+            if (file.Read(snapshot.size(), snapshot.data()) != snapshot.size())
+            {
+                return false;
+            }
+        }
+
+        MergedSnapshotReader reader(snapshot);
+        AZ::u32 magic{};
+        AZ::u32 version{};
+        AZStd::string_view key;
+        AZ::u64 snapshotSettingsHash{};
+        AZ::u32 folderCount{};
+        if (!reader.Read(magic) || magic != MergedSnapshotMagic
+            || !reader.Read(version) || version != MergedSnapshotVersion
+            || !reader.ReadString(key) || key != GetMergedSnapshotKey(platform, specializations)
+            || !reader.Read(snapshotSettingsHash) || snapshotSettingsHash != settingsHash
+            || !reader.Read(folderCount))
+        {
+            return false;
+        }
+
+        // The snapshot is stale if the active gems changed or if a file was added, removed or modified in any registry folder
+        const MergedSnapshotFolders folders = GetMergedSnapshotFolders(registry, platform);
+        if (folderCount != folders.size())
+        {
+            return false;
+        }
+        for (const MergedSnapshotFolder& folder : folders)
+        {
+            AZStd::string_view folderPath;
+            AZ::u64 fingerprint{};
+            if (!reader.ReadString(folderPath) || !reader.Read(fingerprint)
+                || folderPath != folder.m_path.Native() || fingerprint != folder.m_fingerprint)
+            {
+                return false;
+            }
+        }
+
+        AZ::u32 payloadCrc{};
+        AZStd::string_view payload;
+        if (!reader.Read(payloadCrc) || !reader.ReadString(payload)
+            || payloadCrc != static_cast<AZ::u32>(AZ::Crc32(payload.data(), payload.size())))
+        {
+            AZ_Warning("SettingsRegistryMergeUtils", false, R"(Merged snapshot "%s" is corrupted, the registry folders are merged instead.)",
+                filePath.c_str());
+            return false;
+        }
+
+        return registry.MergeSettings(payload, AZ::SettingsRegistryInterface::Format::JsonMergePatch);
+    }
+
+    //! Writes the snapshot to a file of its own then moves it in place, as several processes can miss the snapshot at once.
+    static bool WriteMergedSnapshot(AZStd::string_view snapshotPath, AZStd::string_view key, AZ::u64 settingsHash,
+        const MergedSnapshotFolders& folders, AZStd::string_view payload)
+    {
+        AZStd::vector<char> buffer;
+        AppendMergedSnapshotValue(buffer, &MergedSnapshotMagic, sizeof(MergedSnapshotMagic));
+        AppendMergedSnapshotValue(buffer, &MergedSnapshotVersion, sizeof(MergedSnapshotVersion));
+        AppendMergedSnapshotString(buffer, key);
+        AppendMergedSnapshotValue(buffer, &settingsHash, sizeof(settingsHash));
+        const AZ::u32 folderCount = aznumeric_cast<AZ::u32>(folders.size());
+        AppendMergedSnapshotValue(buffer, &folderCount, sizeof(folderCount));
+        for (const MergedSnapshotFolder& folder : folders)
+        {
+            AppendMergedSnapshotString(buffer, folder.m_path.Native());
+            AppendMergedSnapshotValue(buffer, &folder.m_fingerprint, sizeof(folder.m_fingerprint));
+        }
+        const AZ::u32 payloadCrc = AZ::Crc32(payload.data(), payload.size());
+        AppendMergedSnapshotValue(buffer, &payloadCrc, sizeof(payloadCrc));
+        AppendMergedSnapshotString(buffer, payload);
+
+        const AZ::IO::FixedMaxPath filePath(snapshotPath);
+        AZ::IO::FixedMaxPath tempFilePath(filePath);
+        tempFilePath.Native() += AZ::IO::FixedMaxPathString::format(".%u.tmp", AZ::Platform::GetCurrentProcessId());
+        {
+            AZ::IO::SystemFile file;
+            if (!file.Open(tempFilePath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH
+                | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                return false;
+            }
+            if (file.Write(buffer.data(), buffer.size()) != buffer.size())
+            {
+                file.Close();
+                AZ::IO::SystemFile::Delete(tempFilePath.c_str());
+                return false;
+            }
+        }
+
+        if (!AZ::IO::SystemFile::Rename(tempFilePath.c_str(), filePath.c_str(), true))
+        {
+            AZ::IO::SystemFile::Delete(tempFilePath.c_str());
+            return false;
+        }
+        return true;
+    }
 } // namespace AZ::Internal
 
 namespace AZ::SettingsRegistryMergeUtils
@@ -1014,6 +1300,84 @@ namespace AZ::SettingsRegistryMergeUtils
         }
     }
 
+    AZ::IO::FixedMaxPath GetMergedSnapshotPath(SettingsRegistryInterface& registry, const AZStd::string_view platform,
+        const SettingsRegistryInterface::Specializations& specializations)
+    {
+        AZ::IO::FixedMaxPath snapshotPath;
+        if (!registry.Get(snapshotPath.Native(), FilePathKey_CacheProjectRootFolder))
+        {
+            return {};
+        }
+
+        // The file name only needs to tell the platform and specializations apart, the snapshot stores the full key
+        const uint64_t keyHash = AZStd::hash<AZStd::string>{}(AZ::Internal::GetMergedSnapshotKey(platform, specializations));
+        snapshotPath /= "SettingsRegistry";
+        snapshotPath /= AZ::IO::FixedMaxPathString::format("%.*s.%016" PRIx64 "%.*s", AZ_STRING_ARG(platform), keyHash,
+            AZ_STRING_ARG(MergedSnapshotExtension));
+        return snapshotPath;
+    }
+
+    bool MergeSettingsToRegistry_MergedSnapshot(SettingsRegistryInterface& registry, AZStd::string_view snapshotPath,
+        const AZStd::string_view platform, const SettingsRegistryInterface::Specializations& specializations)
+    {
+        AZStd::string settings;
+        return AZ::Internal::DumpRegistryForMergedSnapshot(registry, settings)
+            && AZ::Internal::MergeMergedSnapshot(registry, snapshotPath, platform, specializations,
+                AZ::Internal::GetMergedSnapshotSettingsHash(settings));
+    }
+
+    bool MergeSettingsToRegistry_EngineGemProjectRegistries(SettingsRegistryInterface& registry, const AZStd::string_view platform,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::string_view snapshotPath,
+        AZStd::vector<char>* scratchBuffer)
+    {
+        // The changes the registry folders make depend on the settings they're merged into, for instance a .setreg file setting
+        // a value that is already set changes nothing. So a snapshot only applies to the same settings as the one that wrote it.
+        AZStd::string settingsBefore;
+        const bool useSnapshot = !snapshotPath.empty() && AZ::Internal::DumpRegistryForMergedSnapshot(registry, settingsBefore);
+        const AZ::u64 settingsHash = useSnapshot ? AZ::Internal::GetMergedSnapshotSettingsHash(settingsBefore) : 0;
+        if (useSnapshot && AZ::Internal::MergeMergedSnapshot(registry, snapshotPath, platform, specializations, settingsHash))
+        {
+            return true;
+        }
+
+        // Record what the registry folders change so the next process can merge it in one go.
+        // The folders are fingerprinted before merging, a file modified during the merge makes the snapshot stale instead of wrong.
+        AZ::Internal::MergedSnapshotFolders folders;
+        if (useSnapshot)
+        {
+            folders = AZ::Internal::GetMergedSnapshotFolders(registry, platform);
+        }
+
+        MergeSettingsToRegistry_EngineRegistry(registry, platform, specializations, scratchBuffer);
+        MergeSettingsToRegistry_GemRegistries(registry, platform, specializations, scratchBuffer);
+        MergeSettingsToRegistry_ProjectRegistry(registry, platform, specializations, scratchBuffer);
+
+        if (useSnapshot)
+        {
+            rapidjson::Document documentBefore;
+            documentBefore.Parse(settingsBefore.c_str(), settingsBefore.size());
+            AZStd::string settingsAfter;
+            rapidjson::Document documentAfter;
+            rapidjson::Document patch;
+            rapidjson::StringBuffer patchBuffer;
+            rapidjson::Writer<rapidjson::StringBuffer> patchWriter(patchBuffer);
+            if (!documentBefore.HasParseError() && documentBefore.IsObject()
+                && AZ::Internal::DumpRegistryForMergedSnapshot(registry, settingsAfter)
+                && !documentAfter.Parse(settingsAfter.c_str(), settingsAfter.size()).HasParseError() && documentAfter.IsObject()
+                && JsonSerialization::CreatePatch(patch, patch.GetAllocator(), documentBefore, documentAfter,
+                    JsonMergeApproach::JsonMergePatch).GetProcessing() != JsonSerializationResult::Processing::Halted
+                && patch.Accept(patchWriter))
+            {
+                [[maybe_unused]] const bool snapshotWritten = AZ::Internal::WriteMergedSnapshot(snapshotPath,
+                    AZ::Internal::GetMergedSnapshotKey(platform, specializations), settingsHash, folders,
+                    AZStd::string_view(patchBuffer.GetString(), patchBuffer.GetSize()));
+                AZ_Warning("SettingsRegistryMergeUtils", snapshotWritten, R"(Unable to write merged snapshot "%.*s".)",
+                    AZ_STRING_ARG(snapshotPath));
+            }
+        }
+        return false;
+    }
+
     void MergeSettingsToRegistry_ProjectUserRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
         const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer)
     {
@@ -231,6 +231,36 @@ namespace AZ::SettingsRegistryMergeUtils
     void MergeSettingsToRegistry_ProjectRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
         const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer = nullptr);
 
+    //! Extension of the files storing the pre-merged engine, gem and project registries.
+    inline constexpr AZStd::string_view MergedSnapshotExtension = ".setregsnapshot";
+    //! Key which can be set to false, for instance with --regset on the command line, to always merge the registry folders
+    //! instead of going through a merged snapshot.
+    inline constexpr const char* MergedSnapshotEnabledKey = "/O3DE/Settings/SettingsRegistry/UseMergedSnapshot";
+
+    //! Returns the path of the merged snapshot for the platform and specializations under the project cache folder,
+    //! or an empty path if the project cache folder isn't known yet.
+    AZ::IO::FixedMaxPath GetMergedSnapshotPath(SettingsRegistryInterface& registry, const AZStd::string_view platform,
+        const SettingsRegistryInterface::Specializations& specializations);
+
+    //! Merges a snapshot written by MergeSettingsToRegistry_EngineGemProjectRegistries.
+    //! The snapshot is only merged if it was made for the same platform and specializations, from a registry holding the same
+    //! settings, and if none of the engine, gem and project registry folders changed since it was written, files being added,
+    //! removed or modified. The merge history and the command line are left out of the comparison, they differ between processes.
+    //! @prereq - The same keys as MergeSettingsToRegistry_GemRegistries must be set, the active gems are needed to validate the snapshot
+    //! @return true if the snapshot was valid and merged, false if the registry folders must be merged instead
+    bool MergeSettingsToRegistry_MergedSnapshot(SettingsRegistryInterface& registry, AZStd::string_view snapshotPath,
+        const AZStd::string_view platform, const SettingsRegistryInterface::Specializations& specializations);
+
+    //! Merges the engine, gem and project registries, in that order, through a snapshot of their merged settings.
+    //! If the snapshot at snapshotPath is valid it is merged in place of the registry folders, which saves scanning, parsing and
+    //! patching every .setreg and .setregpatch file. Otherwise the folders are merged and the changes they made to the registry
+    //! are written to a new snapshot for the next process to use.
+    //! If snapshotPath is empty, the registry folders are merged without a snapshot.
+    //! @return true if the settings were merged from the snapshot
+    bool MergeSettingsToRegistry_EngineGemProjectRegistries(SettingsRegistryInterface& registry, const AZStd::string_view platform,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::string_view snapshotPath,
+        AZStd::vector<char>* scratchBuffer = nullptr);
+
     //! Adds the development settings added by individual users of the project to the Settings Registry.
     //! Note that this function is only called in development builds and is compiled out in release builds.
     void MergeSettingsToRegistry_ProjectUserRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
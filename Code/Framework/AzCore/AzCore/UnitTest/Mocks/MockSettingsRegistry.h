@@ -37,6 +37,13 @@ namespace AZ
         MOCK_CONST_METHOD2(Get, bool(AZStd::string&, AZStd::string_view));
         MOCK_CONST_METHOD2(Get, bool(FixedValueString&, AZStd::string_view));
         MOCK_CONST_METHOD3(GetObject, bool(void*, Uuid, AZStd::string_view));
+        MOCK_CONST_METHOD2(Get, bool(bool&, const KeyHandle&));
+        MOCK_CONST_METHOD2(Get, bool(s64&, const KeyHandle&));
+        MOCK_CONST_METHOD2(Get, bool(u64&, const KeyHandle&));
+        MOCK_CONST_METHOD2(Get, bool(double&, const KeyHandle&));
+        MOCK_CONST_METHOD2(Get, bool(AZStd::string&, const KeyHandle&));
+        MOCK_CONST_METHOD2(Get, bool(FixedValueString&, const KeyHandle&));
+        MOCK_CONST_METHOD3(GetObject, bool(void*, Uuid, const KeyHandle&));
 
         MOCK_METHOD2(Set, bool(AZStd::string_view, bool));
         MOCK_METHOD2(Set, bool(AZStd::string_view, s64));
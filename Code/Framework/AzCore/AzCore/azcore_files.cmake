@@ -33,6 +33,8 @@ set(FILES
     Asset/AssetSerializer.cpp
     Asset/AssetSerializer.h
     Asset/AssetTypeInfoBus.h
+    Asset/ObjectStreamImageAssetData.cpp
+    Asset/ObjectStreamImageAssetData.h
     Asset/AssetInternal/WeakAsset.h
     Casting/lossy_cast.h
     Casting/numeric_cast.h
@@ -382,6 +384,8 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
@@ -497,6 +501,8 @@ set(FILES
     Serialization/SerializationUtils.cpp
     Serialization/ObjectStream.cpp
     Serialization/ObjectStream.h
+    Serialization/ObjectStreamImage.cpp
+    Serialization/ObjectStreamImage.h
     Serialization/SerializeContext.cpp
     Serialization/SerializeContext.h
     Serialization/SerializeContextEnum.cpp
@@ -521,6 +527,8 @@ set(FILES
     Serialization/Json/DoubleSerializer.cpp
     Serialization/Json/IntSerializer.h
     Serialization/Json/IntSerializer.cpp
+    Serialization/Json/JsonClassLoadPlan.h
+    Serialization/Json/JsonClassLoadPlan.cpp
     Serialization/Json/JsonDeserializer.h
     Serialization/Json/JsonDeserializer.cpp
     Serialization/Json/JsonImporter.cpp
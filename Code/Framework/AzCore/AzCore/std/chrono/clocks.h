@@ -58,6 +58,7 @@ namespace AZStd
         //      20.9.5.2 Class monotonic_clock [time.clock.monotonic]                 //
         //----------------------------------------------------------------------------//
         typedef system_clock    monotonic_clock;        // as permitted by [time.clock.monotonic]
+        typedef monotonic_clock steady_clock;           // C++11 name of the monotonic clock [time.clock.steady]
         typedef monotonic_clock high_resolution_clock;  // as permitted by [time.clock.hires]
     }
 }
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace UnitTest
+{
+    class AllocationRecordsSamplingTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            m_records = new AZ::Debug::AllocationRecords(0, false, false, "AllocationRecordsSamplingTest");
+            m_records->SetSamplingInterval(SamplingInterval);
+            m_records->SetMode(AZ::Debug::AllocationRecords::RECORD_SAMPLED);
+        }
+
+        void TearDown() override
+        {
+            delete m_records;
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+        // The records never access the memory, the allocations only need distinct addresses
+        void Allocate(size_t count, size_t byteSize, const char* site)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                void* address = reinterpret_cast<void*>(m_nextAddress);
+                m_nextAddress += 64;
+                m_records->RegisterAllocation(address, byteSize, 16, site, site, 0, 0);
+                m_addresses.push_back(address);
+            }
+        }
+
+        void FreeAll()
+        {
+            for (void* address : m_addresses)
+            {
+                m_records->UnregisterAllocation(address, 0, 0, nullptr);
+            }
+            m_addresses.clear();
+        }
+
+        AZ::Debug::HeapProfileSite GetSite(const char* site)
+        {
+            AZ::Debug::HeapProfile profile;
+            m_records->GatherHeapProfile(profile);
+
+            // The samples of a site can have different stacks
+            AZ::Debug::HeapProfileSite total;
+            for (const AZ::Debug::HeapProfileSite& profileSite : profile)
+            {
+                if (profileSite.m_fileName == site)
+                {
+                    total.m_sampleCount += profileSite.m_sampleCount;
+                    total.m_estimatedCount += profileSite.m_estimatedCount;
+                    total.m_estimatedBytes += profileSite.m_estimatedBytes;
+                }
+            }
+            return total;
+        }
+
+        static constexpr size_t SamplingInterval = 4096;
+
+        AZ::Debug::AllocationRecords* m_records = nullptr;
+        AZStd::vector<void*> m_addresses;
+        uintptr_t m_nextAddress = 0x10000;
+    };
+
+    TEST_F(AllocationRecordsSamplingTest, SmallAllocations_EstimatedBytesWithinBounds)
+    {
+        static const char* Site = "SmallAllocations";
+        constexpr size_t count = 200000;
+        constexpr size_t byteSize = 32;
+        Allocate(count, byteSize, Site);
+
+        // About 1500 samples, the relative standard deviation of the estimate is below 3%
+        const AZ::Debug::HeapProfileSite site = GetSite(Site);
+        EXPECT_LT(site.m_sampleCount, count / 10);
+        EXPECT_NEAR(static_cast<double>(count * byteSize), static_cast<double>(site.m_estimatedBytes), count * byteSize * 0.15);
+        EXPECT_NEAR(static_cast<double>(count), static_cast<double>(site.m_estimatedCount), count * 0.15);
+
+        FreeAll();
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, MixedSizes_EstimatedBytesPerSiteWithinBounds)
+    {
+        static const char* SmallSite = "Small";
+        static const char* MediumSite = "Medium";
+        static const char* LargeSite = "Large";
+        Allocate(100000, 48, SmallSite);
+        Allocate(2000, 3000, MediumSite);
+        Allocate(10, 1024 * 1024, LargeSite);
+
+        // Medium allocations are sampled about half of the time, the estimate corrects for it
+        EXPECT_NEAR(100000.0 * 48, static_cast<double>(GetSite(SmallSite).m_estimatedBytes), 100000.0 * 48 * 0.15);
+        EXPECT_NEAR(2000.0 * 3000, static_cast<double>(GetSite(MediumSite).m_estimatedBytes), 2000.0 * 3000 * 0.15);
+
+        // Allocations much larger than the interval are always sampled
+        const AZ::Debug::HeapProfileSite largeSite = GetSite(LargeSite);
+        EXPECT_EQ(10u, largeSite.m_sampleCount);
+        EXPECT_NEAR(10.0 * 1024 * 1024, static_cast<double>(largeSite.m_estimatedBytes), 10.0 * 1024 * 1024 * 0.01);
+
+        FreeAll();
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, Unregister_FreedAllocations_RemovedFromProfile)
+    {
+        static const char* Site = "Freed";
+        Allocate(10000, 256, Site);
+        EXPECT_GT(GetSite(Site).m_sampleCount, 0u);
+
+        FreeAll();
+        EXPECT_EQ(0u, GetSite(Site).m_sampleCount);
+        EXPECT_TRUE(m_records->GetMap().empty());
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, SetMode_NoRecords_ClearsTheSamples)
+    {
+        static const char* Site = "Cleared";
+        Allocate(1000, 1024, Site);
+        EXPECT_GT(GetSite(Site).m_sampleCount, 0u);
+
+        m_records->SetMode(AZ::Debug::AllocationRecords::RECORD_NO_RECORDS);
+        EXPECT_TRUE(m_records->GetMap().empty());
+        m_addresses.clear();
+    }
+
+    using AllocatorManagerHeapSamplingTest = AllocatorsTestFixture;
+
+    TEST_F(AllocatorManagerHeapSamplingTest, SetHeapSampling_Stopped_RestoresRecordingMode)
+    {
+        AZ::Debug::AllocationRecords* records = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().GetRecords();
+        if (!records)
+        {
+            // Builds without allocation records have no mode to restore
+            return;
+        }
+
+        const AZ::Debug::AllocationRecords::Mode previousMode = records->GetMode();
+        records->SetMode(AZ::Debug::AllocationRecords::RECORD_FULL);
+
+        AZ::AllocatorManager::Instance().SetHeapSampling(4096);
+        EXPECT_EQ(AZ::Debug::AllocationRecords::RECORD_SAMPLED, records->GetMode());
+
+        // Changing the interval while sampling keeps the mode from before the sampling
+        AZ::AllocatorManager::Instance().SetHeapSampling(8192);
+        AZ::AllocatorManager::Instance().SetHeapSampling(0);
+        EXPECT_EQ(AZ::Debug::AllocationRecords::RECORD_FULL, records->GetMode());
+
+        records->SetMode(previousMode);
+    }
+} // namespace UnitTest
@@ -11,6 +11,8 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/Memory/BestFitExternalMapAllocator.h>
 #include <AzCore/Memory/HeapSchema.h>
 #include <AzCore/Memory/HphaSchema.h>
@@ -182,6 +184,25 @@ namespace Benchmark
         {}
     };
 
+    // Same as HphaSchemaAllocator without the per thread caches of small allocations, to measure what they save under contention
+    class HphaSchemaNoThreadCacheAllocator : public AZ::SimpleSchemaAllocator<AZ::HphaSchema>
+    {
+    public:
+        AZ_TYPE_INFO(HphaSchemaNoThreadCacheAllocator, "{0B7A2D8E-6C4F-4E31-9A57-3D2F8C1B6E94}");
+
+        struct Descriptor : public AZ::HphaSchema::Descriptor
+        {
+            Descriptor()
+            {
+                m_isThreadCaching = false;
+            }
+        };
+
+        HphaSchemaNoThreadCacheAllocator()
+            : AZ::SimpleSchemaAllocator<AZ::HphaSchema>("TestHphaSchemaNoThreadCacheAllocator", "")
+        {}
+    };
+
     // For the SystemAllocator we inherit so we have a different stack. The SystemAllocator is used globally so we dont want
     // to get that data affecting the benchmark
     class TestSystemAllocator : public AZ::SystemAllocator
@@ -372,6 +393,99 @@ namespace Benchmark
         }
     };
 
+    // Every thread allocates a batch of small objects and frees it, like job workers creating short lived objects.
+    // Unlike the fixtures above the timing is never paused, so the contention between the threads is measured.
+    template <typename TAllocator>
+    class SmallAllocationThreadScalingBenchmarkFixture
+        : public AllocatorBenchmarkFixture<TAllocator>
+    {
+        using base = AllocatorBenchmarkFixture<TAllocator>;
+        using TestAllocatorType = typename base::TestAllocatorType;
+
+    public:
+        void Benchmark(benchmark::State& state)
+        {
+            const AllocationSizeArray& allocationArray = s_allocationSizes[SMALL];
+            size_t numberOfAllocations = 0;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                // fetched in the loop, only the first thread sets up the allocations and the threads synchronize here
+                AZStd::vector<void*>& perThreadAllocations = base::GetPerThreadAllocations(state.thread_index);
+                numberOfAllocations = perThreadAllocations.size();
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    perThreadAllocations[allocationIndex] = TestAllocatorType::Allocate(allocationArray[allocationIndex % allocationArray.size()], 0);
+                }
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    TestAllocatorType::DeAllocate(perThreadAllocations[allocationIndex], allocationArray[allocationIndex % allocationArray.size()]);
+                    perThreadAllocations[allocationIndex] = nullptr;
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * numberOfAllocations * 2);
+        }
+    };
+
+    // Mixed allocations with the heap sampling of the allocator manager on or off, to measure the cost of sampling
+    template <typename TAllocator, bool TSampling>
+    class HeapSamplingBenchmarkFixture
+        : public AllocatorBenchmarkFixture<TAllocator>
+    {
+        using base = AllocatorBenchmarkFixture<TAllocator>;
+        using TestAllocatorType = typename base::TestAllocatorType;
+
+    protected:
+        void internalSetUp(const ::benchmark::State& state) override
+        {
+            base::internalSetUp(state);
+            if (TSampling && state.thread_index == 0)
+            {
+                AZ::AllocatorManager::Instance().SetHeapSampling(AZ::Debug::AllocationRecords::DefaultSamplingInterval);
+            }
+        }
+
+        void internalTearDown(const ::benchmark::State& state) override
+        {
+            if (TSampling && state.thread_index == 0)
+            {
+                AZ::AllocatorManager::Instance().SetHeapSampling(0);
+            }
+            base::internalTearDown(state);
+        }
+
+    public:
+        void Benchmark(benchmark::State& state)
+        {
+            if (TSampling && !AZ::AllocatorInstance<TAllocator>::Get().GetRecords())
+            {
+                state.SkipWithError("The allocator has no allocation records to sample into");
+                return;
+            }
+
+            const AllocationSizeArray& allocationArray = s_allocationSizes[MIXED];
+            size_t numberOfAllocations = 0;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZStd::vector<void*>& perThreadAllocations = base::GetPerThreadAllocations(state.thread_index);
+                numberOfAllocations = perThreadAllocations.size();
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    perThreadAllocations[allocationIndex] = TestAllocatorType::Allocate(allocationArray[allocationIndex % allocationArray.size()], 0);
+                }
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    TestAllocatorType::DeAllocate(perThreadAllocations[allocationIndex], allocationArray[allocationIndex % allocationArray.size()]);
+                    perThreadAllocations[allocationIndex] = nullptr;
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * numberOfAllocations * 2);
+        }
+    };
+
     template<typename TAllocator>
     class RecordedAllocationBenchmarkFixture : public ::benchmark::Fixture
     {
@@ -551,6 +665,17 @@ namespace Benchmark
     // Test under and over-subscription of threads vs the amount of CPUs available
     static const unsigned int MaxThreadRange = 2 * AZStd::thread::hardware_concurrency();
 
+    // Thread scaling of small allocations, from no contention to the thread counts of large servers
+    static void ThreadScalingRunRanges(benchmark::internal::Benchmark* b)
+    {
+        b->Arg(1000)->ThreadRange(1, 64)->UseRealTime();
+    }
+
+    static void HeapSamplingRunRanges(benchmark::internal::Benchmark* b)
+    {
+        b->Arg(1000)->ThreadRange(1, 8)->UseRealTime();
+    }
+
 #define BM_REGISTER_TEMPLATE(FIXTURE, TESTNAME, ...) \
         BENCHMARK_TEMPLATE_DEFINE_F(FIXTURE, TESTNAME, __VA_ARGS__)(benchmark::State& state) { Benchmark(state); } \
         BENCHMARK_REGISTER_F(FIXTURE, TESTNAME)
@@ -580,12 +705,31 @@ namespace Benchmark
     BM_REGISTER_ALLOCATOR(MallocSchemaAllocator, MallocSchemaAllocator);
     BM_REGISTER_ALLOCATOR(HphaSchemaAllocator, HphaSchemaAllocator);
     BM_REGISTER_ALLOCATOR(SystemAllocator, TestSystemAllocator);
+
+#define BM_REGISTER_THREAD_SCALING(TESTNAME, ALLOCATORTYPE) \
+    namespace BM_##TESTNAME \
+    { \
+        BM_REGISTER_TEMPLATE(SmallAllocationThreadScalingBenchmarkFixture, TESTNAME##_SMALL_THREAD_SCALING, ALLOCATORTYPE)->Apply(ThreadScalingRunRanges); \
+    }
+
+    BM_REGISTER_THREAD_SCALING(RawMallocAllocator, RawMallocAllocator);
+    BM_REGISTER_THREAD_SCALING(HphaSchemaNoThreadCacheAllocator, HphaSchemaNoThreadCacheAllocator);
+    BM_REGISTER_THREAD_SCALING(HphaSchemaAllocator, HphaSchemaAllocator);
+    BM_REGISTER_THREAD_SCALING(SystemAllocator, TestSystemAllocator);
+
+    // Heap sampling is meant to stay on in production, the sampled run should stay within a few percent of the other one
+    namespace BM_SystemAllocator
+    {
+        BM_REGISTER_TEMPLATE(HeapSamplingBenchmarkFixture, SystemAllocator_HEAP_SAMPLING_OFF, TestSystemAllocator, false)->Apply(HeapSamplingRunRanges);
+        BM_REGISTER_TEMPLATE(HeapSamplingBenchmarkFixture, SystemAllocator_HEAP_SAMPLING_ON, TestSystemAllocator, true)->Apply(HeapSamplingRunRanges);
+    }
     
     //BM_REGISTER_ALLOCATOR(BestFitExternalMapAllocator, BestFitExternalMapAllocator); // Requires to pre-allocate blocks and cannot work as a general-purpose allocator
     //BM_REGISTER_ALLOCATOR(HeapSchemaAllocator, TestHeapSchemaAllocator); // Requires to pre-allocate blocks and cannot work as a general-purpose allocator
     //BM_REGISTER_SCHEMA(PoolSchema); // Requires special alignment requests while allocating
     // BM_REGISTER_ALLOCATOR(OSAllocator, OSAllocator); // Requires special treatment to initialize since it will be already initialized, maybe creating a different instance?
 
+#undef BM_REGISTER_THREAD_SCALING
 #undef BM_REGISTER_ALLOCATOR
 #undef BM_REGISTER_SIZE_FIXTURES
 #undef BM_REGISTER_TEMPLATE
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            AZ::FrameArenaAllocator::Descriptor desc;
+            desc.m_chunkSize = ChunkSize;
+            desc.m_markReclaimedMemory = true;
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+        AZ::FrameArenaAllocator& GetAllocator()
+        {
+            return static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get());
+        }
+
+        static constexpr size_t ChunkSize = 4096;
+    };
+
+    // Every allocation is preceded by its size
+    static constexpr size_t HeaderSize = sizeof(size_t);
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_AlignedAllocations_AreContiguousInTheChunk)
+    {
+        AZ::FrameArenaAllocator& allocator = GetAllocator();
+
+        char* first = static_cast<char*>(allocator.Allocate(24, 8));
+        char* second = static_cast<char*>(allocator.Allocate(32, 32));
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(second) % 32);
+        EXPECT_GE(second, first + 24 + HeaderSize);
+        EXPECT_LT(second, first + 24 + HeaderSize + 32);
+        EXPECT_EQ(32, allocator.AllocationSize(second));
+        EXPECT_EQ(24, allocator.AllocationSize(first));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, NewFrame_ReclaimsTheMemoryOfThePreviousFrame)
+    {
+        AZ::FrameArenaAllocator& allocator = GetAllocator();
+
+        char* first = static_cast<char*>(allocator.Allocate(100, 8));
+        ASSERT_NE(nullptr, first);
+        memset(first, 0, 100);
+        EXPECT_EQ(HeaderSize + 100, allocator.NumAllocatedBytes());
+
+        allocator.NewFrame();
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+
+        // The chunk is reused and the reclaimed memory is marked
+        char* second = static_cast<char*>(allocator.Allocate(8, 8));
+        EXPECT_EQ(first, second);
+        EXPECT_EQ(static_cast<char>(0xcd), first[50]);
+        EXPECT_EQ(ChunkSize, allocator.Capacity());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, DeAllocate_LastAllocation_RewindsTheCursor)
+    {
+        AZ::FrameArenaAllocator& allocator = GetAllocator();
+
+        void* first = allocator.Allocate(64, 8);
+        void* second = allocator.Allocate(64, 8);
+        allocator.DeAllocate(first);
+        EXPECT_EQ(2 * (HeaderSize + 64), allocator.NumAllocatedBytes());
+
+        allocator.DeAllocate(second);
+        EXPECT_EQ(HeaderSize + 64, allocator.NumAllocatedBytes());
+        EXPECT_EQ(second, allocator.Allocate(64, 8));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Resize_LastAllocation_GrowsInPlace)
+    {
+        AZ::FrameArenaAllocator& allocator = GetAllocator();
+
+        void* first = allocator.Allocate(64, 8);
+        EXPECT_EQ(256, allocator.Resize(first, 256));
+        EXPECT_EQ(256, allocator.AllocationSize(first));
+
+        // Past the end of the chunk the size is kept
+        EXPECT_EQ(256, allocator.Resize(first, ChunkSize));
+
+        void* second = allocator.Allocate(8, 8);
+        EXPECT_EQ(0, allocator.Resize(first, 512));
+        EXPECT_EQ(64, allocator.Resize(second, 64));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, ReAllocate_NotTheLastAllocation_CopiesIt)
+    {
+        AZ::FrameArenaAllocator& allocator = GetAllocator();
+
+        char* first = static_cast<char*>(allocator.Allocate(16, 8));
+        ASSERT_NE(nullptr, first);
+        memcpy(first, "frame temporary", 16);
+        void* second = allocator.Allocate(8, 8);
+
+        char* reallocated = static_cast<char*>(allocator.ReAllocate(first, 64, 8));
+        ASSERT_NE(nullptr, reallocated);
+        EXPECT_NE(first, reallocated);
+        EXPECT_GT(reallocated, static_cast<char*>(second));
+        EXPECT_STREQ("frame temporary", reallocated);
+        EXPECT_EQ(64, allocator.AllocationSize(reallocated));
+
+        // The last allocation is resized in place
+        EXPECT_EQ(reallocated, allocator.ReAllocate(reallocated, 128, 8));
+        EXPECT_EQ(128, allocator.AllocationSize(reallocated));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_LargerThanAChunk_IsFreedWithTheFrame)
+    {
+        AZ::FrameArenaAllocator& allocator = GetAllocator();
+
+        void* large = allocator.Allocate(ChunkSize * 4, 16);
+        ASSERT_NE(nullptr, large);
+        memset(large, 1, ChunkSize * 4);
+        EXPECT_GT(allocator.Capacity(), ChunkSize * 4);
+
+        allocator.NewFrame();
+        allocator.Allocate(16, 16);
+        EXPECT_EQ(ChunkSize, allocator.Capacity());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, HighWaterMark_IsTheLargestFrame)
+    {
+        AZ::FrameArenaAllocator& allocator = GetAllocator();
+
+        allocator.Allocate(1000, 8);
+        allocator.NewFrame();
+        allocator.Allocate(200, 8);
+        allocator.NewFrame();
+        allocator.Allocate(8, 8);
+
+        EXPECT_EQ(HeaderSize + 1000, allocator.GetHighWaterMark());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_FromManyThreads_EveryThreadHasItsOwnArena)
+    {
+        AZ::FrameArenaAllocator& allocator = GetAllocator();
+
+        constexpr size_t threadCount = 8;
+        constexpr size_t allocationCount = 1000;
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, threadIndex]()
+            {
+                AZStd::vector<AZ::u32*> allocations;
+                for (size_t i = 0; i < allocationCount; ++i)
+                {
+                    AZ::u32* value = static_cast<AZ::u32*>(allocator.Allocate(sizeof(AZ::u32), alignof(AZ::u32)));
+                    *value = static_cast<AZ::u32>(threadIndex);
+                    allocations.push_back(value);
+                }
+                for (AZ::u32* value : allocations)
+                {
+                    EXPECT_EQ(threadIndex, *value);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, StdAllocator_Vector_GrowsInPlace)
+    {
+        AZStd::vector<int, AZ::FrameArenaStdAllocator> values;
+        values.push_back(0);
+        const int* data = values.data();
+        for (int i = 1; i < 100; ++i)
+        {
+            values.push_back(i);
+        }
+        EXPECT_EQ(data, values.data());
+        EXPECT_EQ(99, values.back());
+    }
+
+    TEST_F(AllocatorsTestFixture, FrameArenaStdAllocator_ArenaNotCreated_UsesTheSystemAllocator)
+    {
+        AZ::FrameArenaStdAllocator allocator;
+        const size_t allocatedSize = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+        void* ptr = allocator.allocate(64, 8);
+        EXPECT_LE(allocatedSize + 64, AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes());
+        allocator.deallocate(ptr, 64, 8);
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class FrameArenaAllocatorBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        // A frame worth of temporary vectors, like the entries gathered from a visibility query
+        template<class StdAllocator>
+        void RunFrame(::benchmark::State& state)
+        {
+            const size_t vectorCount = aznumeric_cast<size_t>(state.range(0));
+            for (size_t vectorIndex = 0; vectorIndex < vectorCount; ++vectorIndex)
+            {
+                AZStd::vector<void*, StdAllocator> entries;
+                for (size_t i = 0; i < 64; ++i)
+                {
+                    entries.push_back(&entries);
+                }
+                benchmark::DoNotOptimize(entries.data());
+            }
+        }
+    };
+
+    BENCHMARK_DEFINE_F(FrameArenaAllocatorBenchmarkFixture, TemporaryVectors_SystemAllocator)(::benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            RunFrame<AZStd::allocator>(state);
+        }
+    }
+    BENCHMARK_REGISTER_F(FrameArenaAllocatorBenchmarkFixture, TemporaryVectors_SystemAllocator)->Arg(100)->Arg(1000);
+
+    BENCHMARK_DEFINE_F(FrameArenaAllocatorBenchmarkFixture, TemporaryVectors_FrameArenaAllocator)(::benchmark::State& state)
+    {
+        AZ::FrameArenaAllocator& allocator = static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get());
+        for (auto _ : state)
+        {
+            RunFrame<AZ::FrameArenaStdAllocator>(state);
+            allocator.NewFrame();
+        }
+    }
+    BENCHMARK_REGISTER_F(FrameArenaAllocatorBenchmarkFixture, TemporaryVectors_FrameArenaAllocator)->Arg(100)->Arg(1000);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -9,6 +9,8 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/thread.h>
 
 class HphaSchema_TestAllocator
     : public AZ::SimpleSchemaAllocator<AZ::HphaSchema>
@@ -84,6 +86,107 @@ namespace UnitTest
         }
     }
 
+    TEST_F(HphaSchemaTestFixture, ThreadCaches_FreedOnAnotherThread_AllocatedBytesStayAccurate)
+    {
+        constexpr size_t numberOfThreads = 4;
+        constexpr size_t numberOfAllocationsPerThread = 1000;
+        constexpr AZStd::array<size_t, 4> allocationSizes = { 16, 64, 128, 256 };
+
+        AZ::IAllocator& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        const size_t allocatedBytesBefore = allocator.NumAllocatedBytes();
+
+        AZStd::vector<AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>>> allocations(numberOfThreads);
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, &allocations, &allocationSizes, threadIndex]()
+            {
+                for (size_t i = 0; i < numberOfAllocationsPerThread; ++i)
+                {
+                    allocations[threadIndex].push_back(allocator.Allocate(allocationSizes[i % allocationSizes.size()], 0));
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // the sizes are multiples of the pool granularity, so the allocated bytes are exact
+        size_t expectedBytes = 0;
+        for (size_t i = 0; i < numberOfAllocationsPerThread; ++i)
+        {
+            expectedBytes += allocationSizes[i % allocationSizes.size()];
+        }
+        EXPECT_EQ(allocatedBytesBefore + numberOfThreads * expectedBytes, allocator.NumAllocatedBytes());
+
+        // the allocating threads have exited, free everything from this thread
+        for (auto& threadAllocations : allocations)
+        {
+            for (size_t i = 0; i < threadAllocations.size(); ++i)
+            {
+                allocator.DeAllocate(threadAllocations[i], allocationSizes[i % allocationSizes.size()]);
+            }
+        }
+        EXPECT_EQ(allocatedBytesBefore, allocator.NumAllocatedBytes());
+
+        allocator.GarbageCollect();
+        EXPECT_EQ(allocatedBytesBefore, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaTestFixture, ThreadCaches_ThreadIdle_CacheReleasedWithoutGarbageCollect)
+    {
+        constexpr unsigned int trimIntervalMs = 1;
+        constexpr size_t numberOfAllocations = 32;
+        constexpr size_t allocationSize = 64;
+
+        AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+        HphaSchema_TestAllocator::Descriptor desc;
+        desc.m_threadCacheTrimIntervalMs = trimIntervalMs;
+        AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+
+        AZ::IAllocator& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        const AZ::HphaSchema* schema = static_cast<const AZ::HphaSchema*>(allocator.GetSchema());
+        ASSERT_NE(nullptr, schema);
+
+        // fill the cache of a thread, then keep the thread alive without allocating
+        AZStd::binary_semaphore cacheFilled;
+        AZStd::binary_semaphore exitIdleThread;
+        AZStd::thread idleThread([&allocator, &cacheFilled, &exitIdleThread]()
+        {
+            AZStd::array<void*, numberOfAllocations> allocations;
+            for (void*& allocation : allocations)
+            {
+                allocation = allocator.Allocate(allocationSize, 0);
+            }
+            for (void* allocation : allocations)
+            {
+                allocator.DeAllocate(allocation, allocationSize);
+            }
+            cacheFilled.release();
+            exitIdleThread.acquire();
+        });
+        cacheFilled.acquire();
+        EXPECT_LT(0u, schema->GetThreadCachedMemory());
+
+        // short lived threads go through the slow path on their first allocation, and release their own cache when they exit.
+        // The first trim marks the idle cache as unused, the next one releases it
+        constexpr int maxAttempts = 1000;
+        for (int attempt = 0; attempt < maxAttempts && schema->GetThreadCachedMemory() > 0; ++attempt)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(2 * trimIntervalMs));
+            AZStd::thread busyThread([&allocator]()
+            {
+                allocator.DeAllocate(allocator.Allocate(allocationSize, 0), allocationSize);
+            });
+            busyThread.join();
+        }
+        EXPECT_EQ(0u, schema->GetThreadCachedMemory());
+
+        exitIdleThread.release();
+        idleThread.join();
+    }
+
     static const AZStd::array<HphaSchemaTestParameters, 2> s_smallInstancesParameters = {
          HphaSchemaTestParameters(s_smallAllocationSizes, 2),
          HphaSchemaTestParameters(s_smallAllocationSizes, 100)
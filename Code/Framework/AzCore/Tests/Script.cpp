@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/Script/ScriptContextDebug.h>
@@ -4497,4 +4498,240 @@ ramenShop.handler:Connect(4);
 }
 
 
+namespace UnitTest
+{
+    class ScriptContextAllocatorTest
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(ScriptContextAllocatorTest, PoolAllocator_SmallAllocations_ArePooled)
+    {
+        ScriptContext script;
+
+        const ScriptContext::AllocatorStatistics before = script.GetAllocatorStatistics();
+        EXPECT_TRUE(script.Execute(R"LUA(
+            churn = {}
+            for i = 1, 1000 do
+                churn[i] = { x = i, y = tostring(i) }
+            end
+            big = string.rep("x", 4096)
+        )LUA"));
+
+        const ScriptContext::AllocatorStatistics after = script.GetAllocatorStatistics();
+        EXPECT_GT(after.m_pooledAllocations, before.m_pooledAllocations + 1000);
+        EXPECT_GT(after.m_pooledBytes, before.m_pooledBytes);
+        EXPECT_GT(after.m_fallbackAllocations, before.m_fallbackAllocations);
+        EXPECT_GE(after.m_fallbackBytes, 4096);
+
+        EXPECT_TRUE(script.Execute("churn = nil big = nil"));
+        script.GarbageCollect();
+        EXPECT_LT(script.GetAllocatorStatistics().m_pooledBytes, after.m_pooledBytes);
+    }
+
+    TEST_F(ScriptContextAllocatorTest, PoolAllocator_CustomAllocator_IsNotPooled)
+    {
+        ScriptContext script(ScriptContextIds::DefaultScriptContextId, &AllocatorInstance<SystemAllocator>::Get());
+        EXPECT_TRUE(script.Execute("t = { 1, 2, 3 }"));
+
+        const ScriptContext::AllocatorStatistics statistics = script.GetAllocatorStatistics();
+        EXPECT_EQ(0, statistics.m_pooledAllocations);
+        EXPECT_EQ(0, statistics.m_fallbackAllocations);
+    }
+
+    TEST_F(ScriptContextAllocatorTest, GarbageCollectStepForTime_FinishesCycle_CollectsGarbage)
+    {
+        ScriptContext script;
+        EXPECT_TRUE(script.Execute(R"LUA(
+            garbage = {}
+            for i = 1, 10000 do
+                garbage[i] = { i }
+            end
+            garbage = nil
+        )LUA"));
+
+        const size_t memoryBefore = script.GetMemoryUsage();
+        size_t numberOfSteps = 0;
+        for (int frame = 0; frame < 1000 && script.GetMemoryUsage() >= memoryBefore; ++frame)
+        {
+            numberOfSteps += script.GarbageCollectStepForTime(AZStd::chrono::microseconds(100));
+        }
+
+        EXPECT_GT(numberOfSteps, 0);
+        EXPECT_LT(script.GetMemoryUsage(), memoryBefore);
+    }
+}
+
+namespace AZ
+{
+    AZ_CVAR_EXTERNED(bool, cl_luaFastMethodCalls);
+}
+
+namespace UnitTest
+{
+    // binds the math types with or without the specialized method callers
+    class ScriptContextMethodCallTest
+        : public AllocatorsFixture
+        , public ::testing::WithParamInterface<bool>
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            m_fastMethodCalls = AZ::cl_luaFastMethodCalls;
+            AZ::cl_luaFastMethodCalls = GetParam();
+
+            m_behavior = aznew BehaviorContext();
+            AZ::MathReflect(m_behavior);
+            m_behavior->Method("AZTestAssert", &AZTestAssert);
+
+            m_script = aznew ScriptContext();
+            m_script->BindTo(m_behavior);
+        }
+
+        void TearDown() override
+        {
+            delete m_script;
+            delete m_behavior;
+            AZ::cl_luaFastMethodCalls = m_fastMethodCalls;
+
+            AllocatorsFixture::TearDown();
+        }
+
+        BehaviorContext* m_behavior = nullptr;
+        ScriptContext* m_script = nullptr;
+        bool m_fastMethodCalls = true;
+    };
+
+    TEST_P(ScriptContextMethodCallTest, MathMethods_ValueArgumentsAndResults_MatchNative)
+    {
+        EXPECT_TRUE(m_script->Execute(R"LUA(
+            local a = Vector3(1, 2, 3)
+            local b = Vector3(4, 5, 6)
+            local sum = a + b
+            AZTestAssert(sum.x == 5 and sum.y == 7 and sum.z == 9)
+            AZTestAssert(a.x == 1 and b.x == 4) -- arguments are not modified
+            AZTestAssert((b - a):IsClose(Vector3(3, 3, 3)))
+            AZTestAssert(a:Dot(b) == 32)
+            AZTestAssert(Vector3(3, 4, 0):GetLength() == 5)
+            AZTestAssert(Vector3.CreateAxisX(2).x == 2)
+
+            -- results are independent objects
+            local chained = a + a + a
+            AZTestAssert(chained.x == 3 and chained.z == 9)
+            chained.x = 0
+            AZTestAssert(a.x == 1)
+        )LUA"));
+    }
+
+    TEST_P(ScriptContextMethodCallTest, MathMethods_NilArgument_ReportsError)
+    {
+        bool isErrorReported = false;
+        auto oldHook = m_script->GetErrorHook();
+        m_script->SetErrorHook([&isErrorReported](ScriptContext*, ScriptContext::ErrorType error, const char*)
+        {
+            isErrorReported = isErrorReported || error == ScriptContext::ErrorType::Error;
+        });
+        m_script->Execute("local a = Vector3(1, 2, 3) local d = a:Dot(nil)");
+        m_script->SetErrorHook(oldHook);
+
+        EXPECT_TRUE(isErrorReported);
+    }
+
+    INSTANTIATE_TEST_CASE_P(Script, ScriptContextMethodCallTest, ::testing::Bool());
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class ScriptContextAllocatorBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        // tables, strings and closures, the small object churn of gameplay and UI scripts
+        static constexpr const char* s_churnScript = R"LUA(
+            local items = {}
+            for i = 1, 1000 do
+                local value = i
+                items[i] = { index = i, name = "item" .. i, get = function() return value end }
+            end
+            return #items
+        )LUA";
+
+        void RunChurn(benchmark::State& state, ScriptContext& script)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                script.Execute(s_churnScript);
+                script.GarbageCollectStep(2);
+            }
+
+            state.SetItemsProcessed(state.iterations() * 1000);
+        }
+    };
+
+    BENCHMARK_F(ScriptContextAllocatorBenchmarkFixture, BM_ScriptContextChurn_PoolAllocator)(benchmark::State& state)
+    {
+        ScriptContext script;
+        RunChurn(state, script);
+    }
+
+    BENCHMARK_F(ScriptContextAllocatorBenchmarkFixture, BM_ScriptContextChurn_SystemAllocator)(benchmark::State& state)
+    {
+        ScriptContext script(ScriptContextIds::DefaultScriptContextId, &AllocatorInstance<SystemAllocator>::Get());
+        RunChurn(state, script);
+    }
+
+    class ScriptContextMethodCallBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        static constexpr int s_numberOfAdds = 1000000;
+
+        void RunVector3Adds(benchmark::State& state, bool fastMethodCalls)
+        {
+            const bool oldFastMethodCalls = AZ::cl_luaFastMethodCalls;
+            AZ::cl_luaFastMethodCalls = fastMethodCalls;
+            {
+                BehaviorContext behaviorContext;
+                AZ::MathReflect(&behaviorContext);
+
+                ScriptContext script;
+                script.BindTo(&behaviorContext);
+                script.Execute(AZStd::string::format(R"LUA(
+                    function AddVector3s()
+                        local sum = Vector3(0, 0, 0)
+                        local step = Vector3(1, 1, 1)
+                        for i = 1, %d do
+                            sum = sum + step
+                        end
+                        return sum.x
+                    end
+                )LUA", s_numberOfAdds).c_str());
+
+                for ([[maybe_unused]] auto _ : state)
+                {
+                    script.Execute("AddVector3s()");
+                    script.GarbageCollectStep(2);
+                }
+
+                state.SetItemsProcessed(state.iterations() * s_numberOfAdds);
+            }
+            AZ::cl_luaFastMethodCalls = oldFastMethodCalls;
+        }
+    };
+
+    BENCHMARK_F(ScriptContextMethodCallBenchmarkFixture, BM_ScriptContextVector3Add_FastCaller)(benchmark::State& state)
+    {
+        RunVector3Adds(state, true);
+    }
+
+    BENCHMARK_F(ScriptContextMethodCallBenchmarkFixture, BM_ScriptContextVector3Add_GenericCaller)(benchmark::State& state)
+    {
+        RunVector3Adds(state, false);
+    }
+}
+#endif // HAVE_BENCHMARK
+
 #endif // #if !defined(AZCORE_EXCLUDE_LUA)
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/Json/JsonClassLoadPlan.h>
+#include <Tests/Serialization/Json/BaseJsonSerializerFixture.h>
+
+namespace JsonSerializationTests
+{
+    struct LoadPlanBase
+    {
+        AZ_RTTI(LoadPlanBase, "{0F8B7D3A-4C55-4E0C-9B7E-6C7C4D6A1E21}");
+        AZ_CLASS_ALLOCATOR(LoadPlanBase, AZ::SystemAllocator, 0);
+
+        virtual ~LoadPlanBase() = default;
+
+        int m_baseValue = 0;
+        float m_baseOnly = 0.0f;
+    };
+
+    struct LoadPlanDerived
+        : public LoadPlanBase
+    {
+        AZ_RTTI(LoadPlanDerived, "{6E1B2F44-9A0D-4F3B-8C61-2D5A7E9F0B13}", LoadPlanBase);
+        AZ_CLASS_ALLOCATOR(LoadPlanDerived, AZ::SystemAllocator, 0);
+
+        ~LoadPlanDerived() override
+        {
+            delete m_child;
+        }
+
+        static void Reflect(AZ::SerializeContext& context, bool withExtra)
+        {
+            context.Class<LoadPlanBase>()
+                ->Field("value", &LoadPlanBase::m_baseValue)
+                ->Field("baseOnly", &LoadPlanBase::m_baseOnly);
+
+            AZ::SerializeContext::ClassBuilder builder = context.Class<LoadPlanDerived, LoadPlanBase>();
+            builder
+                ->Field("value", &LoadPlanDerived::m_derivedValue)
+                ->Field("child", &LoadPlanDerived::m_child);
+            if (withExtra)
+            {
+                builder->Field("extra", &LoadPlanDerived::m_extra);
+            }
+        }
+
+        static void Unreflect(AZ::SerializeContext& context)
+        {
+            context.EnableRemoveReflection();
+            Reflect(context, false);
+            context.DisableRemoveReflection();
+        }
+
+        int m_derivedValue = 0;
+        LoadPlanBase* m_child = nullptr;
+        bool m_extra = false;
+    };
+
+    class JsonClassLoadPlanTests
+        : public BaseJsonSerializerFixture
+    {
+    public:
+        void RegisterAdditional(AZStd::unique_ptr<AZ::SerializeContext>& serializeContext) override
+        {
+            LoadPlanDerived::Reflect(*serializeContext, false);
+        }
+
+        AZStd::shared_ptr<const AZ::JsonClassLoadPlan> GetPlan()
+        {
+            const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<LoadPlanDerived>());
+            AZ_Assert(classData, "LoadPlanDerived isn't reflected.");
+            return m_jsonRegistrationContext->GetClassLoadPlan(*m_serializeContext, *classData);
+        }
+
+        static void* GetAddress(LoadPlanDerived& instance, const AZ::JsonClassLoadPlan::Element* element)
+        {
+            return reinterpret_cast<char*>(&instance) + element->m_offset;
+        }
+    };
+
+    TEST_F(JsonClassLoadPlanTests, FindElement_NameInDerivedAndBaseClass_ReturnsDerivedElement)
+    {
+        LoadPlanDerived instance;
+        const AZ::JsonClassLoadPlan::Element* element = GetPlan()->FindElement(AZ::Crc32("value"));
+        ASSERT_NE(nullptr, element);
+        EXPECT_EQ(&instance.m_derivedValue, GetAddress(instance, element));
+    }
+
+    TEST_F(JsonClassLoadPlanTests, FindElement_NameInBaseClass_OffsetIncludesBaseClass)
+    {
+        LoadPlanDerived instance;
+        const AZ::JsonClassLoadPlan::Element* element = GetPlan()->FindElement(AZ::Crc32("baseOnly"));
+        ASSERT_NE(nullptr, element);
+        EXPECT_EQ(&instance.m_baseOnly, GetAddress(instance, element));
+    }
+
+    TEST_F(JsonClassLoadPlanTests, FindElement_UnknownName_ReturnsNull)
+    {
+        EXPECT_EQ(nullptr, GetPlan()->FindElement(AZ::Crc32("unknown")));
+    }
+
+    TEST_F(JsonClassLoadPlanTests, FindElement_ElementWithSerializer_SerializerIsResolved)
+    {
+        const AZ::JsonClassLoadPlan::Element* element = GetPlan()->FindElement(AZ::Crc32("value"));
+        ASSERT_NE(nullptr, element);
+        EXPECT_EQ(m_jsonRegistrationContext->GetSerializerForType(azrtti_typeid<int>()), element->m_serializer);
+        EXPECT_NE(nullptr, element->m_serializer);
+    }
+
+    TEST_F(JsonClassLoadPlanTests, FindElement_PointerElement_HasNoSerializer)
+    {
+        const AZ::JsonClassLoadPlan::Element* element = GetPlan()->FindElement(AZ::Crc32("child"));
+        ASSERT_NE(nullptr, element);
+        EXPECT_EQ(nullptr, element->m_serializer);
+    }
+
+    TEST_F(JsonClassLoadPlanTests, GetElementCount_ClassWithBaseClass_CountsElementsOfBothClasses)
+    {
+        EXPECT_EQ(4, GetPlan()->GetElementCount());
+    }
+
+    TEST_F(JsonClassLoadPlanTests, GetClassLoadPlan_ClassReflectedAgain_PlanIsRebuilt)
+    {
+        EXPECT_EQ(nullptr, GetPlan()->FindElement(AZ::Crc32("extra")));
+
+        LoadPlanDerived::Unreflect(*m_serializeContext);
+        LoadPlanDerived::Reflect(*m_serializeContext, true);
+
+        EXPECT_NE(nullptr, GetPlan()->FindElement(AZ::Crc32("extra")));
+        EXPECT_EQ(5, GetPlan()->GetElementCount());
+
+        LoadPlanDerived::Unreflect(*m_serializeContext);
+        LoadPlanDerived::Reflect(*m_serializeContext, false);
+    }
+
+    TEST_F(JsonClassLoadPlanTests, GetClassLoadPlan_PlanReplaced_HeldPlanStaysValid)
+    {
+        AZStd::shared_ptr<const AZ::JsonClassLoadPlan> heldPlan = GetPlan();
+
+        // A load on another thread could still be using the plan when it's rebuilt or the cache is cleared
+        LoadPlanDerived::Unreflect(*m_serializeContext);
+        LoadPlanDerived::Reflect(*m_serializeContext, true);
+        EXPECT_NE(heldPlan, GetPlan());
+
+        EXPECT_EQ(4, heldPlan->GetElementCount());
+        EXPECT_EQ(nullptr, heldPlan->FindElement(AZ::Crc32("extra")));
+
+        LoadPlanDerived::Unreflect(*m_serializeContext);
+        LoadPlanDerived::Reflect(*m_serializeContext, false);
+    }
+
+    TEST_F(JsonClassLoadPlanTests, Load_WithAndWithoutPlans_ObjectsAndResultsMatch)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        m_jsonDocument->Parse(R"({ "value": 42, "baseOnly": 2.5, "child": { "value": 7 }, "unknown": true })");
+
+        LoadPlanDerived withPlan;
+        m_deserializationSettings->m_useClassLoadPlans = true;
+        ResultCode withPlanResult = AZ::JsonSerialization::Load(withPlan, *m_jsonDocument, *m_deserializationSettings);
+
+        LoadPlanDerived withoutPlan;
+        m_deserializationSettings->m_useClassLoadPlans = false;
+        ResultCode withoutPlanResult = AZ::JsonSerialization::Load(withoutPlan, *m_jsonDocument, *m_deserializationSettings);
+
+        EXPECT_EQ(withoutPlanResult.GetOutcome(), withPlanResult.GetOutcome());
+        EXPECT_EQ(withoutPlanResult.GetProcessing(), withPlanResult.GetProcessing());
+        EXPECT_EQ(42, withPlan.m_derivedValue);
+        EXPECT_EQ(0, withPlan.m_baseValue);
+        EXPECT_FLOAT_EQ(2.5f, withPlan.m_baseOnly);
+        ASSERT_NE(nullptr, withPlan.m_child);
+        EXPECT_EQ(7, withPlan.m_child->m_baseValue);
+
+        EXPECT_EQ(withoutPlan.m_derivedValue, withPlan.m_derivedValue);
+        EXPECT_EQ(withoutPlan.m_baseValue, withPlan.m_baseValue);
+        EXPECT_FLOAT_EQ(withoutPlan.m_baseOnly, withPlan.m_baseOnly);
+        ASSERT_NE(nullptr, withoutPlan.m_child);
+        EXPECT_EQ(withoutPlan.m_child->m_baseValue, withPlan.m_child->m_baseValue);
+    }
+} // namespace JsonSerializationTests
+
+#if defined(HAVE_BENCHMARK)
+#include <AzCore/std/string/string.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    struct LoadPlanComponentBase
+    {
+        AZ_RTTI(LoadPlanComponentBase, "{9D3C2B71-5E4A-4F6B-A0C8-1B2E3D4F5A60}");
+        virtual ~LoadPlanComponentBase() = default;
+
+        AZ::u64 m_id = 0;
+    };
+
+    struct LoadPlanTransformComponent
+        : public LoadPlanComponentBase
+    {
+        AZ_RTTI(LoadPlanTransformComponent, "{2A4C6E80-1B3D-4F5A-8C7E-9D0B2A4C6E81}", LoadPlanComponentBase);
+
+        AZ::u64 m_parentId = 0;
+        float m_x = 0.0f;
+        float m_y = 0.0f;
+        float m_z = 0.0f;
+        float m_scale = 1.0f;
+        bool m_isStatic = false;
+    };
+
+    struct LoadPlanEntity
+    {
+        AZ_TYPE_INFO(LoadPlanEntity, "{7B9D1F23-4C6E-4A8B-9D0F-2E4A6C8E0B34}");
+
+        AZ::u64 m_id = 0;
+        AZStd::string m_name;
+        bool m_isRuntimeActive = true;
+        LoadPlanTransformComponent m_transform;
+    };
+
+    struct LoadPlanPrefab
+    {
+        AZ_TYPE_INFO(LoadPlanPrefab, "{C4E6A8B0-2D4F-4B6C-8E0A-3F5B7D9F1C45}");
+
+        AZStd::string m_source;
+        AZStd::vector<LoadPlanEntity> m_entities;
+    };
+
+    //! Loads a json document shaped like a prefab with 50000 entities.
+    class JsonClassLoadPlanBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr int EntityCount = 50000;
+
+        void internalSetUp()
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_jsonRegistrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            m_jsonSystemComponent = AZ::JsonSystemComponent::CreateDescriptor();
+            m_jsonSystemComponent->Reflect(m_serializeContext.get());
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            Reflect(*m_serializeContext);
+
+            m_document = AZStd::make_unique<rapidjson::Document>();
+            m_document->SetObject();
+            auto& allocator = m_document->GetAllocator();
+            rapidjson::Value entities(rapidjson::kArrayType);
+            for (int entityIndex = 0; entityIndex < EntityCount; ++entityIndex)
+            {
+                rapidjson::Value transform(rapidjson::kObjectType);
+                transform.AddMember("Id", entityIndex * 2 + 1, allocator);
+                transform.AddMember("Parent Id", entityIndex / 16, allocator);
+                transform.AddMember("X", static_cast<float>(entityIndex % 100), allocator);
+                transform.AddMember("Y", static_cast<float>(entityIndex / 100), allocator);
+                transform.AddMember("Z", 0.5f, allocator);
+                transform.AddMember("Scale", 1.0f, allocator);
+                transform.AddMember("Is Static", (entityIndex % 3) == 0, allocator);
+
+                rapidjson::Value entity(rapidjson::kObjectType);
+                entity.AddMember("Id", entityIndex * 2, allocator);
+                entity.AddMember("Name", rapidjson::Value(AZStd::string::format("Entity_%d", entityIndex).c_str(), allocator), allocator);
+                entity.AddMember("IsRuntimeActive", true, allocator);
+                entity.AddMember("Transform", transform, allocator);
+                entities.PushBack(entity, allocator);
+            }
+            m_document->AddMember("Source", "Prefabs/Benchmark.prefab", allocator);
+            m_document->AddMember("Entities", entities, allocator);
+
+            m_settings.m_serializeContext = m_serializeContext.get();
+            m_settings.m_registrationContext = m_jsonRegistrationContext.get();
+        }
+
+        void internalTearDown()
+        {
+            m_document.reset();
+
+            m_serializeContext->EnableRemoveReflection();
+            m_jsonRegistrationContext->EnableRemoveReflection();
+            Reflect(*m_serializeContext);
+            m_jsonSystemComponent->Reflect(m_serializeContext.get());
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            m_jsonRegistrationContext->DisableRemoveReflection();
+            m_serializeContext->DisableRemoveReflection();
+            delete m_jsonSystemComponent;
+            m_jsonSystemComponent = nullptr;
+
+            m_jsonRegistrationContext.reset();
+            m_serializeContext.reset();
+        }
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<LoadPlanComponentBase>()
+                ->Field("Id", &LoadPlanComponentBase::m_id);
+            context.Class<LoadPlanTransformComponent, LoadPlanComponentBase>()
+                ->Field("Parent Id", &LoadPlanTransformComponent::m_parentId)
+                ->Field("X", &LoadPlanTransformComponent::m_x)
+                ->Field("Y", &LoadPlanTransformComponent::m_y)
+                ->Field("Z", &LoadPlanTransformComponent::m_z)
+                ->Field("Scale", &LoadPlanTransformComponent::m_scale)
+                ->Field("Is Static", &LoadPlanTransformComponent::m_isStatic);
+            context.Class<LoadPlanEntity>()
+                ->Field("Id", &LoadPlanEntity::m_id)
+                ->Field("Name", &LoadPlanEntity::m_name)
+                ->Field("IsRuntimeActive", &LoadPlanEntity::m_isRuntimeActive)
+                ->Field("Transform", &LoadPlanEntity::m_transform);
+            context.Class<LoadPlanPrefab>()
+                ->Field("Source", &LoadPlanPrefab::m_source)
+                ->Field("Entities", &LoadPlanPrefab::m_entities);
+        }
+
+        void Load(::benchmark::State& state, bool useClassLoadPlans)
+        {
+            m_settings.m_useClassLoadPlans = useClassLoadPlans;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                LoadPlanPrefab prefab;
+                AZ::JsonSerializationResult::ResultCode result = AZ::JsonSerialization::Load(prefab, *m_document, m_settings);
+                benchmark::DoNotOptimize(result);
+                benchmark::DoNotOptimize(prefab.m_entities.data());
+            }
+            state.SetItemsProcessed(state.iterations() * EntityCount);
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_jsonRegistrationContext;
+        AZ::ComponentDescriptor* m_jsonSystemComponent = nullptr;
+        AZStd::unique_ptr<rapidjson::Document> m_document;
+        AZ::JsonDeserializerSettings m_settings;
+    };
+
+    // Previous behavior, the class data of a class and its base classes is searched for every member
+    BENCHMARK_DEFINE_F(JsonClassLoadPlanBenchmark, LoadPrefab_ClassDataSearch)(::benchmark::State& state)
+    {
+        Load(state, false);
+    }
+    BENCHMARK_REGISTER_F(JsonClassLoadPlanBenchmark, LoadPrefab_ClassDataSearch)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(JsonClassLoadPlanBenchmark, LoadPrefab_ClassLoadPlans)(::benchmark::State& state)
+    {
+        Load(state, true);
+    }
+    BENCHMARK_REGISTER_F(JsonClassLoadPlanBenchmark, LoadPrefab_ClassLoadPlans)
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
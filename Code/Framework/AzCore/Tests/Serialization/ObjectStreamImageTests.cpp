@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/AssetDataStream.h>
+#include <AzCore/Asset/ObjectStreamImageAssetData.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/ObjectStreamImage.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <Tests/SerializeContextFixture.h>
+
+namespace UnitTest
+{
+    struct ImageMaterial
+    {
+        AZ_TYPE_INFO(ImageMaterial, "{5B0E3C9A-7F21-4D6B-8A4E-1C9D2F7B3E60}");
+
+        float m_friction = 0.5f;
+        float m_restitution = 0.0f;
+        AZ::u32 m_flags = 0;
+    };
+
+    struct ImageTile
+    {
+        AZ_TYPE_INFO(ImageTile, "{C2A8F4E1-3D7B-4B59-9E06-8F1A5C3D7B24}");
+
+        AZStd::array<float, 16> m_heights{};
+        ImageMaterial* m_material = nullptr;
+        ImageTile* m_next = nullptr;
+    };
+
+    struct ImageTerrain
+    {
+        AZ_TYPE_INFO(ImageTerrain, "{8E4D2B6F-1A3C-4E7D-B5F9-2C6A8E0D4B17}");
+
+        AZ::u32 m_tileCount = 0;
+        ImageTile* m_firstTile = nullptr;
+        ImageMaterial* m_defaultMaterial = nullptr;
+    };
+
+    struct ImageUnsupported
+    {
+        AZ_TYPE_INFO(ImageUnsupported, "{1F7C3A5E-9B2D-4C8A-A6E0-3D5B7F9C1E48}");
+
+        AZStd::vector<float> m_values;
+    };
+
+    class ImageTerrainAsset
+        : public AZ::Data::ObjectStreamImageAssetData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ImageTerrainAsset, AZ::SystemAllocator, 0);
+        AZ_RTTI(ImageTerrainAsset, "{4A6C8E0B-2D4F-4B6A-9C8E-0B2D4F6A8C13}", AZ::Data::ObjectStreamImageAssetData);
+
+        ImageTerrainAsset()
+            : AZ::Data::ObjectStreamImageAssetData(azrtti_typeid<ImageTerrain>())
+        {
+        }
+    };
+
+    class ObjectStreamImageTests
+        : public SerializeContextFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SerializeContextFixture::SetUp();
+            Reflect(*m_serializeContext, false);
+
+            for (size_t tileIndex = 0; tileIndex < m_tiles.size(); ++tileIndex)
+            {
+                ImageTile& tile = m_tiles[tileIndex];
+                for (size_t heightIndex = 0; heightIndex < tile.m_heights.size(); ++heightIndex)
+                {
+                    tile.m_heights[heightIndex] = static_cast<float>(tileIndex * 100 + heightIndex);
+                }
+                tile.m_next = tileIndex + 1 < m_tiles.size() ? &m_tiles[tileIndex + 1] : nullptr;
+            }
+            m_materials[0].m_friction = 0.8f;
+            m_materials[1].m_restitution = 0.25f;
+            m_materials[1].m_flags = 7;
+            // Two tiles share a material and the last tile has none
+            m_tiles[0].m_material = &m_materials[0];
+            m_tiles[1].m_material = &m_materials[1];
+            m_tiles[2].m_material = &m_materials[0];
+
+            m_terrain.m_tileCount = static_cast<AZ::u32>(m_tiles.size());
+            m_terrain.m_firstTile = &m_tiles[0];
+            m_terrain.m_defaultMaterial = &m_materials[1];
+        }
+
+        static void Reflect(AZ::SerializeContext& context, bool withExtraField)
+        {
+            AZ::SerializeContext::ClassBuilder materialBuilder = context.Class<ImageMaterial>();
+            materialBuilder
+                ->Attribute(AZ::SerializeContextAttributes::ObjectStreamImageLayout, AZ::ObjectStreamImage::Layout::Create<ImageMaterial>())
+                ->Field("Friction", &ImageMaterial::m_friction)
+                ->Field("Restitution", &ImageMaterial::m_restitution);
+            if (withExtraField)
+            {
+                materialBuilder->Field("Flags", &ImageMaterial::m_flags);
+            }
+            context.Class<ImageTile>()
+                ->Attribute(AZ::SerializeContextAttributes::ObjectStreamImageLayout, AZ::ObjectStreamImage::Layout::Create<ImageTile>())
+                ->Field("Heights", &ImageTile::m_heights)
+                ->Field("Material", &ImageTile::m_material)
+                ->Field("Next", &ImageTile::m_next);
+            context.Class<ImageTerrain>()
+                ->Attribute(AZ::SerializeContextAttributes::ObjectStreamImageLayout, AZ::ObjectStreamImage::Layout::Create<ImageTerrain>())
+                ->Field("TileCount", &ImageTerrain::m_tileCount)
+                ->Field("FirstTile", &ImageTerrain::m_firstTile)
+                ->Field("DefaultMaterial", &ImageTerrain::m_defaultMaterial);
+            context.Class<ImageUnsupported>()
+                ->Field("Values", &ImageUnsupported::m_values);
+        }
+
+        void SaveTerrain()
+        {
+            m_buffer.clear();
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+            ASSERT_TRUE(AZ::ObjectStreamImage::Save(stream, m_terrain, *m_serializeContext));
+        }
+
+        bool IsInImage(const AZ::ObjectStreamImage& image, const void* object) const
+        {
+            const char* imageStart = reinterpret_cast<const char*>(image.GetRoot());
+            const char* address = reinterpret_cast<const char*>(object);
+            return address >= imageStart && address < imageStart + image.GetImageSize();
+        }
+
+        void ExpectTerrainEq(const AZ::ObjectStreamImage& image, const ImageTerrain* terrain)
+        {
+            ASSERT_NE(nullptr, terrain);
+            EXPECT_EQ(m_terrain.m_tileCount, terrain->m_tileCount);
+            ASSERT_NE(nullptr, terrain->m_defaultMaterial);
+            EXPECT_TRUE(IsInImage(image, terrain->m_defaultMaterial));
+            EXPECT_FLOAT_EQ(0.25f, terrain->m_defaultMaterial->m_restitution);
+
+            const ImageTile* tile = terrain->m_firstTile;
+            for (const ImageTile& expectedTile : m_tiles)
+            {
+                ASSERT_NE(nullptr, tile);
+                EXPECT_TRUE(IsInImage(image, tile));
+                EXPECT_EQ(expectedTile.m_heights, tile->m_heights);
+                if (expectedTile.m_material)
+                {
+                    ASSERT_NE(nullptr, tile->m_material);
+                    EXPECT_TRUE(IsInImage(image, tile->m_material));
+                    EXPECT_FLOAT_EQ(expectedTile.m_material->m_friction, tile->m_material->m_friction);
+                    EXPECT_FLOAT_EQ(expectedTile.m_material->m_restitution, tile->m_material->m_restitution);
+                }
+                else
+                {
+                    EXPECT_EQ(nullptr, tile->m_material);
+                }
+                tile = tile->m_next;
+            }
+            EXPECT_EQ(nullptr, tile);
+        }
+
+        AZStd::array<ImageMaterial, 2> m_materials;
+        AZStd::array<ImageTile, 4> m_tiles;
+        ImageTerrain m_terrain;
+        AZStd::vector<char> m_buffer;
+    };
+
+    TEST_F(ObjectStreamImageTests, IsSupported_ClassesWithLayout_ReturnsTrue)
+    {
+        EXPECT_TRUE(AZ::ObjectStreamImage::IsSupported(*m_serializeContext, azrtti_typeid<ImageTerrain>()));
+        EXPECT_TRUE(AZ::ObjectStreamImage::IsSupported(*m_serializeContext, azrtti_typeid<ImageMaterial>()));
+    }
+
+    TEST_F(ObjectStreamImageTests, IsSupported_ClassWithoutLayout_ReturnsFalse)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(AZ::ObjectStreamImage::IsSupported(*m_serializeContext, azrtti_typeid<ImageUnsupported>()));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    }
+
+    TEST_F(ObjectStreamImageTests, Save_ClassWithoutLayout_Fails)
+    {
+        ImageUnsupported unsupported;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(AZ::ObjectStreamImage::Save(stream, unsupported, *m_serializeContext));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    }
+
+    TEST_F(ObjectStreamImageTests, Load_SavedImage_ObjectsAndPointersMatch)
+    {
+        SaveTerrain();
+
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+        AZ::ObjectStreamImage image;
+        ASSERT_TRUE(image.Load(stream, *m_serializeContext, azrtti_typeid<ImageTerrain>()));
+        ExpectTerrainEq(image, image.GetRoot<ImageTerrain>());
+    }
+
+    TEST_F(ObjectStreamImageTests, Load_SharedPointee_IsStoredOnce)
+    {
+        SaveTerrain();
+
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+        AZ::ObjectStreamImage image;
+        ASSERT_TRUE(image.Load(stream, *m_serializeContext));
+        const ImageTerrain* terrain = image.GetRoot<ImageTerrain>();
+        ASSERT_NE(nullptr, terrain);
+        const ImageTile* firstTile = terrain->m_firstTile;
+        const ImageTile* thirdTile = firstTile->m_next->m_next;
+        EXPECT_EQ(firstTile->m_material, thirdTile->m_material);
+        EXPECT_NE(firstTile->m_material, terrain->m_defaultMaterial);
+        EXPECT_EQ(firstTile->m_next->m_material, terrain->m_defaultMaterial);
+    }
+
+    TEST_F(ObjectStreamImageTests, GetRoot_DifferentType_ReturnsNull)
+    {
+        SaveTerrain();
+
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+        AZ::ObjectStreamImage image;
+        ASSERT_TRUE(image.Load(stream, *m_serializeContext));
+        EXPECT_EQ(nullptr, image.GetRoot<ImageTile>());
+    }
+
+    TEST_F(ObjectStreamImageTests, Load_DifferentExpectedType_Fails)
+    {
+        SaveTerrain();
+
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+        AZ::ObjectStreamImage image;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(image.Load(stream, *m_serializeContext, azrtti_typeid<ImageTile>()));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        EXPECT_FALSE(image.IsLoaded());
+    }
+
+    TEST_F(ObjectStreamImageTests, Load_LayoutChangedSinceSave_Fails)
+    {
+        SaveTerrain();
+
+        m_serializeContext->EnableRemoveReflection();
+        Reflect(*m_serializeContext, false);
+        m_serializeContext->DisableRemoveReflection();
+        Reflect(*m_serializeContext, true);
+
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+        AZ::ObjectStreamImage image;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(image.Load(stream, *m_serializeContext));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    }
+
+    TEST_F(ObjectStreamImageTests, Load_TruncatedImage_Fails)
+    {
+        SaveTerrain();
+        m_buffer.resize(m_buffer.size() - sizeof(AZ::u64));
+
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+        AZ::ObjectStreamImage image;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(image.Load(stream, *m_serializeContext));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    }
+
+    TEST_F(ObjectStreamImageTests, Load_OverflowingRelocationCount_Fails)
+    {
+        SaveTerrain();
+        // The relocation count is the second to last u64 of the 64 byte header, this count wraps the size of the table to 0
+        const AZ::u64 overflowingRelocationCount = AZ::u64(1) << 61;
+        memcpy(m_buffer.data() + 48, &overflowingRelocationCount, sizeof(overflowingRelocationCount));
+
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+        AZ::ObjectStreamImage image;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(image.Load(stream, *m_serializeContext));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+
+        void* memory = azmalloc(m_buffer.size(), 64);
+        memcpy(memory, m_buffer.data(), m_buffer.size());
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(image.LoadInPlace(memory, m_buffer.size(), *m_serializeContext));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        azfree(memory);
+    }
+
+    TEST_F(ObjectStreamImageTests, Load_RelocationOutsideOfImage_Fails)
+    {
+        SaveTerrain();
+        // The relocation table is at the end of the file
+        const AZ::u64 invalidRelocation = AZ::u64(1) << 40;
+        memcpy(m_buffer.data() + m_buffer.size() - sizeof(invalidRelocation), &invalidRelocation, sizeof(invalidRelocation));
+
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+        AZ::ObjectStreamImage image;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(image.Load(stream, *m_serializeContext));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    }
+
+    TEST_F(ObjectStreamImageTests, LoadInPlace_AlignedMemory_ObjectsAreUsedFromTheMemory)
+    {
+        SaveTerrain();
+
+        void* memory = azmalloc(m_buffer.size(), 64);
+        memcpy(memory, m_buffer.data(), m_buffer.size());
+        EXPECT_TRUE(AZ::ObjectStreamImage::IsImage(memory, m_buffer.size()));
+
+        {
+            AZ::ObjectStreamImage image;
+            ASSERT_TRUE(image.LoadInPlace(memory, m_buffer.size(), *m_serializeContext));
+            EXPECT_EQ(reinterpret_cast<char*>(memory) + 64, image.GetRoot());
+            ExpectTerrainEq(image, image.GetRoot<ImageTerrain>());
+        }
+
+        azfree(memory);
+    }
+
+    TEST_F(ObjectStreamImageTests, Write_LoadedImage_LoadsAgain)
+    {
+        SaveTerrain();
+
+        AZ::ObjectStreamImage image;
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+            ASSERT_TRUE(image.Load(stream, *m_serializeContext));
+        }
+
+        AZStd::vector<char> writtenBuffer;
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&writtenBuffer);
+            ASSERT_TRUE(image.Write(stream));
+        }
+        EXPECT_EQ(m_buffer, writtenBuffer);
+
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&writtenBuffer);
+        AZ::ObjectStreamImage reloadedImage;
+        ASSERT_TRUE(reloadedImage.Load(stream, *m_serializeContext));
+        ExpectTerrainEq(reloadedImage, reloadedImage.GetRoot<ImageTerrain>());
+    }
+
+    TEST_F(ObjectStreamImageTests, LoadObjectStreamImage_AssetDataStream_AssetUsesImage)
+    {
+        SaveTerrain();
+
+        AZ::Data::AssetDataStream::VectorDataSource data(m_buffer.begin(), m_buffer.end());
+        AZ::Data::AssetDataStream stream;
+        stream.Open(AZStd::move(data));
+
+        ImageTerrainAsset asset;
+        ASSERT_TRUE(asset.LoadObjectStreamImage(stream, *m_serializeContext));
+        ExpectTerrainEq(asset.GetImage(), asset.GetRoot<ImageTerrain>());
+        stream.Close();
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+#include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/Serialization/Utils.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    struct ImageNavTile
+    {
+        AZ_TYPE_INFO(ImageNavTile, "{6D8F0A2C-4E6B-4D8F-A1C3-5E7A9C1E3A59}");
+
+        AZStd::array<float, 4096> m_heights{};
+        AZStd::array<AZ::u32, 1024> m_areaFlags{};
+        ImageNavTile* m_next = nullptr;
+    };
+
+    struct ImageNavMesh
+    {
+        AZ_TYPE_INFO(ImageNavMesh, "{0C2E4A6C-8E0A-4C2E-B4A6-C8E0A2C4E6B1}");
+
+        AZ::u32 m_tileCount = 0;
+        ImageNavTile* m_firstTile = nullptr;
+    };
+
+    //! Loads a nav mesh of 64 tiles of plain data, as a binary ObjectStream and as an ObjectStreamImage.
+    class ObjectStreamImageBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t TileCount = 64;
+
+        void internalSetUp()
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_serializeContext->Class<ImageNavTile>()
+                ->Attribute(AZ::SerializeContextAttributes::ObjectStreamImageLayout, AZ::ObjectStreamImage::Layout::Create<ImageNavTile>())
+                ->Field("Heights", &ImageNavTile::m_heights)
+                ->Field("AreaFlags", &ImageNavTile::m_areaFlags)
+                ->Field("Next", &ImageNavTile::m_next);
+            m_serializeContext->Class<ImageNavMesh>()
+                ->Attribute(AZ::SerializeContextAttributes::ObjectStreamImageLayout, AZ::ObjectStreamImage::Layout::Create<ImageNavMesh>())
+                ->Field("TileCount", &ImageNavMesh::m_tileCount)
+                ->Field("FirstTile", &ImageNavMesh::m_firstTile);
+
+            m_tiles.resize(TileCount);
+            for (size_t tileIndex = 0; tileIndex < TileCount; ++tileIndex)
+            {
+                ImageNavTile& tile = m_tiles[tileIndex];
+                for (size_t heightIndex = 0; heightIndex < tile.m_heights.size(); ++heightIndex)
+                {
+                    tile.m_heights[heightIndex] = static_cast<float>(heightIndex % 97) * 0.25f;
+                }
+                for (size_t flagIndex = 0; flagIndex < tile.m_areaFlags.size(); ++flagIndex)
+                {
+                    tile.m_areaFlags[flagIndex] = static_cast<AZ::u32>(flagIndex * tileIndex);
+                }
+                tile.m_next = tileIndex + 1 < TileCount ? &m_tiles[tileIndex + 1] : nullptr;
+            }
+            ImageNavMesh navMesh;
+            navMesh.m_tileCount = static_cast<AZ::u32>(TileCount);
+            navMesh.m_firstTile = m_tiles.data();
+
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> objectStream(&m_objectStreamBuffer);
+            AZ::Utils::SaveObjectToStream(objectStream, AZ::ObjectStream::ST_BINARY, &navMesh, m_serializeContext.get());
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> imageStream(&m_imageBuffer);
+            AZ::ObjectStreamImage::Save(imageStream, navMesh, *m_serializeContext);
+        }
+
+        void internalTearDown()
+        {
+            m_objectStreamBuffer = {};
+            m_imageBuffer = {};
+            m_tiles = {};
+            m_serializeContext.reset();
+        }
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::vector<ImageNavTile> m_tiles;
+        AZStd::vector<char> m_objectStreamBuffer;
+        AZStd::vector<char> m_imageBuffer;
+    };
+
+    BENCHMARK_DEFINE_F(ObjectStreamImageBenchmark, LoadNavMesh_ObjectStream)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_objectStreamBuffer);
+            ImageNavMesh* navMesh = AZ::Utils::LoadObjectFromStream<ImageNavMesh>(stream, m_serializeContext.get());
+            benchmark::DoNotOptimize(navMesh);
+
+            // The objects were created by the factories of their classes, so they're destroyed by them as well
+            state.PauseTiming();
+            AZ::SerializeContext::IObjectFactory* tileFactory = m_serializeContext->FindClassData(azrtti_typeid<ImageNavTile>())->m_factory;
+            for (ImageNavTile* tile = navMesh ? navMesh->m_firstTile : nullptr; tile;)
+            {
+                ImageNavTile* next = tile->m_next;
+                tileFactory->Destroy(tile);
+                tile = next;
+            }
+            if (navMesh)
+            {
+                m_serializeContext->FindClassData(azrtti_typeid<ImageNavMesh>())->m_factory->Destroy(navMesh);
+            }
+            state.ResumeTiming();
+        }
+        state.SetBytesProcessed(state.iterations() * m_objectStreamBuffer.size());
+    }
+    BENCHMARK_REGISTER_F(ObjectStreamImageBenchmark, LoadNavMesh_ObjectStream)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(ObjectStreamImageBenchmark, LoadNavMesh_ObjectStreamImage)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_imageBuffer);
+            AZ::ObjectStreamImage image;
+            image.Load(stream, *m_serializeContext);
+            benchmark::DoNotOptimize(image.GetRoot());
+        }
+        state.SetBytesProcessed(state.iterations() * m_imageBuffer.size());
+    }
+    BENCHMARK_REGISTER_F(ObjectStreamImageBenchmark, LoadNavMesh_ObjectStreamImage)
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -704,6 +704,155 @@ tags=tools,renderer,metal)"
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType("/AnchorPath/Of/Settings"));
     }
 
+    class SettingsRegistryMergedSnapshotFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+    {
+    public:
+        static constexpr AZStd::string_view Platform = "TestPlatform";
+
+        void SetUp() override
+        {
+            const auto tempRootFolder = AZ::IO::FixedMaxPath(m_testFolder.GetDirectory());
+            m_snapshotPath = tempRootFolder / "Cache" / "SettingsRegistry" / "test";
+            m_snapshotPath.ReplaceExtension(AZ::IO::PathView(AZ::SettingsRegistryMergeUtils::MergedSnapshotExtension));
+            m_specializations.Append("test");
+
+            ASSERT_TRUE(CreateTestFile(tempRootFolder / "engine" / "Registry" / "engine.setreg",
+                R"({ "Engine": { "Value": 1, "Name": "engine" } })"));
+            ASSERT_TRUE(CreateTestFile(tempRootFolder / "gem" / "Registry" / "gem.setreg",
+                R"({ "Gem": { "Value": "gem" } })"));
+            ASSERT_TRUE(CreateTestFile(tempRootFolder / "project" / "Registry" / "project.setreg",
+                R"({ "Engine": { "Value": 2 } })"));
+            ASSERT_TRUE(CreateTestFile(tempRootFolder / "project" / "Registry" / "removal.setregpatch",
+                R"([ { "op": "remove", "path": "/Seeded/Removed" } ])"));
+        }
+
+        //! Sets the keys which the engine, gem and project registry merges rely on, like the earlier merges of an application would.
+        void SeedRegistry(AZ::SettingsRegistryInterface& registry)
+        {
+            const auto tempRootFolder = AZ::IO::FixedMaxPath(m_testFolder.GetDirectory());
+            registry.Set(AZ::SettingsRegistryMergeUtils::FilePathKey_EngineRootFolder, (tempRootFolder / "engine").Native());
+            registry.Set(AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectPath, (tempRootFolder / "project").Native());
+            registry.MergeSettings(R"({ "O3DE": { "Gems": { "TestGem": {} } } })", AZ::SettingsRegistryInterface::Format::JsonMergePatch);
+            registry.Set(AZStd::string::format("%s/TestGem/Path", AZ::SettingsRegistryMergeUtils::ManifestGemsRootKey),
+                (tempRootFolder / "gem").Native());
+            registry.Set("/Seeded/Kept", true);
+            registry.Set("/Seeded/Removed", true);
+        }
+
+        //! Merges the registries of a new process into a new registry.
+        bool MergeRegistries(AZ::SettingsRegistryImpl& registry)
+        {
+            SeedRegistry(registry);
+            return AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineGemProjectRegistries(registry, Platform,
+                m_specializations, m_snapshotPath.Native());
+        }
+
+        static void ExpectMergedSettings(AZ::SettingsRegistryImpl& registry)
+        {
+            AZ::s64 engineValue{};
+            EXPECT_TRUE(registry.Get(engineValue, "/Engine/Value"));
+            EXPECT_EQ(2, engineValue);
+            AZ::SettingsRegistryInterface::FixedValueString stringValue;
+            EXPECT_TRUE(registry.Get(stringValue, "/Engine/Name"));
+            EXPECT_STREQ("engine", stringValue.c_str());
+            EXPECT_TRUE(registry.Get(stringValue, "/Gem/Value"));
+            EXPECT_STREQ("gem", stringValue.c_str());
+            bool keptValue{};
+            EXPECT_TRUE(registry.Get(keptValue, "/Seeded/Kept"));
+            EXPECT_TRUE(keptValue);
+            EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, registry.GetType("/Seeded/Removed"));
+        }
+
+    protected:
+        AZ::Test::ScopedAutoTempDirectory m_testFolder;
+        AZ::IO::FixedMaxPath m_snapshotPath;
+        AZ::SettingsRegistryInterface::Specializations m_specializations;
+    };
+
+    TEST_F(SettingsRegistryMergedSnapshotFixture, EngineGemProjectRegistries_SecondMerge_UsesSnapshotWithSameSettings)
+    {
+        AZ::SettingsRegistryImpl firstRegistry;
+        EXPECT_FALSE(MergeRegistries(firstRegistry));
+        EXPECT_TRUE(AZ::IO::SystemFile::Exists(m_snapshotPath.c_str()));
+        ExpectMergedSettings(firstRegistry);
+
+        AZ::SettingsRegistryImpl secondRegistry;
+        EXPECT_TRUE(MergeRegistries(secondRegistry));
+        ExpectMergedSettings(secondRegistry);
+    }
+
+    TEST_F(SettingsRegistryMergedSnapshotFixture, EngineGemProjectRegistries_RegistryFolderChanged_MergesFoldersAgain)
+    {
+        AZ::SettingsRegistryImpl firstRegistry;
+        EXPECT_FALSE(MergeRegistries(firstRegistry));
+
+        // Adding a file to a gem registry folder makes the snapshot stale
+        const auto gemRegistryFolder = AZ::IO::FixedMaxPath(m_testFolder.GetDirectory()) / "gem" / "Registry";
+        ASSERT_TRUE(CreateTestFile(gemRegistryFolder / "added.setreg", R"({ "Gem": { "Added": true } })"));
+
+        AZ::SettingsRegistryImpl secondRegistry;
+        EXPECT_FALSE(MergeRegistries(secondRegistry));
+        ExpectMergedSettings(secondRegistry);
+        bool addedValue{};
+        EXPECT_TRUE(secondRegistry.Get(addedValue, "/Gem/Added"));
+        EXPECT_TRUE(addedValue);
+
+        // The second merge wrote a snapshot with the added file
+        AZ::SettingsRegistryImpl thirdRegistry;
+        EXPECT_TRUE(MergeRegistries(thirdRegistry));
+        addedValue = false;
+        EXPECT_TRUE(thirdRegistry.Get(addedValue, "/Gem/Added"));
+        EXPECT_TRUE(addedValue);
+    }
+
+    TEST_F(SettingsRegistryMergedSnapshotFixture, MergedSnapshot_OtherSpecializations_IsNotMerged)
+    {
+        AZ::SettingsRegistryImpl firstRegistry;
+        EXPECT_FALSE(MergeRegistries(firstRegistry));
+
+        AZ::SettingsRegistryInterface::Specializations otherSpecializations;
+        otherSpecializations.Append("other");
+        AZ::SettingsRegistryImpl secondRegistry;
+        SeedRegistry(secondRegistry);
+        EXPECT_FALSE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_MergedSnapshot(secondRegistry, m_snapshotPath.Native(),
+            Platform, otherSpecializations));
+        EXPECT_FALSE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_MergedSnapshot(secondRegistry, m_snapshotPath.Native(),
+            "OtherPlatform", m_specializations));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, secondRegistry.GetType("/Engine"));
+    }
+
+    TEST_F(SettingsRegistryMergedSnapshotFixture, EngineGemProjectRegistries_OtherSettingsBeforeMerge_MergesFoldersAgain)
+    {
+        // The engine name is already set in the first process, so the changes the folders make don't include it
+        AZ::SettingsRegistryImpl firstRegistry;
+        firstRegistry.Set("/Engine/Name", "engine");
+        EXPECT_FALSE(MergeRegistries(firstRegistry));
+        ExpectMergedSettings(firstRegistry);
+
+        AZ::SettingsRegistryImpl secondRegistry;
+        EXPECT_FALSE(MergeRegistries(secondRegistry));
+        ExpectMergedSettings(secondRegistry);
+    }
+
+    TEST_F(SettingsRegistryMergedSnapshotFixture, EngineGemProjectRegistries_OnlyCommandLineDiffers_UsesSnapshot)
+    {
+        // Like the asset builders, which are each launched with an id of their own
+        AZ::SettingsRegistryImpl firstRegistry;
+        AZ::CommandLine firstCommandLine;
+        firstCommandLine.Parse({ "builder", "-id=first" });
+        AZ::SettingsRegistryMergeUtils::StoreCommandLineToRegistry(firstRegistry, firstCommandLine);
+        EXPECT_FALSE(MergeRegistries(firstRegistry));
+        ExpectMergedSettings(firstRegistry);
+
+        AZ::SettingsRegistryImpl secondRegistry;
+        AZ::CommandLine secondCommandLine;
+        secondCommandLine.Parse({ "builder", "-id=second" });
+        AZ::SettingsRegistryMergeUtils::StoreCommandLineToRegistry(secondRegistry, secondCommandLine);
+        EXPECT_TRUE(MergeRegistries(secondRegistry));
+        ExpectMergedSettings(secondRegistry);
+    }
+
     using SettingsRegistryAncestorDescendantOrEqualPathFixture = SettingsRegistryMergeUtilsCommandLineFixture;
 
     TEST_F(SettingsRegistryAncestorDescendantOrEqualPathFixture, ValidateThatAncestorOrDescendantOrPathWithTheSameValue_Succeeds)
@@ -713,4 +862,126 @@ tags=tools,renderer,metal)"
         EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::IsPathAncestorDescendantOrEqual("/Amazon/AzCore/Bootstrap", "/Amazon/AzCore/Bootstrap/project_path"));
         EXPECT_FALSE(AZ::SettingsRegistryMergeUtils::IsPathAncestorDescendantOrEqual("/Amazon/AzCore/Bootstrap", "/Amazon/Project/Settings/project_name"));
     }
+
+#if defined(HAVE_BENCHMARK)
+    //! Measures the part of the time to first tick spent merging the engine, gem and project registries, with and without
+    //! a merged snapshot. The range is the number of active gems, each with a registry folder of several .setreg files.
+    class SettingsRegistryMergedSnapshotBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr AZStd::string_view Platform = "TestPlatform";
+        static constexpr int FilesPerGem = 4;
+
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            m_testFolder = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            m_gemCount = aznumeric_cast<int>(state.range(0));
+            const auto tempRootFolder = AZ::IO::FixedMaxPath(m_testFolder->GetDirectory());
+            m_snapshotPath = tempRootFolder / "Cache" / "SettingsRegistry" / "benchmark";
+            m_snapshotPath.ReplaceExtension(AZ::IO::PathView(AZ::SettingsRegistryMergeUtils::MergedSnapshotExtension));
+            m_specializations.Append("benchmark");
+
+            CreateTestFile(tempRootFolder / "engine" / "Registry" / "engine.setreg", R"({ "Engine": { "Value": 1 } })");
+            CreateTestFile(tempRootFolder / "project" / "Registry" / "project.setreg", R"({ "Engine": { "Value": 2 } })");
+            for (int gem = 0; gem < m_gemCount; ++gem)
+            {
+                for (int file = 0; file < FilesPerGem; ++file)
+                {
+                    CreateTestFile(tempRootFolder / AZStd::string::format("gem%d", gem) / "Registry" / AZStd::string::format("gem%d.setreg", file),
+                        AZStd::string::format(R"({ "Gems": { "Gem%d": { "Setting%d": { "Value": %d, "Name": "gem%d" } } } })",
+                            gem, file, file, gem));
+                }
+            }
+
+            // Writes the snapshot that the benchmark merges
+            AZ::SettingsRegistryImpl registry;
+            SeedRegistry(registry);
+            AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineGemProjectRegistries(registry, Platform, m_specializations,
+                m_snapshotPath.Native());
+        }
+
+        void internalTearDown()
+        {
+            m_specializations = {};
+            m_testFolder.reset();
+        }
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Sets the keys which the engine, gem and project registry merges rely on, like the earlier merges of an application would.
+        void SeedRegistry(AZ::SettingsRegistryInterface& registry) const
+        {
+            const auto tempRootFolder = AZ::IO::FixedMaxPath(m_testFolder->GetDirectory());
+            registry.Set(AZ::SettingsRegistryMergeUtils::FilePathKey_EngineRootFolder, (tempRootFolder / "engine").Native());
+            registry.Set(AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectPath, (tempRootFolder / "project").Native());
+            for (int gem = 0; gem < m_gemCount; ++gem)
+            {
+                registry.MergeSettings(AZStd::string::format(R"({ "O3DE": { "Gems": { "Gem%d": {} } } })", gem),
+                    AZ::SettingsRegistryInterface::Format::JsonMergePatch);
+                registry.Set(AZStd::string::format("%s/Gem%d/Path", AZ::SettingsRegistryMergeUtils::ManifestGemsRootKey, gem),
+                    (tempRootFolder / AZStd::string::format("gem%d", gem)).Native());
+            }
+        }
+
+        //! Merges the registries into a new registry the way a new process would, only timing the merge itself.
+        void MergeRegistries(benchmark::State& state, AZStd::string_view snapshotPath)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                auto registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+                SeedRegistry(*registry);
+                state.ResumeTiming();
+
+                benchmark::DoNotOptimize(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineGemProjectRegistries(
+                    *registry, Platform, m_specializations, snapshotPath));
+
+                state.PauseTiming();
+                registry.reset();
+                state.ResumeTiming();
+            }
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_testFolder;
+        AZ::IO::FixedMaxPath m_snapshotPath;
+        AZ::SettingsRegistryInterface::Specializations m_specializations;
+        int m_gemCount = 0;
+    };
+
+    BENCHMARK_DEFINE_F(SettingsRegistryMergedSnapshotBenchmark, MergeRegistryFolders)(benchmark::State& state)
+    {
+        MergeRegistries(state, {});
+    }
+    BENCHMARK_REGISTER_F(SettingsRegistryMergedSnapshotBenchmark, MergeRegistryFolders)
+        ->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SettingsRegistryMergedSnapshotBenchmark, MergeSnapshot)(benchmark::State& state)
+    {
+        MergeRegistries(state, m_snapshotPath.Native());
+    }
+    BENCHMARK_REGISTER_F(SettingsRegistryMergedSnapshotBenchmark, MergeSnapshot)
+        ->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+#endif // HAVE_BENCHMARK
 }
@@ -14,6 +14,8 @@
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -534,6 +536,163 @@ namespace SettingsRegistryTests
         EXPECT_TRUE(this->m_registry->Visit(visitor, "/Test"));
     }
 
+    //
+    // Key handles and snapshots
+    //
+
+    TEST_F(SettingsRegistryTest, GetWithKeyHandle_ValueChangesAfterReads_ReturnsLatestValue)
+    {
+        const AZ::SettingsRegistryInterface::KeyHandle key("/Test/Value");
+        ASSERT_TRUE(m_registry->Set("/Test/Value", AZ::s64{ 1 }));
+
+        // Read enough times for the registry to publish a snapshot and the key to cache its value
+        AZ::s64 value = 0;
+        for (int i = 0; i < 100; ++i)
+        {
+            ASSERT_TRUE(m_registry->Get(value, key));
+            EXPECT_EQ(1, value);
+        }
+
+        ASSERT_TRUE(m_registry->Set("/Test/Value", AZ::s64{ 2 }));
+        EXPECT_TRUE(m_registry->Get(value, key));
+        EXPECT_EQ(2, value);
+        EXPECT_TRUE(m_registry->Get(value, "/Test/Value"));
+        EXPECT_EQ(2, value);
+
+        ASSERT_TRUE(m_registry->Remove("/Test/Value"));
+        EXPECT_FALSE(m_registry->Get(value, key));
+        EXPECT_FALSE(m_registry->Get(value, "/Test/Value"));
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithKeyHandle_AllTypes_MatchesPathVersion)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(
+            R"({ "Test": { "Bool": true, "Int": -42, "UInt": 18446744073709551615, "Double": 0.5, "String": "Hello" } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        for (int i = 0; i < 100; ++i)
+        {
+            bool boolValue = false;
+            EXPECT_TRUE(m_registry->Get(boolValue, AZ::SettingsRegistryInterface::KeyHandle("/Test/Bool")));
+            EXPECT_TRUE(boolValue);
+            AZ::s64 intValue = 0;
+            EXPECT_TRUE(m_registry->Get(intValue, AZ::SettingsRegistryInterface::KeyHandle("/Test/Int")));
+            EXPECT_EQ(-42, intValue);
+            AZ::u64 uintValue = 0;
+            EXPECT_TRUE(m_registry->Get(uintValue, AZ::SettingsRegistryInterface::KeyHandle("/Test/UInt")));
+            EXPECT_EQ((std::numeric_limits<AZ::u64>::max)(), uintValue);
+            double doubleValue = 0.0;
+            EXPECT_TRUE(m_registry->Get(doubleValue, AZ::SettingsRegistryInterface::KeyHandle("/Test/Double")));
+            EXPECT_DOUBLE_EQ(0.5, doubleValue);
+            AZ::SettingsRegistryInterface::FixedValueString stringValue;
+            EXPECT_TRUE(m_registry->Get(stringValue, AZ::SettingsRegistryInterface::KeyHandle("/Test/String")));
+            EXPECT_STREQ("Hello", stringValue.c_str());
+            EXPECT_FALSE(m_registry->Get(intValue, AZ::SettingsRegistryInterface::KeyHandle("/Test/String")));
+        }
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithKeyHandle_InvalidOrUnknownPath_ReturnsFalse)
+    {
+        AZ::s64 value = 0;
+        EXPECT_FALSE(m_registry->Get(value, AZ::SettingsRegistryInterface::KeyHandle()));
+        EXPECT_FALSE(m_registry->Get(value, AZ::SettingsRegistryInterface::KeyHandle("$%^&")));
+        EXPECT_FALSE(m_registry->Get(value, AZ::SettingsRegistryInterface::KeyHandle("/Unknown/Path")));
+    }
+
+    TEST_F(SettingsRegistryTest, GetObjectWithKeyHandle_SetAndGetValue_Success)
+    {
+        TestClass::Reflect(*m_serializeContext);
+
+        const AZ::SettingsRegistryInterface::KeyHandle key("/Test/Path/Value");
+        TestClass value = TestClass::Initialize();
+        ASSERT_TRUE(m_registry->SetObject(key.GetPath(), value));
+        for (int i = 0; i < 100; ++i)
+        {
+            TestClass readValue;
+            ASSERT_TRUE(m_registry->GetObject(readValue, key));
+            EXPECT_EQ(value.m_var1, readValue.m_var1);
+            EXPECT_DOUBLE_EQ(value.m_var2, readValue.m_var2);
+        }
+
+        m_serializeContext->EnableRemoveReflection();
+        TestClass::Reflect(*m_serializeContext);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(SettingsRegistryTest, GetObjectWithKeyHandle_ContextChangedAfterSnapshot_UsesNewContext)
+    {
+        TestClass::Reflect(*m_serializeContext);
+
+        const AZ::SettingsRegistryInterface::KeyHandle key("/Test/Path/Value");
+        TestClass value = TestClass::Initialize();
+        ASSERT_TRUE(m_registry->SetObject(key.GetPath(), value));
+        // Enough reads for a snapshot to be published
+        for (int i = 0; i < 100; ++i)
+        {
+            TestClass readValue;
+            ASSERT_TRUE(m_registry->GetObject(readValue, key));
+        }
+
+        // The class isn't reflected in the new context, so loading it fails unless the old context is still used
+        AZ::SerializeContext otherSerializeContext;
+        m_registry->SetContext(&otherSerializeContext);
+        for (int i = 0; i < 100; ++i)
+        {
+            TestClass readValue;
+            EXPECT_FALSE(m_registry->GetObject(readValue, key));
+        }
+
+        m_registry->SetContext(m_serializeContext.get());
+        TestClass readValue;
+        EXPECT_TRUE(m_registry->GetObject(readValue, key));
+        EXPECT_EQ(value.m_var1, readValue.m_var1);
+
+        m_serializeContext->EnableRemoveReflection();
+        TestClass::Reflect(*m_serializeContext);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(SettingsRegistryTest, Get_ReadersOnMultipleThreadsWhileWriting_ReadValuesWereWritten)
+    {
+        constexpr AZ::s64 WriteCount = 1000;
+        constexpr int ReaderCount = 4;
+        ASSERT_TRUE(m_registry->Set("/Test/Value", AZ::s64{ 0 }));
+
+        AZStd::atomic_bool writing{ true };
+        AZStd::atomic_int errorCount{ 0 };
+        AZStd::vector<AZStd::thread> readers;
+        for (int readerIndex = 0; readerIndex < ReaderCount; ++readerIndex)
+        {
+            readers.emplace_back([this, &writing, &errorCount]()
+            {
+                const AZ::SettingsRegistryInterface::KeyHandle key("/Test/Value");
+                AZ::s64 lastValue = 0;
+                while (writing)
+                {
+                    // Values are only ever increased, so a reader can't see a value going back
+                    AZ::s64 value = -1;
+                    if (!m_registry->Get(value, key) || value < lastValue || value > WriteCount)
+                    {
+                        ++errorCount;
+                    }
+                    lastValue = value;
+                }
+            });
+        }
+
+        for (AZ::s64 value = 1; value <= WriteCount; ++value)
+        {
+            m_registry->Set("/Test/Value", value);
+        }
+        writing = false;
+        for (AZStd::thread& reader : readers)
+        {
+            reader.join();
+        }
+
+        EXPECT_EQ(0, errorCount);
+    }
+
     //
     // Object
     //
@@ -1793,3 +1952,142 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
 } // namespace SettingsRegistryTests
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Reads settings from several threads, out of a registry holding 64 groups of 64 integer settings.
+    class SettingsRegistryReadBenchmark
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr int GroupCount = 64;
+        static constexpr int ValueCount = 64;
+        static constexpr int ReadsPerIteration = 16;
+
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            if (state.thread_index == 0) // Only setup in the first thread
+            {
+                AZStd::string json = "{ \"Benchmark\": {";
+                for (int group = 0; group < GroupCount; ++group)
+                {
+                    json += AZStd::string::format("%s \"Group%d\": {", group > 0 ? "," : "", group);
+                    for (int value = 0; value < ValueCount; ++value)
+                    {
+                        json += AZStd::string::format("%s \"Value%d\": %d", value > 0 ? "," : "", value, value);
+                    }
+                    json += " }";
+                }
+                json += " } }";
+
+                s_registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+                s_registry->MergeSettings(json, AZ::SettingsRegistryInterface::Format::JsonMergePatch);
+                s_lockedDocument = AZStd::make_unique<rapidjson::Document>();
+                s_lockedDocument->Parse(json.c_str());
+
+                s_paths.clear();
+                s_keys.clear();
+                for (int read = 0; read < ReadsPerIteration; ++read)
+                {
+                    s_paths.push_back(AZStd::string::format("/Benchmark/Group%d/Value%d", (read * 7) % GroupCount, (read * 13) % ValueCount));
+                    s_keys.emplace_back(s_paths.back());
+                }
+            }
+        }
+
+        void internalTearDown(const ::benchmark::State& state)
+        {
+            if (state.thread_index == 0) // Only teardown in the first thread
+            {
+                s_keys = {};
+                s_paths = {};
+                s_lockedDocument.reset();
+                s_registry.reset();
+            }
+        }
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+
+        //! Reads a setting the way the Settings Registry did before snapshots, by parsing the path and walking the settings under a lock.
+        static bool LockedGet(AZ::s64& result, AZStd::string_view path)
+        {
+            AZStd::scoped_lock lock(s_lockedDocumentMutex);
+            rapidjson::Pointer pointer(path.data(), path.length());
+            if (const rapidjson::Value* value = pointer.IsValid() ? pointer.Get(*s_lockedDocument) : nullptr;
+                value != nullptr && value->IsInt64())
+            {
+                result = value->GetInt64();
+                return true;
+            }
+            return false;
+        }
+
+        static inline AZStd::unique_ptr<AZ::SettingsRegistryImpl> s_registry;
+        static inline AZStd::unique_ptr<rapidjson::Document> s_lockedDocument;
+        static inline AZStd::recursive_mutex s_lockedDocumentMutex;
+        static inline AZStd::vector<AZStd::string> s_paths;
+        static inline AZStd::vector<AZ::SettingsRegistryInterface::KeyHandle> s_keys;
+    };
+
+    BENCHMARK_DEFINE_F(SettingsRegistryReadBenchmark, LockedDocumentGet)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZStd::string& path : s_paths)
+            {
+                AZ::s64 value = 0;
+                LockedGet(value, path);
+                benchmark::DoNotOptimize(value);
+            }
+        }
+    }
+    BENCHMARK_REGISTER_F(SettingsRegistryReadBenchmark, LockedDocumentGet)->ThreadRange(1, 8)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(SettingsRegistryReadBenchmark, SnapshotGetWithPath)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZStd::string& path : s_paths)
+            {
+                AZ::s64 value = 0;
+                s_registry->Get(value, path);
+                benchmark::DoNotOptimize(value);
+            }
+        }
+    }
+    BENCHMARK_REGISTER_F(SettingsRegistryReadBenchmark, SnapshotGetWithPath)->ThreadRange(1, 8)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(SettingsRegistryReadBenchmark, SnapshotGetWithKeyHandle)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::SettingsRegistryInterface::KeyHandle& key : s_keys)
+            {
+                AZ::s64 value = 0;
+                s_registry->Get(value, key);
+                benchmark::DoNotOptimize(value);
+            }
+        }
+    }
+    BENCHMARK_REGISTER_F(SettingsRegistryReadBenchmark, SnapshotGetWithKeyHandle)->ThreadRange(1, 8)->UseRealTime();
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
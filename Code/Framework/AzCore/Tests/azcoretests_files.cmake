@@ -102,6 +102,7 @@ set(FILES
     Serialization/Json/ColorSerializerTests.cpp
     Serialization/Json/DoubleSerializerTests.cpp
     Serialization/Json/IntSerializerTests.cpp
+    Serialization/Json/JsonClassLoadPlanTests.cpp
     Serialization/Json/JsonRegistrationContextTests.cpp
     Serialization/Json/JsonSerializationMetadataTests.cpp
     Serialization/Json/JsonSerializationResultTests.cpp
@@ -133,6 +134,7 @@ set(FILES
     Serialization/Json/UnorderedSetSerializerTests.cpp
     Serialization/Json/UnsupportedTypesSerializerTests.cpp
     Serialization/Json/UuidSerializerTests.cpp
+    Serialization/ObjectStreamImageTests.cpp
     Time/TimeTests.cpp
     Math/AabbTests.cpp
     Math/ColorTests.cpp
@@ -174,8 +176,10 @@ set(FILES
     Math/Vector3Tests.cpp
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
+    Memory/AllocationRecords.cpp
     Memory/AllocatorBenchmarks.cpp
     Memory/AllocatorManager.cpp
+    Memory/FrameArenaAllocator.cpp
     Memory/HphaSchema.cpp
     Memory/HphaSchemaErrorDetection.cpp
     Memory/LeakDetection.cpp
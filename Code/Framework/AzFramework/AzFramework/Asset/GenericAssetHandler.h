@@ -12,6 +12,7 @@
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Asset/ObjectStreamImageAssetData.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
@@ -30,6 +31,8 @@ namespace AzFramework
      *
      * Simple or game specific assets that wish to make use of automated loading and editing facilities
      * can use this handler with any asset type that's reflected for editing.
+     * Asset types deriving from AZ::Data::ObjectStreamImageAssetData are stored as an AZ::ObjectStreamImage of their root type
+     * instead, which is loaded in place without being deserialized.
      *
      * Example:
      *
@@ -135,10 +138,18 @@ namespace AzFramework
             AZ_Assert(m_serializeContext, "Unable to retrieve serialize context.");
             if (assetData)
             {
-                return AZ::Utils::LoadObjectFromStreamInPlace<AssetType>(*stream, *assetData, m_serializeContext,
-                                                                         AZ::ObjectStream::FilterDescriptor(assetLoadFilterCB)) ?
-                    AZ::Data::AssetHandler::LoadResult::LoadComplete :
-                    AZ::Data::AssetHandler::LoadResult::Error;
+                bool loaded;
+                if constexpr (AZStd::is_base_of_v<AZ::Data::ObjectStreamImageAssetData, AssetType>)
+                {
+                    // The image is used in place, nothing is deserialized
+                    loaded = assetData->LoadObjectStreamImage(*stream, *m_serializeContext);
+                }
+                else
+                {
+                    loaded = AZ::Utils::LoadObjectFromStreamInPlace<AssetType>(*stream, *assetData, m_serializeContext,
+                                                                             AZ::ObjectStream::FilterDescriptor(assetLoadFilterCB));
+                }
+                return loaded ? AZ::Data::AssetHandler::LoadResult::LoadComplete : AZ::Data::AssetHandler::LoadResult::Error;
             }
 
             return AZ::Data::AssetHandler::LoadResult::Error;
@@ -148,7 +159,11 @@ namespace AzFramework
         {
             AssetType* assetData = asset.GetAs<AssetType>();
             AZ_Assert(assetData, "Asset is of the wrong type.");
-            if (assetData && m_serializeContext)
+            if constexpr (AZStd::is_base_of_v<AZ::Data::ObjectStreamImageAssetData, AssetType>)
+            {
+                return assetData && assetData->SaveObjectStreamImage(*stream);
+            }
+            else if (assetData && m_serializeContext)
             {
                 return AZ::Utils::SaveObjectToStream<AssetType>(*stream,
                     AZ::ObjectStream::ST_XML,
@@ -17,6 +17,7 @@
 #include <AzCore/Math/Frustum.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
@@ -60,6 +61,19 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! Maximum number of frusta that can be passed to a single EnumerateFrusta call, one bit per frustum in the visibility masks.
+        static constexpr size_t MaxEnumerateFrusta = 32;
+
+        //! Node data for a multi-frustum enumeration.
+        //! Bit N of m_visibilityMasks[i] is set if m_entries[i] overlaps the Nth frustum, a mask of zero means the entry is not visible in any frustum.
+        struct NodeVisibilityData
+        {
+            const AZ::Aabb m_bounds;
+            const AZStd::vector<VisibilityEntry*>& m_entries;
+            AZStd::span<const uint32_t> m_visibilityMasks;
+        };
+        using EnumerateFrustaCallback = AZStd::function<void(const NodeVisibilityData&)>;
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -76,6 +90,15 @@ namespace AzFramework
         //! @param visibilityEntry data for the object being removed
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
 
+        //! Inserts or updates a set of entries at once, see InsertOrUpdateEntry.
+        //! This is cheaper than individual calls, since the visibility system is only locked once for the whole set.
+        //! @param visibilityEntries data for the objects being added/updated
+        virtual void InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> visibilityEntries) = 0;
+
+        //! Removes a set of entries at once, see RemoveEntry.
+        //! @param visibilityEntries data for the objects being removed
+        virtual void RemoveEntries(AZStd::span<VisibilityEntry* const> visibilityEntries) = 0;
+
         //! Intersects an axis aligned bounding box against the visibility system.
         //! @param aabb the axis aligned bounding box to test against
         //! @param callback the callback to invoke when a node is visible
@@ -94,6 +117,12 @@ namespace AzFramework
         //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a set of frusta against the visibility system, traversing the visibility system only once for all of them.
+        //! Unlike the single volume enumerations, this culls the individual entries of each visible node and reports the result per frustum.
+        //! @param frusta the frusta to test against, at most MaxEnumerateFrusta
+        //! @param callback the callback to invoke when a node has entries visible in any of the frusta
+        virtual void EnumerateFrusta(AZStd::span<const AZ::Frustum> frusta, const EnumerateFrustaCallback& callback) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
@@ -7,8 +7,11 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/fixed_vector.h>
 
 namespace AzFramework
 {
@@ -16,6 +19,26 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeLooseness,           1.5f, nullptr, AZ::ConsoleFunctorFlags::Null, "Factor the bounds of child nodes are scaled by, 1 results in a regular octree, clamped to [1, 2]");
+
+    // Layout of OctreeNode::m_entryBounds, blocks of four entries with the components stored in the following order
+    enum EntryBoundsComponent : uint32_t
+    {
+        CenterX,
+        CenterY,
+        CenterZ,
+        HalfExtentX,
+        HalfExtentY,
+        HalfExtentZ,
+        ComponentCount
+    };
+    static constexpr uint32_t EntryBoundsBlockSize = 4;
+    static constexpr uint32_t EntryBoundsBlockFloats = EntryBoundsBlockSize * EntryBoundsComponent::ComponentCount;
+
+    static inline size_t GetEntryBoundsOffset(uint32_t entryIndex, EntryBoundsComponent component)
+    {
+        return (entryIndex / EntryBoundsBlockSize) * EntryBoundsBlockFloats + component * EntryBoundsBlockSize + (entryIndex % EntryBoundsBlockSize);
+    }
 
     static uint32_t GetChildNodeCount()
     {
@@ -32,9 +55,11 @@ namespace AzFramework
 
     OctreeNode::OctreeNode(OctreeNode&& rhs)
         : m_bounds(rhs.m_bounds)
+        , m_looseness(rhs.m_looseness)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
+        , m_entryBounds(AZStd::move(rhs.m_entryBounds))
     {
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -46,9 +71,11 @@ namespace AzFramework
     OctreeNode& OctreeNode::operator=(OctreeNode&& rhs)
     {
         m_bounds = rhs.m_bounds;
+        m_looseness = rhs.m_looseness;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
+        m_entryBounds = AZStd::move(rhs.m_entryBounds);
 
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -63,17 +90,23 @@ namespace AzFramework
     {
         AZ_Assert(entry->m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the OctreeScene");
 
-        // If this is not a leaf node, try to insert into the child nodes
+        // If this is not a leaf node, try to insert into the child node containing the center of the entry
+        // Loose child nodes overlap, so this keeps the placement of an entry unambiguous
         if (m_children != nullptr)
         {
             const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
+            const AZ::Vector3 entryCenter = boundingVolume.GetCenter();
+            const AZ::Vector3 nodeCenter = m_bounds.GetCenter();
+
+            // See Split for the ordering of the child nodes
+            uint32_t child = 0;
+            child |= (entryCenter.GetX() >= nodeCenter.GetX()) ? 0x01 : 0;
+            child |= (entryCenter.GetY() >= nodeCenter.GetY()) ? 0x02 : 0;
+            child |= (!bg_octreeUseQuadtree && (entryCenter.GetZ() >= nodeCenter.GetZ())) ? 0x04 : 0;
+
+            if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
             {
-                if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
-                {
-                    return m_children[child].Insert(octreeScene, entry);
-                }
+                return m_children[child].Insert(octreeScene, entry);
             }
         }
 
@@ -87,9 +120,7 @@ namespace AzFramework
         }
         else
         {
-            m_entries.push_back(entry);
-            entry->m_internalNode = this;
-            entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
+            PushEntry(entry);
         }
     }
 
@@ -103,6 +134,7 @@ namespace AzFramework
             // Entry moved, but is still fully contained within the current node
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
             // even when one of the child nodes would be an adequate fit, due to this early out check
+            SetEntryBounds(entry->m_internalNodeIndex, boundingVolume);
             return;
         }
 
@@ -130,14 +162,25 @@ namespace AzFramework
 
         // Swap and pop the removed entry
         const uint32_t removeIndex = entry->m_internalNodeIndex;
+        const uint32_t lastIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
         m_entries[removeIndex]->m_internalNode = nullptr;
         m_entries[removeIndex]->m_internalNodeIndex = 0;
-        if (removeIndex < (m_entries.size() - 1))
+        if (removeIndex < lastIndex)
         {
             AZStd::swap(m_entries[removeIndex], m_entries.back());
             m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
+            for (uint32_t component = 0; component < EntryBoundsComponent::ComponentCount; ++component)
+            {
+                const auto boundsComponent = static_cast<EntryBoundsComponent>(component);
+                m_entryBounds[GetEntryBoundsOffset(removeIndex, boundsComponent)] = m_entryBounds[GetEntryBoundsOffset(lastIndex, boundsComponent)];
+            }
         }
         m_entries.pop_back();
+        if ((lastIndex % EntryBoundsBlockSize) == 0)
+        {
+            // The last block of entry bounds is empty now
+            m_entryBounds.resize(m_entryBounds.size() - EntryBoundsBlockFloats);
+        }
 
         if (m_parent != nullptr)
         {
@@ -188,6 +231,65 @@ namespace AzFramework
         }
     }
 
+    void OctreeNode::EnumerateFrusta(
+        const FrustumPlanes* frusta, uint32_t activeFrustaMask, uint32_t containedFrustaMask,
+        AZStd::vector<uint32_t>& visibilityMasks, const IVisibilityScene::EnumerateFrustaCallback& callback) const
+    {
+        // Classify this node against the frusta that overlap, but don't fully contain the parent node
+        // This is the same test as AZ::ShapeIntersection::Overlaps and AZ::ShapeIntersection::Contains for a frustum and an aabb
+        const AZ::Vector3 center = m_bounds.GetCenter();
+        const AZ::Vector3 extents = (0.5f * m_bounds.GetMax()) - (0.5f * m_bounds.GetMin());
+        for (uint32_t testMask = activeFrustaMask & ~containedFrustaMask; testMask != 0; testMask &= testMask - 1)
+        {
+            const uint32_t frustumIndex = az_ctz_u32(testMask);
+            const FrustumPlanes& planes = frusta[frustumIndex];
+
+            bool contained = true;
+            for (uint32_t plane = 0; plane < AZ::Frustum::PlaneId::MAX; ++plane)
+            {
+                const float distance = planes.m_normalX[plane] * center.GetX() + planes.m_normalY[plane] * center.GetY()
+                    + planes.m_normalZ[plane] * center.GetZ() + planes.m_distance[plane];
+                const float radius = planes.m_absNormalX[plane] * extents.GetX() + planes.m_absNormalY[plane] * extents.GetY()
+                    + planes.m_absNormalZ[plane] * extents.GetZ();
+                if (distance + radius <= 0.0f)
+                {
+                    activeFrustaMask &= ~(1u << frustumIndex);
+                    contained = false;
+                    break;
+                }
+                contained = contained && (distance - radius >= 0.0f);
+            }
+
+            if (contained)
+            {
+                containedFrustaMask |= 1u << frustumIndex;
+            }
+        }
+
+        if (activeFrustaMask == 0)
+        {
+            return;
+        }
+
+        // Invoke the callback for the current node
+        // Entries exceeding the world extents are stored in the root node, so its entries can't skip the tests of the containing frusta
+        const uint32_t entryContainedMask = (m_parent != nullptr) ? containedFrustaMask : 0;
+        if (!m_entries.empty() && CullEntries(frusta, activeFrustaMask & ~entryContainedMask, entryContainedMask, visibilityMasks))
+        {
+            callback({ m_bounds, m_entries, AZStd::span<const uint32_t>(visibilityMasks.data(), m_entries.size()) });
+        }
+
+        if (m_children != nullptr)
+        {
+            // If this is not a leaf node, recurse into the children
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                m_children[child].EnumerateFrusta(frusta, activeFrustaMask, containedFrustaMask, visibilityMasks, callback);
+            }
+        }
+    }
+
     const AZStd::vector<VisibilityEntry*>& OctreeNode::GetEntries() const
     {
         return m_entries;
@@ -255,6 +357,105 @@ namespace AzFramework
         }
     }
 
+    bool OctreeNode::CullEntries(
+        const FrustumPlanes* frusta, uint32_t testFrustaMask, uint32_t containedFrustaMask, AZStd::vector<uint32_t>& visibilityMasks) const
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        const uint32_t entryCount = aznumeric_cast<uint32_t>(m_entries.size());
+        const uint32_t blockCount = (entryCount + EntryBoundsBlockSize - 1) / EntryBoundsBlockSize;
+        visibilityMasks.resize_no_construct(blockCount * EntryBoundsBlockSize);
+
+        if (testFrustaMask == 0)
+        {
+            // Every frustum that overlaps this node fully contains it, so all entries are visible in them
+            AZStd::fill(visibilityMasks.begin(), visibilityMasks.end(), containedFrustaMask);
+            return true;
+        }
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        uint32_t anyVisibleMask = 0;
+        for (uint32_t block = 0; block < blockCount; ++block)
+        {
+            const float* blockBounds = m_entryBounds.data() + block * EntryBoundsBlockFloats;
+            const Vec4::FloatType centerX = Vec4::LoadUnaligned(blockBounds + EntryBoundsComponent::CenterX * EntryBoundsBlockSize);
+            const Vec4::FloatType centerY = Vec4::LoadUnaligned(blockBounds + EntryBoundsComponent::CenterY * EntryBoundsBlockSize);
+            const Vec4::FloatType centerZ = Vec4::LoadUnaligned(blockBounds + EntryBoundsComponent::CenterZ * EntryBoundsBlockSize);
+            const Vec4::FloatType halfExtentX = Vec4::LoadUnaligned(blockBounds + EntryBoundsComponent::HalfExtentX * EntryBoundsBlockSize);
+            const Vec4::FloatType halfExtentY = Vec4::LoadUnaligned(blockBounds + EntryBoundsComponent::HalfExtentY * EntryBoundsBlockSize);
+            const Vec4::FloatType halfExtentZ = Vec4::LoadUnaligned(blockBounds + EntryBoundsComponent::HalfExtentZ * EntryBoundsBlockSize);
+
+            Vec4::Int32Type masks = Vec4::Splat(aznumeric_cast<int32_t>(containedFrustaMask));
+            for (uint32_t testMask = testFrustaMask; testMask != 0; testMask &= testMask - 1)
+            {
+                const uint32_t frustumIndex = az_ctz_u32(testMask);
+                const FrustumPlanes& planes = frusta[frustumIndex];
+
+                // An entry is outside of the frustum if it is fully behind any of the planes
+                Vec4::FloatType outside = zero;
+                for (uint32_t plane = 0; plane < AZ::Frustum::PlaneId::MAX; ++plane)
+                {
+                    const Vec4::FloatType distance = Vec4::Madd(Vec4::Splat(planes.m_normalX[plane]), centerX,
+                        Vec4::Madd(Vec4::Splat(planes.m_normalY[plane]), centerY,
+                        Vec4::Madd(Vec4::Splat(planes.m_normalZ[plane]), centerZ, Vec4::Splat(planes.m_distance[plane]))));
+                    const Vec4::FloatType radius = Vec4::Madd(Vec4::Splat(planes.m_absNormalX[plane]), halfExtentX,
+                        Vec4::Madd(Vec4::Splat(planes.m_absNormalY[plane]), halfExtentY,
+                        Vec4::Mul(Vec4::Splat(planes.m_absNormalZ[plane]), halfExtentZ)));
+                    outside = Vec4::Or(outside, Vec4::CmpLtEq(Vec4::Add(distance, radius), zero));
+                }
+
+                // Set the bit of this frustum in all lanes that are not outside
+                const Vec4::Int32Type frustumBit = Vec4::Splat(aznumeric_cast<int32_t>(1u << frustumIndex));
+                masks = Vec4::Or(masks, Vec4::AndNot(Vec4::CastToInt(outside), frustumBit));
+            }
+
+            uint32_t* blockMasks = visibilityMasks.data() + block * EntryBoundsBlockSize;
+            Vec4::StoreUnaligned(reinterpret_cast<int32_t*>(blockMasks), masks);
+
+            // The last block can contain unused lanes, they are excluded from the result
+            const uint32_t blockEntryCount = AZStd::min(EntryBoundsBlockSize, entryCount - block * EntryBoundsBlockSize);
+            for (uint32_t lane = 0; lane < blockEntryCount; ++lane)
+            {
+                anyVisibleMask |= blockMasks[lane];
+            }
+        }
+
+        return anyVisibleMask != 0;
+    }
+
+    void OctreeNode::PushEntry(VisibilityEntry* entry)
+    {
+        const uint32_t entryIndex = aznumeric_cast<uint32_t>(m_entries.size());
+        if ((entryIndex % EntryBoundsBlockSize) == 0)
+        {
+            m_entryBounds.resize(m_entryBounds.size() + EntryBoundsBlockFloats, 0.0f);
+        }
+
+        m_entries.push_back(entry);
+        entry->m_internalNode = this;
+        entry->m_internalNodeIndex = entryIndex;
+        SetEntryBounds(entryIndex, entry->m_boundingVolume);
+    }
+
+    void OctreeNode::SetEntryBounds(uint32_t entryIndex, const AZ::Aabb& bounds)
+    {
+        // Scale before subtracting, so bounds at +/-FLT_MAX don't overflow, see AZ::ShapeIntersection::Overlaps
+        const AZ::Vector3 center = (0.5f * bounds.GetMax()) + (0.5f * bounds.GetMin());
+        const AZ::Vector3 halfExtents = (0.5f * bounds.GetMax()) - (0.5f * bounds.GetMin());
+        m_entryBounds[GetEntryBoundsOffset(entryIndex, EntryBoundsComponent::CenterX)] = center.GetX();
+        m_entryBounds[GetEntryBoundsOffset(entryIndex, EntryBoundsComponent::CenterY)] = center.GetY();
+        m_entryBounds[GetEntryBoundsOffset(entryIndex, EntryBoundsComponent::CenterZ)] = center.GetZ();
+        m_entryBounds[GetEntryBoundsOffset(entryIndex, EntryBoundsComponent::HalfExtentX)] = halfExtents.GetX();
+        m_entryBounds[GetEntryBoundsOffset(entryIndex, EntryBoundsComponent::HalfExtentY)] = halfExtents.GetY();
+        m_entryBounds[GetEntryBoundsOffset(entryIndex, EntryBoundsComponent::HalfExtentZ)] = halfExtents.GetZ();
+    }
+
+    void OctreeNode::ClearEntries()
+    {
+        m_entries.clear();
+        m_entryBounds.clear();
+    }
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
@@ -263,8 +464,12 @@ namespace AzFramework
 
         // Set child split planes and bounding volumes
         {
-            const AZ::Vector3 childExtent = (m_bounds.GetMax() - m_bounds.GetMin()) * 0.5f;
-            const AZ::Aabb childBound = AZ::Aabb::CreateFromMinMax(m_bounds.GetMin(), m_bounds.GetMin() + childExtent);
+            // The child cells are half the size of the regular cell of this node, which m_bounds was scaled up from
+            const float childLooseness = AZ::GetClamp(static_cast<float>(bg_octreeLooseness), 1.0f, 2.0f);
+            const AZ::Vector3 childExtent = (m_bounds.GetMax() - m_bounds.GetMin()) * (0.5f / m_looseness);
+            const AZ::Vector3 cellMin = m_bounds.GetCenter() - childExtent;
+            const AZ::Aabb childBound = AZ::Aabb::CreateFromMinMax(cellMin, cellMin + childExtent)
+                .GetExpanded(childExtent * (0.5f * (childLooseness - 1.0f)));
             const uint32_t childCount = GetChildNodeCount();
 
             for (uint32_t child = 0; child < childCount; ++child)
@@ -290,12 +495,14 @@ namespace AzFramework
                 }
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
+                m_children[child].m_looseness = childLooseness;
                 m_children[child].m_parent = this;
             }
         }
 
         // Re-partition our entry set across ourself and our child nodes
         AZStd::vector<VisibilityEntry*> entrySet(AZStd::move(m_entries));
+        ClearEntries();
         for (VisibilityEntry* entry : entrySet)
         {
             entry->m_internalNode = nullptr;
@@ -314,11 +521,9 @@ namespace AzFramework
         {
             for (VisibilityEntry* childEntry : m_children[child].m_entries)
             {
-                childEntry->m_internalNode = this;
-                childEntry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size());
-                m_entries.push_back(childEntry);
+                PushEntry(childEntry);
             }
-            m_children[child].m_entries.clear();
+            m_children[child].ClearEntries();
         }
 
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
@@ -351,6 +556,35 @@ namespace AzFramework
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        InsertOrUpdateEntryInternal(entry);
+    }
+
+    void OctreeScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        RemoveEntryInternal(entry);
+    }
+
+    void OctreeScene::InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        for (VisibilityEntry* entry : entries)
+        {
+            InsertOrUpdateEntryInternal(*entry);
+        }
+    }
+
+    void OctreeScene::RemoveEntries(AZStd::span<VisibilityEntry* const> entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        for (VisibilityEntry* entry : entries)
+        {
+            RemoveEntryInternal(*entry);
+        }
+    }
+
+    void OctreeScene::InsertOrUpdateEntryInternal(VisibilityEntry& entry)
+    {
         if (entry.m_internalNode != nullptr)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
@@ -362,9 +596,8 @@ namespace AzFramework
         }
     }
 
-    void OctreeScene::RemoveEntry(VisibilityEntry& entry)
+    void OctreeScene::RemoveEntryInternal(VisibilityEntry& entry)
     {
-        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
         if (entry.m_internalNode)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Remove(*this, &entry);
@@ -390,6 +623,39 @@ namespace AzFramework
         m_root.Enumerate(frustum, callback);
     }
 
+    void OctreeScene::EnumerateFrusta(AZStd::span<const AZ::Frustum> frusta, const IVisibilityScene::EnumerateFrustaCallback& callback) const
+    {
+        AZ_Assert(frusta.size() <= MaxEnumerateFrusta, "EnumerateFrusta supports at most %zu frusta, %zu were provided", MaxEnumerateFrusta, frusta.size());
+        const size_t frustumCount = AZStd::min(frusta.size(), MaxEnumerateFrusta);
+        if (frustumCount == 0)
+        {
+            return;
+        }
+
+        AZStd::fixed_vector<OctreeNode::FrustumPlanes, MaxEnumerateFrusta> frustaPlanes(frustumCount);
+        for (size_t frustumIndex = 0; frustumIndex < frustumCount; ++frustumIndex)
+        {
+            OctreeNode::FrustumPlanes& planes = frustaPlanes[frustumIndex];
+            for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+            {
+                const AZ::Plane plane = frusta[frustumIndex].GetPlane(planeId);
+                const AZ::Vector3 normal = plane.GetNormal();
+                planes.m_normalX[planeId] = normal.GetX();
+                planes.m_normalY[planeId] = normal.GetY();
+                planes.m_normalZ[planeId] = normal.GetZ();
+                planes.m_absNormalX[planeId] = AZStd::abs(normal.GetX());
+                planes.m_absNormalY[planeId] = AZStd::abs(normal.GetY());
+                planes.m_absNormalZ[planeId] = AZStd::abs(normal.GetZ());
+                planes.m_distance[planeId] = plane.GetDistance();
+            }
+        }
+
+        const uint32_t allFrustaMask = (frustumCount == 32) ? 0xFFFFFFFF : ((1u << frustumCount) - 1);
+        AZStd::vector<uint32_t> visibilityMasks;
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateFrusta(frustaPlanes.data(), allFrustaMask, 0, visibilityMasks, callback);
+    }
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -23,6 +23,10 @@ namespace AzFramework
 
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
+    //! Child nodes are loose, their bounds are scaled up by bg_octreeLooseness around their center, so objects straddling a split plane
+    //! still fit into a child node as long as they are small enough. Objects are assigned to the child node containing their center.
+    //! Next to the entry pointers, each node keeps the centers and half extents of its entries in a structure of arrays layout,
+    //! so entries can be culled four at a time.
     class OctreeNode
         : public VisibilityNode
     {
@@ -57,6 +61,26 @@ namespace AzFramework
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
+        //! The planes of a frustum, split into their components to test entries four at a time.
+        struct FrustumPlanes
+        {
+            float m_normalX[AZ::Frustum::PlaneId::MAX];
+            float m_normalY[AZ::Frustum::PlaneId::MAX];
+            float m_normalZ[AZ::Frustum::PlaneId::MAX];
+            float m_absNormalX[AZ::Frustum::PlaneId::MAX];
+            float m_absNormalY[AZ::Frustum::PlaneId::MAX];
+            float m_absNormalZ[AZ::Frustum::PlaneId::MAX];
+            float m_distance[AZ::Frustum::PlaneId::MAX];
+        };
+
+        //! Recursively enumerates any OctreeNodes and their children that intersect any of the provided frusta.
+        //! @param activeFrustaMask the frusta that the parent node overlaps
+        //! @param containedFrustaMask the frusta that fully contain the parent node, whose entries don't need to be tested
+        //! @param visibilityMasks scratch storage for the per-entry visibility masks
+        void EnumerateFrusta(
+            const FrustumPlanes* frusta, uint32_t activeFrustaMask, uint32_t containedFrustaMask,
+            AZStd::vector<uint32_t>& visibilityMasks, const IVisibilityScene::EnumerateFrustaCallback& callback) const;
+
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
 
@@ -76,14 +100,29 @@ namespace AzFramework
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
 
+        //! Maintain the structure of arrays entry bounds alongside m_entries.
+        //! @{
+        void PushEntry(VisibilityEntry* entry);
+        void SetEntryBounds(uint32_t entryIndex, const AZ::Aabb& bounds);
+        void ClearEntries();
+        //! @}
+
+        //! Fills the visibility masks of all entries, returns true if any entry is visible.
+        bool CullEntries(
+            const FrustumPlanes* frusta, uint32_t testFrustaMask, uint32_t containedFrustaMask, AZStd::vector<uint32_t>& visibilityMasks) const;
+
         // The page is stored in the upper 16-bits of the child node index, the offset into the page is the lower 16-bits
         // This gives us a maximum of 65,536 pages and 65,536 nodes per page, for a total of 2^32 - 1 total pages (-1 reserved for the invalid index)
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
         uint32_t m_childNodeIndex = InvalidChildNodeIndex;
         AZ::Aabb m_bounds;
+        float m_looseness = 1.0f; //< The factor m_bounds was scaled by, relative to the regular octree cell
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
+        //! Bounds of m_entries, stored in blocks of four entries holding four center x, four center y, four center z,
+        //! four half extent x, four half extent y and four half extent z values, in that order.
+        AZStd::vector<float> m_entryBounds;
     };
 
     //! Implementation of the visibility system interface.
@@ -104,9 +143,12 @@ namespace AzFramework
         const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
         void RemoveEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> entries) override;
+        void RemoveEntries(AZStd::span<VisibilityEntry* const> entries) override;
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateFrusta(AZStd::span<const AZ::Frustum> frusta, const IVisibilityScene::EnumerateFrustaCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -121,6 +163,10 @@ namespace AzFramework
         //! @}
 
     private:
+        // The following functions expect m_sharedMutex to be locked
+        void InsertOrUpdateEntryInternal(VisibilityEntry& entry);
+        void RemoveEntryInternal(VisibilityEntry& entry);
+
         uint32_t AllocateChildNodes();
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/AssetDataStream.h>
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Asset/ObjectStreamImageAssetData.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Serialization/ObjectStreamImage.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Asset/GenericAssetHandler.h>
+
+namespace UnitTest
+{
+    struct ImageAssetTile
+    {
+        AZ_TYPE_INFO(ImageAssetTile, "{3E9B5D1F-7A2C-4E8B-9D6F-1B3E5A7C9D42}");
+
+        AZStd::array<float, 8> m_heights{};
+        ImageAssetTile* m_next = nullptr;
+    };
+
+    struct ImageAssetTerrain
+    {
+        AZ_TYPE_INFO(ImageAssetTerrain, "{B1D7F3A5-9C4E-4A2B-8F6D-3E5C7A9B1D84}");
+
+        AZ::u32 m_tileCount = 0;
+        ImageAssetTile* m_firstTile = nullptr;
+    };
+
+    class ImageAssetTerrainAsset
+        : public AZ::Data::ObjectStreamImageAssetData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ImageAssetTerrainAsset, AZ::SystemAllocator, 0);
+        AZ_RTTI(ImageAssetTerrainAsset, "{6F2A8C4E-1B7D-4F3A-A5C9-7E1B3D5F9A26}", AZ::Data::ObjectStreamImageAssetData);
+
+        ImageAssetTerrainAsset()
+            : AZ::Data::ObjectStreamImageAssetData(azrtti_typeid<ImageAssetTerrain>())
+        {
+        }
+    };
+
+    class GenericAssetHandlerImageTest
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_serializeContext->Class<ImageAssetTile>()
+                ->Attribute(AZ::SerializeContextAttributes::ObjectStreamImageLayout, AZ::ObjectStreamImage::Layout::Create<ImageAssetTile>())
+                ->Field("Heights", &ImageAssetTile::m_heights)
+                ->Field("Next", &ImageAssetTile::m_next);
+            m_serializeContext->Class<ImageAssetTerrain>()
+                ->Attribute(AZ::SerializeContextAttributes::ObjectStreamImageLayout, AZ::ObjectStreamImage::Layout::Create<ImageAssetTerrain>())
+                ->Field("TileCount", &ImageAssetTerrain::m_tileCount)
+                ->Field("FirstTile", &ImageAssetTerrain::m_firstTile);
+
+            AZ::Data::AssetManager::Descriptor desc;
+            AZ::Data::AssetManager::Create(desc);
+            m_handler = AZStd::make_unique<AzFramework::GenericAssetHandler<ImageAssetTerrainAsset>>(
+                "Image Terrain", "Test", "imageterrain", AZ::Uuid::CreateNull(), m_serializeContext.get());
+            m_handler->Register();
+
+            for (size_t tileIndex = 0; tileIndex < m_tiles.size(); ++tileIndex)
+            {
+                for (size_t heightIndex = 0; heightIndex < m_tiles[tileIndex].m_heights.size(); ++heightIndex)
+                {
+                    m_tiles[tileIndex].m_heights[heightIndex] = static_cast<float>(tileIndex * 10 + heightIndex);
+                }
+                m_tiles[tileIndex].m_next = tileIndex + 1 < m_tiles.size() ? &m_tiles[tileIndex + 1] : nullptr;
+            }
+            m_terrain.m_tileCount = static_cast<AZ::u32>(m_tiles.size());
+            m_terrain.m_firstTile = &m_tiles[0];
+        }
+
+        void TearDown() override
+        {
+            m_handler->Unregister();
+            m_handler.reset();
+            AZ::Data::AssetManager::Destroy();
+            m_serializeContext.reset();
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        //! Loads the data into a new asset through the handler.
+        AZ::Data::Asset<ImageAssetTerrainAsset> LoadAsset(const AZStd::vector<char>& buffer, AZ::Data::AssetHandler::LoadResult& result)
+        {
+            AZ::Data::Asset<ImageAssetTerrainAsset> asset =
+                AZ::Data::AssetManager::Instance().CreateAsset<ImageAssetTerrainAsset>(AZ::Data::AssetId(AZ::Uuid::CreateRandom()));
+
+            AZ::Data::AssetDataStream::VectorDataSource data(buffer.begin(), buffer.end());
+            auto stream = AZStd::make_shared<AZ::Data::AssetDataStream>();
+            stream->Open(AZStd::move(data));
+            result = m_handler->LoadAssetData(asset, stream, {});
+            stream->Close();
+            return asset;
+        }
+
+        void ExpectTerrainEq(const ImageAssetTerrainAsset& asset) const
+        {
+            const ImageAssetTerrain* terrain = asset.GetRoot<ImageAssetTerrain>();
+            ASSERT_NE(nullptr, terrain);
+            EXPECT_EQ(m_terrain.m_tileCount, terrain->m_tileCount);
+            const ImageAssetTile* tile = terrain->m_firstTile;
+            for (const ImageAssetTile& expectedTile : m_tiles)
+            {
+                ASSERT_NE(nullptr, tile);
+                EXPECT_EQ(expectedTile.m_heights, tile->m_heights);
+                tile = tile->m_next;
+            }
+            EXPECT_EQ(nullptr, tile);
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AzFramework::GenericAssetHandler<ImageAssetTerrainAsset>> m_handler;
+        AZStd::array<ImageAssetTile, 3> m_tiles;
+        ImageAssetTerrain m_terrain;
+    };
+
+    TEST_F(GenericAssetHandlerImageTest, LoadAndSaveAssetData_ObjectStreamImageAsset_RoundTrips)
+    {
+        AZStd::vector<char> imageBuffer;
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&imageBuffer);
+            ASSERT_TRUE(AZ::ObjectStreamImage::Save(stream, m_terrain, *m_serializeContext));
+        }
+
+        AZ::Data::AssetHandler::LoadResult result = AZ::Data::AssetHandler::LoadResult::Error;
+        AZ::Data::Asset<ImageAssetTerrainAsset> asset = LoadAsset(imageBuffer, result);
+        ASSERT_EQ(AZ::Data::AssetHandler::LoadResult::LoadComplete, result);
+        ExpectTerrainEq(*asset);
+
+        // Saving writes the loaded image back unchanged, and it loads again
+        AZStd::vector<char> savedBuffer;
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&savedBuffer);
+            ASSERT_TRUE(m_handler->SaveAssetData(asset, &stream));
+        }
+        EXPECT_EQ(imageBuffer, savedBuffer);
+
+        AZ::Data::Asset<ImageAssetTerrainAsset> reloadedAsset = LoadAsset(savedBuffer, result);
+        ASSERT_EQ(AZ::Data::AssetHandler::LoadResult::LoadComplete, result);
+        ExpectTerrainEq(*reloadedAsset);
+    }
+
+    TEST_F(GenericAssetHandlerImageTest, LoadAssetData_NotAnImage_ReturnsError)
+    {
+        const AZStd::string notAnImage = "<ObjectStream version=\"3\"></ObjectStream>";
+        const AZStd::vector<char> buffer(notAnImage.begin(), notAnImage.end());
+
+        AZ::Data::AssetHandler::LoadResult result = AZ::Data::AssetHandler::LoadResult::LoadComplete;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZ::Data::Asset<ImageAssetTerrainAsset> asset = LoadAsset(buffer, result);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        EXPECT_EQ(AZ::Data::AssetHandler::LoadResult::Error, result);
+        EXPECT_EQ(nullptr, asset->GetRoot<ImageAssetTerrain>());
+    }
+} // namespace UnitTest
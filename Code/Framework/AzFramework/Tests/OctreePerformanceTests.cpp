@@ -7,6 +7,8 @@
  */
 
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
@@ -69,6 +71,16 @@ namespace Benchmark
                     2.0f * atanf(0.5f), unif(rng) * 10.0f, unif(rng) * 1000.0f));
                 return data;
             });
+
+            for (AzFramework::VisibilityEntry& data : m_dataArray)
+            {
+                m_dataPointerArray.push_back(&data);
+            }
+
+            for (const QueryData& data : m_queryDataArray)
+            {
+                m_queryFrustumArray.push_back(data.frustum);
+            }
         }
 
         void internalTearDown()
@@ -83,6 +95,12 @@ namespace Benchmark
             m_queryDataArray.clear();
             m_queryDataArray.shrink_to_fit();
 
+            m_dataPointerArray.clear();
+            m_dataPointerArray.shrink_to_fit();
+
+            m_queryFrustumArray.clear();
+            m_queryFrustumArray.shrink_to_fit();
+
             // Destroy system allocator only if it was created by this environment
             if (m_ownsSystemAllocator)
             {
@@ -125,6 +143,58 @@ namespace Benchmark
             }
         }
 
+        void InsertEntriesBatched(uint32_t entryCount)
+        {
+            m_visScene->InsertOrUpdateEntries(AZStd::span(m_dataPointerArray.data(), entryCount));
+        }
+
+        void RemoveEntriesBatched(uint32_t entryCount)
+        {
+            m_visScene->RemoveEntries(AZStd::span(m_dataPointerArray.data(), entryCount));
+        }
+
+        //! Enumerates every group of FrustaPerView consecutive query frusta with one Enumerate call per frustum,
+        //! culling the entries of each visible node like a renderer would.
+        void EnumerateViewsSingle()
+        {
+            uint32_t visibleCount = 0;
+            for (size_t first = 0; first + FrustaPerView <= m_queryDataArray.size(); first += FrustaPerView)
+            {
+                for (size_t frustumIndex = first; frustumIndex < first + FrustaPerView; ++frustumIndex)
+                {
+                    const AZ::Frustum& frustum = m_queryDataArray[frustumIndex].frustum;
+                    m_visScene->Enumerate(frustum, [&frustum, &visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                    {
+                        for (const AzFramework::VisibilityEntry* entry : nodeData.m_entries)
+                        {
+                            visibleCount += AZ::ShapeIntersection::Overlaps(frustum, entry->m_boundingVolume) ? 1 : 0;
+                        }
+                    });
+                }
+            }
+            benchmark::DoNotOptimize(visibleCount);
+        }
+
+        //! Enumerates every group of FrustaPerView consecutive query frusta with a single EnumerateFrusta call.
+        void EnumerateViewsBatched()
+        {
+            uint32_t visibleCount = 0;
+            for (size_t first = 0; first + FrustaPerView <= m_queryFrustumArray.size(); first += FrustaPerView)
+            {
+                m_visScene->EnumerateFrusta(AZStd::span(m_queryFrustumArray.data() + first, FrustaPerView),
+                    [&visibleCount](const AzFramework::IVisibilityScene::NodeVisibilityData& nodeData)
+                {
+                    for (uint32_t visibilityMask : nodeData.m_visibilityMasks)
+                    {
+                        visibleCount += az_popcnt_u32(visibilityMask);
+                    }
+                });
+            }
+            benchmark::DoNotOptimize(visibleCount);
+        }
+
+        static constexpr size_t FrustaPerView = 8; //< E.g. a main view, four shadow cascades and three more shadow casting lights
+
         struct QueryData
         {
             AZ::Aabb aabb;
@@ -135,6 +205,8 @@ namespace Benchmark
         bool m_ownsSystemAllocator = false;
         AZStd::vector<AzFramework::VisibilityEntry> m_dataArray;
         AZStd::vector<QueryData> m_queryDataArray;
+        AZStd::vector<AzFramework::VisibilityEntry*> m_dataPointerArray;
+        AZStd::vector<AZ::Frustum> m_queryFrustumArray;
         AzFramework::OctreeSystemComponent* m_octreeSystemComponent = nullptr;
         AzFramework::IVisibilityScene* m_visScene = nullptr;
     };
@@ -346,6 +418,70 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    BENCHMARK_F(BM_Octree, InsertDeleteBatched100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            InsertEntriesBatched(EntryCount);
+            RemoveEntriesBatched(EntryCount);
+        }
+    }
+
+    BENCHMARK_F(BM_Octree, InsertDeleteBatched1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            InsertEntriesBatched(EntryCount);
+            RemoveEntriesBatched(EntryCount);
+        }
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumPerView100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EnumerateViewsSingle();
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrusta100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EnumerateViewsBatched();
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumPerView1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EnumerateViewsSingle();
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrusta1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EnumerateViewsBatched();
+        }
+        RemoveEntries(EntryCount);
+    }
 }
 
 #endif
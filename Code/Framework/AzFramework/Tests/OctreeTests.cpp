@@ -11,6 +11,8 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -38,11 +40,13 @@ namespace UnitTest
             m_console->GetCvarValue("bg_octreeNodeMaxEntries", m_savedMaxEntries);
             m_console->GetCvarValue("bg_octreeNodeMinEntries", m_savedMinEntries);
             m_console->GetCvarValue("bg_octreeMaxWorldExtents", m_savedBounds);
+            m_console->GetCvarValue("bg_octreeLooseness", m_savedLooseness);
 
             // To ease unit testing, configure the octreeSystemComponent to only allow one entry per node
             m_console->PerformCommand("bg_octreeNodeMaxEntries 1");
             m_console->PerformCommand("bg_octreeNodeMinEntries 1");
             m_console->PerformCommand("bg_octreeMaxWorldExtents 1"); // Create a -1,-1,-1 to 1,1,1 world volume
+            m_console->PerformCommand("bg_octreeLooseness 1"); // Use regular child nodes, so the node bounds match the expected entries
 
             if (!AZ::NameDictionary::IsReady())
             {
@@ -63,6 +67,8 @@ namespace UnitTest
             m_console->PerformCommand(commandString.c_str());
             commandString.format("bg_octreeMaxWorldExtents %f", m_savedBounds);
             m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_octreeLooseness %f", m_savedLooseness);
+            m_console->PerformCommand(commandString.c_str());
 
             m_octreeSystemComponent->DestroyVisibilityScene(m_octreeScene);
             delete m_octreeSystemComponent;
@@ -88,6 +94,7 @@ namespace UnitTest
         uint32_t m_savedMaxEntries = 0;
         uint32_t m_savedMinEntries = 0;
         float m_savedBounds = 0.0f;
+        float m_savedLooseness = 0.0f;
         AZ::Console* m_console;
     };
 
@@ -420,4 +427,127 @@ namespace UnitTest
         // Expect all the entries to be in the scene
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, static_cast<uint32_t>(visEntries.size()));
     }
+
+    TEST_F(OctreeTests, InsertOrUpdateEntry_LooseNodes_EntryOnSplitPlaneIsStoredInChild)
+    {
+        m_console->PerformCommand("bg_octreeLooseness 1.5");
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.1f), AZ::Vector3(0.1f));
+
+        m_octreeScene->InsertOrUpdateEntry(visEntry[0]);
+        m_octreeScene->InsertOrUpdateEntry(visEntry[1]); // This should force a split of the root node
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1 + m_octreeScene->GetChildNodeCount());
+
+        // The second entry straddles all split planes of the root, but still fits the loose child node containing its center
+        const AZ::Aabb rootBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(1.0f));
+        m_octreeScene->EnumerateNoCull([&rootBounds](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            EXPECT_EQ(nodeData.m_entries.size(), 1u);
+            EXPECT_FALSE(nodeData.m_bounds.IsClose(rootBounds));
+            EXPECT_TRUE(AZ::ShapeIntersection::Contains(nodeData.m_bounds, nodeData.m_entries[0]->m_boundingVolume));
+        });
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 2);
+
+        m_octreeScene->RemoveEntry(visEntry[0]);
+        m_octreeScene->RemoveEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1);
+    }
+
+    TEST_F(OctreeTests, InsertOrUpdateEntries_RemoveEntries_MatchSingleEntryCalls)
+    {
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        AzFramework::VisibilityEntry* entries[] = { &visEntry[0], &visEntry[1], &visEntry[2] };
+
+        m_octreeScene->InsertOrUpdateEntries(entries);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1 + (2 * m_octreeScene->GetChildNodeCount()));
+
+        // Updating existing entries doesn't change the count
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.8f), AZ::Vector3(-0.7f));
+        m_octreeScene->InsertOrUpdateEntries(entries);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+
+        m_octreeScene->RemoveEntries(entries);
+        for (const AzFramework::VisibilityEntry& entry : visEntry)
+        {
+            EXPECT_TRUE(entry.m_internalNode == nullptr);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1);
+    }
+
+    TEST_F(OctreeTests, EnumerateFrusta_RandomEntries_VisibilityMasksMatchOverlaps)
+    {
+        m_console->PerformCommand("bg_octreeLooseness 1.5");
+        m_console->PerformCommand("bg_octreeNodeMaxEntries 6");
+        m_console->PerformCommand("bg_octreeNodeMinEntries 3");
+
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> position(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> size(0.0f, 0.2f);
+        std::uniform_real_distribution<float> angle(0.0f, AZ::Constants::TwoPi);
+
+        constexpr size_t EntryCount = 256;
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(EntryCount);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            const AZ::Vector3 entryMin(position(rng), position(rng), position(rng));
+            entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(entryMin, entryMin + AZ::Vector3(size(rng), size(rng), size(rng)));
+        }
+
+        AZStd::vector<AzFramework::VisibilityEntry*> entries;
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            entries.push_back(&entry);
+        }
+        m_octreeScene->InsertOrUpdateEntries(entries);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, EntryCount);
+
+        // One frustum covering the whole scene, so some nodes are fully contained, and several smaller ones
+        AZStd::vector<AZ::Frustum> frusta;
+        frusta.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(
+            AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, -4.0f, 0.0f)), 1.0f, AZ::Constants::HalfPi, 1.0f, 10.0f)));
+        for (uint32_t frustumIndex = 1; frustumIndex < 8; ++frustumIndex)
+        {
+            const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(angle(rng)), AZ::Vector3(position(rng), position(rng), position(rng)));
+            frusta.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(transform, 1.0f, 2.0f * atanf(0.5f), 0.1f, 1.0f)));
+        }
+
+        AZStd::unordered_map<const AzFramework::VisibilityEntry*, uint32_t> reportedMasks;
+        m_octreeScene->EnumerateFrusta(frusta, [&reportedMasks](const AzFramework::IVisibilityScene::NodeVisibilityData& nodeData)
+        {
+            EXPECT_EQ(nodeData.m_entries.size(), nodeData.m_visibilityMasks.size());
+            for (size_t entryIndex = 0; entryIndex < nodeData.m_entries.size(); ++entryIndex)
+            {
+                EXPECT_TRUE(reportedMasks.emplace(nodeData.m_entries[entryIndex], nodeData.m_visibilityMasks[entryIndex]).second);
+            }
+        });
+
+        for (const AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            uint32_t expectedMask = 0;
+            for (size_t frustumIndex = 0; frustumIndex < frusta.size(); ++frustumIndex)
+            {
+                if (AZ::ShapeIntersection::Overlaps(frusta[frustumIndex], entry.m_boundingVolume))
+                {
+                    expectedMask |= 1u << frustumIndex;
+                }
+            }
+
+            auto reportedMask = reportedMasks.find(&entry);
+            const uint32_t actualMask = (reportedMask != reportedMasks.end()) ? reportedMask->second : 0;
+            EXPECT_EQ(actualMask, expectedMask);
+        }
+        EXPECT_NE(reportedMasks.size(), 0u);
+
+        m_octreeScene->RemoveEntries(entries);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
 }
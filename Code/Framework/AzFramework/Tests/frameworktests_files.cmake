@@ -21,6 +21,7 @@ set(FILES
     EntityContext.cpp
     FileIO.cpp
     FileTagTests.cpp
+    GenericAssetHandlerTests.cpp
     GenAppDescriptors.cpp
     OctreePerformanceTests.cpp
     OctreeTests.cpp
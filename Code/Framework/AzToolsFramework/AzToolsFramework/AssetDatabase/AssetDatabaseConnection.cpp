@@ -670,6 +670,14 @@ namespace AzToolsFramework
             static const auto s_querySourcedependencyBySourcedependencyid = MakeSqlQuery(QUERY_SOURCEDEPENDENCY_BY_SOURCEDEPENDENCYID, QUERY_SOURCEDEPENDENCY_BY_SOURCEDEPENDENCYID_STATEMENT, LOG_NAME,
                     SqlParam<AZ::s64>(":sourceDependencyid"));
 
+            static const char* QUERY_SOURCEDEPENDENCY_BY_TYPEOFDEPENDENCY = "AzToolsFramework::AssetDatabase::QuerySourceDependencyByTypeOfDependency";
+            static const char* QUERY_SOURCEDEPENDENCY_BY_TYPEOFDEPENDENCY_STATEMENT =
+                "SELECT * from SourceDependency WHERE "
+                "TypeOfDependency & :typeOfDependency;";
+
+            static const auto s_querySourcedependencyByTypeofdependency = MakeSqlQuery(QUERY_SOURCEDEPENDENCY_BY_TYPEOFDEPENDENCY, QUERY_SOURCEDEPENDENCY_BY_TYPEOFDEPENDENCY_STATEMENT, LOG_NAME,
+                SqlParam<AZ::u32>(":typeOfDependency"));
+
             static const char* QUERY_SOURCEDEPENDENCY_BY_DEPENDSONSOURCE = "AzToolsFramework::AssetDatabase::QuerySourceDependencyByDependsOnSource";
             static const char* QUERY_SOURCEDEPENDENCY_BY_DEPENDSONSOURCE_STATEMENT =
                 "SELECT * from SourceDependency WHERE "
@@ -1844,6 +1852,7 @@ namespace AzToolsFramework
             AddStatement(m_databaseConnection, s_queryCombinedLikeProductnamePlatform);
 
             AddStatement(m_databaseConnection, s_querySourcedependencyBySourcedependencyid);
+            AddStatement(m_databaseConnection, s_querySourcedependencyByTypeofdependency);
             AddStatement(m_databaseConnection, s_querySourcedependencyByDependsonsource);
             AddStatement(m_databaseConnection, s_querySourcedependencyByDependsonsourceWildcard);
             AddStatement(m_databaseConnection, s_queryDependsonsourceBySource);
@@ -2485,6 +2494,11 @@ namespace AzToolsFramework
             return s_querySourcedependencyBySourcedependencyid.BindAndQuery(*m_databaseConnection, handler, &GetSourceDependencyResult, sourceDependencyID);
         }
 
+        bool AssetDatabaseConnection::QuerySourceDependencies(AzToolsFramework::AssetDatabase::SourceFileDependencyEntry::TypeOfDependency dependencyType, sourceFileDependencyHandler handler)
+        {
+            return s_querySourcedependencyByTypeofdependency.BindAndQuery(*m_databaseConnection, handler, &GetSourceDependencyResult, dependencyType);
+        }
+
         bool AssetDatabaseConnection::QuerySourceDependencyByDependsOnSource(const char* dependsOnSource, const char* dependentFilter, AzToolsFramework::AssetDatabase::SourceFileDependencyEntry::TypeOfDependency dependencyType, sourceFileDependencyHandler handler)
         {
             if (dependencyType & AzToolsFramework::AssetDatabase::SourceFileDependencyEntry::DEP_SourceLikeMatch)
@@ -582,6 +582,9 @@ namespace AzToolsFramework
             /// direct query - look up table row by row ID
             bool QuerySourceDependencyBySourceDependencyId(AZ::s64 sourceDependencyID, sourceFileDependencyHandler handler);
 
+            //! Query all rows of the given dependency type(s), for callers that mirror the whole dependency table at once.
+            bool QuerySourceDependencies(AzToolsFramework::AssetDatabase::SourceFileDependencyEntry::TypeOfDependency dependencyType, sourceFileDependencyHandler handler);
+
             //! Query sources which depend on 'dependsOnSource'.
             //! Reverse dependencies are incoming dependencies: what assets depend on me?
             //! Optional nullable 'dependentFilter' filters it to only resulting sources which are LIKE the filter.
@@ -13,6 +13,7 @@
 
 #include <AzToolsFramework/Prefab/Instance/Instance.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityIdMapper.h>
+#include <AzToolsFramework/Prefab/Instance/InstanceEntityPreloader.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityMapper.h>
 
 namespace AzToolsFramework
@@ -24,7 +25,7 @@ namespace AzToolsFramework
         {
             namespace JSR = AZ::JsonSerializationResult;
 
-            if (!m_loadingInstance)
+            if (!m_loadingInstance && !m_preloadedEntities)
             {
                 AZ_Assert(false,
                     "Attempted to map an EntityId in Prefab Instance without setting the Loading Prefab Instance");
@@ -43,7 +44,7 @@ namespace AzToolsFramework
 
             if (!inputAlias.empty())
             {
-                AliasPath absoluteEntityPath = m_loadingInstance->GetAbsoluteInstanceAliasPath();
+                AliasPath absoluteEntityPath = m_loadingInstance ? m_loadingInstance->GetAbsoluteInstanceAliasPath() : m_instanceAbsolutePath;
                 absoluteEntityPath.Append(inputAlias);
                 absoluteEntityPath = absoluteEntityPath.LexicallyNormal();
 
@@ -51,7 +52,11 @@ namespace AzToolsFramework
 
                 if (!m_isEntityReference)
                 {
-                    if (!m_loadingInstance->RegisterEntity(mappedValue, inputAlias))
+                    if (m_preloadedEntities)
+                    {
+                        m_preloadedEntities->m_entityIds.emplace_back(mappedValue, inputAlias);
+                    }
+                    else if (!m_loadingInstance->RegisterEntity(mappedValue, inputAlias))
                     {
                         mappedValue = AZ::EntityId(AZ::EntityId::InvalidEntityId);
                         context.Report(JSR::Tasks::ReadField, JSR::Outcomes::DefaultsUsed,
@@ -142,6 +147,14 @@ namespace AzToolsFramework
         void InstanceEntityIdMapper::SetLoadingInstance(Instance& loadingInstance)
         {
             m_loadingInstance = &loadingInstance;
+            m_preloadedEntities = nullptr;
+        }
+
+        void InstanceEntityIdMapper::SetPreloadingInstance(AliasPath absoluteInstancePath, PreloadedInstanceEntities& preloadedEntities)
+        {
+            m_instanceAbsolutePath = AZStd::move(absoluteInstancePath);
+            m_preloadedEntities = &preloadedEntities;
+            m_loadingInstance = nullptr;
         }
 
         EntityAlias InstanceEntityIdMapper::ResolveReferenceId(const AZ::EntityId& entityId)
@@ -16,6 +16,7 @@ namespace AzToolsFramework
     namespace Prefab
     {
         class Instance;
+        struct PreloadedInstanceEntities;
 
         class InstanceEntityIdMapper final
             : public AZ::JsonEntityIdSerializer::JsonEntityIdMapper
@@ -38,6 +39,9 @@ namespace AzToolsFramework
 
             void SetStoringInstance(const Instance& storingInstance);
             void SetLoadingInstance(Instance& loadingInstance);
+            //! Maps the entity ids of a DOM that's loaded into an instance later, see InstanceEntityPreloader. Instead of being
+            //! registered with the instance, the ids of the entities are added to the preloaded entities.
+            void SetPreloadingInstance(AliasPath absoluteInstancePath, PreloadedInstanceEntities& preloadedEntities);
 
             static AZ::EntityId GenerateEntityIdForAliasPath(const AliasPathView& aliasPath, uint64_t seedKey = SeedKey);
 
@@ -48,6 +52,7 @@ namespace AzToolsFramework
 
             const Instance* m_storingInstance = nullptr;
             Instance* m_loadingInstance = nullptr;
+            PreloadedInstanceEntities* m_preloadedEntities = nullptr;
 
             uint64_t m_randomSeed = SeedKey;
 
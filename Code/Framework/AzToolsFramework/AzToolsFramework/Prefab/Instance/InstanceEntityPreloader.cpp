@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzToolsFramework/Prefab/Instance/InstanceEntityPreloader.h>
+
+#include <AzCore/Component/Entity.h>
+
+namespace AzToolsFramework
+{
+    namespace Prefab
+    {
+        void InstanceEntityPreloader::Add(const PrefabDomValue& instanceDom, PreloadedInstanceEntities&& entities)
+        {
+            m_preloadedEntities.insert_or_assign(&instanceDom, AZStd::move(entities));
+        }
+
+        PreloadedInstanceEntities* InstanceEntityPreloader::Find(const PrefabDomValue& instanceDom)
+        {
+            auto preloadedEntitiesIterator = m_preloadedEntities.find(&instanceDom);
+            return preloadedEntitiesIterator != m_preloadedEntities.end() ? &preloadedEntitiesIterator->second : nullptr;
+        }
+
+        void InstanceEntityPreloader::Clear()
+        {
+            m_preloadedEntities.clear();
+        }
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Serialization/Json/JsonSerializationResult.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzToolsFramework/Prefab/Instance/Instance.h>
+#include <AzToolsFramework/Prefab/PrefabDomTypes.h>
+
+namespace AzToolsFramework
+{
+    namespace Prefab
+    {
+        //! The entities of an instance DOM, deserialized before the DOM is loaded into the instance.
+        struct PreloadedInstanceEntities
+        {
+            AZStd::unique_ptr<AZ::Entity> m_containerEntity;
+            Instance::AliasToEntityMap m_entities;
+            //! The entity ids and aliases to register with the instance once the entities are moved into it.
+            AZStd::vector<AZStd::pair<AZ::EntityId, EntityAlias>> m_entityIds;
+            AZ::JsonSerializationResult::ResultCode m_result{ AZ::JsonSerializationResult::Tasks::ReadField };
+        };
+
+        //! Holds the entities of instance DOMs that were deserialized ahead of loading the instances. Deserializing the entities
+        //! only reads the DOMs, so it can run on worker threads for independent instances, while loading the instances changes the
+        //! instance hierarchy and has to run on the main thread. The JsonInstanceSerializer takes the preloaded entities of the DOMs
+        //! it loads instead of deserializing them again.
+        //! Entity ids are preloaded with the default hashed id generation, so the preloader can't be used for loads that assign random
+        //! entity ids.
+        class InstanceEntityPreloader
+        {
+        public:
+            AZ_TYPE_INFO(InstanceEntityPreloader, "{6B3E9D21-7C4A-4F58-A0E2-9D1B5C8F3A67}");
+            AZ_CLASS_ALLOCATOR(InstanceEntityPreloader, AZ::SystemAllocator, 0);
+
+            //! Adds the entities preloaded for an instance DOM. The DOM has to stay unchanged until it's loaded.
+            void Add(const PrefabDomValue& instanceDom, PreloadedInstanceEntities&& entities);
+
+            //! Returns the entities preloaded for an instance DOM or null if the DOM wasn't preloaded.
+            PreloadedInstanceEntities* Find(const PrefabDomValue& instanceDom);
+
+            void Clear();
+
+        private:
+            AZStd::unordered_map<const PrefabDomValue*, PreloadedInstanceEntities> m_preloadedEntities;
+        };
+    }
+}
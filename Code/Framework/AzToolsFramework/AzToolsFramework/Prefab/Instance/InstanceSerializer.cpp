@@ -13,6 +13,7 @@
 #include <AzToolsFramework/Prefab/Instance/InstanceSerializer.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityIdMapper.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityMapperInterface.h>
+#include <AzToolsFramework/Prefab/Instance/InstanceEntityPreloader.h>
 #include <AzToolsFramework/Prefab/PrefabLoaderInterface.h>
 #include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
 #include <Prefab/PrefabDomUtils.h>
@@ -186,18 +187,57 @@ namespace AzToolsFramework
                 (*idMapper)->SetLoadingInstance(*instance);
             }
 
+            InstanceEntityPreloader** preloader = context.GetMetadata().Find<InstanceEntityPreloader*>();
+            PreloadedInstanceEntities* preloadedEntities = preloader && *preloader ? (*preloader)->Find(inputValue) : nullptr;
+            if (preloadedEntities)
             {
-                JSR::ResultCode containerEntityResult = ContinueLoadingFromJsonObjectField(
-                    &instance->m_containerEntity, azrtti_typeid<decltype(instance->m_containerEntity)>(), inputValue, "ContainerEntity", context);
-
-                result.Combine(containerEntityResult);
+                // The entities of this instance were deserialized ahead of time, they only need to be registered with the instance.
+                instance->m_containerEntity = AZStd::move(preloadedEntities->m_containerEntity);
+                instance->m_entities = AZStd::move(preloadedEntities->m_entities);
+                for (const auto& [entityId, entityAlias] : preloadedEntities->m_entityIds)
+                {
+                    if (!instance->RegisterEntity(entityId, entityAlias))
+                    {
+                        // Like the entities loaded through the entity id mapper, the entity is left with the default invalid id.
+                        AZ::Entity* entity = nullptr;
+                        if (auto entityIt = instance->m_entities.find(entityAlias);
+                            entityIt != instance->m_entities.end() && entityIt->second && entityIt->second->GetId() == entityId)
+                        {
+                            entity = entityIt->second.get();
+                        }
+                        else if (instance->m_containerEntity && instance->m_containerEntity->GetId() == entityId)
+                        {
+                            entity = instance->m_containerEntity.get();
+                        }
+
+                        if (entity)
+                        {
+                            entity->SetId(AZ::EntityId(AZ::EntityId::InvalidEntityId));
+                        }
+
+                        result.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::DefaultsUsed,
+                            "Unable to register preloaded entity Id with prefab instance during load. Using default invalid id"));
+                    }
+                }
+                preloadedEntities->m_entityIds.clear();
+                AddEntitiesToScrub(instance, context);
+                result.Combine(preloadedEntities->m_result);
             }
-
+            else
             {
-                JSR::ResultCode entitiesResult = ContinueLoadingFromJsonObjectField(
-                    &instance->m_entities, azrtti_typeid<Instance::AliasToEntityMap>(), inputValue, "Entities", context);
-                AddEntitiesToScrub(instance, context);
-                result.Combine(entitiesResult);
+                {
+                    JSR::ResultCode containerEntityResult = ContinueLoadingFromJsonObjectField(
+                        &instance->m_containerEntity, azrtti_typeid<decltype(instance->m_containerEntity)>(), inputValue, "ContainerEntity", context);
+
+                    result.Combine(containerEntityResult);
+                }
+
+                {
+                    JSR::ResultCode entitiesResult = ContinueLoadingFromJsonObjectField(
+                        &instance->m_entities, azrtti_typeid<Instance::AliasToEntityMap>(), inputValue, "Entities", context);
+                    AddEntitiesToScrub(instance, context);
+                    result.Combine(entitiesResult);
+                }
             }
 
             {
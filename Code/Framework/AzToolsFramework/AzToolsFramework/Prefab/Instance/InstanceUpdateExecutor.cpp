@@ -10,6 +10,9 @@
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
 #include <AzToolsFramework/API/ToolsApplicationAPI.h>
@@ -26,6 +29,8 @@ namespace AzToolsFramework
 {
     namespace Prefab
     {
+        static constexpr const char s_parallelPropagationKey[] = "/O3DE/Preferences/Prefabs/ParallelPropagation";
+
         InstanceUpdateExecutor::InstanceUpdateExecutor(int instanceCountToUpdateInBatch)
             : m_instanceCountToUpdateInBatch(instanceCountToUpdateInBatch)
         { 
@@ -88,6 +93,14 @@ namespace AzToolsFramework
             {
                 return entry == instance;
             });
+
+            for (InstanceUpdate& instanceUpdate : m_instanceUpdates)
+            {
+                if (instanceUpdate.m_instance == instance)
+                {
+                    instanceUpdate.m_instance = nullptr;
+                }
+            }
         }
 
         bool InstanceUpdateExecutor::UpdateTemplateInstancesInQueue()
@@ -109,23 +122,33 @@ namespace AzToolsFramework
 
                     EntityIdList selectedEntityIds;
                     ToolsApplicationRequestBus::BroadcastResult(selectedEntityIds, &ToolsApplicationRequests::GetSelectedEntities);
-                    PrefabDom instanceDomFromRootDocument;
+
+                    const bool shouldPreloadEntities = ShouldPreloadEntities();
+                    m_instanceUpdates.reserve(AZStd::min(static_cast<size_t>(instanceCountToUpdateInBatch), InstanceUpdateChunkSize));
 
                     // Process all instances in the queue, capped to the batch size.
                     // Even though we potentially initialized the batch size to the queue, it's possible for the queue size to shrink
                     // during instance processing if the instance gets deleted and it was queued multiple times.  To handle this, we
                     // make sure to end the loop once the queue is empty, regardless of what the initial size was.
-                    for (int i = 0; (i < instanceCountToUpdateInBatch) && !m_instancesUpdateQueue.empty(); ++i)
+                    int instanceCountLeftInBatch = instanceCountToUpdateInBatch;
+                    while (instanceCountLeftInBatch > 0 && !m_instancesUpdateQueue.empty())
                     {
-                        Instance* instanceToUpdate = m_instancesUpdateQueue.front();
-                        m_instancesUpdateQueue.pop_front();
-                        AZ_Assert(instanceToUpdate != nullptr, "Invalid instance on update queue.");
-
-                        TemplateId instanceTemplateId = instanceToUpdate->GetTemplateId();
-                        if (currentTemplateId != instanceTemplateId)
+                        // Find the DOMs of the next chunk of instances in their top level ancestor's DOM.
+                        for (; (instanceCountLeftInBatch > 0) && !m_instancesUpdateQueue.empty() &&
+                               m_instanceUpdates.size() < InstanceUpdateChunkSize;
+                             --instanceCountLeftInBatch)
                         {
-                            currentTemplateId = instanceTemplateId;
-                            currentTemplateReference = m_prefabSystemComponentInterface->FindTemplate(currentTemplateId);
+                            Instance* instanceToUpdate = m_instancesUpdateQueue.front();
+                            m_instancesUpdateQueue.pop_front();
+                            AZ_Assert(instanceToUpdate != nullptr, "Invalid instance on update queue.");
+
+                            TemplateId instanceTemplateId = instanceToUpdate->GetTemplateId();
+                            if (currentTemplateId != instanceTemplateId)
+                            {
+                                currentTemplateId = instanceTemplateId;
+                                currentTemplateReference = m_prefabSystemComponentInterface->FindTemplate(currentTemplateId);
+                            }
+
                             if (!currentTemplateReference.has_value())
                             {
                                 AZ_Error(
@@ -138,103 +161,85 @@ namespace AzToolsFramework
                                 isUpdateSuccessful = false;
                                 continue;
                             }
-                        }
 
-                        auto findInstancesResult = m_templateInstanceMapperInterface->FindInstancesOwnedByTemplate(instanceTemplateId);
-                        AZ_Assert(
-                            findInstancesResult.has_value(), "Prefab Instances corresponding to template with id %llu couldn't be found.",
-                            instanceTemplateId);
+                            auto findInstancesResult = m_templateInstanceMapperInterface->FindInstancesOwnedByTemplate(instanceTemplateId);
+                            AZ_Assert(
+                                findInstancesResult.has_value(), "Prefab Instances corresponding to template with id %llu couldn't be found.",
+                                instanceTemplateId);
 
-                        if (findInstancesResult == AZStd::nullopt ||
-                            findInstancesResult->get().find(instanceToUpdate) == findInstancesResult->get().end())
-                        {
-                            // Since nested instances get reconstructed during propagation, remove any nested instance that no longer
-                            // maps to a template.
-                            isUpdateSuccessful = false;
-                            continue;
-                        }
+                            if (findInstancesResult == AZStd::nullopt ||
+                                findInstancesResult->get().find(instanceToUpdate) == findInstancesResult->get().end())
+                            {
+                                // Since nested instances get reconstructed during propagation, remove any nested instance that no longer
+                                // maps to a template.
+                                isUpdateSuccessful = false;
+                                continue;
+                            }
 
-                        EntityList newEntities;
+                            // Climb up to the root of the instance hierarchy from this instance
+                            InstanceOptionalConstReference rootInstance = *instanceToUpdate;
+                            AZStd::vector<InstanceOptionalConstReference> pathOfInstances;
 
-                        // Climb up to the root of the instance hierarchy from this instance
-                        InstanceOptionalConstReference rootInstance = *instanceToUpdate;
-                        AZStd::vector<InstanceOptionalConstReference> pathOfInstances;
+                            while (rootInstance->get().GetParentInstance() != AZStd::nullopt)
+                            {
+                                pathOfInstances.emplace_back(rootInstance);
+                                rootInstance = rootInstance->get().GetParentInstance();
+                            }
 
-                        while (rootInstance->get().GetParentInstance() != AZStd::nullopt)
-                        {
-                            pathOfInstances.emplace_back(rootInstance);
-                            rootInstance = rootInstance->get().GetParentInstance();
-                        }
+                            AZStd::string aliasPathResult = "";
+                            for (auto instanceIter = pathOfInstances.rbegin(); instanceIter != pathOfInstances.rend(); ++instanceIter)
+                            {
+                                aliasPathResult.append("/Instances/");
+                                aliasPathResult.append((*instanceIter)->get().GetInstanceAlias());
+                            }
 
-                        AZStd::string aliasPathResult = "";
-                        for (auto instanceIter = pathOfInstances.rbegin(); instanceIter != pathOfInstances.rend(); ++instanceIter)
-                        {
-                            aliasPathResult.append("/Instances/");
-                            aliasPathResult.append((*instanceIter)->get().GetInstanceAlias());
-                        }
+                            PrefabDomPath rootPrefabDomPath(aliasPathResult.c_str());
 
-                        PrefabDomPath rootPrefabDomPath(aliasPathResult.c_str());
+                            const PrefabDom& rootPrefabTemplateDom =
+                                m_prefabSystemComponentInterface->FindTemplateDom(rootInstance->get().GetTemplateId());
 
-                        PrefabDom& rootPrefabTemplateDom =
-                            m_prefabSystemComponentInterface->FindTemplateDom(rootInstance->get().GetTemplateId());
+                            const PrefabDomValue* instanceDomFromRootValue = rootPrefabDomPath.Get(rootPrefabTemplateDom);
+                            if (!instanceDomFromRootValue)
+                            {
+                                AZ_Assert(
+                                    false,
+                                    "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
+                                    "Could not load Instance DOM from the top level ancestor's DOM.");
 
-                        auto instanceDomFromRootValue = rootPrefabDomPath.Get(rootPrefabTemplateDom);
-                        if (!instanceDomFromRootValue)
-                        {
-                            AZ_Assert(
-                                false,
-                                "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
-                                "Could not load Instance DOM from the top level ancestor's DOM.");
+                                isUpdateSuccessful = false;
+                                continue;
+                            }
 
-                            isUpdateSuccessful = false;
-                            continue;
+                            InstanceUpdate& instanceUpdate = m_instanceUpdates.emplace_back();
+                            instanceUpdate.m_instance = instanceToUpdate;
+                            instanceUpdate.m_template = &currentTemplateReference->get();
+                            instanceUpdate.m_instanceDomFromRoot = instanceDomFromRootValue;
+                            if (shouldPreloadEntities)
+                            {
+                                instanceUpdate.m_absoluteInstancePath = instanceToUpdate->GetAbsoluteInstanceAliasPath();
+                            }
                         }
 
-                        PrefabDomValueReference instanceDomFromRoot = *instanceDomFromRootValue;
-                        if (!instanceDomFromRoot.has_value())
+                        if (shouldPreloadEntities && m_instanceUpdates.size() > 1)
                         {
-                            AZ_Assert(
-                                false,
-                                "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
-                                "Could not load Instance DOM from the top level ancestor's DOM.");
-
-                            isUpdateSuccessful = false;
-                            continue;
+                            PreloadInstanceUpdateEntities();
                         }
 
-                        // If a link was created for a nested instance before the changes were propagated,
-                        // then we associate it correctly here
-                        instanceDomFromRootDocument.CopyFrom(instanceDomFromRoot->get(), instanceDomFromRootDocument.GetAllocator());
-                        if (PrefabDomUtils::LoadInstanceFromPrefabDom(*instanceToUpdate, newEntities, instanceDomFromRootDocument))
+                        for (InstanceUpdate& instanceUpdate : m_instanceUpdates)
                         {
-                            Template& currentTemplate = currentTemplateReference->get();
-                            instanceToUpdate->GetNestedInstances([&](AZStd::unique_ptr<Instance>& nestedInstance) 
+                            // Instances can be removed by the update of an ancestor that was earlier in the chunk.
+                            if (!instanceUpdate.m_instance)
                             {
-                                if (nestedInstance->GetLinkId() != InvalidLinkId)
-                                {
-                                    return;
-                                }
-
-                                for (auto linkId : currentTemplate.GetLinks())
-                                {
-                                    LinkReference nestedLink = m_prefabSystemComponentInterface->FindLink(linkId);
-                                    if (!nestedLink.has_value())
-                                    {
-                                        continue;
-                                    }
-
-                                    if (nestedLink->get().GetInstanceName() == nestedInstance->GetInstanceAlias())
-                                    {
-                                        nestedInstance->SetLinkId(linkId);
-                                        break;
-                                    }
-                                }
-                            });
-
-                            AzToolsFramework::EditorEntityContextRequestBus::Broadcast(
-                                &AzToolsFramework::EditorEntityContextRequests::HandleEntitiesAdded, newEntities);
+                                isUpdateSuccessful = false;
+                                continue;
+                            }
+
+                            LoadInstanceUpdate(instanceUpdate);
                         }
+
+                        m_instanceUpdates.clear();
                     }
+
                     for (auto entityIdIterator = selectedEntityIds.begin(); entityIdIterator != selectedEntityIds.end(); entityIdIterator++)
                     {
                         // Since entities get recreated during propagation, we need to check whether the entities
@@ -256,5 +261,82 @@ namespace AzToolsFramework
 
             return isUpdateSuccessful;
         }
+
+        bool InstanceUpdateExecutor::ShouldPreloadEntities() const
+        {
+            bool parallelPropagation = true;
+            if (auto* registry = AZ::SettingsRegistry::Get())
+            {
+                registry->Get(parallelPropagation, s_parallelPropagationKey);
+            }
+            return parallelPropagation && AZ::JobContext::GetGlobalContext() != nullptr;
+        }
+
+        void InstanceUpdateExecutor::PreloadInstanceUpdateEntities()
+        {
+            // Copying the DOMs and deserializing their entities only reads the template DOMs, which don't change while the instances
+            // are updated, so the instances of a chunk are preloaded independently.
+            AZ::parallel_for(0, static_cast<int>(m_instanceUpdates.size()), [this](int instanceUpdateIndex)
+            {
+                InstanceUpdate& instanceUpdate = m_instanceUpdates[instanceUpdateIndex];
+                instanceUpdate.m_instanceDom.CopyFrom(*instanceUpdate.m_instanceDomFromRoot, instanceUpdate.m_instanceDom.GetAllocator());
+                PrefabDomUtils::PreloadInstanceEntitiesFromPrefabDom(
+                    instanceUpdate.m_preloader, instanceUpdate.m_instanceDom, instanceUpdate.m_absoluteInstancePath);
+                instanceUpdate.m_isPreloaded = true;
+            });
+        }
+
+        void InstanceUpdateExecutor::LoadInstanceUpdate(InstanceUpdate& instanceUpdate)
+        {
+            Instance* instanceToUpdate = instanceUpdate.m_instance;
+            EntityList newEntities;
+
+            bool isLoaded = false;
+            if (instanceUpdate.m_isPreloaded)
+            {
+                isLoaded = PrefabDomUtils::LoadInstanceFromPrefabDom(
+                    *instanceToUpdate, newEntities, instanceUpdate.m_instanceDom, instanceUpdate.m_preloader);
+            }
+            else
+            {
+                instanceUpdate.m_instanceDom.CopyFrom(*instanceUpdate.m_instanceDomFromRoot, instanceUpdate.m_instanceDom.GetAllocator());
+                isLoaded = PrefabDomUtils::LoadInstanceFromPrefabDom(*instanceToUpdate, newEntities, instanceUpdate.m_instanceDom);
+            }
+
+            // If a link was created for a nested instance before the changes were propagated,
+            // then we associate it correctly here
+            if (isLoaded)
+            {
+                Template& currentTemplate = *instanceUpdate.m_template;
+                instanceToUpdate->GetNestedInstances([&](AZStd::unique_ptr<Instance>& nestedInstance)
+                {
+                    if (nestedInstance->GetLinkId() != InvalidLinkId)
+                    {
+                        return;
+                    }
+
+                    for (auto linkId : currentTemplate.GetLinks())
+                    {
+                        LinkReference nestedLink = m_prefabSystemComponentInterface->FindLink(linkId);
+                        if (!nestedLink.has_value())
+                        {
+                            continue;
+                        }
+
+                        if (nestedLink->get().GetInstanceName() == nestedInstance->GetInstanceAlias())
+                        {
+                            nestedInstance->SetLinkId(linkId);
+                            break;
+                        }
+                    }
+                });
+
+                AzToolsFramework::EditorEntityContextRequestBus::Broadcast(
+                    &AzToolsFramework::EditorEntityContextRequests::HandleEntitiesAdded, newEntities);
+            }
+
+            // Release the preloaded entities the load didn't take, such as those of nested instances that failed to load.
+            instanceUpdate.m_preloader.Clear();
+        }
     }
 }
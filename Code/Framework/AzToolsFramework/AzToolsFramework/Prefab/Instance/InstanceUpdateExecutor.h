@@ -11,7 +11,10 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzToolsFramework/Prefab/Instance/InstanceEntityPreloader.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceUpdateExecutorInterface.h>
+#include <AzToolsFramework/Prefab/PrefabDomTypes.h>
 #include <AzToolsFramework/Prefab/PrefabIdTypes.h>
 
 namespace AzToolsFramework
@@ -20,8 +23,14 @@ namespace AzToolsFramework
     {
         class Instance;
         class PrefabSystemComponentInterface;
+        class Template;
         class TemplateInstanceMapperInterface;
 
+        //! Updates the instances of changed templates from the template DOMs.
+        //! Instances are updated in chunks. The entities of the instances in a chunk are first deserialized from their DOMs on the job
+        //! system, since that only reads the template DOMs. The instances are then loaded with the preloaded entities and their
+        //! entities are added to the editor on the main thread. Preloading can be turned off with the
+        //! "/O3DE/Preferences/Prefabs/ParallelPropagation" setting.
         class InstanceUpdateExecutor
             : public InstanceUpdateExecutorInterface
         {
@@ -39,10 +48,31 @@ namespace AzToolsFramework
             void UnregisterInstanceUpdateExecutorInterface();
 
         private:
+            //! An instance taken from the queue and the DOM it's updated from.
+            struct InstanceUpdate
+            {
+                //! Set to null if the instance is removed while it's being updated.
+                Instance* m_instance = nullptr;
+                Template* m_template = nullptr;
+                const PrefabDomValue* m_instanceDomFromRoot = nullptr;
+                AliasPath m_absoluteInstancePath;
+                PrefabDom m_instanceDom;
+                InstanceEntityPreloader m_preloader;
+                bool m_isPreloaded = false;
+            };
+
+            //! The number of instances whose entities are preloaded together, which bounds the memory held by preloaded entities.
+            static constexpr size_t InstanceUpdateChunkSize = 128;
+
+            bool ShouldPreloadEntities() const;
+            void PreloadInstanceUpdateEntities();
+            void LoadInstanceUpdate(InstanceUpdate& instanceUpdate);
+
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
             TemplateInstanceMapperInterface* m_templateInstanceMapperInterface = nullptr;
             int m_instanceCountToUpdateInBatch = 0;
             AZStd::deque<Instance*> m_instancesUpdateQueue;
+            AZStd::vector<InstanceUpdate> m_instanceUpdates;
             bool m_updatingTemplateInstancesInQueue { false };
         };
     }
@@ -16,6 +16,7 @@
 #include <AzToolsFramework/Prefab/Instance/Instance.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityScrubber.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityIdMapper.h>
+#include <AzToolsFramework/Prefab/Instance/InstanceEntityPreloader.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceSerializer.h>
 
 #include <QDebug>
@@ -172,6 +173,89 @@ namespace AzToolsFramework
 
                     return true;
                 }
+
+                static bool LoadInstanceHelper(
+                    Instance& instance,
+                    EntityList& newlyAddedEntities,
+                    const PrefabDom& prefabDom,
+                    LoadFlags flags,
+                    InstanceEntityPreloader* preloader)
+                {
+                    AZ::JsonDeserializerSettings settings;
+                    settings.m_metadata.Create<InstanceEntityScrubber>(newlyAddedEntities);
+                    if (preloader)
+                    {
+                        settings.m_metadata.Add(preloader);
+                    }
+
+                    AZStd::string scratchBuffer;
+                    auto issueReportingCallback = [&scratchBuffer](
+                        AZStd::string_view message, AZ::JsonSerializationResult::ResultCode result,
+                        AZStd::string_view path) -> AZ::JsonSerializationResult::ResultCode
+                    {
+                        return Internal::JsonIssueReporter(scratchBuffer, message, result, path);
+                    };
+                    settings.m_reporting = AZStd::move(issueReportingCallback);
+
+                    return LoadInstanceHelper(instance, prefabDom, flags, settings);
+                }
+
+                static bool PreloadInstanceEntitiesHelper(
+                    InstanceEntityPreloader& preloader,
+                    const PrefabDomValue& prefabDom,
+                    const AliasPath& absoluteInstancePath,
+                    InstanceEntityIdMapper& entityIdMapper,
+                    AZ::JsonDeserializerSettings& settings)
+                {
+                    if (!prefabDom.IsObject())
+                    {
+                        return false;
+                    }
+
+                    // Nested instances are loaded before the entities of their parent, mirroring the JsonInstanceSerializer.
+                    bool isPreloaded = true;
+                    PrefabDomValueConstReference instancesReference = GetInstancesValue(prefabDom);
+                    if (instancesReference.has_value())
+                    {
+                        const PrefabDomValue& instances = instancesReference->get();
+                        for (PrefabDomValue::ConstMemberIterator instanceIterator = instances.MemberBegin();
+                             instanceIterator != instances.MemberEnd(); ++instanceIterator)
+                        {
+                            AliasPath nestedInstancePath = absoluteInstancePath;
+                            nestedInstancePath.Append(
+                                InstanceAlias(instanceIterator->name.GetString(), instanceIterator->name.GetStringLength()));
+                            isPreloaded = PreloadInstanceEntitiesHelper(
+                                preloader, instanceIterator->value, nestedInstancePath, entityIdMapper, settings) && isPreloaded;
+                        }
+                    }
+
+                    PreloadedInstanceEntities preloadedEntities;
+                    entityIdMapper.SetPreloadingInstance(absoluteInstancePath, preloadedEntities);
+
+                    PrefabDomValueConstReference containerEntityValue = FindPrefabDomValue(prefabDom, ContainerEntityName);
+                    if (containerEntityValue.has_value())
+                    {
+                        preloadedEntities.m_result.Combine(AZ::JsonSerialization::Load(
+                            &preloadedEntities.m_containerEntity, azrtti_typeid<decltype(preloadedEntities.m_containerEntity)>(),
+                            containerEntityValue->get(), settings));
+                    }
+
+                    PrefabDomValueConstReference entitiesValue = FindPrefabDomValue(prefabDom, EntitiesName);
+                    if (entitiesValue.has_value())
+                    {
+                        preloadedEntities.m_result.Combine(AZ::JsonSerialization::Load(
+                            &preloadedEntities.m_entities, azrtti_typeid<Instance::AliasToEntityMap>(), entitiesValue->get(), settings));
+                    }
+
+                    // Instances whose entities couldn't be preloaded are deserialized as usual when they're loaded.
+                    if (preloadedEntities.m_result.GetProcessing() == AZ::JsonSerializationResult::Processing::Halted)
+                    {
+                        return false;
+                    }
+
+                    preloader.Add(prefabDom, AZStd::move(preloadedEntities));
+                    return isPreloaded;
+                }
             }
 
             PrefabDomValueReference FindPrefabDomValue(PrefabDomValue& parentValue, const char* valueName)
@@ -264,9 +348,28 @@ namespace AzToolsFramework
             bool LoadInstanceFromPrefabDom(
                 Instance& instance, EntityList& newlyAddedEntities, const PrefabDom& prefabDom, LoadFlags flags)
             {
+                return Internal::LoadInstanceHelper(instance, newlyAddedEntities, prefabDom, flags, nullptr);
+            }
+
+            bool LoadInstanceFromPrefabDom(
+                Instance& instance, EntityList& newlyAddedEntities, const PrefabDom& prefabDom, InstanceEntityPreloader& preloader)
+            {
+                // Preloaded entities use hashed entity ids, so random ids can't be requested here.
+                return Internal::LoadInstanceHelper(instance, newlyAddedEntities, prefabDom, LoadFlags::None, &preloader);
+            }
+
+            bool PreloadInstanceEntitiesFromPrefabDom(
+                InstanceEntityPreloader& preloader, const PrefabDomValue& prefabDom, const AliasPath& absoluteInstancePath)
+            {
+                InstanceEntityIdMapper entityIdMapper;
+
+                auto tracker = AZ::Data::SerializedAssetTracker{};
+                tracker.SetAssetFixUp(&Internal::FixUpInvalidAssets);
 
                 AZ::JsonDeserializerSettings settings;
-                settings.m_metadata.Create<InstanceEntityScrubber>(newlyAddedEntities);
+                settings.m_metadata.Add(static_cast<AZ::JsonEntityIdSerializer::JsonEntityIdMapper*>(&entityIdMapper));
+                settings.m_metadata.Add(&entityIdMapper);
+                settings.m_metadata.Add(tracker);
 
                 AZStd::string scratchBuffer;
                 auto issueReportingCallback = [&scratchBuffer](
@@ -277,7 +380,7 @@ namespace AzToolsFramework
                 };
                 settings.m_reporting = AZStd::move(issueReportingCallback);
 
-                return Internal::LoadInstanceHelper(instance, prefabDom, flags, settings);
+                return Internal::PreloadInstanceEntitiesHelper(preloader, prefabDom, absoluteInstancePath, entityIdMapper, settings);
             }
 
             void GetTemplateSourcePaths(const PrefabDomValue& prefabDom, AZStd::unordered_set<AZ::IO::Path>& templateSourcePaths)
@@ -19,6 +19,7 @@ namespace AzToolsFramework
     namespace Prefab
     {
         class Instance;
+        class InstanceEntityPreloader;
         namespace PrefabDomUtils
         {
             inline static const char* InstancesName = "Instances";
@@ -136,6 +137,31 @@ namespace AzToolsFramework
                 Instance& instance, EntityList& newlyAddedEntities, const PrefabDom& prefabDom,
                 LoadFlags flags = LoadFlags::None);
 
+            /**
+            * Loads a valid Prefab Instance from a Prefab Dom, taking the entities that were preloaded from the Prefab Dom instead of
+            * deserializing them again.
+            * @param instance The Instance to load.
+            * @param newlyAddedEntities The new instances added during deserializing the instance. These are the entities found
+            *       in the prefabDom.
+            * @param prefabDom The prefabDom that will be used to load the Instance data.
+            * @param preloader The entities preloaded with PreloadInstanceEntitiesFromPrefabDom.
+            * @return bool on whether the operation succeeded.
+            */
+            bool LoadInstanceFromPrefabDom(
+                Instance& instance, EntityList& newlyAddedEntities, const PrefabDom& prefabDom, InstanceEntityPreloader& preloader);
+
+            /**
+            * Deserializes the entities of a Prefab Dom and of the instances nested in it ahead of loading an Instance from the Prefab Dom.
+            * Only the Prefab Dom is read, so the entities of independent instances can be preloaded on multiple threads with a
+            * preloader per thread.
+            * @param preloader The preloader the entities are added to.
+            * @param prefabDom The prefabDom the Instance will be loaded from. It has to stay unchanged until the Instance is loaded.
+            * @param absoluteInstancePath The absolute alias path of the Instance the prefabDom will be loaded into.
+            * @return bool on whether the entities of all the instances in the prefabDom were preloaded.
+            */
+            bool PreloadInstanceEntitiesFromPrefabDom(
+                InstanceEntityPreloader& preloader, const PrefabDomValue& prefabDom, const AliasPath& absoluteInstancePath);
+
             inline PrefabDomPath GetPrefabDomInstancePath(const char* instanceName)
             {
                 return PrefabDomPath()
@@ -683,6 +683,8 @@ set(FILES
     Prefab/Instance/InstanceEntityMapper.h
     Prefab/Instance/InstanceEntityMapper.cpp
     Prefab/Instance/InstanceEntityMapperInterface.h
+    Prefab/Instance/InstanceEntityPreloader.h
+    Prefab/Instance/InstanceEntityPreloader.cpp
     Prefab/Instance/InstanceToTemplateInterface.h
     Prefab/Instance/InstanceToTemplatePropagator.cpp
     Prefab/Instance/InstanceToTemplatePropagator.h
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzToolsFramework/Prefab/PrefabDomUtils.h>
+#include <Prefab/Benchmark/PrefabBenchmarkFixture.h>
+
+namespace Benchmark
+{
+    using namespace AzToolsFramework::Prefab;
+
+    //! This class captures benchmarks for propagating a change to a template that many independent prefab instances depend on.
+    //! The first argument is the number of entities in the changed prefab, the second one turns the parallel preloading of the
+    //! entities of the updated instances on or off.
+    class MultipleInstanceFanOutBenchmarks : public Benchmark::BM_Prefab
+    {
+    protected:
+        static constexpr unsigned int InstanceCount = 1000;
+
+        void SetupHarness(const benchmark::State& state) override
+        {
+            BM_Prefab::SetupHarness(state);
+
+            if (auto* registry = AZ::SettingsRegistry::Get())
+            {
+                registry->Set("/O3DE/Preferences/Prefabs/ParallelPropagation", state.range(1) != 0);
+            }
+        }
+
+        void TeardownHarness(const benchmark::State& state) override
+        {
+            m_instances.clear();
+            m_instanceToModify.reset();
+            BM_Prefab::TeardownHarness(state);
+        }
+
+        //! Creates the prefab that's changed, whose first entity is the one the benchmarks modify.
+        void CreateInstanceToModify(const benchmark::State& state, const AZ::IO::Path& templatePath)
+        {
+            const unsigned int numEntities = static_cast<unsigned int>(state.range(0));
+
+            AZStd::vector<AZ::Entity*> entities;
+            m_entityModify = CreateEntity("Entity");
+            entities.emplace_back(m_entityModify);
+            for (unsigned int i = 1; i < numEntities; i++)
+            {
+                entities.emplace_back(CreateEntity("Entity"));
+            }
+
+            m_instanceToModify = m_prefabSystemComponent->CreatePrefab(entities, {}, templatePath);
+        }
+
+        void InstantiatePrefabs(TemplateId templateId)
+        {
+            m_instances.reserve(InstanceCount);
+            for (unsigned int instanceIndex = 0; instanceIndex < InstanceCount; ++instanceIndex)
+            {
+                m_instances.emplace_back(m_prefabSystemComponent->InstantiatePrefab(templateId));
+            }
+        }
+
+        void MoveEntityToModify()
+        {
+            float worldX = 0.0f;
+            AZ::TransformBus::EventResult(worldX, m_entityModify->GetId(), &AZ::TransformInterface::GetWorldX);
+            AZ::TransformBus::Event(m_entityModify->GetId(), &AZ::TransformInterface::SetWorldX, worldX + 1);
+        }
+
+        AZ::Entity* m_entityModify = nullptr;
+        AZStd::unique_ptr<Instance> m_instanceToModify;
+        AZStd::vector<AZStd::unique_ptr<Instance>> m_instances;
+    };
+
+    BENCHMARK_DEFINE_F(MultipleInstanceFanOutBenchmarks, PropagateUpdateComponentChange_FanOut)(benchmark::State& state)
+    {
+        CreateFakePaths(1);
+        CreateInstanceToModify(state, m_paths.front());
+        const TemplateId templateId = m_instanceToModify->GetTemplateId();
+        InstantiatePrefabs(templateId);
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+
+            // Move the entity and update the template to capture this transform component change.
+            MoveEntityToModify();
+            PrefabDom updatedPrefabDom;
+            PrefabDomUtils::StoreInstanceInPrefabDom(*m_instanceToModify, updatedPrefabDom);
+            PrefabDom& templatePrefabDom = m_prefabSystemComponent->FindTemplateDom(templateId);
+            templatePrefabDom.CopyFrom(updatedPrefabDom, templatePrefabDom.GetAllocator());
+            m_instanceUpdateExecutorInterface->AddTemplateInstancesToQueue(templateId, *m_instanceToModify);
+
+            state.ResumeTiming();
+
+            m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+        }
+
+        state.SetComplexityN(state.range(0) * InstanceCount);
+    }
+
+    BENCHMARK_REGISTER_F(MultipleInstanceFanOutBenchmarks, PropagateUpdateComponentChange_FanOut)
+        ->ArgNames({ "Entities", "Parallel" })
+        ->Args({ 10, 0 })
+        ->Args({ 10, 1 })
+        ->Args({ 100, 0 })
+        ->Args({ 100, 1 })
+        ->Unit(benchmark::kMillisecond);
+
+    //! Changes a prefab that's nested in a prefab with many instances, so every instance of the enclosing prefab is updated.
+    BENCHMARK_DEFINE_F(MultipleInstanceFanOutBenchmarks, PropagateUpdateComponentChange_NestedFanOut)(benchmark::State& state)
+    {
+        CreateFakePaths(2);
+        CreateInstanceToModify(state, m_paths.front());
+        const TemplateId nestedTemplateId = m_instanceToModify->GetTemplateId();
+
+        AZStd::unique_ptr<Instance> enclosingInstance = m_prefabSystemComponent->CreatePrefab(
+            {}, MakeInstanceList(m_prefabSystemComponent->InstantiatePrefab(nestedTemplateId)), m_paths.back());
+        const TemplateId enclosingTemplateId = enclosingInstance->GetTemplateId();
+        InstantiatePrefabs(enclosingTemplateId);
+        m_instances.emplace_back(AZStd::move(enclosingInstance));
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+
+            // Updating the nested template applies the change to the links of the enclosing template and queues its instances.
+            MoveEntityToModify();
+            PrefabDom updatedPrefabDom;
+            PrefabDomUtils::StoreInstanceInPrefabDom(*m_instanceToModify, updatedPrefabDom);
+            m_prefabSystemComponent->UpdatePrefabTemplate(nestedTemplateId, updatedPrefabDom);
+            // The modified instance already has the change, and reloading it would destroy the entity that's modified.
+            m_instanceUpdateExecutorInterface->RemoveTemplateInstanceFromQueue(m_instanceToModify.get());
+
+            state.ResumeTiming();
+
+            m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+        }
+
+        state.SetComplexityN(state.range(0) * InstanceCount);
+    }
+
+    BENCHMARK_REGISTER_F(MultipleInstanceFanOutBenchmarks, PropagateUpdateComponentChange_NestedFanOut)
+        ->ArgNames({ "Entities", "Parallel" })
+        ->Args({ 10, 0 })
+        ->Args({ 10, 1 })
+        ->Args({ 100, 0 })
+        ->Args({ 100, 1 })
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+
+#endif
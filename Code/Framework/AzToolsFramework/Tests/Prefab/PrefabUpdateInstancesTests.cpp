@@ -6,7 +6,12 @@
  *
  */
 
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/std/sort.h>
 #include <AzToolsFramework/Entity/PrefabEditorEntityOwnershipInterface.h>
+#include <AzToolsFramework/Prefab/Instance/InstanceEntityPreloader.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
 #include <Prefab/PrefabTestComponent.h>
 #include <Prefab/PrefabTestDomUtils.h>
@@ -451,4 +456,145 @@ namespace UnitTest
         PrefabTestDomUtils::ValidateInstances(newTemplateId, *entityComponents, entityComponentsPath);
     }
 
+    TEST_F(PrefabUpdateInstancesTest, UpdatePrefabInstances_PreloadedEntities_MatchLoadedEntities)
+    {
+        // Create an enclosing Template with 1 entity and 1 nested Instance owning a single entity.
+        AZ::Entity* nestedEntity = CreateEntity("Nested Entity");
+        AZStd::unique_ptr<Instance> newNestedInstance =
+            m_prefabSystemComponent->CreatePrefab({ nestedEntity }, {}, NestedPrefabMockFilePath);
+        TemplateId newNestedTemplateId = newNestedInstance->GetTemplateId();
+        ASSERT_TRUE(newNestedTemplateId != InvalidTemplateId);
+
+        AZ::Entity* enclosingEntity = CreateEntity("Enclosing Entity");
+        AZStd::unique_ptr<Instance> newEnclosingInstance = m_prefabSystemComponent->CreatePrefab(
+            { enclosingEntity }, MakeInstanceList(m_prefabSystemComponent->InstantiatePrefab(newNestedTemplateId)), PrefabMockFilePath);
+        TemplateId newEnclosingTemplateId = newEnclosingInstance->GetTemplateId();
+        ASSERT_TRUE(newEnclosingTemplateId != InvalidTemplateId);
+        const PrefabDom& newEnclosingTemplateDom = m_prefabSystemComponent->FindTemplateDom(newEnclosingTemplateId);
+
+        // Instantiate the enclosing Template and collect the entity ids of the Instance hierarchy.
+        AZStd::unique_ptr<Instance> instance = m_prefabSystemComponent->InstantiatePrefab(newEnclosingTemplateId);
+        ASSERT_TRUE(instance);
+
+        auto collectEntityIds = [](const Instance& instanceToCollect)
+        {
+            AZStd::vector<AZ::EntityId> entityIds;
+            instanceToCollect.GetAllEntitiesInHierarchyConst([&entityIds](const AZ::Entity& entity)
+            {
+                entityIds.push_back(entity.GetId());
+                return true;
+            });
+            AZStd::sort(entityIds.begin(), entityIds.end());
+            return entityIds;
+        };
+        const AZStd::vector<AZ::EntityId> loadedEntityIds = collectEntityIds(*instance);
+        EXPECT_EQ(loadedEntityIds.size(), 4);
+
+        // Preload the entities of the Instance DOM and reload the Instance with them.
+        PrefabDom instanceDom;
+        instanceDom.CopyFrom(newEnclosingTemplateDom, instanceDom.GetAllocator());
+        InstanceEntityPreloader preloader;
+        ASSERT_TRUE(PrefabDomUtils::PreloadInstanceEntitiesFromPrefabDom(preloader, instanceDom, instance->GetAbsoluteInstanceAliasPath()));
+
+        EntityList newEntities;
+        ASSERT_TRUE(PrefabDomUtils::LoadInstanceFromPrefabDom(*instance, newEntities, instanceDom, preloader));
+
+        // The preloaded entities get the same ids as the entities loaded from the DOM.
+        EXPECT_EQ(collectEntityIds(*instance), loadedEntityIds);
+        EXPECT_EQ(instance->GetEntityAliases().size(), 1);
+        EXPECT_EQ(instance->GetNestedInstanceAliases(newNestedTemplateId).size(), 1);
+    }
+
+    // With a global job context the queued Instances are preloaded in parallel.
+    class PrefabUpdateInstancesParallelTest
+        : public PrefabTestFixture
+    {
+    protected:
+        void SetUpEditorFixtureImpl() override
+        {
+            PrefabTestFixture::SetUpEditorFixtureImpl();
+
+            AZ::JobManagerDesc jobDesc;
+            for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+            {
+                jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            m_previousJobContext = AZ::JobContext::GetGlobalContext();
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void TearDownEditorFixtureImpl() override
+        {
+            AZ::JobContext::SetGlobalContext(m_previousJobContext);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            PrefabTestFixture::TearDownEditorFixtureImpl();
+        }
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZ::JobContext* m_previousJobContext = nullptr;
+    };
+
+    TEST_F(PrefabUpdateInstancesParallelTest, UpdatePrefabInstances_MultipleInstances_UpdatesAllInstances)
+    {
+        // Create a Template from an Instance owning two entities.
+        AZStd::unique_ptr<Instance> newInstance =
+            m_prefabSystemComponent->CreatePrefab({ CreateEntity("Entity 1"), CreateEntity("Entity 2") }, {}, PrefabMockFilePath);
+        ASSERT_TRUE(newInstance);
+        TemplateId newTemplateId = newInstance->GetTemplateId();
+        ASSERT_TRUE(newTemplateId != InvalidTemplateId);
+        PrefabDom& templatePrefabDom = m_prefabSystemComponent->FindTemplateDom(newTemplateId);
+        AZStd::vector<EntityAlias> entityAliases = newInstance->GetEntityAliases();
+        ASSERT_EQ(entityAliases.size(), 2);
+
+        // Instantiate enough Instances for several of them to be preloaded at once.
+        const int numberOfInstances = 8;
+        AZStd::vector<AZStd::unique_ptr<Instance>> instantiatedInstances;
+        for (int i = 0; i < numberOfInstances; ++i)
+        {
+            instantiatedInstances.emplace_back(m_prefabSystemComponent->InstantiatePrefab(newTemplateId));
+            ASSERT_TRUE(instantiatedInstances.back());
+        }
+
+        auto collectEntityIds = [&instantiatedInstances]()
+        {
+            AZStd::vector<AZ::EntityId> entityIds;
+            for (const AZStd::unique_ptr<Instance>& instance : instantiatedInstances)
+            {
+                instance->GetAllEntitiesInHierarchyConst([&entityIds](const AZ::Entity& entity)
+                {
+                    entityIds.push_back(entity.GetId());
+                    return true;
+                });
+            }
+            AZStd::sort(entityIds.begin(), entityIds.end());
+            return entityIds;
+        };
+        const AZStd::vector<AZ::EntityId> entityIdsBeforeUpdate = collectEntityIds();
+
+        // Update the Template's PrefabDom with a new entity name and propagate it to all queued Instances.
+        PrefabDomPath entityNamePath = PrefabTestDomUtils::GetPrefabDomEntityNamePath(entityAliases.front());
+        entityNamePath.Set(templatePrefabDom, "Updated Entity");
+        const PrefabDomValue* entityNameValue = PrefabTestDomUtils::GetPrefabDomEntityName(templatePrefabDom, entityAliases.front());
+        ASSERT_TRUE(entityNameValue != nullptr);
+
+        m_instanceUpdateExecutorInterface->AddTemplateInstancesToQueue(newTemplateId);
+        const bool updateResult = m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+        EXPECT_TRUE(updateResult);
+
+        // Every Instance has the update and kept the entity ids it had before.
+        PrefabTestDomUtils::ValidateInstances(newTemplateId, *entityNameValue, entityNamePath);
+        PrefabTestDomUtils::ValidateEntitiesOfInstances(newTemplateId, templatePrefabDom, entityAliases);
+        const AZStd::vector<AZ::EntityId> entityIdsAfterUpdate = collectEntityIds();
+        EXPECT_EQ(entityIdsAfterUpdate, entityIdsBeforeUpdate);
+        for (const AZ::EntityId& entityId : entityIdsAfterUpdate)
+        {
+            EXPECT_TRUE(entityId.IsValid());
+        }
+    }
+
 }
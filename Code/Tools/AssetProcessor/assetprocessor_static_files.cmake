@@ -25,6 +25,8 @@ set(FILES
     native/AssetManager/FileStateCache.h
     native/AssetManager/PathDependencyManager.cpp
     native/AssetManager/PathDependencyManager.h
+    native/AssetManager/SourceDependencyGraph.cpp
+    native/AssetManager/SourceDependencyGraph.h
     native/AssetManager/SourceFileRelocator.cpp
     native/AssetManager/SourceFileRelocator.h
     native/AssetManager/ControlRequestHandler.cpp
@@ -90,6 +92,8 @@ set(FILES
     native/utilities/JobDiagnosticTracker.h
     native/utilities/LineByLineDependencyScanner.cpp
     native/utilities/LineByLineDependencyScanner.h
+    native/utilities/LocalBuildCache.cpp
+    native/utilities/LocalBuildCache.h
     native/utilities/MissingDependencyScanner.cpp
     native/utilities/MissingDependencyScanner.h
     native/utilities/PlatformConfiguration.cpp
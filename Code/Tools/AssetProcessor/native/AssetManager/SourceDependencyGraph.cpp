@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/AssetManager/SourceDependencyGraph.h>
+#include <native/AssetDatabase/AssetDatabase.h>
+#include <native/utilities/PlatformConfiguration.h>
+#include <native/utilities/assetUtils.h>
+
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AssetProcessor
+{
+    namespace
+    {
+        // Missing dependencies are stored with a placeholder prefix, but are looked up without it,
+        // so that the dependencies get picked up again once the file appears.
+        AZStd::string_view StripPlaceholder(AZStd::string_view databaseName)
+        {
+            const AZStd::string_view placeholder(PlaceHolderFileName);
+            if (databaseName.starts_with(placeholder))
+            {
+                databaseName.remove_prefix(placeholder.size());
+            }
+            return databaseName;
+        }
+    }
+
+    SourceDependencyGraph::SourceDependencyGraph(const PlatformConfiguration* platformConfig)
+        : m_platformConfig(platformConfig)
+    {
+    }
+
+    void SourceDependencyGraph::Load(AssetDatabaseConnection& database)
+    {
+        using namespace AzToolsFramework::AssetDatabase;
+
+        Clear();
+
+        database.QuerySourceDependencies(SourceFileDependencyEntry::DEP_Any,
+            [this](SourceFileDependencyEntry& entry)
+            {
+                AddDependency(FindOrAddNode(entry.m_source), entry.m_dependsOnSource);
+                return true;
+            });
+
+        m_isLoaded = true;
+    }
+
+    void SourceDependencyGraph::Clear()
+    {
+        m_nodes.clear();
+        m_nodeIndices.clear();
+        m_isLoaded = false;
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+        m_resolvedPaths.clear();
+        m_fileFingerprints.clear();
+    }
+
+    void SourceDependencyGraph::ReloadDependencies(AssetDatabaseConnection& database, const AZStd::string& sourceDatabaseName)
+    {
+        using namespace AzToolsFramework::AssetDatabase;
+
+        if (!m_isLoaded)
+        {
+            return;
+        }
+
+        const NodeIndex source = FindOrAddNode(sourceDatabaseName);
+        m_nodes[source].m_dependsOn.clear();
+
+        database.QueryDependsOnSourceBySourceDependency(sourceDatabaseName.c_str(), nullptr, SourceFileDependencyEntry::DEP_Any,
+            [this, source](SourceFileDependencyEntry& entry)
+            {
+                AddDependency(source, entry.m_dependsOnSource);
+                return true;
+            });
+    }
+
+    void SourceDependencyGraph::GetDependenciesRecursive(const AZStd::string& sourceDatabaseName, SourceFilesForFingerprintingContainer& outDependencies)
+    {
+        const AZStd::string_view rootName = StripPlaceholder(sourceDatabaseName);
+
+        NodeIndex root;
+        if (!FindNode(rootName, root))
+        {
+            // the source has no dependencies and nothing depends on it, so there is only the source itself
+            const QString absolutePath = m_platformConfig->FindFirstMatchingFile(QString::fromUtf8(rootName.data(), aznumeric_cast<int>(rootName.size())));
+            if (!absolutePath.isEmpty())
+            {
+                outDependencies.insert(AZStd::make_pair(absolutePath.toUtf8().constData(), AZStd::string(rootName)));
+            }
+            return;
+        }
+
+        AZStd::unordered_set<NodeIndex> visited;
+        AZStd::vector<NodeIndex> toVisit;
+        toVisit.push_back(root);
+        while (!toVisit.empty())
+        {
+            const NodeIndex current = toVisit.back();
+            toVisit.pop_back();
+
+            if (!visited.insert(current).second)
+            {
+                continue;
+            }
+
+            toVisit.insert(toVisit.end(), m_nodes[current].m_dependsOn.begin(), m_nodes[current].m_dependsOn.end());
+
+            AZStd::string absolutePath = ResolveAbsolutePath(current);
+            if (!absolutePath.empty())
+            {
+                outDependencies.insert(AZStd::make_pair(AZStd::move(absolutePath), m_nodes[current].m_databaseName));
+            }
+        }
+    }
+
+    AZStd::string SourceDependencyGraph::GetFileFingerprint(const AZStd::string& absolutePath, const AZStd::string& databaseName)
+    {
+        if (!m_cachingEnabled)
+        {
+            return AssetUtilities::GetFileFingerprint(absolutePath, databaseName);
+        }
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+            auto found = m_fileFingerprints.find(absolutePath);
+            if (found != m_fileFingerprints.end())
+            {
+                return found->second;
+            }
+        }
+
+        // Fingerprint outside of the lock, as this can hash the file. Two threads fingerprinting the same file is harmless.
+        AZStd::string fingerprint = AssetUtilities::GetFileFingerprint(absolutePath, databaseName);
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+        m_fileFingerprints.emplace(absolutePath, fingerprint);
+        return fingerprint;
+    }
+
+    void SourceDependencyGraph::SetFingerprintCachingEnabled(bool enabled)
+    {
+        m_cachingEnabled = enabled;
+        if (!enabled)
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+            m_resolvedPaths.clear();
+            m_fileFingerprints.clear();
+        }
+    }
+
+    void SourceDependencyGraph::InvalidateFile(const AZStd::string& absolutePath)
+    {
+        if (!m_cachingEnabled)
+        {
+            return;
+        }
+
+        // the file can also change which scan folder a database name resolves to, so forget the resolved path as well
+        QString databaseName;
+        QString scanFolderName;
+        NodeIndex node = 0;
+        const bool hasNode = m_platformConfig->ConvertToRelativePath(QString::fromUtf8(absolutePath.c_str()), databaseName, scanFolderName)
+            && FindNode(databaseName.toUtf8().constData(), node);
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+        m_fileFingerprints.erase(absolutePath);
+        if (hasNode)
+        {
+            m_resolvedPaths.erase(node);
+        }
+    }
+
+    SourceDependencyGraph::NodeIndex SourceDependencyGraph::FindOrAddNode(AZStd::string_view databaseName)
+    {
+        databaseName = StripPlaceholder(databaseName);
+
+        auto found = m_nodeIndices.find(databaseName);
+        if (found != m_nodeIndices.end())
+        {
+            return found->second;
+        }
+
+        const NodeIndex index = aznumeric_cast<NodeIndex>(m_nodes.size());
+        Node& node = m_nodes.emplace_back();
+        node.m_databaseName = databaseName;
+        m_nodeIndices.emplace(node.m_databaseName, index);
+        return index;
+    }
+
+    bool SourceDependencyGraph::FindNode(AZStd::string_view databaseName, NodeIndex& outIndex) const
+    {
+        auto found = m_nodeIndices.find(databaseName);
+        if (found == m_nodeIndices.end())
+        {
+            return false;
+        }
+
+        outIndex = found->second;
+        return true;
+    }
+
+    void SourceDependencyGraph::AddDependency(NodeIndex source, AZStd::string_view dependsOnSource)
+    {
+        const NodeIndex dependsOn = FindOrAddNode(dependsOnSource);
+
+        // the same dependency can be stored multiple times, e.g. by different builders
+        AZStd::vector<NodeIndex>& dependencies = m_nodes[source].m_dependsOn;
+        if (AZStd::find(dependencies.begin(), dependencies.end(), dependsOn) == dependencies.end())
+        {
+            dependencies.push_back(dependsOn);
+        }
+    }
+
+    AZStd::string SourceDependencyGraph::ResolveAbsolutePath(NodeIndex node)
+    {
+        if (m_cachingEnabled)
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+            auto found = m_resolvedPaths.find(node);
+            if (found != m_resolvedPaths.end())
+            {
+                return found->second;
+            }
+        }
+
+        const AZStd::string& databaseName = m_nodes[node].m_databaseName;
+        const QString absolutePath = m_platformConfig->FindFirstMatchingFile(QString::fromUtf8(databaseName.c_str()));
+        AZStd::string result = absolutePath.toUtf8().constData();
+
+        if (m_cachingEnabled)
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+            m_resolvedPaths.emplace(node, result);
+        }
+        return result;
+    }
+} // namespace AssetProcessor
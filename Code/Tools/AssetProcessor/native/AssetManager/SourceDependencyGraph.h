@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <native/assetprocessor.h>
+
+namespace AssetProcessor
+{
+    class AssetDatabaseConnection;
+    class PlatformConfiguration;
+
+    /// In-memory mirror of the SourceDependency table, used to compute the recursive dependency fingerprints of source files.
+    /// Walking the dependencies in memory replaces the database query per visited source file that
+    /// AssetProcessorManager::QueryAbsolutePathDependenciesRecursive does. The graph is loaded with a single query when a scan
+    /// starts and the AssetProcessorManager reloads the dependencies of a source whenever it changes them in the database.
+    /// While fingerprint caching is enabled, the resolved path and the fingerprint of every visited file is only computed once,
+    /// so dependencies shared by many source files are not fingerprinted over and over again. Changed files have to be
+    /// invalidated, which makes every source depending on them pick up the new fingerprint.
+    /// Reading from the graph is thread safe, as long as the graph itself is not modified at the same time.
+    class SourceDependencyGraph
+    {
+    public:
+        explicit SourceDependencyGraph(const PlatformConfiguration* platformConfig);
+
+        //! Replace the graph with the source dependencies stored in the database.
+        void Load(AssetDatabaseConnection& database);
+        void Clear();
+        bool IsLoaded() const { return m_isLoaded; }
+
+        //! Re-read the dependencies of a single source from the database, after they were changed there.
+        void ReloadDependencies(AssetDatabaseConnection& database, const AZStd::string& sourceDatabaseName);
+
+        //! Collect the source and all its direct and indirect dependencies, as absolute path to database name pairs.
+        //! The result is the same as a forward query of AssetProcessorManager::QueryAbsolutePathDependenciesRecursive for any type of dependency.
+        void GetDependenciesRecursive(const AZStd::string& sourceDatabaseName, SourceFilesForFingerprintingContainer& outDependencies);
+
+        //! The fingerprint of a single file, as returned by AssetUtilities::GetFileFingerprint, cached while caching is enabled.
+        AZStd::string GetFileFingerprint(const AZStd::string& absolutePath, const AZStd::string& databaseName);
+
+        //! Enable caching the resolved paths and the fingerprints, e.g. for the duration of a scan. Disabling it clears the caches.
+        void SetFingerprintCachingEnabled(bool enabled);
+        bool IsFingerprintCachingEnabled() const { return m_cachingEnabled; }
+
+        //! Forget the cached path and fingerprint of a file that was added, modified or deleted.
+        void InvalidateFile(const AZStd::string& absolutePath);
+
+        size_t GetNumSources() const { return m_nodes.size(); }
+
+    private:
+        using NodeIndex = AZ::u32;
+
+        struct Node
+        {
+            AZStd::string m_databaseName;
+            AZStd::vector<NodeIndex> m_dependsOn;
+        };
+
+        NodeIndex FindOrAddNode(AZStd::string_view databaseName);
+        bool FindNode(AZStd::string_view databaseName, NodeIndex& outIndex) const;
+        void AddDependency(NodeIndex source, AZStd::string_view dependsOnSource);
+        AZStd::string ResolveAbsolutePath(NodeIndex node);
+
+        const PlatformConfiguration* m_platformConfig = nullptr;
+        AZStd::vector<Node> m_nodes;
+        AZStd::unordered_map<AZStd::string, NodeIndex, AZStd::hash<AZStd::string>, AZStd::equal_to<>> m_nodeIndices;
+        bool m_isLoaded = false;
+
+        bool m_cachingEnabled = false;
+        AZStd::shared_mutex m_cacheMutex;
+        AZStd::unordered_map<NodeIndex, AZStd::string> m_resolvedPaths; //!< Absolute path per node, empty if the file does not exist.
+        AZStd::unordered_map<AZStd::string, AZStd::string> m_fileFingerprints; //!< Fingerprint per absolute path.
+    };
+} // namespace AssetProcessor
@@ -20,11 +20,14 @@
 
 #include "native/AssetManager/assetProcessorManager.h"
 
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/std/sort.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 
 #include <native/AssetManager/PathDependencyManager.h>
 #include <native/utilities/BuilderConfigurationBus.h>
+#include <native/utilities/LocalBuildCache.h>
 #include <native/utilities/StatsCapture.h>
 
 #include "AssetRequestHandler.h"
@@ -67,6 +70,8 @@ namespace AssetProcessor
 
         m_sourceFileRelocator = AZStd::make_unique<SourceFileRelocator>(m_stateData, m_platformConfig);
 
+        m_sourceDependencyGraph = AZStd::make_unique<SourceDependencyGraph>(m_platformConfig);
+
         m_excludedFolderCache = AZStd::make_unique<ExcludedFolderCache>(m_platformConfig);
 
         PopulateJobStateCache();
@@ -174,6 +179,13 @@ namespace AssetProcessor
                 return true;
             });
 
+            // mirror the source dependencies in memory, so that the recursive dependencies of every scanned file
+            // don't have to be queried from the database one source at a time.
+            AssetProcessor::StatsCapture::BeginCaptureStat("AnalysisPhase,LoadDependencyGraph");
+            m_sourceDependencyGraph->Load(*m_stateData);
+            m_sourceDependencyGraph->SetFingerprintCachingEnabled(true);
+            AssetProcessor::StatsCapture::EndCaptureStat("AnalysisPhase,LoadDependencyGraph");
+
             m_isCurrentlyScanning = true;
         }
         else if ((status == AssetProcessor::AssetScanningStatus::Completed) ||
@@ -182,6 +194,10 @@ namespace AssetProcessor
             m_isCurrentlyScanning = false;
             AssetProcessor::StatsCapture::EndCaptureStat("AssetScanning");
 
+            // files are no longer assessed in bulk, so there is nothing to gain from caching the fingerprints anymore.
+            // The graph itself stays loaded, it is kept up to date whenever the dependencies in the database change.
+            m_sourceDependencyGraph->SetFingerprintCachingEnabled(false);
+
             // we cannot invoke this immediately - the scanner might be done, but we aren't actually ready until we've processed all remaining messages:
             QMetaObject::invokeMethod(this, "CheckMissingFiles", Qt::QueuedConnection);
         }
@@ -1856,6 +1872,7 @@ namespace AssetProcessor
 
         // when a source is deleted, we also have to queue anything that depended on it, for re-processing:
         SourceFileDependencyEntryContainer results;
+        AZStd::unordered_set<AZStd::string> changedSources;
         m_stateData->GetSourceFileDependenciesByDependsOnSource(databaseSourceFile, SourceFileDependencyEntry::DEP_Any, results);
         // the jobIdentifiers that have identified it as a job dependency
         for (SourceFileDependencyEntry& existingEntry : results)
@@ -1870,6 +1887,7 @@ namespace AssetProcessor
             existingEntry.m_dependsOnSource = QString(PlaceHolderFileName + relativePath).toUtf8().constData();
             m_stateData->RemoveSourceFileDependency(existingEntry.m_sourceDependencyID);
             m_stateData->SetSourceFileDependency(existingEntry);
+            changedSources.insert(existingEntry.m_source);
         }
 
         // now that the right hand column (in terms of [thing] -> [depends on thing]) has been updated, eliminate anywhere its on the left
@@ -1877,6 +1895,8 @@ namespace AssetProcessor
         results.clear();
         m_stateData->GetDependsOnSourceBySource(databaseSourceFile.toUtf8().constData(), SourceFileDependencyEntry::DEP_Any, results);
         m_stateData->RemoveSourceFileDependencies(results);
+        changedSources.insert(databaseSourceFile.toUtf8().constData());
+        ReloadSourceDependencies(changedSources);
 
         Q_EMIT SourceDeleted(databaseSourceFile); // note that this removes it from the RC Queue Model, also
     }
@@ -2757,6 +2777,9 @@ namespace AssetProcessor
                 return;
             }
 
+            // the file changed after the scan started, so its fingerprint has to be recomputed for everything depending on it
+            m_sourceDependencyGraph->InvalidateFile(normalizedFullFile.toUtf8().constData());
+
             // over here we also want to invalidate the metafiles on disk map if it COULD Be a metafile
             // note that there is no reason to do an expensive exacting computation here, it will be
             // done later and cached when m_cachedMetaFilesExistMap is set to false, we just need to
@@ -2851,53 +2874,136 @@ namespace AssetProcessor
 
     void AssetProcessorManager::AssessFilesFromScanner(QSet<AssetFileInfo> filePaths)
     {
-        int processedFileCount = 0;
+        if (!m_allowModtimeSkippingFeature)
+        {
+            for (const AssetFileInfo& fileInfo : filePaths)
+            {
+                AssessFileInternal(fileInfo.m_filePath, false, true);
+            }
+            return;
+        }
+
+        // The cheap modtime, hash and builder checks are done first for all files.  Only the files that pass them need their
+        // recursive dependency fingerprint compared against the database, which is the expensive part, and is done in parallel.
+        AZStd::vector<const AssetFileInfo*> filesToProcess;
+        AZStd::vector<FingerprintCheck> fingerprintChecks;
 
+        AssetProcessor::StatsCapture::BeginCaptureStat("AnalysisPhase,CheckModTimes");
         for (const AssetFileInfo& fileInfo : filePaths)
         {
-            if (m_allowModtimeSkippingFeature)
+            FingerprintCheck check;
+            check.m_fileInfo = &fileInfo;
+            switch (CheckFileForChanges(fileInfo, check))
             {
-                AZ::u64 fileHash = 0;
-                if (CanSkipProcessingFile(fileInfo, fileHash))
-                {
-                    AddKnownFoldersRecursivelyForFile(fileInfo.m_filePath, fileInfo.m_scanFolder->ScanPath());
+            case FileCheckResult::Unchanged:
+                OnSkippedFileFromScanner(fileInfo, check.m_fileHash);
+                break;
+            case FileCheckResult::CompareFingerprint:
+                fingerprintChecks.push_back(AZStd::move(check));
+                break;
+            default:
+                filesToProcess.push_back(&fileInfo);
+                break;
+            }
+        }
+        AssetProcessor::StatsCapture::EndCaptureStat("AnalysisPhase,CheckModTimes");
 
-                    if (fileHash != 0)
-                    {
-                        QString databaseName;
-                        m_platformConfig->ConvertToRelativePath(fileInfo.m_filePath, fileInfo.m_scanFolder, databaseName);
+        AssetProcessor::StatsCapture::BeginCaptureStat("AnalysisPhase,ComputeFingerprints");
+        // initialize everything that is lazily cached on first use, before the fingerprints are computed on multiple threads.
+        CacheMetaFilesWhichActuallyExistOnDisk();
+        AssetUtilities::ShouldUseFileHashing();
+        AssetUtilities::ComputeProjectPath();
+        QDir assetRoot;
+        AssetUtilities::ComputeAssetRoot(assetRoot);
 
-                        // Update the modtime in the db since its possible that the hash is the same, but the modtime is out of date.  Recording the current modtime will allow us to skip hashing the file in the future if no changes are made
-                        bool updated = m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, fileInfo.m_scanFolder->ScanFolderID(), AssetUtilities::AdjustTimestamp(fileInfo.m_modTime), fileHash);
+        auto computeFingerprint = [this](FingerprintCheck& check)
+        {
+            check.m_currentFingerprint = ComputeRecursiveDependenciesFingerprint(
+                check.m_fileInfo->m_filePath.toUtf8().constData(), check.m_sourceDatabaseName);
+        };
 
-                        if(!updated)
-                        {
-                            AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to update modtime for file %s during file scan", fileInfo.m_filePath.toUtf8().constData());
-                        }
-                    }
+        // without the dependency graph, the dependencies are queried from the database connection, which can't be shared between threads.
+        // Not every caller runs with a job system, e.g. some of the tools and tests, in which case the fingerprints are computed serially.
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext() ? AZ::JobContext::GetParentContext() : nullptr;
+        if (m_sourceDependencyGraph->IsLoaded() && jobContext)
+        {
+            AZ::parallel_for_each(fingerprintChecks.begin(), fingerprintChecks.end(), computeFingerprint, jobContext);
+        }
+        else
+        {
+            for (FingerprintCheck& check : fingerprintChecks)
+            {
+                computeFingerprint(check);
+            }
+        }
+        AssetProcessor::StatsCapture::EndCaptureStat("AnalysisPhase,ComputeFingerprints");
 
-                    continue;
-                }
+        AssetProcessor::StatsCapture::BeginCaptureStat("AnalysisPhase,ApplyResults");
+        for (const FingerprintCheck& check : fingerprintChecks)
+        {
+            if (ApplyFingerprintCheck(check))
+            {
+                OnSkippedFileFromScanner(*check.m_fileInfo, check.m_fileHash);
+            }
+            else
+            {
+                filesToProcess.push_back(check.m_fileInfo);
             }
+        }
 
-            processedFileCount++;
-            AssessFileInternal(fileInfo.m_filePath, false, true);
+        for (const AssetFileInfo* fileInfo : filesToProcess)
+        {
+            AssessFileInternal(fileInfo->m_filePath, false, true);
         }
+        AssetProcessor::StatsCapture::EndCaptureStat("AnalysisPhase,ApplyResults");
+
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n",
+            filePaths.size(), filePaths.size() - aznumeric_cast<int>(filesToProcess.size()), aznumeric_cast<int>(filesToProcess.size()));
+    }
 
-        if (m_allowModtimeSkippingFeature)
+    void AssetProcessorManager::OnSkippedFileFromScanner(const AssetFileInfo& fileInfo, AZ::u64 fileHash)
+    {
+        AddKnownFoldersRecursivelyForFile(fileInfo.m_filePath, fileInfo.m_scanFolder->ScanPath());
+
+        if (fileHash != 0)
         {
-            AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n", filePaths.size(), filePaths.size() - processedFileCount, processedFileCount);
+            QString databaseName;
+            m_platformConfig->ConvertToRelativePath(fileInfo.m_filePath, fileInfo.m_scanFolder, databaseName);
+
+            // Update the modtime in the db since its possible that the hash is the same, but the modtime is out of date.  Recording the current modtime will allow us to skip hashing the file in the future if no changes are made
+            bool updated = m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, fileInfo.m_scanFolder->ScanFolderID(), AssetUtilities::AdjustTimestamp(fileInfo.m_modTime), fileHash);
+
+            if(!updated)
+            {
+                AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to update modtime for file %s during file scan", fileInfo.m_filePath.toUtf8().constData());
+            }
         }
     }
 
     bool AssetProcessorManager::CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHashOut)
+    {
+        FingerprintCheck check;
+        check.m_fileInfo = &fileInfo;
+        const FileCheckResult result = CheckFileForChanges(fileInfo, check);
+        fileHashOut = check.m_fileHash;
+
+        if (result == FileCheckResult::CompareFingerprint)
+        {
+            check.m_currentFingerprint = ComputeRecursiveDependenciesFingerprint(fileInfo.m_filePath.toUtf8().constData(), check.m_sourceDatabaseName);
+            return ApplyFingerprintCheck(check);
+        }
+
+        return result == FileCheckResult::Unchanged;
+    }
+
+    AssetProcessorManager::FileCheckResult AssetProcessorManager::CheckFileForChanges(const AssetFileInfo& fileInfo, FingerprintCheck& outCheck)
     {
         // Check to see if the file has changed since the last time we saw it
         // If not, don't even bother processing the file
         // We can only do this if the builders haven't changed however, as they can register to watch files that were previously not processed
         if (m_buildersAddedOrRemoved)
         {
-            return false;
+            return FileCheckResult::Changed;
         }
 
         auto fileItr = m_fileModTimes.find(fileInfo.m_filePath.toUtf8().data());
@@ -2905,7 +3011,7 @@ namespace AssetProcessor
         if (fileItr == m_fileModTimes.end())
         {
             // File has not been processed before
-            return false;
+            return FileCheckResult::Changed;
         }
 
         AZ::u64 databaseModTime = fileItr->second;
@@ -2917,7 +3023,7 @@ namespace AssetProcessor
         {
             // Don't bother with any further checks (particularly hashing), this file hasn't been seen before
             // There should never be a case where we have recorded a hash but not a modtime
-            return false;
+            return FileCheckResult::Changed;
         }
 
         auto thisModTime = aznumeric_cast<decltype(databaseModTime)>(AssetUtilities::AdjustTimestamp(fileInfo.m_modTime));
@@ -2932,7 +3038,7 @@ namespace AssetProcessor
             if(hashItr == m_fileHashes.end())
             {
                 // No hash found
-                return false;
+                return FileCheckResult::Changed;
             }
 
             AZ::u64 databaseHashValue = hashItr->second;
@@ -2942,7 +3048,7 @@ namespace AssetProcessor
             if(databaseHashValue == 0)
             {
                 // 0 is not a valid hash, don't bother trying to hash the file
-                return false;
+                return FileCheckResult::Changed;
             }
 
             AZ::u64 fileHash = AssetUtilities::GetFileHash(fileInfo.m_filePath.toUtf8().constData());
@@ -2950,10 +3056,10 @@ namespace AssetProcessor
             if(fileHash != databaseHashValue)
             {
                 // File contents have changed
-                return false;
+                return FileCheckResult::Changed;
             }
 
-            fileHashOut = fileHash;
+            outCheck.m_fileHash = fileHash;
         }
 
         auto sourceFileItr = m_sourceFilesInDatabase.find(fileInfo.m_filePath.toUtf8().data());
@@ -2968,22 +3074,10 @@ namespace AssetProcessor
 
             if (!fingerprintFromDatabase.empty() && AreBuildersUnchanged(builderEntries, numBuildersEmittingSourceDependencies))
             {
-                // Builder(s) have not changed since last time
-                AZStd::string currentFingerprint = ComputeRecursiveDependenciesFingerprint(
-                    fileInfo.m_filePath.toUtf8().constData(), sourceFileItr->m_sourceDatabaseName.toUtf8().constData());
-
-                if(dependencyFingerprint != currentFingerprint)
-                {
-                    // Dependencies have changed
-                    return false;
-                }
-                // Success - we can skip this file, nothing has changed!
-
-                // Remove it from the list of to-be-processed files, otherwise the AP will assume the file was deleted
-                // Note that this means any files that *were* deleted are already handled by CheckMissingFiles
-                m_sourceFilesInDatabase.erase(sourceFileItr);
-
-                return true;
+                // Builder(s) have not changed since last time, whether the file can be skipped now depends on its dependencies
+                outCheck.m_sourceDatabaseName = sourceFileItr->m_sourceDatabaseName.toUtf8().constData();
+                outCheck.m_databaseFingerprint = dependencyFingerprint;
+                return FileCheckResult::CompareFingerprint;
             }
         }
         else
@@ -2992,10 +3086,26 @@ namespace AssetProcessor
             // The fact that it has a matching modtime means we've already seen this file and attempted to process it
             // If it were a new, unprocessed source file, there would be no modtime stored
 
-            return true;
+            return FileCheckResult::Unchanged;
         }
 
-        return false;
+        return FileCheckResult::Changed;
+    }
+
+    bool AssetProcessorManager::ApplyFingerprintCheck(const FingerprintCheck& check)
+    {
+        if (check.m_databaseFingerprint != check.m_currentFingerprint)
+        {
+            // Dependencies have changed
+            return false;
+        }
+        // Success - we can skip this file, nothing has changed!
+
+        // Remove it from the list of to-be-processed files, otherwise the AP will assume the file was deleted
+        // Note that this means any files that *were* deleted are already handled by CheckMissingFiles
+        m_sourceFilesInDatabase.remove(check.m_fileInfo->m_filePath);
+
+        return true;
     }
 
     void AssetProcessorManager::AssessDeletedFile(QString filePath)
@@ -3187,6 +3297,10 @@ namespace AssetProcessor
             m_jobFingerprintMap[jobIndentifier] = job.m_jobEntry.m_computedFingerprint;
         }
         job.m_jobEntry.m_computedFingerprintTimeStamp = QDateTime::currentMSecsSinceEpoch();
+        if (AZ::Interface<ILocalBuildCacheRequests>::Get())
+        {
+            job.m_buildCacheKey = AssetUtilities::GenerateBuildCacheKey(job);
+        }
         if (job.m_jobEntry.m_computedFingerprint == 0)
         {
             // unable to fingerprint this file.
@@ -4006,6 +4120,14 @@ namespace AssetProcessor
 
         // replace the changed lines:
         m_stateData->SetSourceFileDependencies(results);
+
+        AZStd::unordered_set<AZStd::string> changedSources;
+        changedSources.insert(databaseNameEncoded);
+        for (const SourceFileDependencyEntry& resultEntry : results)
+        {
+            changedSources.insert(resultEntry.m_source);
+        }
+        ReloadSourceDependencies(changedSources);
     }
 
     AZStd::shared_ptr<AssetDatabaseConnection> AssetProcessorManager::GetDatabaseConnection() const
@@ -4514,8 +4636,15 @@ namespace AssetProcessor
         // QSet is not ordered.
         SourceFilesForFingerprintingContainer knownDependenciesAbsolutePaths;
         // this automatically adds the input file to the list:
-        QueryAbsolutePathDependenciesRecursive(QString::fromUtf8(fileDatabaseName.c_str()), knownDependenciesAbsolutePaths,
-            AzToolsFramework::AssetDatabase::SourceFileDependencyEntry::DEP_Any, false);
+        if (m_sourceDependencyGraph->IsLoaded())
+        {
+            m_sourceDependencyGraph->GetDependenciesRecursive(fileDatabaseName, knownDependenciesAbsolutePaths);
+        }
+        else
+        {
+            QueryAbsolutePathDependenciesRecursive(QString::fromUtf8(fileDatabaseName.c_str()), knownDependenciesAbsolutePaths,
+                AzToolsFramework::AssetDatabase::SourceFileDependencyEntry::DEP_Any, false);
+        }
         AddMetadataFilesForFingerprinting(QString::fromUtf8(fileAbsolutePath.c_str()), knownDependenciesAbsolutePaths);
 
         // reserve 17 chars for each since its a 64 bit hex number, and then one more for the dash inbetween each.
@@ -4525,7 +4654,7 @@ namespace AssetProcessor
         for (const auto& element : knownDependenciesAbsolutePaths)
         {
             // if its a placeholder then don't bother hitting the disk to find it.
-            concatenatedFingerprints.append(AssetUtilities::GetFileFingerprint(element.first, element.second));
+            concatenatedFingerprints.append(m_sourceDependencyGraph->GetFileFingerprint(element.first, element.second));
             concatenatedFingerprints.append("-");
         }
 
@@ -4873,21 +5002,7 @@ namespace AssetProcessor
         QString projectPath = AssetUtilities::ComputeProjectPath();
         QString fullPathToFile(absolutePathToFileToCheck);
 
-        if (!m_cachedMetaFilesExistMap)
-        {
-            // one-time cache the actually existing metafiles.  These are files where its an actual path to a file
-            // like "animations/skeletoninfo.xml" as the metafile, not when its a file thats next to each such file of a given type.
-            for (int idx = 0; idx < m_platformConfig->MetaDataFileTypesCount(); idx++)
-            {
-                QPair<QString, QString> metaDataFileType = m_platformConfig->GetMetaDataFileTypeAt(idx);
-                QString fullMetaPath = QDir(projectPath).filePath(metaDataFileType.first);
-                if (QFileInfo::exists(fullMetaPath))
-                {
-                    m_metaFilesWhichActuallyExistOnDisk.insert(metaDataFileType.first);
-                }
-            }
-            m_cachedMetaFilesExistMap = true;
-        }
+        CacheMetaFilesWhichActuallyExistOnDisk();
 
         for (int idx = 0; idx < m_platformConfig->MetaDataFileTypesCount(); idx++)
         {
@@ -4898,7 +5013,7 @@ namespace AssetProcessor
                 continue;
             }
 
-            if (m_metaFilesWhichActuallyExistOnDisk.find(metaDataFileType.first) != m_metaFilesWhichActuallyExistOnDisk.end())
+            if (m_metaFilesWhichActuallyExistOnDisk.contains(metaDataFileType.first))
             {
                 QString fullMetaPath = QDir(projectPath).filePath(metaDataFileType.first);
                 metaDataFileName = fullMetaPath;
@@ -4925,6 +5040,36 @@ namespace AssetProcessor
         }
     }
 
+    void AssetProcessorManager::CacheMetaFilesWhichActuallyExistOnDisk()
+    {
+        if (m_cachedMetaFilesExistMap)
+        {
+            return;
+        }
+
+        // one-time cache the actually existing metafiles.  These are files where its an actual path to a file
+        // like "animations/skeletoninfo.xml" as the metafile, not when its a file thats next to each such file of a given type.
+        QString projectPath = AssetUtilities::ComputeProjectPath();
+        for (int idx = 0; idx < m_platformConfig->MetaDataFileTypesCount(); idx++)
+        {
+            QPair<QString, QString> metaDataFileType = m_platformConfig->GetMetaDataFileTypeAt(idx);
+            QString fullMetaPath = QDir(projectPath).filePath(metaDataFileType.first);
+            if (QFileInfo::exists(fullMetaPath))
+            {
+                m_metaFilesWhichActuallyExistOnDisk.insert(metaDataFileType.first);
+            }
+        }
+        m_cachedMetaFilesExistMap = true;
+    }
+
+    void AssetProcessorManager::ReloadSourceDependencies(const AZStd::unordered_set<AZStd::string>& sourceDatabaseNames)
+    {
+        for (const AZStd::string& sourceDatabaseName : sourceDatabaseNames)
+        {
+            m_sourceDependencyGraph->ReloadDependencies(*m_stateData, sourceDatabaseName);
+        }
+    }
+
     // this function gets called whenever something changes about a file being processed, and checks to see
     // if it needs to write the fingerprint to the database.
     void AssetProcessorManager::UpdateAnalysisTrackerForFile(const char* fullPathToFile, AnalysisTrackerUpdateType updateType)
@@ -40,6 +40,7 @@
 #include "AssetRequestHandler.h"
 #include "native/utilities/JobDiagnosticTracker.h"
 #include "SourceFileRelocator.h"
+#include "SourceDependencyGraph.h"
 
 #include <AssetManager/ExcludedFolderCache.h>
 #endif
@@ -336,6 +337,11 @@ namespace AssetProcessor
 
         //! given a full absolute path to a file, add any metadata files you find that apply.
         void AddMetadataFilesForFingerprinting(QString absolutePathToFileToCheck, SourceFilesForFingerprintingContainer& outFilesToFingerprint);
+        //! fills m_metaFilesWhichActuallyExistOnDisk, if it has not been filled yet.
+        void CacheMetaFilesWhichActuallyExistOnDisk();
+
+        //! Notify the dependency graph that the source dependencies of these sources were changed in the database.
+        void ReloadSourceDependencies(const AZStd::unordered_set<AZStd::string>& sourceDatabaseNames);
 
         // given a file name and a root to not go beyond, add the parent folder and its parent folders recursively
         // to the list of known folders.
@@ -370,6 +376,27 @@ namespace AssetProcessor
         // Checks whether or not a file can be skipped for processing (ie, file content hasn't changed, builders haven't been added/removed, builders for the file haven't changed)
         bool CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHash);
 
+        enum class FileCheckResult
+        {
+            Changed,
+            Unchanged,
+            CompareFingerprint, //!< the file itself is unchanged, but its dependencies have to be compared against the fingerprint in the database
+        };
+
+        struct FingerprintCheck
+        {
+            const AssetFileInfo* m_fileInfo = nullptr;
+            AZ::u64 m_fileHash = 0;
+            AZStd::string m_sourceDatabaseName;
+            AZStd::string m_databaseFingerprint;
+            AZStd::string m_currentFingerprint;
+        };
+
+        // The two halves of CanSkipProcessingFile, split so that the fingerprints of all scanned files can be computed in parallel in between.
+        FileCheckResult CheckFileForChanges(const AssetFileInfo& fileInfo, FingerprintCheck& outCheck);
+        bool ApplyFingerprintCheck(const FingerprintCheck& check);
+        void OnSkippedFileFromScanner(const AssetFileInfo& fileInfo, AZ::u64 fileHash);
+
         AZ::s64 GenerateNewJobRunKey();
         // Attempt to erase a log file.  Failing to erase it is not a critical problem, but should be logged.
         // returns true if there is no log file there after this operation completes
@@ -462,6 +489,7 @@ namespace AssetProcessor
 
         AZStd::unique_ptr<PathDependencyManager> m_pathDependencyManager;
         AZStd::unique_ptr<SourceFileRelocator> m_sourceFileRelocator;
+        AZStd::unique_ptr<SourceDependencyGraph> m_sourceDependencyGraph;
 
         JobDiagnosticTracker m_jobDiagnosticTracker{};
 
@@ -220,6 +220,9 @@ namespace AssetProcessor
         // Indicates whether this job needs to be processed irrespective of whether its fingerprint got modified or not.
         bool m_autoProcessJob = false;
 
+        // key of the job in the local build cache, empty when the local build cache is not in use
+        AZStd::string m_buildCacheKey;
+
         AssetBuilderSDK::AssetBuilderDesc   m_assetBuilderDesc;
         AssetBuilderSDK::JobParameterMap    m_jobParam;
 
@@ -12,6 +12,7 @@
 #include <AzToolsFramework/UI/Logging/LogLine.h>
 
 #include <native/utilities/BuilderManager.h>
+#include <native/utilities/LocalBuildCache.h>
 #include <native/utilities/ThreadHelper.h>
 
 #include <QtConcurrent/QtConcurrentRun>
@@ -519,7 +520,11 @@ namespace AssetProcessor
                 if (!JobCancelListener.IsCancelled())
                 {
                     bool runProcessJob = true;
-                    if (m_jobDetails.m_checkServer)
+                    if (RetrieveFromLocalBuildCache(builderParams, jobLogTraceListener, result))
+                    {
+                        runProcessJob = false;
+                    }
+                    else if (m_jobDetails.m_checkServer)
                     {
                         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
                         builderParams.m_serverKey = QString("%1_%2_%3_%4").arg(fileInfo.completeBaseName(), builderParams.m_processJobRequest.m_jobDescription.m_jobKey.c_str(), builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str()).arg(builderParams.m_rcJob->GetOriginalFingerprint());
@@ -575,6 +580,11 @@ namespace AssetProcessor
                         result.m_outputProducts.clear();
                         // sending process job command to the builder
                         builderParams.m_assetBuilderDesc.m_processJobFunction(builderParams.m_processJobRequest, result);
+
+                        if (result.m_resultCode == AssetBuilderSDK::ProcessJobResult_Success && !JobCancelListener.IsCancelled())
+                        {
+                            StoreInLocalBuildCache(builderParams, result);
+                        }
                     }
                 }
             }
@@ -927,6 +937,62 @@ please check the assetprocessorplatformconfig.ini file and ensure that server ca
         return true;
     }
 
+    bool RCJob::RetrieveFromLocalBuildCache(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse)
+    {
+        auto* localBuildCache = AZ::Interface<ILocalBuildCacheRequests>::Get();
+        const AZStd::string& cacheKey = builderParams.m_rcJob->m_jobDetails.m_buildCacheKey;
+        if (!localBuildCache || cacheKey.empty() || AssetUtilities::InServerMode())
+        {
+            return false;
+        }
+
+        const QString tempDirPath = QString::fromUtf8(builderParams.m_processJobRequest.m_tempDirPath.c_str());
+        if (!localBuildCache->RetrieveJobResult(cacheKey, tempDirPath))
+        {
+            return false;
+        }
+
+        if (!AfterRetrievingJobResult(builderParams, jobLogTraceListener, jobResponse))
+        {
+            // start over with an empty temp directory, so the builder doesn't find the retrieved files
+            QDir(tempDirPath).removeRecursively();
+            QDir().mkpath(tempDirPath);
+            jobResponse = AssetBuilderSDK::ProcessJobResponse();
+            jobResponse.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+            return false;
+        }
+
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Retrieved job (%s, %s, %s) from the local build cache.\n",
+            builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+            builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str());
+        return true;
+    }
+
+    void RCJob::StoreInLocalBuildCache(const BuilderParams& builderParams, const AssetBuilderSDK::ProcessJobResponse& jobResponse)
+    {
+        auto* localBuildCache = AZ::Interface<ILocalBuildCacheRequests>::Get();
+        const AZStd::string& cacheKey = builderParams.m_rcJob->m_jobDetails.m_buildCacheKey;
+        if (!localBuildCache || cacheKey.empty())
+        {
+            return;
+        }
+
+        auto beforeStoreResult = BeforeStoringJobResult(builderParams, jobResponse);
+        if (!beforeStoreResult.IsSuccess())
+        {
+            AZ_Warning(AssetBuilderSDK::WarningWindow, false, "Failed preparing the local build cache entry for %s", builderParams.m_processJobRequest.m_sourceFile.c_str());
+            return;
+        }
+
+        if (!beforeStoreResult.GetValue().empty())
+        {
+            // products copied straight from the source folder are not in the temp directory, these jobs are cheap enough to just run again
+            return;
+        }
+
+        localBuildCache->StoreJobResult(cacheKey, QString::fromUtf8(builderParams.m_processJobRequest.m_tempDirPath.c_str()));
+    }
+
     AZStd::string BuilderParams::GetTempJobDirectory() const
     {
         return m_processJobRequest.m_tempDirPath;
@@ -192,6 +192,10 @@ namespace AssetProcessor
         //! This method will retrieve the processJobResponse and the job log from the temp directory.
         //! This method is also responsible for emitting the server job logs to the local job log file.
         static bool AfterRetrievingJobResult(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse);
+        //! Retrieves the result of the job from the local build cache into the temp directory, if the cache has an entry for the job.
+        static bool RetrieveFromLocalBuildCache(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse);
+        //! Stores the result of a successful job in the local build cache, so that identical jobs do not have to run the builder again.
+        static void StoreInLocalBuildCache(const BuilderParams& builderParams, const AssetBuilderSDK::ProcessJobResponse& jobResponse);
 
         QString GetJobKey() const;
         AZ::Uuid GetBuilderGuid() const;
@@ -993,6 +993,124 @@ TEST_F(AssetProcessorManagerTest, QueryAbsolutePathDependenciesRecursive_Missing
     EXPECT_NE(dependencies.find(tempPath.absoluteFilePath("subfolder1/d.txt").toUtf8().constData()), dependencies.end());
 }
 
+// ------------------------------------------------------------------------------------------------
+//                         SourceDependencyGraph section
+// ------------------------------------------------------------------------------------------------
+
+TEST_F(AssetProcessorManagerTest, SourceDependencyGraph_MatchesQueryAbsolutePathDependenciesRecursive)
+{
+    using SourceFileDependencyEntry = AzToolsFramework::AssetDatabase::SourceFileDependencyEntry;
+
+    //  A depends on B, which depends on both C and D.  D depends on B again, and on E, which is missing and stored as a placeholder.
+
+    QDir tempPath(m_tempDir.path());
+
+    UnitTestUtils::CreateDummyFile(tempPath.absoluteFilePath("subfolder1/a.txt"), QString("tempdata\n"));
+    UnitTestUtils::CreateDummyFile(tempPath.absoluteFilePath("subfolder1/b.txt"), QString("tempdata\n"));
+    UnitTestUtils::CreateDummyFile(tempPath.absoluteFilePath("subfolder1/c.txt"), QString("tempdata\n"));
+    UnitTestUtils::CreateDummyFile(tempPath.absoluteFilePath("subfolder1/d.txt"), QString("tempdata\n"));
+
+    auto addDependency = [this](const char* source, const AZStd::string& dependsOnSource, SourceFileDependencyEntry::TypeOfDependency type)
+    {
+        SourceFileDependencyEntry entry;
+        entry.m_sourceDependencyID = AzToolsFramework::AssetDatabase::InvalidEntryId;
+        entry.m_builderGuid = AZ::Uuid::CreateRandom();
+        entry.m_source = source;
+        entry.m_dependsOnSource = dependsOnSource;
+        entry.m_typeOfDependency = type;
+        EXPECT_TRUE(m_assetProcessorManager->m_stateData->SetSourceFileDependency(entry));
+        return entry.m_sourceDependencyID;
+    };
+
+    addDependency("a.txt", "b.txt", SourceFileDependencyEntry::DEP_SourceToSource);
+    const AZ::s64 bToC = addDependency("b.txt", "c.txt", SourceFileDependencyEntry::DEP_JobToJob);
+    addDependency("b.txt", "d.txt", SourceFileDependencyEntry::DEP_SourceToSource);
+    addDependency("d.txt", "b.txt", SourceFileDependencyEntry::DEP_SourceToSource);
+    addDependency("d.txt", AZStd::string(AssetProcessor::PlaceHolderFileName) + "e.txt", SourceFileDependencyEntry::DEP_SourceToSource);
+
+    AssetProcessor::SourceDependencyGraph graph(m_config.get());
+    graph.Load(*m_assetProcessorManager->m_stateData);
+    ASSERT_TRUE(graph.IsLoaded());
+
+    auto expectSameDependencies = [&](const char* source)
+    {
+        AssetProcessor::SourceFilesForFingerprintingContainer fromDatabase;
+        m_assetProcessorManager->QueryAbsolutePathDependenciesRecursive(source, fromDatabase, SourceFileDependencyEntry::DEP_Any, false);
+
+        AssetProcessor::SourceFilesForFingerprintingContainer fromGraph;
+        graph.GetDependenciesRecursive(source, fromGraph);
+
+        EXPECT_EQ(fromGraph, fromDatabase) << "Dependencies of " << source << " differ.";
+        return fromGraph.size();
+    };
+
+    EXPECT_EQ(expectSameDependencies("a.txt"), 4); // e is missing, so it does not have an absolute path.
+    EXPECT_EQ(expectSameDependencies("b.txt"), 3);
+    EXPECT_EQ(expectSameDependencies("c.txt"), 1);
+    EXPECT_EQ(expectSameDependencies("d.txt"), 3);
+
+    // eliminate b --> c, which is only picked up by the graph once it is told about it.
+    ASSERT_TRUE(m_assetProcessorManager->m_stateData->RemoveSourceFileDependency(bToC));
+    graph.ReloadDependencies(*m_assetProcessorManager->m_stateData, "b.txt");
+
+    EXPECT_EQ(expectSameDependencies("a.txt"), 3);
+    EXPECT_EQ(expectSameDependencies("b.txt"), 2);
+    EXPECT_EQ(expectSameDependencies("d.txt"), 2);
+
+    // once e appears, it is found through the placeholder.
+    UnitTestUtils::CreateDummyFile(tempPath.absoluteFilePath("subfolder1/e.txt"), QString("tempdata\n"));
+    EXPECT_EQ(expectSameDependencies("a.txt"), 4);
+}
+
+TEST_F(AssetProcessorManagerTest, SourceDependencyGraph_ComputeRecursiveDependenciesFingerprint_MatchesDatabaseQuery)
+{
+    using SourceFileDependencyEntry = AzToolsFramework::AssetDatabase::SourceFileDependencyEntry;
+
+    //  A depends on B, which depends on C
+
+    QDir tempPath(m_tempDir.path());
+
+    const QString absolutePathA = tempPath.absoluteFilePath("subfolder1/a.txt");
+    const QString absolutePathC = tempPath.absoluteFilePath("subfolder1/c.txt");
+    UnitTestUtils::CreateDummyFile(absolutePathA, QString("tempdata\n"));
+    UnitTestUtils::CreateDummyFile(tempPath.absoluteFilePath("subfolder1/b.txt"), QString("tempdata\n"));
+    UnitTestUtils::CreateDummyFile(absolutePathC, QString("tempdata\n"));
+
+    SourceFileDependencyEntry newEntry1;  // a depends on B
+    newEntry1.m_sourceDependencyID = AzToolsFramework::AssetDatabase::InvalidEntryId;
+    newEntry1.m_builderGuid = AZ::Uuid::CreateRandom();
+    newEntry1.m_source = "a.txt";
+    newEntry1.m_dependsOnSource = "b.txt";
+
+    SourceFileDependencyEntry newEntry2; // b depends on C
+    newEntry2.m_sourceDependencyID = AzToolsFramework::AssetDatabase::InvalidEntryId;
+    newEntry2.m_builderGuid = AZ::Uuid::CreateRandom();
+    newEntry2.m_source = "b.txt";
+    newEntry2.m_dependsOnSource = "c.txt";
+
+    ASSERT_TRUE(m_assetProcessorManager->m_stateData->SetSourceFileDependency(newEntry1));
+    ASSERT_TRUE(m_assetProcessorManager->m_stateData->SetSourceFileDependency(newEntry2));
+
+    AssetProcessor::SourceDependencyGraph& graph = *m_assetProcessorManager->m_sourceDependencyGraph;
+    ASSERT_FALSE(graph.IsLoaded());
+    const AZStd::string fromDatabase = m_assetProcessorManager->ComputeRecursiveDependenciesFingerprint(absolutePathA.toUtf8().constData(), "a.txt");
+
+    // this is what happens when a scan starts:
+    graph.Load(*m_assetProcessorManager->m_stateData);
+    graph.SetFingerprintCachingEnabled(true);
+    EXPECT_EQ(m_assetProcessorManager->ComputeRecursiveDependenciesFingerprint(absolutePathA.toUtf8().constData(), "a.txt"), fromDatabase);
+
+    // a change to an indirect dependency has to change the fingerprint, once the changed file is invalidated.
+    UnitTestUtils::CreateDummyFile(absolutePathC, QString("changed data\n"));
+    graph.InvalidateFile(absolutePathC.toUtf8().constData());
+    const AZStd::string afterChange = m_assetProcessorManager->ComputeRecursiveDependenciesFingerprint(absolutePathA.toUtf8().constData(), "a.txt");
+    EXPECT_NE(afterChange, fromDatabase);
+
+    graph.SetFingerprintCachingEnabled(false);
+    graph.Clear();
+    EXPECT_EQ(m_assetProcessorManager->ComputeRecursiveDependenciesFingerprint(absolutePathA.toUtf8().constData(), "a.txt"), afterChange);
+}
+
 TEST_F(AssetProcessorManagerTest, BuilderSDK_API_CreateJobs_HasValidParameters_WithNoOutputFolder)
 {
     QDir tempPath(m_tempDir.path());
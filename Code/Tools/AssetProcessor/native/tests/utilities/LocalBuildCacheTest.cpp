@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/tests/AssetProcessorTest.h>
+#include <native/unittests/UnitTestRunner.h>
+#include <native/utilities/LocalBuildCache.h>
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+
+namespace AssetProcessor
+{
+    class LocalBuildCacheTest
+        : public AssetProcessorTest
+    {
+    protected:
+        void SetUp() override
+        {
+            AssetProcessorTest::SetUp();
+            m_tempPath = QDir(m_tempDir.path());
+            m_cacheRoot = m_tempPath.absoluteFilePath("Cache");
+        }
+
+        //! Creates a job temp folder with the given number of products of the given size.
+        QString CreateJobFolder(const QString& name, int numProducts, int productSize = 16)
+        {
+            const QString jobFolder = m_tempPath.absoluteFilePath(name);
+            for (int productIndex = 0; productIndex < numProducts; ++productIndex)
+            {
+                const QString productPath = QDir(jobFolder).absoluteFilePath(QString("subfolder/product%1.bin").arg(productIndex));
+                EXPECT_TRUE(UnitTestUtils::CreateDummyFile(productPath, QString(productSize, QChar('a' + productIndex))));
+            }
+            return jobFolder;
+        }
+
+        static QString ReadFile(const QString& filePath)
+        {
+            QFile file(filePath);
+            if (!file.open(QIODevice::ReadOnly))
+            {
+                return {};
+            }
+            return QString::fromUtf8(file.readAll());
+        }
+
+        QTemporaryDir m_tempDir;
+        QDir m_tempPath;
+        QString m_cacheRoot;
+
+        const AZStd::string m_firstKey = "0123456789abcdef0123456789abcdef01234567";
+        const AZStd::string m_secondKey = "76543210fedcba9876543210fedcba9876543210";
+        const AZStd::string m_thirdKey = "aaaaaaaabbbbbbbbccccccccddddddddeeeeeeee";
+        static constexpr AZ::u64 DefaultMaxSize = 1024 * 1024;
+    };
+
+    TEST_F(LocalBuildCacheTest, Construct_RegistersInterface)
+    {
+        EXPECT_EQ(AZ::Interface<ILocalBuildCacheRequests>::Get(), nullptr);
+        {
+            LocalBuildCache cache(m_cacheRoot, DefaultMaxSize);
+            EXPECT_EQ(AZ::Interface<ILocalBuildCacheRequests>::Get(), &cache);
+        }
+        EXPECT_EQ(AZ::Interface<ILocalBuildCacheRequests>::Get(), nullptr);
+    }
+
+    TEST_F(LocalBuildCacheTest, RetrieveJobResult_NoEntry_CountsMiss)
+    {
+        LocalBuildCache cache(m_cacheRoot, DefaultMaxSize);
+
+        EXPECT_FALSE(cache.RetrieveJobResult(m_firstKey, m_tempPath.absoluteFilePath("Target")));
+
+        const LocalBuildCacheStats stats = cache.GetStats();
+        EXPECT_EQ(stats.m_hits, 0u);
+        EXPECT_EQ(stats.m_misses, 1u);
+        EXPECT_EQ(stats.m_numEntries, 0u);
+    }
+
+    TEST_F(LocalBuildCacheTest, StoreJobResult_ThenRetrieve_RestoresAllFiles)
+    {
+        LocalBuildCache cache(m_cacheRoot, DefaultMaxSize);
+        const QString jobFolder = CreateJobFolder("Job", 3);
+
+        EXPECT_TRUE(cache.StoreJobResult(m_firstKey, jobFolder));
+
+        const QString targetFolder = m_tempPath.absoluteFilePath("Target");
+        ASSERT_TRUE(cache.RetrieveJobResult(m_firstKey, targetFolder));
+        for (int productIndex = 0; productIndex < 3; ++productIndex)
+        {
+            const QString relativePath = QString("subfolder/product%1.bin").arg(productIndex);
+            EXPECT_EQ(ReadFile(QDir(targetFolder).absoluteFilePath(relativePath)), ReadFile(QDir(jobFolder).absoluteFilePath(relativePath)));
+        }
+
+        // the marker file is an implementation detail of the cache and must not show up as a product
+        EXPECT_FALSE(QFileInfo::exists(QDir(targetFolder).absoluteFilePath(LocalBuildCache::EntryMarkerFileName)));
+
+        const LocalBuildCacheStats stats = cache.GetStats();
+        EXPECT_EQ(stats.m_hits, 1u);
+        EXPECT_EQ(stats.m_misses, 0u);
+        EXPECT_EQ(stats.m_stores, 1u);
+        EXPECT_EQ(stats.m_numEntries, 1u);
+        EXPECT_EQ(stats.m_sizeInBytes, 3u * 16);
+    }
+
+    TEST_F(LocalBuildCacheTest, StoreJobResult_InvalidKey_Fails)
+    {
+        LocalBuildCache cache(m_cacheRoot, DefaultMaxSize);
+        const QString jobFolder = CreateJobFolder("Job", 1);
+
+        EXPECT_FALSE(cache.StoreJobResult("../../outside", jobFolder));
+        EXPECT_FALSE(cache.StoreJobResult("", jobFolder));
+        EXPECT_EQ(cache.GetStats().m_numEntries, 0u);
+    }
+
+    TEST_F(LocalBuildCacheTest, NewInstance_SameCacheRoot_FindsStoredEntries)
+    {
+        const QString jobFolder = CreateJobFolder("Job", 2);
+        {
+            LocalBuildCache cache(m_cacheRoot, DefaultMaxSize);
+            EXPECT_TRUE(cache.StoreJobResult(m_firstKey, jobFolder));
+        }
+
+        LocalBuildCache cache(m_cacheRoot, DefaultMaxSize);
+        EXPECT_EQ(cache.GetStats().m_numEntries, 1u);
+        EXPECT_EQ(cache.GetStats().m_sizeInBytes, 2u * 16);
+        EXPECT_TRUE(cache.RetrieveJobResult(m_firstKey, m_tempPath.absoluteFilePath("Target")));
+    }
+
+    TEST_F(LocalBuildCacheTest, RetrieveJobResult_StoredByOtherAssetProcessor_IsHit)
+    {
+        LocalBuildCache cache(m_cacheRoot, DefaultMaxSize);
+
+        // another Asset Processor, e.g. of a different worktree, sharing the cache root stores an entry after the index was built
+        const QString entryPath = QDir(m_cacheRoot).absoluteFilePath(QString("01/%1").arg(m_firstKey.c_str()));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(entryPath).absoluteFilePath("product.bin"), "product"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(QDir(entryPath).absoluteFilePath(LocalBuildCache::EntryMarkerFileName)));
+
+        const QString targetFolder = m_tempPath.absoluteFilePath("Target");
+        EXPECT_TRUE(cache.RetrieveJobResult(m_firstKey, targetFolder));
+        EXPECT_EQ(ReadFile(QDir(targetFolder).absoluteFilePath("product.bin")), "product");
+        EXPECT_EQ(cache.GetStats().m_hits, 1u);
+        EXPECT_EQ(cache.GetStats().m_numEntries, 1u);
+    }
+
+    TEST_F(LocalBuildCacheTest, StoreJobResult_OverBudget_EvictsLeastRecentlyUsed)
+    {
+        // every entry is 100 bytes, so only two of them fit the budget
+        LocalBuildCache cache(m_cacheRoot, 250);
+
+        EXPECT_TRUE(cache.StoreJobResult(m_firstKey, CreateJobFolder("First", 1, 100)));
+        EXPECT_TRUE(cache.StoreJobResult(m_secondKey, CreateJobFolder("Second", 1, 100)));
+
+        // using the first entry makes the second one the least recently used
+        EXPECT_TRUE(cache.RetrieveJobResult(m_firstKey, m_tempPath.absoluteFilePath("Target")));
+
+        EXPECT_TRUE(cache.StoreJobResult(m_thirdKey, CreateJobFolder("Third", 1, 100)));
+
+        const LocalBuildCacheStats stats = cache.GetStats();
+        EXPECT_EQ(stats.m_evictions, 1u);
+        EXPECT_EQ(stats.m_numEntries, 2u);
+        EXPECT_LE(stats.m_sizeInBytes, 250u);
+
+        EXPECT_TRUE(cache.RetrieveJobResult(m_firstKey, m_tempPath.absoluteFilePath("Target")));
+        EXPECT_FALSE(cache.RetrieveJobResult(m_secondKey, m_tempPath.absoluteFilePath("Target")));
+        EXPECT_TRUE(cache.RetrieveJobResult(m_thirdKey, m_tempPath.absoluteFilePath("Target")));
+    }
+} // namespace AssetProcessor
@@ -13,6 +13,7 @@
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Debug/TraceMessageBus.h>
 #include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/parallel/thread.h>
 
 // the simple stats capture system has a trivial interface and only writes to printf.
 // So the simplest tests we can do is make sure it only asserts when it should
@@ -196,5 +197,52 @@ TEST_F(StatsCaptureOutputTest, StatsCaptureTest_Sanity)
     EXPECT_TRUE(foundFoo2) << "The expected CreateJobs.foo2.mybuilder2 did not appear in the output";
 }
 
+// Stats are captured from multiple threads while the analysis computes fingerprints in parallel.
+TEST_F(StatsCaptureOutputTest, StatsCaptureTest_CapturedFromMultipleThreads_CountsAllCaptures)
+{
+    auto registry = AZ::SettingsRegistry::Get();
+    ASSERT_NE(registry, nullptr);
+
+    registry->Set("/Amazon/AssetProcessor/Settings/Stats/HumanReadable", false);
+    registry->Set("/Amazon/AssetProcessor/Settings/Stats/MachineReadable", true);
+
+    constexpr int numThreads = 4;
+    constexpr int numCapturesPerThread = 100;
+    AZStd::vector<AZStd::thread> threads;
+    for (int threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+    {
+        threads.emplace_back([threadIndex]()
+        {
+            AZStd::string statName = AZStd::string::format("AnalysisPhase,Thread%i", threadIndex);
+            for (int captureIndex = 0; captureIndex < numCapturesPerThread; ++captureIndex)
+            {
+                AssetProcessor::StatsCapture::BeginCaptureStat(statName);
+                AssetProcessor::StatsCapture::EndCaptureStat(statName);
+            }
+        });
+    }
+    for (AZStd::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    m_gatheredMessages.clear();
+    Dump();
+
+    int numFoundPhases = 0;
+    for (const auto& stat : m_gatheredMessages)
+    {
+        if (stat.contains("MachineReadableStat:") && stat.contains("AnalysisPhase,Thread"))
+        {
+            AZStd::vector<AZStd::string> tokens;
+            AZ::StringFunc::Tokenize(stat, tokens, ":", false, false);
+            ASSERT_EQ(tokens.size(), 5);
+            EXPECT_STREQ(tokens[2].c_str(), "100");
+            ++numFoundPhases;
+        }
+    }
+    EXPECT_EQ(numFoundPhases, numThreads);
+}
+
 }
 
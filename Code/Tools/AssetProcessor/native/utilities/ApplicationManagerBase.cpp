@@ -8,6 +8,7 @@
 #include "ApplicationManagerBase.h"
 
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
 
@@ -22,6 +23,7 @@
 #include <native/FileProcessor/FileProcessor.h>
 #include <native/utilities/ApplicationServer.h>
 #include <native/utilities/AssetServerHandler.h>
+#include <native/utilities/LocalBuildCache.h>
 #include <native/InternalBuilders/SettingsRegistryBuilder.h>
 #include <AzToolsFramework/Application/Ticker.h>
 #include <AzToolsFramework/ToolsFileUtils/ToolsFileUtils.h>
@@ -178,6 +180,7 @@ void ApplicationManagerBase::InitAssetProcessorManager()
     const APCommandLineSwitch Command_debugOutput("debugOutput", "When enabled, builders that support it will output debug information as product assets. Used primarily with scene files.");
     const APCommandLineSwitch Command_sortJobsByDBSourceName("sortJobsByDBSourceName", "When enabled, sorts pending jobs with equal priority and dependencies by database source name instead of job ID. Useful for automated tests to process assets in the same order each time.");
     const APCommandLineSwitch Command_truncatefingerprint("truncatefingerprint", "Truncates the fingerprint used for processed assets. Useful if you plan to compress product assets to share on another machine because some compression formats like zip will truncate file mod timestamps.");
+    const APCommandLineSwitch Command_localBuildCache("localBuildCache", "Enables the local build cache, also in batch mode. Pass in a path to use a cache root other than the configured one. Job results are stored in and reused from a content-addressed cache on the local disk, which can be shared between branches and worktrees.");
     const APCommandLineSwitch Command_help("help", "Displays this message.");
     const APCommandLineSwitch Command_h("h", Command_help.m_helpText);
 
@@ -283,6 +286,15 @@ void ApplicationManagerBase::InitAssetProcessorManager()
         AssetUtilities::SetTruncateFingerprintTimestamp(precision);
     }
 
+    if (commandLine->HasSwitch(Command_localBuildCache.m_switch))
+    {
+        m_localBuildCacheRequested = true;
+        if (commandLine->GetNumSwitchValues(Command_localBuildCache.m_switch) > 0)
+        {
+            m_localBuildCachePath = commandLine->GetSwitchValue(Command_localBuildCache.m_switch, 0).c_str();
+        }
+    }
+
     if (commandLine->HasSwitch(Command_help.m_switch) || commandLine->HasSwitch(Command_h.m_switch))
     {
         // Other O3DE tools have a more full featured system for registering command flags
@@ -303,6 +315,7 @@ void ApplicationManagerBase::InitAssetProcessorManager()
         AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_debugOutput.m_switch, Command_debugOutput.m_helpText);
         AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_sortJobsByDBSourceName.m_switch, Command_sortJobsByDBSourceName.m_helpText);
         AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_truncatefingerprint.m_switch, Command_truncatefingerprint.m_helpText);
+        AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_localBuildCache.m_switch, Command_localBuildCache.m_helpText);
         AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_help.m_switch, Command_help.m_helpText);
         AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_h.m_switch, Command_h.m_helpText);
         AZ_TracePrintf("AssetProcessor", "\tregset : set the given registry key to the given value.\n");
@@ -910,6 +923,7 @@ void ApplicationManagerBase::Destroy()
     DestroyConnectionManager();
     DestroyAssetServerHandler();
     DestroyRCController();
+    DestroyLocalBuildCache();
     DestroyAssetScanner();
     DestroyFileMonitor();
     ShutDownAssetDatabase();
@@ -1320,6 +1334,57 @@ void ApplicationManagerBase::DestroyAssetServerHandler()
     m_assetServerHandler = nullptr;
 }
 
+void ApplicationManagerBase::InitLocalBuildCache()
+{
+    const auto localBuildCacheKey = AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorSettingsKey) + "/LocalBuildCache";
+
+    bool enabled = false;
+    bool enabledInBatchMode = false;
+    AZ::u64 maxSizeInMB = 10 * 1024;
+    AZ::SettingsRegistryInterface::FixedValueString cachePath;
+    if (auto* settingsRegistry = AZ::SettingsRegistry::Get())
+    {
+        settingsRegistry->Get(enabled, localBuildCacheKey + "/Enabled");
+        // batch builds, e.g. on build machines, usually want to build everything from scratch, so they have to opt in separately
+        settingsRegistry->Get(enabledInBatchMode, localBuildCacheKey + "/EnabledInBatchMode");
+        settingsRegistry->Get(maxSizeInMB, localBuildCacheKey + "/MaxSizeMB");
+        settingsRegistry->Get(cachePath, localBuildCacheKey + "/CachePath");
+    }
+
+    // exiting on idle is what makes a batch build
+    if (!m_localBuildCacheRequested && !(GetShouldExitOnIdle() ? enabledInBatchMode : enabled))
+    {
+        return;
+    }
+
+    QString cacheRoot = m_localBuildCachePath;
+    if (cacheRoot.isEmpty())
+    {
+        cacheRoot = cachePath.empty()
+            // share the cache between all projects and worktrees of the user by default
+            ? QDir(AZ::Utils::GetO3deManifestDirectory().c_str()).absoluteFilePath("LocalBuildCache")
+            : QString::fromUtf8(cachePath.c_str(), aznumeric_cast<int>(cachePath.size()));
+    }
+
+    if (!QDir().mkpath(cacheRoot))
+    {
+        AZ_Warning(AssetProcessor::ConsoleChannel, false, "Unable to create the local build cache at %s, the local build cache is disabled.\n", cacheRoot.toUtf8().constData());
+        return;
+    }
+
+    m_localBuildCache = AZStd::make_unique<AssetProcessor::LocalBuildCache>(cacheRoot, maxSizeInMB * 1024 * 1024);
+    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Using the local build cache at %s.\n", cacheRoot.toUtf8().constData());
+}
+
+void ApplicationManagerBase::DestroyLocalBuildCache()
+{
+    if (m_localBuildCache)
+    {
+        m_localBuildCache->LogStats();
+        m_localBuildCache.reset();
+    }
+}
+
 // IMPLEMENTATION OF -------------- AzToolsFramework::AssetDatabase::AssetDatabaseRequests::Bus::Listener
 bool ApplicationManagerBase::GetAssetDatabaseLocation(AZStd::string& location)
 {
@@ -1395,6 +1460,7 @@ bool ApplicationManagerBase::Activate()
     InitFileMonitor(AZStd::make_unique<FileWatcher>());
     InitAssetScanner();
     InitAssetServerHandler();
+    InitLocalBuildCache();
     InitRCController();
 
     InitConnectionManager();
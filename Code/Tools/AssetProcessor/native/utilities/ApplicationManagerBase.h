@@ -40,6 +40,7 @@ namespace AssetProcessor
     class FileStateBase;
     class FileStateCache;
     class InternalAssetBuilderInfo;
+    class LocalBuildCache;
     class PlatformConfiguration;
     class RCController;
     class SettingsRegistryBuilder;
@@ -154,6 +155,8 @@ protected:
     void ShutDownAssetDatabase();
     void InitAssetServerHandler();
     void DestroyAssetServerHandler();
+    void InitLocalBuildCache();
+    void DestroyLocalBuildCache();
     void InitFileProcessor();
     void ShutDownFileProcessor();
     virtual void InitSourceControl() = 0;
@@ -200,6 +203,7 @@ protected:
     AssetProcessor::AssetRequestHandler* m_assetRequestHandler = nullptr;
     AssetProcessor::BuilderManager* m_builderManager = nullptr;
     AssetProcessor::AssetServerHandler* m_assetServerHandler = nullptr;
+    AZStd::unique_ptr<AssetProcessor::LocalBuildCache> m_localBuildCache;
     ControlRequestHandler* m_controlRequestHandler = nullptr;
 
     AZStd::unique_ptr<AssetProcessor::FileStateBase> m_fileStateCache;
@@ -245,4 +249,8 @@ protected:
     QString m_fileDependencyScanPattern;
     AZStd::vector<AZStd::string> m_dependencyAddtionalScanFolders;
     int m_dependencyScanMaxIteration = AssetProcessor::MissingDependencyScanner::DefaultMaxScanIteration; // The maximum number of times to recurse when scanning a file for missing dependencies.
+
+    // Set by the localBuildCache command line switch, which enables the local build cache regardless of the settings.
+    bool m_localBuildCacheRequested = false;
+    QString m_localBuildCachePath;
 };
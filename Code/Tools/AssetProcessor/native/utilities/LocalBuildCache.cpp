@@ -0,0 +1,385 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/LocalBuildCache.h>
+#include <native/assetprocessor.h>
+
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+
+namespace AssetProcessor
+{
+    namespace
+    {
+        // Staging folders are only left behind by an Asset Processor that was killed while storing an entry.
+        // They are not removed right away, as another Asset Processor sharing the cache root could still be writing to them.
+        const qint64 s_staleStagingFolderAgeInSecs = 60 * 60;
+
+        // Evict down to slightly below the budget, so that not every store past the budget evicts again.
+        const AZ::u64 s_evictionTargetPercentage = 90;
+
+        //! Copies all files in the source directory into the target directory, keeping their relative paths.
+        //! Files that were copied are added to copiedFiles, so that they can be removed again if the copy fails halfway.
+        bool CopyDirectoryContents(const QString& sourceDirectory, const QString& targetDirectory, AZ::u64& sizeInBytes, QStringList& copiedFiles)
+        {
+            QDir source(sourceDirectory);
+            QDir target(targetDirectory);
+            QDirIterator fileIterator(sourceDirectory, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+            while (fileIterator.hasNext())
+            {
+                fileIterator.next();
+                const QString relativePath = source.relativeFilePath(fileIterator.filePath());
+                if (relativePath == LocalBuildCache::EntryMarkerFileName)
+                {
+                    continue;
+                }
+
+                const QString targetPath = target.absoluteFilePath(relativePath);
+                if (!target.mkpath(QFileInfo(targetPath).absolutePath()))
+                {
+                    return false;
+                }
+
+                QFile::remove(targetPath);
+                if (!QFile::copy(fileIterator.filePath(), targetPath))
+                {
+                    return false;
+                }
+                copiedFiles.append(targetPath);
+                sizeInBytes += fileIterator.fileInfo().size();
+            }
+            return true;
+        }
+
+        AZ::u64 GetDirectorySize(const QString& directory)
+        {
+            AZ::u64 sizeInBytes = 0;
+            QDirIterator fileIterator(directory, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+            while (fileIterator.hasNext())
+            {
+                fileIterator.next();
+                sizeInBytes += fileIterator.fileInfo().size();
+            }
+            return sizeInBytes;
+        }
+
+        void TouchFile(const QString& filePath)
+        {
+            QFile file(filePath);
+            if (file.open(QIODevice::WriteOnly | QIODevice::Append))
+            {
+                file.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
+            }
+        }
+
+        QString CreateStagingPath(const QString& cacheRoot, const AZStd::string& cacheKey)
+        {
+            return QDir(cacheRoot).absoluteFilePath(QString("%1/%2_%3").arg(LocalBuildCache::StagingFolderName, cacheKey.c_str(),
+                AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str()));
+        }
+
+        bool IsValidCacheKey(const AZStd::string& cacheKey)
+        {
+            // the key is used as a directory name, so only accept what AssetUtilities::GenerateBuildCacheKey generates
+            return cacheKey.size() > 2 && AZStd::all_of(cacheKey.begin(), cacheKey.end(), [](char character)
+                {
+                    return (character >= '0' && character <= '9') || (character >= 'a' && character <= 'f');
+                });
+        }
+    }
+
+    LocalBuildCache::LocalBuildCache(const QString& cacheRoot, AZ::u64 maxSizeInBytes)
+        : m_cacheRoot(QDir::cleanPath(cacheRoot))
+        , m_maxSizeInBytes(maxSizeInBytes)
+    {
+        ScanEntries();
+        AZ::Interface<ILocalBuildCacheRequests>::Register(this);
+    }
+
+    LocalBuildCache::~LocalBuildCache()
+    {
+        AZ::Interface<ILocalBuildCacheRequests>::Unregister(this);
+    }
+
+    bool LocalBuildCache::RetrieveJobResult(const AZStd::string& cacheKey, const QString& targetDirectory)
+    {
+        if (!IsValidCacheKey(cacheKey))
+        {
+            return false;
+        }
+
+        const QString entryPath = GetEntryPath(cacheKey);
+        bool isIndexed = false;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto found = m_entries.find(cacheKey);
+            if (found != m_entries.end())
+            {
+                MarkUsed(found->second);
+                isIndexed = true;
+            }
+        }
+
+        if (!isIndexed && !AddEntryFromDisk(cacheKey))
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            ++m_stats.m_misses;
+            return false;
+        }
+
+        AZ::u64 sizeInBytes = 0;
+        QStringList copiedFiles;
+        if (!CopyDirectoryContents(entryPath, targetDirectory, sizeInBytes, copiedFiles))
+        {
+            // the entry was evicted or is damaged, don't leave a partial result behind for the builder
+            for (const QString& copiedFile : copiedFiles)
+            {
+                QFile::remove(copiedFile);
+            }
+
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Failed to retrieve entry %s from the local build cache.\n", cacheKey.c_str());
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            RemoveEntry(cacheKey);
+            ++m_stats.m_misses;
+            return false;
+        }
+
+        TouchFile(QDir(entryPath).absoluteFilePath(EntryMarkerFileName));
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        ++m_stats.m_hits;
+        return true;
+    }
+
+    bool LocalBuildCache::StoreJobResult(const AZStd::string& cacheKey, const QString& sourceDirectory)
+    {
+        if (!IsValidCacheKey(cacheKey))
+        {
+            return false;
+        }
+
+        const QString entryPath = GetEntryPath(cacheKey);
+        if (QFileInfo::exists(entryPath))
+        {
+            // another job, or another Asset Processor sharing the cache, already stored the same result
+            return true;
+        }
+
+        const QString stagingPath = CreateStagingPath(m_cacheRoot, cacheKey);
+
+        AZ::u64 sizeInBytes = 0;
+        QStringList copiedFiles;
+        bool stored = QDir().mkpath(stagingPath) && CopyDirectoryContents(sourceDirectory, stagingPath, sizeInBytes, copiedFiles);
+        if (stored)
+        {
+            TouchFile(QDir(stagingPath).absoluteFilePath(EntryMarkerFileName));
+
+            // moving the complete entry into place makes it visible to everyone at once
+            QDir().mkpath(QFileInfo(entryPath).absolutePath());
+            stored = QDir().rename(stagingPath, entryPath);
+        }
+
+        if (!stored)
+        {
+            QDir(stagingPath).removeRecursively();
+
+            // losing the race against someone storing the same entry is not a failure
+            if (QFileInfo::exists(entryPath))
+            {
+                return true;
+            }
+
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Failed to store entry %s in the local build cache.\n", cacheKey.c_str());
+            return false;
+        }
+
+        AZStd::vector<QString> evictedEntries;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AddEntry(cacheKey, sizeInBytes);
+            ++m_stats.m_stores;
+            evictedEntries = EvictEntries();
+        }
+
+        RemoveEvictedEntries(evictedEntries);
+        return true;
+    }
+
+    LocalBuildCacheStats LocalBuildCache::GetStats() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    void LocalBuildCache::LogStats() const
+    {
+        const LocalBuildCacheStats stats = GetStats();
+        const AZ::u64 lookups = stats.m_hits + stats.m_misses;
+        AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Local build cache (%s): %llu hits, %llu misses (%.1f%% hit rate), %llu stores, %llu evictions, %llu entries using %.1f of %.1f MB.\n",
+            m_cacheRoot.toUtf8().constData(), stats.m_hits, stats.m_misses, lookups ? 100.0 * stats.m_hits / lookups : 0.0, stats.m_stores, stats.m_evictions,
+            stats.m_numEntries, stats.m_sizeInBytes / (1024.0 * 1024.0), m_maxSizeInBytes / (1024.0 * 1024.0));
+    }
+
+    QString LocalBuildCache::GetEntryPath(const AZStd::string& cacheKey) const
+    {
+        // spread the entries over subfolders, to keep the number of entries per folder manageable
+        return QDir(m_cacheRoot).absoluteFilePath(QString("%1/%2").arg(QString::fromUtf8(cacheKey.c_str(), 2), cacheKey.c_str()));
+    }
+
+    void LocalBuildCache::ScanEntries()
+    {
+        struct ScannedEntry
+        {
+            AZStd::string m_cacheKey;
+            AZ::u64 m_sizeInBytes;
+            QDateTime m_lastAccess;
+        };
+        AZStd::vector<ScannedEntry> scannedEntries;
+
+        QDir root(m_cacheRoot);
+        for (const QFileInfo& bucket : root.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot))
+        {
+            if (bucket.fileName() == StagingFolderName)
+            {
+                for (const QFileInfo& staged : QDir(bucket.absoluteFilePath()).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot))
+                {
+                    if (staged.lastModified().secsTo(QDateTime::currentDateTime()) > s_staleStagingFolderAgeInSecs)
+                    {
+                        QDir(staged.absoluteFilePath()).removeRecursively();
+                    }
+                }
+                continue;
+            }
+
+            for (const QFileInfo& entry : QDir(bucket.absoluteFilePath()).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot))
+            {
+                const QFileInfo marker(QDir(entry.absoluteFilePath()).absoluteFilePath(EntryMarkerFileName));
+                AZStd::string cacheKey = entry.fileName().toUtf8().constData();
+                if (marker.exists() && IsValidCacheKey(cacheKey))
+                {
+                    scannedEntries.push_back({ AZStd::move(cacheKey), GetDirectorySize(entry.absoluteFilePath()), marker.lastModified() });
+                }
+            }
+        }
+
+        AZStd::sort(scannedEntries.begin(), scannedEntries.end(), [](const ScannedEntry& lhs, const ScannedEntry& rhs)
+            {
+                return lhs.m_lastAccess < rhs.m_lastAccess;
+            });
+
+        AZStd::vector<QString> evictedEntries;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            for (const ScannedEntry& scannedEntry : scannedEntries)
+            {
+                AddEntry(scannedEntry.m_cacheKey, scannedEntry.m_sizeInBytes);
+            }
+
+            // the budget might have been lowered since the entries were stored
+            evictedEntries = EvictEntries();
+        }
+
+        RemoveEvictedEntries(evictedEntries);
+    }
+
+    void LocalBuildCache::RemoveEvictedEntries(const AZStd::vector<QString>& entryPaths) const
+    {
+        for (const QString& entryPath : entryPaths)
+        {
+            // move the entry out of the way first, so that it disappears at once for anyone retrieving it
+            const QString stagingPath = CreateStagingPath(m_cacheRoot, QFileInfo(entryPath).fileName().toUtf8().constData());
+            if (QDir().mkpath(QFileInfo(stagingPath).absolutePath()) && QDir().rename(entryPath, stagingPath))
+            {
+                QDir(stagingPath).removeRecursively();
+            }
+            else
+            {
+                QDir(entryPath).removeRecursively();
+            }
+        }
+    }
+
+    bool LocalBuildCache::AddEntryFromDisk(const AZStd::string& cacheKey)
+    {
+        const QString entryPath = GetEntryPath(cacheKey);
+        if (!QFileInfo::exists(QDir(entryPath).absoluteFilePath(EntryMarkerFileName)))
+        {
+            return false;
+        }
+
+        const AZ::u64 sizeInBytes = GetDirectorySize(entryPath);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_entries.find(cacheKey) == m_entries.end())
+        {
+            AddEntry(cacheKey, sizeInBytes);
+        }
+        return true;
+    }
+
+    void LocalBuildCache::AddEntry(const AZStd::string& cacheKey, AZ::u64 sizeInBytes)
+    {
+        auto insertResult = m_entries.emplace(cacheKey, Entry());
+        Entry& entry = insertResult.first->second;
+        if (!insertResult.second)
+        {
+            m_stats.m_sizeInBytes -= entry.m_sizeInBytes;
+            m_lruOrder.erase(entry.m_lruPosition);
+        }
+
+        entry.m_sizeInBytes = sizeInBytes;
+        entry.m_lruPosition = m_lruOrder.insert(m_lruOrder.end(), cacheKey);
+        m_stats.m_sizeInBytes += sizeInBytes;
+        m_stats.m_numEntries = m_entries.size();
+    }
+
+    void LocalBuildCache::RemoveEntry(const AZStd::string& cacheKey)
+    {
+        auto found = m_entries.find(cacheKey);
+        if (found == m_entries.end())
+        {
+            return;
+        }
+
+        m_stats.m_sizeInBytes -= found->second.m_sizeInBytes;
+        m_lruOrder.erase(found->second.m_lruPosition);
+        m_entries.erase(found);
+        m_stats.m_numEntries = m_entries.size();
+    }
+
+    void LocalBuildCache::MarkUsed(Entry& entry)
+    {
+        m_lruOrder.splice(m_lruOrder.end(), m_lruOrder, entry.m_lruPosition);
+    }
+
+    AZStd::vector<QString> LocalBuildCache::EvictEntries()
+    {
+        AZStd::vector<QString> evictedEntries;
+        if (m_stats.m_sizeInBytes <= m_maxSizeInBytes)
+        {
+            return evictedEntries;
+        }
+
+        const AZ::u64 targetSizeInBytes = m_maxSizeInBytes / 100 * s_evictionTargetPercentage;
+        while (m_stats.m_sizeInBytes > targetSizeInBytes && !m_lruOrder.empty())
+        {
+            const AZStd::string cacheKey = m_lruOrder.front();
+            evictedEntries.push_back(GetEntryPath(cacheKey));
+            RemoveEntry(cacheKey);
+            ++m_stats.m_evictions;
+        }
+        return evictedEntries;
+    }
+} // namespace AssetProcessor
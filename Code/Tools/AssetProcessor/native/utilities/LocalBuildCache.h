@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+#include <QString>
+
+namespace AssetProcessor
+{
+    struct LocalBuildCacheStats
+    {
+        AZ::u64 m_hits = 0;
+        AZ::u64 m_misses = 0;
+        AZ::u64 m_stores = 0;
+        AZ::u64 m_evictions = 0;
+        AZ::u64 m_numEntries = 0;
+        AZ::u64 m_sizeInBytes = 0;
+    };
+
+    //! Content-addressed store for job results on the local disk.
+    //! The key is computed from everything that goes into a job (see AssetUtilities::GenerateBuildCacheKey), so identical jobs
+    //! in different branches or worktrees share their results when they are pointed at the same cache root.
+    struct ILocalBuildCacheRequests
+    {
+        AZ_RTTI(ILocalBuildCacheRequests, "{ADE269DB-4F22-4C76-AB7E-FA2B116F43EA}");
+
+        ILocalBuildCacheRequests() = default;
+        virtual ~ILocalBuildCacheRequests() = default;
+
+        //! Copies all files stored for the key into the target directory. Returns false if there is no entry for the key.
+        virtual bool RetrieveJobResult(const AZStd::string& cacheKey, const QString& targetDirectory) = 0;
+        //! Stores a copy of all files in the source directory for the key. An existing entry for the key is kept.
+        virtual bool StoreJobResult(const AZStd::string& cacheKey, const QString& sourceDirectory) = 0;
+
+        virtual LocalBuildCacheStats GetStats() const = 0;
+    };
+
+    //! Every entry is a directory named after its key, holding a copy of the temp folder of the job after it was processed.
+    //! Entries are written to a staging folder first and then renamed into place, so multiple Asset Processors can share a cache root.
+    //! Once the total size of the entries exceeds the budget, the least recently used entries are evicted.
+    //! The last access time of an entry is kept in the modification time of a marker file, so the order survives restarts.
+    class LocalBuildCache
+        : public ILocalBuildCacheRequests
+    {
+    public:
+        AZ_RTTI(LocalBuildCache, "{B54684B9-6B14-4ABC-B67B-010FC9B7B583}", ILocalBuildCacheRequests);
+
+        LocalBuildCache(const QString& cacheRoot, AZ::u64 maxSizeInBytes);
+        ~LocalBuildCache() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // ILocalBuildCacheRequests overrides
+        bool RetrieveJobResult(const AZStd::string& cacheKey, const QString& targetDirectory) override;
+        bool StoreJobResult(const AZStd::string& cacheKey, const QString& sourceDirectory) override;
+        LocalBuildCacheStats GetStats() const override;
+        //////////////////////////////////////////////////////////////////////////
+
+        void LogStats() const;
+
+        const QString& GetCacheRoot() const { return m_cacheRoot; }
+        AZ::u64 GetMaxSizeInBytes() const { return m_maxSizeInBytes; }
+
+        static constexpr const char* EntryMarkerFileName = ".buildcacheentry";
+        static constexpr const char* StagingFolderName = "staging";
+
+    private:
+        struct Entry
+        {
+            AZ::u64 m_sizeInBytes = 0;
+            AZStd::list<AZStd::string>::iterator m_lruPosition;
+        };
+
+        QString GetEntryPath(const AZStd::string& cacheKey) const;
+
+        //! Builds the index from the entries on disk, ordered by their last access.
+        void ScanEntries();
+        //! Picks up an entry that another Asset Processor stored after the index was built.
+        bool AddEntryFromDisk(const AZStd::string& cacheKey);
+        void RemoveEvictedEntries(const AZStd::vector<QString>& entryPaths) const;
+
+        // The following functions expect m_mutex to be locked
+        void AddEntry(const AZStd::string& cacheKey, AZ::u64 sizeInBytes);
+        void RemoveEntry(const AZStd::string& cacheKey);
+        void MarkUsed(Entry& entry);
+        //! Removes the least recently used entries from the index until the cache fits the budget, and returns their paths.
+        AZStd::vector<QString> EvictEntries();
+
+        QString m_cacheRoot;
+        AZ::u64 m_maxSizeInBytes = 0;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::list<AZStd::string> m_lruOrder; //!< Least recently used entry first.
+        AZStd::unordered_map<AZStd::string, Entry> m_entries;
+        LocalBuildCacheStats m_stats;
+    };
+} // namespace AssetProcessor
@@ -18,6 +18,8 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/StringFunc/StringFunc.h>
 
 #include <inttypes.h>
@@ -49,6 +51,7 @@ namespace AssetProcessor
             };
             
             AZStd::unordered_map<AZStd::string, StatsEntry> m_stats;
+            AZStd::mutex m_statsMutex; // stats can be captured from job threads, e.g. file hashes during analysis.
             bool m_dumpMachineReadableStats = false;
             bool m_dumpHumanReadableStats = true;
 
@@ -163,6 +166,7 @@ namespace AssetProcessor
 
         void StatsCaptureImpl::BeginCaptureStat(AZStd::string_view statName)
         {
+            AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
             StatsEntry& existingStat = m_stats[statName];
             if (existingStat.m_operationStartTime != timepoint())
             {
@@ -174,6 +178,7 @@ namespace AssetProcessor
 
         void StatsCaptureImpl::EndCaptureStat(AZStd::string_view statName)
         {
+            AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
             StatsEntry& existingStat = m_stats[statName];
             if (existingStat.m_operationStartTime != timepoint())
             {
@@ -185,6 +190,7 @@ namespace AssetProcessor
 
         void StatsCaptureImpl::Dump()
         {
+            AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
             timepoint startTimeStamp = AZStd::chrono::high_resolution_clock::now();
 
             auto settingsRegistry = AZ::SettingsRegistry::Get();
@@ -215,6 +221,7 @@ namespace AssetProcessor
             AZStd::vector<AZStd::string> allProcessJobsByPlatform; // bucketed by platform
             AZStd::vector<AZStd::string> allProcessJobsByJobKey; // bucketed by type of job (job key)
             AZStd::vector<AZStd::string> allHashFiles;
+            AZStd::vector<AZStd::string> allAnalysisPhases;
 
             // capture only existing keys as we will be expanding the stats
             // this approach avoids mutating an iterator.   
@@ -307,6 +314,11 @@ namespace AssetProcessor
                     statToSynth.m_cumulativeTime += statistic.m_cumulativeTime;
                     statToSynth.m_operationCount += statistic.m_operationCount;
                 }
+                else if (AZ::StringFunc::StartsWith(statKey, "AnalysisPhase,", true))
+                {
+                    // phases of the analysis of the scanned files, has the format AnalysisPhase,phasename
+                    allAnalysisPhases.push_back(statKey);
+                }
             }
             
             StatsEntry& gemLoadStat = m_stats["LoadingModules"];
@@ -318,6 +330,7 @@ namespace AssetProcessor
             StatsEntry& totalHashTime = m_stats["HashFileTotal"];
             PrintStat("HashFileTotal", totalHashTime.m_cumulativeTime, totalHashTime.m_operationCount);
             PrintStatsArray(allHashFiles, maxIndividualStats, "longest individual file hashes:");
+            PrintStatsArray(allAnalysisPhases, aznumeric_cast<int>(allAnalysisPhases.size()), "analysis phases:");
         
             // CreateJobs stats
             StatsEntry& totalCreateJobs = m_stats["CreateJobsTotal"];
@@ -1081,7 +1081,8 @@ namespace AssetUtilities
         return ReadJobLogResult::Success;
     }
 
-    unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail)
+    //! Builds the string that fingerprints and build cache keys are computed from.
+    static AZStd::string GenerateFingerprintString(const AssetProcessor::JobDetails& jobDetail)
     {
         // it is assumed that m_fingerprintFilesList contains the original file and all dependencies, and is in a stable order without duplicates
         // CRC32 is not an effective hash for this purpose, so we will build a string and then use SHA1 on it.
@@ -1125,6 +1126,13 @@ namespace AssetUtilities
         }
         s_largestFingerprintCapacitySoFar = AZStd::GetMax(fingerprintString.capacity(), s_largestFingerprintCapacitySoFar);
 
+        return fingerprintString;
+    }
+
+    unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail)
+    {
+        AZStd::string fingerprintString = GenerateFingerprintString(jobDetail);
+
         if (fingerprintString.empty())
         {
             AZ_Assert(false, "GenerateFingerprint was called but no input files were requested for fingerprinting.");
@@ -1139,6 +1147,28 @@ namespace AssetUtilities
         return digest[0]; // we only currently use 32-bit hashes.  This could be extended if collisions still occur.
     }
 
+    AZStd::string GenerateBuildCacheKey(const AssetProcessor::JobDetails& jobDetail)
+    {
+        AZStd::string fingerprintString = GenerateFingerprintString(jobDetail);
+        if (fingerprintString.empty())
+        {
+            return {};
+        }
+
+        // the fingerprint only has to tell apart the runs of a single job, but the key has to tell apart all jobs that use the cache
+        fingerprintString.append(AZStd::string::format(":%s:%s:%s",
+            jobDetail.m_jobEntry.m_builderGuid.ToString<AZStd::string>().c_str(),
+            jobDetail.m_jobEntry.m_platformInfo.m_identifier.c_str(),
+            jobDetail.m_jobEntry.m_jobKey.toUtf8().constData()));
+
+        AZ::Sha1 sha;
+        sha.ProcessBytes(fingerprintString.data(), fingerprintString.size());
+        AZ::u32 digest[5];
+        sha.GetDigest(digest);
+
+        return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+    }
+
     std::uint64_t AdjustTimestamp(QDateTime timestamp, int overridePrecision)
     {
         if (timestamp.isDaylightTime())
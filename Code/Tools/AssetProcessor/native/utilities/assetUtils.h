@@ -238,6 +238,11 @@ namespace AssetUtilities
     //! interrogate a given file, which is specified as a full path name, and generate a fingerprint for it.
     unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail);
 
+    //! Generates the key of the job in the local build cache, from the same inputs as the fingerprint of the job plus the builder, platform and job key.
+    //! Unlike the fingerprint, the key uses the full SHA1 digest, as it has to be unique across all jobs of all projects using the cache.
+    //! Returns an empty string if the job has no inputs to fingerprint.
+    AZStd::string GenerateBuildCacheKey(const AssetProcessor::JobDetails& jobDetail);
+
     //! Returns a hash of the contents of the specified file
     // hashMsDelay is only for automated tests to test that writing to a file while it's hashing does not cause a crash.
     // hashMsDelay is not used in non-unit test builds.
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
 #include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/MeshDrawPacket.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
@@ -16,6 +17,8 @@
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
 #include <Atom/Feature/Mesh/ModelReloaderSystemInterface.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
+#include <Mesh/MeshGpuDrivenCulling.h>
+#include <Mesh/MeshInstanceManager.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AtomCore/std/parallel/concurrency_checker.h>
 #include <AzCore/Console/Console.h>
@@ -81,7 +84,10 @@ namespace AZ
             void SetMeshLodConfiguration(RPI::Cullable::LodConfiguration meshLodConfig);
             RPI::Cullable::LodConfiguration GetMeshLodConfiguration() const;
             void UpdateDrawPackets(bool forceUpdate = false);
-            void BuildCullable();
+            //! Meshes which support instancing are added to the meshInstanceManager instead of the cullable, if it isn't null.
+            //! Their indexed draws are culled by gpuDrivenCulling instead of the views, if it isn't null either.
+            void BuildCullable(MeshInstanceManager* meshInstanceManager, MeshGpuDrivenCulling* gpuDrivenCulling);
+            void RemoveMeshInstances();
             void UpdateCullBounds(const TransformServiceFeatureProcessor* transformService);
             void UpdateObjectSrg();
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
@@ -91,6 +97,13 @@ namespace AZ
 
             AZStd::fixed_vector<DrawPacketList, RPI::ModelLodAsset::LodCountMax> m_drawPacketListsByLod;
             RPI::Cullable m_cullable;
+
+            //! The meshes which are drawn instanced, referenced by the visible object user data of the cullable lods.
+            AZStd::fixed_vector<AZStd::vector<MeshInstanceManager::Instance>, RPI::ModelLodAsset::LodCountMax> m_meshInstancesByLod;
+            MeshInstanceManager* m_meshInstanceManager = nullptr;
+            //! The instance of the meshes which are culled by the GPU-driven culling, if there are any.
+            MeshGpuDrivenCulling::InstanceIndex m_gpuDrivenCullingInstance = MeshGpuDrivenCulling::InvalidInstanceIndex;
+            MeshGpuDrivenCulling* m_gpuDrivenCulling = nullptr;
             MaterialAssignmentMap m_materialAssignments;
 
             MeshHandleDescriptor m_descriptor;
@@ -111,6 +124,9 @@ namespace AZ
 
             bool m_cullBoundsNeedsUpdate = false;
             bool m_cullableNeedsRebuild = false;
+            //! Whether the cullable was last built with instancing enabled, so it gets rebuilt once instancing was toggled.
+            bool m_cullableUsesInstancing = false;
+            bool m_cullableUsesGpuDrivenCulling = false;
             bool m_objectSrgNeedsUpdate = true;
             bool m_excludeFromReflectionCubeMaps = false;
             bool m_visible = true;
@@ -137,6 +153,8 @@ namespace AZ
             void Deactivate() override;
             //! Updates GPU buffers with latest data from render proxies
             void Simulate(const FeatureProcessor::SimulatePacket& packet) override;
+            //! Adds the instanced draw packets for the visible meshes which are drawn instanced
+            void OnEndCulling(const FeatureProcessor::RenderPacket& packet) override;
 
             // RPI::SceneNotificationBus overrides ...
             void OnBeginPrepareRender() override;
@@ -193,6 +211,13 @@ namespace AZ
 
             MeshFeatureProcessor(const MeshFeatureProcessor&) = delete;
 
+            void UpdateSceneSrg(RPI::ShaderResourceGroup* sceneSrg);
+            const RHI::DrawPacket* BuildInstancedDrawPacket(const MeshInstanceManager::InstanceBatch& batch);
+            const RHI::DrawPacket* BuildIndirectDrawPacket(
+                const MeshGpuDrivenCulling::IndirectBatch& batch, const RHI::IndirectBufferView& indirectBufferView);
+            //! Returns whether the group is drawn into a draw list the view sorts back to front, cached in m_groupDrawOrders.
+            bool IsGroupDrawnBackToFront(const RPI::View& view, MeshInstanceManager::GroupIndex groupIndex);
+
             // RPI::SceneNotificationBus::Handler overrides...
             void OnRenderPipelineAdded(RPI::RenderPipelinePtr pipeline) override;
             void OnRenderPipelineRemoved(RPI::RenderPipeline* pipeline) override;
@@ -203,6 +228,31 @@ namespace AZ
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
             bool m_forceRebuildDrawPackets = false;
+
+            // Instancing
+            MeshInstanceManager m_meshInstanceManager;
+            bool m_meshInstancingEnabled = false;
+            AZStd::vector<MeshInstanceManager::VisibleInstance> m_visibleInstances;
+            AZStd::vector<MeshInstanceManager::InstanceBatch> m_instanceBatches;
+            AZStd::vector<uint32_t> m_instanceObjectIds;
+            //! The draw order of every group in the view being batched, GroupDrawOrder::Unknown until it's needed.
+            enum class GroupDrawOrder : uint8_t
+            {
+                Unknown,
+                FrontToBack,
+                BackToFront
+            };
+            AZStd::vector<GroupDrawOrder> m_groupDrawOrders;
+            //! The instanced draw packets of the current frame, released when the draw packets of the next frame are built.
+            AZStd::vector<RHI::ConstPtr<RHI::DrawPacket>> m_instancedDrawPackets;
+            Data::Instance<RPI::Buffer> m_instanceObjectIdsBuffer;
+            RPI::Scene::PrepareSceneSrgEvent::Handler m_updateSceneSrgHandler;
+            RHI::ShaderInputNameIndex m_instanceObjectIdsIndex = "m_meshInstanceObjectIds";
+
+            // GPU-driven culling of the instanced meshes
+            MeshGpuDrivenCulling m_gpuDrivenCulling;
+            bool m_gpuDrivenCullingEnabled = false;
+            AZStd::vector<MeshGpuDrivenCulling::IndirectBatch> m_indirectBatches;
         };
     } // namespace Render
 } // namespace AZ
@@ -11,6 +11,7 @@
 #include <Atom/Feature/RenderCommon.h>
 #include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
 #include <Atom/Feature/Mesh/ModelReloaderSystemInterface.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Culling.h>
@@ -36,6 +37,25 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool,
+            r_meshInstancingEnabled,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Draws all visible meshes which share a model lod, material and shader variant with a single instanced draw item. "
+            "Only meshes whose shaders support instancing are affected, see Atom/Features/InstancedTransforms.azsli."
+        );
+
+        AZ_CVAR(bool,
+            r_meshGpuDrivenCulling,
+            false,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Culls the meshes drawn instanced with the GPU-driven culling data instead of the culling scene, and draws every instance "
+            "group with an indirect draw. Requires r_meshInstancingEnabled and indirect draw support. The culling runs on the CPU "
+            "until there is a culling pass for it."
+        );
+
         void MeshFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -58,6 +78,21 @@ namespace AZ
                 [this](const AZ::Name&, RPI::ShaderOptionValue) { m_forceRebuildDrawPackets = true; }
             };
             RPI::ShaderSystemInterface::Get()->Connect(m_handleGlobalShaderOptionUpdate);
+
+            // The buffer is bound to the scene srg even while instancing is disabled, as the shaders which support instancing declare it
+            RPI::CommonBufferDescriptor desc;
+            desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+            desc.m_bufferName = "m_meshInstanceObjectIds";
+            desc.m_byteCount = sizeof(uint32_t);
+            desc.m_elementSize = sizeof(uint32_t);
+            m_instanceObjectIdsBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+
+            m_updateSceneSrgHandler = RPI::Scene::PrepareSceneSrgEvent::Handler([this](RPI::ShaderResourceGroup* sceneSrg) { UpdateSceneSrg(sceneSrg); });
+            GetParentScene()->ConnectEvent(m_updateSceneSrgHandler);
+
+            // Without indirect draw support the instanced meshes stay on the culling scene
+            m_gpuDrivenCulling.Init();
+
             EnableSceneNotification();
         }
 
@@ -71,6 +106,14 @@ namespace AZ
             );
             m_transformService = nullptr;
             m_forceRebuildDrawPackets = false;
+
+            m_updateSceneSrgHandler.Disconnect();
+            m_instancedDrawPackets.clear();
+            m_instanceObjectIdsBuffer = {};
+            m_instanceObjectIdsIndex.Reset();
+
+            m_indirectBatches.clear();
+            m_gpuDrivenCulling.Shutdown();
         }
 
         TransformServiceFeatureProcessorInterface::ObjectId MeshFeatureProcessor::GetObjectId(const MeshHandle& meshHandle) const
@@ -90,6 +133,11 @@ namespace AZ
             AZ::Job* parentJob = packet.m_parentJob;
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
+            m_meshInstancingEnabled = r_meshInstancingEnabled;
+            MeshInstanceManager* meshInstanceManager = m_meshInstancingEnabled ? &m_meshInstanceManager : nullptr;
+            m_gpuDrivenCullingEnabled = m_meshInstancingEnabled && r_meshGpuDrivenCulling && m_gpuDrivenCulling.IsInitialized();
+            MeshGpuDrivenCulling* gpuDrivenCulling = m_gpuDrivenCullingEnabled ? &m_gpuDrivenCulling : nullptr;
+
             const auto iteratorRanges = m_modelData.GetParallelRanges();
             AZ::JobCompletion jobCompletion;
             for (const auto& iteratorRange : iteratorRanges)
@@ -121,9 +169,17 @@ namespace AZ
                         // to check every one.
                         meshDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
 
+                        // Toggling instancing moves the meshes between the cullables and the instance groups. This is checked per mesh,
+                        // as meshes which were hidden or still loading while instancing was toggled only get here once they are visible.
+                        if (meshDataIter->m_cullableUsesInstancing != m_meshInstancingEnabled ||
+                            meshDataIter->m_cullableUsesGpuDrivenCulling != m_gpuDrivenCullingEnabled)
+                        {
+                            meshDataIter->m_cullableNeedsRebuild = true;
+                        }
+
                         if (meshDataIter->m_cullableNeedsRebuild)
                         {
-                            meshDataIter->BuildCullable();
+                            meshDataIter->BuildCullable(meshInstanceManager, gpuDrivenCulling);
                         }
 
                         if (meshDataIter->m_cullBoundsNeedsUpdate)
@@ -155,9 +211,178 @@ namespace AZ
                 }
             }
 
+            if (m_meshInstancingEnabled)
+            {
+                m_meshInstanceManager.UpdateDrawPackets(*GetParentScene(), m_forceRebuildDrawPackets);
+            }
+
+            if (m_gpuDrivenCullingEnabled)
+            {
+                m_gpuDrivenCulling.UpdateBuffers(m_meshInstanceManager);
+            }
+
             m_forceRebuildDrawPackets = false;
         }
 
+        void MeshFeatureProcessor::OnEndCulling(const FeatureProcessor::RenderPacket& packet)
+        {
+            AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: OnEndCulling");
+
+            // The draw lists of the previous frame were submitted already
+            m_instancedDrawPackets.clear();
+            m_instanceObjectIds.clear();
+            m_indirectBatches.clear();
+
+            if (!m_meshInstancingEnabled)
+            {
+                return;
+            }
+
+            for (const RPI::ViewPtr& view : packet.m_views)
+            {
+                m_visibleInstances.clear();
+                m_groupDrawOrders.clear();
+                for (const RPI::View::VisibleObjectProperties& visibleObject : view->GetVisibleObjectList())
+                {
+                    // the mesh feature processor is the only one adding visible objects to the views
+                    const auto* instance = static_cast<const MeshInstanceManager::Instance*>(visibleObject.m_userData);
+                    m_visibleInstances.push_back({ instance->m_groupIndex, instance->m_objectId, visibleObject.m_depth,
+                        IsGroupDrawnBackToFront(*view, instance->m_groupIndex) });
+                }
+
+                MeshInstanceManager::BuildInstanceBatches(m_visibleInstances, m_instanceObjectIds, m_instanceBatches);
+
+                for (const MeshInstanceManager::InstanceBatch& batch : m_instanceBatches)
+                {
+                    if (const RHI::DrawPacket* drawPacket = BuildInstancedDrawPacket(batch))
+                    {
+                        m_instancedDrawPackets.emplace_back(drawPacket);
+                        view->AddDrawPacket(drawPacket, batch.m_depth);
+                    }
+                }
+
+                if (m_gpuDrivenCullingEnabled)
+                {
+                    m_gpuDrivenCulling.CullView(
+                        *view,
+                        [this, &view](MeshInstanceManager::GroupIndex groupIndex) { return IsGroupDrawnBackToFront(*view, groupIndex); },
+                        m_instanceObjectIds,
+                        m_indirectBatches);
+                }
+            }
+
+            // The draws of all views share one indirect buffer, so their draw packets are built once all views were culled
+            if (const RHI::IndirectBufferView* indirectBufferView = m_gpuDrivenCulling.WriteIndirectDraws())
+            {
+                for (const MeshGpuDrivenCulling::IndirectBatch& batch : m_indirectBatches)
+                {
+                    if (const RHI::DrawPacket* drawPacket = BuildIndirectDrawPacket(batch, *indirectBufferView))
+                    {
+                        m_instancedDrawPackets.emplace_back(drawPacket);
+                        batch.m_view->AddDrawPacket(drawPacket, batch.m_depth);
+                    }
+                }
+            }
+
+            if (!m_instanceObjectIds.empty())
+            {
+                const size_t byteCount = m_instanceObjectIds.size() * sizeof(uint32_t);
+                if (byteCount > m_instanceObjectIdsBuffer->GetBufferSize())
+                {
+                    // grow by powers of two, to avoid resizing the buffer every frame
+                    m_instanceObjectIdsBuffer->Resize(RHI::NextPowerOfTwo(aznumeric_cast<uint32_t>(m_instanceObjectIds.size())) * sizeof(uint32_t));
+                }
+                m_instanceObjectIdsBuffer->UpdateData(m_instanceObjectIds.data(), byteCount);
+            }
+        }
+
+        bool MeshFeatureProcessor::IsGroupDrawnBackToFront(const RPI::View& view, MeshInstanceManager::GroupIndex groupIndex)
+        {
+            if (groupIndex >= m_groupDrawOrders.size())
+            {
+                m_groupDrawOrders.resize(groupIndex + 1, GroupDrawOrder::Unknown);
+            }
+
+            GroupDrawOrder& drawOrder = m_groupDrawOrders[groupIndex];
+            if (drawOrder == GroupDrawOrder::Unknown)
+            {
+                // The instances of a draw are drawn in one order for all its draw lists, back to front wins so transparency is right
+                drawOrder = GroupDrawOrder::FrontToBack;
+                if (const RHI::DrawPacket* drawPacket = m_meshInstanceManager.GetGroup(groupIndex).m_drawPacket.GetRHIDrawPacket())
+                {
+                    for (size_t drawItemIndex = 0; drawItemIndex < drawPacket->GetDrawItemCount(); ++drawItemIndex)
+                    {
+                        const RHI::DrawListSortType sortType = view.GetDrawListSortType(drawPacket->GetDrawListTag(drawItemIndex));
+                        if (sortType == RHI::DrawListSortType::KeyThenReverseDepth || sortType == RHI::DrawListSortType::ReverseDepthThenKey)
+                        {
+                            drawOrder = GroupDrawOrder::BackToFront;
+                            break;
+                        }
+                    }
+                }
+            }
+            return drawOrder == GroupDrawOrder::BackToFront;
+        }
+
+        const RHI::DrawPacket* MeshFeatureProcessor::BuildInstancedDrawPacket(const MeshInstanceManager::InstanceBatch& batch)
+        {
+            const RPI::MeshDrawPacket& meshDrawPacket = m_meshInstanceManager.GetGroup(batch.m_groupIndex).m_drawPacket;
+            const RHI::DrawPacket* templateDrawPacket = meshDrawPacket.GetRHIDrawPacket();
+            if (!templateDrawPacket || templateDrawPacket->GetDrawItemCount() == 0)
+            {
+                return nullptr;
+            }
+
+            RHI::DrawArguments drawArguments = templateDrawPacket->GetDrawItem(0).m_item->m_arguments;
+            switch (drawArguments.m_type)
+            {
+            case RHI::DrawType::Indexed:
+                drawArguments.m_indexed.m_instanceCount = batch.m_instanceCount;
+                break;
+            case RHI::DrawType::Linear:
+                drawArguments.m_linear.m_instanceCount = batch.m_instanceCount;
+                break;
+            default:
+                AZ_Warning("MeshFeatureProcessor", false, "Only indexed and linear draws can be instanced.");
+                return nullptr;
+            }
+
+            RHI::ConstantsData rootConstants = meshDrawPacket.GetRootConstants();
+            rootConstants.SetConstant(meshDrawPacket.GetInstanceDataOffsetIndex(), batch.m_instanceOffset);
+
+            RHI::DrawPacketBuilder drawPacketBuilder;
+            drawPacketBuilder.BeginClone(nullptr, templateDrawPacket);
+            drawPacketBuilder.SetDrawArguments(drawArguments);
+            drawPacketBuilder.SetRootConstants(rootConstants.GetConstantData());
+            return drawPacketBuilder.End();
+        }
+
+        const RHI::DrawPacket* MeshFeatureProcessor::BuildIndirectDrawPacket(
+            const MeshGpuDrivenCulling::IndirectBatch& batch, const RHI::IndirectBufferView& indirectBufferView)
+        {
+            const RPI::MeshDrawPacket& meshDrawPacket = m_meshInstanceManager.GetGroup(batch.m_groupIndex).m_drawPacket;
+            const RHI::DrawPacket* templateDrawPacket = meshDrawPacket.GetRHIDrawPacket();
+            if (!templateDrawPacket || templateDrawPacket->GetDrawItemCount() == 0)
+            {
+                return nullptr;
+            }
+
+            // The instance count is read from the indirect buffer, the offset of the object ids is set like for instanced draws
+            RHI::ConstantsData rootConstants = meshDrawPacket.GetRootConstants();
+            rootConstants.SetConstant(meshDrawPacket.GetInstanceDataOffsetIndex(), batch.m_instanceOffset);
+
+            RHI::DrawPacketBuilder drawPacketBuilder;
+            drawPacketBuilder.BeginClone(nullptr, templateDrawPacket);
+            drawPacketBuilder.SetDrawArguments(RHI::DrawIndirect(1, indirectBufferView, batch.m_indirectByteOffset));
+            drawPacketBuilder.SetRootConstants(rootConstants.GetConstantData());
+            return drawPacketBuilder.End();
+        }
+
+        void MeshFeatureProcessor::UpdateSceneSrg(RPI::ShaderResourceGroup* sceneSrg)
+        {
+            sceneSrg->SetBufferView(m_instanceObjectIdsIndex, m_instanceObjectIdsBuffer->GetBufferView());
+        }
+
         void MeshFeatureProcessor::OnBeginPrepareRender()
         {
             m_meshDataChecker.soft_lock();
@@ -179,6 +404,8 @@ namespace AZ
 
             meshDataHandle->m_descriptor = descriptor;
             meshDataHandle->m_scene = GetParentScene();
+            meshDataHandle->m_meshInstanceManager = &m_meshInstanceManager;
+            meshDataHandle->m_gpuDrivenCulling = &m_gpuDrivenCulling;
             meshDataHandle->m_materialAssignments = materials;
             meshDataHandle->m_objectId = m_transformService->ReserveObjectId();
             meshDataHandle->m_originalModelAsset = descriptor.m_modelAsset;
@@ -418,6 +645,8 @@ namespace AZ
                 {
                     meshHandle->m_cullable.m_cullData.m_hideFlags &= ~RPI::View::UsageReflectiveCubeMap;
                 }
+                // the GPU-driven culling instance gets its hide flags with the bounds
+                meshHandle->m_cullBoundsNeedsUpdate = true;
             }
         }
 
@@ -644,6 +873,7 @@ namespace AZ
             m_scene->GetCullingScene()->UnregisterCullable(m_cullable);
 
             RemoveRayTracingData();
+            RemoveMeshInstances();
 
             m_drawPacketListsByLod.clear();
             m_materialAssignments.clear();
@@ -1066,6 +1296,8 @@ namespace AZ
         void ModelDataInstance::SetMeshLodConfiguration(RPI::Cullable::LodConfiguration meshLodConfig)
         {
             m_cullable.m_lodData.m_lodConfiguration = meshLodConfig;
+            // the GPU-driven culling instance gets its lod override with the bounds
+            m_cullBoundsNeedsUpdate = true;
         }
 
         RPI::Cullable::LodConfiguration ModelDataInstance::GetMeshLodConfiguration() const
@@ -1087,7 +1319,25 @@ namespace AZ
             }
         }
 
-        void ModelDataInstance::BuildCullable()
+        void ModelDataInstance::RemoveMeshInstances()
+        {
+            for (const auto& meshInstances : m_meshInstancesByLod)
+            {
+                for (const MeshInstanceManager::Instance& meshInstance : meshInstances)
+                {
+                    m_meshInstanceManager->RemoveInstance(meshInstance.m_groupIndex);
+                }
+            }
+            m_meshInstancesByLod.clear();
+
+            if (m_gpuDrivenCullingInstance != MeshGpuDrivenCulling::InvalidInstanceIndex)
+            {
+                m_gpuDrivenCulling->RemoveInstance(m_gpuDrivenCullingInstance);
+                m_gpuDrivenCullingInstance = MeshGpuDrivenCulling::InvalidInstanceIndex;
+            }
+        }
+
+        void ModelDataInstance::BuildCullable(MeshInstanceManager* meshInstanceManager, MeshGpuDrivenCulling* gpuDrivenCulling)
         {
             AZ_Assert(m_cullableNeedsRebuild, "This function only needs to be called if the cullable to be rebuilt");
             AZ_Assert(m_model, "The model has not finished loading yet");
@@ -1105,6 +1355,15 @@ namespace AZ
             lodData.m_lods.resize(modelLodCount);
             cullData.m_drawListMask.reset();
 
+            RemoveMeshInstances();
+            if (meshInstanceManager)
+            {
+                m_meshInstancesByLod.resize(modelLodCount);
+            }
+
+            AZStd::fixed_vector<RPI::GpuDrivenCulling::LodData, RPI::ModelLodAsset::LodCountMax> gpuDrivenLods;
+            AZStd::vector<RPI::GpuDrivenCulling::DrawData> gpuDrivenDraws;
+
             const size_t lodCount = lodAssets.size();
             for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
             {
@@ -1133,8 +1392,20 @@ namespace AZ
                 }
 
                 lod.m_drawPackets.clear();
-                for (const RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
+                lod.m_visibleObjectUserData.clear();
+                if (meshInstanceManager)
                 {
+                    // the visible object user data points into the list, so it must not be reallocated
+                    m_meshInstancesByLod[lodIndex].reserve(m_drawPacketListsByLod[lodIndex].size());
+                }
+                if (gpuDrivenCulling)
+                {
+                    gpuDrivenLods.push_back({ lod.m_screenCoverageMin, lod.m_screenCoverageMax, aznumeric_cast<uint32_t>(gpuDrivenDraws.size()), 0 });
+                }
+
+                for (uint32_t meshIndex = 0; meshIndex < m_drawPacketListsByLod[lodIndex].size(); ++meshIndex)
+                {
+                    const RPI::MeshDrawPacket& meshDrawPacket = m_drawPacketListsByLod[lodIndex][meshIndex];
                     const RHI::DrawPacket* rhiDrawPacket = meshDrawPacket.GetRHIDrawPacket();
 
                     if (rhiDrawPacket)
@@ -1142,7 +1413,39 @@ namespace AZ
                         //OR-together all the drawListMasks (so we know which views to cull against)
                         cullData.m_drawListMask |= rhiDrawPacket->GetDrawListMask();
 
-                        lod.m_drawPackets.push_back(rhiDrawPacket);
+                        if (meshInstanceManager && meshDrawPacket.SupportsInstancing())
+                        {
+                            MeshInstanceGroupKey key;
+                            key.m_modelLod = m_model->GetLods()[lodIndex].get();
+                            key.m_meshIndex = meshIndex;
+                            key.m_material = meshDrawPacket.GetMaterial().get();
+                            key.m_sortKey = m_sortKey;
+                            for (size_t drawItemIndex = 0; drawItemIndex < rhiDrawPacket->GetDrawItemCount(); ++drawItemIndex)
+                            {
+                                const RHI::DrawItem* drawItem = rhiDrawPacket->GetDrawItem(drawItemIndex).m_item;
+                                AZStd::hash_combine(key.m_shaderVariantHash, drawItem->m_pipelineState);
+                                key.m_stencilRef = drawItem->m_stencilRef;
+                            }
+
+                            MeshInstanceManager::Instance& meshInstance = m_meshInstancesByLod[lodIndex].emplace_back();
+                            meshInstance.m_groupIndex = meshInstanceManager->AddInstance(key, meshDrawPacket);
+                            meshInstance.m_objectId = m_objectId.GetIndex();
+                            if (gpuDrivenCulling && rhiDrawPacket->GetDrawItemCount() > 0 &&
+                                rhiDrawPacket->GetDrawItem(0).m_item->m_arguments.m_type == RHI::DrawType::Indexed)
+                            {
+                                // drawn by the indirect draw of the group, so it's not added to the views
+                                gpuDrivenDraws.push_back({ meshInstance.m_groupIndex });
+                                ++gpuDrivenLods.back().m_drawCount;
+                            }
+                            else
+                            {
+                                lod.m_visibleObjectUserData.push_back(&meshInstance);
+                            }
+                        }
+                        else
+                        {
+                            lod.m_drawPackets.push_back(rhiDrawPacket);
+                        }
                     }
                 }
             }
@@ -1159,6 +1462,13 @@ namespace AZ
             m_cullable.SetDebugName(AZ::Name(AZStd::string::format("%s - objectId: %u", m_model->GetModelAsset()->GetName().GetCStr(), m_objectId.GetIndex())));
 #endif
 
+            if (!gpuDrivenDraws.empty())
+            {
+                m_gpuDrivenCullingInstance = gpuDrivenCulling->AddInstance(gpuDrivenLods, gpuDrivenDraws);
+            }
+
+            m_cullableUsesInstancing = meshInstanceManager != nullptr;
+            m_cullableUsesGpuDrivenCulling = gpuDrivenCulling != nullptr;
             m_cullableNeedsRebuild = false;
             m_cullBoundsNeedsUpdate = true;
         }
@@ -1185,6 +1495,13 @@ namespace AZ
             m_cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
             m_scene->GetCullingScene()->RegisterOrUpdateCullable(m_cullable);
 
+            if (m_gpuDrivenCullingInstance != MeshGpuDrivenCulling::InvalidInstanceIndex)
+            {
+                RPI::GpuDrivenCulling::InstanceData instanceData = RPI::GpuDrivenCulling::CreateInstanceData(m_cullable);
+                instanceData.m_objectId = m_objectId.GetIndex();
+                m_gpuDrivenCulling->UpdateInstance(m_gpuDrivenCullingInstance, instanceData);
+            }
+
             m_cullBoundsNeedsUpdate = false;
         }
 
@@ -1285,6 +1602,11 @@ namespace AZ
         {
             m_visible = isVisible;
             m_cullable.m_isHidden = !isVisible;
+            // the meshes are skipped while they're hidden, so the instance isn't updated with the bounds
+            if (m_gpuDrivenCullingInstance != MeshGpuDrivenCulling::InvalidInstanceIndex)
+            {
+                m_gpuDrivenCulling->SetInstanceHidden(m_gpuDrivenCullingInstance, !isVisible);
+            }
         }
     } // namespace Render
 } // namespace AZ
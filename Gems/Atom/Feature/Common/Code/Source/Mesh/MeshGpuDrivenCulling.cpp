@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshGpuDrivenCulling.h>
+
+#include <Atom/RHI/Factory.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RHI.Reflect/Bits.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        bool MeshGpuDrivenCulling::Init()
+        {
+            RHI::Device* device = RHI::RHISystemInterface::Get()->GetDevice();
+            if (!device->GetFeatures().m_indirectDrawSupport)
+            {
+                return false;
+            }
+
+            // The layout only has the draw, so the signature doesn't depend on the pipeline state and is shared by all groups
+            RHI::IndirectBufferSignatureDescriptor signatureDescriptor;
+            signatureDescriptor.m_layout.AddIndirectCommand(RHI::IndirectCommandType::DrawIndexed);
+            signatureDescriptor.m_layout.Finalize();
+
+            m_indirectSignature = RHI::Factory::Get().CreateIndirectBufferSignature();
+            if (m_indirectSignature->Init(*device, signatureDescriptor) != RHI::ResultCode::Success)
+            {
+                AZ_Error("MeshGpuDrivenCulling", false, "Failed to initialize the indirect buffer signature");
+                m_indirectSignature = nullptr;
+                return false;
+            }
+            m_indirectStride = m_indirectSignature->GetByteStride();
+
+            // The draw arguments are rewritten every frame, the buffer is orphaned instead of tracking the frames in flight
+            RHI::BufferPoolDescriptor poolDescriptor;
+            poolDescriptor.m_heapMemoryLevel = RHI::HeapMemoryLevel::Host;
+            poolDescriptor.m_hostMemoryAccess = RHI::HostMemoryAccess::Write;
+            poolDescriptor.m_bindFlags = RHI::BufferBindFlags::Indirect;
+
+            m_indirectBufferPool = RHI::Factory::Get().CreateBufferPool();
+            m_indirectBufferPool->SetName(Name("MeshGpuDrivenCullingIndirectBufferPool"));
+            if (m_indirectBufferPool->Init(*device, poolDescriptor) != RHI::ResultCode::Success)
+            {
+                AZ_Error("MeshGpuDrivenCulling", false, "Failed to initialize the indirect buffer pool");
+                Shutdown();
+                return false;
+            }
+
+            m_indirectWriter = RHI::Factory::Get().CreateIndirectBufferWriter();
+            return true;
+        }
+
+        void MeshGpuDrivenCulling::Shutdown()
+        {
+            if (m_indirectWriter)
+            {
+                m_indirectWriter->Shutdown();
+            }
+            m_indirectWriter = nullptr;
+            m_indirectBufferView = {};
+            m_indirectBuffer = nullptr;
+            m_indirectBufferPool = nullptr;
+            m_indirectSignature = nullptr;
+            m_indirectSequenceCount = 0;
+            m_indirectDraws.clear();
+
+            m_instanceBuffer = {};
+            m_lodBuffer = {};
+            m_drawBuffer = {};
+            m_groupBuffer = {};
+        }
+
+        bool MeshGpuDrivenCulling::IsInitialized() const
+        {
+            return m_indirectSignature != nullptr;
+        }
+
+        MeshGpuDrivenCulling::InstanceIndex MeshGpuDrivenCulling::AddInstance(
+            AZStd::span<const RPI::GpuDrivenCulling::LodData> lods, AZStd::span<const RPI::GpuDrivenCulling::DrawData> draws)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            InstanceIndex instanceIndex;
+            if (!m_freeInstanceIndices.empty())
+            {
+                instanceIndex = m_freeInstanceIndices.back();
+                m_freeInstanceIndices.pop_back();
+            }
+            else
+            {
+                instanceIndex = aznumeric_cast<InstanceIndex>(m_instances.size());
+                m_instances.emplace_back();
+                m_instanceLayouts.emplace_back();
+            }
+
+            // the instance stays culled until its bounds are set with UpdateInstance
+            m_instances[instanceIndex] = {};
+            InstanceLayout& layout = m_instanceLayouts[instanceIndex];
+            layout.m_lods.assign(lods.begin(), lods.end());
+            layout.m_draws.assign(draws.begin(), draws.end());
+            m_layoutChanged = true;
+            return instanceIndex;
+        }
+
+        void MeshGpuDrivenCulling::RemoveInstance(InstanceIndex instanceIndex)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            AZ_Assert(instanceIndex < m_instances.size(), "Removing an invalid instance.");
+            m_instances[instanceIndex] = {};
+            m_instanceLayouts[instanceIndex] = {};
+            m_freeInstanceIndices.push_back(instanceIndex);
+            m_layoutChanged = true;
+        }
+
+        void MeshGpuDrivenCulling::UpdateInstance(InstanceIndex instanceIndex, const RPI::GpuDrivenCulling::InstanceData& instanceData)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            RPI::GpuDrivenCulling::InstanceData& instance = m_instances[instanceIndex];
+            const uint32_t firstLod = instance.m_firstLod;
+            const uint32_t lodCount = instance.m_lodCount;
+            instance = instanceData;
+            instance.m_firstLod = firstLod;
+            instance.m_lodCount = lodCount;
+            m_instancesChanged = true;
+        }
+
+        void MeshGpuDrivenCulling::SetInstanceHidden(InstanceIndex instanceIndex, bool isHidden)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            m_instances[instanceIndex].m_isHidden = isHidden ? 1 : 0;
+            m_instancesChanged = true;
+        }
+
+        void MeshGpuDrivenCulling::RebuildLayout()
+        {
+            m_lods.clear();
+            m_draws.clear();
+            for (size_t instanceIndex = 0; instanceIndex < m_instances.size(); ++instanceIndex)
+            {
+                RPI::GpuDrivenCulling::InstanceData& instance = m_instances[instanceIndex];
+                const InstanceLayout& layout = m_instanceLayouts[instanceIndex];
+
+                const uint32_t firstDraw = aznumeric_cast<uint32_t>(m_draws.size());
+                instance.m_firstLod = aznumeric_cast<uint32_t>(m_lods.size());
+                instance.m_lodCount = aznumeric_cast<uint32_t>(layout.m_lods.size());
+                for (const RPI::GpuDrivenCulling::LodData& lod : layout.m_lods)
+                {
+                    m_lods.push_back(lod);
+                    m_lods.back().m_firstDraw += firstDraw;
+                }
+                m_draws.insert(m_draws.end(), layout.m_draws.begin(), layout.m_draws.end());
+            }
+        }
+
+        void MeshGpuDrivenCulling::UpdateBuffers(const MeshInstanceManager& meshInstanceManager)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "MeshGpuDrivenCulling: UpdateBuffers");
+
+            const bool layoutChanged = m_layoutChanged;
+            if (layoutChanged)
+            {
+                RebuildLayout();
+                UploadBuffer(m_lodBuffer, "m_gpuDrivenCullingLods", m_lods.data(), sizeof(RPI::GpuDrivenCulling::LodData), m_lods.size());
+                UploadBuffer(m_drawBuffer, "m_gpuDrivenCullingDraws", m_draws.data(), sizeof(RPI::GpuDrivenCulling::DrawData), m_draws.size());
+                m_layoutChanged = false;
+                m_instancesChanged = true;
+            }
+
+            if (m_instancesChanged)
+            {
+                UploadBuffer(
+                    m_instanceBuffer, "m_gpuDrivenCullingInstances", m_instances.data(), sizeof(RPI::GpuDrivenCulling::InstanceData),
+                    m_instances.size());
+                m_instancesChanged = false;
+            }
+
+            // The draw arguments of the groups change with the draw packets of the groups, e.g. after a model reload
+            uint32_t groupCount = 0;
+            for (const RPI::GpuDrivenCulling::DrawData& draw : m_draws)
+            {
+                groupCount = AZStd::max(groupCount, draw.m_groupIndex + 1);
+            }
+
+            bool groupsChanged = layoutChanged || groupCount != m_groups.size();
+            m_groups.resize(groupCount);
+            for (MeshInstanceManager::GroupIndex groupIndex = 0; groupIndex < groupCount; ++groupIndex)
+            {
+                RHI::DrawIndexed drawIndexed;
+                const MeshInstanceManager::Group& group = meshInstanceManager.GetGroup(groupIndex);
+                const RHI::DrawPacket* drawPacket = group.m_instanceCount > 0 ? group.m_drawPacket.GetRHIDrawPacket() : nullptr;
+                if (drawPacket && drawPacket->GetDrawItemCount() > 0 &&
+                    drawPacket->GetDrawItem(0).m_item->m_arguments.m_type == RHI::DrawType::Indexed)
+                {
+                    drawIndexed = drawPacket->GetDrawItem(0).m_item->m_arguments.m_indexed;
+                }
+
+                RPI::GpuDrivenCulling::GroupData& groupData = m_groups[groupIndex];
+                if (groupData.m_indexCount != drawIndexed.m_indexCount ||
+                    groupData.m_indexOffset != drawIndexed.m_indexOffset ||
+                    groupData.m_vertexOffset != drawIndexed.m_vertexOffset)
+                {
+                    groupData.m_indexCount = drawIndexed.m_indexCount;
+                    groupData.m_indexOffset = drawIndexed.m_indexOffset;
+                    groupData.m_vertexOffset = drawIndexed.m_vertexOffset;
+                    groupsChanged = true;
+                }
+            }
+
+            if (layoutChanged)
+            {
+                RPI::GpuDrivenCulling::AssignGroupInstanceRanges(m_instances, m_lods, m_draws, m_groups);
+            }
+
+            if (groupsChanged)
+            {
+                UploadBuffer(m_groupBuffer, "m_gpuDrivenCullingGroups", m_groups.data(), sizeof(RPI::GpuDrivenCulling::GroupData), m_groups.size());
+            }
+        }
+
+        void MeshGpuDrivenCulling::UploadBuffer(
+            Data::Instance<RPI::Buffer>& buffer, const char* bufferName, const void* data, size_t elementSize, size_t elementCount)
+        {
+            if (elementCount == 0)
+            {
+                return;
+            }
+
+            // grow by powers of two, to avoid resizing the buffers whenever a mesh is added
+            const uint64_t byteCount = elementSize * elementCount;
+            const uint64_t capacity = elementSize * RHI::NextPowerOfTwo(aznumeric_cast<uint32_t>(elementCount));
+            if (!buffer)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                desc.m_bufferName = bufferName;
+                desc.m_byteCount = capacity;
+                desc.m_elementSize = aznumeric_cast<uint32_t>(elementSize);
+                buffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            }
+            else if (byteCount > buffer->GetBufferSize())
+            {
+                buffer->Resize(capacity);
+            }
+
+            if (buffer)
+            {
+                buffer->UpdateData(data, byteCount);
+            }
+        }
+
+        void MeshGpuDrivenCulling::CullView(
+            RPI::View& view,
+            const AZStd::function<bool(MeshInstanceManager::GroupIndex)>& isGroupDrawnBackToFront,
+            AZStd::vector<uint32_t>& instanceObjectIds,
+            AZStd::vector<IndirectBatch>& batches)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "MeshGpuDrivenCulling: CullView");
+
+            if (m_groups.empty())
+            {
+                return;
+            }
+
+            RPI::GpuDrivenCulling::CullInstances(
+                RPI::GpuDrivenCulling::CreateViewData(view), m_instances, m_lods, m_draws, m_groups, m_cullingOutput);
+
+            const Matrix4x4& viewToWorld = view.GetViewToWorldMatrix();
+            const Vector3 viewPosition = viewToWorld.GetTranslation();
+            const Vector3 viewDirection = -viewToWorld.GetBasisZAsVector3();
+
+            for (MeshInstanceManager::GroupIndex groupIndex = 0; groupIndex < m_groups.size(); ++groupIndex)
+            {
+                // Unlike a culling pass on the GPU, the CPU knows which groups have no visible instances and skips their draws
+                const RHI::DrawIndexed& drawArguments = m_cullingOutput.m_drawArguments[groupIndex];
+                if (drawArguments.m_instanceCount == 0)
+                {
+                    continue;
+                }
+
+                const uint32_t firstInstance = m_groups[groupIndex].m_firstInstance;
+                m_sortedGroupInstances.clear();
+                for (uint32_t index = firstInstance; index < firstInstance + drawArguments.m_instanceCount; ++index)
+                {
+                    const RPI::GpuDrivenCulling::InstanceData& instance = m_instances[m_cullingOutput.m_groupInstances[index]];
+                    const Vector3 center(instance.m_boundingSphere[0], instance.m_boundingSphere[1], instance.m_boundingSphere[2]);
+                    m_sortedGroupInstances.emplace_back((center - viewPosition).Dot(viewDirection), instance.m_objectId);
+                }
+
+                if (isGroupDrawnBackToFront(groupIndex))
+                {
+                    AZStd::sort(m_sortedGroupInstances.begin(), m_sortedGroupInstances.end(),
+                        [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+                }
+                else
+                {
+                    AZStd::sort(m_sortedGroupInstances.begin(), m_sortedGroupInstances.end(),
+                        [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+                }
+
+                IndirectBatch& batch = batches.emplace_back();
+                batch.m_view = &view;
+                batch.m_groupIndex = groupIndex;
+                batch.m_instanceOffset = aznumeric_cast<uint32_t>(instanceObjectIds.size());
+                batch.m_indirectByteOffset = aznumeric_cast<uint32_t>(m_indirectDraws.size()) * m_indirectStride;
+                batch.m_depth = m_sortedGroupInstances.front().first;
+
+                for (const auto& [depth, objectId] : m_sortedGroupInstances)
+                {
+                    instanceObjectIds.push_back(objectId);
+                }
+                m_indirectDraws.push_back(drawArguments);
+            }
+        }
+
+        bool MeshGpuDrivenCulling::ReserveIndirectBuffer(uint32_t sequenceCount)
+        {
+            if (m_indirectBuffer && sequenceCount <= m_indirectSequenceCount)
+            {
+                // the draws of the previous frames may still be in flight
+                return m_indirectBufferPool->OrphanBuffer(*m_indirectBuffer) == RHI::ResultCode::Success;
+            }
+
+            // The writer is bound to the buffer it was initialized with
+            m_indirectWriter->Shutdown();
+
+            m_indirectSequenceCount = RHI::NextPowerOfTwo(sequenceCount);
+            m_indirectBuffer = RHI::Factory::Get().CreateBuffer();
+            m_indirectBuffer->SetName(Name("MeshGpuDrivenCullingIndirectBuffer"));
+
+            RHI::BufferInitRequest request;
+            request.m_buffer = m_indirectBuffer.get();
+            request.m_descriptor = RHI::BufferDescriptor{ RHI::BufferBindFlags::Indirect, size_t{ m_indirectSequenceCount } * m_indirectStride };
+            if (m_indirectBufferPool->InitBuffer(request) != RHI::ResultCode::Success ||
+                m_indirectWriter->Init(*m_indirectBuffer, 0, m_indirectStride, m_indirectSequenceCount, *m_indirectSignature) != RHI::ResultCode::Success)
+            {
+                AZ_Error("MeshGpuDrivenCulling", false, "Failed to initialize the indirect buffer for %u draws", m_indirectSequenceCount);
+                m_indirectBufferView = {};
+                m_indirectBuffer = nullptr;
+                m_indirectSequenceCount = 0;
+                return false;
+            }
+
+            m_indirectBufferView = RHI::IndirectBufferView(
+                *m_indirectBuffer, *m_indirectSignature, 0, m_indirectSequenceCount * m_indirectStride, m_indirectStride);
+            return true;
+        }
+
+        const RHI::IndirectBufferView* MeshGpuDrivenCulling::WriteIndirectDraws()
+        {
+            AZ_PROFILE_SCOPE(AzRender, "MeshGpuDrivenCulling: WriteIndirectDraws");
+
+            if (m_indirectDraws.empty())
+            {
+                return nullptr;
+            }
+
+            const RHI::IndirectBufferView* indirectBufferView = nullptr;
+            if (ReserveIndirectBuffer(aznumeric_cast<uint32_t>(m_indirectDraws.size())))
+            {
+                for (uint32_t sequenceIndex = 0; sequenceIndex < m_indirectDraws.size(); ++sequenceIndex)
+                {
+                    m_indirectWriter->Seek(sequenceIndex);
+                    m_indirectWriter->DrawIndexed(m_indirectDraws[sequenceIndex]);
+                }
+                m_indirectWriter->Flush();
+                indirectBufferView = &m_indirectBufferView;
+            }
+
+            m_indirectDraws.clear();
+            return indirectBufferView;
+        }
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/Buffer.h>
+#include <Atom/RHI/BufferPool.h>
+#include <Atom/RHI/IndirectBufferSignature.h>
+#include <Atom/RHI/IndirectBufferView.h>
+#include <Atom/RHI/IndirectBufferWriter.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/GpuDrivenCulling.h>
+#include <Mesh/MeshInstanceManager.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class View;
+    }
+
+    namespace Render
+    {
+        //! Culls the meshes which are drawn instanced with the data layouts of RPI::GpuDrivenCulling, and draws every group of the
+        //! MeshInstanceManager with an indirect indexed draw instead of adding the meshes to the views as visible objects.
+        //! The instances, their lods and the draws of the lods are kept in persistent structured buffers which are only uploaded
+        //! when they change. The culling runs the CPU reference of RPI::GpuDrivenCulling and writes the draw arguments of the
+        //! groups of all views to one indirect buffer, which a culling pass on the GPU is going to write instead.
+        class MeshGpuDrivenCulling
+        {
+        public:
+            using InstanceIndex = uint32_t;
+            static constexpr InstanceIndex InvalidInstanceIndex = AZStd::numeric_limits<InstanceIndex>::max();
+
+            //! The indirect draw of a group with visible instances in a view.
+            struct IndirectBatch
+            {
+                RPI::View* m_view = nullptr;
+                MeshInstanceManager::GroupIndex m_groupIndex = MeshInstanceManager::InvalidGroupIndex;
+                //! The index of the first object id of the batch, like MeshInstanceManager::InstanceBatch::m_instanceOffset.
+                uint32_t m_instanceOffset = 0;
+                //! The byte offset of the draw arguments of the batch in the indirect buffer.
+                uint32_t m_indirectByteOffset = 0;
+                float m_depth = 0.0f;
+            };
+
+            //! Creates the buffers and the indirect buffer signature. Returns false if the device doesn't support indirect draws,
+            //! the meshes then stay on the instanced draws of the MeshInstanceManager.
+            bool Init();
+            void Shutdown();
+            bool IsInitialized() const;
+
+            //! Adds an instance with its lods, the first draw of each lod indexes into the draws of the instance.
+            //! This function is thread safe.
+            InstanceIndex AddInstance(AZStd::span<const RPI::GpuDrivenCulling::LodData> lods, AZStd::span<const RPI::GpuDrivenCulling::DrawData> draws);
+
+            //! This function is thread safe.
+            void RemoveInstance(InstanceIndex instanceIndex);
+
+            //! Updates the bounds, the filters and the object id of an instance, its lod range is kept. This function is thread safe.
+            void UpdateInstance(InstanceIndex instanceIndex, const RPI::GpuDrivenCulling::InstanceData& instanceData);
+
+            //! This function is thread safe.
+            void SetInstanceHidden(InstanceIndex instanceIndex, bool isHidden);
+
+            //! Updates the group data from the draw packets of the groups and uploads the buffers which changed.
+            //! Must not be called while instances are added, removed or updated.
+            void UpdateBuffers(const MeshInstanceManager& meshInstanceManager);
+
+            //! Culls the instances against the view and appends the indirect draws of the groups with visible instances to the batches.
+            //! The object ids of the instances of each batch are appended to instanceObjectIds, sorted by depth in the order of the
+            //! draw lists of their group like MeshInstanceManager::BuildInstanceBatches does.
+            void CullView(
+                RPI::View& view,
+                const AZStd::function<bool(MeshInstanceManager::GroupIndex)>& isGroupDrawnBackToFront,
+                AZStd::vector<uint32_t>& instanceObjectIds,
+                AZStd::vector<IndirectBatch>& batches);
+
+            //! Writes the draw arguments of the batches of all views culled since the last call to the indirect buffer.
+            //! Returns the view of the indirect buffer the batches are drawn with, or null if there is nothing to draw.
+            const RHI::IndirectBufferView* WriteIndirectDraws();
+
+        private:
+            //! The lods and draws of an instance, copied into the lod and draw buffers when the instances change.
+            struct InstanceLayout
+            {
+                AZStd::vector<RPI::GpuDrivenCulling::LodData> m_lods;
+                AZStd::vector<RPI::GpuDrivenCulling::DrawData> m_draws;
+            };
+
+            void RebuildLayout();
+            //! Grows the structured buffer to fit the data and uploads it.
+            void UploadBuffer(Data::Instance<RPI::Buffer>& buffer, const char* bufferName, const void* data, size_t elementSize, size_t elementCount);
+            bool ReserveIndirectBuffer(uint32_t sequenceCount);
+
+            AZStd::mutex m_mutex;
+            AZStd::vector<RPI::GpuDrivenCulling::InstanceData> m_instances;
+            AZStd::vector<InstanceLayout> m_instanceLayouts;
+            AZStd::vector<InstanceIndex> m_freeInstanceIndices;
+            bool m_layoutChanged = false;
+            bool m_instancesChanged = false;
+
+            AZStd::vector<RPI::GpuDrivenCulling::LodData> m_lods;
+            AZStd::vector<RPI::GpuDrivenCulling::DrawData> m_draws;
+            AZStd::vector<RPI::GpuDrivenCulling::GroupData> m_groups;
+            RPI::GpuDrivenCulling::CullingOutput m_cullingOutput;
+            AZStd::vector<AZStd::pair<float, uint32_t>> m_sortedGroupInstances;
+
+            Data::Instance<RPI::Buffer> m_instanceBuffer;
+            Data::Instance<RPI::Buffer> m_lodBuffer;
+            Data::Instance<RPI::Buffer> m_drawBuffer;
+            Data::Instance<RPI::Buffer> m_groupBuffer;
+
+            //! The draw arguments of the batches culled this frame, in the order of the sequences of the indirect buffer.
+            AZStd::vector<RHI::DrawIndexed> m_indirectDraws;
+            RHI::Ptr<RHI::BufferPool> m_indirectBufferPool;
+            RHI::Ptr<RHI::Buffer> m_indirectBuffer;
+            RHI::Ptr<RHI::IndirectBufferSignature> m_indirectSignature;
+            RHI::Ptr<RHI::IndirectBufferWriter> m_indirectWriter;
+            RHI::IndirectBufferView m_indirectBufferView;
+            uint32_t m_indirectSequenceCount = 0;
+            uint32_t m_indirectStride = 0;
+        };
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshInstanceManager.h>
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        bool MeshInstanceGroupKey::operator==(const MeshInstanceGroupKey& rhs) const
+        {
+            return m_modelLod == rhs.m_modelLod
+                && m_meshIndex == rhs.m_meshIndex
+                && m_material == rhs.m_material
+                && m_shaderVariantHash == rhs.m_shaderVariantHash
+                && m_sortKey == rhs.m_sortKey
+                && m_stencilRef == rhs.m_stencilRef;
+        }
+
+        bool MeshInstanceGroupKey::operator!=(const MeshInstanceGroupKey& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        size_t MeshInstanceGroupKeyHash::operator()(const MeshInstanceGroupKey& key) const
+        {
+            size_t seed = 0;
+            AZStd::hash_combine(seed, key.m_modelLod);
+            AZStd::hash_combine(seed, key.m_meshIndex);
+            AZStd::hash_combine(seed, key.m_material);
+            AZStd::hash_combine(seed, key.m_shaderVariantHash);
+            AZStd::hash_combine(seed, key.m_sortKey);
+            AZStd::hash_combine(seed, key.m_stencilRef);
+            return seed;
+        }
+
+        MeshInstanceManager::GroupIndex MeshInstanceManager::AddInstance(const MeshInstanceGroupKey& key, const RPI::MeshDrawPacket& drawPacket)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            auto found = m_groupIndices.find(key);
+            if (found != m_groupIndices.end())
+            {
+                ++m_groups[found->second].m_instanceCount;
+                return found->second;
+            }
+
+            GroupIndex groupIndex;
+            if (!m_freeGroupIndices.empty())
+            {
+                groupIndex = m_freeGroupIndices.back();
+                m_freeGroupIndices.pop_back();
+            }
+            else
+            {
+                groupIndex = aznumeric_cast<GroupIndex>(m_groups.size());
+                m_groups.emplace_back();
+            }
+
+            Group& group = m_groups[groupIndex];
+            group.m_key = key;
+            group.m_drawPacket = drawPacket;
+            group.m_instanceCount = 1;
+            m_groupIndices.emplace(key, groupIndex);
+            return groupIndex;
+        }
+
+        void MeshInstanceManager::RemoveInstance(GroupIndex groupIndex)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            AZ_Assert(groupIndex < m_groups.size() && m_groups[groupIndex].m_instanceCount > 0, "Removing an instance from an invalid group.");
+            Group& group = m_groups[groupIndex];
+            if (--group.m_instanceCount == 0)
+            {
+                m_groupIndices.erase(group.m_key);
+                group = {};
+                m_freeGroupIndices.push_back(groupIndex);
+            }
+        }
+
+        void MeshInstanceManager::UpdateDrawPackets(const RPI::Scene& scene, bool forceUpdate)
+        {
+            for (Group& group : m_groups)
+            {
+                if (group.m_instanceCount > 0)
+                {
+                    group.m_drawPacket.Update(scene, forceUpdate);
+                }
+            }
+        }
+
+        const MeshInstanceManager::Group& MeshInstanceManager::GetGroup(GroupIndex groupIndex) const
+        {
+            return m_groups[groupIndex];
+        }
+
+        size_t MeshInstanceManager::GetGroupCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_groupIndices.size();
+        }
+
+        void MeshInstanceManager::BuildInstanceBatches(
+            AZStd::vector<VisibleInstance>& visibleInstances,
+            AZStd::vector<uint32_t>& instanceObjectIds,
+            AZStd::vector<InstanceBatch>& batches)
+        {
+            // Sorting by depth within a group keeps the instances in the order of the draw lists they're drawn into, front to back
+            // for opaque draw lists and back to front for transparent ones
+            AZStd::sort(visibleInstances.begin(), visibleInstances.end(),
+                [](const VisibleInstance& lhs, const VisibleInstance& rhs)
+                {
+                    if (lhs.m_groupIndex != rhs.m_groupIndex)
+                    {
+                        return lhs.m_groupIndex < rhs.m_groupIndex;
+                    }
+                    return lhs.m_backToFront ? lhs.m_depth > rhs.m_depth : lhs.m_depth < rhs.m_depth;
+                });
+
+            batches.clear();
+            instanceObjectIds.reserve(instanceObjectIds.size() + visibleInstances.size());
+
+            for (const VisibleInstance& visibleInstance : visibleInstances)
+            {
+                if (batches.empty() || batches.back().m_groupIndex != visibleInstance.m_groupIndex)
+                {
+                    InstanceBatch& batch = batches.emplace_back();
+                    batch.m_groupIndex = visibleInstance.m_groupIndex;
+                    batch.m_instanceOffset = aznumeric_cast<uint32_t>(instanceObjectIds.size());
+                    batch.m_depth = visibleInstance.m_depth;
+                }
+
+                ++batches.back().m_instanceCount;
+                instanceObjectIds.push_back(visibleInstance.m_objectId);
+            }
+        }
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Public/MeshDrawPacket.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Scene;
+    }
+
+    namespace Render
+    {
+        //! Meshes with equal keys are drawn with the same draw packet, so they can be drawn with a single instanced draw item.
+        struct MeshInstanceGroupKey
+        {
+            const RPI::ModelLod* m_modelLod = nullptr;
+            uint32_t m_meshIndex = 0;
+            const RPI::Material* m_material = nullptr;
+            //! Combined hash of the pipeline states of the draw items, as meshes can select different shader variants with their own shader options.
+            size_t m_shaderVariantHash = 0;
+            RHI::DrawItemSortKey m_sortKey = 0;
+            uint8_t m_stencilRef = 0;
+
+            bool operator==(const MeshInstanceGroupKey& rhs) const;
+            bool operator!=(const MeshInstanceGroupKey& rhs) const;
+        };
+
+        struct MeshInstanceGroupKeyHash
+        {
+            size_t operator()(const MeshInstanceGroupKey& key) const;
+        };
+
+        //! Groups the meshes of the MeshFeatureProcessor that can be drawn instanced, and builds the instanced draws after culling.
+        //! The meshes are added to the views as visible objects instead of draw packets. After culling, the visible instances
+        //! of every view are sorted by group, and every group is drawn with a copy of its draw packet with the instance count set
+        //! to the number of visible instances. The object ids of the instances are written to a per-frame buffer, and the offset
+        //! of the first instance of a draw is passed to the shaders in a root constant.
+        //! Only the object id is taken from each instance. All other data of the object SRG, e.g. the reflection probe, is
+        //! taken from the first mesh that was added to the group.
+        class MeshInstanceManager
+        {
+        public:
+            using GroupIndex = uint32_t;
+            static constexpr GroupIndex InvalidGroupIndex = AZStd::numeric_limits<GroupIndex>::max();
+
+            //! A mesh which is drawn instanced. The address of the instance is added to the views as visible object.
+            struct Instance
+            {
+                GroupIndex m_groupIndex = InvalidGroupIndex;
+                uint32_t m_objectId = 0;
+            };
+
+            struct Group
+            {
+                MeshInstanceGroupKey m_key;
+                //! Copy of the draw packet of the first mesh that was added, so it stays alive when that mesh is removed.
+                RPI::MeshDrawPacket m_drawPacket;
+                uint32_t m_instanceCount = 0;
+            };
+
+            struct VisibleInstance
+            {
+                GroupIndex m_groupIndex = InvalidGroupIndex;
+                uint32_t m_objectId = 0;
+                float m_depth = 0.0f;
+                //! Set for the groups drawn into a draw list that is sorted back to front, e.g. for transparency.
+                //! Must be the same for all the instances of a group.
+                bool m_backToFront = false;
+            };
+
+            //! A range of object ids drawn by a single instanced draw item.
+            struct InstanceBatch
+            {
+                GroupIndex m_groupIndex = InvalidGroupIndex;
+                uint32_t m_instanceOffset = 0;
+                uint32_t m_instanceCount = 0;
+                //! The depth of the first instance drawn, the nearest one or the farthest one for back to front groups.
+                float m_depth = 0.0f;
+            };
+
+            //! Adds a mesh to the group of the key and returns the index of the group. The group is created with a copy of
+            //! the draw packet if it doesn't exist yet. This function is thread safe.
+            GroupIndex AddInstance(const MeshInstanceGroupKey& key, const RPI::MeshDrawPacket& drawPacket);
+
+            //! Removes a mesh from its group, the group is released with its last mesh. This function is thread safe.
+            void RemoveInstance(GroupIndex groupIndex);
+
+            //! Updates the draw packets of all groups, e.g. after a material changed. Must not be called while instances are added or removed.
+            void UpdateDrawPackets(const RPI::Scene& scene, bool forceUpdate);
+
+            //! Must not be called while instances are added or removed.
+            const Group& GetGroup(GroupIndex groupIndex) const;
+
+            //! Returns the number of groups with at least one instance.
+            size_t GetGroupCount() const;
+
+            //! Sorts the visible instances of a view by group and replaces the batches with one batch per group. The instances of
+            //! a group are sorted front to back, or back to front for the groups that are drawn back to front. The object ids
+            //! of the instances are appended to instanceObjectIds in the order of the batches, and the batch offsets index into
+            //! that list, so the object ids of multiple views can be collected in the same list.
+            static void BuildInstanceBatches(
+                AZStd::vector<VisibleInstance>& visibleInstances,
+                AZStd::vector<uint32_t>& instanceObjectIds,
+                AZStd::vector<InstanceBatch>& batches);
+
+        private:
+            mutable AZStd::mutex m_mutex;
+            AZStd::vector<Group> m_groups;
+            AZStd::vector<GroupIndex> m_freeGroupIndices;
+            AZStd::unordered_map<MeshInstanceGroupKey, GroupIndex, MeshInstanceGroupKeyHash> m_groupIndices;
+        };
+    } // namespace Render
+} // namespace AZ
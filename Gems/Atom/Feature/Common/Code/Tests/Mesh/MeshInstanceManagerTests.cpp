@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Mesh/MeshInstanceManager.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    class MeshInstanceManagerTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    protected:
+        // The manager only compares the addresses, so the keys don't need actual model lods and materials
+        static MeshInstanceGroupKey CreateKey(uintptr_t modelLod, uint32_t meshIndex, uintptr_t material)
+        {
+            MeshInstanceGroupKey key;
+            key.m_modelLod = reinterpret_cast<const RPI::ModelLod*>(modelLod);
+            key.m_meshIndex = meshIndex;
+            key.m_material = reinterpret_cast<const RPI::Material*>(material);
+            return key;
+        }
+
+        RPI::MeshDrawPacket m_drawPacket;
+    };
+
+    TEST_F(MeshInstanceManagerTests, AddInstance_EqualKeys_ShareGroup)
+    {
+        MeshInstanceManager manager;
+
+        const MeshInstanceManager::GroupIndex first = manager.AddInstance(CreateKey(0x10, 0, 0x100), m_drawPacket);
+        const MeshInstanceManager::GroupIndex second = manager.AddInstance(CreateKey(0x10, 0, 0x100), m_drawPacket);
+        const MeshInstanceManager::GroupIndex otherMesh = manager.AddInstance(CreateKey(0x10, 1, 0x100), m_drawPacket);
+        const MeshInstanceManager::GroupIndex otherMaterial = manager.AddInstance(CreateKey(0x10, 0, 0x200), m_drawPacket);
+
+        EXPECT_EQ(first, second);
+        EXPECT_NE(first, otherMesh);
+        EXPECT_NE(first, otherMaterial);
+        EXPECT_NE(otherMesh, otherMaterial);
+        EXPECT_EQ(manager.GetGroupCount(), 3u);
+        EXPECT_EQ(manager.GetGroup(first).m_instanceCount, 2u);
+        EXPECT_EQ(manager.GetGroup(otherMesh).m_instanceCount, 1u);
+    }
+
+    TEST_F(MeshInstanceManagerTests, AddInstance_DifferentShaderVariant_SeparateGroups)
+    {
+        MeshInstanceManager manager;
+
+        MeshInstanceGroupKey key = CreateKey(0x10, 0, 0x100);
+        const MeshInstanceManager::GroupIndex first = manager.AddInstance(key, m_drawPacket);
+        key.m_shaderVariantHash = 1234;
+        const MeshInstanceManager::GroupIndex second = manager.AddInstance(key, m_drawPacket);
+
+        EXPECT_NE(first, second);
+        EXPECT_EQ(manager.GetGroupCount(), 2u);
+    }
+
+    TEST_F(MeshInstanceManagerTests, RemoveInstance_LastInstance_ReleasesGroup)
+    {
+        MeshInstanceManager manager;
+
+        const MeshInstanceManager::GroupIndex group = manager.AddInstance(CreateKey(0x10, 0, 0x100), m_drawPacket);
+        manager.AddInstance(CreateKey(0x10, 0, 0x100), m_drawPacket);
+
+        manager.RemoveInstance(group);
+        EXPECT_EQ(manager.GetGroupCount(), 1u);
+        EXPECT_EQ(manager.GetGroup(group).m_instanceCount, 1u);
+
+        manager.RemoveInstance(group);
+        EXPECT_EQ(manager.GetGroupCount(), 0u);
+
+        // the index of the released group is reused
+        const MeshInstanceManager::GroupIndex newGroup = manager.AddInstance(CreateKey(0x20, 0, 0x100), m_drawPacket);
+        EXPECT_EQ(newGroup, group);
+        EXPECT_EQ(manager.GetGroup(newGroup).m_key, CreateKey(0x20, 0, 0x100));
+    }
+
+    TEST_F(MeshInstanceManagerTests, BuildInstanceBatches_ManyInstances_OneBatchPerGroup)
+    {
+        // A synthetic scene of 100k visible instances of a handful of meshes results in one draw item per group
+        constexpr uint32_t InstanceCount = 100000;
+        constexpr uint32_t GroupCount = 5;
+
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::vector<MeshInstanceManager::VisibleInstance> visibleInstances;
+        AZStd::vector<float> nearestDepthPerGroup(GroupCount, AZStd::numeric_limits<float>::max());
+        AZStd::vector<uint32_t> instanceCountPerGroup(GroupCount, 0);
+        for (uint32_t objectId = 0; objectId < InstanceCount; ++objectId)
+        {
+            MeshInstanceManager::VisibleInstance& visibleInstance = visibleInstances.emplace_back();
+            visibleInstance.m_groupIndex = random.GetRandom() % GroupCount;
+            visibleInstance.m_objectId = objectId;
+            visibleInstance.m_depth = random.GetRandomFloat() * 1000.0f;
+
+            nearestDepthPerGroup[visibleInstance.m_groupIndex] = AZStd::min(nearestDepthPerGroup[visibleInstance.m_groupIndex], visibleInstance.m_depth);
+            ++instanceCountPerGroup[visibleInstance.m_groupIndex];
+        }
+
+        // the group of every object id, to validate the order of the object ids
+        AZStd::vector<MeshInstanceManager::GroupIndex> groupPerObjectId(InstanceCount);
+        for (const MeshInstanceManager::VisibleInstance& visibleInstance : visibleInstances)
+        {
+            groupPerObjectId[visibleInstance.m_objectId] = visibleInstance.m_groupIndex;
+        }
+
+        AZStd::vector<uint32_t> instanceObjectIds;
+        AZStd::vector<MeshInstanceManager::InstanceBatch> batches;
+        MeshInstanceManager::BuildInstanceBatches(visibleInstances, instanceObjectIds, batches);
+
+        ASSERT_EQ(batches.size(), GroupCount);
+        ASSERT_EQ(instanceObjectIds.size(), InstanceCount);
+
+        uint32_t expectedOffset = 0;
+        for (const MeshInstanceManager::InstanceBatch& batch : batches)
+        {
+            EXPECT_EQ(batch.m_instanceOffset, expectedOffset);
+            EXPECT_EQ(batch.m_instanceCount, instanceCountPerGroup[batch.m_groupIndex]);
+            EXPECT_EQ(batch.m_depth, nearestDepthPerGroup[batch.m_groupIndex]);
+
+            for (uint32_t i = batch.m_instanceOffset; i < batch.m_instanceOffset + batch.m_instanceCount; ++i)
+            {
+                EXPECT_EQ(groupPerObjectId[instanceObjectIds[i]], batch.m_groupIndex);
+            }
+            expectedOffset += batch.m_instanceCount;
+        }
+    }
+
+    TEST_F(MeshInstanceManagerTests, BuildInstanceBatches_BackToFrontGroup_SortsInstancesBackToFront)
+    {
+        // Group 0 is opaque and group 1 is transparent
+        AZStd::vector<MeshInstanceManager::VisibleInstance> visibleInstances = {
+            { 0, 0, 5.0f, false }, { 1, 1, 5.0f, true }, { 0, 2, 1.0f, false },
+            { 1, 3, 1.0f, true }, { 0, 4, 3.0f, false }, { 1, 5, 3.0f, true }
+        };
+
+        AZStd::vector<uint32_t> instanceObjectIds;
+        AZStd::vector<MeshInstanceManager::InstanceBatch> batches;
+        MeshInstanceManager::BuildInstanceBatches(visibleInstances, instanceObjectIds, batches);
+
+        ASSERT_EQ(batches.size(), 2u);
+        EXPECT_EQ(batches[0].m_depth, 1.0f);
+        EXPECT_EQ(batches[1].m_depth, 5.0f);
+        const AZStd::vector<uint32_t> expectedObjectIds = { 2, 4, 0, 1, 5, 3 };
+        EXPECT_EQ(instanceObjectIds, expectedObjectIds);
+    }
+
+    TEST_F(MeshInstanceManagerTests, BuildInstanceBatches_MultipleViews_AppendObjectIds)
+    {
+        AZStd::vector<MeshInstanceManager::VisibleInstance> firstView = { { 1, 10, 5.0f }, { 0, 11, 1.0f }, { 1, 12, 2.0f } };
+        AZStd::vector<MeshInstanceManager::VisibleInstance> secondView = { { 1, 12, 3.0f } };
+
+        AZStd::vector<uint32_t> instanceObjectIds;
+        AZStd::vector<MeshInstanceManager::InstanceBatch> batches;
+
+        MeshInstanceManager::BuildInstanceBatches(firstView, instanceObjectIds, batches);
+        ASSERT_EQ(batches.size(), 2u);
+        EXPECT_EQ(batches[0].m_groupIndex, 0u);
+        EXPECT_EQ(batches[0].m_instanceOffset, 0u);
+        EXPECT_EQ(batches[0].m_instanceCount, 1u);
+        EXPECT_EQ(batches[1].m_groupIndex, 1u);
+        EXPECT_EQ(batches[1].m_instanceOffset, 1u);
+        EXPECT_EQ(batches[1].m_instanceCount, 2u);
+
+        MeshInstanceManager::BuildInstanceBatches(secondView, instanceObjectIds, batches);
+        ASSERT_EQ(batches.size(), 1u);
+        EXPECT_EQ(batches[0].m_groupIndex, 1u);
+        EXPECT_EQ(batches[0].m_instanceOffset, 3u);
+        EXPECT_EQ(batches[0].m_instanceCount, 1u);
+
+        // instances of a group are sorted front to back
+        const AZStd::vector<uint32_t> expectedObjectIds = { 11, 12, 10, 12 };
+        EXPECT_EQ(instanceObjectIds, expectedObjectIds);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! Measures the CPU cost of instancing a synthetic scene of visible meshes that share a handful of models, in a single view.
+    //! The first argument is the number of visible meshes, the second one the number of distinct meshes they are instances of.
+    //! The DrawItems counter reports the draw items submitted with instancing, compared to one draw item per mesh without it.
+    class MeshInstanceManagerBenchmarks
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        void CreateVisibleInstances(const ::benchmark::State& state)
+        {
+            const uint32_t instanceCount = aznumeric_cast<uint32_t>(state.range(0));
+            const uint32_t groupCount = aznumeric_cast<uint32_t>(state.range(1));
+
+            AZ::SimpleLcgRandom random(1234);
+            m_visibleInstances.clear();
+            m_visibleInstances.reserve(instanceCount);
+            for (uint32_t objectId = 0; objectId < instanceCount; ++objectId)
+            {
+                MeshInstanceManager::VisibleInstance& visibleInstance = m_visibleInstances.emplace_back();
+                visibleInstance.m_groupIndex = random.GetRandom() % groupCount;
+                visibleInstance.m_objectId = objectId;
+                visibleInstance.m_depth = random.GetRandomFloat() * 1000.0f;
+            }
+        }
+
+        void ReportCounters(::benchmark::State& state, size_t drawItemCount)
+        {
+            state.counters["DrawItems"] = aznumeric_cast<double>(drawItemCount);
+            state.counters["DrawItemsWithoutInstancing"] = aznumeric_cast<double>(state.range(0));
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        RPI::MeshDrawPacket m_drawPacket;
+        AZStd::vector<MeshInstanceManager::VisibleInstance> m_visibleInstances;
+    };
+
+    //! Adding the meshes to their instance groups, which happens when the cullables are rebuilt.
+    BENCHMARK_DEFINE_F(MeshInstanceManagerBenchmarks, AddInstances)(::benchmark::State& state)
+    {
+        CreateVisibleInstances(state);
+
+        AZStd::vector<MeshInstanceGroupKey> keys;
+        keys.reserve(m_visibleInstances.size());
+        for (const MeshInstanceManager::VisibleInstance& visibleInstance : m_visibleInstances)
+        {
+            MeshInstanceGroupKey& key = keys.emplace_back();
+            key.m_modelLod = reinterpret_cast<const RPI::ModelLod*>(uintptr_t{ 0x10 } * (visibleInstance.m_groupIndex + 1));
+        }
+
+        size_t groupCount = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MeshInstanceManager manager;
+            for (const MeshInstanceGroupKey& key : keys)
+            {
+                manager.AddInstance(key, m_drawPacket);
+            }
+            groupCount = manager.GetGroupCount();
+            ::benchmark::DoNotOptimize(groupCount);
+        }
+
+        ReportCounters(state, groupCount);
+    }
+
+    //! Batching the visible instances of a view after culling, which happens every frame.
+    BENCHMARK_DEFINE_F(MeshInstanceManagerBenchmarks, BuildInstanceBatches)(::benchmark::State& state)
+    {
+        CreateVisibleInstances(state);
+
+        AZStd::vector<uint32_t> instanceObjectIds;
+        AZStd::vector<MeshInstanceManager::InstanceBatch> batches;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            instanceObjectIds.clear();
+            MeshInstanceManager::BuildInstanceBatches(m_visibleInstances, instanceObjectIds, batches);
+            ::benchmark::DoNotOptimize(batches.data());
+            ::benchmark::ClobberMemory();
+        }
+
+        ReportCounters(state, batches.size());
+    }
+
+    BENCHMARK_REGISTER_F(MeshInstanceManagerBenchmarks, AddInstances)
+        ->ArgNames({ "Meshes", "Groups" })
+        ->Args({ 10000, 5 })
+        ->Args({ 100000, 5 })
+        ->Args({ 100000, 500 })
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(MeshInstanceManagerBenchmarks, BuildInstanceBatches)
+        ->ArgNames({ "Meshes", "Groups" })
+        ->Args({ 10000, 5 })
+        ->Args({ 100000, 5 })
+        ->Args({ 100000, 500 })
+        ->Unit(::benchmark::kMicrosecond);
+#endif // HAVE_BENCHMARK
+} // namespace UnitTest
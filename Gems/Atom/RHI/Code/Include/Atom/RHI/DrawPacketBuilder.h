@@ -52,6 +52,11 @@ namespace AZ
 
             void Begin(IAllocator* allocator);
 
+            //! Begins building a copy of an existing draw packet. All state of the original is loaded into the builder,
+            //! so the setters can be used to change the copy before calling End(), e.g. to draw it instanced.
+            //! The original has to stay alive until End() is called.
+            void BeginClone(IAllocator* allocator, const DrawPacket* original);
+
             void SetDrawArguments(const DrawArguments& drawArguments);
 
             void SetIndexBufferView(const IndexBufferView& indexBufferView);
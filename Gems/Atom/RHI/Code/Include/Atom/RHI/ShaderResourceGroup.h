@@ -10,6 +10,8 @@
 #include <Atom/RHI/Resource.h>
 #include <Atom/RHI/ShaderResourceGroupData.h>
 
+#include <AzCore/std/parallel/atomic.h>
+
 namespace AZ
 {
     namespace RHI
@@ -86,8 +88,9 @@ namespace AZ
             // The binding slot cached from the layout.
             uint32_t m_bindingSlot = aznumeric_cast<uint32_t>(-1);
 
-            // Gates the Compile() function so that the SRG is only queued once.
-            bool m_isQueuedForCompile = false;
+            // Gates the Compile() function so that the SRG is only queued once. Atomic, since threads queue
+            // groups on different compile queue shards of the pool.
+            AZStd::atomic_bool m_isQueuedForCompile{ false };
             
             // Mask used to check whether to compile a specific resource type. This mask is managed on the RHI side.
             uint32_t m_rhiUpdateMask = 0;
@@ -13,6 +13,7 @@
 #include <Atom/RHI/ShaderResourceGroupInvalidateRegistry.h>
 #include <Atom/RHI/ResourcePool.h>
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
 
 namespace AZ
@@ -28,6 +29,10 @@ namespace AZ
             friend class ShaderResourceGroup;
         public:
             AZ_RTTI(ShaderResourceGroupPool, "{9AAB5A85-4063-4BAE-9A9C-E25640F18FFA}", ResourcePool);
+
+            //! The number of queues groups are queued for compile on. Each thread queues its groups on one
+            //! shard, so threads queueing groups of the same pool rarely contend for the same lock.
+            static constexpr uint32_t CompileQueueShardCount = 16;
             virtual ~ShaderResourceGroupPool() override;
 
             //! Initializes the shader resource group pool.
@@ -97,12 +102,18 @@ namespace AZ
             // Queues the shader resource group for compile. Legal to call on a queued group. Takes a lock.
             void QueueForCompile(ShaderResourceGroup& group);
 
-            // Queues the shader resource group for compile. Legal to call on a queued group. Does NOT take a lock.
-            void QueueForCompileNoLock(ShaderResourceGroup& group);
-
-            // Un-queues the shader resource group for compile. Legal to call on an un-queued group. Takes a lock.
+            // Un-queues the shader resource group for compile. Legal to call on an un-queued group. Takes the locks of all shards.
             void UnqueueForCompile(ShaderResourceGroup& shaderResourceGroup);
 
+            struct CompileQueueShard;
+
+            // Returns the compile queue shard of the calling thread.
+            CompileQueueShard& GetCompileQueueShard();
+
+            // Locks and unlocks the compile queues of all shards, in order.
+            void LockCompileQueues();
+            void UnlockCompileQueues();
+
             // Compiles an SRG synchronously. 
             void Compile(ShaderResourceGroup& group, const ShaderResourceGroupData& groupData);
 
@@ -150,7 +161,14 @@ namespace AZ
             bool m_hasSamplerGroup = false;
             bool m_isCompiling = false;
 
-            mutable AZStd::shared_mutex m_groupsToCompileMutex;
+            struct CompileQueueShard
+            {
+                AZStd::mutex m_mutex;
+                AZStd::vector<ShaderResourceGroup*> m_groups;
+            };
+            AZStd::array<CompileQueueShard, CompileQueueShardCount> m_compileQueueShards;
+
+            // The groups of all shards, gathered when the pool begins compiling.
             AZStd::vector<ShaderResourceGroup*> m_groupsToCompile;
 
             AZStd::mutex m_invalidateRegistryMutex;
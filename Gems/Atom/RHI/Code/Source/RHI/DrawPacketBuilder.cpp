@@ -23,6 +23,44 @@ namespace AZ
             m_allocator = allocator ? allocator : &AllocatorInstance<SystemAllocator>::Get();
         }
 
+        void DrawPacketBuilder::BeginClone(IAllocator* allocator, const DrawPacket* original)
+        {
+            Begin(allocator);
+
+            if (!original || original->m_drawItemCount == 0)
+            {
+                return;
+            }
+
+            // All draw items of a draw packet share the draw arguments, index buffer, root constants, scissors and viewports.
+            m_drawArguments = original->m_drawItems[0].m_arguments;
+            m_indexBufferView = original->m_indexBufferView;
+            m_drawFilterMask = original->m_drawFilterMask;
+            m_rootConstants = AZStd::span<const uint8_t>(original->m_rootConstants, original->m_rootConstantSize);
+            SetScissors(AZStd::span<const Scissor>(original->m_scissors, original->m_scissorsCount));
+            SetViewports(AZStd::span<const Viewport>(original->m_viewports, original->m_viewportsCount));
+
+            for (size_t i = 0; i < original->m_shaderResourceGroupCount; ++i)
+            {
+                m_shaderResourceGroups.push_back(original->m_shaderResourceGroups[i]);
+            }
+
+            for (size_t i = 0; i < original->m_drawItemCount; ++i)
+            {
+                const DrawItem& drawItem = original->m_drawItems[i];
+
+                DrawRequest drawRequest;
+                drawRequest.m_listTag = original->m_drawListTags[i];
+                drawRequest.m_stencilRef = drawItem.m_stencilRef;
+                drawRequest.m_streamBufferViews = AZStd::span<const StreamBufferView>(drawItem.m_streamBufferViews, drawItem.m_streamBufferViewCount);
+                drawRequest.m_uniqueShaderResourceGroup = drawItem.m_uniqueShaderResourceGroup;
+                drawRequest.m_pipelineState = drawItem.m_pipelineState;
+                drawRequest.m_sortKey = original->m_drawItemSortKeys[i];
+                drawRequest.m_drawFilterMask = original->m_drawFilterMask;
+                AddDrawItem(drawRequest);
+            }
+        }
+
         void DrawPacketBuilder::SetDrawArguments(const DrawArguments& drawArguments)
         {
             m_drawArguments = drawArguments;
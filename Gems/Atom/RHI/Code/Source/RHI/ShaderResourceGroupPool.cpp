@@ -109,11 +109,37 @@ namespace AZ
             shaderResourceGroup.SetData(ShaderResourceGroupData());
         }
 
+        ShaderResourceGroupPool::CompileQueueShard& ShaderResourceGroupPool::GetCompileQueueShard()
+        {
+            // Threads are assigned shards round robin the first time they queue a group on any pool.
+            static AZStd::atomic_uint32_t s_nextShardIndex{ 0 };
+            thread_local const uint32_t s_shardIndex = s_nextShardIndex.fetch_add(1) % CompileQueueShardCount;
+            return m_compileQueueShards[s_shardIndex];
+        }
+
+        void ShaderResourceGroupPool::LockCompileQueues()
+        {
+            for (CompileQueueShard& shard : m_compileQueueShards)
+            {
+                shard.m_mutex.lock();
+            }
+        }
+
+        void ShaderResourceGroupPool::UnlockCompileQueues()
+        {
+            for (CompileQueueShard& shard : m_compileQueueShards)
+            {
+                shard.m_mutex.unlock();
+            }
+        }
+
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
+            CompileQueueShard& shard = GetCompileQueueShard();
+            AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
 
-            bool isQueuedForCompile = shaderResourceGroup.IsQueuedForCompile();
+            // The group may be queued concurrently on another shard, the flag decides which thread queues it.
+            bool isQueuedForCompile = shaderResourceGroup.m_isQueuedForCompile.exchange(true);
             AZ_Warning(
                 "ShaderResourceGroupPool", !isQueuedForCompile,
                 "Attempting to compile an SRG that's already been queued for compile. Only compile an SRG once per frame.");
@@ -124,33 +150,37 @@ namespace AZ
 
                 shaderResourceGroup.SetData(groupData);
 
-                QueueForCompileNoLock(shaderResourceGroup);
+                shard.m_groups.emplace_back(&shaderResourceGroup);
             }
         }
 
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& group)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
-            QueueForCompileNoLock(group);
-        }
-
-        void ShaderResourceGroupPool::QueueForCompileNoLock(ShaderResourceGroup& group)
-        {
-            if (!group.m_isQueuedForCompile)
+            CompileQueueShard& shard = GetCompileQueueShard();
+            AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
+            if (!group.m_isQueuedForCompile.exchange(true))
             {
-                group.m_isQueuedForCompile = true;
-                m_groupsToCompile.emplace_back(&group);
+                shard.m_groups.emplace_back(&group);
             }
         }
 
         void ShaderResourceGroupPool::UnqueueForCompile(ShaderResourceGroup& shaderResourceGroup)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
-            if (shaderResourceGroup.m_isQueuedForCompile)
+            // The group may be on any shard, and must not be queued again while it's searched for.
+            LockCompileQueues();
+            if (shaderResourceGroup.m_isQueuedForCompile.exchange(false))
             {
-                shaderResourceGroup.m_isQueuedForCompile = false;
-                m_groupsToCompile.erase(AZStd::find(m_groupsToCompile.begin(), m_groupsToCompile.end(), &shaderResourceGroup));
+                for (CompileQueueShard& shard : m_compileQueueShards)
+                {
+                    auto groupIter = AZStd::find(shard.m_groups.begin(), shard.m_groups.end(), &shaderResourceGroup);
+                    if (groupIter != shard.m_groups.end())
+                    {
+                        shard.m_groups.erase(groupIter);
+                        break;
+                    }
+                }
             }
+            UnlockCompileQueues();
         }
 
         void ShaderResourceGroupPool::Compile(ShaderResourceGroup& group, const ShaderResourceGroupData& groupData)
@@ -232,8 +262,21 @@ namespace AZ
         void ShaderResourceGroupPool::CompileGroupsBegin()
         {
             AZ_Assert(m_isCompiling == false, "Already compiling! Deadlock imminent.");
-            m_groupsToCompileMutex.lock();
+            LockCompileQueues();
             m_isCompiling = true;
+
+            size_t groupsToCompileCount = 0;
+            for (const CompileQueueShard& shard : m_compileQueueShards)
+            {
+                groupsToCompileCount += shard.m_groups.size();
+            }
+
+            m_groupsToCompile.reserve(groupsToCompileCount);
+            for (CompileQueueShard& shard : m_compileQueueShards)
+            {
+                m_groupsToCompile.insert(m_groupsToCompile.end(), shard.m_groups.begin(), shard.m_groups.end());
+                shard.m_groups.clear();
+            }
         }
 
         void ShaderResourceGroupPool::CompileGroupsEnd()
@@ -241,7 +284,7 @@ namespace AZ
             AZ_Assert(m_isCompiling, "CompileGroupsBegin() was never called.");
             m_isCompiling = false;
             m_groupsToCompile.clear();
-            m_groupsToCompileMutex.unlock();
+            UnlockCompileQueues();
         }
 
         uint32_t ShaderResourceGroupPool::GetGroupsToCompileCount() const
@@ -341,6 +341,45 @@ namespace UnitTest
         EXPECT_EQ(drawPacket, nullptr);
     }
 
+    TEST_F(DrawPacketTest, DrawPacketClone_ChangedDrawArguments_KeepsAllOtherState)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+        DrawPacketData drawPacketData(random);
+
+        RHI::DrawPacketBuilder builder;
+        const RHI::DrawPacket* drawPacket = drawPacketData.Build(builder);
+
+        RHI::DrawIndexed drawIndexed;
+        drawIndexed.m_indexCount = 36;
+        drawIndexed.m_instanceCount = 64;
+
+        builder.BeginClone(nullptr, drawPacket);
+        builder.SetDrawArguments(drawIndexed);
+        const RHI::DrawPacket* clonedDrawPacket = builder.End();
+
+        ASSERT_NE(clonedDrawPacket, nullptr);
+        EXPECT_NE(clonedDrawPacket, drawPacket);
+        EXPECT_EQ(clonedDrawPacket->GetDrawListMask(), drawPacket->GetDrawListMask());
+        EXPECT_EQ(clonedDrawPacket->GetDrawFilterMask(), drawPacket->GetDrawFilterMask());
+        ASSERT_EQ(clonedDrawPacket->GetDrawItemCount(), drawPacket->GetDrawItemCount());
+
+        for (size_t i = 0; i < clonedDrawPacket->GetDrawItemCount(); ++i)
+        {
+            EXPECT_EQ(clonedDrawPacket->GetDrawListTag(i), drawPacket->GetDrawListTag(i));
+            drawPacketData.ValidateDrawItem(drawPacketData.m_drawItemDatas[i], clonedDrawPacket->GetDrawItem(i));
+
+            const RHI::DrawItem* drawItem = clonedDrawPacket->GetDrawItem(i).m_item;
+            EXPECT_EQ(drawItem->m_arguments.m_type, RHI::DrawType::Indexed);
+            EXPECT_EQ(drawItem->m_arguments.m_indexed.m_indexCount, 36u);
+            EXPECT_EQ(drawItem->m_arguments.m_indexed.m_instanceCount, 64u);
+        }
+
+        // the clone owns its own copy of the data
+        delete drawPacket;
+        EXPECT_EQ(clonedDrawPacket->GetDrawItem(0).m_item->m_arguments.m_indexed.m_instanceCount, 64u);
+        delete clonedDrawPacket;
+    }
+
     TEST_F(DrawPacketTest, DrawListContextFilter)
     {
         AZ::SimpleLcgRandom random(s_randomSeed);
@@ -10,6 +10,7 @@
 #include <Tests/ShaderResourceGroup.h>
 #include <Tests/Factory.h>
 #include <Tests/Device.h>
+#include <Tests/ThreadTester.h>
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI.Reflect/ReflectSystemComponent.h>
 #include <AzCore/Memory/SystemAllocator.h>
@@ -636,6 +637,64 @@ namespace UnitTest
         TestShaderResourceGroupPools();
     }
 
+    TEST_F(ShaderResourceGroupTests, CompileGroups_QueuedFromManyThreads_EachGroupIsCompiledOnce)
+    {
+        static const size_t GroupCount = 4096;
+        static const size_t ThreadCountMax = 8;
+
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        AZStd::vector<RHI::Ptr<RHI::ShaderResourceGroup>> srgs(GroupCount);
+        for (RHI::Ptr<RHI::ShaderResourceGroup>& srg : srgs)
+        {
+            srg = RHI::Factory::Get().CreateShaderResourceGroup();
+            srgPool->InitGroup(*srg);
+        }
+
+        ThreadTester::Dispatch(ThreadCountMax, [&](size_t threadIndex)
+        {
+            for (size_t i = threadIndex; i < GroupCount; i += ThreadCountMax)
+            {
+                srgs[i]->Compile(RHI::ShaderResourceGroupData(*srgs[i]));
+            }
+        });
+
+        for (const RHI::Ptr<RHI::ShaderResourceGroup>& srg : srgs)
+        {
+            EXPECT_TRUE(srg->IsQueuedForCompile());
+        }
+
+        srgPool->CompileGroupsBegin();
+        const uint32_t groupsToCompileCount = srgPool->GetGroupsToCompileCount();
+        EXPECT_EQ(groupsToCompileCount, GroupCount);
+        srgPool->CompileGroupsForInterval(RHI::Interval(0, groupsToCompileCount / 2));
+        srgPool->CompileGroupsForInterval(RHI::Interval(groupsToCompileCount / 2, groupsToCompileCount));
+        srgPool->CompileGroupsEnd();
+
+        for (const RHI::Ptr<RHI::ShaderResourceGroup>& srg : srgs)
+        {
+            EXPECT_FALSE(srg->IsQueuedForCompile());
+        }
+
+        // The queues are empty until groups are queued again.
+        srgPool->CompileGroupsBegin();
+        EXPECT_EQ(srgPool->GetGroupsToCompileCount(), 0);
+        srgPool->CompileGroupsEnd();
+
+        srgs[0]->Compile(RHI::ShaderResourceGroupData(*srgs[0]));
+        srgPool->CompileGroupsBegin();
+        EXPECT_EQ(srgPool->GetGroupsToCompileCount(), 1);
+        srgPool->CompileGroupsForInterval(RHI::Interval(0, 1));
+        srgPool->CompileGroupsEnd();
+    }
+
 
     TEST_F(ShaderResourceGroupTests, SRGDataSetConstant_Vectors_ValidOutput)
     {
@@ -763,4 +822,106 @@ namespace UnitTest
             EXPECT_NE(otherLayout->GetHash(), layout->GetHash());
         }
     }
+
+#if defined(HAVE_BENCHMARK)
+    // Queues 4096 groups of one pool from the range number of threads and compiles them, which is the per-frame pattern of
+    // feature processors updating per-object SRGs from job threads.
+    class ShaderResourceGroupBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        // The SRG test fixture is a gtest fixture, it is only reused here to bring up the test RHI.
+        class Environment
+            : public ShaderResourceGroupTests
+        {
+        public:
+            void TestBody() override {}
+        };
+
+        static const size_t GroupCount = 4096;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+
+        void internalSetUp([[maybe_unused]] const ::benchmark::State& state)
+        {
+            m_environment = AZStd::make_unique<Environment>();
+            m_environment->SetUp();
+
+            m_device = MakeTestDevice();
+            m_srgLayout = m_environment->CreateLayout();
+            m_srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+
+            RHI::ShaderResourceGroupPoolDescriptor descriptor;
+            descriptor.m_layout = m_srgLayout.get();
+            m_srgPool->Init(*m_device, descriptor);
+
+            m_srgs.resize(GroupCount);
+            for (RHI::Ptr<RHI::ShaderResourceGroup>& srg : m_srgs)
+            {
+                srg = RHI::Factory::Get().CreateShaderResourceGroup();
+                m_srgPool->InitGroup(*srg);
+            }
+        }
+
+        void internalTearDown([[maybe_unused]] const ::benchmark::State& state)
+        {
+            m_srgs = {};
+            m_srgPool = nullptr;
+            m_srgLayout = nullptr;
+            m_device = nullptr;
+
+            m_environment->TearDown();
+            m_environment.reset();
+        }
+
+        AZStd::unique_ptr<Environment> m_environment;
+        RHI::Ptr<RHI::Device> m_device;
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> m_srgLayout;
+        RHI::Ptr<RHI::ShaderResourceGroupPool> m_srgPool;
+        AZStd::vector<RHI::Ptr<RHI::ShaderResourceGroup>> m_srgs;
+    };
+
+    BENCHMARK_DEFINE_F(ShaderResourceGroupBenchmarkFixture, BM_CompileGroupsQueuedFromThreads)(benchmark::State& state)
+    {
+        const size_t threadCount = aznumeric_cast<size_t>(state.range(0));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ThreadTester::Dispatch(threadCount, [this, threadCount](size_t threadIndex)
+            {
+                for (size_t i = threadIndex; i < GroupCount; i += threadCount)
+                {
+                    m_srgs[i]->Compile(RHI::ShaderResourceGroupData(*m_srgs[i]));
+                }
+            });
+
+            m_srgPool->CompileGroupsBegin();
+            m_srgPool->CompileGroupsForInterval(RHI::Interval(0, m_srgPool->GetGroupsToCompileCount()));
+            m_srgPool->CompileGroupsEnd();
+        }
+
+        state.SetItemsProcessed(state.iterations() * GroupCount);
+    }
+
+    BENCHMARK_REGISTER_F(ShaderResourceGroupBenchmarkFixture, BM_CompileGroupsQueuedFromThreads)
+        ->Arg(1)
+        ->Arg(8)
+        ->Unit(benchmark::kMicrosecond);
+#endif
 }
@@ -22,6 +22,7 @@
 #include <AzCore/Math/Obb.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 
 #include <AzFramework/Visibility/IVisibilitySystem.h>
@@ -97,6 +98,9 @@ namespace AZ
                     float m_screenCoverageMin;
                     float m_screenCoverageMax;
                     AZStd::vector<const RHI::DrawPacket*> m_drawPackets;
+                    //! Objects which are added to the view with View::AddVisibleObject instead of adding draw packets, so the
+                    //! feature processor which owns them can build the draw packets after culling, see FeatureProcessor::OnEndCulling.
+                    AZStd::vector<const void*> m_visibleObjectUserData;
                 };
 
                 AZStd::vector<Lod> m_lods;
@@ -266,6 +270,20 @@ namespace AZ
             //! Can be called in parallel (i.e. to perform culling on multiple views at the same time).
             void ProcessCullablesTG(const Scene& scene, View& view, AZ::TaskGraph& taskGraph);
 
+            //! Splits the views of a frame into the batches of views which are culled together with ProcessCullablesBatched*(),
+            //! the shadow views when r_cullShadowViewsBatched is enabled, and the views which are culled on their own with ProcessCullables*().
+            void BatchViews(const AZStd::vector<ViewPtr>& views, AZStd::vector<AZStd::vector<View*>>& viewBatches, AZStd::vector<View*>& singleViews);
+
+            //! Performs render culling and lod selection for a set of views, then adds the visible renderpackets to each of them.
+            //! The visibility scene is traversed once for all the views, and each cullable is tested against the frusta of all of them in
+            //! one pass, instead of once per view. This pays off for views that see the same cullables, like the cascades and spot
+            //! shadows of the shadow casting lights. The draw packets are added to the views in per view runs of each visible node.
+            //! At most AzFramework::IVisibilityScene::MaxEnumerateFrusta views, with the same requirements as ProcessCullablesJobs().
+            void ProcessCullablesBatchedJobs(const Scene& scene, AZStd::span<View* const> views, AZ::Job& parentJob);
+
+            //! Same as ProcessCullablesBatchedJobs(), with the processing done in tasks added to the taskGraph.
+            void ProcessCullablesBatchedTG(const Scene& scene, AZStd::span<View* const> views, AZ::TaskGraph& taskGraph);
+
             //! Adds a Cullable to the underlying visibility system(s).
             //! Must be called at least once on initialization and whenever a Cullable's position or bounds is changed.
             //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
@@ -291,6 +309,8 @@ namespace AZ
             void BeginCullingTaskGraph(const AZStd::vector<ViewPtr>& views);
             void BeginCullingJobs(const AZStd::vector<ViewPtr>& views);
             void ProcessCullablesCommon(const Scene& scene, View& view, AZ::Frustum& frustum, void*& maskedOcclusionCulling);
+            template<typename DispatchFunction>
+            void ProcessCullablesBatchedCommon(const Scene& scene, AZStd::span<View* const> views, DispatchFunction&& dispatch);
 
             const Scene* m_parentScene = nullptr;
             AzFramework::IVisibilityScene* m_visScene = nullptr;
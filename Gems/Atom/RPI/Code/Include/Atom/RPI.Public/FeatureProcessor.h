@@ -114,6 +114,12 @@ namespace AZ
             //!  - This may be called in parallel with other feature processors.
             virtual void Render(const RenderPacket&) {}
 
+            //! The feature processor may add draw packets for the objects it added to the views with View::AddVisibleObject,
+            //! e.g. to draw all visible instances of a mesh with a single instanced draw item.
+            //!
+            //!  - This is called every frame, after culling finished and before the draw lists of the views are finalized.
+            virtual void OnEndCulling(const RenderPacket&) {}
+
             //! The feature processor may do clean up when the current render frame is finished
             //!  - This is called every RPI::RenderTick.
             virtual void OnRenderEnd() {}
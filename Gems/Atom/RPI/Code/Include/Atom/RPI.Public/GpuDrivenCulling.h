@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/DrawItem.h>
+#include <Atom/RPI.Public/Culling.h>
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Data layouts and CPU reference implementation of the culling pass of a GPU-driven mesh path.
+        //! Instances, their lods and the draws of the lods live in persistent structured buffers. Every draw belongs to a group of
+        //! meshes that share their geometry and draw packet, and every group is drawn with one indirect indexed draw. The culling
+        //! culls every instance against the view, selects its lods and adds the instance to the groups of the draws of those lods.
+        //! The reference implementation below is tested against CullingScene, and the MeshFeatureProcessor runs it when
+        //! r_meshGpuDrivenCulling is enabled until a culling pass writes the same output on the GPU.
+        namespace GpuDrivenCulling
+        {
+            //! Value of InstanceData::m_lodOverride when the lods are selected by screen coverage.
+            static constexpr uint32_t NoLodOverride = AZStd::numeric_limits<uint32_t>::max();
+
+            //! An element of the instance buffer. The members are grouped in float4s to match the structured buffer layout.
+            struct InstanceData
+            {
+                AZStd::array<float, 4> m_boundingSphere = {};           //!< World space center and radius.
+                AZStd::array<float, 4> m_obbPositionAndLodRadius = {};  //!< World space obb center and lod selection radius.
+                AZStd::array<float, 4> m_obbAxisXAndHalfLength = {};
+                AZStd::array<float, 4> m_obbAxisYAndHalfLength = {};
+                AZStd::array<float, 4> m_obbAxisZAndHalfLength = {};
+                AZStd::array<uint32_t, 2> m_drawListMask = {};          //!< Low and high 32 bits of the cullable draw list mask.
+                uint32_t m_hideFlags = 0;
+                uint32_t m_isHidden = 0;
+                uint32_t m_firstLod = 0;
+                uint32_t m_lodCount = 0;
+                uint32_t m_lodOverride = NoLodOverride;
+                uint32_t m_objectId = 0;                                //!< The transform service object id the shaders fetch the transform with.
+            };
+            static_assert(sizeof(InstanceData) % 16 == 0, "InstanceData must be a multiple of 16 bytes");
+
+            //! An element of the lod buffer.
+            struct LodData
+            {
+                float m_screenCoverageMin = 0.0f;
+                float m_screenCoverageMax = 1.0f;
+                uint32_t m_firstDraw = 0;
+                uint32_t m_drawCount = 0;
+            };
+
+            //! An element of the draw buffer, a mesh of a lod which is drawn with the draw of its group.
+            struct DrawData
+            {
+                uint32_t m_groupIndex = 0;
+            };
+
+            //! An element of the group buffer, the indexed draw shared by all the instances drawing the group.
+            struct GroupData
+            {
+                uint32_t m_indexCount = 0;
+                uint32_t m_indexOffset = 0;
+                uint32_t m_vertexOffset = 0;
+                //! Where the visible instances of the group start in CullingOutput::m_groupInstances, see AssignGroupInstanceRanges.
+                uint32_t m_firstInstance = 0;
+            };
+
+            //! The constants of the culling pass for one view.
+            struct ViewData
+            {
+                AZStd::array<AZStd::array<float, 4>, Frustum::PlaneId::MAX> m_frustumPlanes = {};
+                AZStd::array<float, 4> m_cameraPositionAndYScale = {};
+                AZStd::array<uint32_t, 2> m_drawListMask = {};
+                uint32_t m_usageFlags = 0;
+                uint32_t m_isPerspective = 0;
+            };
+
+            //! What the culling pass writes for one view.
+            struct CullingOutput
+            {
+                //! One indexed draw per group, with the number of visible instances drawing the group as instance count. The instance
+                //! offset is left at 0, the shaders add the first instance of the group to the instance id themselves, as not all
+                //! platforms pass the start instance location of indirect draws on.
+                AZStd::vector<RHI::DrawIndexed> m_drawArguments;
+                //! The indices of the visible instances drawing each group from the first instance of the group on, ascending on the CPU.
+                AZStd::vector<uint32_t> m_groupInstances;
+                //! The indices of the visible instances, in ascending order.
+                AZStd::vector<uint32_t> m_visibleInstances;
+            };
+
+            //! Returns the bounds, the filters and the lod override of the cullable, the lod range is left to the caller.
+            InstanceData CreateInstanceData(const Cullable& cullable);
+
+            ViewData CreateViewData(View& view);
+
+            //! Returns whether an instance passes the filters and the frustum test of the view.
+            bool IsInstanceVisible(const ViewData& view, const InstanceData& instance);
+
+            //! Sets the first instance of every group, so each group has room for all the instances with a lod drawing it.
+            //! Returns the number of instances all groups have room for.
+            uint32_t AssignGroupInstanceRanges(
+                AZStd::span<const InstanceData> instances,
+                AZStd::span<const LodData> lods,
+                AZStd::span<const DrawData> draws,
+                AZStd::span<GroupData> groups);
+
+            //! CPU reference of the culling pass, the output is cleared first.
+            void CullInstances(
+                const ViewData& view,
+                AZStd::span<const InstanceData> instances,
+                AZStd::span<const LodData> lods,
+                AZStd::span<const DrawData> draws,
+                AZStd::span<const GroupData> groups,
+                CullingOutput& output);
+        } // namespace GpuDrivenCulling
+    } // namespace RPI
+} // namespace AZ
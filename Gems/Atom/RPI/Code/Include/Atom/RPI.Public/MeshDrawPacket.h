@@ -11,6 +11,7 @@
 #include <Atom/RPI.Public/Shader/Shader.h>
 #include <Atom/RPI.Public/Material/Material.h>
 #include <Atom/RPI.Public/Model/ModelLod.h>
+#include <Atom/RHI/ConstantsData.h>
 #include <Atom/RHI/DrawPacket.h>
 #include <Atom/RHI/DrawPacketBuilder.h>
 
@@ -48,7 +49,20 @@ namespace AZ
             void SetSortKey(RHI::DrawItemSortKey sortKey) { m_sortKey = sortKey; };
             bool SetShaderOption(const Name& shaderOptionName, RPI::ShaderOptionValue value);
 
-            Data::Instance<Material> GetMaterial();
+            Data::Instance<Material> GetMaterial() const;
+
+            //! Name of the root constant which holds the offset of the first instance in the instance data buffer, see
+            //! ShaderLib/Atom/Features/InstancedTransforms.azsli. A mesh can only be drawn instanced if all its shaders declare it.
+            static constexpr const char* InstanceDataOffsetName = "s_meshInstanceDataOffset";
+            //! The instance data offset of draw packets which aren't drawn instanced, the shaders use the object id of the object SRG.
+            static constexpr uint32_t InvalidInstanceDataOffset = 0xFFFFFFFF;
+
+            //! Returns true if all shaders of the draw packet declare the instance data offset root constant.
+            bool SupportsInstancing() const { return m_instanceDataOffsetIndex.IsValid(); }
+
+            //! The root constants of the draw packet. Only used by draw packets which support instancing.
+            const RHI::ConstantsData& GetRootConstants() const { return m_rootConstants; }
+            RHI::ShaderInputConstantIndex GetInstanceDataOffsetIndex() const { return m_instanceDataOffsetIndex; }
 
         private:
             bool DoUpdate(const Scene& parentScene);
@@ -88,6 +102,10 @@ namespace AZ
             // Set the stencil value for this draw packet
             uint8_t m_stencilRef = 0;
 
+            // Root constants shared by all draw items, with the instance data offset set to InvalidInstanceDataOffset
+            RHI::ConstantsData m_rootConstants;
+            RHI::ShaderInputConstantIndex m_instanceDataOffsetIndex;
+
             //! A map matches the index of UV names of this material to the custom names from the model.
             MaterialModelUvOverrideMap m_materialModelUvMap;
 
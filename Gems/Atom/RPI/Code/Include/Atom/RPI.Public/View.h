@@ -10,6 +10,7 @@
 
 #include <Atom/RHI/ShaderResourceGroup.h>
 #include <Atom/RHI/DrawListContext.h>
+#include <Atom/RHI/ThreadLocalContext.h>
 
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Pass/Pass.h>
@@ -78,6 +79,22 @@ namespace AZ
             //! Add a draw item to this view with its associated draw list tag
             void AddDrawItem(RHI::DrawListTag drawListTag, const RHI::DrawItemProperties& drawItemProperties);
 
+            struct VisibleObjectProperties
+            {
+                const void* m_userData = nullptr;
+                float m_depth = 0.0f;
+            };
+
+            //! Add an object which passed culling to this view. The feature processor owning the object adds its draw packets
+            //! in FeatureProcessor::OnEndCulling. Visible objects need to be added every frame. This function is thread safe.
+            void AddVisibleObject(const void* userData, Vector3 worldPosition);
+
+            //! Merges the visible objects added by all threads. This function should only be called when culling finished.
+            void FinalizeVisibleObjectList();
+
+            //! The objects which passed culling in the current frame, only valid after FinalizeVisibleObjectList() was called.
+            const AZStd::vector<VisibleObjectProperties>& GetVisibleObjectList() const { return m_visibleObjects; }
+
             //! Sets the worldToView matrix and recalculates the other matrices.
             void SetWorldToViewMatrix(const AZ::Matrix4x4& worldToView);
 
@@ -124,6 +141,9 @@ namespace AZ
 
             void SetPassesByDrawList(PassesByDrawList* passes) { m_passesByDrawList = passes; }
 
+            //! Returns the sort type of the pass that draws the draw list with the tag in this view, KeyThenDepth if there's none.
+            RHI::DrawListSortType GetDrawListSortType(RHI::DrawListTag tag) const;
+
             //! Update View's SRG values and compile. This should only be called once per frame before execute command lists.
             void UpdateSrg();
 
@@ -180,6 +200,10 @@ namespace AZ
             RHI::DrawListContext m_drawListContext;
             RHI::DrawListMask m_drawListMask;
 
+            // The objects which passed culling, collected per thread and merged once culling finished.
+            RHI::ThreadLocalContext<AZStd::vector<VisibleObjectProperties>> m_threadVisibleObjects;
+            AZStd::vector<VisibleObjectProperties> m_visibleObjects;
+
             Matrix4x4 m_worldToViewMatrix;
             Matrix4x4 m_viewToWorldMatrix;
             Matrix4x4 m_viewToClipMatrix;
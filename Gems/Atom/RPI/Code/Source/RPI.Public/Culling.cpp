@@ -14,6 +14,7 @@
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/View.h>
 
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Casting/numeric_cast.h>
@@ -21,7 +22,9 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/Job.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <Atom_RPI_Traits_Platform.h>
 
@@ -42,6 +45,8 @@ namespace AZ
     {
         AZ_CVAR(bool, r_CullInParallel, true, nullptr, ConsoleFunctorFlags::Null, "");
         AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null, "");
+        AZ_CVAR(bool, r_cullShadowViewsBatched, true, nullptr, ConsoleFunctorFlags::Null,
+            "Cull all shadow views of a frame together, traversing the visibility scene once instead of once per view.");
 
 #ifdef AZ_CULL_DEBUG_ENABLED
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
@@ -584,7 +589,7 @@ namespace AZ
             {
                 // frustum cull occlusion planes
                 using VisibleOcclusionPlane = AZStd::pair<OcclusionPlane, float>;
-                AZStd::vector<VisibleOcclusionPlane> visibleOccluders;
+                AZStd::vector<VisibleOcclusionPlane, AZ::FrameArenaStdAllocator> visibleOccluders;
                 for (const auto& occlusionPlane : m_occlusionPlanes)
                 {
                     if (ShapeIntersection::Overlaps(frustum, occlusionPlane.m_aabb))
@@ -747,6 +752,234 @@ namespace AZ
         }
 
 
+        using BatchedViewData = AZStd::fixed_vector<AZStd::shared_ptr<WorklistData>, AzFramework::IVisibilityScene::MaxEnumerateFrusta>;
+
+        //! The visible nodes of a batch of views, with a copy of the per entry visibility masks of each node
+        struct BatchedWorklist
+        {
+            struct Node
+            {
+                Aabb m_bounds;
+                const AZStd::vector<AzFramework::VisibilityEntry*>* m_entries;
+                uint32_t m_firstVisibilityMask;
+                uint32_t m_viewMask; //!< the views that see any of the entries of the node
+            };
+
+            AZStd::fixed_vector<Node, WorkListCapacity> m_nodes;
+            AZStd::vector<uint32_t, AZ::FrameArenaStdAllocator> m_visibilityMasks; //!< released by the culling jobs of the frame
+        };
+
+        static void ProcessBatchedWorklist(const AZStd::shared_ptr<BatchedViewData>& viewData, const BatchedWorklist& worklist)
+        {
+            AZ_PROFILE_SCOPE(RPI, "AddObjectsToViewsJob: Process");
+
+            for (const BatchedWorklist::Node& node : worklist.m_nodes)
+            {
+                const uint32_t* visibilityMasks = worklist.m_visibilityMasks.data() + node.m_firstVisibilityMask;
+                const size_t entryCount = node.m_entries->size();
+
+                // go through the views one at a time, so the draw packets of each view are added in one run
+                for (uint32_t viewMask = node.m_viewMask; viewMask != 0; viewMask &= viewMask - 1)
+                {
+                    const uint32_t viewIndex = az_ctz_u32(viewMask);
+                    const uint32_t viewBit = 1u << viewIndex;
+                    const WorklistData& worklistData = *(*viewData)[viewIndex];
+
+                    const View::UsageFlags viewFlags = worklistData.m_view->GetUsageFlags();
+                    const RHI::DrawListMask drawListMask = worklistData.m_view->GetDrawListMask();
+                    const bool nodeIsContainedInFrustum = ShapeIntersection::Contains(worklistData.m_frustum, node.m_bounds);
+#ifdef AZ_CULL_DEBUG_ENABLED
+                    uint32_t numDrawPackets = 0;
+                    uint32_t numVisibleCullables = 0;
+#endif
+
+                    for (size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+                    {
+                        if ((visibilityMasks[entryIndex] & viewBit) == 0)
+                        {
+                            continue;
+                        }
+
+                        AzFramework::VisibilityEntry* visibleEntry = (*node.m_entries)[entryIndex];
+                        if ((visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable) == 0)
+                        {
+                            continue;
+                        }
+
+                        Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                        if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
+                            c->m_cullData.m_hideFlags & viewFlags ||
+                            c->m_cullData.m_scene != worklistData.m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
+                            c->m_isHidden)
+                        {
+                            continue;
+                        }
+
+                        // the visibility mask only tested the bounding box of the entry, do the same fine-grained culling as ProcessWorklist
+                        if (!nodeIsContainedInFrustum)
+                        {
+                            IntersectResult res = ShapeIntersection::Classify(worklistData.m_frustum, c->m_cullData.m_boundingSphere);
+                            if (res == IntersectResult::Exterior ||
+                                (res != IntersectResult::Interior && !ShapeIntersection::Overlaps(worklistData.m_frustum, c->m_cullData.m_boundingObb)))
+                            {
+                                continue;
+                            }
+                        }
+
+#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
+                        if (TestOcclusionCulling((*viewData)[viewIndex], visibleEntry) != MaskedOcclusionCulling::CullingResult::VISIBLE)
+                        {
+                            continue;
+                        }
+#endif
+
+                        [[maybe_unused]] const uint32_t drawPacketCount = AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData.m_view);
+#ifdef AZ_CULL_DEBUG_ENABLED
+                        ++numVisibleCullables;
+                        numDrawPackets += drawPacketCount;
+#endif
+
+                        c->m_isVisible = true;
+                    }
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+                    if (worklistData.m_debugCtx->m_enableStats)
+                    {
+                        CullingDebugContext::CullStats& cullStats = worklistData.m_debugCtx->GetCullStatsForView(worklistData.m_view);
+                        cullStats.m_numVisibleDrawPackets += numDrawPackets;
+                        cullStats.m_numVisibleCullables += numVisibleCullables;
+                    }
+#endif
+                }
+            }
+        }
+
+        void CullingScene::BatchViews(const AZStd::vector<ViewPtr>& views, AZStd::vector<AZStd::vector<View*>>& viewBatches, AZStd::vector<View*>& singleViews)
+        {
+            viewBatches.clear();
+            singleViews.clear();
+
+            AZStd::vector<View*> shadowViews;
+            for (const ViewPtr& viewPtr : views)
+            {
+                // the views selected for debug drawing keep going through ProcessWorklist, which draws the culling debug info
+                const bool isDebugDrawn = m_debugCtx.m_debugDraw && viewPtr->GetName() == m_debugCtx.m_currentViewSelectionName;
+                if (r_cullShadowViewsBatched && m_debugCtx.m_enableFrustumCulling && !isDebugDrawn &&
+                    (viewPtr->GetUsageFlags() & View::UsageShadow))
+                {
+                    shadowViews.push_back(viewPtr.get());
+                }
+                else
+                {
+                    singleViews.push_back(viewPtr.get());
+                }
+            }
+
+            if (shadowViews.size() == 1)
+            {
+                singleViews.push_back(shadowViews.front());
+                return;
+            }
+
+            for (size_t first = 0; first < shadowViews.size(); first += AzFramework::IVisibilityScene::MaxEnumerateFrusta)
+            {
+                const size_t last = AZStd::min(first + AzFramework::IVisibilityScene::MaxEnumerateFrusta, shadowViews.size());
+                viewBatches.emplace_back(shadowViews.begin() + first, shadowViews.begin() + last);
+            }
+        }
+
+        template<typename DispatchFunction>
+        void CullingScene::ProcessCullablesBatchedCommon(const Scene& scene, AZStd::span<View* const> views, DispatchFunction&& dispatch)
+        {
+            AZ_Assert(views.size() <= AzFramework::IVisibilityScene::MaxEnumerateFrusta, "Too many views in one culling batch");
+
+            AZStd::shared_ptr<BatchedViewData> viewData = AZStd::make_shared<BatchedViewData>();
+            AZStd::fixed_vector<Frustum, AzFramework::IVisibilityScene::MaxEnumerateFrusta> frusta;
+            for (View* view : views)
+            {
+                Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
+
+                void* maskedOcclusionCulling = nullptr;
+                ProcessCullablesCommon(scene, *view, frustum, maskedOcclusionCulling);
+
+                viewData->push_back(MakeWorklistData(m_debugCtx, scene, *view, frustum, maskedOcclusionCulling));
+                frusta.push_back(frustum);
+            }
+
+            AZStd::unique_ptr<BatchedWorklist> worklist = AZStd::make_unique<BatchedWorklist>();
+
+            m_visScene->EnumerateFrusta(frusta, [&viewData, &worklist, &dispatch](const AzFramework::IVisibilityScene::NodeVisibilityData& nodeData)
+            {
+                AZ_Assert(nodeData.m_entries.size() > 0, "should not get called with 0 entries");
+
+                uint32_t viewMask = 0;
+                for (uint32_t visibilityMask : nodeData.m_visibilityMasks)
+                {
+                    viewMask |= visibilityMask;
+                }
+
+                worklist->m_nodes.push_back(BatchedWorklist::Node{
+                    nodeData.m_bounds, &nodeData.m_entries, aznumeric_cast<uint32_t>(worklist->m_visibilityMasks.size()), viewMask });
+                worklist->m_visibilityMasks.insert(worklist->m_visibilityMasks.end(), nodeData.m_visibilityMasks.begin(), nodeData.m_visibilityMasks.end());
+
+                if (worklist->m_nodes.size() == worklist->m_nodes.capacity())
+                {
+                    dispatch(viewData, AZStd::move(worklist));
+                    worklist = AZStd::make_unique<BatchedWorklist>();
+                }
+            });
+
+            if (!worklist->m_nodes.empty())
+            {
+                dispatch(viewData, AZStd::move(worklist));
+            }
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            if (m_debugCtx.m_enableStats)
+            {
+                for (View* view : views)
+                {
+                    ++m_debugCtx.GetCullStatsForView(view).m_numJobs;
+                }
+            }
+#endif
+        }
+
+        void CullingScene::ProcessCullablesBatchedJobs(const Scene& scene, AZStd::span<View* const> views, AZ::Job& parentJob)
+        {
+            AZ_PROFILE_SCOPE(RPI, "CullingScene::ProcessCullablesBatchedJobs() - %zu views", views.size());
+
+            ProcessCullablesBatchedCommon(scene, views,
+                [&parentJob](const AZStd::shared_ptr<BatchedViewData>& viewData, AZStd::unique_ptr<BatchedWorklist> worklist)
+                {
+                    AZStd::shared_ptr<BatchedWorklist> sharedWorklist(worklist.release());
+                    auto processWorklist = [viewData, sharedWorklist]()
+                    {
+                        ProcessBatchedWorklist(viewData, *sharedWorklist);
+                    };
+                    AZ::Job* job = AZ::CreateJobFunction(processWorklist, true);
+                    parentJob.SetContinuation(job);
+                    job->Start();
+                });
+        }
+
+        void CullingScene::ProcessCullablesBatchedTG(const Scene& scene, AZStd::span<View* const> views, AZ::TaskGraph& taskGraph)
+        {
+            AZ_PROFILE_SCOPE(RPI, "CullingScene::ProcessCullablesBatchedTG() - %zu views", views.size());
+
+            static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessBatchedWorklist", "Graphics" };
+            ProcessCullablesBatchedCommon(scene, views,
+                [&taskGraph](const AZStd::shared_ptr<BatchedViewData>& viewData, AZStd::unique_ptr<BatchedWorklist> worklist)
+                {
+                    //Task takes ownership of the worklist unique ptr
+                    taskGraph.AddTask(descriptor, [viewData, worklist = AZStd::move(worklist)]()
+                    {
+                        ProcessBatchedWorklist(viewData, *worklist.get());
+                    });
+                });
+        }
+
+
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view)
         {
 #ifdef AZ_CULL_PROFILE_DETAILED
@@ -775,6 +1008,10 @@ namespace AZ
                 {
                     view.AddDrawPacket(drawPacket, pos);
                 }
+                for (const void* visibleObject : lod.m_visibleObjectUserData)
+                {
+                    view.AddVisibleObject(visibleObject, pos);
+                }
             };
 
             switch (lodData.m_lodConfiguration.m_lodType)
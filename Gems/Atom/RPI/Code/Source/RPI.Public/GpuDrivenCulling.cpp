@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/GpuDrivenCulling.h>
+#include <Atom/RPI.Public/Model/ModelLodUtils.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Debug/Profiler.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace GpuDrivenCulling
+        {
+            namespace
+            {
+                AZStd::array<uint32_t, 2> PackDrawListMask(const RHI::DrawListMask& drawListMask)
+                {
+                    static_assert(RHI::Limits::Pipeline::DrawListTagCountMax <= 64, "The draw list mask is packed in two uints");
+                    const uint64_t mask = drawListMask.to_ullong();
+                    return { static_cast<uint32_t>(mask), static_cast<uint32_t>(mask >> 32) };
+                }
+
+                AZStd::array<float, 4> PackVector(const Vector3& vector, float w)
+                {
+                    return { vector.GetX(), vector.GetY(), vector.GetZ(), w };
+                }
+
+                Vector3 UnpackVector(const AZStd::array<float, 4>& vector)
+                {
+                    return Vector3(vector[0], vector[1], vector[2]);
+                }
+
+                float PlaneDistance(const AZStd::array<float, 4>& plane, const Vector3& point)
+                {
+                    return UnpackVector(plane).Dot(point) + plane[3];
+                }
+
+                void AddInstanceToGroups(
+                    const LodData& lod, uint32_t instanceIndex, AZStd::span<const DrawData> draws, AZStd::span<const GroupData> groups,
+                    CullingOutput& output)
+                {
+                    for (uint32_t drawIndex = lod.m_firstDraw; drawIndex < lod.m_firstDraw + lod.m_drawCount; ++drawIndex)
+                    {
+                        // the culling pass increments the instance count atomically, which makes the order within a group arbitrary
+                        const uint32_t groupIndex = draws[drawIndex].m_groupIndex;
+                        const uint32_t outputIndex = groups[groupIndex].m_firstInstance + output.m_drawArguments[groupIndex].m_instanceCount++;
+                        if (outputIndex >= output.m_groupInstances.size())
+                        {
+                            output.m_groupInstances.resize(outputIndex + 1);
+                        }
+                        output.m_groupInstances[outputIndex] = instanceIndex;
+                    }
+                }
+            } // namespace
+
+            InstanceData CreateInstanceData(const Cullable& cullable)
+            {
+                const Sphere& sphere = cullable.m_cullData.m_boundingSphere;
+                const Obb& obb = cullable.m_cullData.m_boundingObb;
+
+                InstanceData instance;
+                instance.m_boundingSphere = PackVector(sphere.GetCenter(), sphere.GetRadius());
+                instance.m_obbPositionAndLodRadius = PackVector(obb.GetPosition(), cullable.m_lodData.m_lodSelectionRadius);
+                instance.m_obbAxisXAndHalfLength = PackVector(obb.GetAxisX(), obb.GetHalfLengthX());
+                instance.m_obbAxisYAndHalfLength = PackVector(obb.GetAxisY(), obb.GetHalfLengthY());
+                instance.m_obbAxisZAndHalfLength = PackVector(obb.GetAxisZ(), obb.GetHalfLengthZ());
+                instance.m_drawListMask = PackDrawListMask(cullable.m_cullData.m_drawListMask);
+                instance.m_hideFlags = cullable.m_cullData.m_hideFlags;
+                instance.m_isHidden = cullable.m_isHidden ? 1 : 0;
+                instance.m_lodOverride = cullable.m_lodData.m_lodConfiguration.m_lodType == Cullable::LodType::SpecificLod
+                    ? cullable.m_lodData.m_lodConfiguration.m_lodOverride
+                    : NoLodOverride;
+                return instance;
+            }
+
+            ViewData CreateViewData(View& view)
+            {
+                ViewData viewData;
+
+                const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view.GetWorldToClipMatrix());
+                for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const Vector4 plane = frustum.GetPlane(planeId).GetPlaneEquationCoefficients();
+                    viewData.m_frustumPlanes[planeId] = { plane.GetX(), plane.GetY(), plane.GetZ(), plane.GetW() };
+                }
+
+                const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
+                viewData.m_cameraPositionAndYScale = PackVector(view.GetViewToWorldMatrix().GetTranslation(), viewToClip.GetElement(1, 1));
+                viewData.m_isPerspective = viewToClip.GetElement(3, 3) == 0.0f ? 1 : 0;
+                viewData.m_drawListMask = PackDrawListMask(view.GetDrawListMask());
+                viewData.m_usageFlags = view.GetUsageFlags();
+                return viewData;
+            }
+
+            bool IsInstanceVisible(const ViewData& view, const InstanceData& instance)
+            {
+                if (((instance.m_drawListMask[0] & view.m_drawListMask[0]) | (instance.m_drawListMask[1] & view.m_drawListMask[1])) == 0 ||
+                    (instance.m_hideFlags & view.m_usageFlags) ||
+                    instance.m_isHidden)
+                {
+                    return false;
+                }
+
+                // the bounding sphere culls most instances, the obb is only tested when the sphere crosses a plane
+                const Vector3 sphereCenter = UnpackVector(instance.m_boundingSphere);
+                const float sphereRadius = instance.m_boundingSphere[3];
+                bool sphereIntersects = false;
+                for (const AZStd::array<float, 4>& plane : view.m_frustumPlanes)
+                {
+                    const float distance = PlaneDistance(plane, sphereCenter);
+                    if (distance < -sphereRadius)
+                    {
+                        return false;
+                    }
+                    sphereIntersects |= fabsf(distance) < sphereRadius;
+                }
+
+                if (!sphereIntersects)
+                {
+                    return true;
+                }
+
+                const Vector3 obbPosition = UnpackVector(instance.m_obbPositionAndLodRadius);
+                const Vector3 obbAxisX = UnpackVector(instance.m_obbAxisXAndHalfLength);
+                const Vector3 obbAxisY = UnpackVector(instance.m_obbAxisYAndHalfLength);
+                const Vector3 obbAxisZ = UnpackVector(instance.m_obbAxisZAndHalfLength);
+                for (const AZStd::array<float, 4>& plane : view.m_frustumPlanes)
+                {
+                    const Vector3 normal = UnpackVector(plane);
+                    const float projectedRadius = instance.m_obbAxisXAndHalfLength[3] * fabsf(normal.Dot(obbAxisX)) +
+                        instance.m_obbAxisYAndHalfLength[3] * fabsf(normal.Dot(obbAxisY)) +
+                        instance.m_obbAxisZAndHalfLength[3] * fabsf(normal.Dot(obbAxisZ));
+                    if (PlaneDistance(plane, obbPosition) < -projectedRadius)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            uint32_t AssignGroupInstanceRanges(
+                AZStd::span<const InstanceData> instances,
+                AZStd::span<const LodData> lods,
+                AZStd::span<const DrawData> draws,
+                AZStd::span<GroupData> groups)
+            {
+                // count the instances of every group first, then turn the counts into offsets
+                for (GroupData& group : groups)
+                {
+                    group.m_firstInstance = 0;
+                }
+                for (const InstanceData& instance : instances)
+                {
+                    for (uint32_t lodIndex = instance.m_firstLod; lodIndex < instance.m_firstLod + instance.m_lodCount; ++lodIndex)
+                    {
+                        const LodData& lod = lods[lodIndex];
+                        for (uint32_t drawIndex = lod.m_firstDraw; drawIndex < lod.m_firstDraw + lod.m_drawCount; ++drawIndex)
+                        {
+                            ++groups[draws[drawIndex].m_groupIndex].m_firstInstance;
+                        }
+                    }
+                }
+
+                uint32_t instanceCount = 0;
+                for (GroupData& group : groups)
+                {
+                    const uint32_t groupInstanceCount = group.m_firstInstance;
+                    group.m_firstInstance = instanceCount;
+                    instanceCount += groupInstanceCount;
+                }
+                return instanceCount;
+            }
+
+            void CullInstances(
+                const ViewData& view,
+                AZStd::span<const InstanceData> instances,
+                AZStd::span<const LodData> lods,
+                AZStd::span<const DrawData> draws,
+                AZStd::span<const GroupData> groups,
+                CullingOutput& output)
+            {
+                AZ_PROFILE_SCOPE(RPI, "GpuDrivenCulling: CullInstances");
+
+                output.m_drawArguments.clear();
+                output.m_groupInstances.clear();
+                output.m_visibleInstances.clear();
+
+                // the draws of all groups are written, the groups without visible instances are drawn with no instances
+                output.m_drawArguments.reserve(groups.size());
+                for (const GroupData& group : groups)
+                {
+                    output.m_drawArguments.emplace_back(0, 0, group.m_vertexOffset, group.m_indexCount, group.m_indexOffset);
+                }
+
+                const Vector3 cameraPosition = UnpackVector(view.m_cameraPositionAndYScale);
+                const float yScale = view.m_cameraPositionAndYScale[3];
+
+                // each iteration is one thread of the culling pass
+                for (uint32_t instanceIndex = 0; instanceIndex < instances.size(); ++instanceIndex)
+                {
+                    const InstanceData& instance = instances[instanceIndex];
+                    if (!IsInstanceVisible(view, instance))
+                    {
+                        continue;
+                    }
+
+                    output.m_visibleInstances.push_back(instanceIndex);
+
+                    if (instance.m_lodOverride != NoLodOverride)
+                    {
+                        if (instance.m_lodOverride < instance.m_lodCount)
+                        {
+                            AddInstanceToGroups(lods[instance.m_firstLod + instance.m_lodOverride], instanceIndex, draws, groups, output);
+                        }
+                        continue;
+                    }
+
+                    const float screenPercentage = ModelLodUtils::ApproxScreenPercentage(
+                        UnpackVector(instance.m_boundingSphere), instance.m_obbPositionAndLodRadius[3], cameraPosition, yScale,
+                        view.m_isPerspective != 0);
+
+                    // lod ranges may overlap for cross-fading, like on the CPU path
+                    for (uint32_t lodIndex = instance.m_firstLod; lodIndex < instance.m_firstLod + instance.m_lodCount; ++lodIndex)
+                    {
+                        const LodData& lod = lods[lodIndex];
+                        if (screenPercentage >= lod.m_screenCoverageMin && screenPercentage <= lod.m_screenCoverageMax)
+                        {
+                            AddInstanceToGroups(lod, instanceIndex, draws, groups, output);
+                        }
+                    }
+                }
+            }
+        } // namespace GpuDrivenCulling
+    } // namespace RPI
+} // namespace AZ
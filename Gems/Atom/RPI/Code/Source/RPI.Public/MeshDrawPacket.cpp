@@ -48,7 +48,7 @@ namespace AZ
             }
         }
 
-        Data::Instance<Material> MeshDrawPacket::GetMaterial()
+        Data::Instance<Material> MeshDrawPacket::GetMaterial() const
         {
             return m_material;
         }
@@ -152,6 +152,12 @@ namespace AZ
 
             m_perDrawSrgs.clear();
 
+            // All draw items share the root constants, so the instance data offset has to be at the same place for all shaders.
+            const Name instanceDataOffsetName{ InstanceDataOffsetName };
+            const RHI::ConstantsLayout* rootConstantsLayout = nullptr;
+            RHI::ShaderInputConstantIndex instanceDataOffsetIndex;
+            bool supportsInstancing = true;
+
             auto appendShader = [&](const ShaderCollection::Item& shaderItem)
             {
                 // Skip the shader item without creating the shader instance
@@ -227,6 +233,31 @@ namespace AZ
                 RHI::PipelineStateDescriptorForDraw pipelineStateDescriptor;
                 variant.ConfigurePipelineState(pipelineStateDescriptor);
 
+                if (supportsInstancing)
+                {
+                    const RHI::ConstantsLayout* shaderRootConstantsLayout = pipelineStateDescriptor.m_pipelineLayoutDescriptor
+                        ? pipelineStateDescriptor.m_pipelineLayoutDescriptor->GetRootConstantsLayout()
+                        : nullptr;
+                    const RHI::ShaderInputConstantIndex shaderInstanceDataOffsetIndex = shaderRootConstantsLayout
+                        ? shaderRootConstantsLayout->FindShaderInputIndex(instanceDataOffsetName)
+                        : RHI::ShaderInputConstantIndex{};
+
+                    if (!shaderInstanceDataOffsetIndex.IsValid())
+                    {
+                        supportsInstancing = false;
+                    }
+                    else if (!rootConstantsLayout)
+                    {
+                        rootConstantsLayout = shaderRootConstantsLayout;
+                        instanceDataOffsetIndex = shaderInstanceDataOffsetIndex;
+                    }
+                    else if (rootConstantsLayout->GetDataSize() != shaderRootConstantsLayout->GetDataSize() ||
+                        rootConstantsLayout->GetInterval(instanceDataOffsetIndex) != shaderRootConstantsLayout->GetInterval(shaderInstanceDataOffsetIndex))
+                    {
+                        supportsInstancing = false;
+                    }
+                }
+
                 // Render states need to merge the runtime variation.
                 // This allows materials to customize the render states that the shader uses.
                 const RHI::RenderStates& renderStatesOverlay = *shaderItem.GetRenderStatesOverlay();
@@ -329,10 +360,24 @@ namespace AZ
                 }
             }
 
+            RHI::ConstantsData rootConstants;
+            if (supportsInstancing && rootConstantsLayout)
+            {
+                rootConstants = RHI::ConstantsData(rootConstantsLayout);
+                rootConstants.SetConstant(instanceDataOffsetIndex, InvalidInstanceDataOffset);
+                drawPacketBuilder.SetRootConstants(rootConstants.GetConstantData());
+            }
+            else
+            {
+                instanceDataOffsetIndex.Reset();
+            }
+
             m_drawPacket = drawPacketBuilder.End();
 
             if (m_drawPacket)
             {
+                m_rootConstants = AZStd::move(rootConstants);
+                m_instanceDataOffsetIndex = instanceDataOffsetIndex;
                 m_activeShaders = shaderList;
                 m_materialSrg = m_material->GetRHIShaderResourceGroup();
                 return true;
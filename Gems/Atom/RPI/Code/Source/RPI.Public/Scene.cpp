@@ -555,17 +555,33 @@ namespace AZ
             // Launch CullingSystem::ProcessCullables() jobs (will run concurrently with FeatureProcessor::Render() jobs if m_parallelOctreeTraversal)
             const bool parallelOctreeTraversal = m_cullingScene->GetDebugContext().m_parallelOctreeTraversal;
             m_cullingScene->BeginCulling(m_renderPacket.m_views);
+            AZStd::vector<AZStd::vector<View*>> viewBatches;
+            AZStd::vector<View*> singleViews;
+            m_cullingScene->BatchViews(m_renderPacket.m_views, viewBatches, singleViews);
             static const AZ::TaskDescriptor processCullablesDescriptor{"AZ::RPI::Scene::ProcessCullables", "Graphics"};
             AZ::TaskGraphEvent processCullablesTGEvent;
             AZ::TaskGraph processCullablesTG;
             if (parallelOctreeTraversal)
             {
-                for (ViewPtr& viewPtr : m_renderPacket.m_views)
+                for (View* view : singleViews)
                 {
-                    processCullablesTG.AddTask(processCullablesDescriptor, [this, &viewPtr, &processCullablesTGEvent]()
+                    processCullablesTG.AddTask(processCullablesDescriptor, [this, view, &processCullablesTGEvent]()
                         {
                             AZ::TaskGraph subTaskGraph;
-                            m_cullingScene->ProcessCullablesTG(*this, *viewPtr, subTaskGraph);
+                            m_cullingScene->ProcessCullablesTG(*this, *view, subTaskGraph);
+                            if (!subTaskGraph.IsEmpty())
+                            {
+                                subTaskGraph.Detach();
+                                subTaskGraph.Submit(&processCullablesTGEvent);
+                            }
+                        });
+                }
+                for (const AZStd::vector<View*>& viewBatch : viewBatches)
+                {
+                    processCullablesTG.AddTask(processCullablesDescriptor, [this, &viewBatch, &processCullablesTGEvent]()
+                        {
+                            AZ::TaskGraph subTaskGraph;
+                            m_cullingScene->ProcessCullablesBatchedTG(*this, viewBatch, subTaskGraph);
                             if (!subTaskGraph.IsEmpty())
                             {
                                 subTaskGraph.Detach();
@@ -576,9 +592,13 @@ namespace AZ
             }
             else
             {
-                for (ViewPtr& viewPtr : m_renderPacket.m_views)
+                for (View* view : singleViews)
+                {
+                    m_cullingScene->ProcessCullablesTG(*this, *view, processCullablesTG);
+                }
+                for (const AZStd::vector<View*>& viewBatch : viewBatches)
                 {
-                    m_cullingScene->ProcessCullablesTG(*this, *viewPtr, processCullablesTG);
+                    m_cullingScene->ProcessCullablesBatchedTG(*this, viewBatch, processCullablesTG);
                 }
             }
             bool processCullablesHasWork = !processCullablesTG.IsEmpty();
@@ -615,13 +635,11 @@ namespace AZ
             // Launch CullingSystem::ProcessCullables() jobs (will run concurrently with FeatureProcessor::Render() jobs)
             const bool parallelOctreeTraversal = m_cullingScene->GetDebugContext().m_parallelOctreeTraversal;
             m_cullingScene->BeginCulling(m_renderPacket.m_views);
-            for (ViewPtr& viewPtr : m_renderPacket.m_views)
+            AZStd::vector<AZStd::vector<View*>> viewBatches;
+            AZStd::vector<View*> singleViews;
+            m_cullingScene->BatchViews(m_renderPacket.m_views, viewBatches, singleViews);
+            auto startProcessCullablesJob = [parallelOctreeTraversal, collectDrawPacketsCompletion](AZ::Job* processCullablesJob)
             {
-                AZ::Job* processCullablesJob = AZ::CreateJobFunction([this, &viewPtr](AZ::Job& thisJob)
-                    {
-                        m_cullingScene->ProcessCullablesJobs(*this, *viewPtr, thisJob); // can't call directly because ProcessCullables needs a parent job
-                    },
-                    true, nullptr); //auto-deletes
                 if (parallelOctreeTraversal)
                 {
                     processCullablesJob->SetDependent(collectDrawPacketsCompletion);
@@ -631,6 +649,22 @@ namespace AZ
                 {
                     processCullablesJob->StartAndWaitForCompletion();
                 }
+            };
+            for (View* view : singleViews)
+            {
+                startProcessCullablesJob(AZ::CreateJobFunction([this, view](AZ::Job& thisJob)
+                    {
+                        m_cullingScene->ProcessCullablesJobs(*this, *view, thisJob); // can't call directly because ProcessCullables needs a parent job
+                    },
+                    true, nullptr)); //auto-deletes
+            }
+            for (const AZStd::vector<View*>& viewBatch : viewBatches)
+            {
+                startProcessCullablesJob(AZ::CreateJobFunction([this, &viewBatch](AZ::Job& thisJob)
+                    {
+                        m_cullingScene->ProcessCullablesBatchedJobs(*this, viewBatch, thisJob);
+                    },
+                    true, nullptr)); //auto-deletes
             }
 
             WaitAndCleanCompletionJob(collectDrawPacketsCompletion);
@@ -767,6 +801,19 @@ namespace AZ
 
                 m_cullingScene->EndCulling();
 
+                {
+                    AZ_PROFILE_SCOPE(RPI, "FeatureProcessor: OnEndCulling");
+                    for (auto& view : m_renderPacket.m_views)
+                    {
+                        view->FinalizeVisibleObjectList();
+                    }
+
+                    for (auto& fp : m_featureProcessors)
+                    {
+                        fp->OnEndCulling(m_renderPacket);
+                    }
+                }
+
                 // Add dynamic draw data for all the views
                 if (m_dynamicDrawSystem)
                 {
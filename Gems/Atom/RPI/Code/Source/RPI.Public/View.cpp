@@ -117,6 +117,24 @@ namespace AZ
             m_drawListContext.AddDrawItem(drawListTag, drawItemProperties);
         }
 
+        void View::AddVisibleObject(const void* userData, Vector3 worldPosition)
+        {
+            Vector3 cameraToObject = worldPosition - m_position;
+            float depth = cameraToObject.Dot(-m_viewToWorldMatrix.GetBasisZAsVector3());
+            m_threadVisibleObjects.GetStorage().push_back(VisibleObjectProperties{ userData, depth });
+        }
+
+        void View::FinalizeVisibleObjectList()
+        {
+            AZ_PROFILE_SCOPE(RPI, "View: FinalizeVisibleObjectList");
+            m_visibleObjects.clear();
+            m_threadVisibleObjects.ForEach([this](AZStd::vector<VisibleObjectProperties>& visibleObjects)
+            {
+                m_visibleObjects.insert(m_visibleObjects.end(), visibleObjects.begin(), visibleObjects.end());
+                visibleObjects.clear();
+            });
+        }
+
         void View::SetWorldToViewMatrix(const AZ::Matrix4x4& worldToView)
         {
             m_viewToWorldMatrix = worldToView.GetInverseFast();
@@ -335,6 +353,18 @@ namespace AZ
             passWithDrawListTag->SortDrawList(drawList);
         }
 
+        RHI::DrawListSortType View::GetDrawListSortType(RHI::DrawListTag tag) const
+        {
+            if (m_passesByDrawList)
+            {
+                if (auto passIter = m_passesByDrawList->find(tag); passIter != m_passesByDrawList->end() && passIter->second)
+                {
+                    return passIter->second->GetDrawListSortType();
+                }
+            }
+            return RHI::DrawListSortType::KeyThenDepth;
+        }
+
         void View::ConnectWorldToViewMatrixChangedHandler(MatrixChangedEvent::Handler& handler)
         {
             handler.Connect(m_onWorldToViewMatrixChange);
@@ -0,0 +1,460 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/GpuDrivenCulling.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/std/sort.h>
+
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+
+#include <AzTest/AzTest.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    class CullingTests
+        : public RPITestFixture
+    {
+    protected:
+        static constexpr int GridSize = 100;
+        static constexpr float GridSpacing = 2.0f;
+        static constexpr float GridDepth = -50.0f;
+
+        void SetUp() override
+        {
+            RPITestFixture::SetUp();
+
+            m_octreeSystemComponent = new AzFramework::OctreeSystemComponent;
+            m_scene = Scene::CreateScene(SceneDescriptor{});
+            m_cullingScene = m_scene->GetCullingScene();
+
+            m_drawListMask.set(0);
+        }
+
+        void TearDown() override
+        {
+            for (Cullable& cullable : m_cullables)
+            {
+                m_cullingScene->UnregisterCullable(cullable);
+            }
+            m_cullables.clear();
+            m_views.clear();
+            m_scene = nullptr;
+
+            delete m_octreeSystemComponent;
+
+            RPITestFixture::TearDown();
+        }
+
+        // a grid of unit boxes in a plane facing the views
+        void CreateCullables(int gridWidth = GridSize, int gridHeight = GridSize)
+        {
+            m_cullables.resize(gridWidth * gridHeight);
+            for (int y = 0; y < gridHeight; ++y)
+            {
+                for (int x = 0; x < gridWidth; ++x)
+                {
+                    Cullable& cullable = m_cullables[y * gridWidth + x];
+                    const Vector3 center((x - gridWidth / 2) * GridSpacing, (y - gridHeight / 2) * GridSpacing, GridDepth);
+                    const Aabb bounds = Aabb::CreateCenterHalfExtents(center, Vector3(0.5f));
+
+                    cullable.m_cullData.m_boundingSphere = Sphere(center, bounds.GetExtents().GetLength() * 0.5f);
+                    cullable.m_cullData.m_boundingObb = Obb::CreateFromAabb(bounds);
+                    cullable.m_cullData.m_drawListMask = m_drawListMask;
+                    cullable.m_cullData.m_scene = m_scene.get();
+                    cullable.m_cullData.m_visibilityEntry.m_boundingVolume = bounds;
+                    cullable.m_cullData.m_visibilityEntry.m_userData = &cullable;
+                    cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
+
+                    // the cullables are added as visible objects, so no draw packets are needed
+                    cullable.m_lodData.m_lodConfiguration.m_lodType = Cullable::LodType::SpecificLod;
+                    cullable.m_lodData.m_lods.resize(1);
+                    cullable.m_lodData.m_lods[0].m_visibleObjectUserData.push_back(&cullable);
+
+                    m_cullingScene->RegisterOrUpdateCullable(cullable);
+                }
+            }
+        }
+
+        ViewPtr CreateView(const char* name, View::UsageFlags usage, const Vector3& position, const Matrix4x4& viewToClip)
+        {
+            ViewPtr view = View::CreateView(Name(name), usage);
+            view->SetDrawListMask(m_drawListMask);
+            view->SetWorldToViewMatrix(Matrix4x4::CreateTranslation(-position));
+            view->SetViewToClipMatrix(viewToClip);
+            m_views.push_back(view);
+            return view;
+        }
+
+        // the cascades of a directional light looking down the grid, and the spot shadows of lights in front of it
+        void CreateShadowViews(int spotShadowCount)
+        {
+            for (int cascade = 0; cascade < 4; ++cascade)
+            {
+                const float halfSize = 12.5f * static_cast<float>(1 << cascade);
+                Matrix4x4 viewToClip;
+                MakeOrthographicMatrixRH(viewToClip, -halfSize, halfSize, -halfSize, halfSize, 0.1f, 100.0f);
+                CreateView("Cascade", View::UsageShadow, Vector3::CreateZero(), viewToClip);
+            }
+
+            Matrix4x4 spotViewToClip;
+            MakePerspectiveFovMatrixRH(spotViewToClip, Constants::QuarterPi, 1.0f, 0.1f, 100.0f);
+            for (int spot = 0; spot < spotShadowCount; ++spot)
+            {
+                const Vector3 position(-90.0f + 6.0f * static_cast<float>(spot), 30.0f * static_cast<float>(spot % 3 - 1), -10.0f * static_cast<float>(spot % 4));
+                CreateView("SpotShadow", View::UsageShadow, position, spotViewToClip);
+            }
+        }
+
+        template<typename ProcessFunction>
+        void ProcessCullables(ProcessFunction&& process)
+        {
+            AZ::JobCompletion completion;
+            AZ::Job* job = AZ::CreateJobFunction(AZStd::forward<ProcessFunction>(process), true, nullptr);
+            job->SetDependent(&completion);
+            job->Start();
+            completion.StartAndWaitForCompletion();
+        }
+
+        AZStd::vector<AZStd::vector<const void*>> GetVisibleObjects()
+        {
+            AZStd::vector<AZStd::vector<const void*>> visibleObjects;
+            for (ViewPtr& view : m_views)
+            {
+                view->FinalizeVisibleObjectList();
+
+                AZStd::vector<const void*>& viewObjects = visibleObjects.emplace_back();
+                for (const View::VisibleObjectProperties& visibleObject : view->GetVisibleObjectList())
+                {
+                    viewObjects.push_back(visibleObject.m_userData);
+                }
+                AZStd::sort(viewObjects.begin(), viewObjects.end());
+            }
+            return visibleObjects;
+        }
+
+        void ProcessEachView()
+        {
+            m_cullingScene->BeginCulling(m_views);
+            for (ViewPtr& view : m_views)
+            {
+                ProcessCullables([this, &view](AZ::Job& thisJob)
+                {
+                    m_cullingScene->ProcessCullablesJobs(*m_scene, *view, thisJob);
+                });
+            }
+            m_cullingScene->EndCulling();
+        }
+
+        void ProcessBatched()
+        {
+            AZStd::vector<AZStd::vector<View*>> viewBatches;
+            AZStd::vector<View*> singleViews;
+
+            m_cullingScene->BeginCulling(m_views);
+            m_cullingScene->BatchViews(m_views, viewBatches, singleViews);
+            EXPECT_TRUE(singleViews.empty());
+            for (const AZStd::vector<View*>& viewBatch : viewBatches)
+            {
+                ProcessCullables([this, &viewBatch](AZ::Job& thisJob)
+                {
+                    m_cullingScene->ProcessCullablesBatchedJobs(*m_scene, viewBatch, thisJob);
+                });
+            }
+            m_cullingScene->EndCulling();
+        }
+
+        AZStd::vector<AZStd::vector<const void*>> CullEachView()
+        {
+            ProcessEachView();
+            return GetVisibleObjects();
+        }
+
+        AZStd::vector<AZStd::vector<const void*>> CullBatched()
+        {
+            ProcessBatched();
+            return GetVisibleObjects();
+        }
+
+        AzFramework::OctreeSystemComponent* m_octreeSystemComponent = nullptr;
+        ScenePtr m_scene;
+        CullingScene* m_cullingScene = nullptr;
+        RHI::DrawListMask m_drawListMask;
+        AZStd::vector<Cullable> m_cullables;
+        AZStd::vector<ViewPtr> m_views;
+    };
+
+    TEST_F(CullingTests, BatchViews_ShadowViews_AreBatched)
+    {
+        Matrix4x4 viewToClip;
+        MakePerspectiveFovMatrixRH(viewToClip, Constants::QuarterPi, 1.0f, 0.1f, 100.0f);
+        CreateView("Camera", View::UsageCamera, Vector3::CreateZero(), viewToClip);
+        CreateShadowViews(32);
+
+        AZStd::vector<AZStd::vector<View*>> viewBatches;
+        AZStd::vector<View*> singleViews;
+        m_cullingScene->BatchViews(m_views, viewBatches, singleViews);
+
+        ASSERT_EQ(2, viewBatches.size());
+        EXPECT_EQ(AzFramework::IVisibilityScene::MaxEnumerateFrusta, viewBatches[0].size());
+        EXPECT_EQ(m_views.size() - 1 - AzFramework::IVisibilityScene::MaxEnumerateFrusta, viewBatches[1].size());
+        ASSERT_EQ(1, singleViews.size());
+        EXPECT_EQ(m_views[0].get(), singleViews[0]);
+    }
+
+    TEST_F(CullingTests, BatchViews_FrustumCullingDisabled_NothingIsBatched)
+    {
+        CreateShadowViews(4);
+        m_cullingScene->GetDebugContext().m_enableFrustumCulling = false;
+
+        AZStd::vector<AZStd::vector<View*>> viewBatches;
+        AZStd::vector<View*> singleViews;
+        m_cullingScene->BatchViews(m_views, viewBatches, singleViews);
+
+        EXPECT_TRUE(viewBatches.empty());
+        EXPECT_EQ(m_views.size(), singleViews.size());
+    }
+
+    TEST_F(CullingTests, ProcessCullablesBatched_CascadesAndSpotShadows_MatchCullingEachView)
+    {
+        CreateCullables();
+        CreateShadowViews(32);
+
+        const AZStd::vector<AZStd::vector<const void*>> expectedVisibleObjects = CullEachView();
+        const AZStd::vector<AZStd::vector<const void*>> visibleObjects = CullBatched();
+
+        ASSERT_EQ(expectedVisibleObjects.size(), visibleObjects.size());
+        size_t totalVisibleObjects = 0;
+        for (size_t viewIndex = 0; viewIndex < visibleObjects.size(); ++viewIndex)
+        {
+            EXPECT_EQ(expectedVisibleObjects[viewIndex], visibleObjects[viewIndex]) << "view " << viewIndex;
+            totalVisibleObjects += visibleObjects[viewIndex].size();
+        }
+
+        // the smallest cascade sees 13x13 cullables, the largest the whole grid
+        EXPECT_EQ(13 * 13, visibleObjects[0].size());
+        EXPECT_EQ(m_cullables.size(), visibleObjects[3].size());
+        EXPECT_GT(totalVisibleObjects, m_cullables.size());
+    }
+
+    TEST_F(CullingTests, ProcessCullablesBatched_HiddenCullables_AreNotVisible)
+    {
+        CreateCullables();
+        CreateShadowViews(2);
+        for (size_t index = 0; index < m_cullables.size(); index += 2)
+        {
+            m_cullables[index].m_isHidden = true;
+        }
+
+        const AZStd::vector<AZStd::vector<const void*>> visibleObjects = CullBatched();
+        for (const AZStd::vector<const void*>& viewObjects : visibleObjects)
+        {
+            for (const void* visibleObject : viewObjects)
+            {
+                EXPECT_FALSE(static_cast<const Cullable*>(visibleObject)->m_isHidden);
+            }
+        }
+        EXPECT_EQ(m_cullables.size() / 2, visibleObjects[3].size());
+    }
+
+    TEST_F(CullingTests, GpuDrivenCullInstances_CascadesAndSpotShadows_MatchCullingEachView)
+    {
+        CreateCullables();
+        CreateShadowViews(32);
+        for (size_t index = 0; index < m_cullables.size(); index += 7)
+        {
+            m_cullables[index].m_isHidden = true;
+        }
+
+        AZStd::vector<GpuDrivenCulling::InstanceData> instances;
+        for (const Cullable& cullable : m_cullables)
+        {
+            instances.push_back(GpuDrivenCulling::CreateInstanceData(cullable));
+        }
+
+        const AZStd::vector<AZStd::vector<const void*>> expectedVisibleObjects = CullEachView();
+
+        GpuDrivenCulling::CullingOutput output;
+        for (size_t viewIndex = 0; viewIndex < m_views.size(); ++viewIndex)
+        {
+            GpuDrivenCulling::CullInstances(
+                GpuDrivenCulling::CreateViewData(*m_views[viewIndex]),
+                instances, {}, {}, {}, output);
+
+            AZStd::vector<const void*> visibleObjects;
+            for (uint32_t instanceIndex : output.m_visibleInstances)
+            {
+                visibleObjects.push_back(&m_cullables[instanceIndex]);
+            }
+            AZStd::sort(visibleObjects.begin(), visibleObjects.end());
+
+            EXPECT_EQ(expectedVisibleObjects[viewIndex], visibleObjects) << "view " << viewIndex;
+            // the instances have no lods, so they draw no groups
+            EXPECT_TRUE(output.m_groupInstances.empty());
+        }
+    }
+
+    TEST_F(CullingTests, GpuDrivenCullInstances_ScreenCoverageLods_AddInstancesToGroupsOfSelectedLod)
+    {
+        Matrix4x4 viewToClip;
+        MakePerspectiveFovMatrixRH(viewToClip, Constants::QuarterPi, 1.0f, 0.1f, 1000.0f);
+        ViewPtr view = CreateView("Camera", View::UsageCamera, Vector3::CreateZero(), viewToClip);
+
+        // two lods with one and two meshes, the first for the instances covering at least a tenth of the screen
+        const GpuDrivenCulling::LodData lods[] = { { 0.1f, 1.0f, 0, 1 }, { 0.0f, 0.1f, 1, 2 } };
+        const GpuDrivenCulling::DrawData draws[] = { { 0 }, { 1 }, { 2 } };
+        GpuDrivenCulling::GroupData groups[] = { { 300, 0, 0 }, { 30, 300, 100 }, { 60, 330, 100 } };
+
+        AZStd::vector<GpuDrivenCulling::InstanceData> instances;
+        for (const float distance : { 10.0f, 200.0f, -10.0f })
+        {
+            GpuDrivenCulling::InstanceData& instance = instances.emplace_back();
+            instance.m_boundingSphere = { 0.0f, 0.0f, -distance, 2.0f };
+            instance.m_obbPositionAndLodRadius = { 0.0f, 0.0f, -distance, 1.0f };
+            instance.m_obbAxisXAndHalfLength = { 1.0f, 0.0f, 0.0f, 1.0f };
+            instance.m_obbAxisYAndHalfLength = { 0.0f, 1.0f, 0.0f, 1.0f };
+            instance.m_obbAxisZAndHalfLength = { 0.0f, 0.0f, 1.0f, 1.0f };
+            instance.m_drawListMask = { 1, 0 };
+            instance.m_lodCount = 2;
+        }
+
+        // every instance may draw every group
+        EXPECT_EQ(9, GpuDrivenCulling::AssignGroupInstanceRanges(instances, lods, draws, groups));
+        EXPECT_EQ(0, groups[0].m_firstInstance);
+        EXPECT_EQ(3, groups[1].m_firstInstance);
+        EXPECT_EQ(6, groups[2].m_firstInstance);
+
+        GpuDrivenCulling::CullingOutput output;
+        GpuDrivenCulling::CullInstances(GpuDrivenCulling::CreateViewData(*view), instances, lods, draws, groups, output);
+
+        // the instance behind the camera is culled, the near one draws lod 0 and the far one lod 1
+        ASSERT_EQ(2, output.m_visibleInstances.size());
+        ASSERT_EQ(3, output.m_drawArguments.size());
+        EXPECT_EQ(1, output.m_drawArguments[0].m_instanceCount);
+        EXPECT_EQ(300, output.m_drawArguments[0].m_indexCount);
+        EXPECT_EQ(0, output.m_groupInstances[groups[0].m_firstInstance]);
+        EXPECT_EQ(1, output.m_drawArguments[1].m_instanceCount);
+        EXPECT_EQ(30, output.m_drawArguments[1].m_indexCount);
+        EXPECT_EQ(100, output.m_drawArguments[1].m_vertexOffset);
+        EXPECT_EQ(1, output.m_groupInstances[groups[1].m_firstInstance]);
+        EXPECT_EQ(1, output.m_drawArguments[2].m_instanceCount);
+        EXPECT_EQ(330, output.m_drawArguments[2].m_indexOffset);
+        EXPECT_EQ(1, output.m_groupInstances[groups[2].m_firstInstance]);
+
+        // a lod override ignores the screen coverage
+        instances[1].m_lodOverride = 0;
+        GpuDrivenCulling::CullInstances(GpuDrivenCulling::CreateViewData(*view), instances, lods, draws, groups, output);
+        EXPECT_EQ(2, output.m_drawArguments[0].m_instanceCount);
+        EXPECT_EQ(0, output.m_drawArguments[1].m_instanceCount);
+        EXPECT_EQ(0, output.m_drawArguments[2].m_instanceCount);
+        EXPECT_EQ(0, output.m_groupInstances[0]);
+        EXPECT_EQ(1, output.m_groupInstances[1]);
+
+        // instances without a draw list the view renders are culled
+        instances[0].m_drawListMask = { 0, 1 };
+        view->SetDrawListMask(RHI::DrawListMask(1));
+        GpuDrivenCulling::CullInstances(GpuDrivenCulling::CreateViewData(*view), instances, lods, draws, groups, output);
+        EXPECT_EQ(1, output.m_visibleInstances.size());
+        EXPECT_EQ(1, output.m_drawArguments[0].m_instanceCount);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    // Culls the 4 cascades of a directional light and 32 spot shadows over the range number of cullables with the stub RHI,
+    // once view by view and once in batches of views that share a visibility scene traversal.
+    class CullingBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        // The culling fixture is a gtest fixture, it is only reused here to bring up the RPI with the stub RHI.
+        class Environment
+            : public CullingTests
+        {
+        public:
+            using CullingTests::CreateCullables;
+            using CullingTests::CreateShadowViews;
+            using CullingTests::ProcessBatched;
+            using CullingTests::ProcessEachView;
+            using CullingTests::SetUp;
+            using CullingTests::TearDown;
+
+            void TestBody() override {}
+        };
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            // a grid 400 cullables wide, which is wider than the largest cascade
+            constexpr int gridWidth = 400;
+            const int gridHeight = aznumeric_cast<int>(state.range(0)) / gridWidth;
+
+            m_environment = AZStd::make_unique<Environment>();
+            m_environment->SetUp();
+            m_environment->CreateCullables(gridWidth, gridHeight);
+            m_environment->CreateShadowViews(32);
+        }
+
+        void internalTearDown([[maybe_unused]] const ::benchmark::State& state)
+        {
+            m_environment->TearDown();
+            m_environment.reset();
+        }
+
+        AZStd::unique_ptr<Environment> m_environment;
+    };
+
+    BENCHMARK_DEFINE_F(CullingBenchmarkFixture, BM_CullShadowViewsEachView)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_environment->ProcessEachView();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(CullingBenchmarkFixture, BM_CullShadowViewsBatched)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_environment->ProcessBatched();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(CullingBenchmarkFixture, BM_CullShadowViewsEachView)->Arg(100000)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(CullingBenchmarkFixture, BM_CullShadowViewsBatched)->Arg(100000)->Unit(benchmark::kMillisecond);
+#endif
+}
@@ -213,7 +213,7 @@ namespace EMotionFX
     }
 
     // update the transformation data
-    void ActorInstance::UpdateTransformations(float timePassedInSeconds, bool updateJointTransforms, bool sampleMotions)
+    void ActorInstance::UpdateTransformations(float timePassedInSeconds, bool updateJointTransforms, bool sampleMotions, UpdateStageTimings* outStageTimings)
     {
         // Update the LOD level in case a change was requested.
         UpdateLODLevel();
@@ -265,6 +265,18 @@ namespace EMotionFX
             return;
         } // if the recorder is in playback mode and we recorded this actor instance
 
+        // Add the time passed since the last stamp to the given stage, in case the stage timings got requested.
+        AZStd::sys_time_t lastStageTicks = outStageTimings ? AZStd::GetTimeNowTicks() : 0;
+        auto stampStage = [outStageTimings, &lastStageTicks](AZStd::sys_time_t UpdateStageTimings::*stage)
+        {
+            if (outStageTimings)
+            {
+                const AZStd::sys_time_t nowTicks = AZStd::GetTimeNowTicks();
+                outStageTimings->*stage += nowTicks - lastStageTicks;
+                lastStageTicks = nowTicks;
+            }
+        };
+
         // check if we are an attachment
         Attachment* attachment = GetSelfAttachment();
 
@@ -276,6 +288,8 @@ namespace EMotionFX
             {
                 m_animGraphInstance->Update(timePassedInSeconds);
                 UpdateWorldTransform();
+                stampStage(&UpdateStageTimings::m_animGraphUpdate);
+
                 if (updateJointTransforms && sampleMotions)
                 {
                     m_animGraphInstance->Output(m_transformData->GetCurrentPose());
@@ -285,14 +299,17 @@ namespace EMotionFX
                         m_ragdollInstance->PostAnimGraphUpdate(timePassedInSeconds);
                     }
                 }
+                stampStage(&UpdateStageTimings::m_motionSampling);
             }
             else if (m_motionSystem)
             {
                 m_motionSystem->Update(timePassedInSeconds, (updateJointTransforms && sampleMotions));
+                stampStage(&UpdateStageTimings::m_motionSampling);
             }
             else
             {
                 UpdateWorldTransform();
+                stampStage(&UpdateStageTimings::m_animGraphUpdate);
             }
 
             // when the actor instance isn't visible, we don't want to do more things
@@ -301,6 +318,7 @@ namespace EMotionFX
                 if (GetBoundsUpdateEnabled() && m_boundsUpdateType == BOUNDS_STATIC_BASED)
                 {
                     UpdateBounds(m_lodLevel, m_boundsUpdateType);
+                    stampStage(&UpdateStageTimings::m_bounds);
                 }
 
                 return;
@@ -310,7 +328,10 @@ namespace EMotionFX
             ApplyMorphSetup();
 
             UpdateSkinningMatrices();
+            stampStage(&UpdateStageTimings::m_deformerUpdate);
+
             UpdateAttachments();
+            stampStage(&UpdateStageTimings::m_attachments);
         }
         else // we are a skin attachment
         {
@@ -319,19 +340,23 @@ namespace EMotionFX
             {
                 m_animGraphInstance->Update(timePassedInSeconds);
                 UpdateWorldTransform();
+                stampStage(&UpdateStageTimings::m_animGraphUpdate);
 
                 if (updateJointTransforms && sampleMotions)
                 {
                     m_animGraphInstance->Output(m_transformData->GetCurrentPose());
                 }
+                stampStage(&UpdateStageTimings::m_motionSampling);
             }
             else if (m_motionSystem)
             {
                 m_motionSystem->Update(timePassedInSeconds, (updateJointTransforms && sampleMotions));
+                stampStage(&UpdateStageTimings::m_motionSampling);
             }
             else
             {
                 UpdateWorldTransform();
+                stampStage(&UpdateStageTimings::m_animGraphUpdate);
             }
 
             // when the actor instance isn't visible, we don't want to do more things
@@ -340,15 +365,21 @@ namespace EMotionFX
                 if (GetBoundsUpdateEnabled() && m_boundsUpdateType == BOUNDS_STATIC_BASED)
                 {
                     UpdateBounds(m_lodLevel, m_boundsUpdateType);
+                    stampStage(&UpdateStageTimings::m_bounds);
                 }
                 return;
             }
 
             m_selfAttachment->UpdateJointTransforms(*m_transformData->GetCurrentPose());
+            stampStage(&UpdateStageTimings::m_attachments);
+
             m_transformData->GetCurrentPose()->ApplyMorphWeightsToActorInstance();
             ApplyMorphSetup();
             UpdateSkinningMatrices();
+            stampStage(&UpdateStageTimings::m_deformerUpdate);
+
             UpdateAttachments();
+            stampStage(&UpdateStageTimings::m_attachments);
         }
 
         // update the bounds when needed
@@ -359,6 +390,7 @@ namespace EMotionFX
             {
                 UpdateBounds(m_lodLevel, m_boundsUpdateType, m_boundsUpdateItemFreq);
                 m_boundsUpdatePassedTime = 0.0f;
+                stampStage(&UpdateStageTimings::m_bounds);
             }
         }
     }
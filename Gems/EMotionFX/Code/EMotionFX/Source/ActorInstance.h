@@ -14,6 +14,7 @@
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/Color.h>
 #include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/time.h>
 #include "EMotionFXConfig.h"
 #include <MCore/Source/Vector.h>
 #include <MCore/Source/Ray.h>
@@ -63,6 +64,19 @@ namespace EMotionFX
             BOUNDS_STATIC_BASED         = 5     /**< Calculate the bounding volumes based on an approximate box, based on the mesh bounds, and move this box along with the actor instance position. */
         };
 
+        /**
+         * The time spent in the individual stages of UpdateTransformations(), in ticks as returned by AZStd::GetTimeNowTicks().
+         * The values get accumulated, so the same object can be passed for multiple updates.
+         */
+        struct EMFX_API UpdateStageTimings
+        {
+            AZStd::sys_time_t m_animGraphUpdate = 0;    /**< Updating the anim graph or motion system state and the world transform. */
+            AZStd::sys_time_t m_motionSampling = 0;     /**< Sampling the motions and outputting the resulting pose. */
+            AZStd::sys_time_t m_deformerUpdate = 0;     /**< Applying the morph targets and calculating the skinning matrices used by the mesh deformers. */
+            AZStd::sys_time_t m_attachments = 0;        /**< Resolving the attachment transforms. */
+            AZStd::sys_time_t m_bounds = 0;             /**< Updating the bounding volumes. */
+        };
+
         static ActorInstance* Create(Actor* actor, AZ::Entity* entity = nullptr, uint32 threadIndex = 0);
 
         /**
@@ -276,8 +290,9 @@ namespace EMotionFX
          * @param timePassedInSeconds The time passed in seconds, since the last frame or update.
          * @param updateJointTransforms When set to true the joint transformations will be calculated by calculating the animation graph output for example.
          * @param sampleMotions When set to true motions will be sampled, or whole anim graphs if using those. When updateMatrices is set to false, motions will never be sampled, even if set to true.
+         * @param outStageTimings When not nullptr, the time spent in the individual update stages is added to it.
          */
-        void UpdateTransformations(float timePassedInSeconds, bool updateJointTransforms = true, bool sampleMotions = true);
+        void UpdateTransformations(float timePassedInSeconds, bool updateJointTransforms = true, bool sampleMotions = true, UpdateStageTimings* outStageTimings = nullptr);
 
         /**
          * Update/Process the mesh deformers.
@@ -18,6 +18,7 @@
 #include "TransformData.h"
 #include "ActorInstance.h"
 #include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/SimdSkinning.h>
 #include <MCore/Source/LogManager.h>
 
 namespace EMotionFX
@@ -113,7 +114,7 @@ namespace EMotionFX
                 AZ::JobContext* jobContext = nullptr;
                 AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinRangeSimd(m_mesh, startVertex, endVertex, m_bones);
                     }, /*isAutoDelete=*/true, jobContext);
 
                 job->SetDependent(&jobCompletion);
@@ -305,6 +306,181 @@ namespace EMotionFX
         }
     }
 
+    namespace
+    {
+        // Dual quaternions of LaneCount vertices in structure-of-arrays form.
+        struct DualQuatLanes
+        {
+            SimdSkinning::FloatType m_real[4];
+            SimdSkinning::FloatType m_dual[4];
+        };
+
+        // Skin SimdSkinning::LaneCount vertices at once, see DualQuatSkinDeformer::SkinRange() for the scalar reference.
+        template<bool SkinTangents, bool SkinBitangents, typename BoneInfoType>
+        void SkinBatchesSimd(const AZStd::vector<BoneInfoType>& boneInfos, AZ::u32 startVertex, AZ::u32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, const AZ::u32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
+        {
+            using namespace SimdSkinning;
+
+            // Lanes without any influences are padded with the identity, which leaves their vertex unchanged.
+            static const MCore::DualQuaternion s_identity;
+
+            const FloatType zero = Vec4::ZeroFloat();
+            const FloatType two = Vec4::Splat(2.0f);
+
+            for (AZ::u32 v = startVertex; v < endVertex; v += LaneCount)
+            {
+                AZ::u32 orgVertices[LaneCount];
+                size_t numInfluences[LaneCount];
+                size_t maxNumInfluences = 1;
+                for (AZ::u32 lane = 0; lane < LaneCount; ++lane)
+                {
+                    orgVertices[lane] = orgVerts[v + lane];
+                    numInfluences[lane] = layer->GetNumInfluences(orgVertices[lane]);
+                    maxNumInfluences = AZStd::max(maxNumInfluences, numInfluences[lane]);
+                }
+
+                // Blend the dual quaternions of all influences per lane.
+                DualQuatLanes skinQuat;
+                FloatType pivot[4];
+                for (AZ::u32 i = 0; i < 4; ++i)
+                {
+                    skinQuat.m_real[i] = zero;
+                    skinQuat.m_dual[i] = zero;
+                }
+
+                for (size_t i = 0; i < maxNumInfluences; ++i)
+                {
+                    const MCore::DualQuaternion* laneQuats[LaneCount];
+                    alignas(16) float laneWeights[LaneCount];
+                    for (AZ::u32 lane = 0; lane < LaneCount; ++lane)
+                    {
+                        if (i < numInfluences[lane])
+                        {
+                            const SkinInfluence* influence = layer->GetInfluence(orgVertices[lane], i);
+                            laneQuats[lane] = &boneInfos[influence->GetBoneNr()].m_dualQuat;
+                            laneWeights[lane] = influence->GetWeight();
+                        }
+                        else
+                        {
+                            laneQuats[lane] = &s_identity;
+                            laneWeights[lane] = (i == 0) ? 1.0f : 0.0f;
+                        }
+                    }
+
+                    DualQuatLanes influenceQuat;
+                    const FloatType realRows[LaneCount] = { laneQuats[0]->m_real.GetSimdValue(), laneQuats[1]->m_real.GetSimdValue(), laneQuats[2]->m_real.GetSimdValue(), laneQuats[3]->m_real.GetSimdValue() };
+                    const FloatType dualRows[LaneCount] = { laneQuats[0]->m_dual.GetSimdValue(), laneQuats[1]->m_dual.GetSimdValue(), laneQuats[2]->m_dual.GetSimdValue(), laneQuats[3]->m_dual.GetSimdValue() };
+                    GatherTransposed(realRows, influenceQuat.m_real);
+                    GatherTransposed(dualRows, influenceQuat.m_dual);
+
+                    // The first influence is the pivot used for the dot product check.
+                    if (i == 0)
+                    {
+                        for (AZ::u32 c = 0; c < 4; ++c)
+                        {
+                            pivot[c] = influenceQuat.m_real[c];
+                        }
+                    }
+
+                    // Invert the dual quat where it lies in the opposite hemisphere of the pivot, by negating its weight.
+                    FloatType weight = Vec4::LoadAligned(laneWeights);
+                    const FloatType dot = Vec4::Madd(influenceQuat.m_real[0], pivot[0], Vec4::Madd(influenceQuat.m_real[1], pivot[1], Vec4::Madd(influenceQuat.m_real[2], pivot[2], Vec4::Mul(influenceQuat.m_real[3], pivot[3]))));
+                    weight = Vec4::Select(Vec4::Sub(zero, weight), weight, Vec4::CmpLt(dot, zero));
+
+                    // weighted sum
+                    for (AZ::u32 c = 0; c < 4; ++c)
+                    {
+                        skinQuat.m_real[c] = Vec4::Madd(influenceQuat.m_real[c], weight, skinQuat.m_real[c]);
+                        skinQuat.m_dual[c] = Vec4::Madd(influenceQuat.m_dual[c], weight, skinQuat.m_dual[c]);
+                    }
+                }
+
+                // normalize the dual quaternion
+                const FloatType lengthSq = Vec4::Madd(skinQuat.m_real[0], skinQuat.m_real[0], Vec4::Madd(skinQuat.m_real[1], skinQuat.m_real[1], Vec4::Madd(skinQuat.m_real[2], skinQuat.m_real[2], Vec4::Mul(skinQuat.m_real[3], skinQuat.m_real[3]))));
+                const FloatType invLength = Vec4::SqrtInv(lengthSq);
+                for (AZ::u32 c = 0; c < 4; ++c)
+                {
+                    skinQuat.m_real[c] = Vec4::Mul(skinQuat.m_real[c], invLength);
+                    skinQuat.m_dual[c] = Vec4::Mul(skinQuat.m_dual[c], invLength);
+                }
+                const FloatType realDotDual = Vec4::Madd(skinQuat.m_real[0], skinQuat.m_dual[0], Vec4::Madd(skinQuat.m_real[1], skinQuat.m_dual[1], Vec4::Madd(skinQuat.m_real[2], skinQuat.m_dual[2], Vec4::Mul(skinQuat.m_real[3], skinQuat.m_dual[3]))));
+                for (AZ::u32 c = 0; c < 4; ++c)
+                {
+                    skinQuat.m_dual[c] = Vec4::Sub(skinQuat.m_dual[c], Vec4::Mul(skinQuat.m_real[c], realDotDual));
+                }
+
+                const Vector3Lanes realVector = { skinQuat.m_real[0], skinQuat.m_real[1], skinQuat.m_real[2] };
+                const Vector3Lanes dualVector = { skinQuat.m_dual[0], skinQuat.m_dual[1], skinQuat.m_dual[2] };
+                const FloatType realW = skinQuat.m_real[3];
+                const FloatType dualW = skinQuat.m_dual[3];
+
+                // Rotate a vector by the real part, matching MCore::DualQuaternion::TransformVector().
+                auto transformVector = [&](const Vector3Lanes& vec) -> Vector3Lanes
+                {
+                    Vector3Lanes inner = CrossLanes(realVector, vec);
+                    MaddLanes(realW, vec, inner);
+                    const Vector3Lanes outer = CrossLanes(realVector, inner);
+                    Vector3Lanes result = vec;
+                    MaddLanes(two, outer, result);
+                    return result;
+                };
+
+                // perform skinning
+                const Vector3Lanes vtxPos = LoadLanes(&positions[v]);
+                Vector3Lanes newPos = transformVector(vtxPos);
+                Vector3Lanes displacement = CrossLanes(realVector, dualVector);
+                MaddLanes(realW, dualVector, displacement);
+                MaddLanes(Vec4::Sub(zero, dualW), realVector, displacement);
+                MaddLanes(two, displacement, newPos);
+                StoreLanes(newPos, &positions[v]);
+
+                StoreLanes(transformVector(LoadLanes(&normals[v])), &normals[v]);
+                if constexpr (SkinTangents)
+                {
+                    StoreLanes(transformVector(LoadLanes(&tangents[v])), &tangents[v]);
+                }
+                if constexpr (SkinBitangents)
+                {
+                    StoreLanes(transformVector(LoadLanes(&bitangents[v])), &bitangents[v]);
+                }
+            }
+        }
+    } // namespace
+
+    void DualQuatSkinDeformer::SkinRangeSimd(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos)
+    {
+        SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
+        AZ_Assert(layer, "Cannot find skinning layer.");
+
+        AZ::Vector3* positions = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        AZ::Vector3* normals = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+        AZ::Vector4* tangents = static_cast<AZ::Vector4*>(mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+        AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+        AZ::u32* orgVerts = static_cast<AZ::u32*>(mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+
+        // Skin whole batches with the SIMD kernel and the remaining vertices with the scalar version.
+        const AZ::u32 numVertices = endVertex - startVertex;
+        const AZ::u32 simdEndVertex = startVertex + (numVertices / SimdSkinning::LaneCount) * SimdSkinning::LaneCount;
+
+        if (tangents && bitangents)
+        {
+            SkinBatchesSimd<true, true>(boneInfos, startVertex, simdEndVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+        }
+        else if (tangents) // tangents but no bitangents
+        {
+            SkinBatchesSimd<true, false>(boneInfos, startVertex, simdEndVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+        }
+        else // there are no tangents and bitangents to skin
+        {
+            SkinBatchesSimd<false, false>(boneInfos, startVertex, simdEndVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+        }
+
+        if (simdEndVertex < endVertex)
+        {
+            SkinRange(mesh, simdEndVertex, endVertex, boneInfos);
+        }
+    }
+
     // initialize the mesh deformer
     void DualQuatSkinDeformer::Reinitialize(Actor* actor, Node* node, size_t lodLevel)
     {
@@ -371,7 +547,7 @@ namespace EMotionFX
                     taskDescriptor,
                     [this, startVertex, endVertex]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinRangeSimd(m_mesh, startVertex, endVertex, m_bones);
                     });
             }
         }
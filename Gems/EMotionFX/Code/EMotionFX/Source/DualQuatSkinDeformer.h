@@ -137,6 +137,17 @@ namespace EMotionFX
          */
         static void SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos);
 
+        /**
+         * Skin a part of the mesh, processing SimdSkinning::LaneCount vertices at once.
+         * Vertices that do not fill a whole batch at the end of the range are skinned by SkinRange().
+         * The results match SkinRange() within floating point precision.
+         * @param mesh The mesh to be skinned.
+         * @param startVertex The start vertex index to start skinning.
+         * @param endVertex The end vertex index for the range to be skinned.
+         * @param boneInfos The pre-calculated skinning matrices shared across the skinning process.
+         */
+        static void SkinRangeSimd(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos);
+
         //! Number of vertices per batch/job used for multi-threaded software skinning.
         static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
         AZ::TaskGraph m_taskGraph;
@@ -20,6 +20,9 @@
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/time.h>
 
 
 namespace EMotionFX
@@ -32,6 +35,14 @@ namespace EMotionFX
     {
         m_cleanTimer     = 0.0f; // time passed since last schedule cleanup, in seconds
         m_steps.reserve(1000);
+
+        for (AZStd::atomic<AZStd::sys_time_t>& stageTicks : m_stageTicks)
+        {
+            stageTicks.store(0);
+        }
+
+        const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        m_useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
     }
 
 
@@ -53,10 +64,18 @@ namespace EMotionFX
     {
         Lock();
         m_steps.clear();
+        m_taskGraphDirty = true;
         Unlock();
     }
 
 
+    void MultiThreadScheduler::SetUseTaskGraph(bool useTaskGraph)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_useTaskGraph = useTaskGraph;
+    }
+
+
     // add the actor instance dependencies to the schedule step
     void MultiThreadScheduler::AddDependenciesToStep(ActorInstance* instance, ScheduleStep* outStep)
     {
@@ -100,6 +119,7 @@ namespace EMotionFX
             else
             {
                 m_steps.erase(AZStd::next(begin(m_steps), s));
+                m_taskGraphDirty = true;
             }
         }
     }
@@ -146,6 +166,75 @@ namespace EMotionFX
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
 
+        const AZStd::sys_time_t startTicks = m_stageTimingEnabled ? AZStd::GetTimeNowTicks() : 0;
+
+        if (m_useTaskGraph)
+        {
+            ExecuteTaskGraph(timePassedInSeconds);
+        }
+        else
+        {
+            ExecuteJobs(timePassedInSeconds);
+        }
+
+        if (m_stageTimingEnabled)
+        {
+            const float ticksToMs = 1000.0f / static_cast<float>(AZStd::GetTimeTicksPerSecond());
+            m_stageTimings.m_animGraphUpdateMs = static_cast<float>(m_stageTicks[0].exchange(0)) * ticksToMs;
+            m_stageTimings.m_motionSamplingMs = static_cast<float>(m_stageTicks[1].exchange(0)) * ticksToMs;
+            m_stageTimings.m_deformerUpdateMs = static_cast<float>(m_stageTicks[2].exchange(0)) * ticksToMs;
+            m_stageTimings.m_attachmentsMs = static_cast<float>(m_stageTicks[3].exchange(0)) * ticksToMs;
+            m_stageTimings.m_boundsMs = static_cast<float>(m_stageTicks[4].exchange(0)) * ticksToMs;
+            m_stageTimings.m_totalMs = static_cast<float>(AZStd::GetTimeNowTicks() - startTicks) * ticksToMs;
+        }
+    }
+
+
+    void MultiThreadScheduler::UpdateActorInstance(ActorInstance* actorInstance, uint32 threadIndex, float timePassedInSeconds)
+    {
+        actorInstance->SetThreadIndex(threadIndex);
+
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        // update the actor instance
+        if (m_stageTimingEnabled)
+        {
+            ActorInstance::UpdateStageTimings stageTimings;
+            actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions, &stageTimings);
+
+            m_stageTicks[0].fetch_add(stageTimings.m_animGraphUpdate);
+            m_stageTicks[1].fetch_add(stageTimings.m_motionSampling);
+            m_stageTicks[2].fetch_add(stageTimings.m_deformerUpdate);
+            m_stageTicks[3].fetch_add(stageTimings.m_attachments);
+            m_stageTicks[4].fetch_add(stageTimings.m_bounds);
+        }
+        else
+        {
+            actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+        }
+    }
+
+
+    void MultiThreadScheduler::ExecuteJobs(float timePassedInSeconds)
+    {
         for (const ScheduleStep& currentStep : m_steps)
         {
             if (currentStep.m_actorInstances.empty())
@@ -167,34 +256,11 @@ namespace EMotionFX
                 {
                     AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
 
-                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
-                    actorInstance->SetThreadIndex(threadIndex);
-
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
-                    {
-                        m_numVisible.Increment();
-                    }
-
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
-
-                        if (isVisible)
-                        {
-                            m_numSampled.Increment();
-                        }
-                    }
-
-                    // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();
+                    UpdateActorInstance(actorInstance, threadIndex, timePassedInSeconds);
                 }, true, jobContext);
 
-                job->SetDependent(&jobCompletion);               
+                job->SetDependent(&jobCompletion);
                 job->Start();
 
                 m_numUpdated.Increment();
@@ -205,6 +271,122 @@ namespace EMotionFX
     }
 
 
+    void MultiThreadScheduler::ExecuteTaskGraph(float timePassedInSeconds)
+    {
+        if (m_taskGraphDirty)
+        {
+            BuildTaskGraph();
+        }
+
+        // the retained tasks read the time passed from here, so that the graph doesn't need to be rebuilt every frame
+        m_timePassedInSeconds = timePassedInSeconds;
+
+        AZ::TaskGraphEvent finishedEvent;
+        m_taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
+
+
+    void MultiThreadScheduler::BuildTaskGraph()
+    {
+        AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::BuildTaskGraph");
+
+        m_taskGraph.Reset();
+        m_taskGraphDirty = false;
+
+        // Task graph workers don't have an index we can use to pick the thread data, so the tasks lease one of the thread datas instead.
+        // This makes sure the pose pools of a thread data are never used by two actor instances at the same time.
+        // No tasks are running while the graph gets rebuilt, so the slots can be reset here.
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_threadSlotMutex);
+            const uint32 numThreadSlots = static_cast<uint32>(GetEMotionFX().GetNumThreads());
+            m_freeThreadSlots.resize(numThreadSlots);
+            for (uint32 i = 0; i < numThreadSlots; ++i)
+            {
+                m_freeThreadSlots[i] = i;
+            }
+            m_freeThreadSlotSemaphore = AZStd::make_unique<AZStd::semaphore>(numThreadSlots);
+        }
+
+        const AZ::TaskDescriptor updateTaskDescriptor{ "MultiThreadScheduler::ActorInstanceUpdateTask", "Animation" };
+        const AZ::TaskDescriptor barrierTaskDescriptor{ "MultiThreadScheduler::StepBarrier", "Animation" };
+
+        AZStd::vector<AZ::TaskToken> previousStepTasks;
+        AZStd::vector<AZ::TaskToken> currentStepTasks;
+        for (const ScheduleStep& currentStep : m_steps)
+        {
+            if (currentStep.m_actorInstances.empty())
+            {
+                continue;
+            }
+
+            // Join all tasks of the previous step, so that the actor instances attached to them are updated afterwards.
+            // A single barrier keeps the number of edges linear in the number of actor instances.
+            if (!previousStepTasks.empty())
+            {
+                AZ::TaskToken barrier = m_taskGraph.AddTask(barrierTaskDescriptor, []() {});
+                for (AZ::TaskToken& previousTask : previousStepTasks)
+                {
+                    previousTask.Precedes(barrier);
+                }
+                previousStepTasks.clear();
+                previousStepTasks.emplace_back(AZStd::move(barrier));
+            }
+
+            for (ActorInstance* actorInstance : currentStep.m_actorInstances)
+            {
+                // The enabled state is checked when the task runs, as it can change without the schedule changing.
+                AZ::TaskToken task = m_taskGraph.AddTask(updateTaskDescriptor, [this, actorInstance]()
+                {
+                    if (actorInstance->GetIsEnabled() == false)
+                    {
+                        return;
+                    }
+
+                    const uint32 threadIndex = AcquireThreadSlot();
+                    UpdateActorInstance(actorInstance, threadIndex, m_timePassedInSeconds);
+                    ReleaseThreadSlot(threadIndex);
+
+                    m_numUpdated.Increment();
+                });
+
+                for (AZ::TaskToken& previousTask : previousStepTasks)
+                {
+                    previousTask.Precedes(task);
+                }
+                currentStepTasks.emplace_back(AZStd::move(task));
+            }
+
+            AZStd::swap(previousStepTasks, currentStepTasks);
+            currentStepTasks.clear();
+        }
+    }
+
+
+    uint32 MultiThreadScheduler::AcquireThreadSlot()
+    {
+        // In case there are more task graph workers than thread datas, block until another task finished its update.
+        // The tasks holding the slots are running and never wait on anything, so they always get to release them.
+        m_freeThreadSlotSemaphore->acquire();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadSlotMutex);
+        AZ_Assert(!m_freeThreadSlots.empty(), "Acquired a thread slot while none is free.");
+        const uint32 threadIndex = m_freeThreadSlots.back();
+        m_freeThreadSlots.pop_back();
+        return threadIndex;
+    }
+
+
+    void MultiThreadScheduler::ReleaseThreadSlot(uint32 threadIndex)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_threadSlotMutex);
+            m_freeThreadSlots.emplace_back(threadIndex);
+        }
+        m_freeThreadSlotSemaphore->release();
+    }
+
+
     // find the next free spot in the schedule
     bool MultiThreadScheduler::FindNextFreeItem(ActorInstance* actorInstance, size_t startStep, size_t* outStepNr)
     {
@@ -271,6 +453,7 @@ namespace EMotionFX
         m_steps[ outStep ].m_actorInstances.reserve(GetEMotionFX().GetNumThreads());
         m_steps[ outStep ].m_actorInstances.emplace_back(instance);
         AddDependenciesToStep(instance, &m_steps[outStep]);
+        m_taskGraphDirty = true;
 
         // recursively add all attachments too
         const size_t numAttachments = instance->GetNumAttachments();
@@ -304,6 +487,8 @@ namespace EMotionFX
             // and if so, reconstruct the dependencies of this step
             if (step.m_actorInstances.size() < numActorInstancesPreRemove)
             {
+                m_taskGraphDirty = true;
+
                 // clear the dependencies (but don't delete the memory)
                 step.m_dependencies.clear();
 
@@ -13,6 +13,11 @@
 #include "ActorUpdateScheduler.h"
 #include "Actor.h"
 #include <MCore/Source/MultiThreadManager.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace EMotionFX
 {
@@ -54,6 +59,20 @@ namespace EMotionFX
             AZStd::vector<ActorInstance*>       m_actorInstances;    /**< The actor instances used inside this step. Each array entry will execute in another thread. */
         };
 
+        /**
+         * The time spent in the individual update stages during the last call to Execute(), in milliseconds.
+         * The stage times are summed over all actor instances, so they can be larger than the total time when updating in parallel.
+         */
+        struct EMFX_API StageTimings
+        {
+            float m_animGraphUpdateMs = 0.0f;   /**< Anim graph and motion system state updates. */
+            float m_motionSamplingMs = 0.0f;    /**< Sampling the motions and outputting the poses. */
+            float m_deformerUpdateMs = 0.0f;    /**< Morph target and skinning matrix updates. */
+            float m_attachmentsMs = 0.0f;       /**< Resolving the attachment transforms. */
+            float m_boundsMs = 0.0f;            /**< Bounding volume updates. */
+            float m_totalMs = 0.0f;             /**< The wall clock time of the whole Execute() call. */
+        };
+
         /**
          * The constructor.
          */
@@ -122,11 +141,63 @@ namespace EMotionFX
         const ScheduleStep& GetScheduleStep(size_t index) const { return m_steps[index]; }
         size_t GetNumScheduleSteps() const { return m_steps.size(); }
 
+        /**
+         * Update the actor instances using a task graph instead of individual jobs.
+         * The task graph contains a task per actor instance and is only rebuilt when the schedule changes.
+         * The steps are separated by barrier tasks so that attachments still get updated after the actor instances they are attached to.
+         * By default the task graph is used when it is activated through the cl_activateTaskGraph console variable.
+         * @param useTaskGraph True to update using the task graph, false to update using the job system.
+         */
+        void SetUseTaskGraph(bool useTaskGraph);
+        bool GetUseTaskGraph() const { return m_useTaskGraph; }
+
+        /**
+         * Enable or disable measuring the time spent in the individual update stages.
+         * This is disabled by default, as it adds a few timer queries per actor instance update.
+         * @param enabled True to measure the stage timings, false to disable it.
+         */
+        void SetStageTimingEnabled(bool enabled) { m_stageTimingEnabled = enabled; }
+        bool GetStageTimingEnabled() const { return m_stageTimingEnabled; }
+
+        /**
+         * Get the stage timings of the last call to Execute().
+         * This is only updated when the stage timing is enabled.
+         * @result The timings of the last update.
+         */
+        const StageTimings& GetStageTimings() const { return m_stageTimings; }
+
     protected:
         AZStd::vector< ScheduleStep >    m_steps;         /**< An array of update steps, that together form the schedule. */
         float                           m_cleanTimer;    /**< The time passed since the last automatic call to the Optimize method. */
         MCore::MutexRecursive           m_mutex;
 
+        AZ::TaskGraph                   m_taskGraph;                    /**< The retained task graph, holding a task per actor instance. */
+        bool                            m_useTaskGraph = false;         /**< Update using the task graph instead of the job system? */
+        bool                            m_taskGraphDirty = true;        /**< Does the task graph need to be rebuilt because the schedule changed? */
+        float                           m_timePassedInSeconds = 0.0f;   /**< The time passed of the current update, read by the retained tasks. */
+        AZStd::mutex                    m_threadSlotMutex;
+        AZStd::vector<uint32>           m_freeThreadSlots;              /**< The thread data indices not in use by any of the running tasks. */
+        AZStd::unique_ptr<AZStd::semaphore> m_freeThreadSlotSemaphore;  /**< Counts the free thread slots, tasks block on it while all slots are in use. */
+
+        bool                            m_stageTimingEnabled = false;
+        StageTimings                    m_stageTimings;
+        AZStd::atomic<AZStd::sys_time_t> m_stageTicks[5];               /**< The accumulated stage ticks of the current update, in the order of the StageTimings members. */
+
+        /**
+         * Update a single actor instance, including the motion sampling timer and the statistics.
+         * @param actorInstance The actor instance to update.
+         * @param threadIndex The thread data index the actor instance is allowed to use during the update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void UpdateActorInstance(ActorInstance* actorInstance, uint32 threadIndex, float timePassedInSeconds);
+
+        void ExecuteJobs(float timePassedInSeconds);
+        void ExecuteTaskGraph(float timePassedInSeconds);
+        void BuildTaskGraph();
+
+        uint32 AcquireThreadSlot();
+        void ReleaseThreadSlot(uint32 threadIndex);
+
         bool HasActorInstanceInSteps(const ActorInstance* actorInstance) const;
 
         /**
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+
+namespace EMotionFX
+{
+    /**
+     * Helpers shared by the CPU skinning deformers to skin several vertices at once.
+     * Vertices are processed in structure-of-arrays form, where every register holds the same component of
+     * LaneCount vertices. The underlying AZ::Simd::Vec4 maps onto SSE, NEON or a scalar fallback depending on the platform.
+     */
+    namespace SimdSkinning
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using FloatType = Vec4::FloatType;
+
+        //! The number of vertices skinned together by one iteration of the SIMD skinning kernels.
+        static constexpr AZ::u32 LaneCount = static_cast<AZ::u32>(Vec4::ElementCount);
+
+        //! Three component vectors of LaneCount vertices, stored as structure-of-arrays.
+        struct Vector3Lanes
+        {
+            FloatType m_x;
+            FloatType m_y;
+            FloatType m_z;
+        };
+
+        AZ_FORCE_INLINE Vector3Lanes CreateZeroLanes()
+        {
+            return { Vec4::ZeroFloat(), Vec4::ZeroFloat(), Vec4::ZeroFloat() };
+        }
+
+        //! Load LaneCount consecutive vectors and transpose them into structure-of-arrays form.
+        AZ_FORCE_INLINE Vector3Lanes LoadLanes(const AZ::Vector3* vectors)
+        {
+            return {
+                Vec4::LoadImmediate(vectors[0].GetX(), vectors[1].GetX(), vectors[2].GetX(), vectors[3].GetX()),
+                Vec4::LoadImmediate(vectors[0].GetY(), vectors[1].GetY(), vectors[2].GetY(), vectors[3].GetY()),
+                Vec4::LoadImmediate(vectors[0].GetZ(), vectors[1].GetZ(), vectors[2].GetZ(), vectors[3].GetZ())
+            };
+        }
+
+        //! Load the xyz components of LaneCount consecutive vectors, the w component is ignored.
+        AZ_FORCE_INLINE Vector3Lanes LoadLanes(const AZ::Vector4* vectors)
+        {
+            return {
+                Vec4::LoadImmediate(vectors[0].GetX(), vectors[1].GetX(), vectors[2].GetX(), vectors[3].GetX()),
+                Vec4::LoadImmediate(vectors[0].GetY(), vectors[1].GetY(), vectors[2].GetY(), vectors[3].GetY()),
+                Vec4::LoadImmediate(vectors[0].GetZ(), vectors[1].GetZ(), vectors[2].GetZ(), vectors[3].GetZ())
+            };
+        }
+
+        //! Transpose the lanes back and store them into LaneCount consecutive vectors.
+        AZ_FORCE_INLINE void StoreLanes(const Vector3Lanes& lanes, AZ::Vector3* vectors)
+        {
+            alignas(16) float x[LaneCount];
+            alignas(16) float y[LaneCount];
+            alignas(16) float z[LaneCount];
+            Vec4::StoreAligned(x, lanes.m_x);
+            Vec4::StoreAligned(y, lanes.m_y);
+            Vec4::StoreAligned(z, lanes.m_z);
+            for (AZ::u32 lane = 0; lane < LaneCount; ++lane)
+            {
+                vectors[lane].Set(x[lane], y[lane], z[lane]);
+            }
+        }
+
+        //! Store the lanes into the xyz components of LaneCount consecutive vectors, keeping their w component.
+        AZ_FORCE_INLINE void StoreLanes(const Vector3Lanes& lanes, AZ::Vector4* vectors)
+        {
+            alignas(16) float x[LaneCount];
+            alignas(16) float y[LaneCount];
+            alignas(16) float z[LaneCount];
+            Vec4::StoreAligned(x, lanes.m_x);
+            Vec4::StoreAligned(y, lanes.m_y);
+            Vec4::StoreAligned(z, lanes.m_z);
+            for (AZ::u32 lane = 0; lane < LaneCount; ++lane)
+            {
+                vectors[lane].Set(x[lane], y[lane], z[lane], vectors[lane].GetW());
+            }
+        }
+
+        //! Gather one four-wide row per lane (e.g. a matrix row or a quaternion) and transpose them.
+        //! Afterwards out[i] holds the i-th element of the row for every lane.
+        AZ_FORCE_INLINE void GatherTransposed(const FloatType (&rows)[LaneCount], FloatType (&out)[LaneCount])
+        {
+            Vec4::Mat4x4Transpose(rows, out);
+        }
+
+        //! Weighted accumulation: result += weight * value.
+        AZ_FORCE_INLINE void MaddLanes(FloatType weight, const Vector3Lanes& value, Vector3Lanes& result)
+        {
+            result.m_x = Vec4::Madd(weight, value.m_x, result.m_x);
+            result.m_y = Vec4::Madd(weight, value.m_y, result.m_y);
+            result.m_z = Vec4::Madd(weight, value.m_z, result.m_z);
+        }
+
+        AZ_FORCE_INLINE Vector3Lanes CrossLanes(const Vector3Lanes& a, const Vector3Lanes& b)
+        {
+            return {
+                Vec4::Sub(Vec4::Mul(a.m_y, b.m_z), Vec4::Mul(a.m_z, b.m_y)),
+                Vec4::Sub(Vec4::Mul(a.m_z, b.m_x), Vec4::Mul(a.m_x, b.m_z)),
+                Vec4::Sub(Vec4::Mul(a.m_x, b.m_y), Vec4::Mul(a.m_y, b.m_x))
+            };
+        }
+    } // namespace SimdSkinning
+} // namespace EMotionFX
@@ -7,6 +7,8 @@
  */
 
 // include the required headers
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include "EMotionFXConfig.h"
 #include "SoftSkinDeformer.h"
 #include "Mesh.h"
@@ -17,6 +19,7 @@
 #include "TransformData.h"
 #include "ActorInstance.h"
 #include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/SimdSkinning.h>
 #include <MCore/Source/AzCoreConversions.h>
 
 
@@ -28,6 +31,8 @@ namespace EMotionFX
     SoftSkinDeformer::SoftSkinDeformer(Mesh* mesh)
         : MeshDeformer(mesh)
     {
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        m_useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
     }
 
 
@@ -93,6 +98,48 @@ namespace EMotionFX
             m_boneMatrices[i] = skinningMatrices[nodeIndex];
         }
 
+        // Small meshes are skinned directly, as the overhead of spreading them across threads outweighs the gain.
+        const uint32 numVertices = m_mesh->GetNumVertices();
+        if (numVertices <= s_numVerticesPerBatch)
+        {
+            SkinMeshRange(0, numVertices);
+        }
+        else if (m_useTaskGraph && !m_taskGraph.IsEmpty())
+        {
+            // Skin the vertices by executing the task graph.
+            AZ::TaskGraphEvent finishedEvent;
+            m_taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else
+        {
+            AZ::JobCompletion jobCompletion;
+
+            // Split up the skinned vertices into batches.
+            const AZ::u32 numBatches = (numVertices + s_numVerticesPerBatch - 1) / s_numVerticesPerBatch;
+            for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+            {
+                const AZ::u32 startVertex = batchIndex * s_numVerticesPerBatch;
+                const AZ::u32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
+
+                // Create a job for every batch and skin them simultaneously.
+                AZ::JobContext* jobContext = nullptr;
+                AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex]()
+                    {
+                        SkinMeshRange(startVertex, endVertex);
+                    }, /*isAutoDelete=*/true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    }
+
+
+    void SoftSkinDeformer::SkinMeshRange(uint32 startVertex, uint32 endVertex)
+    {
         // find the skinning layer
         SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
         AZ_Assert(layer, "Cannot find skinning info");
@@ -103,7 +150,7 @@ namespace EMotionFX
         AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
         AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, m_mesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
+        SkinVertexRangeSimd(startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer);
     }
 
 
@@ -201,6 +248,155 @@ namespace EMotionFX
     }
 
 
+    namespace
+    {
+        // Skin SimdSkinning::LaneCount vertices at once. Tangents and bitangents are template parameters so that the
+        // per-batch loop does not need to branch on which vertex attributes are present.
+        template<bool SkinTangents, bool SkinBitangents>
+        void SkinVertexBatchesSimd(const AZ::Matrix3x4* boneMatrices, uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, const uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
+        {
+            using namespace SimdSkinning;
+            constexpr AZ::u32 numRows = 3;
+
+            // Lanes that have fewer influences than the others in their batch are padded with a zero weighted zero matrix.
+            static const AZ::Matrix3x4 s_zeroMatrix = AZ::Matrix3x4::CreateZero();
+
+            for (uint32 v = startVertex; v < endVertex; v += LaneCount)
+            {
+                uint32 orgVertices[LaneCount];
+                size_t numInfluences[LaneCount];
+                size_t maxNumInfluences = 0;
+                for (AZ::u32 lane = 0; lane < LaneCount; ++lane)
+                {
+                    orgVertices[lane] = orgVerts[v + lane];
+                    numInfluences[lane] = layer->GetNumInfluences(orgVertices[lane]);
+                    maxNumInfluences = AZStd::max(maxNumInfluences, numInfluences[lane]);
+                }
+
+                const Vector3Lanes vtxPos = LoadLanes(&positions[v]);
+                const Vector3Lanes normal = LoadLanes(&normals[v]);
+                Vector3Lanes tangent;
+                Vector3Lanes bitangent;
+                if constexpr (SkinTangents)
+                {
+                    tangent = LoadLanes(&tangents[v]);
+                }
+                if constexpr (SkinBitangents)
+                {
+                    bitangent = LoadLanes(&bitangents[v]);
+                }
+
+                Vector3Lanes newPos = CreateZeroLanes();
+                Vector3Lanes newNormal = CreateZeroLanes();
+                Vector3Lanes newTangent = CreateZeroLanes();
+                Vector3Lanes newBitangent = CreateZeroLanes();
+
+                for (size_t i = 0; i < maxNumInfluences; ++i)
+                {
+                    const AZ::Matrix3x4* laneMatrices[LaneCount];
+                    alignas(16) float laneWeights[LaneCount];
+                    for (AZ::u32 lane = 0; lane < LaneCount; ++lane)
+                    {
+                        if (i < numInfluences[lane])
+                        {
+                            const SkinInfluence* influence = layer->GetInfluence(orgVertices[lane], i);
+                            laneMatrices[lane] = &boneMatrices[influence->GetBoneNr()];
+                            laneWeights[lane] = influence->GetWeight();
+                        }
+                        else
+                        {
+                            laneMatrices[lane] = &s_zeroMatrix;
+                            laneWeights[lane] = 0.0f;
+                        }
+                    }
+
+                    // Gather the bone matrices of all lanes, m[row][column] holds the given matrix element for every lane.
+                    FloatType m[numRows][LaneCount];
+                    for (AZ::u32 row = 0; row < numRows; ++row)
+                    {
+                        const FloatType rows[LaneCount] =
+                        {
+                            laneMatrices[0]->GetSimdValues()[row],
+                            laneMatrices[1]->GetSimdValues()[row],
+                            laneMatrices[2]->GetSimdValues()[row],
+                            laneMatrices[3]->GetSimdValues()[row]
+                        };
+                        GatherTransposed(rows, m[row]);
+                    }
+                    const FloatType weight = Vec4::LoadAligned(laneWeights);
+
+                    // Transform a point (including translation) or a vector (rotation and scale only) by the gathered matrices.
+                    auto transformPoint = [&m](const Vector3Lanes& p) -> Vector3Lanes
+                    {
+                        return {
+                            Vec4::Madd(m[0][0], p.m_x, Vec4::Madd(m[0][1], p.m_y, Vec4::Madd(m[0][2], p.m_z, m[0][3]))),
+                            Vec4::Madd(m[1][0], p.m_x, Vec4::Madd(m[1][1], p.m_y, Vec4::Madd(m[1][2], p.m_z, m[1][3]))),
+                            Vec4::Madd(m[2][0], p.m_x, Vec4::Madd(m[2][1], p.m_y, Vec4::Madd(m[2][2], p.m_z, m[2][3])))
+                        };
+                    };
+                    auto transformVector = [&m](const Vector3Lanes& d) -> Vector3Lanes
+                    {
+                        return {
+                            Vec4::Madd(m[0][0], d.m_x, Vec4::Madd(m[0][1], d.m_y, Vec4::Mul(m[0][2], d.m_z))),
+                            Vec4::Madd(m[1][0], d.m_x, Vec4::Madd(m[1][1], d.m_y, Vec4::Mul(m[1][2], d.m_z))),
+                            Vec4::Madd(m[2][0], d.m_x, Vec4::Madd(m[2][1], d.m_y, Vec4::Mul(m[2][2], d.m_z)))
+                        };
+                    };
+
+                    MaddLanes(weight, transformPoint(vtxPos), newPos);
+                    MaddLanes(weight, transformVector(normal), newNormal);
+                    if constexpr (SkinTangents)
+                    {
+                        MaddLanes(weight, transformVector(tangent), newTangent);
+                    }
+                    if constexpr (SkinBitangents)
+                    {
+                        MaddLanes(weight, transformVector(bitangent), newBitangent);
+                    }
+                }
+
+                // output the skinned values, the tangent keeps its w component
+                StoreLanes(newPos, &positions[v]);
+                StoreLanes(newNormal, &normals[v]);
+                if constexpr (SkinTangents)
+                {
+                    StoreLanes(newTangent, &tangents[v]);
+                }
+                if constexpr (SkinBitangents)
+                {
+                    StoreLanes(newBitangent, &bitangents[v]);
+                }
+            }
+        }
+    } // namespace
+
+
+    void SoftSkinDeformer::SkinVertexRangeSimd(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
+    {
+        // Skin whole batches with the SIMD kernel and the remaining vertices with the scalar version.
+        const uint32 numVertices = endVertex - startVertex;
+        const uint32 simdEndVertex = startVertex + (numVertices / SimdSkinning::LaneCount) * SimdSkinning::LaneCount;
+
+        if (tangents && bitangents)
+        {
+            SkinVertexBatchesSimd<true, true>(m_boneMatrices.data(), startVertex, simdEndVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+        }
+        else if (tangents) // only tangents but no bitangents
+        {
+            SkinVertexBatchesSimd<true, false>(m_boneMatrices.data(), startVertex, simdEndVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+        }
+        else // there are no tangents and bitangents to skin
+        {
+            SkinVertexBatchesSimd<false, false>(m_boneMatrices.data(), startVertex, simdEndVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+        }
+
+        if (simdEndVertex < endVertex)
+        {
+            SkinVertexRange(simdEndVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+        }
+    }
+
+
     // initialize the mesh deformer
     void SoftSkinDeformer::Reinitialize(Actor* actor, Node* node, size_t lodLevel)
     {
@@ -252,5 +448,29 @@ namespace EMotionFX
                 influence->SetBoneNr(static_cast<uint16>(boneIndex));
             }
         }
+
+        m_taskGraph.Reset();
+        const uint32 numVertices = m_mesh->GetNumVertices();
+        if (m_useTaskGraph && numVertices > s_numVerticesPerBatch)
+        {
+            // Prepare the task graph
+            // Split up the to be skinned vertices into batches. As the mesh does not change at runtime, the task graph can
+            // be prepared at init time and be reused at runtime.
+            const AZ::u32 numBatches = (numVertices + s_numVerticesPerBatch - 1) / s_numVerticesPerBatch;
+            for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+            {
+                const AZ::u32 startVertex = batchIndex * s_numVerticesPerBatch;
+                const AZ::u32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
+
+                // Create a task for every batch and skin them simultaneously.
+                AZ::TaskDescriptor taskDescriptor{"SoftSkinRange", "Animation"};
+                m_taskGraph.AddTask(
+                    taskDescriptor,
+                    [this, startVertex, endVertex]()
+                    {
+                        SkinMeshRange(startVertex, endVertex);
+                    });
+            }
+        }
     }
 } // namespace EMotionFX
@@ -11,6 +11,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/Task/TaskGraph.h>
 #include "EMotionFXConfig.h"
 #include "MeshDeformer.h"
 
@@ -143,6 +144,28 @@ namespace EMotionFX
             return foundBoneIndex != end(m_nodeNumbers) ? AZStd::distance(begin(m_nodeNumbers), foundBoneIndex) : InvalidIndex;
         }
 
+        /**
+         * Skin a range of vertices one vertex at a time.
+         * This is the reference implementation and is also used for the remainder of a range that does not fill a whole SIMD batch.
+         */
         void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+
+        /**
+         * Skin a range of vertices, processing SimdSkinning::LaneCount vertices at once.
+         * The bone matrices of all influences are gathered and transposed so that every lane skins its own vertex.
+         * The results match SkinVertexRange() within floating point precision.
+         */
+        void SkinVertexRangeSimd(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+
+        /**
+         * Skin a range of vertices of the mesh the deformer works on.
+         * Used by the batches that split up skinning large meshes across worker threads.
+         */
+        void SkinMeshRange(uint32 startVertex, uint32 endVertex);
+
+        //! Number of vertices per batch/job used for multi-threaded software skinning.
+        static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
+        AZ::TaskGraph m_taskGraph;
+        bool m_useTaskGraph = true;
     };
 } // namespace EMotionFX
@@ -116,6 +116,7 @@ set(FILES
     Source/RecorderBus.h
     Source/RepositioningLayerPass.cpp
     Source/RepositioningLayerPass.h
+    Source/SimdSkinning.h
     Source/SimulatedObjectBus.h
     Source/SimulatedObjectSetup.cpp
     Source/SimulatedObjectSetup.h
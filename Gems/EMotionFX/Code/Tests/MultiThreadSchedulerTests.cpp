@@ -12,10 +12,21 @@
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/ActorManager.h>
 #include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionSystem.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <AzCore/Task/TaskGraphSystemComponent.h>
 #include <Tests/SystemComponentFixture.h>
 #include <Tests/TestAssetCode/JackActor.h>
 #include <Tests/TestAssetCode/ActorFactory.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 namespace EMotionFX
 {
     // This turned into an assert and is now being catched in the actual code. Skip this test, as we don't test and return at runtime anymore.
@@ -44,4 +55,243 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    using TaskGraphSystemComponentFixture = ComponentFixture<
+        AZ::MemoryComponent,
+        AZ::AssetManagerComponent,
+        AZ::JobManagerComponent,
+        AZ::StreamerComponent,
+        AZ::TaskGraphSystemComponent,
+        EMotionFX::Integration::SystemComponent
+    >;
+
+    // Creates a number of Jack actor instances that all play a motion rotating every joint, updated by the multi thread scheduler.
+    class MultiThreadSchedulerFixture
+        : public TaskGraphSystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            TaskGraphSystemComponentFixture::SetUp();
+
+            ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+            ASSERT_EQ(baseScheduler->GetType(), MultiThreadScheduler::TYPE_ID) << "Expected multi thread scheduler.";
+            m_scheduler = static_cast<MultiThreadScheduler*>(baseScheduler);
+
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+            m_motion = CreateMotion(*m_actor);
+        }
+
+        void TearDown() override
+        {
+            DestroyActorInstances();
+            m_motion->Destroy();
+            m_actor.reset();
+
+            TaskGraphSystemComponentFixture::TearDown();
+        }
+
+        static Motion* CreateMotion(const Actor& actor)
+        {
+            Motion* motion = aznew Motion("MultiThreadSchedulerMotion");
+            NonUniformMotionData* motionData = aznew NonUniformMotionData();
+            motion->SetMotionData(motionData);
+
+            const Pose* bindPose = actor.GetBindPose();
+            const size_t numJoints = actor.GetNumNodes();
+            for (size_t jointIndex = 0; jointIndex < numJoints; ++jointIndex)
+            {
+                const Transform& transform = bindPose->GetLocalSpaceTransform(jointIndex);
+                const size_t motionJointIndex = motionData->AddJoint(actor.GetSkeleton()->GetNode(jointIndex)->GetName(), transform, transform);
+
+                motionData->AllocateJointRotationSamples(motionJointIndex, 2);
+                motionData->SetJointRotationSample(motionJointIndex, 0, { 0.0f, transform.m_rotation });
+                motionData->SetJointRotationSample(motionJointIndex, 1, { 1.0f, transform.m_rotation * AZ::Quaternion::CreateRotationZ(0.5f) });
+            }
+
+            motion->UpdateDuration();
+            return motion;
+        }
+
+        void CreateActorInstances(size_t numActorInstances)
+        {
+            for (size_t i = 0; i < numActorInstances; ++i)
+            {
+                ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+                actorInstance->GetMotionSystem()->PlayMotion(m_motion);
+                m_actorInstances.emplace_back(actorInstance);
+            }
+        }
+
+        void DestroyActorInstances()
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+        }
+
+    protected:
+        MultiThreadScheduler* m_scheduler = nullptr;
+        AZStd::unique_ptr<JackNoMeshesActor> m_actor;
+        Motion* m_motion = nullptr;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    TEST_F(MultiThreadSchedulerFixture, TaskGraphMatchesJobs)
+    {
+        constexpr size_t numActorInstances = 32;
+        constexpr size_t numFrames = 20;
+        constexpr float timeDelta = 1.0f / 60.0f;
+
+        AZStd::vector<AZStd::vector<Transform>> modelSpaceTransformsPerPath;
+        for (const bool useTaskGraph : { false, true })
+        {
+            m_scheduler->SetUseTaskGraph(useTaskGraph);
+            EXPECT_EQ(m_scheduler->GetUseTaskGraph(), useTaskGraph);
+
+            CreateActorInstances(numActorInstances);
+            for (size_t frame = 0; frame < numFrames; ++frame)
+            {
+                m_scheduler->Execute(timeDelta);
+            }
+            EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), numActorInstances);
+
+            AZStd::vector<Transform>& modelSpaceTransforms = modelSpaceTransformsPerPath.emplace_back();
+            for (const ActorInstance* actorInstance : m_actorInstances)
+            {
+                const Pose* pose = actorInstance->GetTransformData()->GetCurrentPose();
+                for (size_t jointIndex = 0; jointIndex < pose->GetNumTransforms(); ++jointIndex)
+                {
+                    modelSpaceTransforms.emplace_back(pose->GetModelSpaceTransform(jointIndex));
+                }
+            }
+            DestroyActorInstances();
+        }
+
+        ASSERT_EQ(modelSpaceTransformsPerPath[0].size(), modelSpaceTransformsPerPath[1].size());
+        for (size_t i = 0; i < modelSpaceTransformsPerPath[0].size(); ++i)
+        {
+            EXPECT_THAT(modelSpaceTransformsPerPath[1][i], IsClose(modelSpaceTransformsPerPath[0][i]));
+        }
+    }
+
+    TEST_F(MultiThreadSchedulerFixture, TaskGraphFollowsScheduleChanges)
+    {
+        m_scheduler->SetUseTaskGraph(true);
+
+        CreateActorInstances(4);
+        m_scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 4);
+
+        // Removing and adding actor instances needs to rebuild the task graph.
+        m_actorInstances.back()->Destroy();
+        m_actorInstances.pop_back();
+        m_scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 3);
+
+        CreateActorInstances(2);
+        m_scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 5);
+
+        // Disabled actor instances are skipped without rebuilding the graph.
+        m_actorInstances[0]->SetIsEnabled(false);
+        m_scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 4);
+    }
+
+    TEST_F(MultiThreadSchedulerFixture, StageTimings)
+    {
+        CreateActorInstances(8);
+
+        m_scheduler->SetStageTimingEnabled(true);
+        m_scheduler->Execute(1.0f / 60.0f);
+
+        const MultiThreadScheduler::StageTimings& stageTimings = m_scheduler->GetStageTimings();
+        EXPECT_GT(stageTimings.m_totalMs, 0.0f);
+        EXPECT_GT(stageTimings.m_motionSamplingMs, 0.0f);
+        EXPECT_GE(stageTimings.m_animGraphUpdateMs, 0.0f);
+        EXPECT_GE(stageTimings.m_deformerUpdateMs, 0.0f);
+        EXPECT_GE(stageTimings.m_attachmentsMs, 0.0f);
+        EXPECT_GE(stageTimings.m_boundsMs, 0.0f);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    // Updates 500 animated characters per iteration, once through the job based update and once through the task graph.
+    class MultiThreadSchedulerBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        // The component fixture is a gtest fixture, it is only reused here to bring up the EMotionFX runtime.
+        class Environment
+            : public MultiThreadSchedulerFixture
+        {
+        public:
+            void TestBody() override {}
+        };
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            m_environment = AZStd::make_unique<Environment>();
+            m_environment->SetUp();
+            m_environment->CreateActorInstances(aznumeric_cast<size_t>(state.range(0)));
+        }
+
+        void internalTearDown([[maybe_unused]] const ::benchmark::State& state)
+        {
+            m_environment->TearDown();
+            m_environment.reset();
+        }
+
+        void Run(::benchmark::State& state, bool useTaskGraph)
+        {
+            MultiThreadScheduler* scheduler = static_cast<MultiThreadScheduler*>(GetEMotionFX().GetActorManager()->GetScheduler());
+            scheduler->SetUseTaskGraph(useTaskGraph);
+
+            // warm up the pose pools and build the task graph before measuring
+            scheduler->Execute(1.0f / 60.0f);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                scheduler->Execute(1.0f / 60.0f);
+            }
+
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+    protected:
+        AZStd::unique_ptr<Environment> m_environment;
+    };
+
+    BENCHMARK_DEFINE_F(MultiThreadSchedulerBenchmarkFixture, Jobs)(::benchmark::State& state)
+    {
+        Run(state, /*useTaskGraph=*/false);
+    }
+    BENCHMARK_REGISTER_F(MultiThreadSchedulerBenchmarkFixture, Jobs)->Arg(500)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(MultiThreadSchedulerBenchmarkFixture, TaskGraph)(::benchmark::State& state)
+    {
+        Run(state, /*useTaskGraph=*/true);
+    }
+    BENCHMARK_REGISTER_F(MultiThreadSchedulerBenchmarkFixture, TaskGraph)->Arg(500)->Unit(benchmark::kMillisecond);
+#endif // HAVE_BENCHMARK
 } // namespace EMotionFX
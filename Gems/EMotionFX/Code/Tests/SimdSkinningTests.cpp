@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Random.h>
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/DualQuatSkinDeformer.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
+#include <MCore/Source/MCoreSystem.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/MeshFactory.h>
+
+namespace EMotionFX
+{
+    // Exposes the scalar and SIMD skinning paths of the deformers.
+    class TestSoftSkinDeformer
+        : public SoftSkinDeformer
+    {
+    public:
+        explicit TestSoftSkinDeformer(Mesh* mesh)
+            : SoftSkinDeformer(mesh)
+        {
+        }
+
+        using SoftSkinDeformer::SkinVertexRange;
+        using SoftSkinDeformer::SkinVertexRangeSimd;
+
+        void SetBoneMatrices(const AZStd::vector<AZ::Matrix3x4>& boneMatrices)
+        {
+            for (size_t i = 0; i < m_boneMatrices.size(); ++i)
+            {
+                m_boneMatrices[i] = boneMatrices[m_nodeNumbers[i]];
+            }
+        }
+
+        void Skin(bool useSimd)
+        {
+            SkinningInfoVertexAttributeLayer* layer = static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+            AZ::Vector3* positions = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+            AZ::Vector3* normals = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+            AZ::Vector4* tangents = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+            AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+            AZ::u32* orgVerts = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+            if (useSimd)
+            {
+                SkinVertexRangeSimd(0, m_mesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
+            }
+            else
+            {
+                SkinVertexRange(0, m_mesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
+            }
+        }
+    };
+
+    class TestDualQuatSkinDeformer
+        : public DualQuatSkinDeformer
+    {
+    public:
+        explicit TestDualQuatSkinDeformer(Mesh* mesh)
+            : DualQuatSkinDeformer(mesh)
+        {
+        }
+
+        void SetBoneTransforms(const AZStd::vector<AZ::Quaternion>& rotations, const AZStd::vector<AZ::Vector3>& translations)
+        {
+            for (BoneInfo& boneInfo : m_bones)
+            {
+                boneInfo.m_dualQuat.FromRotationTranslation(rotations[boneInfo.m_nodeNr], translations[boneInfo.m_nodeNr]);
+            }
+        }
+
+        void Skin(bool useSimd)
+        {
+            if (useSimd)
+            {
+                SkinRangeSimd(m_mesh, 0, m_mesh->GetNumVertices(), m_bones);
+            }
+            else
+            {
+                SkinRange(m_mesh, 0, m_mesh->GetNumVertices(), m_bones);
+            }
+        }
+    };
+
+    // Create a triangle soup with random positions and normals, where each vertex is influenced by zero to four random bones.
+    static Mesh* CreateRandomSkinnedMesh(AZ::u32 numVertices, size_t numBones, bool withTangents, AZ::SimpleLcgRandom& random)
+    {
+        auto randomFloat = [&random](float min, float max)
+        {
+            return min + random.GetRandomFloat() * (max - min);
+        };
+
+        AZStd::vector<AZ::u32> indices(numVertices);
+        AZStd::vector<AZ::Vector3> positions(numVertices);
+        AZStd::vector<AZ::Vector3> normals(numVertices);
+        AZStd::vector<AZ::Vector2> uvs(numVertices);
+        AZStd::vector<MeshFactory::VertexSkinInfluences> skinningInfo(numVertices);
+        for (AZ::u32 i = 0; i < numVertices; ++i)
+        {
+            indices[i] = i;
+            positions[i].Set(randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f));
+            normals[i] = AZ::Vector3(randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f)).GetNormalizedSafe();
+            uvs[i].Set(randomFloat(0.0f, 1.0f), randomFloat(0.0f, 1.0f));
+
+            // Mix vertices without influences and with up to four influences into the same batches.
+            const size_t numInfluences = random.GetRandom() % 5;
+            float totalWeight = 0.0f;
+            for (size_t j = 0; j < numInfluences; ++j)
+            {
+                const float weight = randomFloat(0.1f, 1.0f);
+                skinningInfo[i].emplace_back(random.GetRandom() % numBones, weight);
+                totalWeight += weight;
+            }
+            for (MeshFactory::SkinInfluence& influence : skinningInfo[i])
+            {
+                AZStd::get<1>(influence) /= totalWeight;
+            }
+        }
+
+        Mesh* mesh = MeshFactory::Create(indices, positions, normals, uvs, skinningInfo);
+        if (withTangents)
+        {
+            mesh->CalcTangents(/*uvSet=*/0, /*storeBitangents=*/true);
+        }
+        return mesh;
+    }
+
+    // The parameter selects whether the mesh has tangents and bitangents.
+    class SimdSkinningFixture
+        : public SystemComponentFixture
+        , public ::testing::WithParamInterface<bool>
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            AZ::SimpleLcgRandom random(1234);
+            auto randomFloat = [&random](float min, float max)
+            {
+                return min + random.GetRandomFloat() * (max - min);
+            };
+
+            // Use a vertex count that is not a multiple of the SIMD batch size, so that the scalar remainder gets skinned as well.
+            m_scalarMesh = CreateRandomSkinnedMesh(3 * 335, s_numBones, GetParam(), random);
+            m_simdMesh = m_scalarMesh->Clone();
+
+            for (size_t i = 0; i < s_numBones; ++i)
+            {
+                const AZ::Quaternion rotation = AZ::Quaternion(randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f)).GetNormalized();
+                const AZ::Vector3 translation(randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f), randomFloat(-1.0f, 1.0f));
+                m_rotations.emplace_back(rotation);
+                m_translations.emplace_back(translation);
+                m_boneMatrices.emplace_back(AZ::Matrix3x4::CreateFromQuaternionAndTranslation(rotation, translation));
+            }
+        }
+
+        void TearDown() override
+        {
+            m_scalarMesh->Destroy();
+            m_simdMesh->Destroy();
+            SystemComponentFixture::TearDown();
+        }
+
+        void ExpectMatchingMeshes() const
+        {
+            const AZ::u32 numVertices = m_scalarMesh->GetNumVertices();
+            ASSERT_EQ(numVertices, m_simdMesh->GetNumVertices());
+
+            const AZ::Vector3* scalarPositions = static_cast<AZ::Vector3*>(m_scalarMesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+            const AZ::Vector3* simdPositions = static_cast<AZ::Vector3*>(m_simdMesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+            const AZ::Vector3* scalarNormals = static_cast<AZ::Vector3*>(m_scalarMesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+            const AZ::Vector3* simdNormals = static_cast<AZ::Vector3*>(m_simdMesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+            for (AZ::u32 i = 0; i < numVertices; ++i)
+            {
+                EXPECT_THAT(simdPositions[i], IsClose(scalarPositions[i])) << "Vertex " << i;
+                EXPECT_THAT(simdNormals[i], IsClose(scalarNormals[i])) << "Vertex " << i;
+            }
+
+            const AZ::Vector4* scalarTangents = static_cast<AZ::Vector4*>(m_scalarMesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+            const AZ::Vector4* simdTangents = static_cast<AZ::Vector4*>(m_simdMesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+            const AZ::Vector3* scalarBitangents = static_cast<AZ::Vector3*>(m_scalarMesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+            const AZ::Vector3* simdBitangents = static_cast<AZ::Vector3*>(m_simdMesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+            ASSERT_EQ(scalarTangents != nullptr, GetParam());
+            ASSERT_EQ(scalarBitangents != nullptr, GetParam());
+            if (GetParam())
+            {
+                for (AZ::u32 i = 0; i < numVertices; ++i)
+                {
+                    EXPECT_THAT(simdTangents[i], IsClose(scalarTangents[i])) << "Vertex " << i;
+                    EXPECT_THAT(simdBitangents[i], IsClose(scalarBitangents[i])) << "Vertex " << i;
+                }
+            }
+        }
+
+        static constexpr size_t s_numBones = 16;
+        Mesh* m_scalarMesh = nullptr;
+        Mesh* m_simdMesh = nullptr;
+        AZStd::vector<AZ::Quaternion> m_rotations;
+        AZStd::vector<AZ::Vector3> m_translations;
+        AZStd::vector<AZ::Matrix3x4> m_boneMatrices;
+    };
+
+    TEST_P(SimdSkinningFixture, SoftSkinSimdMatchesScalar)
+    {
+        TestSoftSkinDeformer* scalarDeformer = aznew TestSoftSkinDeformer(m_scalarMesh);
+        TestSoftSkinDeformer* simdDeformer = aznew TestSoftSkinDeformer(m_simdMesh);
+        scalarDeformer->Reinitialize(nullptr, nullptr, 0);
+        simdDeformer->Reinitialize(nullptr, nullptr, 0);
+        scalarDeformer->SetBoneMatrices(m_boneMatrices);
+        simdDeformer->SetBoneMatrices(m_boneMatrices);
+
+        scalarDeformer->Skin(/*useSimd=*/false);
+        simdDeformer->Skin(/*useSimd=*/true);
+        ExpectMatchingMeshes();
+
+        scalarDeformer->Destroy();
+        simdDeformer->Destroy();
+    }
+
+    TEST_P(SimdSkinningFixture, DualQuatSkinSimdMatchesScalar)
+    {
+        TestDualQuatSkinDeformer* scalarDeformer = aznew TestDualQuatSkinDeformer(m_scalarMesh);
+        TestDualQuatSkinDeformer* simdDeformer = aznew TestDualQuatSkinDeformer(m_simdMesh);
+        scalarDeformer->Reinitialize(nullptr, nullptr, 0);
+        simdDeformer->Reinitialize(nullptr, nullptr, 0);
+        scalarDeformer->SetBoneTransforms(m_rotations, m_translations);
+        simdDeformer->SetBoneTransforms(m_rotations, m_translations);
+
+        scalarDeformer->Skin(/*useSimd=*/false);
+        simdDeformer->Skin(/*useSimd=*/true);
+        ExpectMatchingMeshes();
+
+        scalarDeformer->Destroy();
+        simdDeformer->Destroy();
+    }
+
+    INSTANTIATE_TEST_CASE_P(SimdSkinningTests, SimdSkinningFixture, ::testing::Bool());
+
+#if defined(HAVE_BENCHMARK)
+    // Measures the CPU skinning throughput in vertices per second for the scalar and the SIMD kernels.
+    class SkinningBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            MCore::Initializer::Init();
+            Allocators::Create();
+
+            AZ::SimpleLcgRandom random(1234);
+            m_mesh = CreateRandomSkinnedMesh(aznumeric_cast<AZ::u32>(state.range(0)), s_numBones, /*withTangents=*/true, random);
+
+            for (size_t i = 0; i < s_numBones; ++i)
+            {
+                const AZ::Quaternion rotation = AZ::Quaternion(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()).GetNormalized();
+                const AZ::Vector3 translation(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat());
+                m_rotations.emplace_back(rotation);
+                m_translations.emplace_back(translation);
+                m_boneMatrices.emplace_back(AZ::Matrix3x4::CreateFromQuaternionAndTranslation(rotation, translation));
+            }
+        }
+
+        void internalTearDown(const ::benchmark::State& state)
+        {
+            m_mesh->Destroy();
+            m_rotations = {};
+            m_translations = {};
+            m_boneMatrices = {};
+
+            Allocators::Destroy();
+            MCore::Initializer::Shutdown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RunSoftSkin(::benchmark::State& state, bool useSimd)
+        {
+            TestSoftSkinDeformer* deformer = aznew TestSoftSkinDeformer(m_mesh);
+            deformer->Reinitialize(nullptr, nullptr, 0);
+            deformer->SetBoneMatrices(m_boneMatrices);
+            for ([[maybe_unused]] auto _ : state)
+            {
+                deformer->Skin(useSimd);
+                benchmark::ClobberMemory();
+            }
+            state.SetItemsProcessed(state.iterations() * m_mesh->GetNumVertices());
+            deformer->Destroy();
+        }
+
+        void RunDualQuatSkin(::benchmark::State& state, bool useSimd)
+        {
+            TestDualQuatSkinDeformer* deformer = aznew TestDualQuatSkinDeformer(m_mesh);
+            deformer->Reinitialize(nullptr, nullptr, 0);
+            deformer->SetBoneTransforms(m_rotations, m_translations);
+            for ([[maybe_unused]] auto _ : state)
+            {
+                deformer->Skin(useSimd);
+                benchmark::ClobberMemory();
+            }
+            state.SetItemsProcessed(state.iterations() * m_mesh->GetNumVertices());
+            deformer->Destroy();
+        }
+
+        static constexpr size_t s_numBones = 64;
+        Mesh* m_mesh = nullptr;
+        AZStd::vector<AZ::Quaternion> m_rotations;
+        AZStd::vector<AZ::Vector3> m_translations;
+        AZStd::vector<AZ::Matrix3x4> m_boneMatrices;
+    };
+
+    BENCHMARK_DEFINE_F(SkinningBenchmarkFixture, SoftSkinScalar)(benchmark::State& state)
+    {
+        RunSoftSkin(state, /*useSimd=*/false);
+    }
+
+    BENCHMARK_DEFINE_F(SkinningBenchmarkFixture, SoftSkinSimd)(benchmark::State& state)
+    {
+        RunSoftSkin(state, /*useSimd=*/true);
+    }
+
+    BENCHMARK_DEFINE_F(SkinningBenchmarkFixture, DualQuatSkinScalar)(benchmark::State& state)
+    {
+        RunDualQuatSkin(state, /*useSimd=*/false);
+    }
+
+    BENCHMARK_DEFINE_F(SkinningBenchmarkFixture, DualQuatSkinSimd)(benchmark::State& state)
+    {
+        RunDualQuatSkin(state, /*useSimd=*/true);
+    }
+
+    BENCHMARK_REGISTER_F(SkinningBenchmarkFixture, SoftSkinScalar)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(SkinningBenchmarkFixture, SoftSkinSimd)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(SkinningBenchmarkFixture, DualQuatSkinScalar)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(SkinningBenchmarkFixture, DualQuatSkinSimd)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+#endif // HAVE_BENCHMARK
+} // namespace EMotionFX
@@ -103,6 +103,7 @@ set(FILES
     Tests/RandomMotionSelectionTests.cpp
     Tests/RenderBackendManagerTests.cpp
     Tests/SelectionListTests.cpp
+    Tests/SimdSkinningTests.cpp
     Tests/SimpleMotionComponentBusTests.cpp
     Tests/SimulatedObjectCommandTests.cpp
     Tests/SimulatedObjectSerializeTests.cpp
@@ -339,6 +339,11 @@ public: // member functions
     //! cleared and rebuilt on the next render.
     virtual void MarkRenderGraphDirty() = 0;
 
+    //! Mark the render graph for the canvas as dirty for a single element. On the next render only
+    //! this element, its children and its ancestors are rendered again, what all other elements
+    //! rendered is retained in the render graph.
+    virtual void MarkRenderGraphDirtyForElement(AZ::EntityId elementId) = 0;
+
 public: // static member data
 
     //! Only one component on an entity can implement the events
@@ -24,7 +24,8 @@ namespace LyShine
     // UI visual components use this interface to add primitives to the render graph, which is how the
     // UI gets rendered.
     // There is one render graph per UI canvas. The render graph (like a display list) is rebuilt when
-    // any visual change occurs on the canvas.
+    // any visual change occurs on the canvas. The primitives added by elements that did not change are
+    // retained between builds.
     class IRenderGraph
     {
     public:
@@ -34,6 +35,14 @@ namespace LyShine
 
         //---- Functions for creating and adding primitives to the render graph ----
 
+        //! Begin rendering an element and its children. Returns true if the graph replayed the primitives that were
+        //! added by the element and its children in the previous build, in which case the element must not render
+        //! and must not call EndElement.
+        virtual bool BeginElement(AZ::EntityId elementId) = 0;
+
+        //! End rendering an element and its children
+        virtual void EndElement() = 0;
+
         //! Begin the setup of a mask render node, primitives added between this call and StartChildrenForMask define the mask
         virtual void BeginMask(bool isMaskingEnabled, bool useAlphaTest, bool drawBehind, bool drawInFront) = 0;
 
@@ -58,6 +58,7 @@ public: // static member functions
         int m_numNodesDueToSrgb;
         int m_numNodesDueToMaxVerts;
         int m_numNodesDueToTextures;
+        int m_numReplayedElements;
         bool m_wasBuiltThisFrame;
         AZ::u64 m_timeGraphLastBuiltMs;
         bool m_isReusingRenderTargets;
@@ -584,6 +584,41 @@ namespace LyShine
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::ResetGraph()
+    {
+        ClearRenderNodes();
+
+        // clear and delete the dynamic quads
+        for (DynamicQuad* quad : m_dynamicQuads)
+        {
+            delete quad;
+        }
+        m_dynamicQuads.clear();
+        for (DynamicQuad* quad : m_previousDynamicQuads)
+        {
+            // replayed quads were moved to m_dynamicQuads
+            if (!quad->m_isReplayed)
+            {
+                delete quad;
+            }
+        }
+        m_previousDynamicQuads.clear();
+
+        // clear the retained commands, so every element is rendered again on the next build
+        m_commands.clear();
+        m_elementRecords.clear();
+        m_openElements.clear();
+        m_previousCommands.clear();
+        m_previousElementRecords.clear();
+        m_previousElementRecordIndices.clear();
+        m_invalidatedElements.clear();
+        m_invalidatedAncestors.clear();
+        m_invalidatedElementNestLevel = 0;
+
+        m_isDirty = true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::ClearRenderNodes()
     {
         // clear and delete the list of render target nodes
         for (RenderNode* renderNode : m_renderTargetRenderNodes)
@@ -599,13 +634,6 @@ namespace LyShine
         }
         m_renderNodes.clear();
 
-        // clear and delete the dynamic quads
-        for (DynamicQuad* quad : m_dynamicQuads)
-        {
-            delete quad;
-        }
-        m_dynamicQuads.clear();
-
         m_currentMask = nullptr;
         m_currentRenderTarget = nullptr;
 
@@ -616,7 +644,6 @@ namespace LyShine
         }
         m_renderNodeListStack.push(&m_renderNodes);
 
-        m_isDirty = true;
         m_renderToRenderTargetCount = 0;
 
 #ifndef _RELEASE  
@@ -625,9 +652,210 @@ namespace LyShine
 #endif
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::BeginBuild()
+    {
+        ClearRenderNodes();
+
+        // The commands of the last build become the previous commands that elements can replay. The dynamic
+        // quads are kept alive until the end of the build since replayed commands can reference them.
+        for (DynamicQuad* quad : m_previousDynamicQuads)
+        {
+            delete quad;
+        }
+        m_previousDynamicQuads.swap(m_dynamicQuads);
+        m_dynamicQuads.clear();
+        for (DynamicQuad* quad : m_previousDynamicQuads)
+        {
+            quad->m_isReplayed = false;
+        }
+
+        m_previousCommands.swap(m_commands);
+        m_commands.clear();
+        m_previousElementRecords.swap(m_elementRecords);
+        m_elementRecords.clear();
+        m_openElements.clear();
+
+        m_previousElementRecordIndices.clear();
+        for (uint32 recordIndex = 0; recordIndex < m_previousElementRecords.size(); ++recordIndex)
+        {
+            m_previousElementRecordIndices.emplace(m_previousElementRecords[recordIndex].m_elementId, recordIndex);
+        }
+
+        m_invalidatedElementNestLevel = 0;
+        m_numReplayedElements = 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::InvalidateElement(AZ::EntityId elementId)
+    {
+        // the render nodes reference primitives owned by the components on the element, the graph can't be rendered
+        // again until it is rebuilt
+        if (!m_isDirty)
+        {
+            ClearRenderNodes();
+            m_isDirty = true;
+        }
+
+        m_invalidatedElements.insert(elementId);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::InvalidateAncestorOfElement(AZ::EntityId elementId)
+    {
+        return m_invalidatedAncestors.insert(elementId).second;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::BeginElement(AZ::EntityId elementId)
+    {
+        const bool isInvalidated = m_invalidatedElements.count(elementId) > 0;
+
+        // Children of invalidated elements are always rendered, since they can depend on state of the invalidated
+        // element, e.g. the alpha fade of a fader
+        if (!isInvalidated && m_invalidatedElementNestLevel == 0 && m_invalidatedAncestors.count(elementId) == 0)
+        {
+            auto recordIter = m_previousElementRecordIndices.find(elementId);
+            if (recordIter != m_previousElementRecordIndices.end())
+            {
+                ReplayElement(recordIter->second);
+                return true;
+            }
+        }
+
+        if (isInvalidated)
+        {
+            ++m_invalidatedElementNestLevel;
+        }
+
+        OpenElement openElement;
+        openElement.m_recordIndex = aznumeric_cast<uint32>(m_elementRecords.size());
+        openElement.m_isInvalidated = isInvalidated;
+        m_openElements.push_back(openElement);
+
+        ElementRecord& record = m_elementRecords.emplace_back();
+        record.m_elementId = elementId;
+        record.m_firstCommand = aznumeric_cast<uint32>(m_commands.size());
+        return false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::EndElement()
+    {
+        AZ_Assert(!m_openElements.empty(), "Calling EndElement without a matching BeginElement");
+        if (!m_openElements.empty())
+        {
+            const OpenElement& openElement = m_openElements.back();
+            ElementRecord& record = m_elementRecords[openElement.m_recordIndex];
+            record.m_endCommand = aznumeric_cast<uint32>(m_commands.size());
+            record.m_endRecord = aznumeric_cast<uint32>(m_elementRecords.size());
+
+            if (openElement.m_isInvalidated)
+            {
+                --m_invalidatedElementNestLevel;
+            }
+            m_openElements.pop_back();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    RenderGraph::RenderCommand* RenderGraph::RecordCommand(RenderCommandType type)
+    {
+        if (m_isReplaying)
+        {
+            return nullptr;
+        }
+
+        RenderCommand& command = m_commands.emplace_back();
+        command.m_type = type;
+        return &command;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::ReplayElement(uint32 previousRecordIndex)
+    {
+        const ElementRecord& previousRecord = m_previousElementRecords[previousRecordIndex];
+
+        // Move the records of the element and its children, adjusting them to where the commands are moved to
+        const uint32 commandOffset = aznumeric_cast<uint32>(m_commands.size());
+        const uint32 recordOffset = aznumeric_cast<uint32>(m_elementRecords.size());
+        for (uint32 recordIndex = previousRecordIndex; recordIndex < previousRecord.m_endRecord; ++recordIndex)
+        {
+            ElementRecord record = m_previousElementRecords[recordIndex];
+            record.m_firstCommand = record.m_firstCommand - previousRecord.m_firstCommand + commandOffset;
+            record.m_endCommand = record.m_endCommand - previousRecord.m_firstCommand + commandOffset;
+            record.m_endRecord = record.m_endRecord - previousRecordIndex + recordOffset;
+            m_elementRecords.push_back(record);
+        }
+
+        m_isReplaying = true;
+        m_commands.reserve(m_commands.size() + previousRecord.m_endCommand - previousRecord.m_firstCommand);
+        for (uint32 commandIndex = previousRecord.m_firstCommand; commandIndex < previousRecord.m_endCommand; ++commandIndex)
+        {
+            RenderCommand& command = m_previousCommands[commandIndex];
+            switch (command.m_type)
+            {
+            case RenderCommandType::AddPrimitive:
+                AddPrimitive(command.m_primitive, command.m_texture,
+                    command.m_flags[0], command.m_flags[1], command.m_flags[2], command.m_blendMode);
+                break;
+            case RenderCommandType::AddAlphaMaskPrimitive:
+                AddAlphaMaskPrimitive(command.m_primitive, command.m_attachmentImage, command.m_maskAttachmentImage,
+                    command.m_flags[0], command.m_flags[1], command.m_flags[2], command.m_blendMode);
+                break;
+            case RenderCommandType::DynamicQuad:
+                // the quad was allocated by the previous build, it is now owned by this one
+                command.m_dynamicQuad->m_isReplayed = true;
+                m_dynamicQuads.push_back(command.m_dynamicQuad);
+                break;
+            case RenderCommandType::BeginMask:
+                BeginMask(command.m_flags[0], command.m_flags[1], command.m_flags[2], command.m_flags[3]);
+                break;
+            case RenderCommandType::StartChildrenForMask:
+                StartChildrenForMask();
+                break;
+            case RenderCommandType::EndMask:
+                EndMask();
+                break;
+            case RenderCommandType::BeginRenderToTexture:
+                BeginRenderToTexture(command.m_attachmentImage, command.m_viewportTopLeft, command.m_viewportSize, command.m_clearColor);
+                break;
+            case RenderCommandType::EndRenderToTexture:
+                EndRenderToTexture();
+                break;
+            case RenderCommandType::SetIsRenderingToMask:
+                SetIsRenderingToMask(command.m_flags[0]);
+                break;
+            case RenderCommandType::PushAlphaFade:
+                PushAlphaFade(command.m_alphaFade);
+                break;
+            case RenderCommandType::PushOverrideAlphaFade:
+                PushOverrideAlphaFade(command.m_alphaFade);
+                break;
+            case RenderCommandType::PopAlphaFade:
+                PopAlphaFade();
+                break;
+            }
+
+            m_commands.push_back(AZStd::move(command));
+        }
+        m_isReplaying = false;
+
+        // count the element and all of its children
+        m_numReplayedElements += aznumeric_cast<int>(previousRecord.m_endRecord - previousRecordIndex);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::BeginMask(bool isMaskingEnabled, bool useAlphaTest, bool drawBehind, bool drawInFront)
     {
+        if (RenderCommand* command = RecordCommand(RenderCommandType::BeginMask))
+        {
+            command->m_flags[0] = isMaskingEnabled;
+            command->m_flags[1] = useAlphaTest;
+            command->m_flags[2] = drawBehind;
+            command->m_flags[3] = drawInFront;
+        }
+
         // this uses pool allocator
         MaskRenderNode* maskRenderNode = new MaskRenderNode(m_currentMask, isMaskingEnabled, useAlphaTest, drawBehind, drawInFront);
 
@@ -638,6 +866,8 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::StartChildrenForMask()
     {
+        RecordCommand(RenderCommandType::StartChildrenForMask);
+
         AZ_Assert(m_currentMask, "Calling StartChildrenForMask while not defining a mask");
         m_renderNodeListStack.pop();
         m_renderNodeListStack.push(&m_currentMask->GetContentRenderNodeList());
@@ -646,6 +876,8 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::EndMask()
     {
+        RecordCommand(RenderCommandType::EndMask);
+
         AZ_Assert(m_currentMask, "Calling EndMask while not defining a mask");
         if (m_currentMask)
         {
@@ -672,6 +904,14 @@ namespace LyShine
     void RenderGraph::BeginRenderToTexture(AZ::Data::Instance<AZ::RPI::AttachmentImage> attachmentImage,
         const AZ::Vector2& viewportTopLeft, const AZ::Vector2& viewportSize, const AZ::Color& clearColor)
     {
+        if (RenderCommand* command = RecordCommand(RenderCommandType::BeginRenderToTexture))
+        {
+            command->m_attachmentImage = attachmentImage;
+            command->m_viewportTopLeft = viewportTopLeft;
+            command->m_viewportSize = viewportSize;
+            command->m_clearColor = clearColor;
+        }
+
         // this uses pool allocator
         RenderTargetRenderNode* renderTargetRenderNode = new RenderTargetRenderNode(
             m_currentRenderTarget, attachmentImage,
@@ -685,6 +925,8 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::EndRenderToTexture()
     {
+        RecordCommand(RenderCommandType::EndRenderToTexture);
+
         AZ_Assert(m_currentRenderTarget, "Calling EndRenderToTexture while not defining a render target node");
         if (m_currentRenderTarget)
         {
@@ -704,6 +946,16 @@ namespace LyShine
     void RenderGraph::AddPrimitive(LyShine::UiPrimitive* primitive, const AZ::Data::Instance<AZ::RPI::Image>& texture,
         bool isClampTextureMode, bool isTextureSRGB, bool isTexturePremultipliedAlpha, BlendMode blendMode)
     {
+        if (RenderCommand* command = RecordCommand(RenderCommandType::AddPrimitive))
+        {
+            command->m_primitive = primitive;
+            command->m_texture = texture;
+            command->m_flags[0] = isClampTextureMode;
+            command->m_flags[1] = isTextureSRGB;
+            command->m_flags[2] = isTexturePremultipliedAlpha;
+            command->m_blendMode = blendMode;
+        }
+
         AZStd::vector<RenderNode*>* renderNodeList = m_renderNodeListStack.top();
 
         int texUnit = -1;
@@ -782,6 +1034,17 @@ namespace LyShine
         bool isTexturePremultipliedAlpha,
         BlendMode blendMode)
     {
+        if (RenderCommand* command = RecordCommand(RenderCommandType::AddAlphaMaskPrimitive))
+        {
+            command->m_primitive = primitive;
+            command->m_attachmentImage = contentAttachmentImage;
+            command->m_maskAttachmentImage = maskAttachmentImage;
+            command->m_flags[0] = isClampTextureMode;
+            command->m_flags[1] = isTextureSRGB;
+            command->m_flags[2] = isTexturePremultipliedAlpha;
+            command->m_blendMode = blendMode;
+        }
+
         AZStd::vector<RenderNode*>* renderNodeList = m_renderNodeListStack.top();
 
         int texUnit0 = -1;
@@ -887,6 +1150,11 @@ namespace LyShine
 
         m_dynamicQuads.push_back(quad);
 
+        if (RenderCommand* command = RecordCommand(RenderCommandType::DynamicQuad))
+        {
+            command->m_dynamicQuad = quad;
+        }
+
         return &quad->m_primitive;
     }
 
@@ -899,12 +1167,22 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::SetIsRenderingToMask(bool isRenderingToMask)
     {
+        if (RenderCommand* command = RecordCommand(RenderCommandType::SetIsRenderingToMask))
+        {
+            command->m_flags[0] = isRenderingToMask;
+        }
+
         m_isRenderingToMask = isRenderingToMask;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::PushAlphaFade(float alphaFadeValue)
     {
+        if (RenderCommand* command = RecordCommand(RenderCommandType::PushAlphaFade))
+        {
+            command->m_alphaFade = alphaFadeValue;
+        }
+
         float currentAlphaFade = GetAlphaFade();
         m_alphaFadeStack.push(alphaFadeValue * currentAlphaFade);
     }
@@ -912,12 +1190,19 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::PushOverrideAlphaFade(float alphaFadeValue)
     {
+        if (RenderCommand* command = RecordCommand(RenderCommandType::PushOverrideAlphaFade))
+        {
+            command->m_alphaFade = alphaFadeValue;
+        }
+
         m_alphaFadeStack.push(alphaFadeValue);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::PopAlphaFade()
     {
+        RecordCommand(RenderCommandType::PopAlphaFade);
+
         if (!m_alphaFadeStack.empty())
         {
             m_alphaFadeStack.pop();
@@ -983,16 +1268,15 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::SetDirtyFlag(bool isDirty)
     {
-        if (m_isDirty != isDirty)
+        // When the graph first becomes dirty it must be reset since an element may have been deleted
+        // and the graph contains pointers to DynUiPrimitives owned by components on elements.
+        // The graph can already be dirty because of invalidated elements, in which case the retained commands
+        // must be reset as well.
+        if (isDirty && (!m_isDirty || !m_commands.empty()))
         {
-            if (isDirty)
-            {
-                // when graph first becomes dirty it must be reset since an element may have been deleted
-                // and the graph contains pointers to DynUiPrimitives owned by components on elements.
-                ResetGraph();
-            }
-            m_isDirty = isDirty;
+            ResetGraph();
         }
+        m_isDirty = isDirty;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1004,6 +1288,23 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::FinalizeGraph()
     {
+        AZ_Assert(m_openElements.empty(), "Calling FinalizeGraph while an element is being rendered");
+
+        // free what was retained from the previous build and not replayed
+        for (DynamicQuad* quad : m_previousDynamicQuads)
+        {
+            if (!quad->m_isReplayed)
+            {
+                delete quad;
+            }
+        }
+        m_previousDynamicQuads.clear();
+        m_previousCommands.clear();
+        m_previousElementRecords.clear();
+        m_previousElementRecordIndices.clear();
+        m_invalidatedElements.clear();
+        m_invalidatedAncestors.clear();
+
         // sort the render targets so that more deeply nested ones are rendered first
         std::sort(m_renderTargetRenderNodes.begin(), m_renderTargetRenderNodes.end(),
             RenderTargetRenderNode::CompareNestLevelForSort);
@@ -1065,6 +1366,7 @@ namespace LyShine
         info.m_numNodesDueToSrgb = 0;
         info.m_numNodesDueToMaxVerts = 0;
         info.m_numNodesDueToTextures = 0;
+        info.m_numReplayedElements = m_numReplayedElements;
         info.m_wasBuiltThisFrame = m_wasBuiltThisFrame;
         info.m_timeGraphLastBuiltMs = m_timeGraphLastBuiltMs;
         info.m_isReusingRenderTargets = m_renderToRenderTargetCount >= 2 && !m_renderTargetRenderNodes.empty();
@@ -13,6 +13,9 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Color.h>
 
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
@@ -247,6 +250,12 @@ namespace LyShine
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     // The RenderGraph is owned by the canvas component
+    //
+    // The graph is retained between builds. While it is built, every call made by the UI components is
+    // recorded as a render command, and the range of commands of every element (including its children) is
+    // remembered. When only some elements are invalidated with InvalidateElement, the next build renders
+    // those elements and their ancestors again, and replays the recorded commands of all other elements
+    // instead of calling their render components.
     class RenderGraph : public IRenderGraph
     {
     public:
@@ -254,10 +263,26 @@ namespace LyShine
         RenderGraph();
         ~RenderGraph() override;
 
-        //! Free up all the memory and clear the lists
+        //! Free up all the memory and clear the lists, including the commands retained from the last build
         void ResetGraph();
-        
+
+        //! Start building the graph. The commands recorded in the previous build are kept for elements that
+        //! were not invalidated.
+        void BeginBuild();
+
+        //! Invalidate the graph for an element. The element and all of its children are rendered again on the
+        //! next build. This must be called for all ancestors of the element as well, using InvalidateAncestorOfElement.
+        void InvalidateElement(AZ::EntityId elementId);
+
+        //! Invalidate the graph for an ancestor of an invalidated element. The ancestor renders itself again on the
+        //! next build, but the commands of its children are replayed unless they are invalidated as well.
+        //! Returns false if the ancestor was already invalidated, in which case so are all of its ancestors.
+        bool InvalidateAncestorOfElement(AZ::EntityId elementId);
+
         // IRenderGraph
+        bool BeginElement(AZ::EntityId elementId) override;
+        void EndElement() override;
+
         void BeginMask(bool isMaskingEnabled, bool useAlphaTest, bool drawBehind, bool drawInFront) override;
         void StartChildrenForMask() override;
         void EndMask() override;
@@ -294,18 +319,21 @@ namespace LyShine
         //! Render the display graph
         void Render(UiRenderer* uiRenderer, const AZ::Vector2& viewportSize);
 
-        //! Set the dirty flag - this also resets the graph
+        //! Set the dirty flag - this also resets the graph, so all elements are rendered again
         void SetDirtyFlag(bool isDirty);
 
         //! Get the dirty flag
         bool GetDirtyFlag();
 
-        //! End the building of the graph
+        //! End the building of the graph, this frees the commands of the previous build that were not replayed
         void FinalizeGraph();
 
         //! Test whether the render graph contains any render nodes
         bool IsEmpty();
 
+        //! Get the number of elements whose commands were replayed in the last build
+        int GetNumReplayedElements() const { return m_numReplayedElements; }
+
         void GetRenderTargetsAndDependencies(LyShine::AttachmentImagesAndDependencies& attachmentImagesAndDependencies);
 
 #ifndef _RELEASE
@@ -329,6 +357,56 @@ namespace LyShine
         {
             LyShine::UiPrimitiveVertex         m_quadVerts[4];
             LyShine::UiPrimitive   m_primitive;
+            bool                   m_isReplayed = false;   //!< Set if the quad was used by a replayed command
+        };
+
+        enum class RenderCommandType : uint8
+        {
+            AddPrimitive,
+            AddAlphaMaskPrimitive,
+            DynamicQuad,
+            BeginMask,
+            StartChildrenForMask,
+            EndMask,
+            BeginRenderToTexture,
+            EndRenderToTexture,
+            SetIsRenderingToMask,
+            PushAlphaFade,
+            PushOverrideAlphaFade,
+            PopAlphaFade
+        };
+
+        //! A call to the graph made while building it, recorded so it can be replayed in later builds
+        struct RenderCommand
+        {
+            RenderCommandType   m_type;
+            LyShine::BlendMode  m_blendMode = LyShine::BlendMode::Normal;
+            bool                m_flags[4] = {}; //!< The bool arguments of the call, in order
+            float               m_alphaFade = 1.0f;
+            LyShine::UiPrimitive* m_primitive = nullptr;
+            DynamicQuad*        m_dynamicQuad = nullptr;
+            AZ::Data::Instance<AZ::RPI::Image> m_texture;
+            AZ::Data::Instance<AZ::RPI::AttachmentImage> m_attachmentImage; //!< The render target or the content image
+            AZ::Data::Instance<AZ::RPI::AttachmentImage> m_maskAttachmentImage;
+            AZ::Vector2         m_viewportTopLeft = AZ::Vector2::CreateZero();
+            AZ::Vector2         m_viewportSize = AZ::Vector2::CreateZero();
+            AZ::Color           m_clearColor = AZ::Color::CreateZero();
+        };
+
+        //! The range of commands recorded for an element and its children
+        struct ElementRecord
+        {
+            AZ::EntityId    m_elementId;
+            uint32          m_firstCommand = 0;
+            uint32          m_endCommand = 0;
+            uint32          m_endRecord = 0;    //!< One past the index of the record of the last descendant
+        };
+
+        //! An element that is being rendered during the build
+        struct OpenElement
+        {
+            uint32          m_recordIndex = 0;
+            bool            m_isInvalidated = false;
         };
 
     protected: // member functions
@@ -338,6 +416,15 @@ namespace LyShine
 
         void SetRttPassesEnabled(UiRenderer* uiRenderer, bool enabled);
 
+        //! Free the render nodes, the retained commands are kept
+        void ClearRenderNodes();
+
+        //! Add a command to the current build, unless it is executed by a replay
+        RenderCommand* RecordCommand(RenderCommandType type);
+
+        //! Replay the commands of an element and its children from the previous build, and move them to the current build
+        void ReplayElement(uint32 previousRecordIndex);
+
     protected:  // data
 
         AZStd::vector<RenderNode*>  m_renderNodes;
@@ -357,6 +444,21 @@ namespace LyShine
         AZStd::vector<RenderTargetRenderNode*>  m_renderTargetRenderNodes;
         int                         m_renderTargetNestLevel = 0;
 
+        // Retained commands of the current and the previous build
+        AZStd::vector<RenderCommand>    m_commands;
+        AZStd::vector<ElementRecord>    m_elementRecords;
+        AZStd::vector<OpenElement>      m_openElements;
+        AZStd::vector<RenderCommand>    m_previousCommands;
+        AZStd::vector<ElementRecord>    m_previousElementRecords;
+        AZStd::unordered_map<AZ::EntityId, uint32> m_previousElementRecordIndices;
+        AZStd::vector<DynamicQuad*>     m_previousDynamicQuads;
+
+        AZStd::unordered_set<AZ::EntityId> m_invalidatedElements;
+        AZStd::unordered_set<AZ::EntityId> m_invalidatedAncestors;
+        int                         m_invalidatedElementNestLevel = 0;  //!< Non-zero while rendering the children of an invalidated element
+        bool                        m_isReplaying = false;
+        int                         m_numReplayedElements = 0;
+
 #ifndef _RELEASE
         // A debug-only variable used to track whether the rendergraph was rebuilt this frame
         mutable bool                m_wasBuiltThisFrame = false;
@@ -3149,6 +3149,48 @@ namespace
 
         lyshine->ReleaseCanvas(canvasEntityId, false);
     }
+
+    void AssertDrawBatchLinesEqual(const UiTextComponent::DrawBatchLines& lines1, const UiTextComponent::DrawBatchLines& lines2)
+    {
+        AZ_Assert(lines1.batchLines.size() == lines2.batchLines.size(), "Test failed");
+        AZ_Assert(lines1.height == lines2.height, "Test failed");
+
+        auto lineIt2 = lines2.batchLines.begin();
+        for (const UiTextComponent::DrawBatchLine& line1 : lines1.batchLines)
+        {
+            const UiTextComponent::DrawBatchLine& line2 = *lineIt2++;
+            AZ_Assert(line1.lineSize == line2.lineSize, "Test failed");
+            AZ_Assert(line1.drawBatchList.size() == line2.drawBatchList.size(), "Test failed");
+
+            auto batchIt2 = line2.drawBatchList.begin();
+            for (const UiTextComponent::DrawBatch& batch1 : line1.drawBatchList)
+            {
+                const UiTextComponent::DrawBatch& batch2 = *batchIt2++;
+                AZ_Assert(batch1.text == batch2.text, "Test failed");
+                AZ_Assert(batch1.font == batch2.font, "Test failed");
+                AZ_Assert(batch1.size == batch2.size, "Test failed");
+                AZ_Assert(batch1.color == batch2.color, "Test failed");
+                AZ_Assert(batch1.clickableId == batch2.clickableId, "Test failed");
+            }
+        }
+    }
+
+    UiTextComponent* CreateWrappedTextComponent(UiCanvasInterface* canvas, const char* name, bool isMarkupEnabled, bool isCached = true)
+    {
+        AZ::Entity* testElem = canvas->CreateChildElement(name);
+        AZ_Assert(testElem, "Test failed");
+
+        CreateComponent(testElem, LyShine::UiTransform2dComponentUuid);
+        CreateComponent(testElem, LyShine::UiTextComponentUuid);
+        EBUS_EVENT_ID(testElem->GetId(), UiTextBus, SetWrapText, UiTextInterface::WrapTextSetting::Wrap);
+        EBUS_EVENT_ID(testElem->GetId(), UiTextBus, SetIsMarkupEnabled, isMarkupEnabled);
+        if (!isCached)
+        {
+            // Layouts of text with a displayed text function aren't cached
+            EBUS_EVENT_ID(testElem->GetId(), UiTextBus, SetDisplayedTextFunction, [](const AZStd::string& text) { return text; });
+        }
+        return testElem->FindComponent<UiTextComponent>();
+    }
 }
 
 void FontSharedPtrTests()
@@ -3473,6 +3515,125 @@ void FontSharedPtrTests()
     }
 }
 
+// Verifies that the layouts from the layout cache match the uncached layouts, and that updating
+// a scoreboard and a chat window reuses the cached layouts
+void UiTextComponent::UnitTestLayoutCache(CLyShine* lyshine)
+{
+    UiTextLayoutCache* layoutCache = AZ::Interface<UiTextLayoutCache>::Get();
+    AZ_Assert(layoutCache, "Test failed");
+    AZ_Assert(layoutCache->GetMaxNumEntries() > 0, "Test failed");
+    layoutCache->Clear();
+
+    AZ::EntityId canvasEntityId = lyshine->CreateCanvas();
+    UiCanvasInterface* canvas = UiCanvasBus::FindFirstHandler(canvasEntityId);
+    AZ_Assert(canvas, "Test failed");
+
+    const char* plainText = "The quick brown fox jumps over the lazy dog, then takes a nap in the afternoon sun.";
+    const char* markupText = "The <font color=\"#FF0000\">quick brown</font> fox <b>jumps</b> over the <a action=\"lazy\">lazy dog</a>";
+
+    // Cached layouts match uncached layouts
+    for (bool isMarkupEnabled : { false, true })
+    {
+        const char* text = isMarkupEnabled ? markupText : plainText;
+
+        UiTextComponent* uncachedComponent = CreateWrappedTextComponent(canvas, "Uncached", isMarkupEnabled, false);
+        UiTextComponent* firstComponent = CreateWrappedTextComponent(canvas, "First", isMarkupEnabled);
+        UiTextComponent* secondComponent = CreateWrappedTextComponent(canvas, "Second", isMarkupEnabled);
+        uncachedComponent->SetText(text);
+        firstComponent->SetText(text);
+        secondComponent->SetText(text);
+
+        const UiTextComponent::DrawBatchLines& uncachedLines = uncachedComponent->GetDrawBatchLines();
+        AZ_Assert(uncachedLines.batchLines.size() > 1, "Test failed");
+
+        const UiTextLayoutCache::Stats statsBefore = layoutCache->GetStats();
+        AssertDrawBatchLinesEqual(uncachedLines, firstComponent->GetDrawBatchLines());
+        AssertDrawBatchLinesEqual(uncachedLines, secondComponent->GetDrawBatchLines());
+        AZ_Assert(layoutCache->GetStats().m_hits > statsBefore.m_hits, "Test failed");
+    }
+
+    // Appending text only re-wraps the last line, and the result matches an uncached layout of the whole text
+    {
+        const char* appendedTexts[] = {
+            " and dreams of chasing rabbits",
+            "\nA new line",
+            "\n",
+            "After an empty line",
+            "Unbrokenwordthatislongerthanthewidthoftheelement"
+        };
+
+        UiTextComponent* appendComponent = CreateWrappedTextComponent(canvas, "Append", false);
+        UiTextComponent* uncachedComponent = CreateWrappedTextComponent(canvas, "Uncached", false, false);
+
+        AZStd::string text(plainText);
+        appendComponent->SetText(text);
+        appendComponent->GetDrawBatchLines();
+
+        for (const char* appendedText : appendedTexts)
+        {
+            text += appendedText;
+            appendComponent->SetText(text);
+            uncachedComponent->SetText(text);
+
+            const UiTextLayoutCache::Stats statsBefore = layoutCache->GetStats();
+            AssertDrawBatchLinesEqual(uncachedComponent->GetDrawBatchLines(), appendComponent->GetDrawBatchLines());
+            AZ_Assert(layoutCache->GetStats().m_appends > statsBefore.m_appends, "Test failed");
+        }
+    }
+
+    // Scoreboard: many text elements showing a few distinct values, all updated every tick.
+    // Chat window: a few text elements that get a message appended every tick.
+    {
+        const int numScoreboardComponents = 300;
+        const int numChatComponents = 4;
+        const int numTicks = 50;
+
+        AZStd::vector<UiTextComponent*> scoreboardComponents;
+        for (int i = 0; i < numScoreboardComponents; ++i)
+        {
+            scoreboardComponents.push_back(CreateWrappedTextComponent(canvas, "Score", false));
+        }
+        AZStd::vector<UiTextComponent*> chatComponents;
+        for (int i = 0; i < numChatComponents; ++i)
+        {
+            chatComponents.push_back(CreateWrappedTextComponent(canvas, "Chat", false));
+        }
+
+        const UiTextLayoutCache::Stats statsBefore = layoutCache->GetStats();
+
+        AZStd::vector<AZStd::string> chatTexts(numChatComponents);
+        for (int tick = 0; tick < numTicks; ++tick)
+        {
+            for (int i = 0; i < numScoreboardComponents; ++i)
+            {
+                scoreboardComponents[i]->SetText(AZStd::string::format("Player %d  Kills %d  Deaths %d", i % 10, tick % 7, tick % 3));
+                scoreboardComponents[i]->GetDrawBatchLines();
+            }
+            for (int i = 0; i < numChatComponents; ++i)
+            {
+                chatTexts[i] += AZStd::string::format("Player %d: message number %d\n", i, tick);
+                chatComponents[i]->SetText(chatTexts[i]);
+                chatComponents[i]->GetDrawBatchLines();
+            }
+        }
+
+        const UiTextLayoutCache::Stats statsAfter = layoutCache->GetStats();
+
+        // The scoreboard shows 10 distinct values per tick, so all but the first element showing a value reuse its layout
+        const AZ::u64 minScoreboardHits = static_cast<AZ::u64>(numTicks) * (numScoreboardComponents - 10);
+        AZ_Assert(statsAfter.m_hits - statsBefore.m_hits >= minScoreboardHits, "Test failed");
+
+        // The chat messages are only wrapped once, after that only the appended message is wrapped
+        AZ_Assert(statsAfter.m_appends > statsBefore.m_appends, "Test failed");
+
+        // Elements showing the same value share the same lines
+        AssertDrawBatchLinesEqual(scoreboardComponents[0]->GetDrawBatchLines(), scoreboardComponents[10]->GetDrawBatchLines());
+    }
+
+    layoutCache->Clear();
+    lyshine->ReleaseCanvas(canvasEntityId, false);
+}
+
 void UiTextComponent::UnitTest(CLyShine* lyshine, IConsoleCmdArgs* cmdArgs)
 {
     const bool testsRunningAtStartup = cmdArgs == nullptr;
@@ -3502,6 +3663,7 @@ void UiTextComponent::UnitTest(CLyShine* lyshine, IConsoleCmdArgs* cmdArgs)
     TrackingLeadingTests(lyshine);
     ComponentGetSetTextTests(lyshine);
     MarkupFlagTest(lyshine);
+    UnitTestLayoutCache(lyshine);
 }
 
 void UiTextComponent::UnitTestLocalization(CLyShine* lyshine, IConsoleCmdArgs* /* cmdArgs */)
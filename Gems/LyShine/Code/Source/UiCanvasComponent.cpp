@@ -1833,6 +1833,27 @@ void UiCanvasComponent::MarkRenderGraphDirty()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiCanvasComponent::MarkRenderGraphDirtyForElement(AZ::EntityId elementId)
+{
+    // See MarkRenderGraphDirty for why this is ignored while rendering
+    if (!m_isRendering)
+    {
+        m_renderGraph.InvalidateElement(elementId);
+
+        // The ancestors render again as well, so the children that did not change are replayed in the right order.
+        // Stop at the first ancestor that was already invalidated, its ancestors are too.
+        AZ::EntityId ancestorId;
+        EBUS_EVENT_ID_RESULT(ancestorId, elementId, UiElementBus, GetParentEntityId);
+        while (ancestorId.IsValid() && m_renderGraph.InvalidateAncestorOfElement(ancestorId))
+        {
+            AZ::EntityId parentId;
+            EBUS_EVENT_ID_RESULT(parentId, ancestorId, UiElementBus, GetParentEntityId);
+            ancestorId = parentId;
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 AZ::RHI::AttachmentId UiCanvasComponent::UseRenderTarget(const AZ::Name& renderTargetName, AZ::RHI::Size size)
 {
@@ -1935,7 +1956,7 @@ void UiCanvasComponent::RenderCanvas(bool isInGame, AZ::Vector2 viewportSize, Ui
 
     if (m_renderGraph.GetDirtyFlag())
     {
-        m_renderGraph.ResetGraph();
+        m_renderGraph.BeginBuild();
 
         bool renderToTexture = !m_renderInEditor && GetIsRenderToTexture();
         if (renderToTexture)
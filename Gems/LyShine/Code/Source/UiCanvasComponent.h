@@ -228,6 +228,7 @@ public: // member functions
 
     // UiCanvasComponentImplementationInterface
     void MarkRenderGraphDirty() override;
+    void MarkRenderGraphDirtyForElement(AZ::EntityId elementId) override;
     // ~UiCanvasComponentImplementationInterface
 
     // RenderToTextureRequests
@@ -11,6 +11,7 @@
 #include "UiCanvasFileObject.h"
 #include "UiCanvasComponent.h"
 #include "UiGameEntityContext.h"
+#include "UiTextLayoutCache.h"
 
 #include <CryCommon/StlUtils.h>
 #include <LyShine/UiSerializeHelpers.h>
@@ -113,6 +114,7 @@ namespace
 UiCanvasManager::UiCanvasManager()
     : m_latestViewportSize(UiCanvasComponent::s_defaultCanvasSize)
     , m_localUserIdInputFilter(AzFramework::LocalUserIdAny)
+    , m_textLayoutCache(AZStd::make_unique<UiTextLayoutCache>())
 {
     UiCanvasManagerBus::Handler::BusConnect();
     UiCanvasOrderNotificationBus::Handler::BusConnect();
@@ -295,6 +297,9 @@ void UiCanvasManager::GenerateMousePositionInputEvent()
 void UiCanvasManager::OnFontsReloaded()
 {
     m_fontTextureHasChanged = true;
+
+    // The cached layouts reference the fonts that were reloaded
+    m_textLayoutCache->Clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1195,8 +1200,8 @@ void UiCanvasManager::DebugDisplayDrawCallData() const
 
     char buffer[200];
 
-    sprintf_s(buffer, "NN: %20s %5s   %5s %5s %5s %5s %5s   %5s %5s %5s %5s %5s %5s",
-        "Canvas name", "nDraw",   "nPrim", "nTris", "nMask", "nRTs", "nUTex",   "XMask", "XRT", "XBlnd", "XSrgb", "XMaxV", "XTex");
+    sprintf_s(buffer, "NN: %20s %5s   %5s %5s %5s %5s %5s   %5s %5s %5s %5s %5s %5s   %5s",
+        "Canvas name", "nDraw",   "nPrim", "nTris", "nMask", "nRTs", "nUTex",   "XMask", "XRT", "XBlnd", "XSrgb", "XMaxV", "XTex",   "nRply");
     WriteLine(buffer, blue);
 
     int totalRenderNodes = 0;
@@ -1210,6 +1215,7 @@ void UiCanvasManager::DebugDisplayDrawCallData() const
     int totalDueToSrgb = 0;
     int totalDueToMaxVerts = 0;
     int totalDueToTextures = 0;
+    int totalReplayedElements = 0;
 
     int i = 0;
     for (auto canvas : m_loadedCanvases)
@@ -1235,14 +1241,15 @@ void UiCanvasManager::DebugDisplayDrawCallData() const
         LyShineDebug::DebugInfoRenderGraph info;
         canvas->GetDebugInfoRenderGraph(info);
 
-        sprintf_s(buffer, "%2d: %20s %5d   %5d %5d %5d %5d %5d   %5d %5d %5d %5d %5d %5d",
+        sprintf_s(buffer, "%2d: %20s %5d   %5d %5d %5d %5d %5d   %5d %5d %5d %5d %5d %5d   %5d",
             i, leafName.c_str(),
             info.m_numRenderNodes,
             info.m_numPrimitives, info.m_numTriangles,
             info.m_numMasks, info.m_numRTs, info.m_numUniqueTextures,
             info.m_numNodesDueToMask, info.m_numNodesDueToRT,
             info.m_numNodesDueToBlendMode, info.m_numNodesDueToSrgb,
-            info.m_numNodesDueToMaxVerts, info.m_numNodesDueToTextures);
+            info.m_numNodesDueToMaxVerts, info.m_numNodesDueToTextures,
+            info.m_numReplayedElements);
 
         AZ::u64 timeSinceBuiltMs = AZStd::GetTimeUTCMilliSecond() - info.m_timeGraphLastBuiltMs;
         if (timeSinceBuiltMs > 1000)
@@ -1286,14 +1293,16 @@ void UiCanvasManager::DebugDisplayDrawCallData() const
         totalDueToSrgb += info.m_numNodesDueToSrgb;
         totalDueToMaxVerts += info.m_numNodesDueToMaxVerts;
         totalDueToTextures += info.m_numNodesDueToTextures;
+        totalReplayedElements += info.m_numReplayedElements;
     }
 
-    sprintf_s(buffer, "Totals:                  %5d   %5d %5d %5d %5d         %5d %5d %5d %5d %5d %5d",
+    sprintf_s(buffer, "Totals:                  %5d   %5d %5d %5d %5d         %5d %5d %5d %5d %5d %5d   %5d",
         totalRenderNodes,
         totalPrimitives, totalTriangles, totalMasks, totalRTs,
         totalDueToMask, totalDueToRT,
         totalDueToBlendMode, totalDueToSrgb,
-        totalDueToMaxVerts, totalDueToTextures);
+        totalDueToMaxVerts, totalDueToTextures,
+        totalReplayedElements);
 
     WriteLine(buffer, red);
 }
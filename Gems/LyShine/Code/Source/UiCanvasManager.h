@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <LyShine/Bus/UiCanvasManagerBus.h>
 #include <LyShine/Bus/UiCanvasBus.h>
 #include <LyShine/UiEntityContext.h>
@@ -15,6 +16,7 @@
 #include <IFont.h>
 
 class UiCanvasComponent;
+class UiTextLayoutCache;
 
 namespace AZ
 {
@@ -150,6 +152,8 @@ private: // data
 
     bool m_fontTextureHasChanged = false;
 
+    AZStd::unique_ptr<UiTextLayoutCache> m_textLayoutCache; // Layouts shared by the text components of all canvases
+
     AzFramework::LocalUserId m_localUserIdInputFilter; // The local user id to filter UI input on
 
     // Indicates whether to generate a mouse position input event on the next canvas update.
@@ -139,6 +139,13 @@ void UiElementComponent::RenderElement(LyShine::IRenderGraph* renderGraph, bool
         }
     }
 
+    // If neither this element nor any of its children changed since the render graph was last built, the graph
+    // replays what they rendered then
+    if (renderGraph->BeginElement(GetEntityId()))
+    {
+        return;
+    }
+
     // If a component is connected to the UiRenderControl bus then we give control of rendering this element
     // and its children to that component, otherwise follow the standard render path
     if (m_renderControlInterface)
@@ -161,6 +168,8 @@ void UiElementComponent::RenderElement(LyShine::IRenderGraph* renderGraph, bool
             GetChildElementComponent(i)->RenderElement(renderGraph, isInGame);
         }
     }
+
+    renderGraph->EndElement();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -923,10 +932,10 @@ void UiElementComponent::SetIsEnabled(bool isEnabled)
             DoRecursiveEnabledNotification(m_isEnabled);
         }
 
-        // tell the canvas to invalidate the render graph
+        // tell the canvas to invalidate the render graph for this element
         if (m_canvas)
         {
-            m_canvas->MarkRenderGraphDirty();
+            m_canvas->MarkRenderGraphDirtyForElement(GetEntityId());
         }
     }
 }
@@ -33,6 +33,7 @@
 #include "StringUtfUtils.h"
 #include "UiLayoutHelpers.h"
 #include "RenderGraph.h"
+#include "UiTextLayoutCache.h"
 
 #include <AtomLyIntegration/AtomFont/FFont.h>
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
@@ -576,10 +577,14 @@ namespace
 
     //! Use the given width and font context to insert newline breaks in the given DrawBatchList.
     //! This code is largely adapted from FFont::WrapText to work with DrawBatch objects.
+    //! When the batches continue a line that starts after a line break of previously wrapped text,
+    //! prevCharBeforeText is the character before the line, so the first character is measured
+    //! with the same tracking and kerning as when wrapping the whole text.
     void InsertNewlinesToWrapText(
         UiTextComponent::DrawBatchContainer& drawBatches,
         const STextDrawContext& ctx,
-        float elementWidth)
+        float elementWidth,
+        uint32_t prevCharBeforeText = 0)
     {
         if (drawBatches.empty())
         {
@@ -595,7 +600,9 @@ namespace
         int lastSpaceIndexInBatch = -1;
         float lastSpaceWidth = 0.0f;
 
-        int curChar = 0;
+        // Character indices only matter relative to the last space, but a space at the start of a
+        // continued line must still be a valid place to wrap (see the lastSpace check below)
+        int curChar = prevCharBeforeText ? 1 : 0;
         float curLineWidth = 0.0f;
         float biggestLineWidth = 0.0f;
 
@@ -623,7 +630,7 @@ namespace
             int batchCurChar = 0;
 
             Utf8::Unchecked::octet_iterator pChar(drawBatch.text.data());
-            uint32_t prevCh = 0;
+            uint32_t prevCh = (&drawBatch == &drawBatches.front()) ? prevCharBeforeText : 0;
             while (uint32_t ch = *pChar)
             {
                 size_t maxSize = 5;
@@ -886,6 +893,23 @@ namespace
         }
     }
 
+    //! Creates a layout cache entry from calculated draw batch lines without inline images
+    UiTextLayoutCache::LayoutPtr CreateCachedLayout(
+        const UiTextComponent::DrawBatchLines& drawBatchLines,
+        const FontFamilyPtr& fontFamily,
+        const FontFamilyPtr& overrideFontFamily)
+    {
+        auto layout = AZStd::make_shared<UiTextLayoutCache::Layout>();
+        layout->m_batchLines = drawBatchLines.batchLines;
+        layout->m_fontFamilyRefs = drawBatchLines.fontFamilyRefs;
+        // The batches reference the fonts of these font families without holding a reference
+        layout->m_fontFamilyRefs.insert(fontFamily);
+        layout->m_fontFamilyRefs.insert(overrideFontFamily);
+        layout->m_height = drawBatchLines.height;
+        layout->m_fontEffectHasTransparency = drawBatchLines.m_fontEffectHasTransparency;
+        return layout;
+    }
+
     //! Takes a flat list of draw batches (created by the Draw Batch Builder) and groups them
     //! by line, taking the element width into account, and also taking any newline characters
     //! that may already exist within the character data of the DrawBatch objects
@@ -1608,6 +1632,50 @@ void UiTextComponent::DrawBatchLines::Clear()
     height = 0.0f;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiTextComponent::TextLayoutKey::HasSameLayoutSettings(const TextLayoutKey& rhs) const
+{
+    return fontFamily == rhs.fontFamily
+        && overrideFontFamily == rhs.overrideFontFamily
+        && fontSize == rhs.fontSize
+        && fontSizeScale == rhs.fontSizeScale
+        && requestFontSize == rhs.requestFontSize
+        && fontEffectIndex == rhs.fontEffectIndex
+        && tracking == rhs.tracking
+        && availableWidth == rhs.availableWidth
+        && isMarkupEnabled == rhs.isMarkupEnabled
+        && wrapText == rhs.wrapText
+        && excludeTrailingSpaceWidth == rhs.excludeTrailingSpaceWidth
+        && pixelAligned == rhs.pixelAligned;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiTextComponent::TextLayoutKey::operator==(const TextLayoutKey& rhs) const
+{
+    return text == rhs.text && HasSameLayoutSettings(rhs);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t UiTextComponent::TextLayoutKeyHash::operator()(const TextLayoutKey& key) const
+{
+    size_t seed = 0;
+    AZStd::hash_combine(seed, key.text);
+    AZStd::hash_combine(seed, key.fontFamily);
+    AZStd::hash_combine(seed, key.overrideFontFamily);
+    AZStd::hash_combine(seed, key.fontSize);
+    AZStd::hash_combine(seed, key.fontSizeScale.GetX());
+    AZStd::hash_combine(seed, key.fontSizeScale.GetY());
+    AZStd::hash_combine(seed, key.requestFontSize);
+    AZStd::hash_combine(seed, key.fontEffectIndex);
+    AZStd::hash_combine(seed, key.tracking);
+    AZStd::hash_combine(seed, key.availableWidth);
+    AZStd::hash_combine(seed, key.isMarkupEnabled);
+    AZStd::hash_combine(seed, key.wrapText);
+    AZStd::hash_combine(seed, key.excludeTrailingSpaceWidth);
+    AZStd::hash_combine(seed, key.pixelAligned);
+    return seed;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 UiTextComponent::UiTextComponent()
     : m_text("My string")
@@ -2569,11 +2637,13 @@ void UiTextComponent::SetDisplayedTextFunction(const DisplayedTextFunction& disp
     if (displayedTextFunction)
     {
         m_displayedTextFunction = displayedTextFunction;
+        m_isDisplayedTextFunctionDefault = false;
     }
     else
     {
         // For null function objects, we fall back on our default implementation
         m_displayedTextFunction = DefaultDisplayedTextFunction;
+        m_isDisplayedTextFunctionDefault = true;
     }
     MarkRenderCacheDirty();
 }
@@ -3806,6 +3876,49 @@ void UiTextComponent::CalculateDrawBatchLines(
 
     SanitizeUserEnteredNewlineChar(m_locText);
 
+    // Text components that show the same text with the same settings share their layout through the layout cache.
+    // The displayed text function can't be compared, so the layouts of transformed text aren't cached
+    UiTextLayoutCache* layoutCache = m_isDisplayedTextFunctionDefault ? AZ::Interface<UiTextLayoutCache>::Get() : nullptr;
+    const bool isMainLayout = &drawBatchLinesOut == &m_drawBatchLines;
+    TextLayoutKey layoutKey;
+    if (layoutCache)
+    {
+        layoutKey = GetTextLayoutKey(m_isMarkupEnabled ? markupText : m_locText, fontContext, drawBatchLinesOut.fontSizeScale,
+            wrapText, availableWidth, excludeTrailingSpaceWidth);
+
+        bool isLayoutCached = false;
+        if (UiTextLayoutCache::LayoutPtr layout = layoutCache->Find(layoutKey))
+        {
+            drawBatchLinesOut.batchLines = layout->m_batchLines;
+            drawBatchLinesOut.fontFamilyRefs = layout->m_fontFamilyRefs;
+            drawBatchLinesOut.height = layout->m_height;
+            drawBatchLinesOut.m_fontEffectHasTransparency = layout->m_fontEffectHasTransparency;
+            isLayoutCached = true;
+        }
+        else if (isMainLayout && CalculateDrawBatchLinesForAppendedText(drawBatchLinesOut, layoutKey, fontContext, requestFontSize))
+        {
+            layoutCache->Store(layoutKey, CreateCachedLayout(drawBatchLinesOut, m_fontFamily, m_overrideFontFamily));
+            isLayoutCached = true;
+        }
+
+        if (isLayoutCached)
+        {
+            // Cached layouts don't have inline images. The glyphs don't need to be added to the font
+            // textures for measuring, rendering the batches adds any glyphs that are missing
+            for (auto image : prevInlineImages)
+            {
+                delete image;
+            }
+            TextureAtlasNamespace::TextureAtlasNotificationBus::Handler::BusDisconnect();
+
+            if (isMainLayout)
+            {
+                m_lastTextLayoutKey = AZStd::move(layoutKey);
+            }
+            return;
+        }
+    }
+
     // Only attempt to parse the string for XML markup if the markup enabled flag is set (it is expensive)
     bool suppressXmlWarnings = !m_textNeedsXmlValidation;
     m_textNeedsXmlValidation = false;
@@ -3921,6 +4034,105 @@ void UiTextComponent::CalculateDrawBatchLines(
         CreateBatchLines(drawBatchLinesOut, drawBatches, m_fontFamily.get());
         AssignLineSizes(drawBatchLinesOut, m_fontFamily.get(), fontContext, excludeTrailingSpaceWidth);
     }
+
+    if (layoutCache)
+    {
+        // The inline images are owned by the draw batch lines, so layouts with images aren't shared
+        if (drawBatchLinesOut.inlineImages.empty())
+        {
+            layoutCache->Store(layoutKey, CreateCachedLayout(drawBatchLinesOut, m_fontFamily, m_overrideFontFamily));
+        }
+
+        if (isMainLayout)
+        {
+            m_lastTextLayoutKey = AZStd::move(layoutKey);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiTextComponent::CalculateDrawBatchLinesForAppendedText(
+    UiTextComponent::DrawBatchLines& drawBatchLinesOut,
+    const TextLayoutKey& key,
+    const STextDrawContext& fontContext,
+    int requestFontSize)
+{
+    // Markup tags can span the appended text, so only the layouts of plain text are extended
+    const AZStd::string& prevText = m_lastTextLayoutKey.text;
+    if (key.isMarkupEnabled
+        || !key.HasSameLayoutSettings(m_lastTextLayoutKey)
+        || key.text.size() <= prevText.size()
+        || !key.text.starts_with(prevText))
+    {
+        return false;
+    }
+
+    UiTextLayoutCache* layoutCache = AZ::Interface<UiTextLayoutCache>::Get();
+    UiTextLayoutCache::LayoutPtr prevLayout = layoutCache->Peek(m_lastTextLayoutKey);
+    if (!prevLayout || prevLayout->m_batchLines.empty())
+    {
+        return false;
+    }
+
+    // Wrapping never moves a line break before the start of the last line, so only the last line of the
+    // previous text is wrapped again together with the appended text. Plain text has one batch per line.
+    const DrawBatchLine& prevLastLine = prevLayout->m_batchLines.back();
+    if (prevLastLine.drawBatchList.size() != 1)
+    {
+        return false;
+    }
+    const AZStd::string& prevLastLineText = prevLastLine.drawBatchList.front().text;
+    if (!prevText.ends_with(prevLastLineText))
+    {
+        return false;
+    }
+    const size_t lastLineStart = prevText.size() - prevLastLineText.size();
+
+    uint32_t prevChar = 0;
+    if (lastLineStart > 0)
+    {
+        Utf8::Unchecked::octet_iterator<const char*> prevCharIt(prevText.c_str() + lastLineStart);
+        --prevCharIt;
+        prevChar = *prevCharIt;
+    }
+
+    DrawBatchContainer drawBatches;
+    drawBatches.push_back(DrawBatch());
+    drawBatches.front().font = m_overrideFontFamily->normal;
+    drawBatches.front().text = prevLastLineText + key.text.substr(prevText.size());
+
+    // A space at the start of a line that follows a newline character isn't a place to wrap when
+    // wrapping the whole text, which a continued line can't reproduce
+    if (key.wrapText && prevChar == '\n' && drawBatches.front().text.starts_with(' '))
+    {
+        return false;
+    }
+
+    gEnv->pCryFont->AddCharsToFontTextures(m_fontFamily, key.text.c_str() + prevText.size(), requestFontSize, requestFontSize);
+
+    DrawBatchLines lastLines;
+    lastLines.baseline = drawBatchLinesOut.baseline;
+    if (key.wrapText)
+    {
+        InsertNewlinesToWrapText(drawBatches, fontContext, key.availableWidth, prevChar);
+    }
+    CreateBatchLines(lastLines, drawBatches, m_fontFamily.get());
+    AssignLineSizes(lastLines, m_fontFamily.get(), fontContext, key.excludeTrailingSpaceWidth);
+
+    drawBatchLinesOut.batchLines.assign(prevLayout->m_batchLines.begin(), AZStd::prev(prevLayout->m_batchLines.end()));
+    drawBatchLinesOut.batchLines.splice(drawBatchLinesOut.batchLines.end(), lastLines.batchLines);
+    drawBatchLinesOut.fontFamilyRefs = prevLayout->m_fontFamilyRefs;
+    drawBatchLinesOut.m_fontEffectHasTransparency = prevLayout->m_fontEffectHasTransparency;
+
+    // Sum the line heights in the same order as AssignLineSizes, so the height matches a full layout exactly
+    drawBatchLinesOut.height = 0.0f;
+    for (const DrawBatchLine& batchLine : drawBatchLinesOut.batchLines)
+    {
+        drawBatchLinesOut.height += batchLine.lineSize.GetY();
+    }
+
+    layoutCache->CountAppend();
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -4225,6 +4437,32 @@ void UiTextComponent::UpdateTextRenderBatchesForFontTextureChange()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiTextComponent::TextLayoutKey UiTextComponent::GetTextLayoutKey(
+    const AZStd::string& text,
+    const STextDrawContext& fontContext,
+    const AZ::Vector2& fontSizeScale,
+    bool wrapText,
+    float availableWidth,
+    bool excludeTrailingSpaceWidth) const
+{
+    TextLayoutKey key;
+    key.text = text;
+    key.fontFamily = m_fontFamily.get();
+    key.overrideFontFamily = m_overrideFontFamily.get();
+    key.fontSize = m_fontSize;
+    key.fontSizeScale = fontSizeScale;
+    key.requestFontSize = fontContext.m_requestSize.x;
+    key.fontEffectIndex = fontContext.m_fxIdx;
+    key.tracking = fontContext.m_tracking;
+    key.availableWidth = wrapText ? availableWidth : -1.0f;
+    key.isMarkupEnabled = m_isMarkupEnabled;
+    key.wrapText = wrapText;
+    key.excludeTrailingSpaceWidth = excludeTrailingSpaceWidth;
+    key.pixelAligned = fontContext.m_pixelAligned;
+    return key;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 STextDrawContext UiTextComponent::GetTextDrawContextPrototype(int requestFontSize, const AZ::Vector2& fontSizeScale) const
 {
@@ -5174,7 +5412,7 @@ void UiTextComponent::MarkRenderGraphDirty()
     // tell the canvas to invalidate the render graph
     AZ::EntityId canvasEntityId;
     EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
-    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirtyForElement, GetEntityId());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -219,6 +219,35 @@ public: //types
         float batchLineLength;
     };
 
+    //! The inputs of CalculateDrawBatchLines. Text components with equal keys calculate the same
+    //! draw batch lines, so the lines can be shared through the UiTextLayoutCache.
+    struct TextLayoutKey
+    {
+        //! Returns true if the keys only differ in their text
+        bool HasSameLayoutSettings(const TextLayoutKey& rhs) const;
+
+        bool operator==(const TextLayoutKey& rhs) const;
+
+        AZStd::string text;
+        const FontFamily* fontFamily = nullptr;             //!< Used for wrapping and for the batches of empty lines
+        const FontFamily* overrideFontFamily = nullptr;     //!< Used for the text batches
+        float fontSize = 0.0f;
+        AZ::Vector2 fontSizeScale = AZ::Vector2(1.0f, 1.0f);
+        int requestFontSize = 0;
+        unsigned int fontEffectIndex = 0;
+        float tracking = 0.0f;
+        float availableWidth = -1.0f;                       //!< Only set when the text is wrapped
+        bool isMarkupEnabled = false;
+        bool wrapText = false;
+        bool excludeTrailingSpaceWidth = true;
+        bool pixelAligned = false;
+    };
+
+    struct TextLayoutKeyHash
+    {
+        size_t operator()(const TextLayoutKey& key) const;
+    };
+
 public: // member functions
 
     AZ_COMPONENT(UiTextComponent, LyShine::UiTextComponentUuid, AZ::Component);
@@ -337,6 +366,7 @@ public: // member functions
 #if defined(LYSHINE_INTERNAL_UNIT_TEST)
     static void UnitTest(CLyShine* lyshine, IConsoleCmdArgs* cmdArgs);
     static void UnitTestLocalization(CLyShine* lyshine, IConsoleCmdArgs* cmdArgs);
+    static void UnitTestLayoutCache(CLyShine* lyshine);
 #endif
 
 public:  // static member functions
@@ -466,6 +496,10 @@ protected: // member functions
     //! Update the text render batches in the case of a font texture change
     void UpdateTextRenderBatchesForFontTextureChange();
 
+    //! Returns the key of the draw batch lines calculated with the given settings and the current text and font
+    TextLayoutKey GetTextLayoutKey(const AZStd::string& text, const STextDrawContext& fontContext, const AZ::Vector2& fontSizeScale,
+        bool wrapText, float availableWidth, bool excludeTrailingSpaceWidth) const;
+
     //! Returns a prototypical STextDrawContext to be used when interacting with IFont routines..
     STextDrawContext GetTextDrawContextPrototype(int requestFontSize, const AZ::Vector2& fontSizeScale) const;
 
@@ -572,6 +606,14 @@ private: // member functions
     //! Given an index into the displayed string, returns the line number that the character is displayed on.
     int GetLineNumberFromCharIndex(const DrawBatchLines& drawBatchLines, const int soughtIndex) const;
 
+    //! Calculates the draw batch lines of text that was appended to the text of a cached layout, by only re-wrapping
+    //! the last line of the cached layout together with the appended text. Returns false if the cached layout can't be used.
+    bool CalculateDrawBatchLinesForAppendedText(
+        UiTextComponent::DrawBatchLines& drawBatchLinesOut,
+        const TextLayoutKey& key,
+        const STextDrawContext& fontContext,
+        int requestFontSize);
+
     //! Invalidates the parent and this element's layout
     void InvalidateLayout() const;
 
@@ -699,4 +741,7 @@ private: // data
     bool m_isRequestFontSizeDirty = true;           //!< Indicates whether m_requestFontSize needs calculating before next use
 
     bool m_textNeedsXmlValidation = true;           //!< Indicates whether any XML parsing warnings should be displayed when next parsed
+
+    bool m_isDisplayedTextFunctionDefault = true;   //!< Only layouts of untransformed text can be shared through the UiTextLayoutCache
+    TextLayoutKey m_lastTextLayoutKey;              //!< The key of the last calculated draw batch lines, used to only re-wrap appended text
 };
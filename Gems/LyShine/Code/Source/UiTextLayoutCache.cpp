@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "UiTextLayoutCache.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC MEMBER FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiTextLayoutCache::UiTextLayoutCache(size_t maxNumEntries)
+    : m_maxNumEntries(maxNumEntries)
+{
+    AZ::Interface<UiTextLayoutCache>::Register(this);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiTextLayoutCache::~UiTextLayoutCache()
+{
+    AZ::Interface<UiTextLayoutCache>::Unregister(this);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiTextLayoutCache::LayoutPtr UiTextLayoutCache::Find(const UiTextComponent::TextLayoutKey& key)
+{
+    auto found = m_entryLookup.find(key);
+    if (found == m_entryLookup.end())
+    {
+        ++m_stats.m_misses;
+        return nullptr;
+    }
+
+    ++m_stats.m_hits;
+    m_entries.splice(m_entries.begin(), m_entries, found->second);
+    return found->second->second;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiTextLayoutCache::LayoutPtr UiTextLayoutCache::Peek(const UiTextComponent::TextLayoutKey& key) const
+{
+    auto found = m_entryLookup.find(key);
+    return found != m_entryLookup.end() ? found->second->second : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextLayoutCache::Store(const UiTextComponent::TextLayoutKey& key, LayoutPtr layout)
+{
+    if (m_maxNumEntries == 0)
+    {
+        return;
+    }
+
+    auto found = m_entryLookup.find(key);
+    if (found != m_entryLookup.end())
+    {
+        found->second->second = AZStd::move(layout);
+        m_entries.splice(m_entries.begin(), m_entries, found->second);
+        return;
+    }
+
+    m_entries.emplace_front(key, AZStd::move(layout));
+    m_entryLookup.emplace(key, m_entries.begin());
+    EvictOverLimit();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextLayoutCache::CountAppend()
+{
+    ++m_stats.m_appends;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextLayoutCache::Clear()
+{
+    m_entryLookup.clear();
+    m_entries.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextLayoutCache::SetMaxNumEntries(size_t maxNumEntries)
+{
+    m_maxNumEntries = maxNumEntries;
+    EvictOverLimit();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t UiTextLayoutCache::GetMaxNumEntries() const
+{
+    return m_maxNumEntries;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiTextLayoutCache::Stats UiTextLayoutCache::GetStats() const
+{
+    Stats stats = m_stats;
+    stats.m_numEntries = m_entries.size();
+    return stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// PRIVATE MEMBER FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextLayoutCache::EvictOverLimit()
+{
+    while (m_entries.size() > m_maxNumEntries)
+    {
+        m_entryLookup.erase(m_entries.back().first);
+        m_entries.pop_back();
+        ++m_stats.m_evictions;
+    }
+}
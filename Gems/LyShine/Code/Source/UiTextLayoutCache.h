@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "UiTextComponent.h"
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//! Cache of the draw batch lines of text components, shared by all text components.
+//!
+//! Text components with the same text, font and layout settings, e.g. the rows of a scoreboard or
+//! the messages of a chat window, produce the same draw batch lines. Parsing the markup, wrapping
+//! the text and measuring the lines is only done for the first of them, the others copy the lines
+//! from the cache. The cache is owned by the UiCanvasManager and accessed through AZ::Interface.
+//! It is only used from the main thread, like the text components.
+class UiTextLayoutCache
+{
+public: // types
+
+    AZ_TYPE_INFO(UiTextLayoutCache, "{02DC7E3C-535B-4C62-8D0D-88724FA7E13A}");
+
+    //! The cached result of UiTextComponent::CalculateDrawBatchLines. Layouts with inline images are not cached
+    struct Layout
+    {
+        UiTextComponent::DrawBatchLineContainer m_batchLines;
+        UiTextComponent::FontFamilyRefSet m_fontFamilyRefs;     //!< Also keeps the font families of the key alive
+        float m_height = 0.0f;
+        bool m_fontEffectHasTransparency = false;
+    };
+    using LayoutPtr = AZStd::shared_ptr<const Layout>;
+
+    struct Stats
+    {
+        AZ::u64 m_hits = 0;
+        AZ::u64 m_misses = 0;
+        AZ::u64 m_appends = 0;          //!< Layouts that were calculated by only re-wrapping the text appended to a cached layout
+        AZ::u64 m_evictions = 0;
+        size_t m_numEntries = 0;
+    };
+
+    static constexpr size_t DefaultMaxNumEntries = 1024;
+
+public: // member functions
+
+    explicit UiTextLayoutCache(size_t maxNumEntries = DefaultMaxNumEntries);
+    ~UiTextLayoutCache();
+
+    //! Returns the layout of the key, or null if it isn't cached. Counts a hit or a miss
+    LayoutPtr Find(const UiTextComponent::TextLayoutKey& key);
+
+    //! Returns the layout of the key without counting a hit or miss or changing the eviction order
+    LayoutPtr Peek(const UiTextComponent::TextLayoutKey& key) const;
+
+    //! Adds or replaces the layout of the key, evicting the least recently used layouts when over the limit
+    void Store(const UiTextComponent::TextLayoutKey& key, LayoutPtr layout);
+
+    //! Counts a layout that was calculated from a cached layout of a prefix of its text
+    void CountAppend();
+
+    //! Releases all layouts and the font families they reference, e.g. when the fonts are reloaded
+    void Clear();
+
+    //! Setting the maximum number of entries to zero disables the cache
+    void SetMaxNumEntries(size_t maxNumEntries);
+    size_t GetMaxNumEntries() const;
+
+    Stats GetStats() const;
+
+private: // types
+
+    using Entry = AZStd::pair<UiTextComponent::TextLayoutKey, LayoutPtr>;
+    using EntryList = AZStd::list<Entry>;
+
+private: // member functions
+
+    void EvictOverLimit();
+
+private: // data
+
+    EntryList m_entries;    //!< Most recently used first
+    AZStd::unordered_map<UiTextComponent::TextLayoutKey, EntryList::iterator, UiTextComponent::TextLayoutKeyHash> m_entryLookup;
+    size_t m_maxNumEntries;
+    Stats m_stats;
+};
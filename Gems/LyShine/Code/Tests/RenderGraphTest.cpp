@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <RenderGraph.h>
+
+namespace UnitTest
+{
+    // Exposes the render nodes of the graph to the tests
+    class TestRenderGraph
+        : public LyShine::RenderGraph
+    {
+    public:
+        //! Get the primitives of all top level render nodes in render order
+        AZStd::vector<const LyShine::UiPrimitive*> GetPrimitives() const
+        {
+            AZStd::vector<const LyShine::UiPrimitive*> primitives;
+            for (const LyShine::RenderNode* renderNode : m_renderNodes)
+            {
+                if (renderNode->GetType() == LyShine::RenderNodeType::PrimitiveList)
+                {
+                    for (const LyShine::UiPrimitive& primitive : static_cast<const LyShine::PrimitiveListRenderNode*>(renderNode)->GetPrimitives())
+                    {
+                        primitives.push_back(&primitive);
+                    }
+                }
+            }
+            return primitives;
+        }
+    };
+
+    // A canvas of elements that each own a quad primitive, rendered like UiElementComponent::RenderElement does
+    class TestCanvas
+    {
+    public:
+        struct Element
+        {
+            AZ::EntityId m_id;
+            AZ::EntityId m_parentId;
+            AZStd::vector<int> m_children;
+            LyShine::UiPrimitiveVertex m_vertices[4];
+            LyShine::UiPrimitive m_primitive;
+            bool m_useDynamicQuad = false;
+            const LyShine::UiPrimitive* m_dynamicQuadPrimitive = nullptr;
+            int m_renderCount = 0;
+        };
+
+        //! Creates a root element with numGroups children that each have numChildrenPerGroup children
+        TestCanvas(int numGroups, int numChildrenPerGroup)
+        {
+            AddElement(-1);
+            for (int group = 0; group < numGroups; ++group)
+            {
+                const int groupIndex = AddElement(0);
+                for (int child = 0; child < numChildrenPerGroup; ++child)
+                {
+                    AddElement(groupIndex);
+                }
+            }
+        }
+
+        void Build(LyShine::RenderGraph& renderGraph)
+        {
+            renderGraph.BeginBuild();
+            RenderElement(renderGraph, 0);
+            renderGraph.SetDirtyFlag(false);
+            renderGraph.FinalizeGraph();
+        }
+
+        //! Does what UiCanvasComponent::MarkRenderGraphDirtyForElement does
+        void InvalidateElement(LyShine::RenderGraph& renderGraph, int elementIndex)
+        {
+            renderGraph.InvalidateElement(m_elements[elementIndex].m_id);
+            AZ::EntityId ancestorId = m_elements[elementIndex].m_parentId;
+            while (ancestorId.IsValid() && renderGraph.InvalidateAncestorOfElement(ancestorId))
+            {
+                ancestorId = m_elements[GetIndex(ancestorId)].m_parentId;
+            }
+        }
+
+        void ResetRenderCounts()
+        {
+            for (Element& element : m_elements)
+            {
+                element.m_renderCount = 0;
+            }
+        }
+
+        AZStd::vector<Element> m_elements;
+
+    private:
+        int AddElement(int parentIndex)
+        {
+            const int index = aznumeric_cast<int>(m_elements.size());
+            Element& element = m_elements.emplace_back();
+            element.m_id = AZ::EntityId(index + 1);
+            for (LyShine::UiPrimitiveVertex& vertex : element.m_vertices)
+            {
+                vertex = {};
+            }
+            element.m_primitive.m_vertices = element.m_vertices;
+            element.m_primitive.m_numVertices = 4;
+            element.m_primitive.m_indices = s_quadIndices;
+            element.m_primitive.m_numIndices = 6;
+            if (parentIndex >= 0)
+            {
+                element.m_parentId = m_elements[parentIndex].m_id;
+                m_elements[parentIndex].m_children.push_back(index);
+            }
+            return index;
+        }
+
+        static int GetIndex(AZ::EntityId elementId)
+        {
+            return aznumeric_cast<int>(static_cast<AZ::u64>(elementId)) - 1;
+        }
+
+        void RenderElement(LyShine::RenderGraph& renderGraph, int elementIndex)
+        {
+            Element& element = m_elements[elementIndex];
+            if (renderGraph.BeginElement(element.m_id))
+            {
+                return;
+            }
+
+            ++element.m_renderCount;
+            if (element.m_useDynamicQuad)
+            {
+                const AZ::Vector2 positions[4] = { AZ::Vector2(0.0f, 0.0f), AZ::Vector2(1.0f, 0.0f), AZ::Vector2(1.0f, 1.0f), AZ::Vector2(0.0f, 1.0f) };
+                LyShine::UiPrimitive* primitive = renderGraph.GetDynamicQuadPrimitive(positions, 0xFFFFFFFF);
+                element.m_dynamicQuadPrimitive = primitive;
+                renderGraph.AddPrimitive(primitive, {}, false, false, false, LyShine::BlendMode::Normal);
+            }
+            else
+            {
+                renderGraph.AddPrimitive(&element.m_primitive, {}, false, false, false, LyShine::BlendMode::Normal);
+            }
+
+            for (int childIndex : element.m_children)
+            {
+                RenderElement(renderGraph, childIndex);
+            }
+
+            renderGraph.EndElement();
+        }
+
+        static uint16 s_quadIndices[6];
+    };
+
+    uint16 TestCanvas::s_quadIndices[6] = { 0, 1, 2, 2, 3, 0 };
+
+    class LyShineRenderGraphTest
+        : public AllocatorsTestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            AllocatorsTestFixture::TearDown();
+        }
+    };
+
+    TEST_F(LyShineRenderGraphTest, Build_InvalidatedElement_OnlyElementAndAncestorsRender)
+    {
+        TestCanvas canvas(4, 5);
+        TestRenderGraph renderGraph;
+        canvas.Build(renderGraph);
+        const AZStd::vector<const LyShine::UiPrimitive*> fullBuildPrimitives = renderGraph.GetPrimitives();
+        EXPECT_EQ(fullBuildPrimitives.size(), canvas.m_elements.size());
+
+        // invalidate a leaf element in the second group
+        const int groupIndex = 7;
+        const int leafIndex = 9;
+        canvas.ResetRenderCounts();
+        canvas.InvalidateElement(renderGraph, leafIndex);
+        EXPECT_TRUE(renderGraph.GetDirtyFlag());
+        EXPECT_TRUE(renderGraph.GetPrimitives().empty());
+
+        canvas.Build(renderGraph);
+
+        for (int elementIndex = 0; elementIndex < aznumeric_cast<int>(canvas.m_elements.size()); ++elementIndex)
+        {
+            const bool shouldRender = elementIndex == 0 || elementIndex == groupIndex || elementIndex == leafIndex;
+            EXPECT_EQ(canvas.m_elements[elementIndex].m_renderCount, shouldRender ? 1 : 0);
+        }
+        EXPECT_EQ(renderGraph.GetNumReplayedElements(), aznumeric_cast<int>(canvas.m_elements.size()) - 3);
+        EXPECT_EQ(renderGraph.GetPrimitives(), fullBuildPrimitives);
+    }
+
+    TEST_F(LyShineRenderGraphTest, Build_InvalidatedParent_ChildrenRenderAgain)
+    {
+        TestCanvas canvas(4, 5);
+        TestRenderGraph renderGraph;
+        canvas.Build(renderGraph);
+
+        const int groupIndex = 1;
+        canvas.ResetRenderCounts();
+        canvas.InvalidateElement(renderGraph, groupIndex);
+        canvas.Build(renderGraph);
+
+        EXPECT_EQ(canvas.m_elements[0].m_renderCount, 1);
+        EXPECT_EQ(canvas.m_elements[groupIndex].m_renderCount, 1);
+        for (int childIndex : canvas.m_elements[groupIndex].m_children)
+        {
+            EXPECT_EQ(canvas.m_elements[childIndex].m_renderCount, 1);
+        }
+        EXPECT_EQ(canvas.m_elements[7].m_renderCount, 0);
+    }
+
+    TEST_F(LyShineRenderGraphTest, Build_ReplayedElementsInvalidatedLater_ReplayChildren)
+    {
+        TestCanvas canvas(4, 5);
+        TestRenderGraph renderGraph;
+        canvas.Build(renderGraph);
+        const AZStd::vector<const LyShine::UiPrimitive*> fullBuildPrimitives = renderGraph.GetPrimitives();
+
+        // The records of replayed elements must be carried over, so their children can be replayed in later builds
+        canvas.InvalidateElement(renderGraph, 2);
+        canvas.Build(renderGraph);
+
+        canvas.ResetRenderCounts();
+        canvas.InvalidateElement(renderGraph, 15);
+        canvas.Build(renderGraph);
+
+        EXPECT_EQ(canvas.m_elements[0].m_renderCount, 1);
+        EXPECT_EQ(canvas.m_elements[13].m_renderCount, 1);
+        EXPECT_EQ(canvas.m_elements[15].m_renderCount, 1);
+        EXPECT_EQ(canvas.m_elements[2].m_renderCount, 0);
+        EXPECT_EQ(canvas.m_elements[14].m_renderCount, 0);
+        EXPECT_EQ(renderGraph.GetPrimitives(), fullBuildPrimitives);
+    }
+
+    TEST_F(LyShineRenderGraphTest, SetDirtyFlag_AfterInvalidateElement_AllElementsRender)
+    {
+        TestCanvas canvas(4, 5);
+        TestRenderGraph renderGraph;
+        canvas.Build(renderGraph);
+
+        canvas.ResetRenderCounts();
+        canvas.InvalidateElement(renderGraph, 3);
+        renderGraph.SetDirtyFlag(true);
+        canvas.Build(renderGraph);
+
+        for (const TestCanvas::Element& element : canvas.m_elements)
+        {
+            EXPECT_EQ(element.m_renderCount, 1);
+        }
+        EXPECT_EQ(renderGraph.GetNumReplayedElements(), 0);
+    }
+
+    TEST_F(LyShineRenderGraphTest, Build_ReplayedDynamicQuad_IsKept)
+    {
+        TestCanvas canvas(2, 2);
+        canvas.m_elements[2].m_useDynamicQuad = true;
+        TestRenderGraph renderGraph;
+        canvas.Build(renderGraph);
+        const LyShine::UiPrimitive* dynamicQuadPrimitive = canvas.m_elements[2].m_dynamicQuadPrimitive;
+
+        canvas.ResetRenderCounts();
+        canvas.InvalidateElement(renderGraph, 5);
+        canvas.Build(renderGraph);
+
+        EXPECT_EQ(canvas.m_elements[2].m_renderCount, 0);
+        const AZStd::vector<const LyShine::UiPrimitive*> primitives = renderGraph.GetPrimitives();
+        EXPECT_NE(AZStd::find(primitives.begin(), primitives.end(), dynamicQuadPrimitive), primitives.end());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class LyShineRenderGraphBenchmark
+        : public AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+    };
+
+    // Rebuilds the graph of a canvas with N elements after a single leaf element changed, the range is the number of elements
+    BENCHMARK_DEFINE_F(LyShineRenderGraphBenchmark, BM_RebuildOneDirtyElement)(benchmark::State& state)
+    {
+        const int numChildrenPerGroup = 20;
+        TestCanvas canvas(aznumeric_cast<int>(state.range(0)) / numChildrenPerGroup, numChildrenPerGroup - 1);
+        TestRenderGraph renderGraph;
+        canvas.Build(renderGraph);
+
+        const int dirtyElementIndex = aznumeric_cast<int>(canvas.m_elements.size()) / 2;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            canvas.InvalidateElement(renderGraph, dirtyElementIndex);
+            canvas.Build(renderGraph);
+        }
+    }
+    BENCHMARK_REGISTER_F(LyShineRenderGraphBenchmark, BM_RebuildOneDirtyElement)->Arg(200)->Arg(2000)->Arg(20000)->Unit(benchmark::kMicrosecond);
+
+    // The same canvas fully rebuilt, which is what any change used to cause
+    BENCHMARK_DEFINE_F(LyShineRenderGraphBenchmark, BM_RebuildAllElements)(benchmark::State& state)
+    {
+        const int numChildrenPerGroup = 20;
+        TestCanvas canvas(aznumeric_cast<int>(state.range(0)) / numChildrenPerGroup, numChildrenPerGroup - 1);
+        TestRenderGraph renderGraph;
+        canvas.Build(renderGraph);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            renderGraph.SetDirtyFlag(true);
+            canvas.Build(renderGraph);
+        }
+    }
+    BENCHMARK_REGISTER_F(LyShineRenderGraphBenchmark, BM_RebuildAllElements)->Arg(200)->Arg(2000)->Arg(20000)->Unit(benchmark::kMicrosecond);
+#endif
+} // namespace UnitTest
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <UiTextLayoutCache.h>
+
+namespace UnitTest
+{
+    // The cache only compares the keys, so the layouts don't need actual fonts
+    static UiTextComponent::TextLayoutKey CreateLayoutKey(const AZStd::string& text, float availableWidth = 200.0f)
+    {
+        UiTextComponent::TextLayoutKey key;
+        key.text = text;
+        key.fontSize = 24.0f;
+        key.wrapText = true;
+        key.availableWidth = availableWidth;
+        return key;
+    }
+
+    using LyShineTextLayoutCacheTest = AllocatorsTestFixture;
+
+    TEST_F(LyShineTextLayoutCacheTest, Find_StoredKey_ReturnsLayoutAndCountsHit)
+    {
+        UiTextLayoutCache cache;
+        auto layout = AZStd::make_shared<UiTextLayoutCache::Layout>();
+        cache.Store(CreateLayoutKey("Player 1"), layout);
+
+        EXPECT_EQ(cache.Find(CreateLayoutKey("Player 1")), layout);
+        EXPECT_EQ(cache.Find(CreateLayoutKey("Player 2")), nullptr);
+        EXPECT_EQ(cache.Find(CreateLayoutKey("Player 1", 100.0f)), nullptr);
+
+        const UiTextLayoutCache::Stats stats = cache.GetStats();
+        EXPECT_EQ(stats.m_hits, 1u);
+        EXPECT_EQ(stats.m_misses, 2u);
+        EXPECT_EQ(stats.m_numEntries, 1u);
+    }
+
+    TEST_F(LyShineTextLayoutCacheTest, Store_OverLimit_EvictsLeastRecentlyUsed)
+    {
+        UiTextLayoutCache cache(2);
+        cache.Store(CreateLayoutKey("First"), AZStd::make_shared<UiTextLayoutCache::Layout>());
+        cache.Store(CreateLayoutKey("Second"), AZStd::make_shared<UiTextLayoutCache::Layout>());
+
+        // Using the first layout makes the second one the least recently used
+        EXPECT_NE(cache.Find(CreateLayoutKey("First")), nullptr);
+        cache.Store(CreateLayoutKey("Third"), AZStd::make_shared<UiTextLayoutCache::Layout>());
+
+        EXPECT_NE(cache.Peek(CreateLayoutKey("First")), nullptr);
+        EXPECT_EQ(cache.Peek(CreateLayoutKey("Second")), nullptr);
+        EXPECT_NE(cache.Peek(CreateLayoutKey("Third")), nullptr);
+        EXPECT_EQ(cache.GetStats().m_evictions, 1u);
+    }
+
+    TEST_F(LyShineTextLayoutCacheTest, SetMaxNumEntries_Zero_DisablesCache)
+    {
+        UiTextLayoutCache cache;
+        cache.Store(CreateLayoutKey("Player 1"), AZStd::make_shared<UiTextLayoutCache::Layout>());
+
+        cache.SetMaxNumEntries(0);
+        cache.Store(CreateLayoutKey("Player 2"), AZStd::make_shared<UiTextLayoutCache::Layout>());
+
+        EXPECT_EQ(cache.Find(CreateLayoutKey("Player 1")), nullptr);
+        EXPECT_EQ(cache.Find(CreateLayoutKey("Player 2")), nullptr);
+        EXPECT_EQ(cache.GetStats().m_numEntries, 0u);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    using LyShineTextLayoutCacheBenchmark = AllocatorsBenchmarkFixture;
+
+    // Looks up the layouts of a scoreboard of N text elements showing 10 distinct values that change every tick, the range is
+    // the number of elements. Without fonts the layouts can't be calculated here, so this measures the overhead the cache adds to
+    // every text update and the hit rate, the layout time saved per hit is covered by the LyShine startup unit-tests.
+    BENCHMARK_DEFINE_F(LyShineTextLayoutCacheBenchmark, BM_ScoreboardLookup)(benchmark::State& state)
+    {
+        const int numElements = aznumeric_cast<int>(state.range(0));
+        UiTextLayoutCache cache;
+
+        int tick = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int i = 0; i < numElements; ++i)
+            {
+                const UiTextComponent::TextLayoutKey key =
+                    CreateLayoutKey(AZStd::string::format("Player %d  Kills %d  Deaths %d", i % 10, tick % 7, tick % 3));
+                if (!cache.Find(key))
+                {
+                    cache.Store(key, AZStd::make_shared<UiTextLayoutCache::Layout>());
+                }
+            }
+            ++tick;
+        }
+
+        const UiTextLayoutCache::Stats stats = cache.GetStats();
+        state.counters["HitRate"] = aznumeric_cast<double>(stats.m_hits) / aznumeric_cast<double>(AZStd::max<AZ::u64>(stats.m_hits + stats.m_misses, 1));
+        state.SetItemsProcessed(state.iterations() * numElements);
+    }
+
+    BENCHMARK_REGISTER_F(LyShineTextLayoutCacheBenchmark, BM_ScoreboardLookup)->RangeMultiplier(10)->Range(30, 3000)->Unit(benchmark::kMicrosecond);
+#endif
+} // namespace UnitTest
@@ -9,11 +9,13 @@
 set(FILES
     Tests/LyShineTest.h
     Tests/AnimationTest.cpp
+    Tests/RenderGraphTest.cpp
     Tests/SpriteTest.cpp
     Tests/SerializationTest.cpp
     Tests/TextInputComponentTest.cpp
     Tests/UiDynamicScrollBoxComponentTest.cpp
     Tests/UiScrollBarComponentTest.cpp
+    Tests/UiTextLayoutCacheTest.cpp
     Tests/UiTooltipComponentTest.cpp
     Tests/Mocks/UiDynamicScrollBoxDataBusHandlerMock.h
 )
@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+
+#include <Allocators.h>
+#include <BruteForceSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(BruteForceSearch, MotionMatchAllocator, 0)
+
+    using Vec4 = AZ::Simd::Vec4;
+
+    bool BruteForceSearch::Init(const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features, Precision precision)
+    {
+        Clear();
+
+        // Collect the feature matrix columns in the order the query values get filled, skipping the same features as KdTree::CalcNumDimensions().
+        AZStd::vector<size_t> columns;
+        for (const Feature* feature : features)
+        {
+            if (feature->GetId().IsNull())
+            {
+                continue;
+            }
+
+            const size_t columnOffset = feature->GetColumnOffset();
+            for (size_t i = 0; i < feature->GetNumDimensions(); ++i)
+            {
+                columns.emplace_back(columnOffset + i);
+            }
+        }
+
+        if (columns.empty())
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize brute force search. None of the given features holds any values.");
+            return false;
+        }
+
+        m_numDimensions = columns.size();
+        m_numFrames = featureMatrix.rows();
+        m_precision = precision;
+
+        if (m_precision == Precision::Float)
+        {
+            m_numBlocks = (m_numFrames + s_numLanes - 1) / s_numLanes;
+            m_floatValues.resize(m_numBlocks * m_numDimensions * s_numLanes, 0.0f);
+
+            for (size_t frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+            {
+                const size_t block = frameIndex / s_numLanes;
+                const size_t lane = frameIndex % s_numLanes;
+                for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+                {
+                    m_floatValues[(block * m_numDimensions + dimension) * s_numLanes + lane] = featureMatrix(frameIndex, columns[dimension]);
+                }
+            }
+        }
+        else
+        {
+            // Find the value range per dimension to get the most out of the available bits.
+            m_minValues.resize(m_numDimensions, FLT_MAX);
+            m_stepSizes.resize(m_numDimensions, 0.0f);
+            AZStd::vector<float> maxValues(m_numDimensions, -FLT_MAX);
+            for (size_t frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+            {
+                for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+                {
+                    const float value = featureMatrix(frameIndex, columns[dimension]);
+                    m_minValues[dimension] = AZ::GetMin(m_minValues[dimension], value);
+                    maxValues[dimension] = AZ::GetMax(maxValues[dimension], value);
+                }
+            }
+
+            AZStd::vector<float> invStepSizes(m_numDimensions, 0.0f);
+            for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+            {
+                const float range = maxValues[dimension] - m_minValues[dimension];
+                if (range > 0.0f)
+                {
+                    m_stepSizes[dimension] = range / s_maxQuantizedValue;
+                    invStepSizes[dimension] = s_maxQuantizedValue / range;
+                }
+            }
+
+            // Every lane packs two frames, the lower 16 bits store frame [lane] and the upper 16 bits frame [lane + s_numLanes] of the block.
+            const size_t numFramesPerBlock = s_numLanes * 2;
+            m_numBlocks = (m_numFrames + numFramesPerBlock - 1) / numFramesPerBlock;
+            m_quantizedValues.resize(m_numBlocks * m_numDimensions * s_numLanes, 0);
+
+            for (size_t frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+            {
+                const size_t block = frameIndex / numFramesPerBlock;
+                const size_t lane = frameIndex % s_numLanes;
+                const bool upperHalf = (frameIndex % numFramesPerBlock) >= s_numLanes;
+                for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+                {
+                    const float value = featureMatrix(frameIndex, columns[dimension]);
+                    const float quantized = AZ::GetClamp(AZStd::round((value - m_minValues[dimension]) * invStepSizes[dimension]), 0.0f, s_maxQuantizedValue);
+                    const AZ::s32 bits = static_cast<AZ::s32>(quantized);
+
+                    AZ::s32& packed = m_quantizedValues[(block * m_numDimensions + dimension) * s_numLanes + lane];
+                    packed |= upperHalf ? (bits << 16) : bits;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void BruteForceSearch::Clear()
+    {
+        m_floatValues.clear();
+        m_floatValues.shrink_to_fit();
+        m_quantizedValues.clear();
+        m_quantizedValues.shrink_to_fit();
+        m_minValues.clear();
+        m_stepSizes.clear();
+        m_numDimensions = 0;
+        m_numFrames = 0;
+        m_numBlocks = 0;
+    }
+
+    size_t BruteForceSearch::CalcMemoryUsageInBytes() const
+    {
+        size_t totalBytes = sizeof(BruteForceSearch);
+        totalBytes += m_floatValues.capacity() * sizeof(float);
+        totalBytes += m_quantizedValues.capacity() * sizeof(AZ::s32);
+        totalBytes += m_minValues.capacity() * sizeof(float);
+        totalBytes += m_stepSizes.capacity() * sizeof(float);
+        return totalBytes;
+    }
+
+    void BruteForceSearch::PrepareQuery(const AZStd::vector<float>& queryValues, AZStd::vector<float>& outPreparedQuery) const
+    {
+        AZ_Assert(queryValues.size() == m_numDimensions, "The query holds %zu values while the search expects %zu.", queryValues.size(), m_numDimensions);
+
+        if (m_precision == Precision::Float)
+        {
+            // distance = value - query
+            outPreparedQuery.resize(m_numDimensions * s_numLanes);
+            for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+            {
+                AZStd::fill_n(&outPreparedQuery[dimension * s_numLanes], s_numLanes, -queryValues[dimension]);
+            }
+        }
+        else
+        {
+            // distance = quantizedValue * stepSize + (minValue - query)
+            // The values stored in the upper 16 bits are not shifted down, but scaled by the step size divided by 2^16 instead.
+            outPreparedQuery.resize(m_numDimensions * s_numLanes * 3);
+            for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+            {
+                float* dimensionValues = &outPreparedQuery[dimension * s_numLanes * 3];
+                AZStd::fill_n(dimensionValues, s_numLanes, m_minValues[dimension] - queryValues[dimension]);
+                AZStd::fill_n(dimensionValues + s_numLanes, s_numLanes, m_stepSizes[dimension]);
+                AZStd::fill_n(dimensionValues + s_numLanes * 2, s_numLanes, m_stepSizes[dimension] / 65536.0f);
+            }
+        }
+    }
+
+    void BruteForceSearch::SearchBlocks(const float* preparedQuery, size_t startBlock, size_t endBlock, CandidateHeap& heap) const
+    {
+        if (m_precision == Precision::Float)
+        {
+            SearchBlocksFloat(preparedQuery, startBlock, endBlock, heap);
+        }
+        else
+        {
+            SearchBlocksQuantized(preparedQuery, startBlock, endBlock, heap);
+        }
+    }
+
+    void BruteForceSearch::SearchBlocksFloat(const float* preparedQuery, size_t startBlock, size_t endBlock, CandidateHeap& heap) const
+    {
+        alignas(16) float distances[s_numLanes];
+        float threshold = heap.GetThreshold();
+
+        for (size_t block = startBlock; block < endBlock; ++block)
+        {
+            const float* values = &m_floatValues[block * m_numDimensions * s_numLanes];
+
+            Vec4::FloatType distance = Vec4::ZeroFloat();
+            for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+            {
+                const Vec4::FloatType diff = Vec4::Add(
+                    Vec4::LoadUnaligned(values + dimension * s_numLanes),
+                    Vec4::LoadUnaligned(preparedQuery + dimension * s_numLanes));
+                distance = Vec4::Madd(diff, diff, distance);
+            }
+
+            // Skip the block in case none of the frames is closer than the furthest one we already found.
+            if (Vec4::CmpAllGtEq(distance, Vec4::Splat(threshold)))
+            {
+                continue;
+            }
+
+            Vec4::StoreAligned(distances, distance);
+            const size_t startFrame = block * s_numLanes;
+            const size_t numValidLanes = AZ::GetMin(s_numLanes, m_numFrames - startFrame);
+            for (size_t lane = 0; lane < numValidLanes; ++lane)
+            {
+                if (distances[lane] < threshold)
+                {
+                    heap.Insert(distances[lane], startFrame + lane);
+                    threshold = heap.GetThreshold();
+                }
+            }
+        }
+    }
+
+    void BruteForceSearch::SearchBlocksQuantized(const float* preparedQuery, size_t startBlock, size_t endBlock, CandidateHeap& heap) const
+    {
+        alignas(16) float distances[s_numLanes * 2];
+        float threshold = heap.GetThreshold();
+
+        const Vec4::Int32Type lowerMask = Vec4::Splat(static_cast<int32_t>(0x0000FFFF));
+        const Vec4::Int32Type upperMask = Vec4::Splat(static_cast<int32_t>(0xFFFF0000));
+
+        for (size_t block = startBlock; block < endBlock; ++block)
+        {
+            const AZ::s32* values = &m_quantizedValues[block * m_numDimensions * s_numLanes];
+
+            Vec4::FloatType lowerDistance = Vec4::ZeroFloat();
+            Vec4::FloatType upperDistance = Vec4::ZeroFloat();
+            for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+            {
+                const Vec4::Int32Type packed = Vec4::LoadUnaligned(values + dimension * s_numLanes);
+                const float* dimensionQuery = preparedQuery + dimension * s_numLanes * 3;
+                const Vec4::FloatType offset = Vec4::LoadUnaligned(dimensionQuery);
+
+                const Vec4::FloatType lowerDiff = Vec4::Madd(
+                    Vec4::ConvertToFloat(Vec4::And(packed, lowerMask)), Vec4::LoadUnaligned(dimensionQuery + s_numLanes), offset);
+                const Vec4::FloatType upperDiff = Vec4::Madd(
+                    Vec4::ConvertToFloat(Vec4::And(packed, upperMask)), Vec4::LoadUnaligned(dimensionQuery + s_numLanes * 2), offset);
+
+                lowerDistance = Vec4::Madd(lowerDiff, lowerDiff, lowerDistance);
+                upperDistance = Vec4::Madd(upperDiff, upperDiff, upperDistance);
+            }
+
+            const Vec4::FloatType thresholdLanes = Vec4::Splat(threshold);
+            if (Vec4::CmpAllGtEq(lowerDistance, thresholdLanes) && Vec4::CmpAllGtEq(upperDistance, thresholdLanes))
+            {
+                continue;
+            }
+
+            Vec4::StoreAligned(distances, lowerDistance);
+            Vec4::StoreAligned(distances + s_numLanes, upperDistance);
+            const size_t startFrame = block * s_numLanes * 2;
+            const size_t numValidFrames = AZ::GetMin(s_numLanes * 2, m_numFrames - startFrame);
+            for (size_t i = 0; i < numValidFrames; ++i)
+            {
+                if (distances[i] < threshold)
+                {
+                    heap.Insert(distances[i], startFrame + i);
+                    threshold = heap.GetThreshold();
+                }
+            }
+        }
+    }
+
+    void BruteForceSearch::FindNearestNeighbors(const AZStd::vector<float>& queryValues, size_t maxResults, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        AZ_Assert(IsInitialized(), "Expecting an initialized brute force search. Did you forget to call BruteForceSearch::Init()?");
+
+        AZStd::vector<float> preparedQuery;
+        PrepareQuery(queryValues, preparedQuery);
+
+        CandidateHeap heap;
+        heap.Reset(maxResults);
+        SearchBlocks(preparedQuery.data(), 0, m_numBlocks, heap);
+        heap.GetSortedFrameIndices(resultFrameIndices);
+    }
+
+    void BruteForceSearch::FindNearestNeighbors(const AZStd::vector<Query>& queries, size_t maxResults) const
+    {
+        AZ_Assert(IsInitialized(), "Expecting an initialized brute force search. Did you forget to call BruteForceSearch::Init()?");
+        const size_t numQueries = queries.size();
+        if (numQueries == 0)
+        {
+            return;
+        }
+
+        AZStd::vector<AZStd::vector<float>> preparedQueries(numQueries);
+        for (size_t queryIndex = 0; queryIndex < numQueries; ++queryIndex)
+        {
+            PrepareQuery(*queries[queryIndex].m_queryValues, preparedQueries[queryIndex]);
+        }
+
+        const size_t numFramesPerBlock = (m_precision == Precision::Float) ? s_numLanes : s_numLanes * 2;
+        const size_t numBlocksPerJob = s_numFramesPerJob / numFramesPerBlock;
+        const size_t numJobs = (m_numBlocks + numBlocksPerJob - 1) / numBlocksPerJob;
+
+        // One heap per job and query, merged after all jobs finished.
+        AZStd::vector<CandidateHeap> heaps(numJobs * numQueries);
+
+        auto searchJobRange = [this, &preparedQueries, &heaps, numQueries, numBlocksPerJob, maxResults](size_t jobIndex)
+        {
+            // Search a few blocks for all queries before moving on, so that the feature values stay in the cache.
+            constexpr size_t numBlocksPerChunk = 32;
+            const size_t startBlock = jobIndex * numBlocksPerJob;
+            const size_t endBlock = AZStd::min(startBlock + numBlocksPerJob, m_numBlocks);
+
+            CandidateHeap* jobHeaps = &heaps[jobIndex * numQueries];
+            for (size_t queryIndex = 0; queryIndex < numQueries; ++queryIndex)
+            {
+                jobHeaps[queryIndex].Reset(maxResults);
+            }
+
+            for (size_t chunkStart = startBlock; chunkStart < endBlock; chunkStart += numBlocksPerChunk)
+            {
+                const size_t chunkEnd = AZStd::min(chunkStart + numBlocksPerChunk, endBlock);
+                for (size_t queryIndex = 0; queryIndex < numQueries; ++queryIndex)
+                {
+                    SearchBlocks(preparedQueries[queryIndex].data(), chunkStart, chunkEnd, jobHeaps[queryIndex]);
+                }
+            }
+        };
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (numJobs > 1 && jobContext)
+        {
+            AZ::JobCompletion jobCompletion;
+            for (size_t jobIndex = 0; jobIndex < numJobs; ++jobIndex)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([&searchJobRange, jobIndex]()
+                    {
+                        searchJobRange(jobIndex);
+                    }, /*isAutoDelete=*/true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (size_t jobIndex = 0; jobIndex < numJobs; ++jobIndex)
+            {
+                searchJobRange(jobIndex);
+            }
+        }
+
+        // Merge the candidates the jobs found into the heaps of the first job.
+        for (size_t queryIndex = 0; queryIndex < numQueries; ++queryIndex)
+        {
+            CandidateHeap& heap = heaps[queryIndex];
+            for (size_t jobIndex = 1; jobIndex < numJobs; ++jobIndex)
+            {
+                heap.Merge(heaps[jobIndex * numQueries + queryIndex]);
+            }
+            heap.GetSortedFrameIndices(*queries[queryIndex].m_resultFrameIndices);
+        }
+    }
+
+    void BruteForceSearch::CandidateHeap::Reset(size_t maxResults)
+    {
+        m_candidates.clear();
+        m_candidates.reserve(maxResults);
+        m_maxResults = maxResults;
+    }
+
+    float BruteForceSearch::CandidateHeap::GetThreshold() const
+    {
+        if (m_candidates.size() < m_maxResults)
+        {
+            return FLT_MAX;
+        }
+
+        return m_maxResults > 0 ? m_candidates.front().m_distance : -FLT_MAX;
+    }
+
+    void BruteForceSearch::CandidateHeap::Insert(float distance, size_t frameIndex)
+    {
+        if (m_candidates.size() < m_maxResults)
+        {
+            m_candidates.push_back({ distance, frameIndex });
+            AZStd::push_heap(m_candidates.begin(), m_candidates.end());
+        }
+        else if (m_maxResults > 0 && distance < m_candidates.front().m_distance)
+        {
+            // Replace the furthest candidate.
+            AZStd::pop_heap(m_candidates.begin(), m_candidates.end());
+            m_candidates.back() = { distance, frameIndex };
+            AZStd::push_heap(m_candidates.begin(), m_candidates.end());
+        }
+    }
+
+    void BruteForceSearch::CandidateHeap::Merge(const CandidateHeap& other)
+    {
+        for (const Candidate& candidate : other.m_candidates)
+        {
+            Insert(candidate.m_distance, candidate.m_frameIndex);
+        }
+    }
+
+    void BruteForceSearch::CandidateHeap::GetSortedFrameIndices(AZStd::vector<size_t>& resultFrameIndices)
+    {
+        AZStd::sort(m_candidates.begin(), m_candidates.end());
+
+        resultFrameIndices.resize(m_candidates.size());
+        for (size_t i = 0; i < m_candidates.size(); ++i)
+        {
+            resultFrameIndices[i] = m_candidates[i].m_frameIndex;
+        }
+    }
+} // namespace EMotionFX::MotionMatching
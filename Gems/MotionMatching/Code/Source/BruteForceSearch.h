@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+#include <Feature.h>
+#include <FeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Broad-phase search alternative to the KD-tree that compares the query against every frame in the motion database.
+    //! The feature values of the searched features are copied out of the feature matrix into a contiguous structure-of-arrays layout,
+    //! where the values of one dimension for a block of frames are stored next to each other. This allows to calculate the distances
+    //! for multiple frames at once using SIMD. Optionally, the values are quantized to 15 bits per value which halves the memory bandwidth.
+    //! Unlike the KD-tree, which returns all frames of a leaf node, the search returns the closest frames sorted by their squared euclidean distance.
+    class EMFX_API BruteForceSearch
+    {
+    public:
+        AZ_RTTI(BruteForceSearch, "{4A6D6F4B-55A1-4D4B-9E1F-2B7C3E18A0D5}")
+        AZ_CLASS_ALLOCATOR_DECL
+
+        enum class Precision : AZ::u8
+        {
+            Float, //< Full precision, 4 bytes per value.
+            Quantized //< Values are quantized per dimension between the minimum and maximum value, 2 bytes per value.
+        };
+
+        BruteForceSearch() = default;
+        virtual ~BruteForceSearch() = default;
+
+        bool Init(const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features, Precision precision = Precision::Quantized);
+        void Clear();
+
+        bool IsInitialized() const { return m_numDimensions != 0; }
+        size_t GetNumDimensions() const { return m_numDimensions; }
+        size_t GetNumFrames() const { return m_numFrames; }
+        Precision GetPrecision() const { return m_precision; }
+        size_t CalcMemoryUsageInBytes() const;
+
+        //! Find the frames closest to the given query.
+        //! @param[in] queryValues The query feature values in the same order as the features passed to Init(), as filled by Feature::FillQueryFeatureValues().
+        //! @param[in] maxResults The maximum number of frames to return.
+        //! @param[out] resultFrameIndices The indices of the closest frames, sorted by distance with the closest frame first.
+        void FindNearestNeighbors(const AZStd::vector<float>& queryValues, size_t maxResults, AZStd::vector<size_t>& resultFrameIndices) const;
+
+        struct Query
+        {
+            const AZStd::vector<float>* m_queryValues = nullptr;
+            AZStd::vector<size_t>* m_resultFrameIndices = nullptr;
+        };
+
+        //! Find the closest frames for several queries at once, e.g. for all motion matching instances using the same motion database.
+        //! The frames are split into ranges that are searched in parallel by the job system, while every range is evaluated against all queries.
+        //! This way the feature data only needs to be streamed through the cache once for all queries.
+        void FindNearestNeighbors(const AZStd::vector<Query>& queries, size_t maxResults) const;
+
+    private:
+        struct Candidate
+        {
+            float m_distance;
+            size_t m_frameIndex;
+
+            bool operator<(const Candidate& other) const { return m_distance < other.m_distance; }
+        };
+
+        //! Bounded max-heap holding the closest frames found so far.
+        class CandidateHeap
+        {
+        public:
+            void Reset(size_t maxResults);
+            float GetThreshold() const;
+            void Insert(float distance, size_t frameIndex);
+            void Merge(const CandidateHeap& other);
+            void GetSortedFrameIndices(AZStd::vector<size_t>& resultFrameIndices);
+
+        private:
+            AZStd::vector<Candidate> m_candidates;
+            size_t m_maxResults = 0;
+        };
+
+        //! Query values converted into the layout used by the search kernels, every value splatted across all SIMD lanes.
+        void PrepareQuery(const AZStd::vector<float>& queryValues, AZStd::vector<float>& outPreparedQuery) const;
+
+        void SearchBlocks(const float* preparedQuery, size_t startBlock, size_t endBlock, CandidateHeap& heap) const;
+        void SearchBlocksFloat(const float* preparedQuery, size_t startBlock, size_t endBlock, CandidateHeap& heap) const;
+        void SearchBlocksQuantized(const float* preparedQuery, size_t startBlock, size_t endBlock, CandidateHeap& heap) const;
+
+        static constexpr size_t s_numLanes = 4;
+        static constexpr size_t s_numFramesPerJob = 8192; //< Number of frames each job searches in the batched search.
+        static constexpr float s_maxQuantizedValue = 32767.0f; //< 15 bits, so that the higher of the two values packed into an int32 never hits the sign bit.
+
+        AZStd::vector<float> m_floatValues; //< [block][dimension][lane] with s_numLanes frames per block.
+        AZStd::vector<AZ::s32> m_quantizedValues; //< [block][dimension][lane] with 2 * s_numLanes frames per block, two 16 bit values packed per lane.
+        AZStd::vector<float> m_minValues; //< Per dimension minimum value, used for dequantization.
+        AZStd::vector<float> m_stepSizes; //< Per dimension dequantization step size.
+        size_t m_numDimensions = 0;
+        size_t m_numFrames = 0;
+        size_t m_numBlocks = 0;
+        Precision m_precision = Precision::Quantized;
+    };
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+
+#include <Allocators.h>
+#include <BruteForceSearchBatcher.h>
+#include <MotionMatchingInstance.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CVAR_EXTERNED(uint32_t, mm_bruteForceSearchNumResults);
+
+    AZ_CLASS_ALLOCATOR_IMPL(BruteForceSearchBatcher, MotionMatchAllocator, 0)
+
+    BruteForceSearchBatcher::BruteForceSearchBatcher()
+    {
+        if (BruteForceSearchBatcherInterface::Get() == nullptr)
+        {
+            BruteForceSearchBatcherInterface::Register(this);
+        }
+    }
+
+    BruteForceSearchBatcher::~BruteForceSearchBatcher()
+    {
+        if (BruteForceSearchBatcherInterface::Get() == this)
+        {
+            BruteForceSearchBatcherInterface::Unregister(this);
+        }
+    }
+
+    void BruteForceSearchBatcher::Activate()
+    {
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void BruteForceSearchBatcher::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    void BruteForceSearchBatcher::RegisterInstance(MotionMatchingInstance* instance)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (AZStd::find(m_instances.begin(), m_instances.end(), instance) == m_instances.end())
+        {
+            m_instances.emplace_back(instance);
+        }
+    }
+
+    void BruteForceSearchBatcher::UnregisterInstance(MotionMatchingInstance* instance)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        const auto iterator = AZStd::find(m_instances.begin(), m_instances.end(), instance);
+        if (iterator != m_instances.end())
+        {
+            *iterator = m_instances.back();
+            m_instances.pop_back();
+        }
+    }
+
+    void BruteForceSearchBatcher::SearchPendingQueries()
+    {
+        AZ_PROFILE_SCOPE(Animation, "BruteForceSearchBatcher::SearchPendingQueries");
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        // Group the queries by the brute force search of the motion database the instances use.
+        for (auto& [search, queries] : m_queriesPerSearch)
+        {
+            queries.clear();
+        }
+        bool hasPendingQueries = false;
+        for (MotionMatchingInstance* instance : m_instances)
+        {
+            if (const BruteForceSearch* search = instance->GetPendingBroadPhaseSearch())
+            {
+                m_queriesPerSearch[search].emplace_back(instance->GetPendingBroadPhaseQuery());
+                hasPendingQueries = true;
+            }
+        }
+        if (!hasPendingQueries)
+        {
+            return;
+        }
+
+        for (const auto& [search, queries] : m_queriesPerSearch)
+        {
+            if (!queries.empty())
+            {
+                search->FindNearestNeighbors(queries, mm_bruteForceSearchNumResults);
+            }
+        }
+
+        for (MotionMatchingInstance* instance : m_instances)
+        {
+            if (instance->GetPendingBroadPhaseSearch())
+            {
+                instance->OnPendingBroadPhaseQuerySearched();
+            }
+        }
+
+        // Don't keep the queries of motion databases that are no longer used.
+        for (auto iterator = m_queriesPerSearch.begin(); iterator != m_queriesPerSearch.end();)
+        {
+            iterator = iterator->second.empty() ? m_queriesPerSearch.erase(iterator) : AZStd::next(iterator);
+        }
+    }
+
+    void BruteForceSearchBatcher::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        SearchPendingQueries();
+    }
+} // namespace EMotionFX::MotionMatching
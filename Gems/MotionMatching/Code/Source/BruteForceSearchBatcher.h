@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+#include <BruteForceSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class MotionMatchingInstance;
+
+    //! Collects the broad-phase queries of the motion matching instances that use the brute force search and searches them before the anim graphs get updated.
+    //! The instances prepare the query for their next search at the end of their update. The queries of all instances sharing a motion database are then
+    //! searched at once, so that its feature values are only streamed through the cache once per frame and the search is split across the job system.
+    //! Instances that search without a prepared query, e.g. because their update got called outside of the tick, fall back to searching on their own.
+    class BruteForceSearchBatcher
+        : public AZ::TickBus::Handler
+    {
+    public:
+        AZ_RTTI(BruteForceSearchBatcher, "{3C8F1E27-9B4D-4A62-8E5D-71C0A2F6B9E3}")
+        AZ_CLASS_ALLOCATOR_DECL
+
+        BruteForceSearchBatcher();
+        virtual ~BruteForceSearchBatcher();
+
+        void Activate();
+        void Deactivate();
+
+        void RegisterInstance(MotionMatchingInstance* instance);
+        void UnregisterInstance(MotionMatchingInstance* instance);
+
+        //! Search the pending queries of all registered instances. Called on tick, right before the anim graphs get updated.
+        void SearchPendingQueries();
+
+    protected:
+        // AZ::TickBus::Handler overrides
+        int GetTickOrder() override
+        {
+            return AZ::TICK_ANIMATION - 1;
+        }
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+    private:
+        AZStd::mutex m_mutex; //< Instances can be created and destroyed on any thread.
+        AZStd::vector<MotionMatchingInstance*> m_instances;
+        AZStd::unordered_map<const BruteForceSearch*, AZStd::vector<BruteForceSearch::Query>> m_queriesPerSearch; //< Kept around to not reallocate every frame.
+    };
+
+    using BruteForceSearchBatcherInterface = AZ::Interface<BruteForceSearchBatcher>;
+} // namespace EMotionFX::MotionMatching
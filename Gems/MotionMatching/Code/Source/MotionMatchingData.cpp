@@ -30,6 +30,7 @@
 namespace EMotionFX::MotionMatching
 {
     AZ_CVAR_EXTERNED(bool, mm_multiThreadedInitialization);
+    AZ_CVAR_EXTERNED(bool, mm_useBruteForceSearch);
 
     AZ_CLASS_ALLOCATOR_IMPL(MotionMatchingData, MotionMatchAllocator, 0)
 
@@ -44,7 +45,8 @@ namespace EMotionFX::MotionMatching
         Clear();
     }
 
-    bool MotionMatchingData::ExtractFeatures(ActorInstance* actorInstance, FrameDatabase* frameDatabase, size_t maxKdTreeDepth, size_t minFramesPerKdTreeNode)
+    bool MotionMatchingData::ExtractFeatures(ActorInstance* actorInstance, FrameDatabase* frameDatabase, size_t maxKdTreeDepth, size_t minFramesPerKdTreeNode,
+        BruteForceSearch::Precision bruteForceSearchPrecision)
     {
         AZ_PROFILE_SCOPE(Animation, "MotionMatchingData::ExtractFeatures");
         AZ::Debug::Timer timer;
@@ -144,6 +146,24 @@ namespace EMotionFX::MotionMatching
         }
 
         const float initKdTreeTimer = timer.GetDeltaTimeInSeconds();
+        timer.Stamp();
+
+        // Initialize the brute force search which uses the same features as the kd-tree. It copies the searched feature values,
+        // so only build it in case it is used.
+        if (mm_useBruteForceSearch)
+        {
+            m_bruteForceSearch = AZStd::make_unique<BruteForceSearch>();
+            if (!m_bruteForceSearch->Init(m_featureMatrix, m_featuresInKdTree, bruteForceSearchPrecision))
+            {
+                AZ_Error("EMotionFX", false, "Failed to initialize brute force search.");
+                return false;
+            }
+
+            const float initBruteForceSearchTimer = timer.GetDeltaTimeInSeconds();
+            AZ_Printf("MotionMatching", "Brute force search took %.2f ms to initialize and uses %.2f MB.",
+                initBruteForceSearchTimer * 1000.0f,
+                static_cast<float>(m_bruteForceSearch->CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f);
+        }
 
         AZ_Printf("MotionMatching", "Feature matrix (%zu, %zu) uses %.2f MB and took %.2f ms to initialize (KD-Tree %.2f ms).",
             m_featureMatrix.rows(),
@@ -230,7 +250,7 @@ namespace EMotionFX::MotionMatching
         }
 
         // Extract feature data and place the values into the feature matrix.
-        if (!ExtractFeatures(settings.m_actorInstance, &m_frameDatabase, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode))
+        if (!ExtractFeatures(settings.m_actorInstance, &m_frameDatabase, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode, settings.m_bruteForceSearchPrecision))
         {
             AZ_Error("Motion Matching", false, "Failed to extract features from motion database.");
             return false;
@@ -244,6 +264,7 @@ namespace EMotionFX::MotionMatching
         m_frameDatabase.Clear();
         m_featureMatrix.Clear();
         m_kdTree->Clear();
+        m_bruteForceSearch.reset();
         m_featuresInKdTree.clear();
     }
 } // namespace EMotionFX::MotionMatching
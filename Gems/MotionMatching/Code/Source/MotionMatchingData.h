@@ -14,6 +14,7 @@
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
 
+#include <BruteForceSearch.h>
 #include <Feature.h>
 #include <FeatureSchema.h>
 #include <FrameDatabase.h>
@@ -47,6 +48,7 @@ namespace EMotionFX::MotionMatching
             FrameDatabase::FrameImportSettings m_frameImportSettings;
             size_t m_maxKdTreeDepth = 20;
             size_t m_minFramesPerKdTreeNode = 1000;
+            BruteForceSearch::Precision m_bruteForceSearchPrecision = BruteForceSearch::Precision::Quantized;
             bool m_importMirrored = false;
         };
         bool Init(const InitSettings& settings);
@@ -58,11 +60,14 @@ namespace EMotionFX::MotionMatching
         const FeatureSchema& GetFeatureSchema() const { return m_featureSchema; }
         const FeatureMatrix& GetFeatureMatrix() const { return m_featureMatrix; }
         const KdTree& GetKdTree() const { return *m_kdTree.get(); }
+        //! The brute force search is only built when mm_useBruteForceSearch is enabled while the features get extracted, nullptr otherwise.
+        const BruteForceSearch* GetBruteForceSearch() const { return m_bruteForceSearch.get(); }
         const AZStd::vector<Feature*>& GetFeaturesInKdTree() const { return m_featuresInKdTree; }
 
     protected:
         //! Extract features from the motion database (multi-threaded).
-        bool ExtractFeatures(ActorInstance* actorInstance, FrameDatabase* frameDatabase, size_t maxKdTreeDepth=20, size_t minFramesPerKdTreeNode=2000);
+        bool ExtractFeatures(ActorInstance* actorInstance, FrameDatabase* frameDatabase, size_t maxKdTreeDepth=20, size_t minFramesPerKdTreeNode=2000,
+            BruteForceSearch::Precision bruteForceSearchPrecision = BruteForceSearch::Precision::Quantized);
 
         //! Extract features for a given range of frames and store the values in the feature matrix.
         static void ExtractFeatureValuesRange(ActorInstance* actorInstance, FrameDatabase& frameDatabase, const FeatureSchema& featureSchema, FeatureMatrix& featureMatrix, size_t startFrame, size_t endFrame);
@@ -75,6 +80,7 @@ namespace EMotionFX::MotionMatching
         FeatureMatrix m_featureMatrix;
 
         AZStd::unique_ptr<KdTree> m_kdTree; //< The acceleration structure to speed up the search for lowest cost frames.
+        AZStd::unique_ptr<BruteForceSearch> m_bruteForceSearch; //< SIMD broad-phase search over all frames, alternative to the KD-tree. Only created when enabled.
         AZStd::vector<Feature*> m_featuresInKdTree;
     };
 } // namespace EMotionFX::MotionMatching
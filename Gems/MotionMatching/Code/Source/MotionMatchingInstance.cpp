@@ -21,6 +21,7 @@
 #include <EMotionFX/Source/TransformData.h>
 
 #include <Allocators.h>
+#include <BruteForceSearchBatcher.h>
 #include <Feature.h>
 #include <FeatureSchema.h>
 #include <FeatureTrajectory.h>
@@ -39,6 +40,8 @@ namespace EMotionFX::MotionMatching
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryPose);
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryVelocities);
     AZ_CVAR_EXTERNED(bool, mm_useKdTree);
+    AZ_CVAR_EXTERNED(bool, mm_useBruteForceSearch);
+    AZ_CVAR_EXTERNED(uint32_t, mm_bruteForceSearchNumResults);
 
     AZ_CLASS_ALLOCATOR_IMPL(MotionMatchingInstance, MotionMatchAllocator, 0)
 
@@ -46,6 +49,11 @@ namespace EMotionFX::MotionMatching
     {
         DebugDrawRequestBus::Handler::BusDisconnect();
 
+        if (BruteForceSearchBatcher* batcher = BruteForceSearchBatcherInterface::Get())
+        {
+            batcher->UnregisterInstance(this);
+        }
+
         if (m_motionInstance)
         {
             GetMotionInstancePool().Free(m_motionInstance);
@@ -110,6 +118,15 @@ namespace EMotionFX::MotionMatching
         // Make sure we have enough space inside the frame floats array, which is used to search the kdTree.
         const size_t numValuesInKdTree = m_data->GetKdTree().GetNumDimensions();
         m_queryFeatureValues.resize(numValuesInKdTree);
+        m_pendingQueryFeatureValues.resize(numValuesInKdTree);
+        m_pendingBroadPhaseSearch = nullptr;
+        m_hasPrefetchedNearestFrames = false;
+
+        // Let the batcher search the broad-phase queries of all instances at once when the brute force search is used.
+        if (BruteForceSearchBatcher* batcher = BruteForceSearchBatcherInterface::Get())
+        {
+            batcher->RegisterInstance(this);
+        }
 
         // Initialize the trajectory history.
         if (m_cachedTrajectoryFeature)
@@ -390,26 +407,8 @@ namespace EMotionFX::MotionMatching
         if (searchLowestCostFrame)
         {
             // Calculate the input query pose for the motion matching search algorithm.
-            {
-                // Sample the pose for the new motion time as the motion instance has not been updated with the timeDelta from this frame yet.
-                SamplePose(m_motionInstance->GetMotion(), m_queryPose, newMotionTime);
-
-                // Copy over the motion extraction joint transform from the current pose to the newly sampled pose.
-                // When sampling a motion, the motion extraction joint is in animation space, while we need the query pose to be in world space.
-                // Note: This does not yet take the extraction delta from the current tick into account.
-                if (m_actorInstance->GetActor()->GetMotionExtractionNode())
-                {
-                    const Pose* currentPose = m_actorInstance->GetTransformData()->GetCurrentPose();
-                    const size_t motionExtractionJointIndex = m_actorInstance->GetActor()->GetMotionExtractionNodeIndex();
-                    m_queryPose.SetWorldSpaceTransform(motionExtractionJointIndex,
-                        currentPose->GetWorldSpaceTransform(motionExtractionJointIndex));
-                }
-
-                // Calculate the joint velocities for the sampled pose using the same method as we do for the frame database.
-                PoseDataJointVelocities* velocityPoseData = m_queryPose.GetAndPreparePoseData<PoseDataJointVelocities>(m_actorInstance);
-                AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(m_actorInstance->GetThreadIndex())->GetPosePool();
-                velocityPoseData->CalculateVelocity(m_actorInstance, posePool, m_motionInstance->GetMotion(), newMotionTime, m_cachedTrajectoryFeature->GetRelativeToNodeIndex());
-            }
+            // Sample the pose for the new motion time as the motion instance has not been updated with the timeDelta from this frame yet.
+            UpdateQueryPose(newMotionTime);
 
             const FeatureMatrix& featureMatrix = m_data->GetFeatureMatrix();
             const FrameDatabase& frameDatabase = m_data->GetFrameDatabase();
@@ -454,6 +453,8 @@ namespace EMotionFX::MotionMatching
             m_timeSinceLastFrameSwitch = 0.0f;
         }
 
+        PreparePendingBroadPhaseQuery(timePassedInSeconds);
+
         // ImGui monitor
         {
 #ifdef IMGUI_ENABLED
@@ -472,6 +473,83 @@ namespace EMotionFX::MotionMatching
         }
     }
 
+    void MotionMatchingInstance::UpdateQueryPose(float motionTime)
+    {
+        SamplePose(m_motionInstance->GetMotion(), m_queryPose, motionTime);
+
+        // Copy over the motion extraction joint transform from the current pose to the newly sampled pose.
+        // When sampling a motion, the motion extraction joint is in animation space, while we need the query pose to be in world space.
+        // Note: This does not yet take the extraction delta from the current tick into account.
+        if (m_actorInstance->GetActor()->GetMotionExtractionNode())
+        {
+            const Pose* currentPose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            const size_t motionExtractionJointIndex = m_actorInstance->GetActor()->GetMotionExtractionNodeIndex();
+            m_queryPose.SetWorldSpaceTransform(motionExtractionJointIndex,
+                currentPose->GetWorldSpaceTransform(motionExtractionJointIndex));
+        }
+
+        // Calculate the joint velocities for the sampled pose using the same method as we do for the frame database.
+        PoseDataJointVelocities* velocityPoseData = m_queryPose.GetAndPreparePoseData<PoseDataJointVelocities>(m_actorInstance);
+        AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(m_actorInstance->GetThreadIndex())->GetPosePool();
+        velocityPoseData->CalculateVelocity(m_actorInstance, posePool, m_motionInstance->GetMotion(), motionTime, m_cachedTrajectoryFeature->GetRelativeToNodeIndex());
+    }
+
+    void MotionMatchingInstance::FillQueryFeatureValues(const Feature::FrameCostContext& context, AZStd::vector<float>& queryFeatureValues) const
+    {
+        // Build the input query features that will be compared to every entry in the feature database in the motion matching search.
+        size_t startOffset = 0;
+        for (Feature* feature : m_data->GetFeaturesInKdTree())
+        {
+            feature->FillQueryFeatureValues(startOffset, queryFeatureValues, context);
+            startOffset += feature->GetNumDimensions();
+        }
+        AZ_Assert(startOffset == queryFeatureValues.size(), "Frame float vector is not the expected size.");
+    }
+
+    void MotionMatchingInstance::PreparePendingBroadPhaseQuery(float timePassedInSeconds)
+    {
+        m_pendingBroadPhaseSearch = nullptr;
+        m_hasPrefetchedNearestFrames = false;
+
+        // Only prepare a query in case the batcher searches it before the next update, and the next update is going to search
+        // assuming a similar time delta. In case the guess is wrong, the query is either not used or the search runs unbatched.
+        const BruteForceSearch* bruteForceSearch = mm_useBruteForceSearch ? m_data->GetBruteForceSearch() : nullptr;
+        if (!bruteForceSearch || !BruteForceSearchBatcherInterface::Get() ||
+            m_timeSinceLastFrameSwitch + timePassedInSeconds < 1.0f / m_lowestCostSearchFrequency)
+        {
+            return;
+        }
+
+        // The query reflects the state after this update, one update ahead of the search. It is only used for the broad-phase, the
+        // narrow-phase still calculates the frame costs using the query pose and trajectory of the update that searches.
+        UpdateQueryPose(m_newMotionTime);
+        Feature::FrameCostContext frameCostContext(m_data->GetFrameDatabase(), m_data->GetFeatureMatrix(), m_queryPose);
+        frameCostContext.m_trajectoryQuery = &m_trajectoryQuery;
+        frameCostContext.m_actorInstance = m_actorInstance;
+        FillQueryFeatureValues(frameCostContext, m_pendingQueryFeatureValues);
+        m_pendingBroadPhaseSearch = bruteForceSearch;
+    }
+
+    const BruteForceSearch* MotionMatchingInstance::GetPendingBroadPhaseSearch() const
+    {
+        // The motion database might have been re-initialized since the query got prepared.
+        if (m_hasPrefetchedNearestFrames || !m_data || m_pendingBroadPhaseSearch != m_data->GetBruteForceSearch())
+        {
+            return nullptr;
+        }
+        return m_pendingBroadPhaseSearch;
+    }
+
+    BruteForceSearch::Query MotionMatchingInstance::GetPendingBroadPhaseQuery()
+    {
+        return { &m_pendingQueryFeatureValues, &m_prefetchedNearestFrames };
+    }
+
+    void MotionMatchingInstance::OnPendingBroadPhaseQuerySearched()
+    {
+        m_hasPrefetchedNearestFrames = true;
+    }
+
     size_t MotionMatchingInstance::FindLowestCostFrameIndex(const Feature::FrameCostContext& context)
     {
         AZ::Debug::Timer timer;
@@ -483,20 +561,28 @@ namespace EMotionFX::MotionMatching
         const FeatureSchema& featureSchema = m_data->GetFeatureSchema();
         const FeatureTrajectory* trajectoryFeature = m_cachedTrajectoryFeature;
 
-        // 1. Broad-phase search using KD-tree
-        if (mm_useKdTree)
+        // 1. Broad-phase search using either the KD-tree or the brute force search
+        // The brute force search only exists in case it was enabled when the motion database got initialized.
+        const BruteForceSearch* bruteForceSearch = mm_useBruteForceSearch ? m_data->GetBruteForceSearch() : nullptr;
+        const bool useBroadPhase = mm_useKdTree || bruteForceSearch;
+        if (bruteForceSearch && m_hasPrefetchedNearestFrames && m_pendingBroadPhaseSearch == bruteForceSearch)
         {
-            // Build the input query features that will be compared to every entry in the feature database in the motion matching search.
-            size_t startOffset = 0;
-            for (Feature* feature : m_data->GetFeaturesInKdTree())
-            {
-                feature->FillQueryFeatureValues(startOffset, m_queryFeatureValues, context);
-                startOffset += feature->GetNumDimensions();
-            }
-            AZ_Assert(startOffset == m_queryFeatureValues.size(), "Frame float vector is not the expected size.");
+            // The batcher already searched the query prepared at the end of the last update together with the other instances.
+            m_nearestFrames.swap(m_prefetchedNearestFrames);
+        }
+        else if (useBroadPhase)
+        {
+            FillQueryFeatureValues(context, m_queryFeatureValues);
 
             // Find our nearest frames.
-            m_data->GetKdTree().FindNearestNeighbors(m_queryFeatureValues, m_nearestFrames);
+            if (bruteForceSearch)
+            {
+                bruteForceSearch->FindNearestNeighbors(m_queryFeatureValues, mm_bruteForceSearchNumResults, m_nearestFrames);
+            }
+            else
+            {
+                m_data->GetKdTree().FindNearestNeighbors(m_queryFeatureValues, m_nearestFrames);
+            }
         }
 
         // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
@@ -508,10 +594,10 @@ namespace EMotionFX::MotionMatching
         float minTrajectoryFutureCost = 0.0f;
 
         // Iterate through the frames filtered by the broad-phase search.
-        const size_t numFrames = mm_useKdTree ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
+        const size_t numFrames = useBroadPhase ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
         for (size_t i = 0; i < numFrames; ++i)
         {
-            const size_t frameIndex = mm_useKdTree ? m_nearestFrames[i] : i;
+            const size_t frameIndex = useBroadPhase ? m_nearestFrames[i] : i;
             const Frame& frame = frameDatabase.GetFrame(frameIndex);
 
             // TODO: This shouldn't be there, we should be discarding the frames when extracting the features and not at runtime when checking the cost.
@@ -13,6 +13,7 @@
 #include <AzCore/RTTI/RTTI.h>
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
+#include <BruteForceSearch.h>
 #include <Feature.h>
 #include <TrajectoryHistory.h>
 #include <TrajectoryQuery.h>
@@ -83,12 +84,22 @@ namespace EMotionFX::MotionMatching
         const TrajectoryHistory& GetTrajectoryHistory() const { return m_trajectoryHistory; }
         const Transform& GetMotionExtractionDelta() const { return m_motionExtractionDelta; }
 
+        //! The brute force search the query prepared for the next search is waiting for, nullptr in case there is no pending query.
+        //! The query gets prepared at the end of the update preceding the search and is searched by the BruteForceSearchBatcher together with the queries of the other instances.
+        const BruteForceSearch* GetPendingBroadPhaseSearch() const;
+        BruteForceSearch::Query GetPendingBroadPhaseQuery();
+        //! Called by the batcher once the nearest frames for the pending query got found.
+        void OnPendingBroadPhaseQuerySearched();
+
     private:
         MotionInstance* CreateMotionInstance() const;
         void DebugDrawQueryPose(AzFramework::DebugDisplayRequests& debugDisplay, bool drawPose, bool drawVelocities) const;
         void SamplePose(MotionInstance* motionInstance, Pose& outputPose);
         void SamplePose(Motion* motion, Pose& outputPose, float sampleTime) const;
 
+        void UpdateQueryPose(float motionTime);
+        void FillQueryFeatureValues(const Feature::FrameCostContext& context, AZStd::vector<float>& queryFeatureValues) const;
+        void PreparePendingBroadPhaseQuery(float timePassedInSeconds);
         size_t FindLowestCostFrameIndex(const Feature::FrameCostContext& context);
 
         MotionMatchingData* m_data = nullptr;
@@ -104,6 +115,12 @@ namespace EMotionFX::MotionMatching
         AZStd::vector<float> m_queryFeatureValues; //< The input query features to be compared to every entry/row in the feature matrix with the motion matching search.
         AZStd::vector<size_t> m_nearestFrames; //< Stores the nearest matching frames / search result from the KD-tree.
 
+        /// Query prepared for the batched brute force search and its result.
+        const BruteForceSearch* m_pendingBroadPhaseSearch = nullptr;
+        AZStd::vector<float> m_pendingQueryFeatureValues;
+        AZStd::vector<size_t> m_prefetchedNearestFrames;
+        bool m_hasPrefetchedNearestFrames = false;
+
         FeatureTrajectory* m_cachedTrajectoryFeature = nullptr; //< Cached pointer to the trajectory feature in the feature schema.
         TrajectoryQuery m_trajectoryQuery;
         TrajectoryHistory m_trajectoryHistory;
@@ -46,6 +46,15 @@ namespace EMotionFX::MotionMatching
         "Use Kd-Tree to accelerate the motion matching search for the best next matching frame. "
         "Disabling it will heavily slow down performance and should only be done for debugging purposes");
 
+    AZ_CVAR(bool, mm_useBruteForceSearch, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Use the SIMD brute force search instead of the Kd-Tree for the broad-phase of the motion matching search. "
+        "Rather than the frames of a single leaf node, it returns the mm_bruteForceSearchNumResults closest frames across the whole motion database. "
+        "The queries of all instances are searched together before the anim graphs get updated. "
+        "The search is only built for motion databases initialized while this is enabled, so enable it before the motion matching anim graphs get activated.");
+
+    AZ_CVAR(uint32_t, mm_bruteForceSearchNumResults, 1000, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of closest frames the brute force broad-phase search passes on to the narrow-phase cost evaluation.");
+
     AZ_CVAR(bool, mm_multiThreadedInitialization, true, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Use multi-threading to initialize motion matching.");
 
@@ -124,6 +133,7 @@ namespace EMotionFX::MotionMatching
     {
         MotionMatchingRequestBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
+        m_bruteForceSearchBatcher.Activate();
 
         // Register the motion matching anim graph node.
         {
@@ -142,6 +152,7 @@ namespace EMotionFX::MotionMatching
 
     void MotionMatchingSystemComponent::Deactivate()
     {
+        m_bruteForceSearchBatcher.Deactivate();
         AZ::TickBus::Handler::BusDisconnect();
         MotionMatchingRequestBus::Handler::BusDisconnect();
     }
@@ -11,6 +11,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <MotionMatching/MotionMatchingBus.h>
+#include <BruteForceSearchBatcher.h>
 
 namespace EMotionFX::MotionMatching
 {
@@ -50,5 +51,7 @@ namespace EMotionFX::MotionMatching
         }
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
         ////////////////////////////////////////////////////////////////////////
+
+        BruteForceSearchBatcher m_bruteForceSearchBatcher;
     };
 } // namespace EMotionFX::MotionMatching
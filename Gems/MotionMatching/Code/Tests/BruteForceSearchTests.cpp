@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Fixture.h>
+#include <BruteForceSearch.h>
+#include <FeaturePosition.h>
+#include <FrameDatabase.h>
+#include <KdTree.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Fills the frame database and feature matrix with random values for the given features, three values per feature.
+    static void CreateRandomFeatureData(size_t numFrames, const AZStd::vector<Feature*>& features, FrameDatabase& frameDatabase, FeatureMatrix& featureMatrix, AZ::SimpleLcgRandom& random)
+    {
+        size_t numColumns = 0;
+        for (Feature* feature : features)
+        {
+            feature->SetColumnOffset(numColumns);
+            numColumns += feature->GetNumDimensions();
+        }
+
+        featureMatrix.resize(numFrames, numColumns);
+        for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            frameDatabase.GetFrames().emplace_back(frameIndex, nullptr, 0.0f, false);
+            for (size_t column = 0; column < numColumns; ++column)
+            {
+                featureMatrix(frameIndex, column) = random.GetRandomFloat() * 4.0f - 2.0f;
+            }
+        }
+    }
+
+    static AZStd::vector<float> CreateRandomQuery(size_t numDimensions, AZ::SimpleLcgRandom& random)
+    {
+        AZStd::vector<float> query(numDimensions);
+        for (float& value : query)
+        {
+            value = random.GetRandomFloat() * 4.0f - 2.0f;
+        }
+        return query;
+    }
+
+    static float CalcSquaredDistance(const FeatureMatrix& featureMatrix, size_t frameIndex, const AZStd::vector<float>& query)
+    {
+        float result = 0.0f;
+        for (size_t column = 0; column < query.size(); ++column)
+        {
+            const float diff = featureMatrix(frameIndex, column) - query[column];
+            result += diff * diff;
+        }
+        return result;
+    }
+
+    class BruteForceSearchFixture
+        : public Fixture
+        , public ::testing::WithParamInterface<BruteForceSearch::Precision>
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+            for (size_t i = 0; i < s_numFeatures; ++i)
+            {
+                m_features.emplace_back(aznew FeaturePosition());
+            }
+        }
+
+        void TearDown() override
+        {
+            for (Feature* feature : m_features)
+            {
+                delete feature;
+            }
+            m_features.clear();
+            m_featureMatrix.Clear();
+            m_frameDatabase.reset();
+            Fixture::TearDown();
+        }
+
+        void InitSearch(size_t numFrames)
+        {
+            AZ::SimpleLcgRandom random(1234);
+            m_frameDatabase = AZStd::make_unique<FrameDatabase>();
+            CreateRandomFeatureData(numFrames, m_features, *m_frameDatabase, m_featureMatrix, random);
+            ASSERT_TRUE(m_search.Init(m_featureMatrix, m_features, GetParam()));
+        }
+
+        //! Sorted squared distances of all frames to the query, calculated the slow way.
+        AZStd::vector<AZStd::pair<float, size_t>> CalcReferenceDistances(const AZStd::vector<float>& query) const
+        {
+            AZStd::vector<AZStd::pair<float, size_t>> result;
+            for (size_t frameIndex = 0; frameIndex < m_featureMatrix.rows(); ++frameIndex)
+            {
+                result.emplace_back(CalcSquaredDistance(m_featureMatrix, frameIndex, query), frameIndex);
+            }
+            AZStd::sort(result.begin(), result.end());
+            return result;
+        }
+
+        static constexpr size_t s_numFeatures = 4;
+        AZStd::vector<Feature*> m_features;
+        AZStd::unique_ptr<FrameDatabase> m_frameDatabase;
+        FeatureMatrix m_featureMatrix;
+        BruteForceSearch m_search;
+    };
+
+    TEST_P(BruteForceSearchFixture, MatchesReference)
+    {
+        // Uneven amount of frames to also cover the partially filled last block.
+        InitSearch(1003);
+        EXPECT_EQ(m_search.GetNumDimensions(), s_numFeatures * 3);
+        EXPECT_EQ(m_search.GetNumFrames(), 1003);
+
+        AZ::SimpleLcgRandom random(5678);
+        AZStd::vector<size_t> result;
+        for (size_t queryIndex = 0; queryIndex < 10; ++queryIndex)
+        {
+            const AZStd::vector<float> query = CreateRandomQuery(m_search.GetNumDimensions(), random);
+            const auto reference = CalcReferenceDistances(query);
+
+            const size_t maxResults = 50;
+            m_search.FindNearestNeighbors(query, maxResults, result);
+            ASSERT_EQ(result.size(), maxResults);
+
+            for (size_t i = 0; i < maxResults; ++i)
+            {
+                if (GetParam() == BruteForceSearch::Precision::Float)
+                {
+                    EXPECT_EQ(result[i], reference[i].second);
+                }
+                else
+                {
+                    // The quantization error is tiny compared to the value range, so the n-th closest frame needs to be about as close as the exact one.
+                    EXPECT_NEAR(CalcSquaredDistance(m_featureMatrix, result[i], query), reference[i].first, 1e-3f);
+                }
+            }
+        }
+    }
+
+    TEST_P(BruteForceSearchFixture, MaxResultsExceedsNumFrames)
+    {
+        InitSearch(5);
+
+        AZ::SimpleLcgRandom random(5678);
+        const AZStd::vector<float> query = CreateRandomQuery(m_search.GetNumDimensions(), random);
+
+        AZStd::vector<size_t> result;
+        m_search.FindNearestNeighbors(query, 100, result);
+        ASSERT_EQ(result.size(), 5);
+
+        AZStd::sort(result.begin(), result.end());
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            EXPECT_EQ(result[i], i);
+        }
+    }
+
+    TEST_P(BruteForceSearchFixture, BatchedMatchesSingleQueries)
+    {
+        // Enough frames to split the batched search across multiple jobs.
+        InitSearch(20000);
+
+        AZ::SimpleLcgRandom random(5678);
+        const size_t numQueries = 16;
+        const size_t maxResults = 100;
+        AZStd::vector<AZStd::vector<float>> queryValues(numQueries);
+        AZStd::vector<AZStd::vector<size_t>> batchedResults(numQueries);
+        AZStd::vector<BruteForceSearch::Query> queries(numQueries);
+        for (size_t i = 0; i < numQueries; ++i)
+        {
+            queryValues[i] = CreateRandomQuery(m_search.GetNumDimensions(), random);
+            queries[i].m_queryValues = &queryValues[i];
+            queries[i].m_resultFrameIndices = &batchedResults[i];
+        }
+
+        m_search.FindNearestNeighbors(queries, maxResults);
+
+        AZStd::vector<size_t> result;
+        for (size_t i = 0; i < numQueries; ++i)
+        {
+            m_search.FindNearestNeighbors(queryValues[i], maxResults, result);
+            EXPECT_EQ(batchedResults[i], result);
+        }
+    }
+
+    INSTANTIATE_TEST_CASE_P(BruteForceSearch, BruteForceSearchFixture,
+        ::testing::Values(BruteForceSearch::Precision::Float, BruteForceSearch::Precision::Quantized));
+
+#if defined(HAVE_BENCHMARK)
+    //! Compares the broad-phase search of the KD-tree with the brute force search on the same frame database.
+    class BroadPhaseSearchBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            const AZ::u32 numWorkerThreads = AZStd::thread::hardware_concurrency();
+            for (AZ::u32 i = 0; i < numWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(desc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+
+            AZ::SimpleLcgRandom random(1234);
+            for (size_t i = 0; i < s_numFeatures; ++i)
+            {
+                m_features.emplace_back(aznew FeaturePosition());
+            }
+            m_frameDatabase = AZStd::make_unique<FrameDatabase>();
+            m_featureMatrix = AZStd::make_unique<FeatureMatrix>();
+            CreateRandomFeatureData(aznumeric_cast<size_t>(state.range(0)), m_features, *m_frameDatabase, *m_featureMatrix, random);
+
+            m_queryValues.resize(s_numQueries);
+            for (AZStd::vector<float>& queryValues : m_queryValues)
+            {
+                queryValues = CreateRandomQuery(KdTree::CalcNumDimensions(m_features), random);
+            }
+            m_results.resize(s_numQueries);
+        }
+
+        void internalTearDown(const ::benchmark::State& state)
+        {
+            m_queryValues = {};
+            m_results = {};
+            m_featureMatrix.reset();
+            m_frameDatabase.reset();
+            for (Feature* feature : m_features)
+            {
+                delete feature;
+            }
+            m_features = {};
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RunBruteForceSearch(::benchmark::State& state, BruteForceSearch::Precision precision, bool batched)
+        {
+            BruteForceSearch search;
+            search.Init(*m_featureMatrix, m_features, precision);
+
+            AZStd::vector<BruteForceSearch::Query> queries(s_numQueries);
+            for (size_t i = 0; i < s_numQueries; ++i)
+            {
+                queries[i].m_queryValues = &m_queryValues[i];
+                queries[i].m_resultFrameIndices = &m_results[i];
+            }
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                if (batched)
+                {
+                    search.FindNearestNeighbors(queries, s_maxResults);
+                }
+                else
+                {
+                    for (size_t i = 0; i < s_numQueries; ++i)
+                    {
+                        search.FindNearestNeighbors(m_queryValues[i], s_maxResults, m_results[i]);
+                    }
+                }
+                benchmark::ClobberMemory();
+            }
+            state.SetItemsProcessed(state.iterations() * s_numQueries);
+        }
+
+        static constexpr size_t s_numFeatures = 4;
+        static constexpr size_t s_numQueries = 100; //< One query per motion matched character.
+        static constexpr size_t s_maxResults = 1000; //< Matches the default minimum number of frames per KD-tree leaf.
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+        AZStd::vector<Feature*> m_features;
+        AZStd::unique_ptr<FrameDatabase> m_frameDatabase;
+        AZStd::unique_ptr<FeatureMatrix> m_featureMatrix;
+        AZStd::vector<AZStd::vector<float>> m_queryValues;
+        AZStd::vector<AZStd::vector<size_t>> m_results;
+    };
+
+    BENCHMARK_DEFINE_F(BroadPhaseSearchBenchmarkFixture, KdTree)(benchmark::State& state)
+    {
+        KdTree kdTree;
+        kdTree.Init(*m_frameDatabase, *m_featureMatrix, m_features, /*maxDepth=*/20, s_maxResults);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < s_numQueries; ++i)
+            {
+                kdTree.FindNearestNeighbors(m_queryValues[i], m_results[i]);
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * s_numQueries);
+    }
+
+    BENCHMARK_DEFINE_F(BroadPhaseSearchBenchmarkFixture, BruteForceFloat)(benchmark::State& state)
+    {
+        RunBruteForceSearch(state, BruteForceSearch::Precision::Float, /*batched=*/false);
+    }
+
+    BENCHMARK_DEFINE_F(BroadPhaseSearchBenchmarkFixture, BruteForceQuantized)(benchmark::State& state)
+    {
+        RunBruteForceSearch(state, BruteForceSearch::Precision::Quantized, /*batched=*/false);
+    }
+
+    BENCHMARK_DEFINE_F(BroadPhaseSearchBenchmarkFixture, BruteForceQuantizedBatched)(benchmark::State& state)
+    {
+        RunBruteForceSearch(state, BruteForceSearch::Precision::Quantized, /*batched=*/true);
+    }
+
+    BENCHMARK_REGISTER_F(BroadPhaseSearchBenchmarkFixture, KdTree)->RangeMultiplier(10)->Range(10000, 100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BroadPhaseSearchBenchmarkFixture, BruteForceFloat)->RangeMultiplier(10)->Range(10000, 100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BroadPhaseSearchBenchmarkFixture, BruteForceQuantized)->RangeMultiplier(10)->Range(10000, 100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BroadPhaseSearchBenchmarkFixture, BruteForceQuantizedBatched)->RangeMultiplier(10)->Range(10000, 100000)->Unit(benchmark::kMicrosecond);
+#endif // HAVE_BENCHMARK
+} // namespace EMotionFX::MotionMatching
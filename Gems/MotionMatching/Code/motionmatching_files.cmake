@@ -14,6 +14,10 @@ set(FILES
     Source/Allocators.h
     Source/BlendTreeMotionMatchNode.cpp
     Source/BlendTreeMotionMatchNode.h
+    Source/BruteForceSearch.cpp
+    Source/BruteForceSearch.h
+    Source/BruteForceSearchBatcher.cpp
+    Source/BruteForceSearchBatcher.h
     Source/EventData.cpp
     Source/EventData.h
     Source/Frame.cpp
@@ -8,6 +8,7 @@
 
 set(FILES
     Tests/Fixture.h
+    Tests/BruteForceSearchTests.cpp
     Tests/FeatureMatrixTests.cpp
     Tests/FeatureSchemaTests.cpp
     Tests/MotionMatchingTest.cpp
@@ -10,6 +10,7 @@
 
 #include <Atom/RPI.Public/ViewportContext.h>
 #include <Atom/RPI.Public/ViewportContextBus.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <Multiplayer/Components/NetBindComponent.h>
@@ -190,7 +191,7 @@ namespace Multiplayer
             awarenessSphere.SetCenter(viewportContext->GetCameraTransform().GetTranslation());
         }
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
+        AZStd::vector<AzFramework::VisibilityEntry*, AZ::FrameArenaStdAllocator> gatheredEntries;
         AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere,
             [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
             {
@@ -381,6 +381,7 @@ namespace Multiplayer
                 return;
             }
             m_serverSendAccumulator -= serverRateSeconds;
+            m_networkTime.RecordRewindHistory();
             m_networkTime.IncrementHostFrameId();
         }
 
@@ -391,6 +392,9 @@ namespace Multiplayer
         // Restore any entities that were rewound during input processing so that normal gameplay updates have the correct state
         Multiplayer::GetNetworkTime()->ClearRewoundEntities();
 
+        // Update the entities relevant to the client connections that are due, all from a single pass over the network entities
+        m_interestManager.Update();
+
         // Let the network system know the frame is done and we can collect dirty bits
         m_networkEntityManager.NotifyEntitiesChanged();
         m_networkEntityManager.NotifyEntitiesDirtied();
@@ -560,7 +564,7 @@ namespace Multiplayer
                 EnableAutonomousControl(controlledEntity, connection->GetConnectionId());
 
                 ServerToClientConnectionData* connectionData = reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData());
-                AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+                AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection, m_interestManager);
                 connectionData->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
                 connectionData->SetControlledEntity(controlledEntity);
 
@@ -7,6 +7,7 @@
  */
 
 #include <Source/NetworkTime/NetworkTime.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkTransformComponent.h>
@@ -18,6 +19,7 @@
 namespace Multiplayer
 {
     AZ_CVAR(float, sv_RewindVolumeExtrudeDistance, 50.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount to increase rewind volume checks to account for fast moving entities");
+    AZ_CVAR(bool, sv_RewindSpatialHistory, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true rewind queries use the entity positions recorded for the rewound frame instead of an expanded volume");
     AZ_CVAR(bool, bg_RewindDebugDraw, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true enables debug draw of rewind operations");
 
     NetworkTime::NetworkTime()
@@ -93,9 +95,6 @@ namespace Multiplayer
             return;
         }
 
-        // Since the vis system doesn't support rewound queries, first query with an expanded volume to catch any fast moving entities
-        const AZ::Aabb expandedVolume = rewindVolume.GetExpanded(AZ::Vector3(sv_RewindVolumeExtrudeDistance));
-
         AzFramework::DebugDisplayRequests* debugDisplay = nullptr;
         if (bg_RewindDebugDraw)
         {
@@ -104,14 +103,42 @@ namespace Multiplayer
             debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
         }
 
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+
+        // Query the entities where they were in the rewound frame, so that only the entities that can overlap the volume are synced
+        m_rewindCandidates.clear();
+        if (sv_RewindSpatialHistory && m_rewindHistory.Query(m_hostFrameId, rewindVolume, m_rewindCandidates))
+        {
+            if (debugDisplay)
+            {
+                debugDisplay->SetColor(AZ::Colors::Red);
+                debugDisplay->DrawWireBox(rewindVolume.GetMin(), rewindVolume.GetMax());
+            }
+
+            m_rewoundEntities.reserve(m_rewoundEntities.size() + m_rewindCandidates.size());
+            for (NetEntityId netEntityId : m_rewindCandidates)
+            {
+                NetworkEntityHandle entityHandle = networkEntityTracker->Get(netEntityId);
+                if (entityHandle.GetEntity() != nullptr)
+                {
+                    SyncEntityToRewindState(entityHandle, rewindVolume, entityBoundsUnion, debugDisplay);
+                }
+            }
+            m_rewindCandidates.clear();
+            return;
+        }
+
+        // The rewound frame is not in the history, since the vis system doesn't support rewound queries,
+        // query with an expanded volume to catch any fast moving entities
+        const AZ::Aabb expandedVolume = rewindVolume.GetExpanded(AZ::Vector3(sv_RewindVolumeExtrudeDistance));
+
         if (debugDisplay)
         {
             debugDisplay->SetColor(AZ::Colors::Red);
             debugDisplay->DrawWireBox(expandedVolume.GetMin(), expandedVolume.GetMax());
         }
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
-        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
         AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(expandedVolume,
             [this, debugDisplay, networkEntityTracker, entityBoundsUnion, rewindVolume](const AzFramework::IVisibilityScene::NodeData& nodeData)
         {
@@ -122,48 +149,57 @@ namespace Multiplayer
                 {
                     AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
                     NetworkEntityHandle entityHandle(entity, networkEntityTracker);
-                    if (entityHandle.GetNetBindComponent() != nullptr)
-                    {
-                        const AZ::Aabb currentBounds = entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId());
-                        const AZ::Vector3 currentCenter = currentBounds.GetCenter();
-                        NetworkTransformComponent* networkTransform = entity->template FindComponent<NetworkTransformComponent>();
-                        if (debugDisplay)
-                        {
-                            debugDisplay->SetColor(AZ::Colors::White);
-                            debugDisplay->DrawWireBox(currentBounds.GetMin(), currentBounds.GetMax());
-                        }
-
-                        if (networkTransform != nullptr)
-                        {
-                            // Get the rewound position for target host frame ID plus the one preceding it for potential lerp
-                            AZ::Vector3 rewindCenter = networkTransform->GetTranslation();
-                            const AZ::Vector3 rewindCenterPrevious = networkTransform->GetTranslationPrevious();
-                            const float blendFactor = GetNetworkTime()->GetHostBlendFactor();
-                            if (!AZ::IsClose(blendFactor, 1.0f) && !rewindCenter.IsClose(rewindCenterPrevious))
-                            {
-                                // If we have a blend factor, lerp the translation for accuracy
-                                rewindCenter = rewindCenterPrevious.Lerp(rewindCenter, blendFactor);
-                            }
-                            const AZ::Vector3 rewindOffset = rewindCenter - currentCenter; // Compute offset between rewound and current positions
-                            const AZ::Aabb rewoundAabb = currentBounds.GetTranslated(rewindOffset); // Apply offset to the entity aabb
-                            if (debugDisplay)
-                            {
-                                debugDisplay->SetColor(AZ::Colors::Grey);
-                                debugDisplay->DrawWireBox(rewoundAabb.GetMin(), rewoundAabb.GetMax());
-                            }
-
-                            if (AZ::ShapeIntersection::Overlaps(rewoundAabb, rewindVolume)) // Validate the rewound aabb intersects our rewind volume
-                            {
-                                m_rewoundEntities.push_back(entityHandle);
-                                entityHandle.GetNetBindComponent()->NotifySyncRewindState();
-                            }
-                        }
-                    }
+                    SyncEntityToRewindState(entityHandle, rewindVolume, entityBoundsUnion, debugDisplay);
                 }
             }
         });
     }
 
+    void NetworkTime::SyncEntityToRewindState(NetworkEntityHandle& entityHandle, const AZ::Aabb& rewindVolume,
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion, AzFramework::DebugDisplayRequests* debugDisplay)
+    {
+        if (entityHandle.GetNetBindComponent() == nullptr)
+        {
+            return;
+        }
+
+        AZ::Entity* entity = entityHandle.GetEntity();
+        const AZ::Aabb currentBounds = entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId());
+        const AZ::Vector3 currentCenter = currentBounds.GetCenter();
+        NetworkTransformComponent* networkTransform = entity->template FindComponent<NetworkTransformComponent>();
+        if (debugDisplay)
+        {
+            debugDisplay->SetColor(AZ::Colors::White);
+            debugDisplay->DrawWireBox(currentBounds.GetMin(), currentBounds.GetMax());
+        }
+
+        if (networkTransform != nullptr)
+        {
+            // Get the rewound position for target host frame ID plus the one preceding it for potential lerp
+            AZ::Vector3 rewindCenter = networkTransform->GetTranslation();
+            const AZ::Vector3 rewindCenterPrevious = networkTransform->GetTranslationPrevious();
+            const float blendFactor = GetNetworkTime()->GetHostBlendFactor();
+            if (!AZ::IsClose(blendFactor, 1.0f) && !rewindCenter.IsClose(rewindCenterPrevious))
+            {
+                // If we have a blend factor, lerp the translation for accuracy
+                rewindCenter = rewindCenterPrevious.Lerp(rewindCenter, blendFactor);
+            }
+            const AZ::Vector3 rewindOffset = rewindCenter - currentCenter; // Compute offset between rewound and current positions
+            const AZ::Aabb rewoundAabb = currentBounds.GetTranslated(rewindOffset); // Apply offset to the entity aabb
+            if (debugDisplay)
+            {
+                debugDisplay->SetColor(AZ::Colors::Grey);
+                debugDisplay->DrawWireBox(rewoundAabb.GetMin(), rewoundAabb.GetMax());
+            }
+
+            if (AZ::ShapeIntersection::Overlaps(rewoundAabb, rewindVolume)) // Validate the rewound aabb intersects our rewind volume
+            {
+                m_rewoundEntities.push_back(entityHandle);
+                entityHandle.GetNetBindComponent()->NotifySyncRewindState();
+            }
+        }
+    }
+
     void NetworkTime::ClearRewoundEntities()
     {
         AZ_Assert(!IsTimeRewound(), "Cannot clear rewound entity state while still within scoped rewind");
@@ -177,4 +213,39 @@ namespace Multiplayer
         }
         m_rewoundEntities.clear();
     }
+
+    void NetworkTime::RecordRewindHistory()
+    {
+        AZ_Assert(!IsTimeRewound(), "Recording the rewind history is unsupported under a rewound time scope");
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        if (!sv_RewindSpatialHistory || networkEntityTracker == nullptr || entityBoundsUnion == nullptr)
+        {
+            m_rewindHistory.Clear();
+            return;
+        }
+
+        m_rewindHistory.BeginFrame(m_unalteredFrameId);
+        for (const auto& [netEntityId, entity] : *networkEntityTracker)
+        {
+            if (entity->GetState() != AZ::Entity::State::Active)
+            {
+                continue;
+            }
+
+            // Only entities with a network transform can be rewound
+            NetworkTransformComponent* networkTransform = entity->FindComponent<NetworkTransformComponent>();
+            if (networkTransform == nullptr)
+            {
+                continue;
+            }
+
+            // The rewound bounds are the current bounds moved to the rewound position, use a radius that covers them under any rotation
+            const AZ::Aabb bounds = entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId());
+            const float radius = bounds.IsValid() ? bounds.GetExtents().GetLength() * 0.5f : 0.0f;
+            m_rewindHistory.AddEntity(netEntityId, networkTransform->GetTranslation(), radius);
+        }
+        m_rewindHistory.EndFrame();
+    }
 }
@@ -10,9 +10,16 @@
 
 #include <Multiplayer/NetworkTime/INetworkTime.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Source/NetworkTime/RewindSpatialHistory.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Console/IConsole.h>
 
+namespace AzFramework
+{
+    class DebugDisplayRequests;
+    class IEntityBoundsUnion;
+}
+
 namespace Multiplayer
 {
     //! Implementation of the INetworkTime interface.
@@ -38,10 +45,21 @@ namespace Multiplayer
         void ClearRewoundEntities() override;
         //! @}
 
+        //! Records the positions of the rewindable entities for the current unaltered frame.
+        //! Should be called once the frame is simulated, right before the host frame id is incremented.
+        void RecordRewindHistory();
+
     private:
 
+        //! Syncs the entity to its rewound state if its rewound bounds overlap the rewind volume.
+        void SyncEntityToRewindState(NetworkEntityHandle& entityHandle, const AZ::Aabb& rewindVolume,
+            AzFramework::IEntityBoundsUnion* entityBoundsUnion, AzFramework::DebugDisplayRequests* debugDisplay);
+
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
 
+        RewindSpatialHistory m_rewindHistory;
+        AZStd::vector<NetEntityId> m_rewindCandidates;
+
         HostFrameId m_hostFrameId = HostFrameId{ 0 };
         HostFrameId m_unalteredFrameId = HostFrameId{ 0 };
         AZ::TimeMs m_hostTimeMs = AZ::Time::ZeroTimeMs;
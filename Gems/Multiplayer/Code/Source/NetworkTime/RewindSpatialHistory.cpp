@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/RewindSpatialHistory.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    // Spreads the lower 10 bits of the value so that there are two zero bits between each of them
+    static uint32_t SpreadBits(uint32_t value)
+    {
+        value &= 0x000003ff;
+        value = (value ^ (value << 16)) & 0xff0000ff;
+        value = (value ^ (value << 8)) & 0x0300f00f;
+        value = (value ^ (value << 4)) & 0x030c30c3;
+        value = (value ^ (value << 2)) & 0x09249249;
+        return value;
+    }
+
+    bool RewindSpatialHistory::CompactAabb::Overlaps(const CompactAabb& rhs) const
+    {
+        return m_min[0] <= rhs.m_max[0] && m_max[0] >= rhs.m_min[0]
+            && m_min[1] <= rhs.m_max[1] && m_max[1] >= rhs.m_min[1]
+            && m_min[2] <= rhs.m_max[2] && m_max[2] >= rhs.m_min[2];
+    }
+
+    void RewindSpatialHistory::CompactAabb::AddAabb(const CompactAabb& rhs)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            m_min[axis] = AZStd::min(m_min[axis], rhs.m_min[axis]);
+            m_max[axis] = AZStd::max(m_max[axis], rhs.m_max[axis]);
+        }
+    }
+
+    void RewindSpatialHistory::BeginFrame(HostFrameId frameId)
+    {
+        AZ_Assert(m_recordingFrameId == InvalidHostFrameId, "BeginFrame called while frame %u is still being recorded", static_cast<uint32_t>(m_recordingFrameId));
+        m_recordingFrameId = frameId;
+        m_entries.clear();
+    }
+
+    void RewindSpatialHistory::AddEntity(NetEntityId netEntityId, const AZ::Vector3& position, float radius)
+    {
+        AZ_Assert(m_recordingFrameId != InvalidHostFrameId, "AddEntity called outside of BeginFrame and EndFrame");
+        Entry& entry = m_entries.emplace_back();
+        entry.m_netEntityId = netEntityId;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            entry.m_bounds.m_min[axis] = position.GetElement(axis) - radius;
+            entry.m_bounds.m_max[axis] = position.GetElement(axis) + radius;
+        }
+    }
+
+    void RewindSpatialHistory::EndFrame()
+    {
+        AZ_Assert(m_recordingFrameId != InvalidHostFrameId, "EndFrame called without a matching BeginFrame");
+
+        SweepEntries();
+
+        Snapshot& snapshot = m_snapshots[static_cast<uint32_t>(m_recordingFrameId) % RewindHistorySize];
+        BuildSnapshot(snapshot);
+        snapshot.m_frameId = m_recordingFrameId;
+
+        // The unswept entries of this frame are swept into the next one
+        AZStd::swap(m_entries, m_previousEntries);
+        m_previousFrameId = m_recordingFrameId;
+        m_recordingFrameId = InvalidHostFrameId;
+    }
+
+    bool RewindSpatialHistory::HasFrame(HostFrameId frameId) const
+    {
+        return (frameId != InvalidHostFrameId) && (m_snapshots[static_cast<uint32_t>(frameId) % RewindHistorySize].m_frameId == frameId);
+    }
+
+    bool RewindSpatialHistory::Query(HostFrameId frameId, const AZ::Aabb& volume, AZStd::vector<NetEntityId>& outNetEntityIds) const
+    {
+        if (!HasFrame(frameId))
+        {
+            return false;
+        }
+
+        CompactAabb queryBounds;
+        volume.GetMin().StoreToFloat3(queryBounds.m_min);
+        volume.GetMax().StoreToFloat3(queryBounds.m_max);
+
+        const Snapshot& snapshot = m_snapshots[static_cast<uint32_t>(frameId) % RewindHistorySize];
+        const uint32_t entryCount = aznumeric_cast<uint32_t>(snapshot.m_bounds.size());
+        const uint32_t clusterCount = aznumeric_cast<uint32_t>(snapshot.m_clusterBounds.size());
+        for (uint32_t clusterIndex = 0; clusterIndex < clusterCount; ++clusterIndex)
+        {
+            if (!snapshot.m_clusterBounds[clusterIndex].Overlaps(queryBounds))
+            {
+                continue;
+            }
+
+            const uint32_t entryEnd = AZStd::min(entryCount, (clusterIndex + 1) * ClusterSize);
+            for (uint32_t entryIndex = clusterIndex * ClusterSize; entryIndex < entryEnd; ++entryIndex)
+            {
+                if (snapshot.m_bounds[entryIndex].Overlaps(queryBounds))
+                {
+                    outNetEntityIds.push_back(snapshot.m_netEntityIds[entryIndex]);
+                }
+            }
+        }
+        return true;
+    }
+
+    void RewindSpatialHistory::Clear()
+    {
+        for (Snapshot& snapshot : m_snapshots)
+        {
+            snapshot.m_frameId = InvalidHostFrameId;
+            snapshot.m_netEntityIds.clear();
+            snapshot.m_bounds.clear();
+            snapshot.m_clusterBounds.clear();
+        }
+        m_previousFrameId = InvalidHostFrameId;
+        m_previousEntries.clear();
+    }
+
+    void RewindSpatialHistory::SweepEntries()
+    {
+        const auto lessById = [](const Entry& lhs, const Entry& rhs)
+        {
+            return lhs.m_netEntityId < rhs.m_netEntityId;
+        };
+        AZStd::sort(m_entries.begin(), m_entries.end(), lessById);
+
+        m_sweptEntries.assign(m_entries.begin(), m_entries.end());
+
+        // Only the bounds of the frame immediately preceding this one can be blended with it
+        const bool consecutiveFrames = (m_previousFrameId != InvalidHostFrameId)
+            && (static_cast<uint32_t>(m_previousFrameId) + 1 == static_cast<uint32_t>(m_recordingFrameId));
+        if (!consecutiveFrames)
+        {
+            return;
+        }
+
+        // Both frames are sorted by NetEntityId, so a single pass matches the entities present in both
+        auto previousIter = m_previousEntries.begin();
+        for (Entry& entry : m_sweptEntries)
+        {
+            while (previousIter != m_previousEntries.end() && previousIter->m_netEntityId < entry.m_netEntityId)
+            {
+                ++previousIter;
+            }
+            if (previousIter == m_previousEntries.end())
+            {
+                break;
+            }
+            if (previousIter->m_netEntityId == entry.m_netEntityId)
+            {
+                entry.m_bounds.AddAabb(previousIter->m_bounds);
+            }
+        }
+    }
+
+    void RewindSpatialHistory::BuildSnapshot(Snapshot& snapshot)
+    {
+        snapshot.m_netEntityIds.clear();
+        snapshot.m_bounds.clear();
+        snapshot.m_clusterBounds.clear();
+        if (m_sweptEntries.empty())
+        {
+            return;
+        }
+
+        // Quantize the entry centers to a 1024^3 grid spanning all the entries
+        constexpr float floatMax = AZStd::numeric_limits<float>::max();
+        float centerMin[3] = { floatMax, floatMax, floatMax };
+        float centerMax[3] = { -floatMax, -floatMax, -floatMax };
+        for (const Entry& entry : m_sweptEntries)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float center = (entry.m_bounds.m_min[axis] + entry.m_bounds.m_max[axis]) * 0.5f;
+                centerMin[axis] = AZStd::min(centerMin[axis], center);
+                centerMax[axis] = AZStd::max(centerMax[axis], center);
+            }
+        }
+
+        float scale[3];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float extent = centerMax[axis] - centerMin[axis];
+            scale[axis] = (extent > 0.0f) ? 1023.0f / extent : 0.0f;
+        }
+
+        m_sortKeys.clear();
+        m_sortKeys.reserve(m_sweptEntries.size());
+        for (uint32_t entryIndex = 0; entryIndex < m_sweptEntries.size(); ++entryIndex)
+        {
+            const CompactAabb& bounds = m_sweptEntries[entryIndex].m_bounds;
+            uint32_t mortonCode = 0;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float center = (bounds.m_min[axis] + bounds.m_max[axis]) * 0.5f;
+                mortonCode |= SpreadBits(static_cast<uint32_t>((center - centerMin[axis]) * scale[axis])) << axis;
+            }
+            m_sortKeys.emplace_back(mortonCode, entryIndex);
+        }
+        AZStd::sort(m_sortKeys.begin(), m_sortKeys.end());
+
+        snapshot.m_netEntityIds.reserve(m_sweptEntries.size());
+        snapshot.m_bounds.reserve(m_sweptEntries.size());
+        for (const auto& [mortonCode, entryIndex] : m_sortKeys)
+        {
+            const Entry& entry = m_sweptEntries[entryIndex];
+            snapshot.m_netEntityIds.push_back(entry.m_netEntityId);
+            snapshot.m_bounds.push_back(entry.m_bounds);
+            if (snapshot.m_bounds.size() % ClusterSize == 1)
+            {
+                snapshot.m_clusterBounds.push_back(entry.m_bounds);
+            }
+            else
+            {
+                snapshot.m_clusterBounds.back().AddAabb(entry.m_bounds);
+            }
+        }
+    }
+}
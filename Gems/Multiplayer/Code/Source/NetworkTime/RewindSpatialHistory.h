@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! Keeps a compact spatial snapshot of the rewindable network entities for every frame of the rewind window.
+    //! Rewind queries run against the positions the entities had in the rewound frame, so only the entities that were
+    //! actually inside the rewind volume at that time are returned, no matter how far they moved since.
+    //! The entries of a snapshot are sorted along a Morton curve and grouped in clusters, a query only tests the
+    //! entries of the clusters whose bounds overlap the query volume.
+    class RewindSpatialHistory
+    {
+    public:
+        //! Number of consecutive entries that share a cluster bound.
+        static constexpr uint32_t ClusterSize = 32;
+
+        //! Starts recording the snapshot of a frame, the snapshot replaces the oldest one once the history is full.
+        //! @param frameId the host frame being recorded
+        void BeginFrame(HostFrameId frameId);
+
+        //! Adds an entity to the snapshot being recorded.
+        //! The recorded bounds are a cube around the position, large enough to contain the entity under any rotation.
+        //! They are also extended to the entity's bounds of the preceding frame, so they cover every blended position.
+        //! @param netEntityId the entity to add
+        //! @param position    the position of the entity in the recorded frame
+        //! @param radius      the radius of a sphere centered on the position that contains the entity
+        void AddEntity(NetEntityId netEntityId, const AZ::Vector3& position, float radius);
+
+        //! Sorts and clusters the snapshot being recorded, the frame can be queried after this.
+        void EndFrame();
+
+        //! Returns true if the snapshot of the frame is still in the history.
+        bool HasFrame(HostFrameId frameId) const;
+
+        //! Appends the entities whose recorded bounds overlap the volume in the given frame.
+        //! @param frameId         the frame to query
+        //! @param volume          the volume to query
+        //! @param outNetEntityIds the entities that overlap the volume are appended to this vector
+        //! @return false if the frame is not in the history, the output is left untouched in that case
+        bool Query(HostFrameId frameId, const AZ::Aabb& volume, AZStd::vector<NetEntityId>& outNetEntityIds) const;
+
+        //! Removes all the snapshots.
+        void Clear();
+
+    private:
+        //! Aabb stored as plain floats, without the padding of the simd vectors of an AZ::Aabb.
+        struct CompactAabb
+        {
+            bool Overlaps(const CompactAabb& rhs) const;
+            void AddAabb(const CompactAabb& rhs);
+
+            float m_min[3];
+            float m_max[3];
+        };
+
+        struct Entry
+        {
+            NetEntityId m_netEntityId;
+            CompactAabb m_bounds;
+        };
+
+        struct Snapshot
+        {
+            HostFrameId m_frameId = InvalidHostFrameId;
+            AZStd::vector<NetEntityId> m_netEntityIds;
+            AZStd::vector<CompactAabb> m_bounds;
+            AZStd::vector<CompactAabb> m_clusterBounds;
+        };
+
+        //! Computes the bounds of the recorded entries extended to their bounds in the previous frame.
+        void SweepEntries();
+        //! Writes the swept entries to the snapshot in Morton order and computes the cluster bounds.
+        void BuildSnapshot(Snapshot& snapshot);
+
+        AZStd::array<Snapshot, RewindHistorySize> m_snapshots;
+
+        HostFrameId m_recordingFrameId = InvalidHostFrameId;
+        HostFrameId m_previousFrameId = InvalidHostFrameId;
+        AZStd::vector<Entry> m_entries;          //!< Entries of the frame being recorded.
+        AZStd::vector<Entry> m_previousEntries;  //!< Entries of the previous frame, sorted by NetEntityId.
+        AZStd::vector<Entry> m_sweptEntries;
+        AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_sortKeys;
+    };
+}
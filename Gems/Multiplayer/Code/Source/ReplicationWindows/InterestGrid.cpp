@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+
+namespace Multiplayer
+{
+    void InterestGrid::Clear()
+    {
+        m_entries.clear();
+        m_cellEntries.clear();
+        m_cellStarts.clear();
+        m_cellCountX = 0;
+        m_cellCountY = 0;
+        m_maxHalfExtent = 0.0f;
+    }
+
+    void InterestGrid::AddEntity(NetEntityId netEntityId, const AZ::Aabb& bounds)
+    {
+        AZ_Assert(bounds.IsValid(), "Entity %llu added to the interest grid with invalid bounds", static_cast<AZ::u64>(netEntityId));
+        m_entries.push_back({ netEntityId, bounds });
+    }
+
+    void InterestGrid::Build(float cellSize)
+    {
+        m_cellEntries.clear();
+        m_cellCountX = 0;
+        m_cellCountY = 0;
+        m_maxHalfExtent = 0.0f;
+        if (m_entries.empty())
+        {
+            return;
+        }
+
+        constexpr float floatMax = AZStd::numeric_limits<float>::max();
+        float minX = floatMax;
+        float minY = floatMax;
+        float maxX = -floatMax;
+        float maxY = -floatMax;
+        for (const Entry& entry : m_entries)
+        {
+            const AZ::Vector3 center = entry.m_bounds.GetCenter();
+            const AZ::Vector3 halfExtents = entry.m_bounds.GetExtents() * 0.5f;
+            minX = AZStd::min(minX, center.GetX());
+            minY = AZStd::min(minY, center.GetY());
+            maxX = AZStd::max(maxX, center.GetX());
+            maxY = AZStd::max(maxY, center.GetY());
+            m_maxHalfExtent = AZStd::max(m_maxHalfExtent, AZStd::max(halfExtents.GetX(), halfExtents.GetY()));
+        }
+
+        // Grow the cells rather than allocating a huge grid for sparse worlds
+        const float largestExtent = AZStd::max(maxX - minX, maxY - minY);
+        m_cellSize = AZStd::max(cellSize, largestExtent / static_cast<float>(MaxCellsPerAxis - 1));
+        m_inverseCellSize = 1.0f / m_cellSize;
+        m_originX = minX;
+        m_originY = minY;
+        m_cellCountX = AZStd::min(static_cast<uint32_t>((maxX - minX) * m_inverseCellSize) + 1, MaxCellsPerAxis);
+        m_cellCountY = AZStd::min(static_cast<uint32_t>((maxY - minY) * m_inverseCellSize) + 1, MaxCellsPerAxis);
+
+        // Counting sort of the entries by cell
+        const uint32_t cellCount = m_cellCountX * m_cellCountY;
+        m_cellStarts.assign(cellCount + 1, 0);
+        m_entryCells.resize(m_entries.size());
+        for (size_t entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex)
+        {
+            const uint32_t cellIndex = GetCellIndex(m_entries[entryIndex].m_bounds);
+            m_entryCells[entryIndex] = cellIndex;
+            ++m_cellStarts[cellIndex + 1];
+        }
+        for (uint32_t cellIndex = 0; cellIndex < cellCount; ++cellIndex)
+        {
+            m_cellStarts[cellIndex + 1] += m_cellStarts[cellIndex];
+        }
+
+        // Scatter the entries using the starts as write cursors, each start ends up at the start of the next cell
+        m_cellEntries.resize(m_entries.size());
+        for (size_t entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex)
+        {
+            m_cellEntries[m_cellStarts[m_entryCells[entryIndex]]++] = m_entries[entryIndex];
+        }
+        for (uint32_t cellIndex = cellCount; cellIndex > 0; --cellIndex)
+        {
+            m_cellStarts[cellIndex] = m_cellStarts[cellIndex - 1];
+        }
+        m_cellStarts[0] = 0;
+    }
+
+    void InterestGrid::GatherCandidates(const AZ::Vector3& position, float radius, AZStd::vector<Candidate>& outCandidates) const
+    {
+        if (m_cellCountX == 0)
+        {
+            return;
+        }
+
+        // Entries are binned by their center, expand the query so that entries overlapping it from a neighbouring cell are found
+        const float reach = radius + m_maxHalfExtent;
+        const float firstX = AZStd::floor((position.GetX() - reach - m_originX) * m_inverseCellSize);
+        const float lastX = AZStd::floor((position.GetX() + reach - m_originX) * m_inverseCellSize);
+        const float firstY = AZStd::floor((position.GetY() - reach - m_originY) * m_inverseCellSize);
+        const float lastY = AZStd::floor((position.GetY() + reach - m_originY) * m_inverseCellSize);
+        if (lastX < 0.0f || lastY < 0.0f || firstX >= static_cast<float>(m_cellCountX) || firstY >= static_cast<float>(m_cellCountY))
+        {
+            return;
+        }
+
+        const uint32_t cellX0 = static_cast<uint32_t>(AZStd::max(firstX, 0.0f));
+        const uint32_t cellY0 = static_cast<uint32_t>(AZStd::max(firstY, 0.0f));
+        const uint32_t cellX1 = AZStd::min(static_cast<uint32_t>(lastX), m_cellCountX - 1);
+        const uint32_t cellY1 = AZStd::min(static_cast<uint32_t>(lastY), m_cellCountY - 1);
+        const float radiusSquared = radius * radius;
+        for (uint32_t cellY = cellY0; cellY <= cellY1; ++cellY)
+        {
+            // The cells of a row are contiguous, so the entries of the whole row span are a single range
+            const uint32_t rowStart = cellY * m_cellCountX;
+            const uint32_t entryEnd = m_cellStarts[rowStart + cellX1 + 1];
+            for (uint32_t entryIndex = m_cellStarts[rowStart + cellX0]; entryIndex < entryEnd; ++entryIndex)
+            {
+                const Entry& entry = m_cellEntries[entryIndex];
+                if (entry.m_bounds.GetDistanceSq(position) > radiusSquared)
+                {
+                    continue;
+                }
+
+                // We want to find the closest extent to the player and prioritize using that distance
+                const AZ::Vector3 supportNormal = position - entry.m_bounds.GetCenter();
+                const AZ::Vector3 closestPosition = entry.m_bounds.GetSupport(supportNormal);
+                const float distanceSquared = position.GetDistanceSq(closestPosition);
+                const float priority = (distanceSquared > 0.0f) ? 1.0f / distanceSquared : 0.0f;
+                outCandidates.push_back({ entry.m_netEntityId, priority, distanceSquared });
+            }
+        }
+    }
+
+    uint32_t InterestGrid::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_entries.size());
+    }
+
+    uint32_t InterestGrid::GetCellIndex(const AZ::Aabb& bounds) const
+    {
+        const AZ::Vector3 center = bounds.GetCenter();
+        const uint32_t cellX = AZStd::min(static_cast<uint32_t>((center.GetX() - m_originX) * m_inverseCellSize), m_cellCountX - 1);
+        const uint32_t cellY = AZStd::min(static_cast<uint32_t>((center.GetY() - m_originY) * m_inverseCellSize), m_cellCountY - 1);
+        return cellY * m_cellCountX + cellX;
+    }
+}
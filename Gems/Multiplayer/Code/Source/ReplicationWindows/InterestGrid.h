@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! Uniform grid over the XY plane holding the bounds of the network entities.
+    //! The grid is rebuilt from scratch every server tick, entities are binned by the center of their bounds with a counting sort,
+    //! so a build is linear in the number of entities and reuses the memory of the previous build.
+    //! Once built, the grid is read only and can be queried from several threads at once.
+    class InterestGrid
+    {
+    public:
+        //! The cell size is increased if needed to keep the number of cells per axis under this value.
+        static constexpr uint32_t MaxCellsPerAxis = 256;
+
+        struct Candidate
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            float m_priority = 0.0f;
+            float m_distanceSquared = 0.0f;
+        };
+
+        //! Removes all the entities, the grid must be built again before being queried.
+        void Clear();
+
+        //! Adds an entity to the next build.
+        //! @param netEntityId the entity to add
+        //! @param bounds      the world bounds of the entity
+        void AddEntity(NetEntityId netEntityId, const AZ::Aabb& bounds);
+
+        //! Bins the added entities into square cells.
+        //! @param cellSize the size of the cells in meters
+        void Build(float cellSize);
+
+        //! Appends every entity whose bounds overlap the sphere.
+        //! Entities are prioritized by the inverse of the squared distance from the center of the sphere to their closest extent.
+        //! @param position      the center of the sphere
+        //! @param radius        the radius of the sphere
+        //! @param outCandidates the overlapping entities are appended to this vector
+        void GatherCandidates(const AZ::Vector3& position, float radius, AZStd::vector<Candidate>& outCandidates) const;
+
+        //! Returns the number of entities in the grid.
+        uint32_t GetEntityCount() const;
+
+    private:
+        struct Entry
+        {
+            NetEntityId m_netEntityId;
+            AZ::Aabb m_bounds;
+        };
+
+        uint32_t GetCellIndex(const AZ::Aabb& bounds) const;
+
+        AZStd::vector<Entry> m_entries;         //!< Entries in the order they were added.
+        AZStd::vector<Entry> m_cellEntries;     //!< Entries sorted by cell, rows of cells along X are contiguous.
+        AZStd::vector<uint32_t> m_cellStarts;   //!< Index of the first entry of each cell in m_cellEntries, plus the end index.
+        AZStd::vector<uint32_t> m_entryCells;   //!< Cell of each entry of m_entries, only used during the build.
+
+        float m_originX = 0.0f;
+        float m_originY = 0.0f;
+        float m_cellSize = 1.0f;
+        float m_inverseCellSize = 1.0f;
+        float m_maxHalfExtent = 0.0f;           //!< Largest half extent of the entries on X or Y, queries are expanded by it.
+        uint32_t m_cellCountX = 0;
+        uint32_t m_cellCountY = 0;
+    };
+}
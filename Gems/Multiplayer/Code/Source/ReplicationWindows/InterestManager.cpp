@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestManager.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
+
+AZ_DECLARE_BUDGET(MULTIPLAYER);
+
+namespace Multiplayer
+{
+    AZ_CVAR_EXTERNED(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs);
+
+    AZ_CVAR(float, sv_InterestGridCellSize, 64.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The size in meters of the cells of the grid used to find the entities relevant to each client");
+    AZ_CVAR(bool, sv_ParallelReplicationWindowUpdates, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true the replication windows that are due for an update gather their entities in parallel");
+
+    void InterestManager::RegisterWindow(ServerToClientReplicationWindow* window)
+    {
+        m_windows.push_back({ window, AZ::GetElapsedTimeMs() + sv_ClientReplicationWindowUpdateMs });
+    }
+
+    void InterestManager::UnregisterWindow(ServerToClientReplicationWindow* window)
+    {
+        auto iter = AZStd::find_if(m_windows.begin(), m_windows.end(), [window](const RegisteredWindow& registered) { return registered.m_window == window; });
+        if (iter != m_windows.end())
+        {
+            m_windows.erase(iter);
+        }
+    }
+
+    void InterestManager::Update()
+    {
+        if (m_windows.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "InterestManager: Update");
+
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        m_dueWindows.clear();
+        for (RegisteredWindow& registered : m_windows)
+        {
+            if (currentTimeMs >= registered.m_nextUpdateTimeMs)
+            {
+                registered.m_nextUpdateTimeMs = currentTimeMs + sv_ClientReplicationWindowUpdateMs;
+                if (registered.m_window->PrepareUpdate())
+                {
+                    m_dueWindows.push_back(registered.m_window);
+                }
+            }
+        }
+
+        if (m_dueWindows.empty())
+        {
+            return;
+        }
+
+        RebuildGrid();
+
+        // Gathering only reads the grid and writes to the window, the main thread is blocked until all the windows are done
+        const int32_t dueWindowCount = aznumeric_cast<int32_t>(m_dueWindows.size());
+        if (sv_ParallelReplicationWindowUpdates && dueWindowCount > 1 && AZ::JobContext::GetGlobalContext() != nullptr)
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "InterestManager: Update - GatherCandidates");
+            AZ::parallel_for(0, dueWindowCount, [this](int32_t windowIndex)
+            {
+                m_dueWindows[windowIndex]->GatherCandidates(m_grid);
+            });
+        }
+        else
+        {
+            for (ServerToClientReplicationWindow* window : m_dueWindows)
+            {
+                window->GatherCandidates(m_grid);
+            }
+        }
+
+        for (ServerToClientReplicationWindow* window : m_dueWindows)
+        {
+            window->ApplyCandidates();
+        }
+    }
+
+    const InterestGrid& InterestManager::GetGrid() const
+    {
+        return m_grid;
+    }
+
+    void InterestManager::RebuildGrid()
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "InterestManager: RebuildGrid");
+
+        m_grid.Clear();
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        if (networkEntityTracker != nullptr && entityBoundsUnion != nullptr)
+        {
+            for (const auto& [netEntityId, entity] : *networkEntityTracker)
+            {
+                if (entity->GetState() != AZ::Entity::State::Active)
+                {
+                    continue;
+                }
+
+                const AZ::Aabb bounds = entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId());
+                if (bounds.IsValid())
+                {
+                    m_grid.AddEntity(netEntityId, bounds);
+                }
+            }
+        }
+
+        m_grid.Build(sv_InterestGridCellSize);
+    }
+}
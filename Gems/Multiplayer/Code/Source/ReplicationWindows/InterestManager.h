@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class ServerToClientReplicationWindow;
+
+    //! Interest management shared by all the server to client replication windows.
+    //! Once per server tick, if any window is due for an update, the InterestGrid is rebuilt from the network entities.
+    //! The due windows then gather their candidates from the grid in parallel, and the results are applied to the windows
+    //! on the calling thread, so each tick costs a single pass over the entities instead of one scene query per connection.
+    class InterestManager
+    {
+    public:
+        //! Adds a window to the windows updated by the manager, its first update happens after sv_ClientReplicationWindowUpdateMs.
+        void RegisterWindow(ServerToClientReplicationWindow* window);
+
+        //! Removes a window from the windows updated by the manager.
+        void UnregisterWindow(ServerToClientReplicationWindow* window);
+
+        //! Updates the windows that are due for an update, should be called once per server tick.
+        void Update();
+
+        //! Returns the grid built during the last update.
+        const InterestGrid& GetGrid() const;
+
+    private:
+        struct RegisteredWindow
+        {
+            ServerToClientReplicationWindow* m_window = nullptr;
+            AZ::TimeMs m_nextUpdateTimeMs = AZ::Time::ZeroTimeMs;
+        };
+
+        //! Rebuilds the grid from the entities of the network entity tracker.
+        void RebuildGrid();
+
+        InterestGrid m_grid;
+        AZStd::vector<RegisteredWindow> m_windows;
+        AZStd::vector<ServerToClientReplicationWindow*> m_dueWindows;
+    };
+}
@@ -7,10 +7,11 @@
  */
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/InterestManager.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
-#include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/std/sort.h>
@@ -52,26 +53,31 @@ namespace Multiplayer
         return m_priority < rhs.m_priority;
     }
 
-    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection)
-        : m_controlledEntity(controlledEntity)
+    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection, InterestManager& interestManager)
+        : m_interestManager(interestManager)
+        , m_controlledEntity(controlledEntity)
         , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
         , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
         , m_connection(connection)
         , m_lastCheckedSentPackets(connection->GetMetrics().m_packetsSent)
         , m_lastCheckedLostPackets(connection->GetMetrics().m_packetsLost)
-        , m_updateWindowEvent([this]() { UpdateWindow(); }, AZ::Name("Server to client replication window update event"))
     {
         AZ::Entity* entity = m_controlledEntity.GetEntity();
         AZ_Assert(entity, "Invalid controlled entity provided to replication window");
         m_controlledEntityTransform = entity ? entity->GetTransform() : nullptr;
         AZ_Assert(m_controlledEntityTransform, "Controlled player entity must have a transform");
 
-        m_updateWindowEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+        m_interestManager.RegisterWindow(this);
 
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
     }
 
+    ServerToClientReplicationWindow::~ServerToClientReplicationWindow()
+    {
+        m_interestManager.UnregisterWindow(this);
+    }
+
     bool ServerToClientReplicationWindow::ReplicationSetUpdateReady()
     {
         // if we don't have a controlled entity anymore, don't send updates (validate this)
@@ -101,68 +107,129 @@ namespace Multiplayer
 
     void ServerToClientReplicationWindow::UpdateWindow()
     {
-        // Clear the candidate queue, we're going to rebuild it
-        ReplicationCandidateQueue::container_type clearQueueContainer;
-        clearQueueContainer.reserve(sv_MaxEntitiesToTrackReplication);
-        // Move the clearQueueContainer into the ReplicationCandidateQueue to maintain the reserved memory
-        ReplicationCandidateQueue clearQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(clearQueueContainer));
-        m_candidateQueue.swap(clearQueue);
-        m_replicationSet.clear();
+        // Gathers from the grid built during the last update of the interest manager
+        if (PrepareUpdate())
+        {
+            GatherCandidates(m_interestManager.GetGrid());
+            ApplyCandidates();
+        }
+    }
 
+    bool ServerToClientReplicationWindow::PrepareUpdate()
+    {
         NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
         if (!netBindComponent || !netBindComponent->HasController())
         {
             // If we don't have a controlled entity, or we no longer have control of the entity, don't run the update
-            return;
+            ClearCandidateQueue();
+            m_replicationSet.clear();
+            return false;
         }
 
         EvaluateConnection();
 
+        // Cache everything the gather needs, so that it doesn't touch the entities or the console from another thread
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
-        const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
+        m_controlledEntityPosition = transformInterface->GetWorldTranslation();
+        m_filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        m_awarenessRadius = sv_ClientAwarenessRadius;
+        m_maxEntitiesToTrack = sv_MaxEntitiesToTrackReplication;
+        m_replicateServerProxies = sv_ReplicateServerProxies;
+        return true;
+    }
+
+    void ServerToClientReplicationWindow::GatherCandidates(const InterestGrid& grid)
+    {
+        m_candidates.clear();
+        grid.GatherCandidates(m_controlledEntityPosition, m_awarenessRadius, m_candidates);
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        const auto higherPriority = [](const InterestGrid::Candidate& lhs, const InterestGrid::Candidate& rhs)
+        {
+            return lhs.m_priority > rhs.m_priority;
+        };
+        if (m_filterEntityManager == nullptr && m_replicateServerProxies)
+        {
+            // Every candidate will be accepted, only keep the ones with the highest priorities
+            if (m_candidates.size() > m_maxEntitiesToTrack)
             {
-                gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                {
-                    if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                    {
-                        gatheredEntries.push_back(visEntry);
-                    }
-                }
+                AZStd::partial_sort(m_candidates.begin(), m_candidates.begin() + m_maxEntitiesToTrack, m_candidates.end(), higherPriority);
+                m_candidates.resize(m_maxEntitiesToTrack);
             }
-        );
+        }
+        else
+        {
+            // Some candidates will be rejected on the main thread, keep all of them in priority order
+            AZStd::sort(m_candidates.begin(), m_candidates.end(), higherPriority);
+        }
+    }
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
-        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+    void ServerToClientReplicationWindow::ApplyCandidates()
+    {
+        ClearCandidateQueue();
 
-        // Add all the neighbours
-        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        // Entities may have been removed since the grid was built, they are not found in the tracker anymore
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        m_selectedEntities.clear();
+        for (const InterestGrid::Candidate& candidate : m_candidates)
         {
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
-            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
-            if (entityHandle.GetNetBindComponent() == nullptr)
+            if (m_candidateQueue.size() >= m_maxEntitiesToTrack)
+            {
+                break;
+            }
+
+            ConstNetworkEntityHandle entityHandle = networkEntityTracker->Get(candidate.m_netEntityId);
+            const AZ::Entity* entity = entityHandle.GetEntity();
+            if (entity == nullptr)
             {
-                // Entity does not have netbinding, skip this entity
                 continue;
             }
 
-            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
+            if (m_filterEntityManager && m_filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
             {
                 continue;
             }
 
-            // We want to find the closest extent to the player and prioritize using that distance
-            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
-                
-            AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
+            if (!m_replicateServerProxies)
+            {
+                NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+                if ((netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Server))
+                {
+                    // Proxy replication disabled
+                    continue;
+                }
+            }
+
+            m_candidateQueue.push(PrioritizedReplicationCandidate(entityHandle, candidate.m_priority));
+            m_selectedEntities.emplace_back(entityHandle, candidate.m_priority);
+        }
+        m_candidates.clear();
+
+        // Both the selection and the replication set are ordered by NetEntityId, walk them together to only add and remove the differences
+        AZStd::sort(m_selectedEntities.begin(), m_selectedEntities.end(),
+            [](const AZStd::pair<ConstNetworkEntityHandle, float>& lhs, const AZStd::pair<ConstNetworkEntityHandle, float>& rhs)
+        {
+            return lhs.first < rhs.first;
+        });
+        auto replicationSetIter = m_replicationSet.begin();
+        for (const auto& [entityHandle, priority] : m_selectedEntities)
+        {
+            while (replicationSetIter != m_replicationSet.end() && replicationSetIter->first < entityHandle)
+            {
+                replicationSetIter = m_replicationSet.erase(replicationSetIter);
+            }
+
+            if (replicationSetIter != m_replicationSet.end() && !(entityHandle < replicationSetIter->first))
+            {
+                replicationSetIter->second = { NetEntityRole::Client, priority };
+                ++replicationSetIter;
+            }
+            else
+            {
+                m_replicationSet.insert(replicationSetIter, ReplicationSet::value_type(entityHandle, { NetEntityRole::Client, priority }));
+            }
         }
+        m_replicationSet.erase(replicationSetIter, m_replicationSet.end());
+        m_selectedEntities.clear();
 
         // Add in all entities that have forced relevancy
         for (const ConstNetworkEntityHandle& entityHandle : GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet())
@@ -271,6 +338,15 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::ClearCandidateQueue()
+    {
+        ReplicationCandidateQueue::container_type clearQueueContainer;
+        clearQueueContainer.reserve(sv_MaxEntitiesToTrackReplication);
+        // Move the clearQueueContainer into the ReplicationCandidateQueue to maintain the reserved memory
+        ReplicationCandidateQueue clearQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(clearQueueContainer));
+        m_candidateQueue.swap(clearQueue);
+    }
+
     void ServerToClientReplicationWindow::EvaluateConnection()
     {
         const uint32_t newPacketsSent = m_connection->GetMetrics().m_packetsSent;
@@ -11,14 +11,15 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/ReplicationWindows/InterestGrid.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
-#include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace Multiplayer
 {
+    class InterestManager;
     class NetSystemComponent;
     class NetworkHierarchyRootComponent;
 
@@ -39,7 +40,8 @@ namespace Multiplayer
         // we sort lowest priority first, so that we can easily keep the biggest N priorities
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
-        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
+        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection, InterestManager& interestManager);
+        ~ServerToClientReplicationWindow() override;
 
         //! IReplicationWindow interface
         //! @{
@@ -53,12 +55,23 @@ namespace Multiplayer
         void DebugDraw() const override;
         //! @}
 
+        //! Window update steps, run by the InterestManager.
+        //! @{
+        //! Prepares the update on the main thread, returns false if the window has no controlled entity to gather candidates for.
+        bool PrepareUpdate();
+        //! Gathers the candidates around the controlled entity from the grid, can run on any thread.
+        void GatherCandidates(const InterestGrid& grid);
+        //! Applies the gathered candidates to the replication set on the main thread, only adding and removing the entities that changed.
+        void ApplyCandidates();
+        //! @}
+
     private:
         void OnEntityActivated(AZ::Entity* entity);
         void OnEntityDeactivated(AZ::Entity* entity);
 
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
+        void ClearCandidateQueue();
         void EvaluateConnection();
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
 
@@ -68,11 +81,20 @@ namespace Multiplayer
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
 
-        AZ::ScheduledEvent m_updateWindowEvent;
+        InterestManager& m_interestManager;
 
         NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
 
+        // State of the update in progress
+        AZ::Vector3 m_controlledEntityPosition = AZ::Vector3::CreateZero();
+        IFilterEntityManager* m_filterEntityManager = nullptr;
+        float m_awarenessRadius = 0.0f;
+        uint32_t m_maxEntitiesToTrack = 0;
+        bool m_replicateServerProxies = true;
+        AZStd::vector<InterestGrid::Candidate> m_candidates;
+        AZStd::vector<AZStd::pair<ConstNetworkEntityHandle, float>> m_selectedEntities;
+
         AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
         AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
 
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <benchmark/benchmark.h>
+
+namespace Multiplayer
+{
+    /*
+     * 20000 moving entities on a 4km square map and 200 clients, each client tracks the 512 entities with the highest priority
+     * inside its 500m awareness radius, like the ServerToClientReplicationWindow with the default cvars.
+     */
+    class InterestGridBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t EntityCount = 20000;
+        static constexpr uint32_t ClientCount = 200;
+        static constexpr uint32_t MaxEntitiesToTrack = 512;
+        static constexpr float MapSize = 4000.0f;
+        static constexpr float MaxSpeed = 5.0f;
+        static constexpr float AwarenessRadius = 500.0f;
+        static constexpr float CellSize = 64.0f;
+
+        void internalSetUp()
+        {
+            AZ::NameDictionary::Create();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc desc;
+            for (uint32_t threadIndex = 0; threadIndex < AZStd::thread::hardware_concurrency(); ++threadIndex)
+            {
+                desc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(desc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
+            m_grid = AZStd::make_unique<InterestGrid>();
+            m_octree = AZStd::make_unique<AzFramework::OctreeScene>(AZ::Name("InterestGridBenchmark"));
+            m_visEntries.resize(EntityCount);
+            m_positions.resize(EntityCount);
+            m_velocities.resize(EntityCount);
+            for (uint32_t entityIndex = 0; entityIndex < EntityCount; ++entityIndex)
+            {
+                m_positions[entityIndex] = AZ::Vector3(m_random.GetRandomFloat() * MapSize, m_random.GetRandomFloat() * MapSize, 0.0f);
+                m_velocities[entityIndex] = AZ::Vector3(m_random.GetRandomFloat() - 0.5f, m_random.GetRandomFloat() - 0.5f, 0.0f) * (2.0f * MaxSpeed);
+                m_visEntries[entityIndex].m_typeFlags = AzFramework::VisibilityEntry::TYPE_Entity;
+                m_visEntries[entityIndex].m_userData = reinterpret_cast<void*>(static_cast<uintptr_t>(entityIndex));
+            }
+            m_clientCandidates.resize(ClientCount);
+            MoveEntities();
+        }
+
+        void internalTearDown()
+        {
+            for (uint32_t entityIndex = 0; entityIndex < EntityCount; ++entityIndex)
+            {
+                m_octree->RemoveEntry(m_visEntries[entityIndex]);
+            }
+            m_octree.reset();
+            m_visEntries = {};
+            m_grid.reset();
+            m_positions = {};
+            m_velocities = {};
+            m_clientCandidates = {};
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            AZ::NameDictionary::Destroy();
+        }
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Moves the entities and updates their entries in the octree, like the visibility system does when transforms change.
+        void MoveEntities()
+        {
+            for (uint32_t entityIndex = 0; entityIndex < EntityCount; ++entityIndex)
+            {
+                AZ::Vector3 position = m_positions[entityIndex] + m_velocities[entityIndex];
+                if (position.GetX() < 0.0f || position.GetX() > MapSize || position.GetY() < 0.0f || position.GetY() > MapSize)
+                {
+                    m_velocities[entityIndex] = -m_velocities[entityIndex];
+                    position = m_positions[entityIndex];
+                }
+                m_positions[entityIndex] = position;
+                m_visEntries[entityIndex].m_boundingVolume = AZ::Aabb::CreateCenterRadius(position, 1.0f);
+                m_octree->InsertOrUpdateEntry(m_visEntries[entityIndex]);
+            }
+        }
+
+        //! Clients follow some of the entities.
+        AZ::Vector3 GetClientPosition(uint32_t clientIndex) const
+        {
+            return m_positions[clientIndex * (EntityCount / ClientCount)];
+        }
+
+        //! Keeps the highest priorities, the way ServerToClientReplicationWindow::GatherCandidates does.
+        static void SelectCandidates(AZStd::vector<InterestGrid::Candidate>& candidates)
+        {
+            if (candidates.size() > MaxEntitiesToTrack)
+            {
+                AZStd::partial_sort(candidates.begin(), candidates.begin() + MaxEntitiesToTrack, candidates.end(),
+                    [](const InterestGrid::Candidate& lhs, const InterestGrid::Candidate& rhs) { return lhs.m_priority > rhs.m_priority; });
+                candidates.resize(MaxEntitiesToTrack);
+            }
+        }
+
+        void BuildGrid()
+        {
+            m_grid->Clear();
+            for (uint32_t entityIndex = 0; entityIndex < EntityCount; ++entityIndex)
+            {
+                m_grid->AddEntity(NetEntityId{ entityIndex }, m_visEntries[entityIndex].m_boundingVolume);
+            }
+            m_grid->Build(CellSize);
+        }
+
+        void GatherClient(uint32_t clientIndex)
+        {
+            AZStd::vector<InterestGrid::Candidate>& candidates = m_clientCandidates[clientIndex];
+            candidates.clear();
+            m_grid->GatherCandidates(GetClientPosition(clientIndex), AwarenessRadius, candidates);
+            SelectCandidates(candidates);
+        }
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZStd::unique_ptr<InterestGrid> m_grid;
+        AZStd::unique_ptr<AzFramework::OctreeScene> m_octree;
+        AZStd::vector<AzFramework::VisibilityEntry> m_visEntries; // Sized once, the octree points to the entries
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_velocities;
+        AZStd::vector<AZStd::vector<InterestGrid::Candidate>> m_clientCandidates;
+        AZ::SimpleLcgRandom m_random{ 1234 };
+    };
+
+    // Previous behavior, every client walks the octree and pushes its candidates through a bounded priority queue
+    BENCHMARK_DEFINE_F(InterestGridBenchmark, OctreeQueryPerClient)(benchmark::State& state)
+    {
+        struct QueueCandidate
+        {
+            uint32_t m_entityIndex;
+            float m_priority;
+            bool operator<(const QueueCandidate& rhs) const { return m_priority > rhs.m_priority; }
+        };
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            state.PauseTiming();
+            MoveEntities();
+            state.ResumeTiming();
+
+            for (uint32_t clientIndex = 0; clientIndex < ClientCount; ++clientIndex)
+            {
+                const AZ::Vector3 clientPosition = GetClientPosition(clientIndex);
+                AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
+                m_octree->Enumerate(AZ::Sphere(clientPosition, AwarenessRadius), [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    gatheredEntries.insert(gatheredEntries.end(), nodeData.m_entries.begin(), nodeData.m_entries.end());
+                });
+
+                AZStd::priority_queue<QueueCandidate> candidateQueue;
+                for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+                {
+                    const AZ::Vector3 supportNormal = clientPosition - visEntry->m_boundingVolume.GetCenter();
+                    const float distanceSquared = clientPosition.GetDistanceSq(visEntry->m_boundingVolume.GetSupport(supportNormal));
+                    const float priority = (distanceSquared > 0.0f) ? 1.0f / distanceSquared : 0.0f;
+                    if (candidateQueue.size() >= MaxEntitiesToTrack)
+                    {
+                        candidateQueue.pop();
+                    }
+                    candidateQueue.push({ static_cast<uint32_t>(reinterpret_cast<uintptr_t>(visEntry->m_userData)), priority });
+                }
+                benchmark::DoNotOptimize(candidateQueue.size());
+            }
+        }
+    }
+
+    BENCHMARK_REGISTER_F(InterestGridBenchmark, OctreeQueryPerClient)
+        ->Unit(benchmark::kMillisecond)
+        ;
+
+    // The grid is rebuilt once per tick and the clients gather from it one after the other
+    BENCHMARK_DEFINE_F(InterestGridBenchmark, SharedGrid)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto value : state)
+        {
+            state.PauseTiming();
+            MoveEntities();
+            state.ResumeTiming();
+
+            BuildGrid();
+            for (uint32_t clientIndex = 0; clientIndex < ClientCount; ++clientIndex)
+            {
+                GatherClient(clientIndex);
+            }
+        }
+    }
+
+    BENCHMARK_REGISTER_F(InterestGridBenchmark, SharedGrid)
+        ->Unit(benchmark::kMillisecond)
+        ;
+
+    // The grid is rebuilt once per tick and the clients gather from it in parallel
+    BENCHMARK_DEFINE_F(InterestGridBenchmark, SharedGridParallel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto value : state)
+        {
+            state.PauseTiming();
+            MoveEntities();
+            state.ResumeTiming();
+
+            BuildGrid();
+            AZ::parallel_for(0, static_cast<int32_t>(ClientCount), [this](int32_t clientIndex)
+            {
+                GatherClient(static_cast<uint32_t>(clientIndex));
+            });
+        }
+    }
+
+    BENCHMARK_REGISTER_F(InterestGridBenchmark, SharedGridParallel)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime()
+        ;
+}
+
+#endif
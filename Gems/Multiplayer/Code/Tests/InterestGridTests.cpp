@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class InterestGridTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_grid = AZStd::make_unique<InterestGrid>();
+        }
+
+        void TearDown() override
+        {
+            m_grid.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        AZStd::vector<NetEntityId> Gather(const AZ::Vector3& position, float radius)
+        {
+            AZStd::vector<InterestGrid::Candidate> candidates;
+            m_grid->GatherCandidates(position, radius, candidates);
+
+            AZStd::vector<NetEntityId> result;
+            for (const InterestGrid::Candidate& candidate : candidates)
+            {
+                result.push_back(candidate.m_netEntityId);
+            }
+            AZStd::sort(result.begin(), result.end());
+            return result;
+        }
+
+        AZStd::unique_ptr<InterestGrid> m_grid;
+    };
+
+    TEST_F(InterestGridTests, GatherCandidates_EmptyGrid_ReturnsNothing)
+    {
+        m_grid->Build(64.0f);
+        EXPECT_TRUE(Gather(AZ::Vector3::CreateZero(), 500.0f).empty());
+    }
+
+    TEST_F(InterestGridTests, GatherCandidates_CloserEntitiesHaveHigherPriorities)
+    {
+        m_grid->AddEntity(NetEntityId{ 1 }, AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(50.0f, 0.0f, 0.0f), AZ::Vector3(1.0f)));
+        m_grid->AddEntity(NetEntityId{ 2 }, AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(10.0f, 0.0f, 0.0f), AZ::Vector3(1.0f)));
+        m_grid->AddEntity(NetEntityId{ 3 }, AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(0.0f, 200.0f, 0.0f), AZ::Vector3(1.0f)));
+        m_grid->Build(64.0f);
+
+        AZStd::vector<InterestGrid::Candidate> candidates;
+        m_grid->GatherCandidates(AZ::Vector3::CreateZero(), 100.0f, candidates);
+        ASSERT_EQ(candidates.size(), 2u);
+        AZStd::sort(candidates.begin(), candidates.end(), [](const InterestGrid::Candidate& lhs, const InterestGrid::Candidate& rhs)
+        {
+            return lhs.m_priority > rhs.m_priority;
+        });
+        EXPECT_EQ(candidates[0].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_EQ(candidates[1].m_netEntityId, NetEntityId{ 1 });
+        EXPECT_FLOAT_EQ(candidates[0].m_priority, 1.0f / candidates[0].m_distanceSquared);
+    }
+
+    TEST_F(InterestGridTests, GatherCandidates_LargeEntity_FoundFromANeighbouringCell)
+    {
+        // The entity is binned far from the query, but its bounds reach into it
+        m_grid->AddEntity(NetEntityId{ 1 }, AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(500.0f, 0.0f, 0.0f), AZ::Vector3(450.0f, 10.0f, 10.0f)));
+        m_grid->AddEntity(NetEntityId{ 2 }, AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(1000.0f, 0.0f, 0.0f), AZ::Vector3(1.0f)));
+        m_grid->Build(16.0f);
+
+        EXPECT_EQ(Gather(AZ::Vector3::CreateZero(), 60.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 1 } }));
+    }
+
+    TEST_F(InterestGridTests, GatherCandidates_ManyEntities_MatchesBruteForce)
+    {
+        constexpr uint32_t entityCount = 5000;
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::vector<AZ::Aabb> bounds;
+        for (uint32_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+        {
+            const AZ::Vector3 center(random.GetRandomFloat() * 4000.0f - 2000.0f, random.GetRandomFloat() * 4000.0f - 2000.0f, random.GetRandomFloat() * 50.0f);
+            bounds.push_back(AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(random.GetRandomFloat() * 5.0f + 0.5f)));
+            m_grid->AddEntity(NetEntityId{ entityIndex }, bounds.back());
+        }
+
+        // Small cells are grown to keep the grid under the maximum number of cells
+        m_grid->Build(1.0f);
+        EXPECT_EQ(m_grid->GetEntityCount(), entityCount);
+
+        for (uint32_t queryIndex = 0; queryIndex < 50; ++queryIndex)
+        {
+            const AZ::Vector3 position(random.GetRandomFloat() * 5000.0f - 2500.0f, random.GetRandomFloat() * 5000.0f - 2500.0f, 0.0f);
+            const float radius = random.GetRandomFloat() * 500.0f;
+
+            AZStd::vector<NetEntityId> expected;
+            for (uint32_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+            {
+                if (bounds[entityIndex].GetDistanceSq(position) <= radius * radius)
+                {
+                    expected.push_back(NetEntityId{ entityIndex });
+                }
+            }
+
+            EXPECT_EQ(Gather(position, radius), expected);
+        }
+    }
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonHierarchySetup.h>
+#include <MockInterfaces.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
+#include <AzTest/AzTest.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <ReplicationWindows/InterestManager.h>
+#include <ReplicationWindows/ServerToClientReplicationWindow.h>
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    //! Unit sized bounds around the position of each entity, the bounds of the transform components are not tracked in unit tests.
+    class TestEntityBoundsUnion
+        : public AzFramework::IEntityBoundsUnion
+    {
+    public:
+        void RefreshEntityLocalBoundsUnion([[maybe_unused]] AZ::EntityId entityId) override {}
+        AZ::Aabb GetEntityLocalBoundsUnion([[maybe_unused]] AZ::EntityId entityId) const override
+        {
+            return AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(0.5f));
+        }
+        AZ::Aabb GetEntityWorldBoundsUnion(AZ::EntityId entityId) const override
+        {
+            AZ::Vector3 position = AZ::Vector3::CreateZero();
+            AZ::TransformBus::EventResult(position, entityId, &AZ::TransformBus::Events::GetWorldTranslation);
+            return AZ::Aabb::CreateCenterHalfExtents(position, AZ::Vector3(0.5f));
+        }
+        void ProcessEntityBoundsUnionRequests() override {}
+        void OnTransformUpdated([[maybe_unused]] AZ::Entity* entity) override {}
+    };
+
+    class InterestManagerTests
+        : public HierarchyTests
+    {
+    public:
+        void SetUp() override
+        {
+            HierarchyTests::SetUp();
+
+            ON_CALL(*m_mockTime, GetElapsedTimeMs()).WillByDefault(Invoke([this]() { return m_elapsedTimeMs; }));
+            AZ::Interface<AzFramework::IEntityBoundsUnion>::Register(&m_entityBoundsUnion);
+
+            m_interestManager = AZStd::make_unique<InterestManager>();
+        }
+
+        void TearDown() override
+        {
+            m_windows.clear();
+            m_interestManager.reset();
+            m_entityInfos.clear();
+
+            AZ::Interface<AzFramework::IEntityBoundsUnion>::Unregister(&m_entityBoundsUnion);
+
+            HierarchyTests::TearDown();
+        }
+
+        //! Creates an active network entity with authority at the position, and adds it to the network entity tracker.
+        EntityInfo& CreateEntity(AZ::u64 entityId, NetEntityId netEntityId, const AZ::Vector3& position)
+        {
+            EntityInfo& entityInfo =
+                *m_entityInfos.emplace_back(AZStd::make_unique<EntityInfo>(entityId, "entity", netEntityId, EntityInfo::Role::None));
+            PopulateHierarchicalEntity(entityInfo);
+            SetupEntity(entityInfo.m_entity, netEntityId, NetEntityRole::Authority);
+
+            const NetworkEntityHandle handle(entityInfo.m_entity.get(), m_networkEntityTracker.get());
+            entityInfo.m_replicator = AZStd::make_unique<EntityReplicator>(*m_entityReplicationManager, m_mockConnection.get(), NetEntityRole::Client, handle);
+            entityInfo.m_replicator->Initialize(handle);
+
+            entityInfo.m_entity->Activate();
+            entityInfo.m_entity->GetTransform()->SetWorldTranslation(position);
+            m_networkEntityTracker->Add(netEntityId, entityInfo.m_entity.get());
+            return entityInfo;
+        }
+
+        ServerToClientReplicationWindow& CreateWindow(const EntityInfo& controlledEntity)
+        {
+            return *m_windows.emplace_back(AZStd::make_unique<ServerToClientReplicationWindow>(
+                NetworkEntityHandle(controlledEntity.m_entity.get(), m_networkEntityTracker.get()), m_mockConnection.get(), *m_interestManager));
+        }
+
+        static InterestGrid BuildGrid(const AZStd::vector<const EntityInfo*>& entities)
+        {
+            InterestGrid grid;
+            for (const EntityInfo* entityInfo : entities)
+            {
+                grid.AddEntity(entityInfo->m_netId, AZ::Aabb::CreateCenterHalfExtents(
+                    entityInfo->m_entity->GetTransform()->GetWorldTranslation(), AZ::Vector3(0.5f)));
+            }
+            grid.Build(64.0f);
+            return grid;
+        }
+
+        static AZStd::vector<AZStd::pair<NetEntityId, float>> GetPriorities(const ServerToClientReplicationWindow& window)
+        {
+            AZStd::vector<AZStd::pair<NetEntityId, float>> priorities;
+            for (const auto& [entityHandle, entry] : window.GetReplicationSet())
+            {
+                priorities.emplace_back(entityHandle.GetNetEntityId(), entry.m_priority);
+            }
+            return priorities;
+        }
+
+        static AZStd::vector<NetEntityId> GetReplicatedEntities(const ServerToClientReplicationWindow& window, NetEntityRole role)
+        {
+            AZStd::vector<NetEntityId> entities;
+            for (const auto& [entityHandle, entry] : window.GetReplicationSet())
+            {
+                if (entry.m_netEntityRole == role)
+                {
+                    entities.push_back(entityHandle.GetNetEntityId());
+                }
+            }
+            return entities;
+        }
+
+        AZ::TimeMs m_elapsedTimeMs = AZ::Time::ZeroTimeMs;
+        TestEntityBoundsUnion m_entityBoundsUnion;
+        AZStd::unique_ptr<InterestManager> m_interestManager;
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entityInfos;
+        AZStd::vector<AZStd::unique_ptr<ServerToClientReplicationWindow>> m_windows;
+    };
+
+    TEST_F(InterestManagerTests, ApplyCandidates_ChangedSelection_OnlyAddsAndRemovesTheDifferences)
+    {
+        const EntityInfo& player = CreateEntity(1, NetEntityId{ 1 }, AZ::Vector3::CreateZero());
+        const EntityInfo& nearEntity = CreateEntity(2, NetEntityId{ 2 }, AZ::Vector3(10.0f, 0.0f, 0.0f));
+        const EntityInfo& keptEntity = CreateEntity(3, NetEntityId{ 3 }, AZ::Vector3(20.0f, 0.0f, 0.0f));
+        const EntityInfo& farEntity = CreateEntity(4, NetEntityId{ 4 }, AZ::Vector3(2000.0f, 0.0f, 0.0f));
+        ServerToClientReplicationWindow& window = CreateWindow(player);
+
+        ASSERT_TRUE(window.PrepareUpdate());
+        window.GatherCandidates(BuildGrid({ &player, &nearEntity, &keptEntity, &farEntity }));
+        window.ApplyCandidates();
+
+        // The controlled entity is a candidate as well, but stays autonomous
+        EXPECT_THAT(GetReplicatedEntities(window, NetEntityRole::Client), UnorderedElementsAre(NetEntityId{ 2 }, NetEntityId{ 3 }));
+        EXPECT_THAT(GetReplicatedEntities(window, NetEntityRole::Autonomous), ElementsAre(NetEntityId{ 1 }));
+        const float keptPriority = window.GetReplicationSet().find(ConstNetworkEntityHandle(keptEntity.m_entity.get(), m_networkEntityTracker.get()))->second.m_priority;
+
+        // The near entity left the grid, the far one moved closer and the kept one moved away
+        farEntity.m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(30.0f, 0.0f, 0.0f));
+        keptEntity.m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(40.0f, 0.0f, 0.0f));
+        ASSERT_TRUE(window.PrepareUpdate());
+        window.GatherCandidates(BuildGrid({ &player, &keptEntity, &farEntity }));
+        window.ApplyCandidates();
+
+        EXPECT_THAT(GetReplicatedEntities(window, NetEntityRole::Client), UnorderedElementsAre(NetEntityId{ 3 }, NetEntityId{ 4 }));
+        EXPECT_THAT(GetReplicatedEntities(window, NetEntityRole::Autonomous), ElementsAre(NetEntityId{ 1 }));
+        EXPECT_LT(window.GetReplicationSet().find(ConstNetworkEntityHandle(keptEntity.m_entity.get(), m_networkEntityTracker.get()))->second.m_priority, keptPriority);
+    }
+
+    TEST_F(InterestManagerTests, ApplyCandidates_SameSelection_KeepsTheReplicationSet)
+    {
+        const EntityInfo& player = CreateEntity(1, NetEntityId{ 1 }, AZ::Vector3::CreateZero());
+        const EntityInfo& nearEntity = CreateEntity(2, NetEntityId{ 2 }, AZ::Vector3(10.0f, 0.0f, 0.0f));
+        ServerToClientReplicationWindow& window = CreateWindow(player);
+        const InterestGrid grid = BuildGrid({ &player, &nearEntity });
+
+        ASSERT_TRUE(window.PrepareUpdate());
+        window.GatherCandidates(grid);
+        window.ApplyCandidates();
+        const AZStd::vector<AZStd::pair<NetEntityId, float>> priorities = GetPriorities(window);
+        EXPECT_EQ(priorities.size(), 2);
+
+        ASSERT_TRUE(window.PrepareUpdate());
+        window.GatherCandidates(grid);
+        window.ApplyCandidates();
+        EXPECT_EQ(priorities, GetPriorities(window));
+        EXPECT_THAT(GetReplicatedEntities(window, NetEntityRole::Autonomous), ElementsAre(NetEntityId{ 1 }));
+    }
+
+    TEST_F(InterestManagerTests, PrepareUpdate_ControlledEntityRemoved_ClearsTheReplicationSet)
+    {
+        const EntityInfo& player = CreateEntity(1, NetEntityId{ 1 }, AZ::Vector3::CreateZero());
+        const EntityInfo& nearEntity = CreateEntity(2, NetEntityId{ 2 }, AZ::Vector3(10.0f, 0.0f, 0.0f));
+        ServerToClientReplicationWindow& window = CreateWindow(player);
+
+        ASSERT_TRUE(window.PrepareUpdate());
+        window.GatherCandidates(BuildGrid({ &player, &nearEntity }));
+        window.ApplyCandidates();
+        EXPECT_EQ(window.GetReplicationSet().size(), 2);
+
+        m_networkEntityTracker->erase(player.m_netId);
+        EXPECT_FALSE(window.PrepareUpdate());
+        EXPECT_TRUE(window.GetReplicationSet().empty());
+    }
+
+    TEST_F(InterestManagerTests, Update_WindowsDue_GatherFromTheSharedGrid)
+    {
+        const EntityInfo& firstPlayer = CreateEntity(1, NetEntityId{ 1 }, AZ::Vector3::CreateZero());
+        const EntityInfo& secondPlayer = CreateEntity(2, NetEntityId{ 2 }, AZ::Vector3(1000.0f, 0.0f, 0.0f));
+        CreateEntity(3, NetEntityId{ 3 }, AZ::Vector3(10.0f, 0.0f, 0.0f));
+        CreateEntity(4, NetEntityId{ 4 }, AZ::Vector3(990.0f, 0.0f, 0.0f));
+        ServerToClientReplicationWindow& firstWindow = CreateWindow(firstPlayer);
+        ServerToClientReplicationWindow& secondWindow = CreateWindow(secondPlayer);
+
+        // The windows are not due until sv_ClientReplicationWindowUpdateMs has elapsed since they were registered
+        m_interestManager->Update();
+        EXPECT_TRUE(firstWindow.GetReplicationSet().empty());
+        EXPECT_TRUE(secondWindow.GetReplicationSet().empty());
+        EXPECT_EQ(m_interestManager->GetGrid().GetEntityCount(), 0);
+
+        m_elapsedTimeMs = AZ::TimeMs{ 1000 };
+        m_interestManager->Update();
+        EXPECT_EQ(m_interestManager->GetGrid().GetEntityCount(), 4);
+        EXPECT_THAT(GetReplicatedEntities(firstWindow, NetEntityRole::Client), ElementsAre(NetEntityId{ 3 }));
+        EXPECT_THAT(GetReplicatedEntities(firstWindow, NetEntityRole::Autonomous), ElementsAre(NetEntityId{ 1 }));
+        EXPECT_THAT(GetReplicatedEntities(secondWindow, NetEntityRole::Client), ElementsAre(NetEntityId{ 4 }));
+        EXPECT_THAT(GetReplicatedEntities(secondWindow, NetEntityRole::Autonomous), ElementsAre(NetEntityId{ 2 }));
+
+        // A window that is removed is not updated anymore
+        m_windows.pop_back();
+        m_elapsedTimeMs = AZ::TimeMs{ 2000 };
+        m_interestManager->Update();
+        EXPECT_THAT(GetReplicatedEntities(firstWindow, NetEntityRole::Client), ElementsAre(NetEntityId{ 3 }));
+    }
+}
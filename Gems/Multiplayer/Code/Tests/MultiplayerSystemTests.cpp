@@ -19,6 +19,7 @@
 #include <IMultiplayerConnectionMock.h>
 #include <IMultiplayerSpawnerMock.h>
 #include <ConnectionData/ServerToClientConnectionData.h>
+#include <ReplicationWindows/InterestManager.h>
 #include <ReplicationWindows/ServerToClientReplicationWindow.h>
 
 namespace UnitTest
@@ -131,10 +132,11 @@ namespace UnitTest
         AZ_TEST_START_TRACE_SUPPRESSION;
         // Setup mock connection and dummy connection data, this should raise two errors around entity validity
         Multiplayer::NetworkEntityHandle controlledEntity;
+        Multiplayer::InterestManager interestManager;
         IMultiplayerConnectionMock connMock =
             IMultiplayerConnectionMock(AzNetworking::ConnectionId(), AzNetworking::IpAddress(), AzNetworking::ConnectionRole::Acceptor);
         Multiplayer::ServerToClientConnectionData* connectionData = new Multiplayer::ServerToClientConnectionData(&connMock, *m_mpComponent);
-        connectionData->GetReplicationManager().SetReplicationWindow(AZStd::make_unique<Multiplayer::ServerToClientReplicationWindow>(controlledEntity, &connMock));
+        connectionData->GetReplicationManager().SetReplicationWindow(AZStd::make_unique<Multiplayer::ServerToClientReplicationWindow>(controlledEntity, &connMock, interestManager));
         connMock.SetUserData(connectionData);
 
         m_mpComponent->OnDisconnect(&connMock, AzNetworking::DisconnectReason::None, AzNetworking::TerminationEndpoint::Local);
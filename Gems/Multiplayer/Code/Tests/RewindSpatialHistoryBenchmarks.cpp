@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Source/NetworkTime/RewindSpatialHistory.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+namespace Multiplayer
+{
+    /*
+     * 2000 entities moving up to 15 meters per frame on a 1km square map, with 100 rewound hit checks per frame.
+     * Every hit check targets the rewound position of a random entity 1 to 10 frames in the past.
+     */
+    class RewindSpatialHistoryBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t EntityCount = 2000;
+        static constexpr uint32_t QueriesPerFrame = 100;
+        static constexpr float MapSize = 1000.0f;
+        static constexpr float MaxSpeed = 15.0f;
+        static constexpr float EntityRadius = 1.0f;
+        static constexpr float HitVolumeHalfExtent = 2.0f;
+        static constexpr float ExtrudeDistance = 50.0f; // Default of sv_RewindVolumeExtrudeDistance
+
+        void internalSetUp()
+        {
+            m_history = AZStd::make_unique<RewindSpatialHistory>();
+            m_positions.resize(RewindHistorySize);
+            m_velocities.resize(EntityCount);
+            m_positions[0].resize(EntityCount);
+            for (uint32_t entityIndex = 0; entityIndex < EntityCount; ++entityIndex)
+            {
+                m_positions[0][entityIndex] = AZ::Vector3(m_random.GetRandomFloat() * MapSize, m_random.GetRandomFloat() * MapSize, 0.0f);
+                m_velocities[entityIndex] = AZ::Vector3(m_random.GetRandomFloat() - 0.5f, m_random.GetRandomFloat() - 0.5f, 0.0f) * (2.0f * MaxSpeed);
+            }
+
+            // Fill the rewind window
+            for (uint32_t frame = 0; frame < RewindHistorySize; ++frame)
+            {
+                SimulateFrame();
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_history.reset();
+            m_positions = {};
+            m_velocities = {};
+        }
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        const AZStd::vector<AZ::Vector3>& GetPositions(uint32_t frame) const
+        {
+            return m_positions[frame % RewindHistorySize];
+        }
+
+        //! Moves the entities and records the new frame.
+        void SimulateFrame()
+        {
+            const AZStd::vector<AZ::Vector3>& previous = GetPositions(m_frame);
+            ++m_frame;
+            AZStd::vector<AZ::Vector3>& current = m_positions[m_frame % RewindHistorySize];
+            current.resize(EntityCount);
+            for (uint32_t entityIndex = 0; entityIndex < EntityCount; ++entityIndex)
+            {
+                AZ::Vector3 position = previous[entityIndex] + m_velocities[entityIndex];
+                if (position.GetX() < 0.0f || position.GetX() > MapSize || position.GetY() < 0.0f || position.GetY() > MapSize)
+                {
+                    m_velocities[entityIndex] = -m_velocities[entityIndex];
+                    position = previous[entityIndex];
+                }
+                current[entityIndex] = position;
+            }
+
+            m_history->BeginFrame(HostFrameId{ m_frame });
+            for (uint32_t entityIndex = 0; entityIndex < EntityCount; ++entityIndex)
+            {
+                m_history->AddEntity(NetEntityId{ entityIndex }, current[entityIndex], EntityRadius);
+            }
+            m_history->EndFrame();
+        }
+
+        //! Returns a rewound hit check volume and the frame it was made in.
+        AZ::Aabb GetHitVolume(uint32_t& outFrame)
+        {
+            outFrame = m_frame - 1 - (m_random.GetRandom() % 10);
+            const uint32_t target = m_random.GetRandom() % EntityCount;
+            return AZ::Aabb::CreateCenterHalfExtents(GetPositions(outFrame)[target], AZ::Vector3(HitVolumeHalfExtent));
+        }
+
+        //! Returns true if the entity overlaps the volume at its rewound position, this is the check every synced entity goes through.
+        bool OverlapsRewound(uint32_t frame, uint32_t entityIndex, const AZ::Aabb& volume) const
+        {
+            return AZ::Aabb::CreateCenterRadius(GetPositions(frame)[entityIndex], EntityRadius).Overlaps(volume);
+        }
+
+        AZStd::unique_ptr<RewindSpatialHistory> m_history;
+        AZStd::vector<AZStd::vector<AZ::Vector3>> m_positions;
+        AZStd::vector<AZ::Vector3> m_velocities;
+        AZ::SimpleLcgRandom m_random{ 1234 };
+        uint32_t m_frame = 0;
+    };
+
+    // Previous behavior, the candidates are the entities currently inside the volume expanded by the extrude distance
+    BENCHMARK_DEFINE_F(RewindSpatialHistoryBenchmark, ExpandedCurrentVolume)(benchmark::State& state)
+    {
+        uint64_t candidateCount = 0;
+        uint64_t hitCount = 0;
+        for ([[maybe_unused]] auto value : state)
+        {
+            SimulateFrame();
+            const AZStd::vector<AZ::Vector3>& current = GetPositions(m_frame);
+            for (uint32_t queryIndex = 0; queryIndex < QueriesPerFrame; ++queryIndex)
+            {
+                uint32_t frame = 0;
+                const AZ::Aabb volume = GetHitVolume(frame);
+                const AZ::Aabb expandedVolume = volume.GetExpanded(AZ::Vector3(ExtrudeDistance));
+                for (uint32_t entityIndex = 0; entityIndex < EntityCount; ++entityIndex)
+                {
+                    if (AZ::Aabb::CreateCenterRadius(current[entityIndex], EntityRadius).Overlaps(expandedVolume))
+                    {
+                        ++candidateCount;
+                        hitCount += OverlapsRewound(frame, entityIndex, volume) ? 1 : 0;
+                    }
+                }
+            }
+        }
+        state.counters["CandidatesPerQuery"] = benchmark::Counter(static_cast<double>(candidateCount) / QueriesPerFrame, benchmark::Counter::kAvgIterations);
+        state.counters["HitsPerQuery"] = benchmark::Counter(static_cast<double>(hitCount) / QueriesPerFrame, benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK_REGISTER_F(RewindSpatialHistoryBenchmark, ExpandedCurrentVolume)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    // The candidates are the entities recorded inside the volume in the rewound frame
+    BENCHMARK_DEFINE_F(RewindSpatialHistoryBenchmark, HistoricalFrame)(benchmark::State& state)
+    {
+        uint64_t candidateCount = 0;
+        uint64_t hitCount = 0;
+        AZStd::vector<NetEntityId> candidates;
+        for ([[maybe_unused]] auto value : state)
+        {
+            SimulateFrame();
+            for (uint32_t queryIndex = 0; queryIndex < QueriesPerFrame; ++queryIndex)
+            {
+                uint32_t frame = 0;
+                const AZ::Aabb volume = GetHitVolume(frame);
+                candidates.clear();
+                m_history->Query(HostFrameId{ frame }, volume, candidates);
+                candidateCount += candidates.size();
+                for (NetEntityId netEntityId : candidates)
+                {
+                    hitCount += OverlapsRewound(frame, static_cast<uint32_t>(netEntityId), volume) ? 1 : 0;
+                }
+            }
+        }
+        state.counters["CandidatesPerQuery"] = benchmark::Counter(static_cast<double>(candidateCount) / QueriesPerFrame, benchmark::Counter::kAvgIterations);
+        state.counters["HitsPerQuery"] = benchmark::Counter(static_cast<double>(hitCount) / QueriesPerFrame, benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK_REGISTER_F(RewindSpatialHistoryBenchmark, HistoricalFrame)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
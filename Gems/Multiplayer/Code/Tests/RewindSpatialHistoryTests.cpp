@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/RewindSpatialHistory.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class RewindSpatialHistoryTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_history = AZStd::make_unique<RewindSpatialHistory>();
+        }
+
+        void TearDown() override
+        {
+            m_history.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        AZStd::vector<NetEntityId> Query(HostFrameId frameId, const AZ::Vector3& center, float halfExtent)
+        {
+            AZStd::vector<NetEntityId> result;
+            m_history->Query(frameId, AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(halfExtent)), result);
+            AZStd::sort(result.begin(), result.end());
+            return result;
+        }
+
+        AZStd::unique_ptr<RewindSpatialHistory> m_history;
+    };
+
+    TEST_F(RewindSpatialHistoryTests, Query_ReturnsEntitiesAtTheirRecordedPosition)
+    {
+        m_history->BeginFrame(HostFrameId{ 1 });
+        m_history->AddEntity(NetEntityId{ 1 }, AZ::Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+        m_history->AddEntity(NetEntityId{ 2 }, AZ::Vector3(100.0f, 0.0f, 0.0f), 1.0f);
+        m_history->EndFrame();
+
+        // Entity 1 moved away, the rewound frame still has it at the origin
+        m_history->BeginFrame(HostFrameId{ 3 });
+        m_history->AddEntity(NetEntityId{ 1 }, AZ::Vector3(100.0f, 0.0f, 0.0f), 1.0f);
+        m_history->AddEntity(NetEntityId{ 2 }, AZ::Vector3(100.0f, 0.0f, 0.0f), 1.0f);
+        m_history->EndFrame();
+
+        EXPECT_EQ(Query(HostFrameId{ 1 }, AZ::Vector3::CreateZero(), 2.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 1 } }));
+        EXPECT_EQ(Query(HostFrameId{ 1 }, AZ::Vector3(100.0f, 0.0f, 0.0f), 2.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 2 } }));
+        EXPECT_TRUE(Query(HostFrameId{ 3 }, AZ::Vector3::CreateZero(), 2.0f).empty());
+        EXPECT_EQ(Query(HostFrameId{ 3 }, AZ::Vector3(100.0f, 0.0f, 0.0f), 2.0f).size(), 2u);
+    }
+
+    TEST_F(RewindSpatialHistoryTests, Query_ConsecutiveFrames_CoversTheBlendedPositions)
+    {
+        m_history->BeginFrame(HostFrameId{ 1 });
+        m_history->AddEntity(NetEntityId{ 1 }, AZ::Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+        m_history->EndFrame();
+
+        m_history->BeginFrame(HostFrameId{ 2 });
+        m_history->AddEntity(NetEntityId{ 1 }, AZ::Vector3(20.0f, 0.0f, 0.0f), 1.0f);
+        m_history->EndFrame();
+
+        // Blending frame 2 with frame 1 can put the entity anywhere between the two positions
+        EXPECT_EQ(Query(HostFrameId{ 2 }, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f).size(), 1u);
+        EXPECT_TRUE(Query(HostFrameId{ 1 }, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f).empty());
+    }
+
+    TEST_F(RewindSpatialHistoryTests, Query_FrameOutOfTheHistory_ReturnsFalse)
+    {
+        for (uint32_t frame = 0; frame <= RewindHistorySize; ++frame)
+        {
+            m_history->BeginFrame(HostFrameId{ frame });
+            m_history->AddEntity(NetEntityId{ 1 }, AZ::Vector3::CreateZero(), 1.0f);
+            m_history->EndFrame();
+        }
+
+        AZStd::vector<NetEntityId> result;
+        const AZ::Aabb volume = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(1.0f));
+        EXPECT_FALSE(m_history->HasFrame(HostFrameId{ 0 }));
+        EXPECT_FALSE(m_history->Query(HostFrameId{ 0 }, volume, result));
+        EXPECT_TRUE(result.empty());
+        EXPECT_TRUE(m_history->Query(HostFrameId{ 1 }, volume, result));
+        EXPECT_EQ(result.size(), 1u);
+
+        m_history->Clear();
+        EXPECT_FALSE(m_history->HasFrame(HostFrameId{ RewindHistorySize }));
+    }
+
+    TEST_F(RewindSpatialHistoryTests, Query_ManyEntities_MatchesBruteForce)
+    {
+        constexpr uint32_t entityCount = 1000;
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::vector<AZ::Vector3> positions;
+
+        m_history->BeginFrame(HostFrameId{ 1 });
+        for (uint32_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+        {
+            positions.push_back(AZ::Vector3(random.GetRandomFloat() * 500.0f, random.GetRandomFloat() * 500.0f, random.GetRandomFloat() * 10.0f));
+            m_history->AddEntity(NetEntityId{ entityIndex }, positions.back(), 1.0f);
+        }
+        m_history->EndFrame();
+
+        for (uint32_t queryIndex = 0; queryIndex < 50; ++queryIndex)
+        {
+            const AZ::Vector3 center(random.GetRandomFloat() * 500.0f, random.GetRandomFloat() * 500.0f, 5.0f);
+            const AZ::Aabb volume = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(25.0f));
+
+            AZStd::vector<NetEntityId> expected;
+            for (uint32_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+            {
+                if (AZ::Aabb::CreateCenterHalfExtents(positions[entityIndex], AZ::Vector3(1.0f)).Overlaps(volume))
+                {
+                    expected.push_back(NetEntityId{ entityIndex });
+                }
+            }
+
+            EXPECT_EQ(Query(HostFrameId{ 1 }, center, 25.0f), expected);
+        }
+    }
+}
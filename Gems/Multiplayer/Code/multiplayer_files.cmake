@@ -135,8 +135,14 @@ set(FILES
     Source/NetworkInput/NetworkInputMigrationVector.cpp
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
+    Source/NetworkTime/RewindSpatialHistory.cpp
+    Source/NetworkTime/RewindSpatialHistory.h
     Source/Pipeline/NetworkSpawnableHolderComponent.cpp
     Source/Pipeline/NetworkSpawnableHolderComponent.h
+    Source/ReplicationWindows/InterestGrid.cpp
+    Source/ReplicationWindows/InterestGrid.h
+    Source/ReplicationWindows/InterestManager.cpp
+    Source/ReplicationWindows/InterestManager.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
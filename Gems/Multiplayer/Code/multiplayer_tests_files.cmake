@@ -19,6 +19,9 @@ set(FILES
     Tests/CommonBenchmarkSetup.h
     Tests/IMultiplayerConnectionMock.h
     Tests/IMultiplayerSpawnerMock.h
+    Tests/InterestGridBenchmarks.cpp
+    Tests/InterestGridTests.cpp
+    Tests/InterestManagerTests.cpp
     Tests/Main.cpp
     Tests/MockInterfaces.h
     Tests/MultiplayerSystemTests.cpp
@@ -26,6 +29,8 @@ set(FILES
     Tests/NetworkTransformTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
+    Tests/RewindSpatialHistoryBenchmarks.cpp
+    Tests/RewindSpatialHistoryTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/TestMultiplayerComponent.h
     Tests/TestMultiplayerComponent.cpp
@@ -34,6 +34,8 @@ namespace ScriptCanvasEditor
       
         virtual AZ::Outcome<ScriptCanvas::Translation::LuaAssetResult, AZStd::string> CreateLuaAsset(const SourceHandle& editAsset, AZStd::string_view graphPathForRawLuaFile) = 0;
         virtual AZ::Outcome<AZ::Data::Asset<ScriptCanvas::RuntimeAsset>, AZStd::string> CreateRuntimeAsset(const SourceHandle& editAsset) = 0;
+        // returns the header and source text of the native translation of the graph
+        virtual AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::string> CreateNativeSource(const SourceHandle& editAsset, AZStd::string_view graphPathForRawCppFile) = 0;
     };
 
     using EditorAssetConversionBus = AZ::EBus<EditorAssetConversionBusTraits>;
@@ -103,6 +103,11 @@ namespace ScriptCanvasEditor
         return ScriptCanvasBuilder::CreateLuaAsset(editAsset, graphPathForRawLuaFile);
     }
 
+    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::string> EditorAssetSystemComponent::CreateNativeSource(const SourceHandle& editAsset, AZStd::string_view graphPathForRawCppFile)
+    {
+        return ScriptCanvasBuilder::CreateNativeSource(editAsset, graphPathForRawCppFile);
+    }
+
     void EditorAssetSystemComponent::AddSourceFileOpeners
         ( [[maybe_unused]] const char* fullSourceFileName
         , const AZ::Uuid& sourceUuid
@@ -49,6 +49,7 @@ namespace ScriptCanvasEditor
         // EditorAssetConversionBus::Handler...
         AZ::Outcome<AZ::Data::Asset<ScriptCanvas::RuntimeAsset>, AZStd::string> CreateRuntimeAsset(const SourceHandle& editAsset) override;
         AZ::Outcome<ScriptCanvas::Translation::LuaAssetResult, AZStd::string> CreateLuaAsset(const SourceHandle& editAsset, AZStd::string_view graphPathForRawLuaFile) override;
+        AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::string> CreateNativeSource(const SourceHandle& editAsset, AZStd::string_view graphPathForRawCppFile) override;
         //////////////////////////////////////////////////////////////////////////
         
         ScriptCanvas::AssetRegistry& GetAssetRegistry();
@@ -130,6 +130,9 @@ namespace ScriptCanvasBuilder
 
     AZ::Outcome<ScriptCanvas::Translation::LuaAssetResult, AZStd::string> CreateLuaAsset(const ScriptCanvasEditor::SourceHandle& editAsset, AZStd::string_view rawLuaFilePath);
 
+    //! Translates the graph to the header and source of a native execution state, to be compiled into a gem module
+    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::string> CreateNativeSource(const ScriptCanvasEditor::SourceHandle& editAsset, AZStd::string_view rawCppFilePath);
+
     int GetBuilderVersion();
 
     AZ::Outcome<ScriptCanvas::Grammar::AbstractCodeModelConstPtr, AZStd::string> ParseGraph(AZ::Entity& buildEntity, AZStd::string_view graphPath);
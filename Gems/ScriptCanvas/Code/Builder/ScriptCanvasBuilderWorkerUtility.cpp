@@ -131,6 +131,37 @@ namespace ScriptCanvasBuilder
         return AZ::Success(result);
     }
 
+    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::string> CreateNativeSource(const ScriptCanvasEditor::SourceHandle& editAsset, AZStd::string_view rawCppFilePath)
+    {
+        AZStd::string fullPath(rawCppFilePath);
+        AZStd::string fileNameOnly;
+        AzFramework::StringFunc::Path::GetFullFileName(rawCppFilePath.data(), fileNameOnly);
+        AzFramework::StringFunc::Path::Normalize(fullPath);
+
+        auto sourceGraph = PrepareSourceGraph(editAsset.Mod()->GetEntity());
+
+        ScriptCanvas::Grammar::Request request;
+        request.scriptAssetId = editAsset.Id();
+        request.graph = sourceGraph;
+        request.name = fileNameOnly;
+        request.rawSaveDebugOutput = ScriptCanvas::Grammar::g_saveRawTranslationOuputToFile;
+        request.printModelToConsole = ScriptCanvas::Grammar::g_printAbstractCodeModel;
+        request.path = fullPath;
+        request.addDebugInformation = false;
+
+        const ScriptCanvas::Translation::Result translationResult = ScriptCanvas::Translation::ToCPlusPlus(request);
+
+        auto isSuccessOutcome = translationResult.IsSuccess(ScriptCanvas::Translation::TargetFlags::Cpp);
+        if (!isSuccessOutcome.IsSuccess())
+        {
+            return AZ::Failure(isSuccessOutcome.TakeError());
+        }
+
+        const auto& header = translationResult.m_translations.find(ScriptCanvas::Translation::TargetFlags::Hpp)->second;
+        const auto& source = translationResult.m_translations.find(ScriptCanvas::Translation::TargetFlags::Cpp)->second;
+        return AZ::Success(AZStd::make_pair(header.m_text, source.m_text));
+    }
+
     AZ::Outcome<AZ::Data::Asset<ScriptCanvas::RuntimeAsset>, AZStd::string> CreateRuntimeAsset(const ScriptCanvasEditor::SourceHandle& editAsset)
     {
         // Flush asset manager events to ensure no asset references are held by closures queued on Ebuses.
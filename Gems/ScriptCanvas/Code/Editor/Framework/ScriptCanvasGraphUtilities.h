@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Script/ScriptSystemBus.h>
 #include <Editor/Framework/ScriptCanvasTraceUtilities.h>
 #include <Editor/Framework/ScriptCanvasReporter.h>
@@ -31,7 +33,31 @@ namespace ScriptCanvasEditor
 
     AZ_INLINE AZStd::vector<LoadedInterpretedDependency> LoadInterpretedDepencies(const ScriptCanvas::DependencySet& dependencySet);
 
-    AZ_INLINE LoadTestGraphResult LoadTestGraph(AZStd::string_view path);
+    //! Graphs loaded for native execution get a source id made from their path, which is the id their translation registers with.
+    AZ_INLINE LoadTestGraphResult LoadTestGraph(AZStd::string_view path, ScriptCanvas::ExecutionMode execution = ScriptCanvas::ExecutionMode::Interpreted);
+
+    //! Graphs activated in the scope execute with their native translation, if a module registered one.
+    struct ScopedNativeExecution
+    {
+        ScopedNativeExecution()
+        {
+            if (auto console = AZ::Interface<AZ::IConsole>::Get())
+            {
+                console->GetCvarValue("g_executeNativeGraphs", m_wasNativeExecution);
+                console->PerformCommand("g_executeNativeGraphs", { "true" }, AZ::ConsoleSilentMode::Silent);
+            }
+        }
+
+        ~ScopedNativeExecution()
+        {
+            if (auto console = AZ::Interface<AZ::IConsole>::Get())
+            {
+                console->PerformCommand("g_executeNativeGraphs", { m_wasNativeExecution ? "true" : "false" }, AZ::ConsoleSilentMode::Silent);
+            }
+        }
+    private:
+        bool m_wasNativeExecution = false;
+    };
 
     struct RunSpec
     {
@@ -109,12 +109,13 @@ namespace ScriptCanvasEditor
         return spec;
     }
 
-    AZ_INLINE LoadTestGraphResult LoadTestGraph(AZStd::string_view graphPath)
+    AZ_INLINE LoadTestGraphResult LoadTestGraph(AZStd::string_view graphPath, ExecutionMode execution)
     {
         if (auto loadFileOutcome = LoadFromFile(graphPath); loadFileOutcome.IsSuccess())
         {
             auto& source = loadFileOutcome.GetValue().handle;
-            auto testableSource = SourceHandle(source, AZ::Uuid::CreateRandom(), source.Path().c_str());
+            const AZ::Uuid sourceId = execution == ExecutionMode::Native ? AZ::Uuid::CreateData(graphPath.data(), graphPath.size()) : AZ::Uuid::CreateRandom();
+            auto testableSource = SourceHandle(source, sourceId, source.Path().c_str());
 
             AZ::Outcome<AZ::Data::Asset<ScriptCanvas::RuntimeAsset>, AZStd::string> assetOutcome(AZ::Failure(AZStd::string("asset create failed")));
             ScriptCanvasEditor::EditorAssetConversionBus::BroadcastResult(assetOutcome
@@ -181,7 +182,7 @@ namespace ScriptCanvasEditor
     AZ_INLINE void RunGraphImplementation(const RunGraphSpec& runGraphSpec, Reporter& reporter)
     {
         TraceSuppressionBus::Broadcast(&TraceSuppressionRequests::SuppressPrintf, true);
-        LoadTestGraphResult loadResult = LoadTestGraph(runGraphSpec.graphPath);
+        LoadTestGraphResult loadResult = LoadTestGraph(runGraphSpec.graphPath, runGraphSpec.runSpec.execution);
         TraceSuppressionBus::Broadcast(&TraceSuppressionRequests::SuppressPrintf, false);
         RunGraphImplementation(runGraphSpec, loadResult, reporter);
     }
@@ -198,7 +199,8 @@ namespace ScriptCanvasEditor
             AZStd::vector<RuntimeData> dependencyDataBuffer;
             AZStd::vector<LoadedInterpretedDependency> dependencies;
 
-            if (runGraphSpec.runSpec.execution == ExecutionMode::Interpreted)
+            // the native execution state reads the runtime inputs of the translation, and graphs without a native translation execute interpreted
+            if (runGraphSpec.runSpec.execution == ExecutionMode::Interpreted || runGraphSpec.runSpec.execution == ExecutionMode::Native)
             {
                 ScopedOutputSuppression outputSuppressor;
                 AZ::Outcome<ScriptCanvas::Translation::LuaAssetResult, AZStd::string> luaAssetOutcome = AZ::Failure(AZStd::string("lua asset creation failed"));
@@ -328,7 +330,18 @@ namespace ScriptCanvasEditor
                             }
                         }
 
-                        loadResult.m_entity->Activate();
+                        if (runGraphSpec.runSpec.execution == ExecutionMode::Native)
+                        {
+                            ScopedNativeExecution nativeExecution;
+                            loadResult.m_entity->Activate();
+                        }
+                        else
+                        {
+                            loadResult.m_entity->Activate();
+                        }
+
+                        // report the mode the graph executes in, which is interpreted if no native translation was registered for it
+                        reporter.SetExecutionMode(loadResult.m_runtimeComponent->GetExecutionMode());
                         SimulateDuration(runGraphSpec.runSpec.duration);
                     }
 
@@ -344,7 +357,7 @@ namespace ScriptCanvasEditor
                 }
             }
 
-            if (runGraphSpec.runSpec.execution == ExecutionMode::Interpreted)
+            if (runGraphSpec.runSpec.execution == ExecutionMode::Interpreted || runGraphSpec.runSpec.execution == ExecutionMode::Native)
             {
                 AZ::ScriptSystemRequestBus::Broadcast(&AZ::ScriptSystemRequests::ClearAssetReferences, loadResult.m_scriptAsset.GetId());
 
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <ScriptCanvas/Core/Core.h>
 #include <ScriptCanvas/Execution/RuntimeComponent.h>
@@ -14,11 +15,15 @@
 #include "Interpreted/ExecutionStateInterpretedPure.h"
 #include "Interpreted/ExecutionStateInterpretedPerActivation.h"
 #include "Interpreted/ExecutionStateInterpretedSingleton.h"
+#include "Native/ExecutionStateNative.h"
 
 #include "ExecutionState.h"
 
 namespace ScriptCanvas
 {
+    AZ_CVAR(bool, g_executeNativeGraphs, false, {}, AZ::ConsoleFunctorFlags::Null
+        , "Execute graphs with their natively compiled translation, if one was registered by a gem module, instead of interpreting them.");
+
     ExecutionStateConfig::ExecutionStateConfig(AZ::Data::Asset<RuntimeAsset> runtimeAsset, RuntimeComponent& component)
         : asset(runtimeAsset)
         , component(component)
@@ -31,6 +36,18 @@ namespace ScriptCanvas
 
     ExecutionStatePtr ExecutionState::Create(const ExecutionStateConfig& config)
     {
+        if (g_executeNativeGraphs)
+        {
+            if (auto factory = NativeGraphRegistry::Get().Find(config.asset.GetId().m_guid))
+            {
+                // the factory returns nullptr if the graph can't be executed natively in this application
+                if (ExecutionStatePtr nativeState = factory(config))
+                {
+                    return nativeState;
+                }
+            }
+        }
+
         Grammar::ExecutionStateSelection selection = config.runtimeData.m_input.m_executionSelection;
 
         switch (selection)
@@ -108,6 +125,7 @@ namespace ScriptCanvas
         ExecutionStateInterpretedPure::Reflect(reflectContext);
         ExecutionStateInterpretedPureOnGraphStart::Reflect(reflectContext);
         ExecutionStateInterpretedSingleton::Reflect(reflectContext);
+        ExecutionStateNative::Reflect(reflectContext);
     }
 
     ExecutionStatePtr ExecutionState::SharedFromThis()
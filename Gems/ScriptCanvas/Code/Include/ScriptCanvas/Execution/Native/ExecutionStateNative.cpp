@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ExecutionStateNative.h"
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Module/Environment.h>
+#include <ScriptCanvas/Core/Core.h>
+
+#include "Execution/RuntimeComponent.h"
+
+namespace ExecutionStateNativeCpp
+{
+    constexpr const char* k_registryName = "ScriptCanvasNativeGraphRegistry";
+
+    // ScriptCanvas numbers are doubles, reflected methods may use any arithmetic type for their arguments and results
+    template<typename... NumberTypes>
+    struct NumberConversion
+    {
+        static bool IsConvertible(const AZ::Uuid& typeId)
+        {
+            return ((typeId == azrtti_typeid<NumberTypes>()) || ...);
+        }
+
+        static void ConvertArgument(AZ::BehaviorValueParameter& argument, const AZ::Uuid& targetTypeId)
+        {
+            const double number = *reinterpret_cast<const double*>(argument.GetValueAddress());
+            (void)((targetTypeId == azrtti_typeid<NumberTypes>() ? (argument.StoreInTempData(aznumeric_cast<NumberTypes>(number)), true) : false) || ...);
+        }
+
+        static void CreateResult(AZ::BehaviorValueParameter& result, const AZ::Uuid& typeId)
+        {
+            (void)((typeId == azrtti_typeid<NumberTypes>() ? (result.StoreInTempData(NumberTypes{}), true) : false) || ...);
+        }
+
+        static double ReadResult(const AZ::BehaviorValueParameter& result)
+        {
+            double number = 0.0;
+            (void)((result.m_typeId == azrtti_typeid<NumberTypes>()
+                ? (number = aznumeric_cast<double>(*reinterpret_cast<const NumberTypes*>(result.GetValueAddress())), true)
+                : false) || ...);
+            return number;
+        }
+    };
+
+    using Numbers = NumberConversion<float, AZ::s8, AZ::u8, AZ::s16, AZ::u16, AZ::s32, AZ::u32, AZ::s64, AZ::u64>;
+
+    AZ::BehaviorContext* GetBehaviorContext()
+    {
+        AZ::BehaviorContext* behaviorContext = nullptr;
+        AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+        return behaviorContext;
+    }
+
+    const AZ::BehaviorMethod* FindMethod(const AZ::BehaviorClass& behaviorClass, AZStd::string_view methodName)
+    {
+        auto methodIter = behaviorClass.m_methods.find(methodName);
+        return methodIter != behaviorClass.m_methods.end() ? methodIter->second : nullptr;
+    }
+}
+
+namespace ScriptCanvas
+{
+    ExecutionStateNative::ExecutionStateNative(const ExecutionStateConfig& config)
+        : ExecutionState(config)
+    {}
+
+    Execution::ActivationInputRange ExecutionStateNative::CreateActivationInputRange(Execution::ActivationInputArray& storage) const
+    {
+        Execution::ActivationData data(m_component->GetRuntimeDataOverrides(), storage);
+        return Execution::Context::CreateActivateInputRange(data, m_component->GetEntityId());
+    }
+
+    EBusHandler* ExecutionStateNative::CreateEBusHandler(AZStd::string_view busName)
+    {
+        m_ebusHandlers.emplace_back(EBusHandler::Create(WeakFromThis(), busName));
+        return m_ebusHandlers.back().get();
+    }
+
+    ExecutionMode ExecutionStateNative::GetExecutionMode() const
+    {
+        return ExecutionMode::Native;
+    }
+
+    void ExecutionStateNative::Initialize()
+    {}
+
+    void ExecutionStateNative::StopExecution()
+    {
+        // the handlers are only destroyed with the execution state, the execution may be stopped from one of their events
+        for (auto& handler : m_ebusHandlers)
+        {
+            handler->Disconnect();
+        }
+    }
+
+    void ExecutionStateNative::Reflect(AZ::ReflectContext* reflectContext)
+    {
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(reflectContext))
+        {
+            behaviorContext->Class<ExecutionStateNative>()
+                ->Attribute(AZ::Script::Attributes::ExcludeFrom, AZ::Script::Attributes::ExcludeFlags::List)
+                ->Attribute(AZ::ScriptCanvasAttributes::VariableCreationForbidden, AZ::AttributeIsValid::IfPresent)
+                ;
+        }
+    }
+
+    NativeGraphRegistry& NativeGraphRegistry::Get()
+    {
+        // generated graphs are registered from the gem modules they are compiled into, so the registry lives in the environment
+        static AZ::EnvironmentVariable<NativeGraphRegistry> s_registry = AZ::Environment::CreateVariable<NativeGraphRegistry>(ExecutionStateNativeCpp::k_registryName);
+        return *s_registry;
+    }
+
+    void NativeGraphRegistry::Register(const AZ::Uuid& sourceAssetGuid, Factory factory)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_factories[sourceAssetGuid] = factory;
+    }
+
+    void NativeGraphRegistry::Unregister(const AZ::Uuid& sourceAssetGuid)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_factories.erase(sourceAssetGuid);
+    }
+
+    NativeGraphRegistry::Factory NativeGraphRegistry::Find(const AZ::Uuid& sourceAssetGuid) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        auto iter = m_factories.find(sourceAssetGuid);
+        return iter != m_factories.end() ? iter->second : nullptr;
+    }
+
+    namespace Execution
+    {
+        const AZ::BehaviorMethod* FindNativeMethod(AZStd::string_view className, AZStd::string_view methodName)
+        {
+            AZ::BehaviorContext* behaviorContext = ExecutionStateNativeCpp::GetBehaviorContext();
+            if (!behaviorContext)
+            {
+                return nullptr;
+            }
+
+            if (className.empty())
+            {
+                auto methodIter = behaviorContext->m_methods.find(methodName);
+                return methodIter != behaviorContext->m_methods.end() ? methodIter->second : nullptr;
+            }
+
+            auto classIter = behaviorContext->m_classes.find(className);
+            return classIter != behaviorContext->m_classes.end() ? ExecutionStateNativeCpp::FindMethod(*classIter->second, methodName) : nullptr;
+        }
+
+        const AZ::BehaviorMethod* FindNativeMethod(const AZ::Uuid& typeId, AZStd::string_view methodName)
+        {
+            AZ::BehaviorContext* behaviorContext = ExecutionStateNativeCpp::GetBehaviorContext();
+            if (!behaviorContext)
+            {
+                return nullptr;
+            }
+
+            auto classIter = behaviorContext->m_typeToClassMap.find(typeId);
+            return classIter != behaviorContext->m_typeToClassMap.end() ? ExecutionStateNativeCpp::FindMethod(*classIter->second, methodName) : nullptr;
+        }
+
+        Data::NumberType ReadNativeNumber(const AZ::BehaviorValueParameter& value)
+        {
+            if (value.m_typeId == azrtti_typeid<Data::NumberType>())
+            {
+                return *reinterpret_cast<const Data::NumberType*>(value.GetValueAddress());
+            }
+
+            AZ_Assert(ExecutionStateNativeCpp::Numbers::IsConvertible(value.m_typeId), "the value is not a number");
+            return ExecutionStateNativeCpp::Numbers::ReadResult(value);
+        }
+
+        bool CallNativeMethod(const AZ::BehaviorMethod& method, AZ::BehaviorValueParameter* arguments, size_t argumentCount, AZ::BehaviorValueParameter* result)
+        {
+            using ExecutionStateNativeCpp::Numbers;
+
+            const AZ::Uuid numberTypeId = azrtti_typeid<Data::NumberType>();
+
+            for (size_t index = 0; index < argumentCount && index < method.GetNumArguments(); ++index)
+            {
+                const AZ::Uuid& targetTypeId = method.GetArgument(index)->m_typeId;
+                if (arguments[index].m_typeId == numberTypeId && targetTypeId != numberTypeId && Numbers::IsConvertible(targetTypeId))
+                {
+                    Numbers::ConvertArgument(arguments[index], targetTypeId);
+                }
+            }
+
+            bool isCalled = false;
+
+            if (result && method.HasResult() && result->m_typeId == numberTypeId
+                && method.GetResult()->m_typeId != numberTypeId && Numbers::IsConvertible(method.GetResult()->m_typeId))
+            {
+                AZ::BehaviorValueParameter numberResult;
+                Numbers::CreateResult(numberResult, method.GetResult()->m_typeId);
+                isCalled = method.Call(arguments, aznumeric_caster(argumentCount), &numberResult);
+
+                if (isCalled)
+                {
+                    *reinterpret_cast<double*>(result->GetValueAddress()) = Numbers::ReadResult(numberResult);
+                }
+            }
+            else
+            {
+                isCalled = method.Call(arguments, aznumeric_caster(argumentCount), result);
+            }
+
+            AZ_Error("ScriptCanvas", isCalled, "Native graph call to %s failed", method.m_name.c_str());
+            return isCalled;
+        }
+    }
+}
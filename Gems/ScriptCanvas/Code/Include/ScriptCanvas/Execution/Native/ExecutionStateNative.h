@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <ScriptCanvas/Core/EBusHandler.h>
+#include <ScriptCanvas/Data/Data.h>
+
+#include "Execution/ExecutionContext.h"
+#include "Execution/ExecutionState.h"
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        template<typename R, typename... Args>
+        using NativeFunction = R(*)(Args...);
+
+        template<typename R, typename C, typename... Args>
+        using NativeMemberFunction = R(C::*)(Args...);
+
+        //! Finds a BehaviorContext method, a global one if the class name is empty
+        const AZ::BehaviorMethod* FindNativeMethod(AZStd::string_view className, AZStd::string_view methodName);
+
+        //! Finds a BehaviorContext method of the class reflected for the type
+        const AZ::BehaviorMethod* FindNativeMethod(const AZ::Uuid& typeId, AZStd::string_view methodName);
+
+        //! Returns the function the method or one of its overloads was reflected from, if it has exactly the signature R(Args...).
+        //! The generated graphs call the functions directly, instead of marshalling the arguments through BehaviorMethod::Call.
+        template<typename R, typename... Args>
+        NativeFunction<R, Args...> FindNativeFunction(const AZ::BehaviorMethod* method)
+        {
+            for (; method; method = method->m_overload)
+            {
+                if (auto reflected = dynamic_cast<const AZ::Internal::BehaviorMethodImpl<R(Args...)>*>(method))
+                {
+                    return reflected->m_functionPtr;
+                }
+            }
+
+            return nullptr;
+        }
+
+        //! Returns the member function the method or one of its overloads was reflected from, if it has exactly the signature R(C::*)(Args...)
+        template<typename R, typename C, typename... Args>
+        NativeMemberFunction<R, C, Args...> FindNativeMemberFunction(const AZ::BehaviorMethod* method)
+        {
+            for (; method; method = method->m_overload)
+            {
+                // const member functions are reflected with their non-const signature, see AZStd::RemoveFunctionConst
+                if (auto reflected = dynamic_cast<const AZ::Internal::BehaviorMethodImpl<R(C::*)(Args...)>*>(method))
+                {
+                    return reflected->m_functionPtr;
+                }
+            }
+
+            return nullptr;
+        }
+
+        //! Reads a value of any arithmetic type as a ScriptCanvas number
+        Data::NumberType ReadNativeNumber(const AZ::BehaviorValueParameter& value);
+
+        //! Calls the method, converting ScriptCanvas numbers to and from the numeric types of its arguments and result
+        bool CallNativeMethod(const AZ::BehaviorMethod& method, AZ::BehaviorValueParameter* arguments, size_t argumentCount, AZ::BehaviorValueParameter* result);
+
+        template<typename T>
+        AZ::BehaviorValueParameter ToNativeArgument(T& argument)
+        {
+            return AZ::BehaviorValueParameter(const_cast<AZStd::remove_cvref_t<T>*>(&argument));
+        }
+
+        template<typename... Args>
+        bool CallNative(const AZ::BehaviorMethod* method, Args&&... args)
+        {
+            AZ::BehaviorValueParameter arguments[sizeof...(Args) + 1] = { ToNativeArgument(args)... };
+            return CallNativeMethod(*method, arguments, sizeof...(Args), nullptr);
+        }
+
+        template<typename TResult, typename... Args>
+        bool CallNativeResult(const AZ::BehaviorMethod* method, TResult& resultValue, Args&&... args)
+        {
+            AZ::BehaviorValueParameter arguments[sizeof...(Args) + 1] = { ToNativeArgument(args)... };
+            AZ::BehaviorValueParameter result(&resultValue);
+            return CallNativeMethod(*method, arguments, sizeof...(Args), &result);
+        }
+    }
+
+    //! Base class of the execution states that are generated from graphs by Translation::GraphToCpp.
+    //! The generated classes are compiled into a gem module, which registers them with the NativeGraphRegistry.
+    //! ExecutionState::Create selects the generated class instead of the interpreted (Lua) execution state
+    //! for graphs that have one registered.
+    class ExecutionStateNative
+        : public ExecutionState
+    {
+    public:
+        AZ_RTTI(ExecutionStateNative, "{5C0E3B7F-1F0E-4B55-9E1C-6A3A8D3E2F14}", ExecutionState);
+        AZ_CLASS_ALLOCATOR(ExecutionStateNative, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* reflectContext);
+
+        ExecutionStateNative(const ExecutionStateConfig& config);
+
+        ExecutionMode GetExecutionMode() const override;
+
+        void Initialize() override;
+
+        void StopExecution() override;
+
+    protected:
+        //! Creates a handler of the bus, for the generated functions that handle its events.
+        //! The handlers are disconnected when the execution stops, and destroyed with the execution state.
+        EBusHandler* CreateEBusHandler(AZStd::string_view busName);
+
+        //! Fills the storage with the (possibly overridden) graph variables, in the order of the construction arguments of the graph
+        Execution::ActivationInputRange CreateActivationInputRange(Execution::ActivationInputArray& storage) const;
+
+        template<typename T>
+        static const T& GetActivationInput(const Execution::ActivationInputRange& range, size_t index)
+        {
+            AZ_Assert(index < range.totalCount, "activation input index out of range");
+            AZ_Assert(range.inputs[index].m_typeId == azrtti_typeid<T>(), "activation input type mismatch");
+            return *reinterpret_cast<const T*>(range.inputs[index].GetValueAddress());
+        }
+
+        //! Reads an argument of a handled event, converting the numeric types of the event to ScriptCanvas numbers
+        template<typename T>
+        static T GetEventArgument(const AZ::BehaviorValueParameter* arguments, int numArguments, int index)
+        {
+            AZ_Assert(index < numArguments, "event argument index out of range");
+            AZ_UNUSED(numArguments);
+
+            if constexpr (AZStd::is_same_v<T, Data::NumberType>)
+            {
+                return Execution::ReadNativeNumber(arguments[index]);
+            }
+            else
+            {
+                AZ_Assert(arguments[index].m_typeId == azrtti_typeid<T>(), "event argument type mismatch");
+                return *arguments[index].GetAsUnsafe<T>();
+            }
+        }
+
+    private:
+        AZStd::vector<AZStd::unique_ptr<EBusHandler>> m_ebusHandlers;
+    };
+
+    //! Maps the source asset ids of graphs to the factories of their generated execution states.
+    //! The registry is shared by all modules through the AZ::Environment.
+    class NativeGraphRegistry
+    {
+    public:
+        AZ_TYPE_INFO(NativeGraphRegistry, "{B6C5B6A2-5C73-4E0B-8F9B-33F0E6A9D1C8}");
+        AZ_CLASS_ALLOCATOR(NativeGraphRegistry, AZ::SystemAllocator, 0);
+
+        //! Returns nullptr when the graph can't be executed natively, e.g. when a method it calls isn't reflected
+        using Factory = ExecutionStatePtr(*)(const ExecutionStateConfig& config);
+
+        static NativeGraphRegistry& Get();
+
+        void Register(const AZ::Uuid& sourceAssetGuid, Factory factory);
+
+        void Unregister(const AZ::Uuid& sourceAssetGuid);
+
+        Factory Find(const AZ::Uuid& sourceAssetGuid) const;
+
+    private:
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZ::Uuid, Factory> m_factories;
+    };
+}
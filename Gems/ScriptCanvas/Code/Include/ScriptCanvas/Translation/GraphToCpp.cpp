@@ -0,0 +1,1503 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "GraphToCpp.h"
+
+#include <clocale>
+#include <cmath>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/optional.h>
+#include <ScriptCanvas/Core/Node.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Debugger/ValidationEvents/ParsingValidation/ParsingValidations.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+#include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Grammar/ParsingUtilities.h>
+#include <ScriptCanvas/Grammar/Primitives.h>
+#include <ScriptCanvas/Grammar/PrimitivesExecution.h>
+
+namespace GraphToCppCpp
+{
+    using namespace ScriptCanvas;
+
+    class ScopedLocale
+    {
+    public:
+        ScopedLocale()
+        {
+            m_previousLocale = std::setlocale(LC_NUMERIC, "C");
+        }
+
+        ~ScopedLocale()
+        {
+            std::setlocale(LC_NUMERIC, m_previousLocale);
+        }
+
+    private:
+        char* m_previousLocale = nullptr;
+    };
+
+    Translation::Configuration CreateCppConfig()
+    {
+        Translation::Configuration configuration;
+        configuration.m_blockCommentClose = "*/";
+        configuration.m_blockCommentOpen = "/*";
+        configuration.m_dependencyDelimiter = "/";
+        configuration.m_executionStateName = "executionState";
+        configuration.m_executionStateEntityIdName = "m_entityId";
+        configuration.m_executionStateEntityIdRef = "GetEntityId()";
+        configuration.m_executionStateReferenceGraph = "this";
+        configuration.m_executionStateReferenceLocal = "this";
+        configuration.m_executionStateScriptCanvasIdName = "m_scriptCanvasId";
+        configuration.m_executionStateScriptCanvasIdRef = "GetScriptCanvasId()";
+        configuration.m_functionBlockClose = "}";
+        configuration.m_functionBlockOpen = "{";
+        configuration.m_lexicalScopeDelimiter = "::";
+        configuration.m_lexicalScopeVariable = ".";
+        configuration.m_namespaceClose = "}";
+        configuration.m_namespaceOpen = "{";
+        configuration.m_namespaceOpenPrefix = "namespace";
+        configuration.m_scopeClose = "}";
+        configuration.m_scopeOpen = "{";
+        configuration.m_singleLineComment = "//";
+        configuration.m_suffix = "_Native";
+        return configuration;
+    }
+
+    // the graph variable names are safe for Lua, the prefix keeps them clear of C++ keywords and the ExecutionState members
+    AZStd::string ToVariableName(Grammar::VariableConstPtr variable)
+    {
+        return AZStd::string::format("v_%s", variable->m_name.c_str());
+    }
+
+    AZStd::string ToFloatLiteral(float value)
+    {
+        AZStd::string literal = AZStd::string::format("%.9g", value);
+        if (literal.find_first_of(".e") == AZStd::string::npos)
+        {
+            literal += ".0";
+        }
+
+        literal += "f";
+        return literal;
+    }
+
+    AZStd::string ToStringLiteral(AZStd::string_view value)
+    {
+        AZStd::string literal = "AZStd::string(\"";
+
+        for (char character : value)
+        {
+            switch (character)
+            {
+            case '\"':
+                literal += "\\\"";
+                break;
+            case '\\':
+                literal += "\\\\";
+                break;
+            case '\n':
+                literal += "\\n";
+                break;
+            case '\r':
+                literal += "\\r";
+                break;
+            case '\t':
+                literal += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20)
+                {
+                    literal += AZStd::string::format("\\x%02x\"\"", static_cast<unsigned char>(character));
+                }
+                else
+                {
+                    literal += character;
+                }
+                break;
+            }
+        }
+
+        literal += "\")";
+        return literal;
+    }
+
+    // the types of the graph values, and of the arguments and results of the functions that are called directly
+    struct NativeType
+    {
+        AZ::Uuid m_typeId;
+        const char* m_name = nullptr;
+        bool m_isNumber = false;
+    };
+
+    const NativeType* FindNativeType(const AZ::Uuid& typeId)
+    {
+        static const NativeType s_nativeTypes[] =
+        {
+            { azrtti_typeid<bool>(), "bool", false },
+            { azrtti_typeid<double>(), "double", true },
+            { azrtti_typeid<float>(), "float", true },
+            { azrtti_typeid<AZ::s8>(), "AZ::s8", true },
+            { azrtti_typeid<AZ::u8>(), "AZ::u8", true },
+            { azrtti_typeid<AZ::s16>(), "AZ::s16", true },
+            { azrtti_typeid<AZ::u16>(), "AZ::u16", true },
+            { azrtti_typeid<AZ::s32>(), "AZ::s32", true },
+            { azrtti_typeid<AZ::u32>(), "AZ::u32", true },
+            { azrtti_typeid<AZ::s64>(), "AZ::s64", true },
+            { azrtti_typeid<AZ::u64>(), "AZ::u64", true },
+            { azrtti_typeid<AZ::Color>(), "AZ::Color", false },
+            { azrtti_typeid<AZ::Crc32>(), "AZ::Crc32", false },
+            { azrtti_typeid<AZ::EntityId>(), "AZ::EntityId", false },
+            { azrtti_typeid<AZ::Quaternion>(), "AZ::Quaternion", false },
+            { azrtti_typeid<AZStd::string>(), "AZStd::string", false },
+            { azrtti_typeid<AZStd::string_view>(), "AZStd::string_view", false },
+            { azrtti_typeid<AZ::Vector2>(), "AZ::Vector2", false },
+            { azrtti_typeid<AZ::Vector3>(), "AZ::Vector3", false },
+            { azrtti_typeid<AZ::Vector4>(), "AZ::Vector4", false },
+        };
+
+        for (const NativeType& nativeType : s_nativeTypes)
+        {
+            if (nativeType.m_typeId == typeId)
+            {
+                return &nativeType;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Returns an empty string if the graph value can't be passed as the parameter. The values are passed by value or const
+    // reference, functions that could write through a pointer or reference aren't called directly.
+    AZStd::string ToNativeParameterType(const AZ::BehaviorParameter& parameter, const NativeType& nativeType)
+    {
+        if (parameter.m_traits & AZ::BehaviorParameter::TR_POINTER)
+        {
+            return "";
+        }
+        else if (parameter.m_traits & AZ::BehaviorParameter::TR_REFERENCE)
+        {
+            return (parameter.m_traits & AZ::BehaviorParameter::TR_CONST) ? AZStd::string::format("const %s&", nativeType.m_name) : "";
+        }
+        else
+        {
+            return nativeType.m_name;
+        }
+    }
+
+    bool IsNativeConvertible(const Data::Type& valueType, const NativeType& nativeType)
+    {
+        return valueType.GetAZType() == nativeType.m_typeId
+            || (valueType.GetType() == Data::eType::Number && nativeType.m_isNumber)
+            || (valueType.GetType() == Data::eType::String && nativeType.m_typeId == azrtti_typeid<AZStd::string_view>());
+    }
+
+    struct NativeSignature
+    {
+        bool m_isMember = false;
+        // R, [C,] Args... of Execution::NativeFunction or Execution::NativeMemberFunction
+        AZStd::string m_templateArguments;
+        // the type each ScriptCanvas number is cast to, empty for the inputs that are passed as they are
+        AZStd::vector<AZStd::string> m_inputCasts;
+    };
+
+    AZStd::optional<NativeSignature> GetNativeSignature(const AZ::BehaviorMethod& method, const AZStd::vector<Data::Type>& inputTypes, const Data::Type* outputType)
+    {
+        if (method.GetNumArguments() != inputTypes.size())
+        {
+            return AZStd::nullopt;
+        }
+
+        NativeSignature signature;
+
+        if (method.HasResult())
+        {
+            const AZ::BehaviorParameter* result = method.GetResult();
+            const NativeType* resultType = FindNativeType(result->m_typeId);
+            if (!resultType || (result->m_traits & AZ::BehaviorParameter::TR_POINTER))
+            {
+                return AZStd::nullopt;
+            }
+
+            if (outputType && !(outputType->GetAZType() == resultType->m_typeId || (outputType->GetType() == Data::eType::Number && resultType->m_isNumber)))
+            {
+                return AZStd::nullopt;
+            }
+
+            if (result->m_traits & AZ::BehaviorParameter::TR_REFERENCE)
+            {
+                signature.m_templateArguments = AZStd::string::format("%s%s&", (result->m_traits & AZ::BehaviorParameter::TR_CONST) ? "const " : "", resultType->m_name);
+            }
+            else
+            {
+                signature.m_templateArguments = resultType->m_name;
+            }
+        }
+        else if (outputType)
+        {
+            return AZStd::nullopt;
+        }
+        else
+        {
+            signature.m_templateArguments = "void";
+        }
+
+        size_t index = 0;
+
+        if (method.IsMember())
+        {
+            const NativeType* classType = FindNativeType(method.GetArgument(0)->m_typeId);
+            if (!classType || inputTypes.empty() || inputTypes[0].GetAZType() != classType->m_typeId)
+            {
+                return AZStd::nullopt;
+            }
+
+            signature.m_isMember = true;
+            signature.m_templateArguments += AZStd::string::format(", %s", classType->m_name);
+            signature.m_inputCasts.emplace_back();
+            ++index;
+        }
+
+        for (; index < inputTypes.size(); ++index)
+        {
+            const AZ::BehaviorParameter* parameter = method.GetArgument(index);
+            const NativeType* parameterType = FindNativeType(parameter->m_typeId);
+            if (!parameterType || !IsNativeConvertible(inputTypes[index], *parameterType))
+            {
+                return AZStd::nullopt;
+            }
+
+            const AZStd::string parameterTypeName = ToNativeParameterType(*parameter, *parameterType);
+            if (parameterTypeName.empty())
+            {
+                return AZStd::nullopt;
+            }
+
+            signature.m_templateArguments += AZStd::string::format(", %s", parameterTypeName.c_str());
+
+            const bool isCast = inputTypes[index].GetType() == Data::eType::Number && parameterType->m_typeId != azrtti_typeid<Data::NumberType>();
+            signature.m_inputCasts.emplace_back(isCast ? parameterType->m_name : "");
+        }
+
+        return signature;
+    }
+
+    // the C++ type of a graph variable, empty if the type isn't supported
+    AZStd::string ToCppTypeName(const Data::Type& type)
+    {
+        switch (type.GetType())
+        {
+        case Data::eType::Boolean:
+            return "bool";
+        case Data::eType::Color:
+            return "AZ::Color";
+        case Data::eType::CRC:
+            return "AZ::Crc32";
+        case Data::eType::EntityID:
+            return "AZ::EntityId";
+        case Data::eType::Number:
+            return "double";
+        case Data::eType::Quaternion:
+            return "AZ::Quaternion";
+        case Data::eType::String:
+            return "AZStd::string";
+        case Data::eType::Vector2:
+            return "AZ::Vector2";
+        case Data::eType::Vector3:
+            return "AZ::Vector3";
+        case Data::eType::Vector4:
+            return "AZ::Vector4";
+        default:
+            return "";
+        }
+    }
+
+    AZStd::string_view GetOperatorString(Grammar::Symbol symbol)
+    {
+        switch (symbol)
+        {
+        case Grammar::Symbol::OperatorAddition:
+            return " + ";
+        case Grammar::Symbol::OperatorDivision:
+            return " / ";
+        case Grammar::Symbol::OperatorMultiplication:
+            return " * ";
+        case Grammar::Symbol::OperatorSubraction:
+            return " - ";
+        default:
+            return "";
+        }
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Translation
+    {
+        GraphToCpp::GraphToCpp(const Grammar::AbstractCodeModel& source)
+            : GraphToX(GraphToCppCpp::CreateCppConfig(), source)
+        {
+            MarkTranslationStart();
+
+            m_className = Grammar::ToSafeName(m_model.GetSource().m_name);
+            m_className += m_configuration.m_suffix;
+            m_runtimeInputs.CopyFrom(m_model.GetRuntimeInputs());
+
+            if (CheckSupportedGraph())
+            {
+                ParseMemberVariables();
+                TranslateExecute();
+                m_executeBody = m_execute.MoveOutput();
+                TranslateEventFunctions();
+                TranslateHeader();
+                TranslateSource();
+            }
+
+            MarkTranslationStop();
+        }
+
+        size_t GraphToCpp::AddFunctionLookup(const FunctionLookup& lookup)
+        {
+            const AZStd::string key = lookup.m_type + lookup.m_resolution;
+            auto iter = m_functionIndices.find(key);
+            if (iter != m_functionIndices.end())
+            {
+                return iter->second;
+            }
+
+            const size_t index = m_functionLookups.size();
+            m_functionLookups.push_back(lookup);
+            m_functionIndices.emplace(key, index);
+            return index;
+        }
+
+        void GraphToCpp::AddMemberVariable(Grammar::VariableConstPtr variable)
+        {
+            if (!IsMemberVariable(variable))
+            {
+                m_memberVariables.push_back(variable);
+            }
+        }
+
+        size_t GraphToCpp::AddMethodLookup(const AZStd::string& lookup)
+        {
+            auto iter = m_methodIndices.find(lookup);
+            if (iter != m_methodIndices.end())
+            {
+                return iter->second;
+            }
+
+            const size_t index = m_methodLookups.size();
+            m_methodLookups.push_back(lookup);
+            m_methodIndices.emplace(lookup, index);
+            return index;
+        }
+
+        bool GraphToCpp::CheckSupportedGraph()
+        {
+            if (!m_model.GetStart() && m_model.GetEBusHandlings().empty())
+            {
+                WriteUnsupported(nullptr, "graphs that neither execute on graph start nor handle EBus events");
+            }
+            else if (!m_model.GetFunctions().empty())
+            {
+                WriteUnsupported(nullptr, "graphs with functions");
+            }
+            else if (!m_model.GetEventHandlings().empty())
+            {
+                WriteUnsupported(nullptr, "graphs that handle AZ::Events");
+            }
+            else if (!m_runtimeInputs.m_nodeables.empty() || !m_runtimeInputs.m_staticVariables.empty())
+            {
+                WriteUnsupported(nullptr, "graphs with nodeables or static variables");
+            }
+            else if (m_model.GetInterface().RequiresConstructionParametersForDependencies())
+            {
+                WriteUnsupported(nullptr, "graphs with dependencies");
+            }
+
+            for (const auto& ebusHandling : m_model.GetEBusHandlings())
+            {
+                // connecting and disconnecting from the graph would need the handlers as nodeables
+                if (!ebusHandling->m_startsConnected || ebusHandling->RequiresConnectionControl())
+                {
+                    WriteUnsupported(nullptr, AZStd::string::format("EBus handlers that are connected by the graph, %s", ebusHandling->m_ebusName.c_str()));
+                }
+            }
+
+            return IsSuccessfull();
+        }
+
+        bool GraphToCpp::IsMemberVariable(Grammar::VariableConstPtr variable) const
+        {
+            return AZStd::find(m_memberVariables.begin(), m_memberVariables.end(), variable) != m_memberVariables.end();
+        }
+
+        bool GraphToCpp::IsSupportedVariable(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
+        {
+            if (variable->m_requiresCreationFunction || variable->m_initializeAsNull)
+            {
+                WriteUnsupported(execution, "created or null initialized variables");
+                return false;
+            }
+
+            return !ToCppType(execution, variable->m_datum.GetType()).empty();
+        }
+
+        void GraphToCpp::ParseMemberVariables()
+        {
+            m_constructionArguments = m_model.CombineVariableLists(m_runtimeInputs.m_nodeables, m_runtimeInputs.m_variables, m_runtimeInputs.m_entityIds);
+
+            for (const auto& argument : m_constructionArguments)
+            {
+                AddMemberVariable(argument);
+            }
+
+            // the variables that are shared between the start and the events of the graph
+            for (const auto& variable : m_model.GetVariables())
+            {
+                if (variable->m_isMember && !variable->m_isDebugOnly)
+                {
+                    AddMemberVariable(variable);
+                }
+            }
+
+            for (const auto& ebusHandling : m_model.GetEBusHandlings())
+            {
+                if (ebusHandling->m_isAddressed && ebusHandling->m_startingAdress)
+                {
+                    AddMemberVariable(ebusHandling->m_startingAdress);
+                }
+            }
+        }
+
+        AZStd::string GraphToCpp::ToCppType(Grammar::ExecutionTreeConstPtr execution, const Data::Type& type)
+        {
+            AZStd::string typeName = GraphToCppCpp::ToCppTypeName(type);
+            if (typeName.empty())
+            {
+                WriteUnsupported(execution, AZStd::string::format("variables of type %s", Data::GetName(type).c_str()));
+            }
+
+            return typeName;
+        }
+
+        AZStd::string GraphToCpp::ToCppValue(Grammar::ExecutionTreeConstPtr execution, const Datum& datum)
+        {
+            using GraphToCppCpp::ToFloatLiteral;
+
+            GraphToCppCpp::ScopedLocale scopedLocale;
+
+            switch (datum.GetType().GetType())
+            {
+            case Data::eType::Boolean:
+                return *datum.GetAs<Data::BooleanType>() ? "true" : "false";
+
+            case Data::eType::Color:
+            {
+                const auto value = datum.GetAs<Data::ColorType>();
+                return AZStd::string::format("AZ::Color(%s, %s, %s, %s)", ToFloatLiteral(value->GetR()).c_str(), ToFloatLiteral(value->GetG()).c_str()
+                    , ToFloatLiteral(value->GetB()).c_str(), ToFloatLiteral(value->GetA()).c_str());
+            }
+
+            case Data::eType::CRC:
+                return AZStd::string::format("AZ::Crc32(static_cast<AZ::u32>(%u))", static_cast<AZ::u32>(*datum.GetAs<Data::CRCType>()));
+
+            case Data::eType::EntityID:
+            {
+                const AZ::EntityId entityId = *datum.GetAs<Data::EntityIDType>();
+                const AZStd::string value = EntityIdValueToString(entityId, m_configuration);
+                return entityId == GraphOwnerId || entityId == UniqueId ? value : AZStd::string::format("AZ::EntityId(%sull)", value.c_str());
+            }
+
+            case Data::eType::Number:
+            {
+                const double value = *datum.GetAs<Data::NumberType>();
+                if (!std::isfinite(value))
+                {
+                    WriteUnsupported(execution, "numbers that are not finite");
+                    return "0.0";
+                }
+
+                AZStd::string literal = AZStd::string::format("%.17g", value);
+                if (literal.find_first_of(".e") == AZStd::string::npos)
+                {
+                    literal += ".0";
+                }
+
+                return literal;
+            }
+
+            case Data::eType::Quaternion:
+            {
+                const auto value = datum.GetAs<Data::QuaternionType>();
+                return AZStd::string::format("AZ::Quaternion(%s, %s, %s, %s)", ToFloatLiteral(value->GetX()).c_str(), ToFloatLiteral(value->GetY()).c_str()
+                    , ToFloatLiteral(value->GetZ()).c_str(), ToFloatLiteral(value->GetW()).c_str());
+            }
+
+            case Data::eType::String:
+                return GraphToCppCpp::ToStringLiteral(*datum.GetAs<Data::StringType>());
+
+            case Data::eType::Vector2:
+            {
+                const auto value = datum.GetAs<Data::Vector2Type>();
+                return AZStd::string::format("AZ::Vector2(%s, %s)", ToFloatLiteral(value->GetX()).c_str(), ToFloatLiteral(value->GetY()).c_str());
+            }
+
+            case Data::eType::Vector3:
+            {
+                const auto value = datum.GetAs<Data::Vector3Type>();
+                return AZStd::string::format("AZ::Vector3(%s, %s, %s)", ToFloatLiteral(value->GetX()).c_str(), ToFloatLiteral(value->GetY()).c_str()
+                    , ToFloatLiteral(value->GetZ()).c_str());
+            }
+
+            case Data::eType::Vector4:
+            {
+                const auto value = datum.GetAs<Data::Vector4Type>();
+                return AZStd::string::format("AZ::Vector4(%s, %s, %s, %s)", ToFloatLiteral(value->GetX()).c_str(), ToFloatLiteral(value->GetY()).c_str()
+                    , ToFloatLiteral(value->GetZ()).c_str(), ToFloatLiteral(value->GetW()).c_str());
+            }
+
+            default:
+                WriteUnsupported(execution, AZStd::string::format("values of type %s", Data::GetName(datum.GetType()).c_str()));
+                return "";
+            }
+        }
+
+        AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> GraphToCpp::Translate(const Grammar::AbstractCodeModel& model)
+        {
+            GraphToCpp translation(model);
+
+            if (translation.IsSuccessfull())
+            {
+                TargetResult header;
+                header.m_text = translation.m_dotH.MoveOutput();
+                header.m_subgraphInterface = model.GetInterface();
+                header.m_runtimeInputs = translation.m_runtimeInputs;
+                header.m_duration = translation.GetTranslationDuration();
+
+                TargetResult source;
+                source.m_text = translation.m_dotCpp.MoveOutput();
+                source.m_subgraphInterface = model.GetInterface();
+                source.m_runtimeInputs = AZStd::move(translation.m_runtimeInputs);
+                // the header and source are translated together, the duration is only counted once
+                source.m_duration = 0;
+
+                return AZ::Success(AZStd::make_pair(AZStd::move(header), AZStd::move(source)));
+            }
+            else
+            {
+                return AZ::Failure(translation.MoveErrors());
+            }
+        }
+
+        void GraphToCpp::TranslateEBusHandlerCreation()
+        {
+            for (const auto& ebusHandling : m_model.GetEBusHandlings())
+            {
+                m_execute.WriteLineIndented("{");
+                {
+                    ScopedIndent indent(m_execute);
+                    m_execute.WriteLineIndented("EBusHandler* handler = CreateEBusHandler(\"%s\");", ebusHandling->m_ebusName.c_str());
+
+                    for (const auto& nameAndEventThread : ebusHandling->m_events)
+                    {
+                        const Grammar::ExecutionTreeConstPtr& eventThread = nameAndEventThread.second;
+
+                        AZStd::optional<size_t> eventIndex = ebusHandling->m_node->GetEventIndex(nameAndEventThread.first);
+                        if (!eventIndex)
+                        {
+                            AddError(nullptr, aznew Internal::ParseError(ebusHandling->m_node->GetEntityId()
+                                , AZStd::string::format("EBus Handler %s did not return a valid index for event %s"
+                                    , ebusHandling->m_ebusName.c_str(), nameAndEventThread.first.c_str())));
+                            return;
+                        }
+
+                        if (eventThread->HasReturnValues())
+                        {
+                            WriteUnsupported(eventThread, AZStd::string::format("EBus events with results, %s", nameAndEventThread.first.c_str()));
+                            return;
+                        }
+
+                        EventFunction eventFunction;
+                        eventFunction.m_name = AZStd::string::format("On%s_%s", Grammar::ToIdentifier(ebusHandling->m_handlerName).c_str()
+                            , Grammar::ToIdentifier(nameAndEventThread.first).c_str());
+                        eventFunction.m_execution = eventThread;
+
+                        m_execute.WriteLineIndented("handler->SetExecutionOut(%zu, [this](AZ::BehaviorValueParameter*, AZ::BehaviorValueParameter* arguments, int numArguments)", *eventIndex);
+                        m_execute.WriteLineIndented("{");
+                        m_execute.WriteLineIndented("    %s(arguments, numArguments);", eventFunction.m_name.c_str());
+                        m_execute.WriteLineIndented("});");
+                        m_execute.WriteLineIndented("handler->HandleEvent(%zu);", *eventIndex);
+
+                        m_eventFunctions.push_back(AZStd::move(eventFunction));
+                    }
+
+                    if (ebusHandling->m_isAddressed)
+                    {
+                        if (!IsSupportedVariable(nullptr, ebusHandling->m_startingAdress))
+                        {
+                            return;
+                        }
+
+                        m_execute.WriteLineIndented("AZ::BehaviorValueParameter address(&%s);", GraphToCppCpp::ToVariableName(ebusHandling->m_startingAdress).c_str());
+                        m_execute.WriteLineIndented("handler->ConnectTo(address);");
+                    }
+                    else
+                    {
+                        m_execute.WriteLineIndented("handler->Connect();");
+                    }
+                }
+                m_execute.WriteLineIndented("}");
+            }
+        }
+
+        void GraphToCpp::TranslateEventFunctions()
+        {
+            for (EventFunction& eventFunction : m_eventFunctions)
+            {
+                if (!IsSuccessfull())
+                {
+                    return;
+                }
+
+                const Grammar::ExecutionTreeConstPtr& eventThread = eventFunction.m_execution;
+
+                // the event functions are written inside of the namespaces
+                m_execute = Writer();
+                m_execute.SetIndent(3);
+
+                if (eventThread->GetChildrenCount() > 0)
+                {
+                    const auto& parameters = eventThread->GetChild(0).m_output;
+
+                    for (size_t index = 0; index < parameters.size(); ++index)
+                    {
+                        // parameters the graph doesn't support, e.g. the ScriptTimePoint of OnTick, are only an error when they are used
+                        const Grammar::VariableConstPtr& parameter = parameters[index].second->m_source;
+                        const AZStd::string type = GraphToCppCpp::ToCppTypeName(parameter->m_datum.GetType());
+                        if (!type.empty())
+                        {
+                            m_execute.WriteLineIndented("[[maybe_unused]] %s %s = GetEventArgument<%s>(arguments, numArguments, %zu);", type.c_str()
+                                , GraphToCppCpp::ToVariableName(parameter).c_str(), type.c_str(), index);
+                        }
+                    }
+                }
+
+                WriteOutputAssignments(eventThread);
+                WriteLocalVariables(eventThread);
+
+                if (eventThread->GetChildrenCount() > 0 && eventThread->GetChild(0).m_execution)
+                {
+                    TranslateExecutionTreeEntry(eventThread->GetChild(0).m_execution);
+                }
+
+                eventFunction.m_body = m_execute.MoveOutput();
+            }
+        }
+
+        void GraphToCpp::TranslateExecute()
+        {
+            const Grammar::ExecutionTreeConstPtr start = m_model.GetStart();
+
+            // Execute is written inside of the namespaces
+            m_execute.SetIndent(3);
+
+            if (!m_constructionArguments.empty())
+            {
+                m_execute.WriteLineIndented("Execution::ActivationInputArray storage;");
+                m_execute.WriteLineIndented("const Execution::ActivationInputRange range = CreateActivationInputRange(storage);");
+
+                for (size_t index = 0; index < m_constructionArguments.size(); ++index)
+                {
+                    const Grammar::VariableConstPtr& argument = m_constructionArguments[index];
+                    if (!IsSupportedVariable(start, argument))
+                    {
+                        return;
+                    }
+
+                    m_execute.WriteLineIndented("%s = GetActivationInput<%s>(range, %zu);", GraphToCppCpp::ToVariableName(argument).c_str()
+                        , ToCppType(start, argument->m_datum.GetType()).c_str(), index);
+                }
+            }
+
+            for (const auto& variable : m_memberVariables)
+            {
+                if (!IsSupportedVariable(start, variable))
+                {
+                    return;
+                }
+
+                const bool isConstructionArgument = AZStd::find(m_constructionArguments.begin(), m_constructionArguments.end(), variable) != m_constructionArguments.end();
+
+                if (!isConstructionArgument && Grammar::ParseConstructionRequirement(variable) == Grammar::VariableConstructionRequirement::None)
+                {
+                    m_execute.WriteLineIndented("%s = %s;", GraphToCppCpp::ToVariableName(variable).c_str(), ToCppValue(start, variable->m_datum).c_str());
+                }
+            }
+
+            TranslateEBusHandlerCreation();
+
+            if (start && IsSuccessfull())
+            {
+                WriteLocalVariables(start);
+                WriteOutputAssignments(start);
+
+                if (start->GetChildrenCount() > 0 && start->GetChild(0).m_execution)
+                {
+                    TranslateExecutionTreeEntry(start->GetChild(0).m_execution);
+                }
+            }
+        }
+
+        void GraphToCpp::TranslateExecutionTreeChildren(Grammar::ExecutionTreeConstPtr execution)
+        {
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount() && IsSuccessfull(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+
+                if (child.m_execution && !child.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+            }
+        }
+
+        void GraphToCpp::TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (!IsSuccessfull())
+            {
+                return;
+            }
+
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::Break:
+                m_execute.WriteLineIndented("break;");
+                break;
+
+            case Grammar::Symbol::CompareEqual:
+            case Grammar::Symbol::CompareGreater:
+            case Grammar::Symbol::CompareGreaterEqual:
+            case Grammar::Symbol::CompareLess:
+            case Grammar::Symbol::CompareLessEqual:
+            case Grammar::Symbol::CompareNotEqual:
+            case Grammar::Symbol::LogicalAND:
+            case Grammar::Symbol::LogicalNOT:
+            case Grammar::Symbol::LogicalOR:
+            case Grammar::Symbol::FunctionCall:
+            case Grammar::Symbol::OperatorAddition:
+            case Grammar::Symbol::OperatorDivision:
+            case Grammar::Symbol::OperatorMultiplication:
+            case Grammar::Symbol::OperatorSubraction:
+            case Grammar::Symbol::VariableAssignment:
+                TranslateExecutionTreeFunctionCall(execution);
+                break;
+
+            case Grammar::Symbol::VariableDeclaration:
+            {
+                auto variable = execution->GetInput(0).m_value;
+                if (!IsMemberVariable(variable) && IsSupportedVariable(execution, variable))
+                {
+                    m_execute.WriteLineIndented("%s %s = %s;", ToCppType(execution, variable->m_datum.GetType()).c_str()
+                        , GraphToCppCpp::ToVariableName(variable).c_str(), ToCppValue(execution, variable->m_datum).c_str());
+                }
+                break;
+            }
+
+            case Grammar::Symbol::IfCondition:
+                m_execute.WriteIndented("if (");
+                WriteFunctionCallInput(execution, 0);
+                m_execute.WriteLine(")");
+
+                for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+                {
+                    if (childIndex > 0)
+                    {
+                        m_execute.WriteLineIndented("else");
+                    }
+
+                    m_execute.WriteLineIndented("{");
+                    {
+                        ScopedIndent indent(m_execute);
+                        const auto& child = execution->GetChild(childIndex);
+
+                        if (child.m_execution && !child.m_execution->IsInternalOut())
+                        {
+                            TranslateExecutionTreeEntry(child.m_execution);
+                        }
+                    }
+                    m_execute.WriteLineIndented("}");
+                }
+                return;
+
+            case Grammar::Symbol::While:
+                m_execute.WriteIndented("while (");
+                WriteFunctionCallInput(execution, 0);
+                m_execute.WriteLine(")");
+                m_execute.WriteLineIndented("{");
+                {
+                    ScopedIndent indent(m_execute);
+                    const auto& loop = execution->GetChild(0);
+
+                    if (loop.m_execution && !loop.m_execution->IsInternalOut())
+                    {
+                        TranslateExecutionTreeEntry(loop.m_execution);
+                    }
+                }
+                m_execute.WriteLineIndented("}");
+
+                if (execution->GetChildrenCount() > 1)
+                {
+                    const auto& finished = execution->GetChild(1);
+
+                    if (finished.m_execution && !finished.m_execution->IsInternalOut())
+                    {
+                        TranslateExecutionTreeEntry(finished.m_execution);
+                    }
+                }
+                return;
+
+            case Grammar::Symbol::DebugInfoEmptyStatement:
+            case Grammar::Symbol::FunctionDefinition:
+            case Grammar::Symbol::PlaceHolderDuringParsing:
+            case Grammar::Symbol::Sequence:
+                break;
+
+            default:
+                WriteUnsupported(execution, AZStd::string::format("%s nodes", Grammar::GetSymbolName(execution->GetSymbol())));
+                return;
+            }
+
+            TranslateExecutionTreeChildren(execution);
+        }
+
+        void GraphToCpp::TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (!execution->GetConversions().empty())
+            {
+                WriteUnsupported(execution, "data conversions");
+                return;
+            }
+
+            for (size_t index = 0; index < execution->GetInputCount(); ++index)
+            {
+                if (!IsSupportedVariable(execution, execution->GetInput(index).m_value))
+                {
+                    return;
+                }
+            }
+
+            Grammar::VariableConstPtr output;
+
+            if (execution->GetChildrenCount() == 1 && !execution->GetChild(0).m_output.empty())
+            {
+                const auto& childOutput = execution->GetChild(0).m_output;
+                if (childOutput.size() > 1)
+                {
+                    WriteUnsupported(execution, "multiple results");
+                    return;
+                }
+
+                if (!childOutput[0].second->m_sourceConversions.empty())
+                {
+                    WriteUnsupported(execution, "data conversions");
+                    return;
+                }
+
+                output = childOutput[0].second->m_source;
+
+                if (!IsSupportedVariable(execution, output))
+                {
+                    return;
+                }
+            }
+
+            const bool isOutputDeclared = output && output->m_source == execution && !IsMemberVariable(output);
+
+            auto writeOutput = [&]()
+            {
+                if (isOutputDeclared)
+                {
+                    m_execute.WriteIndented("%s %s = ", ToCppType(execution, output->m_datum.GetType()).c_str(), GraphToCppCpp::ToVariableName(output).c_str());
+                }
+                else
+                {
+                    m_execute.WriteIndented("%s = ", GraphToCppCpp::ToVariableName(output).c_str());
+                }
+            };
+
+            if (Grammar::IsLogicalExpression(execution))
+            {
+                if (output)
+                {
+                    writeOutput();
+                    WriteLogicalExpression(execution);
+                    m_execute.WriteLine(";");
+                }
+            }
+            else if (Grammar::IsVariableGet(execution) || Grammar::IsVariableSet(execution) || execution->GetSymbol() == Grammar::Symbol::VariableAssignment)
+            {
+                if (output)
+                {
+                    writeOutput();
+                    WriteFunctionCallInput(execution, 0);
+                    m_execute.WriteLine(";");
+                }
+            }
+            else if (Grammar::IsOperatorArithmetic(execution))
+            {
+                if (output)
+                {
+                    writeOutput();
+                    WriteOperatorArithmetic(execution);
+                    m_execute.WriteLine(";");
+                }
+            }
+            else if (Grammar::IsWrittenMathExpression(execution))
+            {
+                WriteUnsupported(execution, "math expressions");
+            }
+            else if (Grammar::IsExecutedPropertyExtraction(execution)
+                || Grammar::IsGlobalPropertyRead(execution)
+                || Grammar::IsClassPropertyRead(execution)
+                || Grammar::IsClassPropertyWrite(execution))
+            {
+                WriteUnsupported(execution, "properties");
+            }
+            else if (Grammar::IsEventConnectCall(execution) || Grammar::IsEventDisconnectCall(execution) || execution->GetEventType() != EventType::Count)
+            {
+                WriteUnsupported(execution, "events");
+            }
+            else if (Grammar::IsUserFunctionCall(execution) || execution->GetNodeable())
+            {
+                WriteUnsupported(execution, "functions and nodeables");
+            }
+            else if (Grammar::IsFunctionCallNullCheckRequired(execution)
+                || (execution->GetId().m_node && execution->GetId().m_node->ConvertsInputToStrings()))
+            {
+                WriteUnsupported(execution, "null checked or formatted input");
+            }
+            else
+            {
+                WriteMethodCall(execution, output, isOutputDeclared);
+            }
+
+            WriteOutputAssignments(execution);
+        }
+
+        void GraphToCpp::TranslateHeader()
+        {
+            if (!IsSuccessfull())
+            {
+                return;
+            }
+
+            WriteCopyright(m_dotH);
+            WriteDoNotModify(m_dotH);
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLine("#pragma once");
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLine("#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>");
+            m_dotH.WriteNewLine();
+            OpenNamespace(m_dotH, "ScriptCanvas");
+            OpenNamespace(m_dotH, GetAutoNativeNamespace());
+            {
+                m_dotH.WriteLineIndented("class %s final", m_className.c_str());
+                m_dotH.WriteLineIndented("    : public ExecutionStateNative");
+                m_dotH.WriteLineIndented("{");
+                m_dotH.WriteLineIndented("public:");
+                {
+                    ScopedIndent indent(m_dotH);
+                    m_dotH.WriteLineIndented("AZ_RTTI(%s, \"%s\", ExecutionStateNative);", m_className.c_str()
+                        , AZ::Uuid::CreateName(m_className.c_str()).ToString<AZStd::string>().c_str());
+                    m_dotH.WriteLineIndented("AZ_CLASS_ALLOCATOR(%s, AZ::SystemAllocator, 0);", m_className.c_str());
+                    m_dotH.WriteNewLine();
+                    m_dotH.WriteLineIndented("%s Call from the constructor and destructor of the gem module the graph is compiled into", m_configuration.m_singleLineComment.data());
+                    m_dotH.WriteLineIndented("static void Register();");
+                    m_dotH.WriteLineIndented("static void Unregister();");
+                    m_dotH.WriteNewLine();
+                    m_dotH.WriteLineIndented("%s(const ExecutionStateConfig& config);", m_className.c_str());
+                    m_dotH.WriteNewLine();
+                    m_dotH.WriteLineIndented("void Execute() override;");
+                }
+                m_dotH.WriteNewLine();
+                m_dotH.WriteLineIndented("private:");
+                {
+                    ScopedIndent indent(m_dotH);
+                    m_dotH.WriteLineIndented("static ExecutionStatePtr Create(const ExecutionStateConfig& config);");
+                    m_dotH.WriteLineIndented("static bool ResolveMethods();");
+
+                    if (!m_eventFunctions.empty())
+                    {
+                        m_dotH.WriteNewLine();
+
+                        for (const EventFunction& eventFunction : m_eventFunctions)
+                        {
+                            m_dotH.WriteLineIndented("void %s(AZ::BehaviorValueParameter* arguments, int numArguments);", eventFunction.m_name.c_str());
+                        }
+                    }
+
+                    if (!m_methodLookups.empty())
+                    {
+                        m_dotH.WriteNewLine();
+                        m_dotH.WriteLineIndented("static const AZ::BehaviorMethod* s_methods[%zu];", m_methodLookups.size());
+
+                        for (size_t index = 0; index < m_functionLookups.size(); ++index)
+                        {
+                            m_dotH.WriteLineIndented("static %s s_function%zu;", m_functionLookups[index].m_type.c_str(), index);
+                        }
+                    }
+
+                    if (!m_memberVariables.empty())
+                    {
+                        m_dotH.WriteNewLine();
+
+                        for (const auto& variable : m_memberVariables)
+                        {
+                            m_dotH.WriteLineIndented("%s %s{};", GraphToCppCpp::ToCppTypeName(variable->m_datum.GetType()).c_str()
+                                , GraphToCppCpp::ToVariableName(variable).c_str());
+                        }
+                    }
+                }
+                m_dotH.WriteLineIndented("};");
+            }
+            CloseNamespace(m_dotH, GetAutoNativeNamespace());
+            CloseNamespace(m_dotH, "ScriptCanvas");
+        }
+
+        void GraphToCpp::TranslateSource()
+        {
+            if (!IsSuccessfull())
+            {
+                return;
+            }
+
+            WriteCopyright(m_dotCpp);
+            WriteDoNotModify(m_dotCpp);
+            m_dotCpp.WriteNewLine();
+            m_dotCpp.WriteLine("#include \"%s.h\"", GetGraphName().data());
+            m_dotCpp.WriteNewLine();
+            OpenNamespace(m_dotCpp, "ScriptCanvas");
+            OpenNamespace(m_dotCpp, GetAutoNativeNamespace());
+            {
+                if (!m_methodLookups.empty())
+                {
+                    m_dotCpp.WriteLineIndented("const AZ::BehaviorMethod* %s::s_methods[%zu] = {};", m_className.c_str(), m_methodLookups.size());
+
+                    for (size_t index = 0; index < m_functionLookups.size(); ++index)
+                    {
+                        m_dotCpp.WriteLineIndented("%s %s::s_function%zu = nullptr;", m_functionLookups[index].m_type.c_str(), m_className.c_str(), index);
+                    }
+
+                    m_dotCpp.WriteNewLine();
+                }
+
+                // Register
+                m_dotCpp.WriteLineIndented("void %s::Register()", m_className.c_str());
+                OpenFunctionBlock(m_dotCpp);
+                m_dotCpp.WriteLineIndented("NativeGraphRegistry::Get().Register(AZ::Uuid(\"%s\"), &%s::Create);"
+                    , m_model.GetSource().m_assetId.m_guid.ToString<AZStd::string>().c_str(), m_className.c_str());
+                CloseFunctionBlock(m_dotCpp);
+                m_dotCpp.WriteNewLine();
+
+                // Unregister
+                m_dotCpp.WriteLineIndented("void %s::Unregister()", m_className.c_str());
+                OpenFunctionBlock(m_dotCpp);
+                m_dotCpp.WriteLineIndented("NativeGraphRegistry::Get().Unregister(AZ::Uuid(\"%s\"));"
+                    , m_model.GetSource().m_assetId.m_guid.ToString<AZStd::string>().c_str());
+                CloseFunctionBlock(m_dotCpp);
+                m_dotCpp.WriteNewLine();
+
+                // Create
+                m_dotCpp.WriteLineIndented("ExecutionStatePtr %s::Create(const ExecutionStateConfig& config)", m_className.c_str());
+                OpenFunctionBlock(m_dotCpp);
+                m_dotCpp.WriteLineIndented("return ResolveMethods() ? AZStd::make_shared<%s>(config) : nullptr;", m_className.c_str());
+                CloseFunctionBlock(m_dotCpp);
+                m_dotCpp.WriteNewLine();
+
+                // ResolveMethods
+                m_dotCpp.WriteLineIndented("bool %s::ResolveMethods()", m_className.c_str());
+                OpenFunctionBlock(m_dotCpp);
+                if (m_methodLookups.empty())
+                {
+                    m_dotCpp.WriteLineIndented("return true;");
+                }
+                else
+                {
+                    m_dotCpp.WriteLineIndented("static const bool s_isResolved = []()");
+                    m_dotCpp.WriteLineIndented("{");
+                    {
+                        ScopedIndent indent(m_dotCpp);
+                        m_dotCpp.WriteLineIndented("bool isResolved = true;");
+
+                        for (size_t index = 0; index < m_methodLookups.size(); ++index)
+                        {
+                            m_dotCpp.WriteLineIndented("s_methods[%zu] = %s;", index, m_methodLookups[index].c_str());
+                            m_dotCpp.WriteLineIndented("isResolved = isResolved && s_methods[%zu];", index);
+                        }
+
+                        for (size_t index = 0; index < m_functionLookups.size(); ++index)
+                        {
+                            m_dotCpp.WriteLineIndented("s_function%zu = %s;", index, m_functionLookups[index].m_resolution.c_str());
+                            m_dotCpp.WriteLineIndented("isResolved = isResolved && s_function%zu;", index);
+                        }
+
+                        m_dotCpp.WriteLineIndented("AZ_Warning(\"ScriptCanvas\", isResolved, \"%s executes interpreted, not all of its methods are reflected\");", m_className.c_str());
+                        m_dotCpp.WriteLineIndented("return isResolved;");
+                    }
+                    m_dotCpp.WriteLineIndented("}();");
+                    m_dotCpp.WriteLineIndented("return s_isResolved;");
+                }
+                CloseFunctionBlock(m_dotCpp);
+                m_dotCpp.WriteNewLine();
+
+                // constructor
+                m_dotCpp.WriteLineIndented("%s::%s(const ExecutionStateConfig& config)", m_className.c_str(), m_className.c_str());
+                m_dotCpp.WriteLineIndented("    : ExecutionStateNative(config)");
+                m_dotCpp.WriteLineIndented("{}");
+                m_dotCpp.WriteNewLine();
+
+                // Execute
+                m_dotCpp.WriteLineIndented("void %s::Execute()", m_className.c_str());
+                OpenFunctionBlock(m_dotCpp);
+                m_dotCpp.Write(m_executeBody);
+                CloseFunctionBlock(m_dotCpp);
+
+                // EBus events
+                for (const EventFunction& eventFunction : m_eventFunctions)
+                {
+                    m_dotCpp.WriteNewLine();
+                    m_dotCpp.WriteLineIndented("void %s::%s([[maybe_unused]] AZ::BehaviorValueParameter* arguments, [[maybe_unused]] int numArguments)"
+                        , m_className.c_str(), eventFunction.m_name.c_str());
+                    OpenFunctionBlock(m_dotCpp);
+                    m_dotCpp.Write(eventFunction.m_body);
+                    CloseFunctionBlock(m_dotCpp);
+                }
+            }
+            CloseNamespace(m_dotCpp, GetAutoNativeNamespace());
+            CloseNamespace(m_dotCpp, "ScriptCanvas");
+        }
+
+        void GraphToCpp::WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index)
+        {
+            if (index >= execution->GetInputCount())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), "Native translation is missing function call input"));
+                return;
+            }
+
+            const auto& input = execution->GetInput(index).m_value;
+            if (!IsSupportedVariable(execution, input))
+            {
+                return;
+            }
+
+            if (input->m_source != execution || input->m_requiresCreationFunction)
+            {
+                m_execute.Write(GraphToCppCpp::ToVariableName(input));
+            }
+            else
+            {
+                m_execute.Write(ToCppValue(execution, input->m_datum));
+            }
+        }
+
+        void GraphToCpp::WriteLocalVariables(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto localVariables = m_model.GetLocalVariables(execution))
+            {
+                for (const auto& variable : *localVariables)
+                {
+                    if (!IsMemberVariable(variable) && Grammar::ParseConstructionRequirement(variable) == Grammar::VariableConstructionRequirement::None)
+                    {
+                        if (!IsSupportedVariable(execution, variable))
+                        {
+                            return;
+                        }
+
+                        m_execute.WriteLineIndented("%s %s = %s;", ToCppType(execution, variable->m_datum.GetType()).c_str()
+                            , GraphToCppCpp::ToVariableName(variable).c_str(), ToCppValue(execution, variable->m_datum).c_str());
+                    }
+                }
+            }
+        }
+
+        void GraphToCpp::WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto symbol = execution->GetSymbol();
+
+            if (symbol == Grammar::Symbol::LogicalNOT)
+            {
+                m_execute.Write("!");
+                WriteFunctionCallInput(execution, 0);
+            }
+            else if (Grammar::IsFloatingPointNumberEqualityComparison(execution))
+            {
+                // the same tolerance as the interpreted comparison
+                m_execute.Write("(AZ::GetAbs(");
+                WriteFunctionCallInput(execution, 0);
+                m_execute.Write(" - ");
+                WriteFunctionCallInput(execution, 1);
+                m_execute.Write(symbol == Grammar::Symbol::CompareEqual ? ") <= %s)" : ") > %s)", Grammar::k_LuaEpsilonString);
+            }
+            else
+            {
+                WriteFunctionCallInput(execution, 0);
+
+                switch (symbol)
+                {
+                case Grammar::Symbol::CompareEqual:
+                    m_execute.Write(" == ");
+                    break;
+                case Grammar::Symbol::CompareGreater:
+                    m_execute.Write(" > ");
+                    break;
+                case Grammar::Symbol::CompareGreaterEqual:
+                    m_execute.Write(" >= ");
+                    break;
+                case Grammar::Symbol::CompareLess:
+                    m_execute.Write(" < ");
+                    break;
+                case Grammar::Symbol::CompareLessEqual:
+                    m_execute.Write(" <= ");
+                    break;
+                case Grammar::Symbol::CompareNotEqual:
+                    m_execute.Write(" != ");
+                    break;
+                case Grammar::Symbol::LogicalAND:
+                    m_execute.Write(" && ");
+                    break;
+                case Grammar::Symbol::LogicalOR:
+                    m_execute.Write(" || ");
+                    break;
+                default:
+                    WriteUnsupported(execution, AZStd::string::format("%s expressions", Grammar::GetSymbolName(symbol)));
+                    return;
+                }
+
+                WriteFunctionCallInput(execution, 1);
+            }
+        }
+
+        void GraphToCpp::WriteMethodCall(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr output, bool isOutputDeclared)
+        {
+            const AZStd::string& name = execution->GetName();
+            if (name.empty())
+            {
+                WriteUnsupported(execution, "unnamed function calls");
+                return;
+            }
+
+            const Grammar::LexicalScope lexicalScope = execution->GetNameLexicalScope();
+            AZStd::string lookup;
+
+            switch (lexicalScope.m_type)
+            {
+            case Grammar::LexicalScopeType::Class:
+            case Grammar::LexicalScopeType::Namespace:
+                lookup = AZStd::string::format("Execution::FindNativeMethod(\"%s\", \"%s\")"
+                    , lexicalScope.m_namespaces.empty() ? "" : lexicalScope.m_namespaces.back().c_str(), name.c_str());
+                break;
+
+            case Grammar::LexicalScopeType::Variable:
+                if (execution->GetInputCount() == 0)
+                {
+                    WriteUnsupported(execution, "member function calls without an object");
+                    return;
+                }
+
+                lookup = AZStd::string::format("Execution::FindNativeMethod(AZ::Uuid(\"%s\"), \"%s\")"
+                    , execution->GetInput(0).m_value->m_datum.GetType().GetAZType().ToString<AZStd::string>().c_str(), name.c_str());
+                break;
+
+            default:
+                WriteUnsupported(execution, "function calls of this scope");
+                return;
+            }
+
+            const size_t methodIndex = AddMethodLookup(lookup);
+
+            const AZ::BehaviorMethod* method = lexicalScope.m_type == Grammar::LexicalScopeType::Variable
+                ? Execution::FindNativeMethod(execution->GetInput(0).m_value->m_datum.GetType().GetAZType(), name)
+                : Execution::FindNativeMethod(AZStd::string_view(lexicalScope.m_namespaces.empty() ? "" : lexicalScope.m_namespaces.back().c_str()), name);
+
+            AZStd::optional<GraphToCppCpp::NativeSignature> signature;
+            if (method)
+            {
+                AZStd::vector<Data::Type> inputTypes;
+                for (size_t index = 0; index < execution->GetInputCount(); ++index)
+                {
+                    inputTypes.push_back(execution->GetInput(index).m_value->m_datum.GetType());
+                }
+
+                const Data::Type outputType = output ? output->m_datum.GetType() : Data::Type::Invalid();
+                for (const AZ::BehaviorMethod* overload = method; overload && !signature; overload = overload->m_overload)
+                {
+                    signature = GraphToCppCpp::GetNativeSignature(*overload, inputTypes, output ? &outputType : nullptr);
+                }
+
+                // the overloads are only told apart by their types, which the BehaviorContext resolves when they are called generically
+                if (!signature && method->m_overload)
+                {
+                    WriteUnsupported(execution, AZStd::string::format("overloaded functions with these arguments, %s", name.c_str()));
+                    return;
+                }
+            }
+
+            if (output && isOutputDeclared)
+            {
+                m_execute.WriteLineIndented("%s %s{};", ToCppType(execution, output->m_datum.GetType()).c_str(), GraphToCppCpp::ToVariableName(output).c_str());
+            }
+
+            if (signature)
+            {
+                // the function is called directly, the BehaviorMethod only resolves it
+                FunctionLookup functionLookup;
+                functionLookup.m_type = AZStd::string::format("Execution::%s<%s>", signature->m_isMember ? "NativeMemberFunction" : "NativeFunction"
+                    , signature->m_templateArguments.c_str());
+                functionLookup.m_resolution = AZStd::string::format("Execution::%s<%s>(s_methods[%zu])", signature->m_isMember ? "FindNativeMemberFunction" : "FindNativeFunction"
+                    , signature->m_templateArguments.c_str(), methodIndex);
+                const size_t functionIndex = AddFunctionLookup(functionLookup);
+
+                m_execute.WriteIndent();
+
+                if (output)
+                {
+                    m_execute.Write("%s = ", GraphToCppCpp::ToVariableName(output).c_str());
+                }
+
+                size_t index = 0;
+
+                if (signature->m_isMember)
+                {
+                    m_execute.Write("(");
+                    WriteFunctionCallInput(execution, 0);
+                    m_execute.Write(".*s_function%zu)(", functionIndex);
+                    ++index;
+                }
+                else
+                {
+                    m_execute.Write("s_function%zu(", functionIndex);
+                }
+
+                for (const size_t firstArgument = index; index < execution->GetInputCount(); ++index)
+                {
+                    if (index != firstArgument)
+                    {
+                        m_execute.Write(", ");
+                    }
+
+                    const AZStd::string& cast = signature->m_inputCasts[index];
+                    if (!cast.empty())
+                    {
+                        m_execute.Write("static_cast<%s>(", cast.c_str());
+                        WriteFunctionCallInput(execution, index);
+                        m_execute.Write(")");
+                    }
+                    else
+                    {
+                        WriteFunctionCallInput(execution, index);
+                    }
+                }
+
+                m_execute.WriteLine(");");
+                return;
+            }
+
+            // the types of the function aren't known in advance, or it isn't reflected in the editor, so it's called generically
+            if (output)
+            {
+                m_execute.WriteIndented("Execution::CallNativeResult(s_methods[%zu], %s", methodIndex, GraphToCppCpp::ToVariableName(output).c_str());
+            }
+            else
+            {
+                m_execute.WriteIndented("Execution::CallNative(s_methods[%zu]", methodIndex);
+            }
+
+            for (size_t index = 0; index < execution->GetInputCount(); ++index)
+            {
+                m_execute.Write(", ");
+                WriteFunctionCallInput(execution, index);
+            }
+
+            m_execute.WriteLine(");");
+        }
+
+        void GraphToCpp::WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto count = execution->GetInputCount();
+
+            if (count < 2)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NotEnoughInputForArithmeticOperator));
+                return;
+            }
+
+            // the C++ operators of the math types don't mix with doubles, so only operands of the same type are supported
+            const Data::Type& type = execution->GetInput(0).m_value->m_datum.GetType();
+            for (size_t i = 1; i < count; ++i)
+            {
+                if (!(execution->GetInput(i).m_value->m_datum.GetType() == type))
+                {
+                    WriteUnsupported(execution, "arithmetic on operands of different types");
+                    return;
+                }
+            }
+
+            const AZStd::string_view operatorString = GraphToCppCpp::GetOperatorString(execution->GetSymbol());
+
+            for (size_t i = 0; i < (count - 1); ++i)
+            {
+                m_execute.Write("(");
+            }
+
+            WriteFunctionCallInput(execution, 0);
+            m_execute.Write(operatorString);
+            WriteFunctionCallInput(execution, 1);
+            m_execute.Write(")");
+
+            for (size_t i = 2; i < count; ++i)
+            {
+                m_execute.Write(operatorString);
+                WriteFunctionCallInput(execution, i);
+                m_execute.Write(")");
+            }
+        }
+
+        void GraphToCpp::WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto output = execution->GetLocalOutput();
+            if (!output)
+            {
+                return;
+            }
+
+            for (const auto& outputIter : *output)
+            {
+                for (const auto& assignment : outputIter.second->m_assignments)
+                {
+                    if (!IsSupportedVariable(execution, assignment))
+                    {
+                        return;
+                    }
+
+                    m_execute.WriteLineIndented("%s = %s;", GraphToCppCpp::ToVariableName(assignment).c_str()
+                        , GraphToCppCpp::ToVariableName(outputIter.second->m_source).c_str());
+                }
+            }
+        }
+
+        void GraphToCpp::WriteUnsupported(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view construct)
+        {
+            const AZ::EntityId nodeId = execution ? execution->GetNodeId() : AZ::EntityId();
+            AddError(execution, aznew Internal::ParseError(nodeId
+                , AZStd::string::format("Native translation doesn't support %.*s", aznumeric_cast<int>(construct.size()), construct.data())));
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
+
+#include "GraphToX.h"
+#include "TranslationResult.h"
+#include "TranslationUtilities.h"
+
+namespace ScriptCanvas
+{
+    class Datum;
+
+    namespace Data
+    {
+        class Type;
+    }
+
+    namespace Translation
+    {
+        // Translates a graph to a C++ class derived from ExecutionStateNative, to be compiled into a gem module.
+        // The functions the graph calls are resolved from the BehaviorContext once, and called directly with the
+        // graph variables, without marshalling them through the Lua stack. The graph variables are members of the
+        // class, the events of the EBus handlers of the graph, e.g. TickBus::OnTick, are member functions.
+        //
+        // Graphs with functions, nodeables, AZ::Event handlers or dependencies can't be translated yet, nor can
+        // variables of other than value types. They are reported as errors, and the graph keeps running interpreted.
+        class GraphToCpp
+            : public GraphToX
+        {
+        public:
+            // the first result is the header, the second the source file
+            static AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> Translate(const Grammar::AbstractCodeModel& source);
+
+        protected:
+            struct EventFunction
+            {
+                AZStd::string m_name;
+                Grammar::ExecutionTreeConstPtr m_execution;
+                AZStd::string m_body;
+            };
+
+            struct FunctionLookup
+            {
+                AZStd::string m_type;
+                AZStd::string m_resolution;
+            };
+
+            RuntimeInputs m_runtimeInputs;
+            AZStd::string m_className;
+            Writer m_dotH;
+            Writer m_dotCpp;
+            // the body of the function being translated, written before the resolved methods are known
+            Writer m_execute;
+            AZStd::string m_executeBody;
+            AZStd::vector<EventFunction> m_eventFunctions;
+            AZStd::vector<Grammar::VariableConstPtr> m_constructionArguments;
+            AZStd::vector<Grammar::VariableConstPtr> m_memberVariables;
+            AZStd::vector<AZStd::string> m_methodLookups;
+            AZStd::unordered_map<AZStd::string, size_t> m_methodIndices;
+            AZStd::vector<FunctionLookup> m_functionLookups;
+            AZStd::unordered_map<AZStd::string, size_t> m_functionIndices;
+
+            GraphToCpp(const Grammar::AbstractCodeModel& source);
+
+            size_t AddFunctionLookup(const FunctionLookup& lookup);
+            size_t AddMethodLookup(const AZStd::string& lookup);
+            void AddMemberVariable(Grammar::VariableConstPtr variable);
+            bool CheckSupportedGraph();
+            bool IsMemberVariable(Grammar::VariableConstPtr variable) const;
+            bool IsSupportedVariable(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+            void ParseMemberVariables();
+            AZStd::string ToCppType(Grammar::ExecutionTreeConstPtr execution, const Data::Type& type);
+            AZStd::string ToCppValue(Grammar::ExecutionTreeConstPtr execution, const Datum& datum);
+            void TranslateEBusHandlerCreation();
+            void TranslateEventFunctions();
+            void TranslateExecute();
+            void TranslateExecutionTreeChildren(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateHeader();
+            void TranslateSource();
+            void WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            void WriteLocalVariables(Grammar::ExecutionTreeConstPtr execution);
+            void WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution);
+            void WriteMethodCall(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr output, bool isOutputDeclared);
+            void WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution);
+            void WriteUnsupported(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view construct);
+        };
+    }
+}
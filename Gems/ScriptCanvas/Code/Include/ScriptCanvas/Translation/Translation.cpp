@@ -18,6 +18,7 @@
 
 #include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Translation/GraphToCpp.h>
 #include <ScriptCanvas/Translation/GraphToLua.h>
 #include <ScriptCanvas/Core/Graph.h>
 
@@ -26,6 +27,34 @@ namespace TranslationCPP
     using namespace ScriptCanvas;
     using namespace ScriptCanvas::Translation;
 
+    AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
+    {
+        auto outcome = GraphToCpp::Translate(model);
+        if (outcome.IsSuccess())
+        {
+            if (rawSave)
+            {
+                auto saveOutcome = SaveDotH(model.GetSource(), outcome.GetValue().first.m_text);
+                if (!saveOutcome.IsSuccess())
+                {
+                    AZ_TracePrintf("ScriptCanvas", "Save failed %s", saveOutcome.GetError().data());
+                }
+
+                saveOutcome = SaveDotCPP(model.GetSource(), outcome.GetValue().second.m_text);
+                if (!saveOutcome.IsSuccess())
+                {
+                    AZ_TracePrintf("ScriptCanvas", "Save failed %s", saveOutcome.GetError().data());
+                }
+            }
+
+            return AZ::Success(outcome.TakeValue());
+        }
+        else
+        {
+            return AZ::Failure(outcome.TakeError());
+        }
+    }
+
     AZ::Outcome<TargetResult, ErrorList> ToLua(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
         auto outcome = GraphToLua::Translate(model);
@@ -41,7 +70,7 @@ namespace TranslationCPP
                 auto saveOutcome = SaveDotLua(model.GetSource(), outcome.GetValue().m_text);
                 if (!saveOutcome.IsSuccess())
                 {
-                    AZ_TracePrintf("Save failed %s", saveOutcome.GetError().data());
+                    AZ_TracePrintf("ScriptCanvas", "Save failed %s", saveOutcome.GetError().data());
                 }
             }
 
@@ -98,32 +127,24 @@ namespace ScriptCanvas
                     }
                 }
 
-                // Translation to C++ (executed via BehaviorContext calls) has been demonstrated in the past and is partially in progress.
-                // These calls allow for users to execute multiple translations from the same abstract code model.
-                // More work is required to complete all the latest features of the ACM, and do integrate output files into the build.
-                // 
-                //                 if (targetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
-                //                 {
-                //                     auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), rawSave);
-                //                     if (outcomeCPP.IsSuccess())
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeValue();
-                //                         
-                //                         TargetResult cppResult;
-                //                         cppResult.m_text = AZStd::move(hppAndCpp.first);
-                //                         translations.emplace(TargetFlags::Hpp, AZStd::move(cppResult));
-                //                         TargetResult hppResult;
-                //                         hppResult.m_text = AZStd::move(hppAndCpp.second);
-                //                         translations.emplace(TargetFlags::Cpp, AZStd::move(hppResult));
-                //                     }
-                //                     else
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeError();
-                //                         errors.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
-                //                         errors.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
-                //                     }
-                //                 }
-
+                // The generated C++ executes the BehaviorContext methods directly, once it is compiled into a gem module.
+                // Graphs that use constructs it doesn't support yet report errors here, and keep executing as Lua.
+                if (request.translationTargetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
+                {
+                    auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), request.rawSaveDebugOutput);
+                    if (outcomeCPP.IsSuccess())
+                    {
+                        auto hppAndCpp = outcomeCPP.TakeValue();
+                        translations.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
+                        translations.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
+                    }
+                    else
+                    {
+                        ErrorList cppErrors = outcomeCPP.TakeError();
+                        errors.emplace(TargetFlags::Hpp, cppErrors);
+                        errors.emplace(TargetFlags::Cpp, AZStd::move(cppErrors));
+                    }
+                }
             }
 
             return Result(model, AZStd::move(translations), AZStd::move(errors));
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Asset/EditorAssetConversionBus.h>
+#include <AzCore/Utils/Utils.h>
+#include <Editor/Framework/ScriptCanvasGraphUtilities.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+#include <ScriptCanvasTestingNativeGraphs.h>
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+
+using namespace ScriptCanvas;
+using namespace ScriptCanvasTests;
+using namespace ScriptCanvasEditor;
+
+namespace ScriptCanvas_NativeCPP
+{
+    ExecutionStatePtr CreateNothing(const ExecutionStateConfig&)
+    {
+        return nullptr;
+    }
+
+    // The graph is loaded with the source id it executes natively with, and translated as if its C++ files were in the
+    // directory of the native test graphs.
+    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::string> CreateNativeSource(AZStd::string_view graphName)
+    {
+        const AZStd::string path = AZStd::string::format("%s/%.*s.scriptcanvas", k_unitTestDirPathRelative, aznumeric_cast<int>(graphName.size()), graphName.data());
+        LoadTestGraphResult loadResult = LoadTestGraph(path, ExecutionMode::Native);
+        if (!loadResult.m_runtimeAsset)
+        {
+            return AZ::Failure(AZStd::string::format("failed to load %s", path.c_str()));
+        }
+
+        const AZStd::string rawCppPath = AZStd::string::format("%s/%.*s", k_nativeTestGraphsDir, aznumeric_cast<int>(graphName.size()), graphName.data());
+        AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::string> outcome = AZ::Failure(AZStd::string("native translation failed"));
+        EditorAssetConversionBus::BroadcastResult(outcome, &EditorAssetConversionBusTraits::CreateNativeSource, loadResult.m_editorAsset, rawCppPath);
+        return outcome;
+    }
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeGraphRegistryRegisterFindUnregister)
+{
+    const AZ::Uuid sourceAssetGuid = AZ::Uuid::CreateRandom();
+    EXPECT_EQ(nullptr, NativeGraphRegistry::Get().Find(sourceAssetGuid));
+
+    NativeGraphRegistry::Get().Register(sourceAssetGuid, &ScriptCanvas_NativeCPP::CreateNothing);
+    EXPECT_EQ(&ScriptCanvas_NativeCPP::CreateNothing, NativeGraphRegistry::Get().Find(sourceAssetGuid));
+    EXPECT_EQ(nullptr, NativeGraphRegistry::Get().Find(AZ::Uuid::CreateRandom()));
+
+    NativeGraphRegistry::Get().Unregister(sourceAssetGuid);
+    EXPECT_EQ(nullptr, NativeGraphRegistry::Get().Find(sourceAssetGuid));
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationRejectsAzEventHandlers)
+{
+    auto outcome = ScriptCanvas_NativeCPP::CreateNativeSource("LY_SC_UnitTest_EventHandlerDisconnect");
+    EXPECT_FALSE(outcome.IsSuccess());
+
+    // the graph keeps executing interpreted
+    RunUnitTestGraph("LY_SC_UnitTest_EventHandlerDisconnect", ExecutionMode::Interpreted);
+}
+
+// Translates the native test graphs for the ScriptCanvasTesting.Editor.NativeGraphs.Tests module, which compiles them.
+// The build of that module runs this test, see CMakeLists.txt, it's disabled otherwise.
+TEST_F(ScriptCanvasTestFixture, DISABLED_NativeTranslationWritesTestGraphs)
+{
+    for (const char* graphName : k_nativeTestGraphs)
+    {
+        auto outcome = ScriptCanvas_NativeCPP::CreateNativeSource(graphName);
+        ASSERT_TRUE(outcome.IsSuccess()) << graphName << ": " << outcome.GetError().c_str();
+
+        const AZStd::string headerPath = AZStd::string::format("%s/%s.h", k_nativeTestGraphsDir, graphName);
+        const AZStd::string sourcePath = AZStd::string::format("%s/%s.cpp", k_nativeTestGraphsDir, graphName);
+        auto headerOutcome = AZ::Utils::WriteFile(outcome.GetValue().first, headerPath);
+        EXPECT_TRUE(headerOutcome.IsSuccess()) << headerOutcome.GetError().c_str();
+        auto sourceOutcome = AZ::Utils::WriteFile(outcome.GetValue().second, sourcePath);
+        EXPECT_TRUE(sourceOutcome.IsSuccess()) << sourceOutcome.GetError().c_str();
+    }
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeExecutionReadsNumbersOfAnyArithmeticType)
+{
+    float floatValue = 0.25f;
+    AZ::s32 intValue = -3;
+    double doubleValue = 1.5;
+
+    EXPECT_DOUBLE_EQ(0.25, Execution::ReadNativeNumber(AZ::BehaviorValueParameter(&floatValue)));
+    EXPECT_DOUBLE_EQ(-3.0, Execution::ReadNativeNumber(AZ::BehaviorValueParameter(&intValue)));
+    EXPECT_DOUBLE_EQ(1.5, Execution::ReadNativeNumber(AZ::BehaviorValueParameter(&doubleValue)));
+}
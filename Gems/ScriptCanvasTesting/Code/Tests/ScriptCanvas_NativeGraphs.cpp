@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Asset/EditorAssetConversionBus.h>
+#include <Editor/Framework/ScriptCanvasGraphUtilities.h>
+#include <ScriptCanvas/Execution/ExecutionContext.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
+#include <ScriptCanvas/Execution/RuntimeComponent.h>
+#include <ScriptCanvasTestingNativeGraphs.h>
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+
+using namespace ScriptCanvas;
+using namespace ScriptCanvasTests;
+using namespace ScriptCanvasEditor;
+
+namespace ScriptCanvas_NativeGraphsCPP
+{
+    void RunTestGraph(AZStd::string_view graphName, ExecutionMode execution, Reporter& reporter)
+    {
+        const AZStd::string filePath = AZStd::string::format("%s/%.*s.scriptcanvas", k_unitTestDirPathRelative, aznumeric_cast<int>(graphName.size()), graphName.data());
+
+        RunGraphSpec runGraphSpec;
+        runGraphSpec.graphPath = filePath;
+        runGraphSpec.dirPath = k_unitTestDirPathRelative;
+        runGraphSpec.runSpec.execution = execution;
+
+        reporter.SetExecutionConfiguration(ExecutionConfiguration::Release);
+        reporter.SetExecutionMode(execution);
+        RunGraphImplementation(runGraphSpec, reporter);
+    }
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTestGraphsMatchInterpreted)
+{
+    RegisterNativeTestGraphs();
+    AZ_TEST_START_TRACE_SUPPRESSION;
+
+    for (const char* graphName : k_nativeTestGraphs)
+    {
+        Reporter interpreted;
+        ScriptCanvas_NativeGraphsCPP::RunTestGraph(graphName, ExecutionMode::Interpreted, interpreted);
+        VerifyReporter(interpreted);
+
+        Reporter native;
+        ScriptCanvas_NativeGraphsCPP::RunTestGraph(graphName, ExecutionMode::Native, native);
+        VerifyReporter(native);
+
+        EXPECT_EQ(ExecutionMode::Native, native.GetExecutionMode()) << graphName << " didn't execute natively, its methods aren't reflected with the translated signatures";
+        EXPECT_EQ(interpreted, native) << graphName;
+    }
+
+    AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    UnregisterNativeTestGraphs();
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTestGraphsExecuteInterpretedWithoutRegistration)
+{
+    AZ_TEST_START_TRACE_SUPPRESSION;
+
+    for (const char* graphName : k_nativeTestGraphs)
+    {
+        Reporter reporter;
+        ScriptCanvas_NativeGraphsCPP::RunTestGraph(graphName, ExecutionMode::Native, reporter);
+        VerifyReporter(reporter);
+        EXPECT_EQ(ExecutionMode::Interpreted, reporter.GetExecutionMode()) << graphName;
+    }
+
+    AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace ScriptCanvas_NativeGraphsCPP
+{
+    // Starts and stops the application of the ScriptCanvas tests for the benchmarks, like the fixture does for each test case
+    class BenchmarkApplication
+        : public ScriptCanvasTestFixture
+    {
+    public:
+        using ScriptCanvasTestFixture::SetUpTestCase;
+        using ScriptCanvasTestFixture::TearDownTestCase;
+    };
+
+    // Measures the activation of the native test graph of the range index, which executes it from graph start until it is
+    // complete, interpreted and with its compiled translation. The graph is loaded and translated to Lua once, the activation
+    // creates the execution state of the graph, like it does for the graphs of the entities of a level.
+    class NativeGraphBenchmark
+        : public ::benchmark::Fixture
+    {
+    public:
+        void internalSetUp(const benchmark::State& state)
+        {
+            BenchmarkApplication::SetUpTestCase();
+            RegisterNativeTestGraphs();
+
+            const char* graphName = k_nativeTestGraphs[state.range(0)];
+            const AZStd::string path = AZStd::string::format("%s/%s.scriptcanvas", k_unitTestDirPathRelative, graphName);
+            m_loadResult = LoadTestGraph(path, ExecutionMode::Native);
+            if (!m_loadResult.m_runtimeAsset)
+            {
+                return;
+            }
+
+            AZ::Outcome<Translation::LuaAssetResult, AZStd::string> luaAssetOutcome = AZ::Failure(AZStd::string("lua asset creation failed"));
+            EditorAssetConversionBus::BroadcastResult(luaAssetOutcome, &EditorAssetConversionBusTraits::CreateLuaAsset
+                , m_loadResult.m_editorAsset, m_loadResult.m_editorAsset.Path().c_str());
+            if (!luaAssetOutcome.IsSuccess())
+            {
+                return;
+            }
+
+            const Translation::LuaAssetResult& luaAssetResult = luaAssetOutcome.GetValue();
+            RuntimeData& runtimeData = m_loadResult.m_runtimeAsset.Get()->m_runtimeData;
+            m_loadResult.m_scriptAsset = luaAssetResult.m_scriptAsset;
+            runtimeData.m_script = luaAssetResult.m_scriptAsset;
+            runtimeData.m_input = luaAssetResult.m_runtimeInputs;
+            runtimeData.m_debugMap = luaAssetResult.m_debugMap;
+
+            RuntimeDataOverrides runtimeDataOverrides;
+            runtimeDataOverrides.m_runtimeAsset = m_loadResult.m_runtimeAsset;
+            CopyAssetEntityIdsToOverrides(runtimeDataOverrides);
+            m_loadResult.m_runtimeComponent = m_loadResult.m_entity->CreateComponent<RuntimeComponent>();
+            m_loadResult.m_runtimeComponent->TakeRuntimeDataOverrides(AZStd::move(runtimeDataOverrides));
+            Execution::Context::InitializeActivationData(runtimeData);
+            Execution::InitializeInterpretedStatics(runtimeData);
+            m_loadResult.m_entity->Init();
+        }
+
+        void internalTearDown()
+        {
+            const AZ::Data::AssetId scriptAssetId = m_loadResult.m_scriptAsset.GetId();
+            m_loadResult = LoadTestGraphResult();
+            AZ::ScriptSystemRequestBus::Broadcast(&AZ::ScriptSystemRequests::ClearAssetReferences, scriptAssetId);
+            AZ::ScriptSystemRequestBus::Broadcast(&AZ::ScriptSystemRequests::GarbageCollect);
+
+            UnregisterNativeTestGraphs();
+            BenchmarkApplication::TearDownTestCase();
+        }
+
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+    protected:
+        void ActivateGraph(benchmark::State& state, ExecutionMode execution)
+        {
+            if (!m_loadResult.m_runtimeComponent)
+            {
+                state.SkipWithError("the graph failed to load or translate");
+                return;
+            }
+
+            ScopedOutputSuppression outputSuppression;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                m_loadResult.m_entity->Activate();
+
+                if (m_loadResult.m_runtimeComponent->GetExecutionMode() != execution)
+                {
+                    m_loadResult.m_entity->Deactivate();
+                    state.SkipWithError("the graph executes interpreted, its methods aren't reflected with the translated signatures");
+                    return;
+                }
+
+                m_loadResult.m_entity->Deactivate();
+            }
+
+            state.SetItemsProcessed(state.iterations());
+        }
+
+        LoadTestGraphResult m_loadResult;
+    };
+
+    BENCHMARK_DEFINE_F(NativeGraphBenchmark, BM_ActivateInterpreted)(benchmark::State& state)
+    {
+        ActivateGraph(state, ExecutionMode::Interpreted);
+    }
+
+    BENCHMARK_DEFINE_F(NativeGraphBenchmark, BM_ActivateNative)(benchmark::State& state)
+    {
+        ScopedNativeExecution nativeExecution;
+        ActivateGraph(state, ExecutionMode::Native);
+    }
+
+    BENCHMARK_REGISTER_F(NativeGraphBenchmark, BM_ActivateInterpreted)->DenseRange(0, AZ_ARRAY_SIZE(k_nativeTestGraphs) - 1)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(NativeGraphBenchmark, BM_ActivateNative)->DenseRange(0, AZ_ARRAY_SIZE(k_nativeTestGraphs) - 1)->Unit(benchmark::kMicrosecond);
+}
+#endif
@@ -0,0 +1,20 @@
+#
+# Copyright (c) Contributors to the Open 3D Engine Project.
+# For complete copyright and license terms please see the LICENSE at the root of this distribution.
+#
+# SPDX-License-Identifier: Apache-2.0 OR MIT
+#
+#
+
+set(FILES
+    Source/Framework/ScriptCanvasTestFixture.h
+    Source/Framework/ScriptCanvasTestFixture.cpp
+    Source/Framework/ScriptCanvasTestNodes.h
+    Source/Framework/ScriptCanvasTestNodes.cpp
+    Source/Framework/ScriptCanvasTestUtilities.h
+    Source/Framework/ScriptCanvasTestUtilities.cpp
+    Source/Framework/ScriptCanvasTestApplication.h
+    Source/Framework/EntityRefTests.h
+    Tests/ScriptCanvasTestingTest.cpp
+    Tests/ScriptCanvas_NativeGraphs.cpp
+)